@@ -0,0 +1,863 @@
+/*********************************************************\
+ * Copyright (c) 2012-2020 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Benchmark/Private/Benchmark/Benchmark.h"
+#include "Benchmark/Private/BenchmarkReport.h"
+#ifdef BENCHMARK_HEAP_ALLOCATIONS
+	#include "Benchmark/Private/Benchmark/HeapAllocationCounter.h"
+#endif
+
+#include <Renderer/Public/Context.h>
+#include <Renderer/Public/IRenderer.h>
+#include <Renderer/Public/Core/IProfiler.h>
+#include <Renderer/Public/Core/Math/Math.h>
+#include <Renderer/Public/Core/Memory/FrameAllocator.h>
+#include <Renderer/Public/Core/TimestampProfiler.h>
+#include <Renderer/Public/Resource/Scene/SceneNode.h>
+#include <Renderer/Public/Resource/Scene/SceneResource.h>
+#include <Renderer/Public/Resource/Scene/SceneResourceManager.h>
+#include <Renderer/Public/Resource/Scene/Loader/SceneFileFormat.h>
+#include <Renderer/Public/Resource/Scene/Culling/SceneCullingManager.h>
+#include <Renderer/Public/Resource/Scene/Culling/SoftwareOcclusionCuller.h>
+#include <Renderer/Public/Resource/Scene/Item/Camera/CameraSceneItem.h>
+#include <Renderer/Public/Resource/Scene/Item/Light/SunlightSceneItem.h>
+#include <Renderer/Public/Resource/Scene/Item/Mesh/MeshSceneItem.h>
+#include <Renderer/Public/Resource/ShaderBlueprint/Cache/ShaderBuilder.h>
+#include <Renderer/Public/Resource/ShaderBlueprint/ShaderBlueprintResourceManager.h>
+#include <Renderer/Public/Resource/ShaderBlueprint/ShaderBlueprintResource.h>
+#include <Renderer/Public/Resource/CompositorWorkspace/CompositorWorkspaceInstance.h>
+#ifdef RENDERER_TOOLKIT
+	#include <Renderer/Public/Core/File/DefaultFileManager.h>
+	#include <Renderer/Public/Core/File/FileSystemHelper.h>
+
+	#include <RendererToolkit/Public/RendererToolkitInstance.h>
+
+	#include <Rhi/Public/DefaultLog.h>
+#endif
+
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4201)	// warning C4201: nonstandard extension used: nameless struct/union
+	PRAGMA_WARNING_DISABLE_MSVC(4365)	// warning C4365: 'argument': conversion from 'long' to 'unsigned int', signed/unsigned mismatch
+	PRAGMA_WARNING_DISABLE_MSVC(4464)	// warning C4464: relative include path contains '..'
+	PRAGMA_WARNING_DISABLE_MSVC(4324)	// warning C4324: '<x>': structure was padded due to alignment specifier
+	PRAGMA_WARNING_DISABLE_MSVC(4571)	// warning C4571: Informational: catch(...) semantics changed since Visual C++ 7.1; structured exceptions (SEH) are no longer caught
+	PRAGMA_WARNING_DISABLE_MSVC(4625)	// warning C4625: 'std::codecvt_base': copy constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4626)	// warning C4626: 'std::codecvt_base': assignment operator was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4668)	// warning C4668: '_M_HYBRID_X86_ARM64' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
+	PRAGMA_WARNING_DISABLE_MSVC(4774)	// warning C4774: 'sprintf_s' : format string expected in argument 3 is not a string literal
+	PRAGMA_WARNING_DISABLE_MSVC(5026)	// warning C5026: 'std::_Generic_error_category': move constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(5027)	// warning C5027: 'std::_Generic_error_category': move assignment operator was implicitly defined as deleted
+	#include <random>
+	#include <limits>
+	#ifdef RENDERER_TOOLKIT
+		#include <mutex>
+		#include <cstdio>
+		#include <cstring>
+		#include <fstream>
+		#include <exception>
+	#endif
+PRAGMA_WARNING_POP
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Global definitions                                    ]
+		//[-------------------------------------------------------]
+		static constexpr uint32_t MESH_ASSET_ID			   = ASSET_ID("Example/Mesh/Imrod/SM_Imrod");
+		static constexpr uint32_t SCENE_LOAD_REPETITIONS   = 5;
+		static constexpr uint32_t COMMAND_BUFFER_FRAMES	   = 20;	// The first frame isn't warmed up and not measured
+		static constexpr uint32_t NESTED_SUBMISSIONS	   = 4;		// Number of nested command buffer submissions per frame and submission type
+		#ifdef RENDERER_TOOLKIT
+			static constexpr uint32_t	 TEXTURE_COMPILE_REPETITIONS  = 3;
+			static constexpr const char* TEXTURE_COMPILE_PROJECT_NAME = "TextureCompileBenchmark";	// Project directory inside the local data directory, the project name is the directory name
+			static constexpr const char* TEXTURE_COMPILE_RHI_TARGET	  = "Direct3D11_50";
+
+
+			//[-------------------------------------------------------]
+			//[ Classes                                               ]
+			//[-------------------------------------------------------]
+			/**
+			*  @brief
+			*    Log gathering the per-stage timings the texture asset compiler logs for each compiled texture
+			*
+			*  @note
+			*    - Only warnings and errors are forwarded to the default log implementation to not flood the output with the asset compilation progress
+			*/
+			class TextureCompileLog final : public Rhi::DefaultLog
+			{
+
+
+			//[-------------------------------------------------------]
+			//[ Public definitions                                    ]
+			//[-------------------------------------------------------]
+			public:
+				struct StageMilliseconds final
+				{
+					BenchmarkReport::Values loadAndProcess;	///< Loading the source images and e.g. channel packing, mipmap generation and Toksvig specular anti-aliasing
+					BenchmarkReport::Values compress;
+					BenchmarkReport::Values write;
+				};
+
+
+			//[-------------------------------------------------------]
+			//[ Public methods                                        ]
+			//[-------------------------------------------------------]
+			public:
+				inline TextureCompileLog()
+				{
+					// Nothing here
+				}
+
+				inline virtual ~TextureCompileLog() override
+				{
+					// Nothing here
+				}
+
+				/**
+				*  @brief
+				*    Return the gathered per-stage timings, one entry per compiled texture
+				*
+				*  @note
+				*    - Don't call this method while assets are compiled
+				*/
+				[[nodiscard]] inline const StageMilliseconds& getStageMilliseconds() const
+				{
+					return mStageMilliseconds;
+				}
+
+
+			//[-------------------------------------------------------]
+			//[ Protected virtual Rhi::DefaultLog methods             ]
+			//[-------------------------------------------------------]
+			protected:
+				[[nodiscard]] inline virtual bool printInternal(Type type, const char* attachment, const char* file, uint32_t line, const char* message, uint32_t numberOfCharacters) override
+				{
+					if (Type::DEBUG == type)
+					{
+						// Texture asset compiler message: "Texture "<filename>" <width>x<height> using up to <n> threads: Load and process <ms> ms, compress <ms> ms, write <ms> ms"
+						const char* stages = strstr(message, ": Load and process ");
+						double loadAndProcessMilliseconds = 0.0;
+						double compressMilliseconds = 0.0;
+						double writeMilliseconds = 0.0;
+						if (nullptr != stages && 3 == sscanf(stages, ": Load and process %lf ms, compress %lf ms, write %lf ms", &loadAndProcessMilliseconds, &compressMilliseconds, &writeMilliseconds))
+						{
+							// Asset compilers might run in parallel
+							std::lock_guard<std::mutex> stageMutexLock(mStageMutex);
+							mStageMilliseconds.loadAndProcess.push_back(loadAndProcessMilliseconds);
+							mStageMilliseconds.compress.push_back(compressMilliseconds);
+							mStageMilliseconds.write.push_back(writeMilliseconds);
+						}
+						return false;
+					}
+					return (type >= Type::WARNING) ? DefaultLog::printInternal(type, attachment, file, line, message, numberOfCharacters) : false;
+				}
+
+
+			//[-------------------------------------------------------]
+			//[ Private methods                                       ]
+			//[-------------------------------------------------------]
+			private:
+				explicit TextureCompileLog(const TextureCompileLog&) = delete;
+				TextureCompileLog& operator=(const TextureCompileLog&) = delete;
+
+
+			//[-------------------------------------------------------]
+			//[ Private data                                          ]
+			//[-------------------------------------------------------]
+			private:
+				std::mutex		  mStageMutex;
+				StageMilliseconds mStageMilliseconds;
+
+
+			};
+
+
+			//[-------------------------------------------------------]
+			//[ Global functions                                      ]
+			//[-------------------------------------------------------]
+			/**
+			*  @brief
+			*    Write an uncompressed 24 bit true color TGA image
+			*
+			*  @param[in] filename
+			*    Filename of the image to write
+			*  @param[in] size
+			*    Width and height of the image
+			*  @param[in] function
+			*    Function with the signature "void(uint32_t x, uint32_t y, uint8_t rgb[3])" returning the color of each texel
+			*
+			*  @return
+			*    "true" if all went fine, else "false"
+			*/
+			template <typename FUNCTION>
+			[[nodiscard]] bool writeTgaImage(const std_filesystem::path& filename, uint32_t size, const FUNCTION& function)
+			{
+				// Header with a top-left origin, TGA stores the channels in BGR order
+				const uint8_t header[18] = { 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, static_cast<uint8_t>(size & 0xff), static_cast<uint8_t>(size >> 8), static_cast<uint8_t>(size & 0xff), static_cast<uint8_t>(size >> 8), 24, 0x20 };
+				std::vector<uint8_t> texels(static_cast<size_t>(size) * size * 3);
+				uint8_t* texel = texels.data();
+				for (uint32_t y = 0; y < size; ++y)
+				{
+					for (uint32_t x = 0; x < size; ++x, texel += 3)
+					{
+						uint8_t rgb[3] = {};
+						function(x, y, rgb);
+						texel[0] = rgb[2];
+						texel[1] = rgb[1];
+						texel[2] = rgb[0];
+					}
+				}
+				std::ofstream outputFileStream(filename, std::ios::binary);
+				outputFileStream.write(reinterpret_cast<const char*>(header), sizeof(header));
+				outputFileStream.write(reinterpret_cast<const char*>(texels.data()), static_cast<std::streamsize>(texels.size()));
+				return outputFileStream.good();
+			}
+
+			/**
+			*  @brief
+			*    Write a texture asset using the given texture channel packing
+			*
+			*  @param[in] filename
+			*    Filename of the asset to write
+			*  @param[in] textureChannelPacking
+			*    Texture channel packing name as defined inside the targets
+			*  @param[in] inputFiles
+			*    JSON object members with the input files, e.g. ""ALBEDO_MAP": "./Albedo.tga""
+			*  @param[in] toksvigSpecularAntiAliasing
+			*    "true" to enable Toksvig specular anti-aliasing, else "false"
+			*
+			*  @return
+			*    "true" if all went fine, else "false"
+			*/
+			[[nodiscard]] bool writeTextureAsset(const std_filesystem::path& filename, const char* textureChannelPacking, const char* inputFiles, bool toksvigSpecularAntiAliasing)
+			{
+				std::ofstream outputFileStream(filename);
+				outputFileStream << "{\n\t\"Format\":\n\t{\n\t\t\"Type\": \"Asset\",\n\t\t\"Version\": \"1\"\n\t},\n";
+				outputFileStream << "\t\"Asset\":\n\t{\n\t\t\"Compiler\":\n\t\t{\n";
+				outputFileStream << "\t\t\t\"ClassName\": \"RendererToolkit::TextureAssetCompiler\",\n";
+				outputFileStream << "\t\t\t\"TextureSemantic\": \"PACKED_CHANNELS\",\n";
+				outputFileStream << "\t\t\t\"TextureChannelPacking\": \"" << textureChannelPacking << "\",\n";
+				if (toksvigSpecularAntiAliasing)
+				{
+					outputFileStream << "\t\t\t\"ToksvigSpecularAntiAliasing\": \"TRUE\",\n";
+				}
+				outputFileStream << "\t\t\t\"InputFiles\":\n\t\t\t{\n" << inputFiles << "\n\t\t\t}\n\t\t}\n\t}\n}\n";
+				return outputFileStream.good();
+			}
+		#endif
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
+
+
+//[-------------------------------------------------------]
+//[ Public methods                                        ]
+//[-------------------------------------------------------]
+Benchmark::Benchmark() :
+	mCompositorWorkspaceInstance(nullptr),
+	mFirstMeasuredFrameNumber(std::numeric_limits<uint64_t>::max())
+{
+	// Nothing here
+}
+
+
+//[-------------------------------------------------------]
+//[ Protected virtual IBenchmarkApplication methods       ]
+//[-------------------------------------------------------]
+void Benchmark::readParameters(const Arguments& arguments)
+{
+	// Call the base implementation
+	IBenchmarkApplication::readParameters(arguments);
+
+	// Read the benchmark parameters
+	readArgument(arguments, "compositor", mBenchmarkParameters.compositorWorkspace);
+	readArgument(arguments, "trace", mBenchmarkParameters.traceVirtualFilename);
+	readArgument(arguments, "frameAllocator", mBenchmarkParameters.frameAllocator);
+	readArgument(arguments, "sceneLoadProps", mBenchmarkParameters.sceneLoadProps);
+	readArgument(arguments, "commandBufferDraws", mBenchmarkParameters.commandBufferDraws);
+	readArgument(arguments, "shaderBuilderPermutations", mBenchmarkParameters.shaderBuilderPermutations);
+	readArgument(arguments, "textureCompileSize", mBenchmarkParameters.textureCompileSize);
+	readArgument(arguments, "textureCompileThreads", mBenchmarkParameters.textureCompileThreads);
+
+	// Sanity check: The synthetic source textures are written as TGA images which are limited to 16 bit dimensions, stay at the usual maximum texture size
+	mBenchmarkParameters.textureCompileSize = std::min(mBenchmarkParameters.textureCompileSize, 16384u);
+}
+
+bool Benchmark::onInitialization()
+{
+	// Call the base implementation
+	if (!IBenchmarkApplication::onInitialization())
+	{
+		// Error!
+		return false;
+	}
+	Renderer::IRenderer& renderer = getRendererSafe();
+	renderer.getFrameAllocator().setEnabled(0 != mBenchmarkParameters.frameAllocator);
+
+	{ // Create the offscreen framebuffer object (FBO) the compositor renders into
+		const Rhi::TextureFormat::Enum colorTextureFormat = Rhi::TextureFormat::Enum::R8G8B8A8;
+		const Rhi::TextureFormat::Enum depthTextureFormat = Rhi::TextureFormat::Enum::D32_FLOAT;
+		Rhi::ITextureManager& textureManager = renderer.getTextureManager();
+		Rhi::IRenderPass* renderPass = mRhi->createRenderPass(1, &colorTextureFormat, depthTextureFormat, 1 RHI_RESOURCE_DEBUG_NAME("Benchmark"));
+		const Rhi::FramebufferAttachment colorFramebufferAttachment(textureManager.createTexture2D(mParameters.width, mParameters.height, colorTextureFormat, nullptr, Rhi::TextureFlag::SHADER_RESOURCE | Rhi::TextureFlag::RENDER_TARGET, Rhi::TextureUsage::DEFAULT, 1, nullptr RHI_RESOURCE_DEBUG_NAME("Benchmark color")));
+		const Rhi::FramebufferAttachment depthFramebufferAttachment(textureManager.createTexture2D(mParameters.width, mParameters.height, depthTextureFormat, nullptr, Rhi::TextureFlag::SHADER_RESOURCE | Rhi::TextureFlag::RENDER_TARGET, Rhi::TextureUsage::DEFAULT, 1, nullptr RHI_RESOURCE_DEBUG_NAME("Benchmark depth")));
+		mFramebuffer = mRhi->createFramebuffer(*renderPass, &colorFramebufferAttachment, &depthFramebufferAttachment RHI_RESOURCE_DEBUG_NAME("Benchmark"));
+	}
+
+	{ // Create the compositor workspace instance
+		if ("Forward" != mBenchmarkParameters.compositorWorkspace && "Deferred" != mBenchmarkParameters.compositorWorkspace && "Debug" != mBenchmarkParameters.compositorWorkspace)
+		{
+			RHI_LOG(mRhi->getContext(), WARNING, "The benchmark doesn't know the compositor workspace \"%s\", using \"Forward\" as fallback", mBenchmarkParameters.compositorWorkspace.c_str())
+			mBenchmarkParameters.compositorWorkspace = "Forward";
+		}
+		const Renderer::AssetId compositorWorkspaceAssetId = ("Deferred" == mBenchmarkParameters.compositorWorkspace) ? ASSET_ID("Example/CompositorWorkspace/CW_Deferred") : (("Debug" == mBenchmarkParameters.compositorWorkspace) ? ASSET_ID("Example/CompositorWorkspace/CW_Debug") : ASSET_ID("Example/CompositorWorkspace/CW_Forward"));
+		mCompositorWorkspaceInstance = new Renderer::CompositorWorkspaceInstance(renderer, compositorWorkspaceAssetId);
+	}
+
+	// Done
+	return true;
+}
+
+void Benchmark::onDeinitialization()
+{
+	// Release the used resources
+	if (nullptr != mCompositorWorkspaceInstance)
+	{
+		delete mCompositorWorkspaceInstance;
+		mCompositorWorkspaceInstance = nullptr;
+	}
+	mFramebuffer = nullptr;
+
+	// Call the base implementation
+	IBenchmarkApplication::onDeinitialization();
+}
+
+bool Benchmark::onDoJob()
+{
+	const Rhi::Context& rhiContext = mRhi->getContext();
+	BenchmarkReport report;
+	addParametersToReport(report);
+	report.addString("compositor", mBenchmarkParameters.compositorWorkspace);
+
+	// Optional micro benchmarks, the scene load one replaces the scene content
+	if (mBenchmarkParameters.textureCompileSize > 0)
+	{
+		measureTextureCompile(report);
+	}
+	if (mBenchmarkParameters.commandBufferDraws > 0)
+	{
+		measureCommandBuffer(report);
+	}
+	if (mBenchmarkParameters.sceneLoadProps > 0)
+	{
+		measureSceneLoad(report);
+	}
+	if (!createSyntheticScene())
+	{
+		// Error!
+		RHI_LOG(rhiContext, CRITICAL, "The benchmark failed to create the synthetic scene")
+		return false;
+	}
+	if (mBenchmarkParameters.shaderBuilderPermutations > 0)
+	{
+		measureShaderBuilder(report);
+	}
+
+	// Render the frames
+	measureFrames(report);
+
+	// Write the JSON report and the optional Chrome trace
+	bool result = report.write(mParameters.outputFilename);
+	if (!result)
+	{
+		RHI_LOG(rhiContext, CRITICAL, "The benchmark failed to write the report \"%s\"", mParameters.outputFilename.c_str())
+	}
+	if (!mBenchmarkParameters.traceVirtualFilename.empty() && !mTimestampProfiler->exportChromeTrace(*mFileManager, mBenchmarkParameters.traceVirtualFilename.c_str()))
+	{
+		RHI_LOG(rhiContext, CRITICAL, "The benchmark failed to write the Chrome trace \"%s\"", mBenchmarkParameters.traceVirtualFilename.c_str())
+		result = false;
+	}
+
+	// Done
+	return result;
+}
+
+
+//[-------------------------------------------------------]
+//[ Private methods                                       ]
+//[-------------------------------------------------------]
+void Benchmark::measureFrames(BenchmarkReport& report)
+{
+	Renderer::IRenderer& renderer = getRendererSafe();
+	Counts heapAllocationsPerFrame;
+	Counts frameAllocationsPerFrame;
+	Counts frameOverflowAllocationsPerFrame;
+	Counts occludedSceneItemsPerFrame;
+
+	// Render the warmup and the measured frames
+	const uint32_t numberOfFrames = mParameters.numberOfWarmupFrames + mParameters.numberOfMeasuredFrames;
+	mGatheredFrames.assign(mParameters.numberOfMeasuredFrames, false);
+	for (uint32_t frameIndex = 0; frameIndex < numberOfFrames; ++frameIndex)
+	{
+		if (frameIndex == mParameters.numberOfWarmupFrames)
+		{
+			// Finish the resource streaming and pipeline state compilation requested during the warmup so it doesn't disturb the measured frames
+			renderer.flushAllQueues();
+			mFirstMeasuredFrameNumber = mTimestampProfiler->getCurrentFrameNumber();
+		}
+		updateCameraPath(frameIndex);
+		const uint64_t numberOfHeapAllocations = mNumberOfHeapAllocations;
+		{
+			RENDERER_PROFILER_SCOPED_CPU_SAMPLE(renderer.getContext(), "Renderer update")
+			renderer.update();
+		}
+		if (frameIndex > mParameters.numberOfWarmupFrames)
+		{
+			// The frame allocator statistics are the ones of the previous frame
+			const Renderer::FrameAllocator::Statistics& frameAllocatorStatistics = renderer.getFrameAllocator().getStatistics();
+			frameAllocationsPerFrame.push_back(static_cast<double>(frameAllocatorStatistics.numberOfAllocations));
+			frameOverflowAllocationsPerFrame.push_back(static_cast<double>(frameAllocatorStatistics.numberOfOverflowAllocations));
+		}
+		{
+			RENDERER_PROFILER_SCOPED_CPU_SAMPLE(renderer.getContext(), "Compositor workspace execution")
+			mCompositorWorkspaceInstance->execute(*mFramebuffer, mCameraSceneItem, mSunlightSceneItem);
+		}
+		mTimestampProfiler->nextFrame();
+		if (frameIndex >= mParameters.numberOfWarmupFrames)
+		{
+			heapAllocationsPerFrame.push_back(static_cast<double>(mNumberOfHeapAllocations - numberOfHeapAllocations));
+			const Renderer::SoftwareOcclusionCuller* softwareOcclusionCuller = mCameraSceneItem->getSceneResource().getSceneCullingManager().getSoftwareOcclusionCuller();
+			if (nullptr != softwareOcclusionCuller)
+			{
+				occludedSceneItemsPerFrame.push_back(static_cast<double>(softwareOcclusionCuller->getStatistics().numberOfOccludedSceneItems));
+			}
+		}
+		gatherResolvedFrames();
+	}
+
+	// Wait for the GPU so the timestamps of the last measured frames can be resolved as well
+	mRhi->finish();
+	mTimestampProfiler->nextFrame();
+	gatherResolvedFrames();
+
+	// Frame timings
+	report.addBool("gpuSamplingSupported", mTimestampProfiler->isGpuSamplingSupported());
+	report.addNumber("gatheredFrames", static_cast<uint64_t>(mCpuFrameMilliseconds.size()));
+	report.addStatistics("cpuFrame", mCpuFrameMilliseconds);
+	report.addStatistics("gpuFrame", mGpuFrameMilliseconds);
+
+	{ // Phase timings
+		const auto addPhases = [&report](const char* name, const PhaseMilliseconds& phaseMilliseconds)
+		{
+			report.beginObject(name);
+			for (const auto& pair : phaseMilliseconds)
+			{
+				report.addStatistics(pair.first.c_str(), pair.second);
+			}
+			report.endObject();
+		};
+		addPhases("cpuPhases", mCpuPhaseMilliseconds);
+		addPhases("gpuPhases", mGpuPhaseMilliseconds);
+	}
+
+	{ // Memory statistics
+		const Renderer::FrameAllocator::Statistics& frameAllocatorStatistics = renderer.getFrameAllocator().getStatistics();
+		report.addStatistics("heapAllocationsPerFrame", heapAllocationsPerFrame);
+		report.beginObject("frameAllocator");
+		report.addBool("enabled", 0 != mBenchmarkParameters.frameAllocator);
+		report.addNumber("bytesPerArena", static_cast<uint64_t>(frameAllocatorStatistics.numberOfBytesPerArena));
+		report.addNumber("peakUsedBytes", static_cast<uint64_t>(frameAllocatorStatistics.peakNumberOfUsedBytes));
+		report.addStatistics("allocationsPerFrame", frameAllocationsPerFrame);
+		report.addStatistics("overflowAllocationsPerFrame", frameOverflowAllocationsPerFrame);
+		report.endObject();
+	}
+
+	// Culling statistics, the occlusion culling timings are part of the CPU phases
+	report.addStatistics("occludedSceneItemsPerFrame", occludedSceneItemsPerFrame);
+}
+
+void Benchmark::measureShaderBuilder(BenchmarkReport& report)
+{
+	Renderer::IRenderer& renderer = getRendererSafe();
+
+	// Gather the loaded shader blueprint resources
+	const Renderer::ShaderBlueprintResourceManager& shaderBlueprintResourceManager = renderer.getShaderBlueprintResourceManager();
+	std::vector<const Renderer::ShaderBlueprintResource*> shaderBlueprintResources;
+	for (uint32_t i = 0; i < shaderBlueprintResourceManager.getNumberOfResources(); ++i)
+	{
+		const Renderer::IResource& resource = shaderBlueprintResourceManager.getResourceByIndex(i);
+		if (Renderer::IResource::LoadingState::LOADED == resource.getLoadingState())
+		{
+			shaderBlueprintResources.push_back(static_cast<const Renderer::ShaderBlueprintResource*>(&resource));
+		}
+	}
+	report.beginObject("shaderBuilder");
+	report.addNumber("permutations", static_cast<uint64_t>(mBenchmarkParameters.shaderBuilderPermutations));
+	report.addNumber("shaderBlueprints", static_cast<uint64_t>(shaderBlueprintResources.size()));
+	if (shaderBlueprintResources.empty())
+	{
+		RHI_LOG(mRhi->getContext(), WARNING, "The benchmark found no loaded shader blueprint for the shader builder micro benchmark")
+		report.endObject();
+		return;
+	}
+
+	// Create the random shader properties up-front so only the shader builder is measured, the shader blueprints are used round-robin
+	// -> Each shader property referenced by the shader blueprint gets a random value of 0 or 1, most shader properties are boolean ones
+	std::minstd_rand randomGenerator(RANDOM_SEED);
+	std::vector<Renderer::ShaderProperties> shaderPropertiesVector(mBenchmarkParameters.shaderBuilderPermutations);
+	for (uint32_t i = 0; i < mBenchmarkParameters.shaderBuilderPermutations; ++i)
+	{
+		const Renderer::ShaderBlueprintResource& shaderBlueprintResource = *shaderBlueprintResources[i % shaderBlueprintResources.size()];
+		for (const Renderer::ShaderProperties::Property& property : shaderBlueprintResource.getReferencedShaderProperties().getSortedPropertyVector())
+		{
+			shaderPropertiesVector[i].setPropertyValue(property.shaderPropertyId, static_cast<int32_t>(randomGenerator() & 1u));
+		}
+	}
+
+	// Warm up the shader builder with one permutation per shader blueprint, a shader builder instance is meant to be reused
+	const Renderer::ShaderPieceResourceManager& shaderPieceResourceManager = renderer.getShaderPieceResourceManager();
+	Renderer::ShaderBuilder shaderBuilder(mRhi->getContext());
+	for (size_t i = 0; i < shaderBlueprintResources.size() && i < shaderPropertiesVector.size(); ++i)
+	{
+		Renderer::ShaderBuilder::BuildShader buildShader;
+		shaderBuilder.createSourceCode(shaderPieceResourceManager, *shaderBlueprintResources[i], shaderPropertiesVector[i], buildShader);
+	}
+
+	// Measure, the build shader is a local variable like when building shaders inside the renderer
+	#ifdef BENCHMARK_HEAP_ALLOCATIONS
+		const HeapAllocationCounter heapAllocationCounter;
+	#endif
+	const BenchmarkReport::TimePoint startTime = BenchmarkReport::now();
+	for (uint32_t i = 0; i < mBenchmarkParameters.shaderBuilderPermutations; ++i)
+	{
+		Renderer::ShaderBuilder::BuildShader buildShader;
+		shaderBuilder.createSourceCode(shaderPieceResourceManager, *shaderBlueprintResources[i % shaderBlueprintResources.size()], shaderPropertiesVector[i], buildShader);
+	}
+	const double seconds = BenchmarkReport::getMilliseconds(startTime, BenchmarkReport::now()) * 0.001;
+	report.addNumber("permutationsPerSecond", (seconds > 0.0) ? static_cast<double>(mBenchmarkParameters.shaderBuilderPermutations) / seconds : 0.0);
+	#ifdef BENCHMARK_HEAP_ALLOCATIONS
+		report.addNumber("heapAllocationsPerPermutation", static_cast<double>(heapAllocationCounter.getNumberOfHeapAllocations()) / static_cast<double>(mBenchmarkParameters.shaderBuilderPermutations));
+	#endif
+	report.endObject();
+}
+
+void Benchmark::measureSceneLoad(BenchmarkReport& report)
+{
+	Renderer::SceneResource& sceneResource = getRendererSafe().getSceneResourceManager().getById(mSceneResourceId);
+
+	// Packed mesh scene item data like it's inside a prefab of the scene file format
+	const Renderer::v1Scene::MeshItem meshItem = { Renderer::AssetId(::detail::MESH_ASSET_ID), 0 };
+	const uint32_t gridSize = getGridSize(mBenchmarkParameters.sceneLoadProps);
+	BenchmarkReport::Values createMilliseconds;
+	BenchmarkReport::Values destroyMilliseconds;
+	#ifdef BENCHMARK_HEAP_ALLOCATIONS
+		BenchmarkReport::Values heapAllocationsPerProp;
+	#endif
+	for (uint32_t repetitionIndex = 0; repetitionIndex < ::detail::SCENE_LOAD_REPETITIONS; ++repetitionIndex)
+	{
+		sceneResource.destroyAllSceneNodesAndItems();
+
+		// Create, mirrors the prefab instances deserialization of the scene resource loader
+		#ifdef BENCHMARK_HEAP_ALLOCATIONS
+			const HeapAllocationCounter heapAllocationCounter;
+		#endif
+		const BenchmarkReport::TimePoint createStartTime = BenchmarkReport::now();
+		sceneResource.reserveSceneNodesAndItems(mBenchmarkParameters.sceneLoadProps, mBenchmarkParameters.sceneLoadProps);
+		for (uint32_t i = 0; i < mBenchmarkParameters.sceneLoadProps; ++i)
+		{
+			const glm::dvec3 position(static_cast<double>(i % gridSize) * GRID_SPACING, 0.0, static_cast<double>(i / gridSize) * GRID_SPACING);
+			Renderer::SceneNode* sceneNode = sceneResource.createSceneNode(Renderer::Transform(position, Renderer::Math::QUAT_IDENTITY, glm::vec3(MESH_SCALE)));
+			Renderer::ISceneItem* sceneItem = sceneResource.createSceneItem(Renderer::MeshSceneItem::TYPE_ID, *sceneNode);
+			if (nullptr != sceneItem)
+			{
+				sceneItem->deserialize(sizeof(Renderer::v1Scene::MeshItem), reinterpret_cast<const uint8_t*>(&meshItem));
+			}
+		}
+		const BenchmarkReport::TimePoint destroyStartTime = BenchmarkReport::now();
+		#ifdef BENCHMARK_HEAP_ALLOCATIONS
+			heapAllocationsPerProp.push_back(static_cast<double>(heapAllocationCounter.getNumberOfHeapAllocations()) / static_cast<double>(mBenchmarkParameters.sceneLoadProps));
+		#endif
+
+		// Destroy
+		sceneResource.destroyAllSceneNodesAndItems();
+		const BenchmarkReport::TimePoint endTime = BenchmarkReport::now();
+
+		// Gather
+		createMilliseconds.push_back(BenchmarkReport::getMilliseconds(createStartTime, destroyStartTime));
+		destroyMilliseconds.push_back(BenchmarkReport::getMilliseconds(destroyStartTime, endTime));
+	}
+
+	// Report
+	report.beginObject("sceneLoad");
+	report.addNumber("props", static_cast<uint64_t>(mBenchmarkParameters.sceneLoadProps));
+	report.addStatistics("createMilliseconds", createMilliseconds);
+	report.addStatistics("destroyMilliseconds", destroyMilliseconds);
+	#ifdef BENCHMARK_HEAP_ALLOCATIONS
+		report.addStatistics("heapAllocationsPerProp", heapAllocationsPerProp);
+	#endif
+	report.endObject();
+}
+
+void Benchmark::measureCommandBuffer(BenchmarkReport& report)
+{
+	// The command buffers are reused each frame like inside the renderer, so only the first frame has to grow them
+	Rhi::CommandBuffer innerCommandBuffer;
+	Rhi::CommandBuffer outerCommandBuffer;
+	BenchmarkReport::Values recordMilliseconds;
+	BenchmarkReport::Values copySubmissionMilliseconds;
+	BenchmarkReport::Values referenceSubmissionMilliseconds;
+	#ifdef BENCHMARK_HEAP_ALLOCATIONS
+		uint64_t numberOfFirstFrameHeapAllocations = 0;
+		BenchmarkReport::Values heapAllocationsPerFrame;
+	#endif
+	for (uint32_t frameIndex = 0; frameIndex < ::detail::COMMAND_BUFFER_FRAMES; ++frameIndex)
+	{
+		#ifdef BENCHMARK_HEAP_ALLOCATIONS
+			const HeapAllocationCounter heapAllocationCounter;
+		#endif
+		innerCommandBuffer.clear();
+		outerCommandBuffer.clear();
+
+		// Record
+		const BenchmarkReport::TimePoint recordStartTime = BenchmarkReport::now();
+		for (uint32_t i = 0; i < mBenchmarkParameters.commandBufferDraws; ++i)
+		{
+			Rhi::Command::DrawIndexedGraphics::create(innerCommandBuffer, 3 + i % 100);
+		}
+
+		// Nested submission by copying the command packets
+		const BenchmarkReport::TimePoint copySubmissionStartTime = BenchmarkReport::now();
+		for (uint32_t i = 0; i < ::detail::NESTED_SUBMISSIONS; ++i)
+		{
+			innerCommandBuffer.submitToCommandBuffer(outerCommandBuffer);
+		}
+
+		// Nested submission by reference
+		const BenchmarkReport::TimePoint referenceSubmissionStartTime = BenchmarkReport::now();
+		for (uint32_t i = 0; i < ::detail::NESTED_SUBMISSIONS; ++i)
+		{
+			innerCommandBuffer.submitToCommandBufferByReference(outerCommandBuffer);
+		}
+		const BenchmarkReport::TimePoint endTime = BenchmarkReport::now();
+
+		// Gather
+		#ifdef BENCHMARK_HEAP_ALLOCATIONS
+			if (0 == frameIndex)
+			{
+				numberOfFirstFrameHeapAllocations = heapAllocationCounter.getNumberOfHeapAllocations();
+			}
+			else
+			{
+				heapAllocationsPerFrame.push_back(static_cast<double>(heapAllocationCounter.getNumberOfHeapAllocations()));
+			}
+		#endif
+		if (0 != frameIndex)
+		{
+			recordMilliseconds.push_back(BenchmarkReport::getMilliseconds(recordStartTime, copySubmissionStartTime));
+			copySubmissionMilliseconds.push_back(BenchmarkReport::getMilliseconds(copySubmissionStartTime, referenceSubmissionStartTime));
+			referenceSubmissionMilliseconds.push_back(BenchmarkReport::getMilliseconds(referenceSubmissionStartTime, endTime));
+		}
+	}
+
+	// Report
+	report.beginObject("commandBuffer");
+	report.addNumber("draws", static_cast<uint64_t>(mBenchmarkParameters.commandBufferDraws));
+	report.addNumber("nestedSubmissions", static_cast<uint64_t>(::detail::NESTED_SUBMISSIONS));
+	report.addStatistics("recordMilliseconds", recordMilliseconds);
+	report.addStatistics("copySubmissionMilliseconds", copySubmissionMilliseconds);
+	report.addStatistics("referenceSubmissionMilliseconds", referenceSubmissionMilliseconds);
+	#ifdef BENCHMARK_HEAP_ALLOCATIONS
+		report.addNumber("firstFrameHeapAllocations", numberOfFirstFrameHeapAllocations);
+		report.addStatistics("heapAllocationsPerFrame", heapAllocationsPerFrame);
+	#endif
+	report.endObject();
+}
+
+void Benchmark::measureTextureCompile([[maybe_unused]] BenchmarkReport& report)
+{
+	const Rhi::Context& rhiContext = mRhi->getContext();
+	#ifdef RENDERER_TOOLKIT
+		// Setup the renderer toolkit, the log gathers the per-stage timings of the texture asset compiler
+		::detail::TextureCompileLog textureCompileLog;
+		Renderer::DefaultFileManager defaultFileManager(textureCompileLog, rhiContext.getAssert(), rhiContext.getAllocator(), mFileManager->getAbsoluteRootDirectory());
+		RendererToolkit::Context rendererToolkitContext(textureCompileLog, rhiContext.getAssert(), rhiContext.getAllocator(), defaultFileManager);
+		RendererToolkit::RendererToolkitInstance rendererToolkitInstance(rendererToolkitContext);
+		RendererToolkit::IRendererToolkit* rendererToolkit = rendererToolkitInstance.getRendererToolkit();
+		if (nullptr == rendererToolkit)
+		{
+			RHI_LOG(rhiContext, CRITICAL, "The benchmark failed to load the renderer toolkit, skipping the texture compile micro benchmark")
+			return;
+		}
+
+		// Write the synthetic project: An albedo map with a packed normal map and a roughness map with a packed Toksvig specular anti-aliased normal map, like the example project
+		// -> The output cache is disabled, else compiling the same source textures again would only copy the cached output
+		// -> The targets of the example project are used, shippable executable binaries are inside e.g. "unrimp/Binary/Windows_x64_Shared" while
+		//    development data source is located at "unrimp/Example/DataSource/Example"
+		const std_filesystem::path rootDirectory = std_filesystem::u8path(mFileManager->getAbsoluteRootDirectory());
+		const std_filesystem::path projectDirectory = rootDirectory / defaultFileManager.getLocalDataMountPoint() / ::detail::TEXTURE_COMPILE_PROJECT_NAME;
+		const std_filesystem::path contentDirectory = projectDirectory / "Content";
+		{
+			std::error_code errorCode;
+			std_filesystem::create_directories(contentDirectory, errorCode);
+			std_filesystem::copy_file(rootDirectory / ".." / "Example" / "DataSource" / "Example" / "Example.targets", projectDirectory / "Example.targets", std_filesystem::copy_options::overwrite_existing, errorCode);
+			if (errorCode)
+			{
+				RHI_LOG(rhiContext, CRITICAL, "The benchmark failed to setup the texture compile project \"%s\": %s", projectDirectory.generic_string().c_str(), errorCode.message().c_str())
+				return;
+			}
+		}
+		{
+			std::ofstream outputFileStream(projectDirectory / (std::string(::detail::TEXTURE_COMPILE_PROJECT_NAME) + ".project"));
+			outputFileStream << "{\n\t\"Format\":\n\t{\n\t\t\"Type\": \"Project\",\n\t\t\"Version\": \"1\"\n\t},\n";
+			outputFileStream << "\t\"Project\":\n\t{\n\t\t\"AssetPackages\": [\"Content\"],\n\t\t\"TargetsFilename\": \"Example.targets\",\n\t\t\"QualityStrategy\": \"PRODUCTION\",\n";
+			outputFileStream << "\t\t\"NumberOfThreadsPerAssetCompiler\": " << mBenchmarkParameters.textureCompileThreads << ",\n\t\t\"OutputCacheSizeLimitInMiB\": 0\n\t}\n}\n";
+			if (!outputFileStream.good() ||
+				!::detail::writeTextureAsset(contentDirectory / "T_Synthetic_argb_nxa.asset", "_argb_nxa", "\t\t\t\t\"ALBEDO_MAP\": \"./Albedo.tga\",\n\t\t\t\t\"NORMAL_MAP\": \"./Normal.tga\"", false) ||
+				!::detail::writeTextureAsset(contentDirectory / "T_Synthetic_hr_rg_mb_nya.asset", "_hr_rg_mb_nya", "\t\t\t\t\"ROUGHNESS_MAP\": \"./Roughness.tga\",\n\t\t\t\t\"NORMAL_MAP\": \"./Normal.tga\"", true))
+			{
+				RHI_LOG(rhiContext, CRITICAL, "The benchmark failed to write the texture compile project \"%s\"", projectDirectory.generic_string().c_str())
+				return;
+			}
+		}
+
+		// Compile
+		// -> Each repetition writes new source textures, else the renderer toolkit would skip the unchanged assets, this includes the ones of previous benchmark runs
+		// -> Noisy normals are the worst case for the Toksvig specular anti-aliasing and the texture compression
+		const uint32_t size = mBenchmarkParameters.textureCompileSize;
+		std::random_device randomDevice;
+		std::mt19937 randomGenerator(randomDevice());
+		std::uniform_int_distribution<uint32_t> noiseDistribution(0, 63);
+		std::uniform_real_distribution<float> slopeDistribution(-0.5f, 0.5f);
+		BenchmarkReport::Values compileMilliseconds;
+		RendererToolkit::IProject* project = rendererToolkit->createProject();
+		try
+		{
+			for (uint32_t repetitionIndex = 0; repetitionIndex < ::detail::TEXTURE_COMPILE_REPETITIONS; ++repetitionIndex)
+			{
+				// Write the source textures
+				const bool result = ::detail::writeTgaImage(contentDirectory / "Albedo.tga", size, [&](uint32_t x, uint32_t y, uint8_t rgb[3])
+					{
+						rgb[0] = static_cast<uint8_t>(x * 192 / size + noiseDistribution(randomGenerator));
+						rgb[1] = static_cast<uint8_t>(y * 192 / size + noiseDistribution(randomGenerator));
+						rgb[2] = static_cast<uint8_t>(128 + noiseDistribution(randomGenerator));
+					}) && ::detail::writeTgaImage(contentDirectory / "Normal.tga", size, [&](uint32_t, uint32_t, uint8_t rgb[3])
+					{
+						const float x = slopeDistribution(randomGenerator);
+						const float y = slopeDistribution(randomGenerator);
+						const glm::vec3 normal = glm::normalize(glm::vec3(x, y, 1.0f));
+						rgb[0] = static_cast<uint8_t>((normal.x * 0.5f + 0.5f) * 255.0f);
+						rgb[1] = static_cast<uint8_t>((normal.y * 0.5f + 0.5f) * 255.0f);
+						rgb[2] = static_cast<uint8_t>((normal.z * 0.5f + 0.5f) * 255.0f);
+					}) && ::detail::writeTgaImage(contentDirectory / "Roughness.tga", size, [&](uint32_t x, uint32_t, uint8_t rgb[3])
+					{
+						rgb[0] = rgb[1] = rgb[2] = static_cast<uint8_t>(x * 192 / size + noiseDistribution(randomGenerator));
+					});
+				if (!result)
+				{
+					RHI_LOG(rhiContext, CRITICAL, "The benchmark failed to write the texture compile source textures")
+					break;
+				}
+
+				// Compile all assets of the project, the loading isn't part of the measurement
+				project->load(projectDirectory.generic_string().c_str());
+				const BenchmarkReport::TimePoint startTime = BenchmarkReport::now();
+				project->compileAllAssets(::detail::TEXTURE_COMPILE_RHI_TARGET);
+				compileMilliseconds.push_back(BenchmarkReport::getMilliseconds(startTime, BenchmarkReport::now()));
+			}
+		}
+		catch (const std::exception& e)
+		{
+			RHI_LOG(rhiContext, CRITICAL, "The benchmark failed to compile the texture compile project: %s", e.what())
+		}
+		delete project;
+
+		// Report, the per-stage timings are per compiled texture
+		const ::detail::TextureCompileLog::StageMilliseconds& stageMilliseconds = textureCompileLog.getStageMilliseconds();
+		report.beginObject("textureCompile");
+		report.addNumber("size", static_cast<uint64_t>(size));
+		report.addNumber("threadsPerAssetCompiler", static_cast<uint64_t>(mBenchmarkParameters.textureCompileThreads));
+		report.addStatistics("compileMilliseconds", compileMilliseconds);
+		report.addStatistics("loadAndProcessMilliseconds", stageMilliseconds.loadAndProcess);
+		report.addStatistics("compressMilliseconds", stageMilliseconds.compress);
+		report.addStatistics("writeMilliseconds", stageMilliseconds.write);
+		report.endObject();
+	#else
+		RHI_LOG(rhiContext, WARNING, "The benchmark was built without the renderer toolkit, skipping the texture compile micro benchmark")
+	#endif
+}
+
+void Benchmark::gatherResolvedFrames()
+{
+	// Sum up the samples with the same name per frame, root samples sum up to the frame time
+	const auto gatherSamples = [](const Renderer::TimestampProfiler::Samples& samples, PhaseMilliseconds& phaseMilliseconds)
+	{
+		std::map<std::string, double> frameMilliseconds;
+		double rootMilliseconds = 0.0;
+		for (const Renderer::TimestampProfiler::Sample& sample : samples)
+		{
+			const double milliseconds = BenchmarkReport::nanosecondsToMilliseconds(sample.endNanoseconds - sample.beginNanoseconds);
+			frameMilliseconds[sample.name] += milliseconds;
+			if (0 == sample.depth)
+			{
+				rootMilliseconds += milliseconds;
+			}
+		}
+		for (const auto& pair : frameMilliseconds)
+		{
+			phaseMilliseconds[pair.first].push_back(pair.second);
+		}
+		return rootMilliseconds;
+	};
+
+	// Only gather each measured frame once, frames are resolved with a latency
+	for (const Renderer::TimestampProfiler::Frame& frame : mTimestampProfiler->getFrames())
+	{
+		if (frame.resolved && frame.frameNumber >= mFirstMeasuredFrameNumber && frame.frameNumber - mFirstMeasuredFrameNumber < mGatheredFrames.size())
+		{
+			const size_t measuredFrameIndex = static_cast<size_t>(frame.frameNumber - mFirstMeasuredFrameNumber);
+			if (!mGatheredFrames[measuredFrameIndex])
+			{
+				mGatheredFrames[measuredFrameIndex] = true;
+				mCpuFrameMilliseconds.push_back(BenchmarkReport::nanosecondsToMilliseconds(frame.cpuEndNanoseconds - frame.cpuBeginNanoseconds));
+				gatherSamples(frame.cpuSamples, mCpuPhaseMilliseconds);
+				if (!frame.gpuSamples.empty())
+				{
+					mGpuFrameMilliseconds.push_back(gatherSamples(frame.gpuSamples, mGpuPhaseMilliseconds));
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,226 @@
+/*********************************************************\
+ * Copyright (c) 2012-2020 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Benchmark/Private/IBenchmarkApplication.h"
+
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4365)	// warning C4365: 'argument': conversion from 'long' to 'unsigned int', signed/unsigned mismatch
+	PRAGMA_WARNING_DISABLE_MSVC(4571)	// warning C4571: Informational: catch(...) semantics changed since Visual C++ 7.1; structured exceptions (SEH) are no longer caught
+	PRAGMA_WARNING_DISABLE_MSVC(4625)	// warning C4625: 'std::codecvt_base': copy constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4626)	// warning C4626: 'std::codecvt<char16_t,char,_Mbstatet>': assignment operator was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4668)	// warning C4668: '_M_HYBRID_X86_ARM64' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
+	PRAGMA_WARNING_DISABLE_MSVC(4774)	// warning C4774: 'sprintf_s' : format string expected in argument 3 is not a string literal
+	PRAGMA_WARNING_DISABLE_MSVC(5026)	// warning C5026: 'std::_Generic_error_category': move constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(5027)	// warning C5027: 'std::_Generic_error_category': move assignment operator was implicitly defined as deleted
+	#include <map>
+	#include <string>
+	#include <vector>
+PRAGMA_WARNING_POP
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+	class CompositorWorkspaceInstance;
+}
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Headless renderer benchmark
+*
+*  @remarks
+*    Renders a fixed number of frames of the synthetic scene through the full compositor into an offscreen framebuffer while the camera
+*    follows the fixed orbit path and writes the per-phase CPU and GPU timings gathered by the timestamp profiler as JSON. The report also
+*    contains the number of heap allocations per frame done through the RHI allocator as well as the renderer frame allocator statistics.
+*    Works without any output window, so it can run on the null RHI (pure CPU cost) or on e.g. Vulkan with a software implementation like
+*    lavapipe. The correctness checks are done by the separate renderer check program.
+*
+*    Command line arguments in addition to the ones of "IBenchmarkApplication", all optional:
+*    - "--compositor <Forward|Deferred|Debug>": Compositor workspace to use, default "Forward"
+*    - "--trace <virtual filename>": Optional Chrome trace event JSON export, e.g. "LocalData/Benchmark/Trace.json"
+*    - "--frameAllocator <0|1>": Use the renderer frame allocator for transient per-frame data, default 1, 0 turns each such allocation into a heap allocation
+*    - "--sceneLoadProps <n>": Bulk create n instanced mesh props the way the scene resource loader does, by reserving everything up-front and deserializing each mesh scene item from the packed scene file format data, and destroy them again, e.g. 100000, default 0 (off)
+*    - "--commandBufferDraws <n>": Record n indexed draw commands into a reused RHI command buffer and submit it four times nested into another one by copy as well as by reference, e.g. 100000, default 0 (off)
+*    - "--shaderBuilderPermutations <n>": Build n shader source code permutations with random shader property values from the loaded shader blueprints using one warmed up shader builder, e.g. 10000, default 0 (off)
+*    - "--textureCompileSize <n>": Compile synthetic n x n albedo, normal and roughness source textures of a generated renderer toolkit project including Toksvig specular anti-aliasing and report the load and process, compress and write timings per texture, e.g. 2048, default 0 (off), requires the renderer toolkit
+*    - "--textureCompileThreads <n>": Maximum number of threads a single texture asset compilation is allowed to use, default 0 (all hardware threads)
+*
+*    If built with the opt-in CMake option "EXAMPLE_BENCHMARK_HEAP_ALLOCATIONS", the micro benchmarks additionally report the number of heap
+*    allocations of the calling thread per operation, see "HeapAllocationCounter".
+*
+*    Example usage: "./Benchmark -r Vulkan --meshes 1024 --frames 1000 --output Benchmark.json"
+*/
+class Benchmark final : public IBenchmarkApplication
+{
+
+
+//[-------------------------------------------------------]
+//[ Public methods                                        ]
+//[-------------------------------------------------------]
+public:
+	/**
+	*  @brief
+	*    Default constructor
+	*/
+	Benchmark();
+
+	/**
+	*  @brief
+	*    Destructor
+	*/
+	inline virtual ~Benchmark() override
+	{
+		// The resources are released within "onDeinitialization()"
+		// Nothing here
+	}
+
+
+//[-------------------------------------------------------]
+//[ Protected virtual IBenchmarkApplication methods       ]
+//[-------------------------------------------------------]
+protected:
+	virtual void readParameters(const Arguments& arguments) override;
+	[[nodiscard]] virtual bool onInitialization() override;
+	virtual void onDeinitialization() override;
+	[[nodiscard]] virtual bool onDoJob() override;
+
+
+//[-------------------------------------------------------]
+//[ Private definitions                                   ]
+//[-------------------------------------------------------]
+private:
+	struct BenchmarkParameters final
+	{
+		std::string compositorWorkspace		  = "Forward";
+		std::string traceVirtualFilename;		///< Empty string means no Chrome trace export
+		uint32_t	frameAllocator			  = 1;
+		uint32_t	sceneLoadProps			  = 0;	///< Number of instanced mesh props to bulk create, 0 means no scene load micro benchmark
+		uint32_t	commandBufferDraws		  = 0;	///< Number of draw commands to record, 0 means no command buffer micro benchmark
+		uint32_t	shaderBuilderPermutations = 0;	///< Number of shader source code permutations to build, 0 means no shader builder micro benchmark
+		uint32_t	textureCompileSize		  = 0;	///< Width and height of the synthetic source textures to compile, 0 means no texture compile micro benchmark
+		uint32_t	textureCompileThreads	  = 0;	///< Maximum number of threads per texture asset compilation, 0 means all hardware threads
+	};
+	typedef std::vector<double>					Milliseconds;		///< One entry per measured frame the phase was sampled in
+	typedef std::vector<double>					Counts;				///< One entry per measured frame
+	typedef std::map<std::string, Milliseconds> PhaseMilliseconds;	///< Key = sample name
+
+
+//[-------------------------------------------------------]
+//[ Private methods                                       ]
+//[-------------------------------------------------------]
+private:
+	explicit Benchmark(const Benchmark&) = delete;
+	Benchmark& operator=(const Benchmark&) = delete;
+
+	/**
+	*  @brief
+	*    Render the warmup and the measured frames and add the gathered frame statistics to the given report
+	*
+	*  @param[in] report
+	*    Report to add the frame statistics to
+	*/
+	void measureFrames(BenchmarkReport& report);
+
+	/**
+	*  @brief
+	*    Measure the shader source code permutations the shader builder builds per second using the loaded shader blueprints
+	*
+	*  @param[in] report
+	*    Report to add the measurement to
+	*
+	*  @note
+	*    - When this method is called it's ensured that the material blueprint resources and their shader blueprint resources are loaded
+	*/
+	void measureShaderBuilder(BenchmarkReport& report);
+
+	/**
+	*  @brief
+	*    Measure the time needed to bulk create and destroy instanced mesh props inside the scene resource
+	*
+	*  @param[in] report
+	*    Report to add the measurement to
+	*
+	*  @note
+	*    - Must be called before the synthetic scene is created since it replaces the scene content
+	*/
+	void measureSceneLoad(BenchmarkReport& report);
+
+	/**
+	*  @brief
+	*    Measure the time needed to record draw commands into a reused RHI command buffer as well as the time needed to submit it nested into another one
+	*
+	*  @param[in] report
+	*    Report to add the measurement to
+	*/
+	void measureCommandBuffer(BenchmarkReport& report);
+
+	/**
+	*  @brief
+	*    Measure the time needed to compile the textures of a generated renderer toolkit project as well as the per-stage timings the texture asset compiler logs
+	*
+	*  @param[in] report
+	*    Report to add the measurement to
+	*
+	*  @note
+	*    - The project is written into the local data directory, the example project data source is required for its targets
+	*    - Only available if the renderer toolkit is available, which is only the case for shared library builds
+	*/
+	void measureTextureCompile(BenchmarkReport& report);
+
+	/**
+	*  @brief
+	*    Gather the timings of the measured frames the timestamp profiler resolved since the last call
+	*/
+	void gatherResolvedFrames();
+
+
+//[-------------------------------------------------------]
+//[ Private data                                          ]
+//[-------------------------------------------------------]
+private:
+	BenchmarkParameters					   mBenchmarkParameters;
+	Rhi::IFramebufferPtr				   mFramebuffer;				///< Offscreen framebuffer object (FBO) the compositor renders into, can be a null pointer
+	Renderer::CompositorWorkspaceInstance* mCompositorWorkspaceInstance;	///< Compositor workspace instance, can be a null pointer
+	// Gathered timings
+	uint64_t							   mFirstMeasuredFrameNumber;	///< Timestamp profiler frame number of the first measured frame
+	std::vector<bool>					   mGatheredFrames;				///< One entry per measured frame, "true" if the frame timings were gathered
+	Milliseconds						   mCpuFrameMilliseconds;
+	Milliseconds						   mGpuFrameMilliseconds;
+	PhaseMilliseconds					   mCpuPhaseMilliseconds;
+	PhaseMilliseconds					   mGpuPhaseMilliseconds;
+
+
+};
@@ -0,0 +1,86 @@
+/*********************************************************\
+ * Copyright (c) 2012-2020 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Benchmark/Private/Benchmark/HeapAllocationCounter.h"
+
+#include <cstdlib>	// For "malloc()", "free()" and "abort()"
+#include <cstddef>	// For "size_t"
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Global variables                                      ]
+		//[-------------------------------------------------------]
+		thread_local uint64_t g_NumberOfThreadHeapAllocations = 0;	///< Number of heap allocations of the current thread done via the global operator new
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
+
+
+//[-------------------------------------------------------]
+//[ Global operators                                      ]
+//[-------------------------------------------------------]
+// Only linked into the benchmark executable if the opt-in CMake option "EXAMPLE_BENCHMARK_HEAP_ALLOCATIONS" is set
+// -> The array new and delete variants forward to these by default
+void* operator new(size_t numberOfBytes)
+{
+	++::detail::g_NumberOfThreadHeapAllocations;
+	void* memory = malloc((0 != numberOfBytes) ? numberOfBytes : 1);
+	if (nullptr == memory)
+	{
+		// Out of memory, there's no sane way to continue the benchmark
+		abort();
+	}
+	return memory;
+}
+
+void operator delete(void* memory) noexcept
+{
+	free(memory);
+}
+
+void operator delete(void* memory, size_t) noexcept
+{
+	free(memory);
+}
+
+
+//[-------------------------------------------------------]
+//[ Public static methods                                 ]
+//[-------------------------------------------------------]
+uint64_t HeapAllocationCounter::getNumberOfThreadHeapAllocations()
+{
+	return ::detail::g_NumberOfThreadHeapAllocations;
+}
@@ -0,0 +1,110 @@
+/*********************************************************\
+ * Copyright (c) 2012-2020 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <inttypes.h>	// For uint32_t, uint64_t etc.
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Scoped heap allocation counter of the calling thread
+*
+*  @remarks
+*    Counts the heap allocations done via the global operator new by the calling thread during the lifetime of the instance. The renderer
+*    shader builder, scene resource and RHI command buffer use the standard containers and operator new instead of the RHI allocator, so
+*    their heap allocations can't be counted via the counting RHI allocator.
+*
+*  @note
+*    - Only available if the benchmark was built with the opt-in "BENCHMARK_HEAP_ALLOCATIONS" preprocessor definition (CMake option
+*      "EXAMPLE_BENCHMARK_HEAP_ALLOCATIONS"), in this case "HeapAllocationCounter.cpp" replaces the global operator new of the benchmark executable
+*/
+class HeapAllocationCounter final
+{
+
+
+//[-------------------------------------------------------]
+//[ Public static methods                                 ]
+//[-------------------------------------------------------]
+public:
+	/**
+	*  @brief
+	*    Return the total number of heap allocations of the calling thread done via the global operator new
+	*
+	*  @return
+	*    The total number of heap allocations of the calling thread
+	*/
+	[[nodiscard]] static uint64_t getNumberOfThreadHeapAllocations();
+
+
+//[-------------------------------------------------------]
+//[ Public methods                                        ]
+//[-------------------------------------------------------]
+public:
+	inline HeapAllocationCounter() :
+		mNumberOfThreadHeapAllocations(getNumberOfThreadHeapAllocations())
+	{
+		// Nothing here
+	}
+
+	inline ~HeapAllocationCounter()
+	{
+		// Nothing here
+	}
+
+	/**
+	*  @brief
+	*    Return the number of heap allocations of the calling thread since the construction of this instance
+	*
+	*  @return
+	*    The number of heap allocations of the calling thread since the construction of this instance
+	*/
+	[[nodiscard]] inline uint64_t getNumberOfHeapAllocations() const
+	{
+		return getNumberOfThreadHeapAllocations() - mNumberOfThreadHeapAllocations;
+	}
+
+
+//[-------------------------------------------------------]
+//[ Private methods                                       ]
+//[-------------------------------------------------------]
+private:
+	explicit HeapAllocationCounter(const HeapAllocationCounter&) = delete;
+	HeapAllocationCounter& operator=(const HeapAllocationCounter&) = delete;
+
+
+//[-------------------------------------------------------]
+//[ Private data                                          ]
+//[-------------------------------------------------------]
+private:
+	uint64_t mNumberOfThreadHeapAllocations;	///< Total number of heap allocations of the calling thread at construction time
+
+
+};
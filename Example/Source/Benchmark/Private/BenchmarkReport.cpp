@@ -0,0 +1,174 @@
+/*********************************************************\
+ * Copyright (c) 2012-2020 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Benchmark/Private/BenchmarkReport.h"
+
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4365)	// warning C4365: 'argument': conversion from 'long' to 'unsigned int', signed/unsigned mismatch
+	PRAGMA_WARNING_DISABLE_MSVC(4571)	// warning C4571: Informational: catch(...) semantics changed since Visual C++ 7.1; structured exceptions (SEH) are no longer caught
+	PRAGMA_WARNING_DISABLE_MSVC(4625)	// warning C4625: 'std::codecvt_base': copy constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4626)	// warning C4626: 'std::codecvt_base': assignment operator was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4668)	// warning C4668: '_M_HYBRID_X86_ARM64' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
+	PRAGMA_WARNING_DISABLE_MSVC(4774)	// warning C4774: 'sprintf_s' : format string expected in argument 3 is not a string literal
+	PRAGMA_WARNING_DISABLE_MSVC(5026)	// warning C5026: 'std::_Generic_error_category': move constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(5027)	// warning C5027: 'std::_Generic_error_category': move assignment operator was implicitly defined as deleted
+	#include <cmath>
+	#include <fstream>
+	#include <iostream>
+	#include <algorithm>
+PRAGMA_WARNING_POP
+
+
+//[-------------------------------------------------------]
+//[ Public methods                                        ]
+//[-------------------------------------------------------]
+BenchmarkReport::BenchmarkReport() :
+	mDepth(1),
+	mFirstValue(true),
+	mNumberOfChecks(0),
+	mChecksPassed(true)
+{
+	mJson << '{';
+}
+
+void BenchmarkReport::beginObject(const char* name)
+{
+	writeName(name);
+	mJson << '{';
+	++mDepth;
+	mFirstValue = true;
+}
+
+void BenchmarkReport::endObject()
+{
+	ASSERT(mDepth > 1, "Benchmark report object end without matching begin")
+	--mDepth;
+	mJson << '\n' << std::string(mDepth, '\t') << '}';
+	mFirstValue = false;
+}
+
+void BenchmarkReport::addBool(const char* name, bool value)
+{
+	writeName(name);
+	mJson << (value ? "true" : "false");
+}
+
+void BenchmarkReport::addNumber(const char* name, uint64_t value)
+{
+	writeName(name);
+	mJson << value;
+}
+
+void BenchmarkReport::addNumber(const char* name, double value)
+{
+	writeName(name);
+	mJson << value;
+}
+
+void BenchmarkReport::addString(const char* name, const std::string& value)
+{
+	writeName(name);
+	writeString(value);
+}
+
+void BenchmarkReport::addStatistics(const char* name, Values values)
+{
+	writeName(name);
+	mJson << "{ \"count\": " << values.size();
+	if (!values.empty())
+	{
+		std::sort(values.begin(), values.end());
+		const size_t numberOfValues = values.size();
+		double sum = 0.0;
+		for (const double value : values)
+		{
+			sum += value;
+		}
+		const size_t percentile95Index = static_cast<size_t>(std::ceil(0.95 * static_cast<double>(numberOfValues))) - 1;
+		mJson << ", \"mean\": " << sum / static_cast<double>(numberOfValues);
+		mJson << ", \"minimum\": " << values.front();
+		mJson << ", \"median\": " << values[numberOfValues / 2];
+		mJson << ", \"percentile95\": " << values[percentile95Index];
+		mJson << ", \"maximum\": " << values.back();
+	}
+	mJson << " }";
+}
+
+void BenchmarkReport::addCheckResult(bool passed)
+{
+	addBool("passed", passed);
+	++mNumberOfChecks;
+	if (!passed)
+	{
+		mChecksPassed = false;
+	}
+}
+
+bool BenchmarkReport::write(const std::string& outputFilename)
+{
+	// Finish the report root
+	ASSERT(1 == mDepth, "Benchmark report objects must be ended before writing the report")
+	if (mNumberOfChecks > 0)
+	{
+		addBool("checksPassed", mChecksPassed);
+	}
+	mJson << "\n}\n";
+	mDepth = 0;
+
+	// Write the report into the given file or the standard output
+	if (outputFilename.empty())
+	{
+		std::cout << mJson.str();
+		return true;
+	}
+	std::ofstream outputFileStream(outputFilename);
+	outputFileStream << mJson.str();
+	return outputFileStream.good();
+}
+
+
+//[-------------------------------------------------------]
+//[ Private methods                                       ]
+//[-------------------------------------------------------]
+void BenchmarkReport::writeName(const char* name)
+{
+	mJson << (mFirstValue ? "\n" : ",\n") << std::string(mDepth, '\t');
+	writeString(name);
+	mJson << ": ";
+	mFirstValue = false;
+}
+
+void BenchmarkReport::writeString(const std::string& value)
+{
+	mJson << '"';
+	for (const char character : value)
+	{
+		if ('"' == character || '\\' == character)
+		{
+			mJson << '\\';
+		}
+		mJson << character;
+	}
+	mJson << '"';
+}
@@ -0,0 +1,208 @@
+/*********************************************************\
+ * Copyright (c) 2012-2020 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <Rhi/Public/Rhi.h>
+
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4365)	// warning C4365: 'argument': conversion from 'long' to 'unsigned int', signed/unsigned mismatch
+	PRAGMA_WARNING_DISABLE_MSVC(4571)	// warning C4571: Informational: catch(...) semantics changed since Visual C++ 7.1; structured exceptions (SEH) are no longer caught
+	PRAGMA_WARNING_DISABLE_MSVC(4625)	// warning C4625: 'std::codecvt_base': copy constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4626)	// warning C4626: 'std::codecvt<char16_t,char,_Mbstatet>': assignment operator was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4668)	// warning C4668: '_M_HYBRID_X86_ARM64' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
+	PRAGMA_WARNING_DISABLE_MSVC(4774)	// warning C4774: 'sprintf_s' : format string expected in argument 3 is not a string literal
+	PRAGMA_WARNING_DISABLE_MSVC(5026)	// warning C5026: 'std::_Generic_error_category': move constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(5027)	// warning C5027: 'std::_Generic_error_category': move assignment operator was implicitly defined as deleted
+	#include <chrono>
+	#include <string>
+	#include <vector>
+	#include <sstream>
+PRAGMA_WARNING_POP
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Measurement and JSON report helper shared by the benchmark and the renderer check programs
+*
+*  @remarks
+*    The report is a JSON object the values and nested objects are added to in order. Sample series like per-frame timings are
+*    reduced to statistics, so all programs report them the same way. Checks add a "passed" value to the current object, the
+*    report root gets a "checksPassed" value as soon as one check has been added.
+*
+*    Usage example:
+*    @code
+*    BenchmarkReport report;
+*    report.beginObject("commandBuffer");
+*    const BenchmarkReport::TimePoint startTime = BenchmarkReport::now();
+*    // ... measured code ...
+*    milliseconds.push_back(BenchmarkReport::getMilliseconds(startTime, BenchmarkReport::now()));
+*    report.addStatistics("recordMilliseconds", milliseconds);
+*    report.endObject();
+*    report.write("");
+*    @endcode
+*/
+class BenchmarkReport final
+{
+
+
+//[-------------------------------------------------------]
+//[ Public definitions                                    ]
+//[-------------------------------------------------------]
+public:
+	typedef std::chrono::steady_clock::time_point TimePoint;
+	typedef std::vector<double>					  Values;	///< One entry per sample, e.g. milliseconds or counts
+
+
+//[-------------------------------------------------------]
+//[ Public static methods                                 ]
+//[-------------------------------------------------------]
+public:
+	[[nodiscard]] static inline TimePoint now()
+	{
+		return std::chrono::steady_clock::now();
+	}
+
+	[[nodiscard]] static inline double getMilliseconds(const TimePoint& startTime, const TimePoint& endTime)
+	{
+		return std::chrono::duration<double, std::milli>(endTime - startTime).count();
+	}
+
+	[[nodiscard]] static inline double nanosecondsToMilliseconds(uint64_t nanoseconds)
+	{
+		return static_cast<double>(nanoseconds) * 1e-6;
+	}
+
+
+//[-------------------------------------------------------]
+//[ Public methods                                        ]
+//[-------------------------------------------------------]
+public:
+	BenchmarkReport();
+
+	inline ~BenchmarkReport()
+	{
+		// Nothing here
+	}
+
+	/**
+	*  @brief
+	*    Begin a nested object, must be closed by "endObject()"
+	*
+	*  @param[in] name
+	*    ASCII name of the object
+	*/
+	void beginObject(const char* name);
+
+	/**
+	*  @brief
+	*    End the nested object begun by the last "beginObject()"
+	*/
+	void endObject();
+
+	void addBool(const char* name, bool value);
+	void addNumber(const char* name, uint64_t value);
+	void addNumber(const char* name, double value);
+	void addString(const char* name, const std::string& value);
+
+	/**
+	*  @brief
+	*    Add the statistics of the given sample series as object with the number of samples, the mean, the minimum, the median, the 95th percentile and the maximum
+	*
+	*  @param[in] name
+	*    ASCII name of the statistics object
+	*  @param[in] values
+	*    Sample series, the statistics are in the unit of the values, can be empty
+	*
+	*  @note
+	*    - The percentile uses the nearest-rank method
+	*/
+	void addStatistics(const char* name, Values values);
+
+	/**
+	*  @brief
+	*    Add the result of a check as "passed" value to the current object
+	*
+	*  @param[in] passed
+	*    "true" if the check passed, else "false"
+	*/
+	void addCheckResult(bool passed);
+
+	/**
+	*  @brief
+	*    Return whether or not all added checks passed
+	*
+	*  @return
+	*    "true" if all added checks passed or no check has been added, else "false"
+	*/
+	[[nodiscard]] inline bool haveAllChecksPassed() const
+	{
+		return mChecksPassed;
+	}
+
+	/**
+	*  @brief
+	*    Finish the report and write it
+	*
+	*  @param[in] outputFilename
+	*    UTF-8 filename of the report file, if empty the report is written into the standard output
+	*
+	*  @return
+	*    "true" if all went fine, else "false"
+	*
+	*  @note
+	*    - All nested objects must have been ended, no values can be added afterwards
+	*/
+	[[nodiscard]] bool write(const std::string& outputFilename);
+
+
+//[-------------------------------------------------------]
+//[ Private methods                                       ]
+//[-------------------------------------------------------]
+private:
+	explicit BenchmarkReport(const BenchmarkReport&) = delete;
+	BenchmarkReport& operator=(const BenchmarkReport&) = delete;
+	void writeName(const char* name);
+	void writeString(const std::string& value);
+
+
+//[-------------------------------------------------------]
+//[ Private data                                          ]
+//[-------------------------------------------------------]
+private:
+	std::ostringstream mJson;
+	uint32_t		   mDepth;				///< Nesting depth of the current object, the report root has a depth of one
+	bool			   mFirstValue;			///< "true" if no value has been added to the current object yet
+	uint32_t		   mNumberOfChecks;
+	bool			   mChecksPassed;		///< "false" if one of the added checks failed
+
+
+};
@@ -0,0 +1,687 @@
+/*********************************************************\
+ * Copyright (c) 2012-2020 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Benchmark/Private/IBenchmarkApplication.h"
+#include "Benchmark/Private/CommandLineArguments.h"
+#include "Benchmark/Private/BenchmarkReport.h"
+
+#include <Renderer/Public/Context.h>
+#include <Renderer/Public/IRenderer.h>
+#include <Renderer/Public/RendererInstance.h>
+#include <Renderer/Public/Asset/AssetManager.h>
+#include <Renderer/Public/Core/Math/Math.h>
+#include <Renderer/Public/Core/TimestampProfiler.h>
+#include <Renderer/Public/Core/Time/TimeManager.h>
+#include <Renderer/Public/Core/File/PhysicsFSFileManager.h>
+#ifdef RENDERER_GRAPHICS_DEBUGGER
+	#include <Renderer/Public/Core/RenderDocGraphicsDebugger.h>
+#endif
+#include <Renderer/Public/Resource/Scene/SceneNode.h>
+#include <Renderer/Public/Resource/Scene/SceneResource.h>
+#include <Renderer/Public/Resource/Scene/SceneResourceManager.h>
+#include <Renderer/Public/Resource/Scene/Loader/SceneFileFormat.h>
+#include <Renderer/Public/Resource/Scene/Culling/SceneCullingManager.h>
+#include <Renderer/Public/Resource/Scene/Item/Camera/CameraSceneItem.h>
+#include <Renderer/Public/Resource/Scene/Item/Light/LightSceneItem.h>
+#include <Renderer/Public/Resource/Scene/Item/Light/SunlightSceneItem.h>
+#include <Renderer/Public/Resource/Scene/Item/Mesh/SkeletonMeshSceneItem.h>
+#include <Renderer/Public/Resource/Mesh/MeshResourceManager.h>
+#include <Renderer/Public/Resource/Mesh/MeshResource.h>
+#include <Renderer/Public/Resource/Material/MaterialResourceManager.h>
+#include <Renderer/Public/Resource/Material/MaterialResource.h>
+
+#include <Rhi/Public/DefaultLog.h>
+#include <Rhi/Public/DefaultAssert.h>
+#include <Rhi/Public/DefaultAllocator.h>
+#include <Rhi/Public/RhiInstance.h>
+
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4201)	// warning C4201: nonstandard extension used: nameless struct/union
+	PRAGMA_WARNING_DISABLE_MSVC(4365)	// warning C4365: 'argument': conversion from 'long' to 'unsigned int', signed/unsigned mismatch
+	PRAGMA_WARNING_DISABLE_MSVC(4464)	// warning C4464: relative include path contains '..'
+	PRAGMA_WARNING_DISABLE_MSVC(4324)	// warning C4324: '<x>': structure was padded due to alignment specifier
+	PRAGMA_WARNING_DISABLE_MSVC(4571)	// warning C4571: Informational: catch(...) semantics changed since Visual C++ 7.1; structured exceptions (SEH) are no longer caught
+	PRAGMA_WARNING_DISABLE_MSVC(4625)	// warning C4625: 'std::codecvt_base': copy constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4626)	// warning C4626: 'std::codecvt_base': assignment operator was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4668)	// warning C4668: '_M_HYBRID_X86_ARM64' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
+	PRAGMA_WARNING_DISABLE_MSVC(4774)	// warning C4774: 'sprintf_s' : format string expected in argument 3 is not a string literal
+	PRAGMA_WARNING_DISABLE_MSVC(5026)	// warning C5026: 'std::_Generic_error_category': move constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(5027)	// warning C5027: 'std::_Generic_error_category': move assignment operator was implicitly defined as deleted
+	#include <glm/gtc/constants.hpp>
+	#include <glm/gtc/quaternion.hpp>
+
+	#include <cmath>
+	#include <chrono>
+	#include <random>
+	#include <thread>
+	#include <cstdlib>
+	#include <iostream>
+	#include <algorithm>
+PRAGMA_WARNING_POP
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Global definitions                                    ]
+		//[-------------------------------------------------------]
+		static constexpr uint32_t SCENE_ASSET_ID				 = ASSET_ID("Example/Scene/S_Scene");				// Only used as container, the content is replaced by the synthetic scene
+		static constexpr uint32_t MATERIAL_ASSET_ID				 = ASSET_ID("Example/Mesh/Imrod/M_Imrod");
+		static constexpr uint32_t MESH_ASSET_ID					 = ASSET_ID("Example/Mesh/Imrod/SM_Imrod");
+		static constexpr uint32_t SKELETON_MESH_ASSET_ID		 = ASSET_ID("Example/Mesh/Bob/SM_Bob");
+		static constexpr uint32_t SKELETON_ANIMATION_ASSET_ID	 = ASSET_ID("Example/Mesh/Bob/SA_Bob");
+		static constexpr uint32_t BOX_MESH_ASSET_ID				 = ASSET_ID("Example/Mesh/Benchmark/SM_Box");		// Procedural unit cube, there's no such asset
+		static constexpr float	  WALL_WIDTH					 = 1.8f;	// In meter
+		static constexpr float	  WALL_HEIGHT					 = 2.0f;	// In meter
+		static constexpr float	  WALL_THICKNESS				 = 0.2f;	// In meter
+		static constexpr float	  SKELETON_MESH_SCALE			 = 0.03f;
+		static constexpr double	  CAMERA_HEIGHT					 = 3.0;		// In meter
+		static constexpr float	  LIGHT_RADIUS					 = 5.0f;	// In meter
+		static constexpr float	  FIXED_TIME_STEP				 = 1.0f / 60.0f;	// In seconds, the renderer time and hence the skeleton animations advance by this step each frame
+		static constexpr uint32_t OCCLUDER_INTERVAL				 = 4;		// Every n-th mesh is a wall box, flagged as occluder if the occlusion culling is enabled
+		static constexpr int64_t  LOADING_TIMEOUT_MILLISECONDS	 = 60000;
+
+
+		//[-------------------------------------------------------]
+		//[ Classes                                               ]
+		//[-------------------------------------------------------]
+		/**
+		*  @brief
+		*    Allocator which forwards to the default allocator and counts the heap allocations
+		*/
+		class CountingAllocator final : public Rhi::IAllocator
+		{
+		public:
+			inline explicit CountingAllocator(std::atomic<uint64_t>& numberOfAllocations) :
+				IAllocator(&CountingAllocator::reallocate),
+				mNumberOfAllocations(numberOfAllocations)
+			{
+				// Nothing here
+			}
+
+			inline virtual ~CountingAllocator() override
+			{
+				// Nothing here
+			}
+
+		private:
+			explicit CountingAllocator(const CountingAllocator&) = delete;
+			CountingAllocator& operator=(const CountingAllocator&) = delete;
+
+			[[nodiscard]] static void* reallocate(Rhi::IAllocator& allocator, void* oldPointer, size_t oldNumberOfBytes, size_t newNumberOfBytes, size_t alignment)
+			{
+				CountingAllocator& countingAllocator = static_cast<CountingAllocator&>(allocator);
+				if (0 != newNumberOfBytes)
+				{
+					// Allocations as well as reallocations are heap allocations, freeing memory isn't
+					++countingAllocator.mNumberOfAllocations;
+				}
+				return countingAllocator.mDefaultAllocator.reallocate(oldPointer, oldNumberOfBytes, newNumberOfBytes, alignment);
+			}
+
+		private:
+			Rhi::DefaultAllocator  mDefaultAllocator;
+			std::atomic<uint64_t>& mNumberOfAllocations;
+		};
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
+
+
+//[-------------------------------------------------------]
+//[ Public methods                                        ]
+//[-------------------------------------------------------]
+int IBenchmarkApplication::run(const CommandLineArguments& commandLineArguments)
+{
+	// Parse the command line arguments and read the parameters
+	Arguments arguments;
+	if (!parseCommandLineArguments(commandLineArguments, arguments))
+	{
+		// Error!
+		return 1;
+	}
+	readParameters(arguments);
+
+	// Create RHI instance, no output window is needed
+	// -> The allocator counts the heap allocations, the renderer is using the allocator of the RHI context
+	Rhi::DefaultLog defaultLog;
+	Rhi::DefaultAssert defaultAssert;
+	::detail::CountingAllocator countingAllocator(mNumberOfHeapAllocations);
+	Rhi::Context rhiContext(defaultLog, defaultAssert, countingAllocator);
+	#ifdef RENDERER_GRAPHICS_DEBUGGER
+		mGraphicsDebugger = new Renderer::RenderDocGraphicsDebugger(rhiContext);
+	#endif
+	mRhiInstance = new Rhi::RhiInstance(mRhiName, rhiContext);
+
+	// Get the RHI instance and ensure it's valid
+	bool result = false;
+	mRhi = mRhiInstance->getRhi();
+	if (nullptr != mRhi && mRhi->isInitialized())
+	{
+		// Call initialization method
+		if (onInitialization())
+		{
+			// Let the application to its job
+			result = onDoJob();
+		}
+
+		// Call de-initialization method
+		onDeinitialization();
+	}
+	else
+	{
+		RHI_LOG(rhiContext, CRITICAL, "Failed to create the RHI instance \"%s\"", mRhiName)
+	}
+
+	// Destroy the RHI instance
+	mRhi = nullptr;
+	delete mRhiInstance;
+	mRhiInstance = nullptr;
+	#ifdef RENDERER_GRAPHICS_DEBUGGER
+		delete static_cast<Renderer::RenderDocGraphicsDebugger*>(mGraphicsDebugger);
+		mGraphicsDebugger = nullptr;
+	#endif
+
+	// Done, the return code tells whether or not all went fine so the programs can be used inside scripts
+	return result ? 0 : 1;
+}
+
+
+//[-------------------------------------------------------]
+//[ Protected static methods                              ]
+//[-------------------------------------------------------]
+void IBenchmarkApplication::readArgument(const Arguments& arguments, const char* name, uint32_t& value)
+{
+	const Arguments::const_iterator iterator = arguments.find(name);
+	if (arguments.cend() != iterator)
+	{
+		value = static_cast<uint32_t>(std::strtoul(iterator->second.c_str(), nullptr, 10));
+	}
+}
+
+void IBenchmarkApplication::readArgument(const Arguments& arguments, const char* name, std::string& value)
+{
+	const Arguments::const_iterator iterator = arguments.find(name);
+	if (arguments.cend() != iterator)
+	{
+		value = iterator->second;
+	}
+}
+
+uint32_t IBenchmarkApplication::getGridSize(uint32_t numberOfMeshes)
+{
+	return std::max(1u, static_cast<uint32_t>(std::ceil(std::sqrt(static_cast<double>(numberOfMeshes)))));
+}
+
+Renderer::MeshSceneItem* IBenchmarkApplication::createBoxSceneItem(Renderer::SceneResource& sceneResource, Renderer::MeshResourceId boxMeshResourceId, const glm::dvec3& position, const glm::vec3& size, bool occluder)
+{
+	// The box mesh is a unit cube centered at the origin, so the scale is the box size
+	Renderer::MeshSceneItem* meshSceneItem = sceneResource.createSceneItem<Renderer::MeshSceneItem>(*sceneResource.createSceneNode(Renderer::Transform(position, Renderer::Math::QUAT_IDENTITY, size)));
+	if (nullptr != meshSceneItem)
+	{
+		meshSceneItem->setMeshResourceId(boxMeshResourceId);
+		meshSceneItem->setOccluder(occluder);
+	}
+	return meshSceneItem;
+}
+
+
+//[-------------------------------------------------------]
+//[ Protected virtual IBenchmarkApplication methods       ]
+//[-------------------------------------------------------]
+void IBenchmarkApplication::readParameters(const Arguments& arguments)
+{
+	readArgument(arguments, "meshes", mParameters.numberOfMeshes);
+	readArgument(arguments, "materials", mParameters.numberOfMaterials);
+	readArgument(arguments, "lights", mParameters.numberOfLights);
+	readArgument(arguments, "characters", mParameters.numberOfSkinnedCharacters);
+	readArgument(arguments, "warmup", mParameters.numberOfWarmupFrames);
+	readArgument(arguments, "frames", mParameters.numberOfMeasuredFrames);
+	readArgument(arguments, "width", mParameters.width);
+	readArgument(arguments, "height", mParameters.height);
+	readArgument(arguments, "occlusionCulling", mParameters.occlusionCulling);
+	readArgument(arguments, "worldOffset", mParameters.worldOffset);
+	readArgument(arguments, "output", mParameters.outputFilename);
+
+	// Sanity checks
+	mParameters.numberOfMeasuredFrames = std::max(1u, mParameters.numberOfMeasuredFrames);
+	mParameters.width = std::max(1u, mParameters.width);
+	mParameters.height = std::max(1u, mParameters.height);
+}
+
+bool IBenchmarkApplication::onInitialization()
+{
+	// Create the renderer instance, the timestamp profiler gathers the per-phase timings
+	const Rhi::Context& rhiContext = mRhi->getContext();
+	mFileManager = new Renderer::PhysicsFSFileManager(rhiContext.getLog(), std_filesystem::canonical(std_filesystem::current_path() / "..").generic_string());
+	mTimestampProfiler = new Renderer::TimestampProfiler(*mRhi, 16);
+	#ifdef RENDERER_GRAPHICS_DEBUGGER
+		mRendererContext = new Renderer::Context(*mRhi, *mFileManager, *mGraphicsDebugger, *mTimestampProfiler);
+	#else
+		mRendererContext = new Renderer::Context(*mRhi, *mFileManager, *mTimestampProfiler);
+	#endif
+	mRendererInstance = new Renderer::RendererInstance(*mRendererContext);
+	Renderer::IRenderer* renderer = mRendererInstance->getRenderer();
+	if (nullptr == renderer)
+	{
+		// Error!
+		RHI_LOG(rhiContext, CRITICAL, "Failed to create the renderer instance")
+		return false;
+	}
+
+	// Mount asset package
+	if (nullptr == renderer->getAssetManager().mountAssetPackage("../DataPc/Example/Content", "Example"))
+	{
+		// Error!
+		RHI_LOG(rhiContext, CRITICAL, "Please start \"ExampleProjectCompiler\" before starting the benchmark or the renderer check for the first time")
+		return false;
+	}
+	renderer->loadPipelineStateObjectCache();
+
+	// Advance the renderer time by a fixed step instead of the wall-clock time so the skeleton animation poses don't depend on the frame rate
+	renderer->getTimeManager().setFixedPastSecondsSinceLastFrame(::detail::FIXED_TIME_STEP);
+
+	// Load the resources and create the box mesh
+	if (!loadResources())
+	{
+		// Error!
+		return false;
+	}
+	if (!createBoxMesh())
+	{
+		// Error!
+		RHI_LOG(rhiContext, CRITICAL, "Failed to create the box mesh")
+		return false;
+	}
+
+	// Done
+	return true;
+}
+
+void IBenchmarkApplication::onDeinitialization()
+{
+	// Release the used resources
+	if (Renderer::isValid(mSceneResourceId))
+	{
+		getRendererSafe().getSceneResourceManager().destroySceneResource(mSceneResourceId);
+		Renderer::setInvalid(mSceneResourceId);
+	}
+	mCameraSceneItem = nullptr;
+	mSunlightSceneItem = nullptr;
+
+	// Destroy the renderer instance
+	delete mRendererInstance;
+	mRendererInstance = nullptr;
+	delete mRendererContext;
+	mRendererContext = nullptr;
+	delete mTimestampProfiler;
+	mTimestampProfiler = nullptr;
+	delete static_cast<Renderer::PhysicsFSFileManager*>(mFileManager);
+	mFileManager = nullptr;
+}
+
+
+//[-------------------------------------------------------]
+//[ Protected methods                                     ]
+//[-------------------------------------------------------]
+IBenchmarkApplication::IBenchmarkApplication() :
+	mFileManager(nullptr),
+	mTimestampProfiler(nullptr),
+	mSceneResourceId(Renderer::getInvalid<Renderer::SceneResourceId>()),
+	mMaterialResourceId(Renderer::getInvalid<Renderer::MaterialResourceId>()),
+	mBoxMeshResourceId(Renderer::getInvalid<Renderer::MeshResourceId>()),
+	mCameraSceneItem(nullptr),
+	mSunlightSceneItem(nullptr),
+	mNumberOfHeapAllocations(0),
+	mRhiInstance(nullptr),
+	mGraphicsDebugger(nullptr),
+	mRendererContext(nullptr),
+	mRendererInstance(nullptr)
+{
+	// Use the default RHI as long as no RHI is given by using the command line arguments
+	strncpy(mRhiName, Rhi::DEFAULT_RHI_NAME, 32);
+	mRhiName[31] = '\0';
+}
+
+bool IBenchmarkApplication::createSyntheticScene()
+{
+	Renderer::IRenderer& renderer = getRendererSafe();
+	Renderer::SceneResource& sceneResource = renderer.getSceneResourceManager().getById(mSceneResourceId);
+
+	// Replace the loaded scene content
+	sceneResource.destroyAllSceneNodesAndItems();
+	sceneResource.getSceneCullingManager().setOcclusionCullingEnabled(0 != mParameters.occlusionCulling);
+	const uint32_t numberOfSceneNodes = 2 + mParameters.numberOfMeshes + mParameters.numberOfLights + mParameters.numberOfSkinnedCharacters;
+	sceneResource.reserveSceneNodesAndItems(numberOfSceneNodes, numberOfSceneNodes);
+
+	// Camera and sunlight, the camera is moved along the fixed camera path each frame
+	mCameraSceneItem = sceneResource.createSceneItem<Renderer::CameraSceneItem>(*sceneResource.createSceneNode(Renderer::Transform::IDENTITY));
+	mSunlightSceneItem = sceneResource.createSceneItem<Renderer::SunlightSceneItem>(*sceneResource.createSceneNode(Renderer::Transform::IDENTITY));
+	if (nullptr == mCameraSceneItem || nullptr == mSunlightSceneItem)
+	{
+		// Error!
+		return false;
+	}
+	mSunlightSceneItem->setTimeOfDay(14.42f);
+
+	// Static meshes on a grid around the world offset
+	const glm::dvec3 worldOffset(static_cast<double>(mParameters.worldOffset), 0.0, static_cast<double>(mParameters.worldOffset));
+	const uint32_t gridSize = getGridSize(mParameters.numberOfMeshes);
+	const double gridHalfExtent = static_cast<double>(gridSize - 1) * GRID_SPACING * 0.5;
+	std::vector<Renderer::MeshSceneItem*> meshSceneItems;
+	meshSceneItems.reserve(mParameters.numberOfMeshes);
+	// -> Every n-th mesh is a wall box, those are solid within their bounding box and hence the only meshes suited as occluder
+	for (uint32_t i = 0; i < mParameters.numberOfMeshes; ++i)
+	{
+		const glm::dvec3 position = worldOffset + glm::dvec3(static_cast<double>(i % gridSize) * GRID_SPACING - gridHalfExtent, 0.0, static_cast<double>(i / gridSize) * GRID_SPACING - gridHalfExtent);
+		Renderer::MeshSceneItem* meshSceneItem = nullptr;
+		if (0 == (i % ::detail::OCCLUDER_INTERVAL))
+		{
+			meshSceneItem = createBoxSceneItem(sceneResource, mBoxMeshResourceId, position + glm::dvec3(0.0, ::detail::WALL_HEIGHT * 0.5f, 0.0), glm::vec3(::detail::WALL_WIDTH, ::detail::WALL_HEIGHT, ::detail::WALL_THICKNESS), 0 != mParameters.occlusionCulling);
+		}
+		else
+		{
+			Renderer::SceneNode* sceneNode = sceneResource.createSceneNode(Renderer::Transform(position, Renderer::Math::QUAT_IDENTITY, glm::vec3(MESH_SCALE)));
+			meshSceneItem = sceneResource.createSceneItem<Renderer::MeshSceneItem>(*sceneNode);
+			if (nullptr != meshSceneItem)
+			{
+				meshSceneItem->setMeshResourceIdByAssetId(::detail::MESH_ASSET_ID);
+			}
+		}
+		if (nullptr != meshSceneItem)
+		{
+			meshSceneItems.push_back(meshSceneItem);
+		}
+	}
+
+	// Skinned characters on a ring around the mesh grid
+	// -> There's no public setter for the skeleton animation, so use the scene file format deserialization
+	const double characterRingRadius = gridHalfExtent + GRID_SPACING;
+	for (uint32_t i = 0; i < mParameters.numberOfSkinnedCharacters; ++i)
+	{
+		const double angle = glm::two_pi<double>() * static_cast<double>(i) / static_cast<double>(mParameters.numberOfSkinnedCharacters);
+		const glm::dvec3 position = worldOffset + glm::dvec3(std::cos(angle) * characterRingRadius, 0.0, std::sin(angle) * characterRingRadius);
+		Renderer::SceneNode* sceneNode = sceneResource.createSceneNode(Renderer::Transform(position, Renderer::Math::QUAT_IDENTITY, glm::vec3(::detail::SKELETON_MESH_SCALE)));
+		Renderer::SkeletonMeshSceneItem* skeletonMeshSceneItem = sceneResource.createSceneItem<Renderer::SkeletonMeshSceneItem>(*sceneNode);
+		if (nullptr != skeletonMeshSceneItem)
+		{
+			#pragma pack(push)
+			#pragma pack(1)
+				struct SkeletonMeshItem final
+				{
+					Renderer::v1Scene::SkeletonMeshItem skeletonMeshItem;
+					Renderer::v1Scene::MeshItem			meshItem;
+				};
+			#pragma pack(pop)
+			const SkeletonMeshItem skeletonMeshItem = { { Renderer::AssetId(::detail::SKELETON_ANIMATION_ASSET_ID) }, { Renderer::AssetId(::detail::SKELETON_MESH_ASSET_ID), 0 } };
+			skeletonMeshSceneItem->deserialize(sizeof(SkeletonMeshItem), reinterpret_cast<const uint8_t*>(&skeletonMeshItem));
+		}
+	}
+
+	// Point lights at fixed pseudo-random positions above the mesh grid
+	std::minstd_rand randomGenerator(RANDOM_SEED);
+	std::uniform_real_distribution<double> positionDistribution(-gridHalfExtent - GRID_SPACING, gridHalfExtent + GRID_SPACING);
+	std::uniform_real_distribution<float> colorDistribution(0.2f, 1.0f);
+	for (uint32_t i = 0; i < mParameters.numberOfLights; ++i)
+	{
+		const double x = positionDistribution(randomGenerator);
+		const double z = positionDistribution(randomGenerator);
+		Renderer::LightSceneItem* lightSceneItem = sceneResource.createSceneItem<Renderer::LightSceneItem>(*sceneResource.createSceneNode(Renderer::Transform(worldOffset + glm::dvec3(x, 1.5, z))));
+		if (nullptr != lightSceneItem)
+		{
+			lightSceneItem->setLightTypeAndRadius(Renderer::LightSceneItem::LightType::POINT, ::detail::LIGHT_RADIUS);
+			const float red = colorDistribution(randomGenerator);
+			const float green = colorDistribution(randomGenerator);
+			const float blue = colorDistribution(randomGenerator);
+			lightSceneItem->setColor(glm::vec3(red, green, blue) * 10.0f);
+		}
+	}
+
+	// Load the meshes, the materials can only be assigned as soon as the renderables of the meshes exist
+	renderer.flushAllQueues();
+
+	// Spread the meshes over distinct material resources cloned from the parent material resource
+	if (mParameters.numberOfMaterials > 0)
+	{
+		Renderer::MaterialResourceManager& materialResourceManager = renderer.getMaterialResourceManager();
+		std::vector<Renderer::MaterialResourceId> materialResourceIds(mParameters.numberOfMaterials);
+		for (Renderer::MaterialResourceId& materialResourceId : materialResourceIds)
+		{
+			materialResourceId = materialResourceManager.createMaterialResourceByCloning(mMaterialResourceId);
+		}
+		for (size_t i = 0; i < meshSceneItems.size(); ++i)
+		{
+			meshSceneItems[i]->setMaterialResourceIdOfAllSubMeshesAndLods(materialResourceIds[i % materialResourceIds.size()]);
+		}
+	}
+
+	// Done
+	return true;
+}
+
+void IBenchmarkApplication::updateCameraPath(uint32_t frameIndex)
+{
+	// Orbit around the mesh grid, one revolution per measured frames, only depending on the frame index so the runs are comparable
+	const double gridHalfExtent = static_cast<double>(getGridSize(mParameters.numberOfMeshes) - 1) * GRID_SPACING * 0.5;
+	const double radius = gridHalfExtent + GRID_SPACING * 3.0;
+	const double angle = glm::two_pi<double>() * static_cast<double>(frameIndex % mParameters.numberOfMeasuredFrames) / static_cast<double>(mParameters.numberOfMeasuredFrames);
+	const glm::dvec3 position(std::cos(angle) * radius, ::detail::CAMERA_HEIGHT, std::sin(angle) * radius);
+	const glm::vec3 direction = glm::normalize(glm::vec3(-position.x, 1.0 - position.y, -position.z));
+	const glm::dvec3 worldOffset(static_cast<double>(mParameters.worldOffset), 0.0, static_cast<double>(mParameters.worldOffset));
+	mCameraSceneItem->getParentSceneNodeSafe().teleportPositionRotation(worldOffset + position, glm::quatLookAt(direction, Renderer::Math::VEC3_UP));
+}
+
+void IBenchmarkApplication::addParametersToReport(BenchmarkReport& report) const
+{
+	report.addString("rhi", mRhiName);
+	report.beginObject("parameters");
+	report.addNumber("meshes", static_cast<uint64_t>(mParameters.numberOfMeshes));
+	report.addNumber("materials", static_cast<uint64_t>(mParameters.numberOfMaterials));
+	report.addNumber("lights", static_cast<uint64_t>(mParameters.numberOfLights));
+	report.addNumber("characters", static_cast<uint64_t>(mParameters.numberOfSkinnedCharacters));
+	report.addNumber("warmupFrames", static_cast<uint64_t>(mParameters.numberOfWarmupFrames));
+	report.addNumber("measuredFrames", static_cast<uint64_t>(mParameters.numberOfMeasuredFrames));
+	report.addNumber("width", static_cast<uint64_t>(mParameters.width));
+	report.addNumber("height", static_cast<uint64_t>(mParameters.height));
+	report.addBool("occlusionCulling", 0 != mParameters.occlusionCulling);
+	report.addNumber("worldOffset", static_cast<uint64_t>(mParameters.worldOffset));
+	report.endObject();
+}
+
+Renderer::IRenderer& IBenchmarkApplication::getRendererSafe() const
+{
+	ASSERT(nullptr != mRendererInstance && nullptr != mRendererInstance->getRenderer(), "Invalid renderer instance")
+	return *mRendererInstance->getRenderer();
+}
+
+
+//[-------------------------------------------------------]
+//[ Private methods                                       ]
+//[-------------------------------------------------------]
+bool IBenchmarkApplication::parseCommandLineArguments(const CommandLineArguments& commandLineArguments, Arguments& arguments)
+{
+	const uint32_t numberOfArguments = commandLineArguments.getCount();
+	for (uint32_t argumentIndex = 0; argumentIndex < numberOfArguments; ++argumentIndex)
+	{
+		const std::string argument = commandLineArguments.getArgumentAtIndex(argumentIndex);
+		if (argumentIndex + 1 >= numberOfArguments)
+		{
+			// Error!
+			std::cerr << "Missing value for the command line argument \"" << argument << "\"\n";
+			return false;
+		}
+		if ("-r" == argument)
+		{
+			// RHI name in the form "-r <RhiName>"
+			++argumentIndex;
+			strncpy(mRhiName, commandLineArguments.getArgumentAtIndex(argumentIndex).c_str(), 32);
+
+			// In case the source string is longer then 32 bytes (including null terminator) make sure that the string is null terminated
+			mRhiName[31] = '\0';
+		}
+		else if (argument.size() > 2 && '-' == argument[0] && '-' == argument[1])
+		{
+			// Argument in the form "--<OptionName> <Value>"
+			++argumentIndex;
+			arguments[argument.substr(2)] = commandLineArguments.getArgumentAtIndex(argumentIndex);
+		}
+		else
+		{
+			// Error!
+			std::cerr << "Unknown command line argument \"" << argument << "\", usage: [-r <RhiName>] [--<OptionName> <Value>]...\n";
+			return false;
+		}
+	}
+
+	// Done
+	return true;
+}
+
+bool IBenchmarkApplication::loadResources()
+{
+	Renderer::IRenderer& renderer = getRendererSafe();
+	const Rhi::Context& rhiContext = mRhi->getContext();
+	renderer.getSceneResourceManager().loadSceneResourceByAssetId(::detail::SCENE_ASSET_ID, mSceneResourceId);
+	renderer.getMaterialResourceManager().loadMaterialResourceByAssetId(::detail::MATERIAL_ASSET_ID, mMaterialResourceId);
+	const std::chrono::steady_clock::time_point loadingStartTime = std::chrono::steady_clock::now();
+	for (;;)
+	{
+		renderer.update();
+		mTimestampProfiler->nextFrame();
+		const Renderer::SceneResource* sceneResource = renderer.getSceneResourceManager().tryGetById(mSceneResourceId);
+		const Renderer::MaterialResource* materialResource = renderer.getMaterialResourceManager().tryGetById(mMaterialResourceId);
+		if (nullptr == sceneResource || nullptr == materialResource || Renderer::IResource::LoadingState::FAILED == sceneResource->getLoadingState() || Renderer::IResource::LoadingState::FAILED == materialResource->getLoadingState())
+		{
+			// Error!
+			RHI_LOG(rhiContext, CRITICAL, "Failed to load the required resources")
+			return false;
+		}
+		if (Renderer::IResource::LoadingState::LOADED == sceneResource->getLoadingState() && Renderer::IResource::LoadingState::LOADED == materialResource->getLoadingState())
+		{
+			// Done
+			return true;
+		}
+		if (std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - loadingStartTime).count() > ::detail::LOADING_TIMEOUT_MILLISECONDS)
+		{
+			// Error!
+			RHI_LOG(rhiContext, CRITICAL, "Timed out while loading the required resources")
+			return false;
+		}
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+}
+
+bool IBenchmarkApplication::createBoxMesh()
+{
+	Renderer::IRenderer& renderer = getRendererSafe();
+	Renderer::MeshResourceManager& meshResourceManager = renderer.getMeshResourceManager();
+	Rhi::IBufferManager& bufferManager = renderer.getBufferManager();
+
+	// Unit cube centered at the origin using the default vertex attributes layout, each side has its own four vertices for the side tangent frame
+	// -> The front faces are clockwise like the ones of the compiled meshes
+	#pragma pack(push)
+	#pragma pack(1)
+		struct Vertex final
+		{
+			float position[3];
+			float texCoord[2];
+			short qTangent[4];
+		};
+	#pragma pack(pop)
+	static constexpr float SIDES[6][2][3] =	// Normal and tangent of each side
+	{
+		{ {  1.0f,  0.0f,  0.0f }, {  0.0f, 0.0f,  1.0f } },
+		{ { -1.0f,  0.0f,  0.0f }, {  0.0f, 0.0f, -1.0f } },
+		{ {  0.0f,  1.0f,  0.0f }, {  1.0f, 0.0f,  0.0f } },
+		{ {  0.0f, -1.0f,  0.0f }, {  1.0f, 0.0f,  0.0f } },
+		{ {  0.0f,  0.0f,  1.0f }, { -1.0f, 0.0f,  0.0f } },
+		{ {  0.0f,  0.0f, -1.0f }, {  1.0f, 0.0f,  0.0f } }
+	};
+	static constexpr float CORNERS[4][2] = { { -1.0f, -1.0f }, { 1.0f, -1.0f }, { 1.0f, 1.0f }, { -1.0f, 1.0f } };	// Along the tangent and the binormal
+	Vertex vertices[6 * 4];
+	uint16_t indices[6 * 6];
+	for (uint16_t side = 0; side < 6; ++side)
+	{
+		const glm::vec3 normal(SIDES[side][0][0], SIDES[side][0][1], SIDES[side][0][2]);
+		const glm::vec3 tangent(SIDES[side][1][0], SIDES[side][1][1], SIDES[side][1][2]);
+		const glm::vec3 binormal = glm::cross(normal, tangent);
+		glm::mat3 tangentFrame(tangent, binormal, normal);
+		const glm::quat tangentFrameQuaternion = Renderer::Math::calculateTangentFrameQuaternion(tangentFrame);
+		for (uint16_t corner = 0; corner < 4; ++corner)
+		{
+			Vertex& vertex = vertices[side * 4 + corner];
+			const glm::vec3 position = (normal + tangent * CORNERS[corner][0] + binormal * CORNERS[corner][1]) * 0.5f;
+			vertex.position[0] = position.x;
+			vertex.position[1] = position.y;
+			vertex.position[2] = position.z;
+			vertex.texCoord[0] = (CORNERS[corner][0] + 1.0f) * 0.5f;
+			vertex.texCoord[1] = (1.0f - CORNERS[corner][1]) * 0.5f;
+			vertex.qTangent[0] = static_cast<short>(tangentFrameQuaternion.x * std::numeric_limits<short>::max());
+			vertex.qTangent[1] = static_cast<short>(tangentFrameQuaternion.y * std::numeric_limits<short>::max());
+			vertex.qTangent[2] = static_cast<short>(tangentFrameQuaternion.z * std::numeric_limits<short>::max());
+			vertex.qTangent[3] = static_cast<short>(tangentFrameQuaternion.w * std::numeric_limits<short>::max());
+		}
+		static constexpr uint16_t SIDE_INDICES[6] = { 0, 1, 2, 0, 2, 3 };
+		for (uint16_t i = 0; i < 6; ++i)
+		{
+			indices[side * 6 + i] = static_cast<uint16_t>(side * 4 + SIDE_INDICES[i]);
+		}
+	}
+
+	// Create the RHI vertex array, the draw ID vertex buffer is shared by all meshes
+	Rhi::IVertexBufferPtr vertexBuffer(bufferManager.createVertexBuffer(sizeof(vertices), vertices, 0, Rhi::BufferUsage::STATIC_DRAW RHI_RESOURCE_DEBUG_NAME("Benchmark box")));
+	Rhi::IIndexBufferPtr indexBuffer(bufferManager.createIndexBuffer(sizeof(indices), indices, 0, Rhi::BufferUsage::STATIC_DRAW, Rhi::IndexBufferFormat::UNSIGNED_SHORT RHI_RESOURCE_DEBUG_NAME("Benchmark box")));
+	const Rhi::VertexArrayVertexBuffer vertexArrayVertexBuffers[] = { vertexBuffer, meshResourceManager.getDrawIdVertexBufferPtr() };
+	Rhi::IVertexArray* vertexArray = bufferManager.createVertexArray(Renderer::MeshResource::VERTEX_ATTRIBUTES, static_cast<uint32_t>(GLM_COUNTOF(vertexArrayVertexBuffers)), vertexArrayVertexBuffers, indexBuffer RHI_RESOURCE_DEBUG_NAME("Benchmark box"));
+	if (nullptr == vertexArray)
+	{
+		// Error!
+		return false;
+	}
+
+	// Create the mesh resource, a single sub-mesh using the parent material resource and a single LOD
+	mBoxMeshResourceId = meshResourceManager.createEmptyMeshResourceByAssetId(::detail::BOX_MESH_ASSET_ID);
+	Renderer::MeshResource& meshResource = static_cast<Renderer::MeshResource&>(meshResourceManager.getResourceByResourceId(mBoxMeshResourceId));
+	meshResource.setBoundingBoxPosition(glm::vec3(-0.5f), glm::vec3(0.5f));
+	meshResource.setBoundingSpherePositionRadius(Renderer::Math::VEC3_ZERO, std::sqrt(0.75f));
+	meshResource.setNumberOfVertices(static_cast<uint32_t>(GLM_COUNTOF(vertices)));
+	meshResource.setNumberOfIndices(static_cast<uint32_t>(GLM_COUNTOF(indices)));
+	meshResource.setVertexArray(vertexArray);
+	meshResource.getSubMeshes().emplace_back(mMaterialResourceId, 0u, static_cast<uint32_t>(GLM_COUNTOF(indices)));
+	meshResource.setNumberOfLods(1);
+
+	// Done
+	return true;
+}
@@ -0,0 +1,363 @@
+/*********************************************************\
+ * Copyright (c) 2012-2020 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <Rhi/Public/Rhi.h>
+
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4201)	// warning C4201: nonstandard extension used: nameless struct/union
+	PRAGMA_WARNING_DISABLE_MSVC(4365)	// warning C4365: 'argument': conversion from 'long' to 'unsigned int', signed/unsigned mismatch
+	PRAGMA_WARNING_DISABLE_MSVC(4571)	// warning C4571: Informational: catch(...) semantics changed since Visual C++ 7.1; structured exceptions (SEH) are no longer caught
+	PRAGMA_WARNING_DISABLE_MSVC(4625)	// warning C4625: 'std::codecvt_base': copy constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4626)	// warning C4626: 'std::codecvt<char16_t,char,_Mbstatet>': assignment operator was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4668)	// warning C4668: '_M_HYBRID_X86_ARM64' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
+	PRAGMA_WARNING_DISABLE_MSVC(4774)	// warning C4774: 'sprintf_s' : format string expected in argument 3 is not a string literal
+	PRAGMA_WARNING_DISABLE_MSVC(5026)	// warning C5026: 'std::_Generic_error_category': move constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(5027)	// warning C5027: 'std::_Generic_error_category': move assignment operator was implicitly defined as deleted
+	#include <glm/glm.hpp>
+
+	#include <map>
+	#include <atomic>
+	#include <string>
+PRAGMA_WARNING_POP
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+namespace Rhi
+{
+	class RhiInstance;
+}
+namespace Renderer
+{
+	class Context;
+	class IRenderer;
+	class IFileManager;
+	class MeshSceneItem;
+	class SceneResource;
+	class CameraSceneItem;
+	class RendererInstance;
+	class SunlightSceneItem;
+	class TimestampProfiler;
+	class IGraphicsDebugger;
+}
+class BenchmarkReport;
+class CommandLineArguments;
+
+
+//[-------------------------------------------------------]
+//[ Global definitions                                    ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+	typedef uint32_t SceneResourceId;		///< POD scene resource identifier
+	typedef uint32_t MaterialResourceId;	///< POD material resource identifier
+	typedef uint32_t MeshResourceId;		///< POD mesh resource identifier
+}
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Abstract headless renderer application the benchmark and the renderer check programs are based on
+*
+*  @remarks
+*    Creates the RHI instance without any output window as well as the renderer instance with a timestamp profiler, loads the scene
+*    resource used as container of the synthetic scene and its parent material resource and creates the procedural box mesh used for
+*    the occluders. The synthetic scene and the fixed camera orbit path are shared, so both programs work on the same scene. The renderer
+*    time advances by a fixed step each frame, so the skeleton animations don't depend on the frame rate.
+*
+*    Command line arguments, all optional:
+*    - "-r <RhiName>": Case sensitive ASCII name of the RHI to use, e.g. "Null" or "Vulkan", default is the default RHI
+*    - "--meshes <n>": Number of static meshes, default 256
+*    - "--materials <n>": Number of distinct material resources the meshes are spread over, default 16
+*    - "--lights <n>": Number of point lights, default 32
+*    - "--characters <n>": Number of skinned characters, default 8
+*    - "--warmup <n>": Number of warmup frames which aren't measured, default 60
+*    - "--frames <n>": Number of measured frames, default 600
+*    - "--width <n>" and "--height <n>": Viewport size, default 1280x720
+*    - "--occlusionCulling <0|1>": Enable the software occlusion culling with the wall boxes flagged as occluder, every fourth mesh is such a wall box, default 0
+*    - "--worldOffset <meter>": Move the scene and the camera path along the x and z axis, e.g. 100000 to work far away from the world space origin
+*    - "--output <filename>": JSON report filename, if not given the JSON report is written into the standard output
+*/
+class IBenchmarkApplication
+{
+
+
+//[-------------------------------------------------------]
+//[ Public methods                                        ]
+//[-------------------------------------------------------]
+public:
+	/**
+	*  @brief
+	*    Destructor
+	*/
+	inline virtual ~IBenchmarkApplication()
+	{
+		// The resources are released within "onDeinitialization()"
+		// Nothing here
+	}
+
+	/**
+	*  @brief
+	*    Run the application
+	*
+	*  @param[in] commandLineArguments
+	*    Command line arguments
+	*
+	*  @return
+	*    Program return code, 0 to indicate that no error has occurred and all checks passed, else 1
+	*/
+	[[nodiscard]] int run(const CommandLineArguments& commandLineArguments);
+
+
+//[-------------------------------------------------------]
+//[ Protected definitions                                 ]
+//[-------------------------------------------------------]
+protected:
+	typedef std::map<std::string, std::string> Arguments;	///< Key = option name without the leading "--", value = option value
+	struct Parameters final
+	{
+		uint32_t	numberOfMeshes			  = 256;
+		uint32_t	numberOfMaterials		  = 16;
+		uint32_t	numberOfLights			  = 32;
+		uint32_t	numberOfSkinnedCharacters = 8;
+		uint32_t	numberOfWarmupFrames	  = 60;
+		uint32_t	numberOfMeasuredFrames	  = 600;
+		uint32_t	width					  = 1280;
+		uint32_t	height					  = 720;
+		uint32_t	occlusionCulling		  = 0;
+		uint32_t	worldOffset				  = 0;	///< In meter
+		std::string outputFilename;				///< Empty string means standard output
+	};
+	static constexpr uint32_t RANDOM_SEED  = 42;		///< Fixed seed so all runs use the same pseudo-random values
+	static constexpr float	  MESH_SCALE   = 0.07f;
+	static constexpr double	  GRID_SPACING = 2.0;	///< In meter
+
+
+//[-------------------------------------------------------]
+//[ Protected static methods                              ]
+//[-------------------------------------------------------]
+protected:
+	static void readArgument(const Arguments& arguments, const char* name, uint32_t& value);
+	static void readArgument(const Arguments& arguments, const char* name, std::string& value);
+
+	/**
+	*  @brief
+	*    Return the number of grid cells along each axis needed to place the given number of meshes on a square grid
+	*/
+	[[nodiscard]] static uint32_t getGridSize(uint32_t numberOfMeshes);
+
+	/**
+	*  @brief
+	*    Create a box mesh scene item
+	*
+	*  @param[in] sceneResource
+	*    Scene resource to create the box in
+	*  @param[in] boxMeshResourceId
+	*    Procedural box mesh resource ID
+	*  @param[in] position
+	*    Box center position
+	*  @param[in] size
+	*    Box size
+	*  @param[in] occluder
+	*    "true" to flag the box as occluder, else "false"
+	*
+	*  @return
+	*    The created mesh scene item, null pointer on error
+	*/
+	[[nodiscard]] static Renderer::MeshSceneItem* createBoxSceneItem(Renderer::SceneResource& sceneResource, Renderer::MeshResourceId boxMeshResourceId, const glm::dvec3& position, const glm::vec3& size, bool occluder);
+
+
+//[-------------------------------------------------------]
+//[ Protected virtual IBenchmarkApplication methods       ]
+//[-------------------------------------------------------]
+protected:
+	/**
+	*  @brief
+	*    Read the parameters from the command line arguments
+	*
+	*  @param[in] arguments
+	*    The "--<OptionName> <Value>" command line arguments
+	*
+	*  @note
+	*    - Overwrite the method in order to read additional parameters, the shared parameters are read by this base implementation
+	*/
+	virtual void readParameters(const Arguments& arguments);
+
+	/**
+	*  @brief
+	*    Called on application initialization
+	*
+	*  @return
+	*    "true" if all went fine, else "false"
+	*
+	*  @note
+	*    - When this method is called it's ensured that the RHI instance "mRhi" is valid
+	*    - When the base implementation returned successfully it's ensured that the renderer instance is valid, the scene resource and the parent material resource are loaded and the box mesh has been created
+	*/
+	[[nodiscard]] virtual bool onInitialization();
+
+	/**
+	*  @brief
+	*    Called on application de-initialization
+	*
+	*  @note
+	*    - When this method is called it's ensured that the RHI instance "mRhi" is valid
+	*/
+	virtual void onDeinitialization();
+
+	/**
+	*  @brief
+	*    Called on application should to its job
+	*
+	*  @return
+	*    "true" if all went fine and all checks passed, else "false"
+	*
+	*  @note
+	*    - When this method is called it's ensured that "onInitialization()" returned successfully
+	*/
+	[[nodiscard]] virtual bool onDoJob() = 0;
+
+
+//[-------------------------------------------------------]
+//[ Protected methods                                     ]
+//[-------------------------------------------------------]
+protected:
+	IBenchmarkApplication();
+	explicit IBenchmarkApplication(const IBenchmarkApplication&) = delete;
+	IBenchmarkApplication& operator=(const IBenchmarkApplication&) = delete;
+
+	/**
+	*  @brief
+	*    Replace the content of the loaded scene resource by the synthetic scene
+	*
+	*  @return
+	*    "true" if all went fine, else "false"
+	*
+	*  @remarks
+	*    The synthetic scene consists of the camera, the sunlight, the static meshes on a grid around the world offset, every fourth of
+	*    them a wall box, the skinned characters on a ring around the grid and the point lights at fixed pseudo-random positions above
+	*    the grid. The scene items are always created in the same order.
+	*/
+	[[nodiscard]] bool createSyntheticScene();
+
+	/**
+	*  @brief
+	*    Move the camera to the position of the fixed camera path
+	*
+	*  @param[in] frameIndex
+	*    Frame index, the camera path is repeated every measured frames
+	*/
+	void updateCameraPath(uint32_t frameIndex);
+
+	/**
+	*  @brief
+	*    Add the RHI name and the shared parameters to the given report
+	*
+	*  @param[in] report
+	*    Report to add the parameters to
+	*/
+	void addParametersToReport(BenchmarkReport& report) const;
+
+	[[nodiscard]] Renderer::IRenderer& getRendererSafe() const;
+
+
+//[-------------------------------------------------------]
+//[ Private methods                                       ]
+//[-------------------------------------------------------]
+private:
+	/**
+	*  @brief
+	*    Parse the command line arguments
+	*
+	*  @param[in] commandLineArguments
+	*    Command line arguments
+	*  @param[out] arguments
+	*    Receives the "--<OptionName> <Value>" command line arguments
+	*
+	*  @return
+	*    "true" if all went fine, else "false"
+	*/
+	[[nodiscard]] bool parseCommandLineArguments(const CommandLineArguments& commandLineArguments, Arguments& arguments);
+
+	/**
+	*  @brief
+	*    Load the scene resource used as container of the synthetic scene as well as the parent material resource
+	*
+	*  @return
+	*    "true" if all went fine, else "false"
+	*/
+	[[nodiscard]] bool loadResources();
+
+	/**
+	*  @brief
+	*    Create the procedural box mesh resource used for the occluders
+	*
+	*  @return
+	*    "true" if all went fine, else "false"
+	*
+	*  @note
+	*    - The rasterized occluder is the bounding box, so only meshes which are solid within their bounding box are suited as occluder
+	*    - When this method is called it's ensured that the parent material resource is loaded
+	*/
+	[[nodiscard]] bool createBoxMesh();
+
+
+//[-------------------------------------------------------]
+//[ Protected data                                        ]
+//[-------------------------------------------------------]
+protected:
+	char						 mRhiName[32];				///< Case sensitive ASCII name of the RHI to instance
+	Parameters					 mParameters;
+	Rhi::IRhiPtr				 mRhi;						///< RHI instance, can be a null pointer
+	Renderer::IFileManager*		 mFileManager;				///< File manager instance, can be a null pointer
+	Renderer::TimestampProfiler* mTimestampProfiler;		///< Timestamp profiler instance, can be a null pointer
+	Renderer::SceneResourceId	 mSceneResourceId;			///< Scene resource ID, the loaded scene content is replaced by the synthetic scene
+	Renderer::MaterialResourceId mMaterialResourceId;		///< Parent material resource ID of the synthetic scene materials
+	Renderer::MeshResourceId	 mBoxMeshResourceId;		///< Procedural box mesh resource ID, the mesh resource is owned by the mesh resource manager
+	Renderer::CameraSceneItem*	 mCameraSceneItem;			///< Camera scene item, can be a null pointer
+	Renderer::SunlightSceneItem* mSunlightSceneItem;		///< Sunlight scene item, can be a null pointer
+	std::atomic<uint64_t>		 mNumberOfHeapAllocations;	///< Number of heap allocations done through the RHI allocator, updated by the counting allocator
+
+
+//[-------------------------------------------------------]
+//[ Private data                                          ]
+//[-------------------------------------------------------]
+private:
+	Rhi::RhiInstance*			 mRhiInstance;			///< RHI instance, can be a null pointer
+	Renderer::IGraphicsDebugger* mGraphicsDebugger;		///< Graphics debugger instance, can be a null pointer
+	Renderer::Context*			 mRendererContext;		///< Renderer context instance, can be a null pointer
+	Renderer::RendererInstance*	 mRendererInstance;		///< Renderer instance, can be a null pointer
+
+
+};
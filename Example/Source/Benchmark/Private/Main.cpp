@@ -0,0 +1,107 @@
+/*********************************************************\
+ * Copyright (c) 2012-2020 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Benchmark/Private/CommandLineArguments.h"
+#ifdef RENDERER_CHECK
+	#include "Benchmark/Private/RendererCheck/RendererCheck.h"
+#else
+	#include "Benchmark/Private/Benchmark/Benchmark.h"
+#endif
+
+
+//[-------------------------------------------------------]
+//[ Platform independent program entry point              ]
+//[-------------------------------------------------------]
+[[nodiscard]] int programEntryPoint(const CommandLineArguments& commandLineArguments)
+{
+	// The renderer check and the benchmark share the source codes, the "RENDERER_CHECK" preprocessor definition is set by the renderer check target
+	#ifdef RENDERER_CHECK
+		return RendererCheck().run(commandLineArguments);
+	#else
+		return Benchmark().run(commandLineArguments);
+	#endif
+}
+
+
+//[-------------------------------------------------------]
+//[ Platform dependent program entry point                ]
+//[-------------------------------------------------------]
+// Windows implementation
+#ifdef _WIN32
+	#include <Renderer/Public/Core/Platform/WindowsHeader.h>
+
+	#ifdef _CONSOLE
+		#ifdef UNICODE
+			int wmain(int, wchar_t**)
+		#else
+			int main(int, char**)
+		#endif
+			{
+				// For memory leak detection
+				#ifdef RHI_DEBUG
+					// "_CrtDumpMemoryLeaks()" reports false positive memory leak with static variables, so use a memory difference instead
+					_CrtMemState crtMemState = { };
+					_CrtMemCheckpoint(&crtMemState);
+				#endif
+
+				// Call the platform independent program entry point
+				// -> Uses internally "GetCommandLine()" to fetch the command line arguments
+				const int result = programEntryPoint(CommandLineArguments());
+
+				// For memory leak detection
+				#ifdef RHI_DEBUG
+					_CrtMemDumpAllObjectsSince(&crtMemState);
+				#endif
+
+				// Done
+				return result;
+			}
+	#else
+		#ifdef UNICODE
+			int WINAPI wWinMain(HINSTANCE, HINSTANCE, LPWSTR, int)
+		#else
+			int WINAPI WinMain(HINSTANCE, HINSTANCE, LPSTR, int)
+		#endif
+			{
+				// Call the platform independent program entry point
+				// -> Uses internally "GetCommandLine()" to fetch the command line arguments
+				const int result = programEntryPoint(CommandLineArguments());
+
+				// For memory leak detection
+				#ifdef RHI_DEBUG
+					_CrtDumpMemoryLeaks();
+				#endif
+
+				// Done
+				return result;
+			}
+	#endif
+
+// Linux implementation
+#elif LINUX
+	int main(int argc, char** argv)
+	{
+		// Call the platform independent program entry point
+		return programEntryPoint(CommandLineArguments(argc, argv));
+	}
+#endif
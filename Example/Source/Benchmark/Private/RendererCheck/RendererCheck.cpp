@@ -0,0 +1,418 @@
+/*********************************************************\
+ * Copyright (c) 2012-2020 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Benchmark/Private/RendererCheck/RendererCheck.h"
+#include "Benchmark/Private/BenchmarkReport.h"
+
+#include <Renderer/Public/IRenderer.h>
+#include <Renderer/Public/Core/Math/Math.h>
+#include <Renderer/Public/RenderQueue/GpuInstanceCuller.h>
+#include <Renderer/Public/Resource/Scene/SceneNode.h>
+#include <Renderer/Public/Resource/Scene/SceneResource.h>
+#include <Renderer/Public/Resource/Scene/SceneResourceManager.h>
+#include <Renderer/Public/Resource/Scene/Culling/SceneCullingManager.h>
+#include <Renderer/Public/Resource/Scene/Culling/SceneItemSet.h>
+#include <Renderer/Public/Resource/Scene/Item/Camera/CameraSceneItem.h>
+#include <Renderer/Public/Resource/Scene/Item/Mesh/MeshSceneItem.h>
+
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4201)	// warning C4201: nonstandard extension used: nameless struct/union
+	PRAGMA_WARNING_DISABLE_MSVC(4365)	// warning C4365: 'argument': conversion from 'long' to 'unsigned int', signed/unsigned mismatch
+	PRAGMA_WARNING_DISABLE_MSVC(4464)	// warning C4464: relative include path contains '..'
+	PRAGMA_WARNING_DISABLE_MSVC(4324)	// warning C4324: '<x>': structure was padded due to alignment specifier
+	PRAGMA_WARNING_DISABLE_MSVC(4571)	// warning C4571: Informational: catch(...) semantics changed since Visual C++ 7.1; structured exceptions (SEH) are no longer caught
+	PRAGMA_WARNING_DISABLE_MSVC(4625)	// warning C4625: 'std::codecvt_base': copy constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4626)	// warning C4626: 'std::codecvt_base': assignment operator was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4668)	// warning C4668: '_M_HYBRID_X86_ARM64' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
+	PRAGMA_WARNING_DISABLE_MSVC(4774)	// warning C4774: 'sprintf_s' : format string expected in argument 3 is not a string literal
+	PRAGMA_WARNING_DISABLE_MSVC(5026)	// warning C5026: 'std::_Generic_error_category': move constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(5027)	// warning C5027: 'std::_Generic_error_category': move assignment operator was implicitly defined as deleted
+	#include <glm/gtc/constants.hpp>
+	#include <glm/gtc/quaternion.hpp>
+	#include <glm/gtc/matrix_transform.hpp>
+
+	#include <random>
+	#include <algorithm>
+	#include <unordered_map>
+PRAGMA_WARNING_POP
+
+
+//[-------------------------------------------------------]
+//[ Public methods                                        ]
+//[-------------------------------------------------------]
+RendererCheck::RendererCheck() :
+	mNumberOfInstances(100000)
+{
+	// Check the culling far away from the world space origin by default
+	mParameters.worldOffset = 100000;
+}
+
+
+//[-------------------------------------------------------]
+//[ Protected virtual IBenchmarkApplication methods       ]
+//[-------------------------------------------------------]
+void RendererCheck::readParameters(const Arguments& arguments)
+{
+	// Call the base implementation
+	IBenchmarkApplication::readParameters(arguments);
+
+	// Read the renderer check parameters
+	readArgument(arguments, "instances", mNumberOfInstances);
+}
+
+bool RendererCheck::onDoJob()
+{
+	BenchmarkReport report;
+	addParametersToReport(report);
+
+	// Run the checks, the occlusion culling check replaces the scene content and the culling check creates the synthetic scene
+	checkGpuInstanceCuller(report);
+	checkOcclusionCulling(report);
+	checkCulling(report);
+
+	// Write the JSON report
+	if (!report.write(mParameters.outputFilename))
+	{
+		// Error!
+		RHI_LOG(mRhi->getContext(), CRITICAL, "The renderer check failed to write the report \"%s\"", mParameters.outputFilename.c_str())
+		return false;
+	}
+
+	// Done
+	return report.haveAllChecksPassed();
+}
+
+
+//[-------------------------------------------------------]
+//[ Private methods                                       ]
+//[-------------------------------------------------------]
+void RendererCheck::checkGpuInstanceCuller(BenchmarkReport& report)
+{
+	// Single mesh with three LODs
+	Renderer::GpuInstanceCuller::Meshes meshes(1);
+	Renderer::GpuInstanceCuller::Mesh& mesh = meshes[0];
+	mesh.numberOfLods = 3;
+	for (uint32_t i = 0; i < Renderer::GpuInstanceCuller::MAXIMUM_NUMBER_OF_LODS; ++i)
+	{
+		mesh.indexCountPerInstance[i] = 300u >> i;
+		mesh.startIndexLocation[i] = 1000u * i;
+		mesh.baseVertexLocation[i] = 100 * static_cast<int32_t>(i);
+		mesh.maximumLodDistance[i] = 10.0f * static_cast<float>(i + 1);
+	}
+
+	// Camera far away from the origin looking along the negative z axis, the random instances are placed all around the camera so each frustum plane gets tested
+	const glm::vec3 worldSpaceCameraPosition(1000.0f, 0.0f, 0.0f);
+	const glm::mat4 cameraRelativeWorldSpaceToClipSpaceMatrix = glm::perspectiveRH_ZO(glm::radians(90.0f), 1.0f, 0.1f, 100.0f) * glm::lookAtRH(glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, -1.0f), Renderer::Math::VEC3_UP);
+	std::minstd_rand randomGenerator(RANDOM_SEED);
+	std::uniform_real_distribution<float> positionDistribution(-60.0f, 60.0f);
+	std::uniform_real_distribution<float> scaleDistribution(1.0f, 5.0f);
+	std::uniform_real_distribution<float> angleDistribution(0.0f, glm::two_pi<float>());
+	Renderer::GpuInstanceCuller::Instances instances;
+	instances.reserve(mNumberOfInstances);
+	for (uint32_t i = 0; i < mNumberOfInstances; ++i)
+	{
+		const float x = positionDistribution(randomGenerator);
+		const float y = positionDistribution(randomGenerator);
+		const float z = positionDistribution(randomGenerator);
+		const float angle = angleDistribution(randomGenerator);
+		const float scale = scaleDistribution(randomGenerator);
+		const glm::mat4 objectSpaceToWorldSpace = glm::scale(glm::rotate(glm::translate(glm::mat4(1.0f), worldSpaceCameraPosition + glm::vec3(x, y, z)), angle, Renderer::Math::VEC3_UP), glm::vec3(scale));
+		instances.emplace_back(objectSpaceToWorldSpace, glm::vec3(-1.0f), glm::vec3(1.0f), 0u, i);
+	}
+
+	// Cull
+	Renderer::GpuInstanceCuller::DrawIndexedArgumentsVector drawIndexedArgumentsVector(instances.size(), Rhi::DrawIndexedArguments(0));
+	const BenchmarkReport::TimePoint cullStartTime = BenchmarkReport::now();
+	const uint32_t numberOfVisibleInstances = Renderer::GpuInstanceCuller::cullOnCpu(meshes, instances, cameraRelativeWorldSpaceToClipSpaceMatrix, worldSpaceCameraPosition, drawIndexedArgumentsVector.data());
+	const double cullMilliseconds = BenchmarkReport::getMilliseconds(cullStartTime, BenchmarkReport::now());
+
+	// Brute-force reference: An instance is invisible if all eight bounding box corners are on the outer side of one clip space plane
+	static const glm::vec4 CLIP_SPACE_PLANES[6] = { glm::vec4(1.0f, 0.0f, 0.0f, 1.0f), glm::vec4(-1.0f, 0.0f, 0.0f, 1.0f), glm::vec4(0.0f, 1.0f, 0.0f, 1.0f), glm::vec4(0.0f, -1.0f, 0.0f, 1.0f), glm::vec4(0.0f, 0.0f, 1.0f, 0.0f), glm::vec4(0.0f, 0.0f, -1.0f, 1.0f) };
+	uint32_t numberOfReferenceVisibleInstances = 0;
+	uint32_t numberOfMismatches = 0;
+	uint32_t drawIndex = 0;
+	for (const Renderer::GpuInstanceCuller::Instance& instance : instances)
+	{
+		glm::vec4 clipSpaceCorners[8];
+		for (int corner = 0; corner < 8; ++corner)
+		{
+			const glm::vec4 objectSpaceCorner((corner & 1) ? instance.maximum[0] : instance.minimum[0], (corner & 2) ? instance.maximum[1] : instance.minimum[1], (corner & 4) ? instance.maximum[2] : instance.minimum[2], 1.0f);
+			glm::vec3 cameraRelativeCorner;
+			for (int row = 0; row < 3; ++row)
+			{
+				cameraRelativeCorner[row] = glm::dot(glm::vec4(instance.objectSpaceToWorldSpace[row][0], instance.objectSpaceToWorldSpace[row][1], instance.objectSpaceToWorldSpace[row][2], instance.objectSpaceToWorldSpace[row][3]), objectSpaceCorner) - worldSpaceCameraPosition[row];
+			}
+			clipSpaceCorners[corner] = cameraRelativeWorldSpaceToClipSpaceMatrix * glm::vec4(cameraRelativeCorner, 1.0f);
+		}
+		bool visible = true;
+		for (const glm::vec4& plane : CLIP_SPACE_PLANES)
+		{
+			bool allCornersOutside = true;
+			for (const glm::vec4& clipSpaceCorner : clipSpaceCorners)
+			{
+				if (glm::dot(plane, clipSpaceCorner) >= 0.0f)
+				{
+					allCornersOutside = false;
+					break;
+				}
+			}
+			if (allCornersOutside)
+			{
+				visible = false;
+				break;
+			}
+		}
+
+		// The CPU reference implementation writes the draws in instance order
+		const bool culledVisible = (drawIndex < numberOfVisibleInstances && drawIndexedArgumentsVector[drawIndex].startInstanceLocation == instance.startInstanceLocation);
+		if (culledVisible)
+		{
+			++drawIndex;
+		}
+		if (visible)
+		{
+			++numberOfReferenceVisibleInstances;
+		}
+		if (visible != culledVisible)
+		{
+			++numberOfMismatches;
+		}
+	}
+
+	// Cull the same instances using the compute shader and read back the GPU draw list
+	Renderer::GpuInstanceCuller gpuInstanceCuller(getRendererSafe(), mNumberOfInstances, 1);
+	const bool gpuCulling = gpuInstanceCuller.isGpuCulling();
+	bool equivalentDrawLists = true;
+	uint32_t numberOfGpuVisibleInstances = 0;
+	if (gpuCulling)
+	{
+		gpuInstanceCuller.addMesh(mesh);
+		for (const Renderer::GpuInstanceCuller::Instance& instance : instances)
+		{
+			gpuInstanceCuller.addInstance(instance);
+		}
+		Rhi::CommandBuffer commandBuffer;
+		gpuInstanceCuller.cull(cameraRelativeWorldSpaceToClipSpaceMatrix, worldSpaceCameraPosition, commandBuffer);
+		Renderer::GpuInstanceCuller::DrawIndexedArgumentsVector gpuDrawIndexedArgumentsVector;
+		equivalentDrawLists = false;
+		if (mRhi->beginScene())
+		{
+			commandBuffer.submitToRhi(*mRhi);
+			mRhi->endScene();
+			mRhi->finish();
+			if (gpuInstanceCuller.readBackDrawIndexedArguments(gpuDrawIndexedArgumentsVector) && gpuDrawIndexedArgumentsVector.size() == drawIndexedArgumentsVector.size())
+			{
+				// The GPU draw order isn't deterministic and the GPU draw list contains empty draws behind the visible instances, so the draw list comparison must not depend on either
+				equivalentDrawLists = Renderer::GpuInstanceCuller::areDrawListsEquivalent(drawIndexedArgumentsVector.data(), gpuDrawIndexedArgumentsVector.data(), static_cast<uint32_t>(drawIndexedArgumentsVector.size()));
+				for (const Rhi::DrawIndexedArguments& drawIndexedArguments : gpuDrawIndexedArgumentsVector)
+				{
+					if (drawIndexedArguments.instanceCount > 0 && drawIndexedArguments.indexCountPerInstance > 0)
+					{
+						++numberOfGpuVisibleInstances;
+					}
+				}
+			}
+		}
+		gpuInstanceCuller.onPostCommandBufferExecution();
+	}
+
+	// Evaluate
+	const bool passed = (0 == numberOfMismatches && equivalentDrawLists);
+	if (!passed)
+	{
+		RHI_LOG(mRhi->getContext(), CRITICAL, "The GPU instance culler check failed: %u of %u instances don't match the brute-force frustum test, the GPU draw list has %u instead of %u visible instances", numberOfMismatches, mNumberOfInstances, numberOfGpuVisibleInstances, numberOfVisibleInstances)
+	}
+	report.beginObject("gpuInstanceCullerCheck");
+	report.addNumber("instances", static_cast<uint64_t>(mNumberOfInstances));
+	report.addNumber("visible", static_cast<uint64_t>(numberOfVisibleInstances));
+	report.addNumber("referenceVisible", static_cast<uint64_t>(numberOfReferenceVisibleInstances));
+	report.addNumber("mismatches", static_cast<uint64_t>(numberOfMismatches));
+	report.addBool("gpuCulling", gpuCulling);
+	report.addNumber("gpuVisible", static_cast<uint64_t>(numberOfGpuVisibleInstances));
+	report.addBool("equivalentDrawLists", equivalentDrawLists);
+	report.addNumber("cullMilliseconds", cullMilliseconds);
+	report.addCheckResult(passed);
+	report.endObject();
+}
+
+void RendererCheck::checkOcclusionCulling(BenchmarkReport& report)
+{
+	Renderer::IRenderer& renderer = getRendererSafe();
+	Renderer::SceneResource& sceneResource = renderer.getSceneResourceManager().getById(mSceneResourceId);
+	Renderer::SceneCullingManager& sceneCullingManager = sceneResource.getSceneCullingManager();
+	bool wallVisible = false;
+	bool boxBehindWallOccluded = false;
+	bool boxBesideWallVisible = false;
+
+	// Camera looking along the positive z axis at a wall, one box is hidden behind the wall and one box is beside the wall
+	sceneResource.destroyAllSceneNodesAndItems();
+	sceneCullingManager.setOcclusionCullingEnabled(true);
+	Renderer::CameraSceneItem* cameraSceneItem = sceneResource.createSceneItem<Renderer::CameraSceneItem>(*sceneResource.createSceneNode(Renderer::Transform(glm::dvec3(0.0, 1.0, 0.0), glm::quatLookAt(glm::vec3(0.0f, 0.0f, 1.0f), Renderer::Math::VEC3_UP))));
+	const Renderer::MeshSceneItem* wallSceneItem = createBoxSceneItem(sceneResource, mBoxMeshResourceId, glm::dvec3(0.0, 1.0, 10.0), glm::vec3(8.0f, 4.0f, 0.5f), true);
+	const Renderer::MeshSceneItem* boxBehindWallSceneItem = createBoxSceneItem(sceneResource, mBoxMeshResourceId, glm::dvec3(0.0, 1.0, 20.0), glm::vec3(1.0f), false);
+	const Renderer::MeshSceneItem* boxBesideWallSceneItem = createBoxSceneItem(sceneResource, mBoxMeshResourceId, glm::dvec3(14.0, 1.0, 20.0), glm::vec3(1.0f), false);
+	if (nullptr != cameraSceneItem && nullptr != wallSceneItem && nullptr != boxBehindWallSceneItem && nullptr != boxBesideWallSceneItem)
+	{
+		// Cull, the renderer update is needed for the frame allocator
+		renderer.update();
+		Renderer::SceneCullingManager::SceneItems visibleSceneItems;
+		sceneCullingManager.gatherVisibleSceneItems(renderer, *cameraSceneItem, static_cast<float>(mParameters.width) / static_cast<float>(mParameters.height), visibleSceneItems);
+		const auto isVisible = [&visibleSceneItems](const Renderer::ISceneItem* sceneItem)
+		{
+			return (std::find(visibleSceneItems.cbegin(), visibleSceneItems.cend(), sceneItem) != visibleSceneItems.cend());
+		};
+		wallVisible = isVisible(wallSceneItem);
+		boxBehindWallOccluded = !isVisible(boxBehindWallSceneItem);
+		boxBesideWallVisible = isVisible(boxBesideWallSceneItem);
+	}
+	sceneResource.destroyAllSceneNodesAndItems();
+
+	// Evaluate
+	const bool passed = (wallVisible && boxBehindWallOccluded && boxBesideWallVisible);
+	if (!passed)
+	{
+		RHI_LOG(mRhi->getContext(), CRITICAL, "The occlusion culling check failed: Wall visible = %d, box behind the wall occluded = %d, box beside the wall visible = %d", wallVisible, boxBehindWallOccluded, boxBesideWallVisible)
+	}
+	report.beginObject("occlusionCullingCheck");
+	report.addBool("wallVisible", wallVisible);
+	report.addBool("boxBehindWallOccluded", boxBehindWallOccluded);
+	report.addBool("boxBesideWallVisible", boxBesideWallVisible);
+	report.addCheckResult(passed);
+	report.endObject();
+}
+
+void RendererCheck::checkCulling(BenchmarkReport& report)
+{
+	report.beginObject("cullingCheck");
+
+	// Create the synthetic scene at the world offset and cull along the camera path
+	VisibleSceneItemIndices worldOffsetVisibleSceneItemIndices;
+	Milliseconds worldOffsetMilliseconds;
+	if (!createSyntheticScene())
+	{
+		// Error!
+		RHI_LOG(mRhi->getContext(), CRITICAL, "The culling check failed to create the synthetic scene at the world offset")
+		report.addCheckResult(false);
+		report.endObject();
+		return;
+	}
+	cullAlongCameraPath(worldOffsetMilliseconds, worldOffsetVisibleSceneItemIndices);
+	const uint32_t numberOfCullableSceneItems = mCameraSceneItem->getSceneResource().getSceneCullingManager().getCullableSceneItemSet().numberOfSceneItems;
+	BenchmarkReport::Values visibleSceneItemsPerFrame;
+	for (uint32_t frameIndex = mParameters.numberOfWarmupFrames; frameIndex < worldOffsetVisibleSceneItemIndices.size(); ++frameIndex)
+	{
+		visibleSceneItemsPerFrame.push_back(static_cast<double>(worldOffsetVisibleSceneItemIndices[frameIndex].size()));
+	}
+
+	// Recreate the synthetic scene at the world space origin and cull along the same camera path
+	// -> The world offset parameter is used by the synthetic scene creation as well as by the camera path, so temporarily reset it
+	VisibleSceneItemIndices originVisibleSceneItemIndices;
+	Milliseconds originMilliseconds;
+	const uint32_t worldOffset = mParameters.worldOffset;
+	mParameters.worldOffset = 0;
+	const bool result = createSyntheticScene();
+	if (result)
+	{
+		cullAlongCameraPath(originMilliseconds, originVisibleSceneItemIndices);
+	}
+	mParameters.worldOffset = worldOffset;
+	if (!result)
+	{
+		// Error!
+		RHI_LOG(mRhi->getContext(), CRITICAL, "The culling check failed to create the synthetic scene at the world space origin")
+		report.addCheckResult(false);
+		report.endObject();
+		return;
+	}
+
+	// The visible scene items must be identical, else the culling lost precision far away from the world space origin
+	uint32_t numberOfMismatchingFrames = 0;
+	for (size_t frameIndex = 0; frameIndex < worldOffsetVisibleSceneItemIndices.size(); ++frameIndex)
+	{
+		if (worldOffsetVisibleSceneItemIndices[frameIndex] != originVisibleSceneItemIndices[frameIndex])
+		{
+			++numberOfMismatchingFrames;
+		}
+	}
+	if (0 != numberOfMismatchingFrames)
+	{
+		RHI_LOG(mRhi->getContext(), CRITICAL, "The culling check failed: The visible scene items at the world offset of %u meter differ from the ones at the world space origin in %u of %u frames", worldOffset, numberOfMismatchingFrames, static_cast<uint32_t>(worldOffsetVisibleSceneItemIndices.size()))
+	}
+
+	// Write report
+	report.addNumber("cullableSceneItems", static_cast<uint64_t>(numberOfCullableSceneItems));
+	report.addStatistics("visibleSceneItems", visibleSceneItemsPerFrame);
+	report.addStatistics("worldOffsetCullMilliseconds", worldOffsetMilliseconds);
+	report.addStatistics("originCullMilliseconds", originMilliseconds);
+	report.addNumber("mismatchingFrames", static_cast<uint64_t>(numberOfMismatchingFrames));
+	report.addCheckResult(0 == numberOfMismatchingFrames);
+	report.endObject();
+}
+
+void RendererCheck::cullAlongCameraPath(Milliseconds& cullMilliseconds, VisibleSceneItemIndices& visibleSceneItemIndices)
+{
+	Renderer::IRenderer& renderer = getRendererSafe();
+	Renderer::SceneResource& sceneResource = mCameraSceneItem->getSceneResource();
+	Renderer::SceneCullingManager& sceneCullingManager = sceneResource.getSceneCullingManager();
+
+	// Finish loading the meshes so the culling uses their final bounding volumes
+	renderer.flushAllQueues();
+	renderer.update();
+
+	// The synthetic scene items are always created in the same order, so the index inside the scene resource identifies them across synthetic scenes
+	std::unordered_map<const Renderer::ISceneItem*, uint32_t> sceneItemIndices;
+	const Renderer::SceneResource::SceneItems& sceneItems = sceneResource.getSceneItems();
+	sceneItemIndices.reserve(sceneItems.size());
+	for (size_t i = 0; i < sceneItems.size(); ++i)
+	{
+		sceneItemIndices.emplace(sceneItems[i], static_cast<uint32_t>(i));
+	}
+
+	// Cull each frame of the camera path, the renderer update is needed for the frame allocator
+	const float aspectRatio = static_cast<float>(mParameters.width) / static_cast<float>(mParameters.height);
+	const uint32_t numberOfFrames = mParameters.numberOfWarmupFrames + mParameters.numberOfMeasuredFrames;
+	Renderer::SceneCullingManager::SceneItems visibleSceneItems;
+	visibleSceneItemIndices.resize(numberOfFrames);
+	for (uint32_t frameIndex = 0; frameIndex < numberOfFrames; ++frameIndex)
+	{
+		updateCameraPath(frameIndex);
+		renderer.update();
+		visibleSceneItems.clear();
+		const BenchmarkReport::TimePoint cullStartTime = BenchmarkReport::now();
+		sceneCullingManager.gatherVisibleSceneItems(renderer, *mCameraSceneItem, aspectRatio, visibleSceneItems);
+		if (frameIndex >= mParameters.numberOfWarmupFrames)
+		{
+			cullMilliseconds.push_back(BenchmarkReport::getMilliseconds(cullStartTime, BenchmarkReport::now()));
+		}
+
+		// Gather the sorted indices of the visible scene items
+		std::vector<uint32_t>& frameVisibleSceneItemIndices = visibleSceneItemIndices[frameIndex];
+		frameVisibleSceneItemIndices.reserve(visibleSceneItems.size());
+		for (const Renderer::ISceneItem* sceneItem : visibleSceneItems)
+		{
+			frameVisibleSceneItemIndices.push_back(sceneItemIndices.at(sceneItem));
+		}
+		std::sort(frameVisibleSceneItemIndices.begin(), frameVisibleSceneItemIndices.end());
+	}
+}
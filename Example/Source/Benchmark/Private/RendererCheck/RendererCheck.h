@@ -0,0 +1,171 @@
+/*********************************************************\
+ * Copyright (c) 2012-2020 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Benchmark/Private/IBenchmarkApplication.h"
+
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4365)	// warning C4365: 'argument': conversion from 'long' to 'unsigned int', signed/unsigned mismatch
+	PRAGMA_WARNING_DISABLE_MSVC(4571)	// warning C4571: Informational: catch(...) semantics changed since Visual C++ 7.1; structured exceptions (SEH) are no longer caught
+	PRAGMA_WARNING_DISABLE_MSVC(4625)	// warning C4625: 'std::codecvt_base': copy constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4626)	// warning C4626: 'std::codecvt<char16_t,char,_Mbstatet>': assignment operator was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4668)	// warning C4668: '_M_HYBRID_X86_ARM64' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
+	PRAGMA_WARNING_DISABLE_MSVC(4774)	// warning C4774: 'sprintf_s' : format string expected in argument 3 is not a string literal
+	PRAGMA_WARNING_DISABLE_MSVC(5026)	// warning C5026: 'std::_Generic_error_category': move constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(5027)	// warning C5027: 'std::_Generic_error_category': move assignment operator was implicitly defined as deleted
+	#include <vector>
+PRAGMA_WARNING_POP
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Headless renderer correctness check
+*
+*  @remarks
+*    Runs the renderer checks which can't be judged by looking at the timings of the benchmark:
+*    - GPU instance culler: Cull random instances with the GPU instance culler CPU reference and compare the result against a brute-force eight corner frustum test
+*    - Occlusion culling: The software occlusion culling must report a box behind a wall as occluded while a box beside the wall stays visible
+*    - Culling far away from the world space origin: Cull the synthetic scene along the camera path once at the world offset and once at the
+*      world space origin without rendering, the visible scene items must match. The culling timings of both runs are reported as well.
+*
+*    The JSON report contains one object per check, the program return code is 1 if one of the checks failed, else 0. Works without any
+*    output window, so it can run on the null RHI.
+*
+*    Command line arguments in addition to the ones of "IBenchmarkApplication", all optional:
+*    - "--instances <n>": Number of random instances of the GPU instance culler check, default 100000
+*    - The default world offset is 100000 meter instead of 0
+*
+*    Example usage: "./RendererCheck -r Null --worldOffset 1000000 --output RendererCheck.json"
+*/
+class RendererCheck final : public IBenchmarkApplication
+{
+
+
+//[-------------------------------------------------------]
+//[ Public methods                                        ]
+//[-------------------------------------------------------]
+public:
+	/**
+	*  @brief
+	*    Default constructor
+	*/
+	RendererCheck();
+
+	/**
+	*  @brief
+	*    Destructor
+	*/
+	inline virtual ~RendererCheck() override
+	{
+		// Nothing here
+	}
+
+
+//[-------------------------------------------------------]
+//[ Protected virtual IBenchmarkApplication methods       ]
+//[-------------------------------------------------------]
+protected:
+	virtual void readParameters(const Arguments& arguments) override;
+	[[nodiscard]] virtual bool onDoJob() override;
+
+
+//[-------------------------------------------------------]
+//[ Private definitions                                   ]
+//[-------------------------------------------------------]
+private:
+	typedef std::vector<double>				   Milliseconds;			///< One entry per measured frame
+	typedef std::vector<std::vector<uint32_t>> VisibleSceneItemIndices;	///< One entry per frame, sorted scene item indices inside the scene resource
+
+
+//[-------------------------------------------------------]
+//[ Private methods                                       ]
+//[-------------------------------------------------------]
+private:
+	explicit RendererCheck(const RendererCheck&) = delete;
+	RendererCheck& operator=(const RendererCheck&) = delete;
+
+	/**
+	*  @brief
+	*    Check the GPU instance culler CPU reference implementation against a brute-force frustum test using random instances and the read back GPU draw list against the CPU reference implementation
+	*
+	*  @param[in] report
+	*    Report to add the check result to
+	*
+	*  @note
+	*    - The GPU draw list is only checked if the RHI supports the compute shader path, else only the CPU reference implementation is checked
+	*/
+	void checkGpuInstanceCuller(BenchmarkReport& report);
+
+	/**
+	*  @brief
+	*    Check the software occlusion culling using a wall in front of a box and a box beside the wall
+	*
+	*  @param[in] report
+	*    Report to add the check result to
+	*
+	*  @note
+	*    - Must be called before the synthetic scene is created since it replaces the scene content
+	*/
+	void checkOcclusionCulling(BenchmarkReport& report);
+
+	/**
+	*  @brief
+	*    Cull along the camera path at the world offset as well as at the world space origin without rendering and check that the visible scene items match
+	*
+	*  @param[in] report
+	*    Report to add the check result to
+	*
+	*  @note
+	*    - The synthetic scene is created at the world offset and afterwards recreated at the world space origin
+	*/
+	void checkCulling(BenchmarkReport& report);
+
+	/**
+	*  @brief
+	*    Cull the synthetic scene along the camera path without rendering
+	*
+	*  @param[out] cullMilliseconds
+	*    Receives the culling time of each measured frame
+	*  @param[out] visibleSceneItemIndices
+	*    Receives the visible scene items of each frame
+	*/
+	void cullAlongCameraPath(Milliseconds& cullMilliseconds, VisibleSceneItemIndices& visibleSceneItemIndices);
+
+
+//[-------------------------------------------------------]
+//[ Private data                                          ]
+//[-------------------------------------------------------]
+private:
+	uint32_t mNumberOfInstances;	///< Number of random instances of the GPU instance culler check
+
+
+};
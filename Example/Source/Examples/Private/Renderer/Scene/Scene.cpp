@@ -150,11 +150,14 @@ Scene::Scene() :
 	mCurrentCompositor(static_cast<int>(mInstancedCompositor)),
 	mShadowQuality(ShadowQuality::HIGH),
 	mCurrentShadowQuality(static_cast<int>(mShadowQuality)),
+	mShadowCasterCulling(true),
+	mDepthBasedCascadeFitting(false),
 	mHighQualityRendering(true),
 	mHighQualityLighting(true),
 	mSoftParticles(true),
 	mCurrentTextureFiltering(static_cast<int>(TextureFiltering::ANISOTROPIC_4)),
 	mNumberOfTopTextureMipmapsToRemove(0),
+	mTextureStreaming(true),
 	mNumberOfTopMeshLodsToRemove(0),
 	mTerrainTessellatedTriangleWidth(16),
 	// Environment
@@ -703,6 +706,7 @@ void Scene::applyCurrentSettings(Rhi::IRenderTarget& mainRenderTarget)
 			}
 		}
 		renderer.getTextureResourceManager().setNumberOfTopMipmapsToRemove(static_cast<uint8_t>(mNumberOfTopTextureMipmapsToRemove));
+		renderer.getTextureResourceManager().setTextureStreamingEnabled(mTextureStreaming);
 
 		// Update mesh related settings
 		renderer.getMeshResourceManager().setNumberOfTopMeshLodsToRemove(static_cast<uint8_t>(mNumberOfTopMeshLodsToRemove));
@@ -778,6 +782,21 @@ void Scene::applyCurrentSettings(Rhi::IRenderTarget& mainRenderTarget)
 					}
 				}
 			}
+			for (const Renderer::CompositorNodeInstance* compositorNodeInstance : mCompositorWorkspaceInstance->getSequentialCompositorNodeInstances())
+			{
+				for (Renderer::ICompositorInstancePass* compositorInstancePass : compositorNodeInstance->getCompositorInstancePasses())
+				{
+					if (compositorInstancePass->getCompositorResourcePass().getTypeId() == Renderer::CompositorResourcePassShadowMap::TYPE_ID)
+					{
+						Renderer::CompositorInstancePassShadowMap* compositorInstancePassShadowMap = static_cast<Renderer::CompositorInstancePassShadowMap*>(compositorInstancePass);
+						compositorInstancePassShadowMap->setShadowCasterCulling(mShadowCasterCulling);
+						compositorInstancePassShadowMap->setDepthBasedCascadeFitting(mDepthBasedCascadeFitting);
+
+						// We know that there's just a single compositor instance pass shadow map per compositor node instance, so get us out of the inner loop right now
+						break;
+					}
+				}
+			}
 		}
 
 		{ // Update the material resource instance
@@ -933,6 +952,20 @@ void Scene::createDebugGui([[maybe_unused]] Rhi::IRenderTarget& mainRenderTarget
 							static constexpr const char* items[] = { "None", "Low", "Medium", "High", "Ultra", "Epic" };
 							ImGui::Combo("Shadow Quality", &mCurrentShadowQuality, items, static_cast<int>(GLM_COUNTOF(items)));
 						}
+						{ // Shadow caster culling
+							ImGui::Checkbox("Shadow Caster Culling", &mShadowCasterCulling);
+							if (ImGui::IsItemHovered())
+							{
+								ImGui::SetTooltip("Render only the shadow casters inside a shadow cascade instead of all shadow casters visible to the camera into each shadow cascade");
+							}
+						}
+						{ // Depth based cascade fitting
+							ImGui::Checkbox("Depth Based Cascade Fitting", &mDepthBasedCascadeFitting);
+							if (ImGui::IsItemHovered())
+							{
+								ImGui::SetTooltip("Fit the shadow cascades to the depth range of the visible scene");
+							}
+						}
 						{ // High quality rendering
 							ImGui::Checkbox("High Quality Rendering", &mHighQualityRendering);
 							if (ImGui::IsItemHovered())
@@ -947,6 +980,13 @@ void Scene::createDebugGui([[maybe_unused]] Rhi::IRenderTarget& mainRenderTarget
 							ImGui::Combo("Texture Filtering", &mCurrentTextureFiltering, items, static_cast<int>(GLM_COUNTOF(items)));
 						}
 						ImGui::SliderInt("Texture Mipmaps to Remove", &mNumberOfTopTextureMipmapsToRemove, 0, 8);
+						{ // Texture streaming
+							ImGui::Checkbox("Texture Streaming", &mTextureStreaming);
+							if (ImGui::IsItemHovered())
+							{
+								ImGui::SetTooltip("Stream texture mipmaps in and out depending on the on-screen size of visible geometry, see metrics window for resident and requested mipmaps");
+							}
+						}
 						ImGui::SliderInt("Mesh LODs to Remove", &mNumberOfTopMeshLodsToRemove, 0, 4);
 						ImGui::SliderInt("Terrain Tessellated Triangle Width", &mTerrainTessellatedTriangleWidth, 0, 64);
 						if (ImGui::IsItemHovered())
@@ -207,11 +207,14 @@ private:
 	int			  mCurrentCompositor;
 	ShadowQuality mShadowQuality;
 	int			  mCurrentShadowQuality;
+	bool		  mShadowCasterCulling;
+	bool		  mDepthBasedCascadeFitting;
 	bool		  mHighQualityRendering;
 	bool		  mHighQualityLighting;
 	bool		  mSoftParticles;
 	int			  mCurrentTextureFiltering;
 	int			  mNumberOfTopTextureMipmapsToRemove;
+	bool		  mTextureStreaming;
 	int			  mNumberOfTopMeshLodsToRemove;
 	int			  mTerrainTessellatedTriangleWidth;
 	// Environment
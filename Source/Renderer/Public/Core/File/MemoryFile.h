@@ -125,6 +125,21 @@ namespace Renderer
 			return mDecompressedData;
 		}
 
+		/**
+		*  @brief
+		*    Return the current decompressed data position
+		*
+		*  @return
+		*    The current decompressed data position, don't destroy the data, only valid as long as the decompressed data isn't changed
+		*
+		*  @note
+		*    - Allows readers to directly work on the decompressed data instead of copying it into temporary buffers, use "Renderer::MemoryFile::skip()" to advance
+		*/
+		[[nodiscard]] inline const uint8_t* getCurrentDataPointer() const
+		{
+			return mCurrentDataPointer;
+		}
+
 		[[nodiscard]] RENDERER_API_EXPORT bool loadLz4CompressedDataByVirtualFilename(uint32_t formatType, uint32_t formatVersion, const IFileManager& fileManager, VirtualFilename virtualFilename);
 		[[nodiscard]] RENDERER_API_EXPORT bool loadLz4CompressedDataFromFile(uint32_t formatType, uint32_t formatVersion, IFile& file);
 		RENDERER_API_EXPORT void setLz4CompressedDataByFile(IFile& file, uint32_t numberOfCompressedBytes, uint32_t numberOfDecompressedBytes);
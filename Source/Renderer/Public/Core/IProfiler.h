@@ -33,6 +33,15 @@
 	#include <inttypes.h>	// For uint32_t, uint64_t etc.
 
 
+	//[-------------------------------------------------------]
+	//[ Forward declarations                                  ]
+	//[-------------------------------------------------------]
+	namespace Rhi
+	{
+		class CommandBuffer;
+	}
+
+
 	//[-------------------------------------------------------]
 	//[ Namespace                                             ]
 	//[-------------------------------------------------------]
@@ -89,12 +98,120 @@
 			*/
 			virtual void endGpuSample() = 0;
 
+			/**
+			*  @brief
+			*    Begin a frame recorded into the given command buffer
+			*
+			*  @param[in] commandBuffer
+			*    RHI command buffer of the frame, must be submitted during the current frame
+			*
+			*  @note
+			*    - Must be called at the begin of the command buffer before any render target is set, profilers can record per frame commands like query pool resets which aren't allowed inside render passes
+			*    - The default implementation does nothing
+			*/
+			inline virtual void beginCommandBufferFrame([[maybe_unused]] Rhi::CommandBuffer& commandBuffer)
+			{
+				// Nothing here
+			}
+
+			/**
+			*  @brief
+			*    Suspend or resume recording GPU samples into command buffers
+			*
+			*  @param[in] suspended
+			*    "true" to suspend recording GPU samples into command buffers, else "false"
+			*
+			*  @note
+			*    - Used while recording command buffers which are cached and replayed during later frames, GPU samples baked into such command buffers would reference stale profiler data
+			*    - While suspended, "Renderer::IProfiler::beginCommandBufferGpuSample()" and "Renderer::IProfiler::endCommandBufferGpuSample()" don't reach the profiler implementation at all, so the caller has to sample the replayed command buffer from the outside
+			*    - Must not be changed between a begin and its corresponding end
+			*/
+			inline void setCommandBufferGpuSamplesSuspended(bool suspended)
+			{
+				mCommandBufferGpuSamplesSuspended = suspended;
+			}
+
+			/**
+			*  @brief
+			*    Begin profiler GPU sample section recorded into the given command buffer
+			*
+			*  @param[in] commandBuffer
+			*    RHI command buffer the GPU sample is recorded into, must be submitted during the current frame
+			*  @param[in] name
+			*    Section name
+			*  @param[in] hashCache
+			*    Hash cache, can be a null pointer (less efficient)
+			*/
+			inline void beginCommandBufferGpuSample(Rhi::CommandBuffer& commandBuffer, const char* name, uint32_t* hashCache)
+			{
+				if (!mCommandBufferGpuSamplesSuspended)
+				{
+					onBeginCommandBufferGpuSample(commandBuffer, name, hashCache);
+				}
+			}
+
+			/**
+			*  @brief
+			*    End profiler GPU sample section recorded into the given command buffer
+			*
+			*  @param[in] commandBuffer
+			*    RHI command buffer the GPU sample is recorded into, must be the one given to the corresponding "Renderer::IProfiler::beginCommandBufferGpuSample()" call
+			*/
+			inline void endCommandBufferGpuSample(Rhi::CommandBuffer& commandBuffer)
+			{
+				if (!mCommandBufferGpuSamplesSuspended)
+				{
+					onEndCommandBufferGpuSample(commandBuffer);
+				}
+			}
+
+
+		//[-------------------------------------------------------]
+		//[ Protected virtual Renderer::IProfiler methods         ]
+		//[-------------------------------------------------------]
+		protected:
+			/**
+			*  @brief
+			*    Begin profiler GPU sample section recorded into the given command buffer
+			*
+			*  @param[in] commandBuffer
+			*    RHI command buffer the GPU sample is recorded into, must be submitted during the current frame
+			*  @param[in] name
+			*    Section name
+			*  @param[in] hashCache
+			*    Hash cache, can be a null pointer (less efficient)
+			*
+			*  @note
+			*    - The default implementation ignores the command buffer, profilers which e.g. write GPU timestamp queries have to overwrite this method
+			*    - Not called while command buffer GPU samples are suspended
+			*/
+			inline virtual void onBeginCommandBufferGpuSample([[maybe_unused]] Rhi::CommandBuffer& commandBuffer, const char* name, uint32_t* hashCache)
+			{
+				beginGpuSample(name, hashCache);
+			}
+
+			/**
+			*  @brief
+			*    End profiler GPU sample section recorded into the given command buffer
+			*
+			*  @param[in] commandBuffer
+			*    RHI command buffer the GPU sample is recorded into, must be the one given to the corresponding "Renderer::IProfiler::onBeginCommandBufferGpuSample()" call
+			*
+			*  @note
+			*    - Not called while command buffer GPU samples are suspended
+			*/
+			inline virtual void onEndCommandBufferGpuSample([[maybe_unused]] Rhi::CommandBuffer& commandBuffer)
+			{
+				endGpuSample();
+			}
+
 
 		//[-------------------------------------------------------]
 		//[ Protected methods                                     ]
 		//[-------------------------------------------------------]
 		protected:
-			inline IProfiler()
+			inline IProfiler() :
+				mCommandBufferGpuSamplesSuspended(false)
 			{
 				// Nothing here
 			}
@@ -108,6 +225,13 @@
 			IProfiler& operator=(const IProfiler&) = delete;
 
 
+		//[-------------------------------------------------------]
+		//[ Private data                                          ]
+		//[-------------------------------------------------------]
+		private:
+			bool mCommandBufferGpuSamplesSuspended;	///< Don't let GPU samples reach command buffers which are replayed during later frames
+
+
 		};
 
 
@@ -236,6 +360,38 @@
 		};
 	}
 
+	namespace Renderer
+	{
+		/**
+		*  @brief
+		*    Scoped profiler GPU sample section recorded into a command buffer
+		*/
+		class RendererProfilerScopedCommandBufferGpuSampleOnExit
+		{
+		// Public methods
+		public:
+			inline RendererProfilerScopedCommandBufferGpuSampleOnExit(IProfiler& profiler, Rhi::CommandBuffer& commandBuffer) :
+				mProfiler(profiler),
+				mCommandBuffer(commandBuffer)
+			{}
+
+			inline ~RendererProfilerScopedCommandBufferGpuSampleOnExit()
+			{
+				mProfiler.endCommandBufferGpuSample(mCommandBuffer);
+			}
+
+		// Private methods
+		private:
+			explicit RendererProfilerScopedCommandBufferGpuSampleOnExit(const RendererProfilerScopedCommandBufferGpuSampleOnExit& rendererProfilerScopedCommandBufferGpuSampleOnExit) = delete;
+			RendererProfilerScopedCommandBufferGpuSampleOnExit& operator =(const RendererProfilerScopedCommandBufferGpuSampleOnExit& rendererProfilerScopedCommandBufferGpuSampleOnExit) = delete;
+
+		// Private data
+		private:
+			IProfiler&			mProfiler;
+			Rhi::CommandBuffer& mCommandBuffer;
+		};
+	}
+
 	/**
 	*  @brief
 	*    Scoped profiler GPU sample section, minor internal overhead compared to manual begin/end
@@ -265,11 +421,11 @@
 	*/
 	#define RENDERER_SCOPED_PROFILER_EVENT(context, commandBuffer, name) \
 		COMMAND_SCOPED_DEBUG_EVENT(commandBuffer, name) \
-		{ static uint32_t sampleHash_##__LINE__ = 0; (context).getProfiler().beginGpuSample(name, &sampleHash_##__LINE__); (context).getProfiler().beginCpuSample(name, &sampleHash_##__LINE__); } \
+		{ static uint32_t sampleHash_##__LINE__ = 0; (context).getProfiler().beginCommandBufferGpuSample(commandBuffer, name, &sampleHash_##__LINE__); (context).getProfiler().beginCpuSample(name, &sampleHash_##__LINE__); } \
 		PRAGMA_WARNING_PUSH \
 			PRAGMA_WARNING_DISABLE_MSVC(4456) \
 			Renderer::RendererProfilerScopedCpuSampleOnExit rendererProfilerScopedCpuSampleOnExit##__FUNCTION__((context).getProfiler()); \
-			Renderer::RendererProfilerScopedGpuSampleOnExit rendererProfilerScopedGpuSampleOnExit##__FUNCTION__((context).getProfiler()); \
+			Renderer::RendererProfilerScopedCommandBufferGpuSampleOnExit rendererProfilerScopedCommandBufferGpuSampleOnExit##__FUNCTION__((context).getProfiler(), commandBuffer); \
 		PRAGMA_WARNING_POP
 
 	/**
@@ -285,12 +441,12 @@
 	*/
 	#define RENDERER_SCOPED_PROFILER_EVENT_DYNAMIC(context, commandBuffer, name) \
 		COMMAND_SCOPED_DEBUG_EVENT(commandBuffer, name) \
-		(context).getProfiler().beginGpuSample(name, nullptr); \
+		(context).getProfiler().beginCommandBufferGpuSample(commandBuffer, name, nullptr); \
 		(context).getProfiler().beginCpuSample(name, nullptr); \
 		PRAGMA_WARNING_PUSH \
 			PRAGMA_WARNING_DISABLE_MSVC(4456) \
 			Renderer::RendererProfilerScopedCpuSampleOnExit rendererProfilerScopedCpuSampleOnExit##__FUNCTION__((context).getProfiler()); \
-			Renderer::RendererProfilerScopedGpuSampleOnExit rendererProfilerScopedGpuSampleOnExit##__FUNCTION__((context).getProfiler()); \
+			Renderer::RendererProfilerScopedCommandBufferGpuSampleOnExit rendererProfilerScopedCommandBufferGpuSampleOnExit##__FUNCTION__((context).getProfiler(), commandBuffer); \
 		PRAGMA_WARNING_POP
 
 	/**
@@ -0,0 +1,164 @@
+/*********************************************************\
+ * Copyright (c) 2012-2020 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Renderer/Public/Core/Memory/FrameAllocator.h"
+
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4668)	// warning C4668: '_M_HYBRID_X86_ARM64' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
+	#include <algorithm>	// For "std::max()"
+PRAGMA_WARNING_POP
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Global definitions                                    ]
+		//[-------------------------------------------------------]
+		static constexpr size_t ARENA_ALIGNMENT = 64;	///< Cache line size
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	FrameAllocator::FrameAllocator(Rhi::IAllocator& allocator, size_t numberOfBytesPerArena) :
+		mAllocator(allocator),
+		mNumberOfBytesPerArena(numberOfBytesPerArena),
+		mCurrentArenaIndex(0),
+		mEnabled(true),
+		mEnabledNextFrame(true),
+		mStatistics{ numberOfBytesPerArena, 0, 0, 0, 0 }
+	{
+		if (mNumberOfBytesPerArena > 0)
+		{
+			for (Arena& arena : mArenas)
+			{
+				arena.memory = static_cast<uint8_t*>(mAllocator.reallocate(nullptr, 0, mNumberOfBytesPerArena, ::detail::ARENA_ALIGNMENT));
+			}
+		}
+	}
+
+	FrameAllocator::~FrameAllocator()
+	{
+		for (Arena& arena : mArenas)
+		{
+			resetArena(arena);
+			if (nullptr != arena.memory)
+			{
+				mAllocator.reallocate(arena.memory, mNumberOfBytesPerArena, 0, ::detail::ARENA_ALIGNMENT);
+			}
+		}
+	}
+
+	void* FrameAllocator::allocate(size_t numberOfBytes, size_t alignment)
+	{
+		// Sanity checks
+		ASSERT(0 != alignment && !(alignment & (alignment - 1)), "The frame allocator alignment must be a power of two")
+		ASSERT(alignment <= ::detail::ARENA_ALIGNMENT, "The frame allocator alignment must not be larger than the arena alignment")
+
+		// Reserve the worst case inside the arena, this way a single atomic operation is sufficient
+		Arena& arena = mArenas[mCurrentArenaIndex];
+		++arena.numberOfAllocations;
+		numberOfBytes = std::max<size_t>(numberOfBytes, 1);
+		if (mEnabled && nullptr != arena.memory)
+		{
+			const size_t numberOfReservedBytes = numberOfBytes + alignment - 1;
+			const size_t offset = arena.numberOfUsedBytes.fetch_add(numberOfReservedBytes);
+			if (offset + numberOfReservedBytes <= mNumberOfBytesPerArena)
+			{
+				return reinterpret_cast<void*>((reinterpret_cast<uintptr_t>(arena.memory) + offset + alignment - 1) & ~static_cast<uintptr_t>(alignment - 1));
+			}
+		}
+
+		// The arena is exhausted or disabled, fall back to the heap
+		return allocateOverflow(arena, numberOfBytes, alignment);
+	}
+
+	void FrameAllocator::nextFrame()
+	{
+		{ // Gather the statistics of the frame which just ended
+			const Arena& arena = mArenas[mCurrentArenaIndex];
+			mStatistics.numberOfUsedBytes = std::min(arena.numberOfUsedBytes.load(), mNumberOfBytesPerArena);
+			mStatistics.peakNumberOfUsedBytes = std::max(mStatistics.peakNumberOfUsedBytes, mStatistics.numberOfUsedBytes);
+			mStatistics.numberOfAllocations = arena.numberOfAllocations.load();
+			mStatistics.numberOfOverflowAllocations = static_cast<uint32_t>(arena.overflowAllocations.size());
+		}
+
+		// Switch to the next arena, the memory inside it was handed out two frames ago and can be recycled
+		mCurrentArenaIndex = (mCurrentArenaIndex + 1) % NUMBER_OF_ARENAS;
+		resetArena(mArenas[mCurrentArenaIndex]);
+		mEnabled = mEnabledNextFrame;
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	void* FrameAllocator::allocateOverflow(Arena& arena, size_t numberOfBytes, size_t alignment)
+	{
+		void* pointer = mAllocator.reallocate(nullptr, 0, numberOfBytes, alignment);
+		if (nullptr != pointer)
+		{
+			std::lock_guard<std::mutex> overflowMutexLock(arena.overflowMutex);
+			arena.overflowAllocations.push_back(pointer);
+		}
+		return pointer;
+	}
+
+	void FrameAllocator::resetArena(Arena& arena)
+	{
+		for (void* pointer : arena.overflowAllocations)
+		{
+			mAllocator.reallocate(pointer, 0, 0, 1);
+		}
+		arena.overflowAllocations.clear();
+		arena.numberOfUsedBytes = 0;
+		arena.numberOfAllocations = 0;
+	}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // Renderer
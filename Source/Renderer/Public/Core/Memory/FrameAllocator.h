@@ -0,0 +1,423 @@
+/*********************************************************\
+ * Copyright (c) 2012-2020 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Renderer/Public/Core/Manager.h"
+
+#include <Rhi/Public/Rhi.h>
+
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4365)	// warning C4365: 'argument': conversion from 'long' to 'unsigned int', signed/unsigned mismatch
+	PRAGMA_WARNING_DISABLE_MSVC(4571)	// warning C4571: Informational: catch(...) semantics changed since Visual C++ 7.1; structured exceptions (SEH) are no longer caught
+	PRAGMA_WARNING_DISABLE_MSVC(4623)	// warning C4623: 'std::_List_node<_Ty,std::_Default_allocator_traits<_Alloc>::void_pointer>': default constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4625)	// warning C4625: 'std::_Generic_error_category': copy constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4626)	// warning C4626: 'std::_Generic_error_category': assignment operator was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4774)	// warning C4774: 'sprintf_s' : format string expected in argument 3 is not a string literal
+	PRAGMA_WARNING_DISABLE_MSVC(5026)	// warning C5026: 'std::_Generic_error_category': move constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(5027)	// warning C5027: 'std::_Generic_error_category': move assignment operator was implicitly defined as deleted
+	#include <mutex>
+	#include <atomic>	// For "std::atomic<>"
+	#include <vector>
+	#include <cstddef>	// For "std::max_align_t"
+	#include <type_traits>
+PRAGMA_WARNING_POP
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Classes                                               ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Double buffered linear frame arena allocator for transient per-frame renderer data
+	*
+	*  @remarks
+	*    Allocations are a lock-free pointer bump inside the arena of the current frame, there's no individual deallocation. The arena of a
+	*    frame is reset as a whole two "Renderer::FrameAllocator::nextFrame()" calls later, so memory requested during frame N stays valid until
+	*    the end of frame N + 1. If an arena is exhausted the allocation falls back to the heap, those overflow allocations are released together
+	*    with the arena. Watch "Renderer::FrameAllocator::Statistics::numberOfOverflowAllocations" to tune the arena size.
+	*
+	*    Usage example:
+	*    FrameVector<Rhi::IResource*> resources(FrameStlAllocator<Rhi::IResource*>(renderer.getFrameAllocator()));
+	*
+	*  @note
+	*    - "Renderer::FrameAllocator::allocate()" can be called by multiple threads at the same time, use "Renderer::FrameSubAllocator" to reduce contention for many tiny allocations
+	*    - "Renderer::FrameAllocator::nextFrame()" must not be called while other threads are allocating
+	*    - Don't store frame allocator memory inside data which lives longer than the next frame
+	*/
+	class FrameAllocator final : public Manager
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Public definitions                                    ]
+	//[-------------------------------------------------------]
+	public:
+		static constexpr uint32_t NUMBER_OF_ARENAS  = 2;	///< Number of arenas, double buffered
+		static constexpr size_t   DEFAULT_ALIGNMENT = alignof(std::max_align_t);
+
+		/**
+		*  @brief
+		*    Frame allocator statistics of the last completed frame
+		*/
+		struct Statistics final
+		{
+			size_t	 numberOfBytesPerArena;
+			size_t	 numberOfUsedBytes;				///< Number of arena bytes used during the last completed frame, including alignment padding, clamped to the arena size
+			size_t	 peakNumberOfUsedBytes;			///< Highest number of used arena bytes since the frame allocator creation
+			uint32_t numberOfAllocations;			///< Number of allocations during the last completed frame, including overflow allocations
+			uint32_t numberOfOverflowAllocations;	///< Number of allocations during the last completed frame which didn't fit into the arena and hence were heap allocations
+		};
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Constructor
+		*
+		*  @param[in] allocator
+		*    Allocator used for the arenas as well as for overflow allocations, the instance must stay valid as long as the frame allocator instance exists
+		*  @param[in] numberOfBytesPerArena
+		*    Number of bytes per arena, the frame allocator needs two arenas
+		*/
+		FrameAllocator(Rhi::IAllocator& allocator, size_t numberOfBytesPerArena);
+
+		/**
+		*  @brief
+		*    Destructor
+		*/
+		~FrameAllocator();
+
+		/**
+		*  @brief
+		*    Return whether or not the frame allocator is enabled
+		*
+		*  @return
+		*    "true" if the frame allocator is enabled, else "false"
+		*/
+		[[nodiscard]] inline bool isEnabled() const
+		{
+			return mEnabled;
+		}
+
+		/**
+		*  @brief
+		*    Set whether or not the frame allocator is enabled
+		*
+		*  @param[in] enabled
+		*    "true" to enable the frame allocator, "false" to turn each allocation into a heap allocation (e.g. to compare the number of heap allocations)
+		*
+		*  @note
+		*    - Takes effect at the next frame
+		*/
+		inline void setEnabled(bool enabled)
+		{
+			mEnabledNextFrame = enabled;
+		}
+
+		/**
+		*  @brief
+		*    Return the frame allocator statistics of the last completed frame
+		*
+		*  @return
+		*    The frame allocator statistics of the last completed frame
+		*/
+		[[nodiscard]] inline const Statistics& getStatistics() const
+		{
+			return mStatistics;
+		}
+
+		/**
+		*  @brief
+		*    Allocate memory which stays valid until the end of the next frame
+		*
+		*  @param[in] numberOfBytes
+		*    Number of bytes to allocate
+		*  @param[in] alignment
+		*    Alignment, must be a power of two
+		*
+		*  @return
+		*    The allocated memory, don't free it, can be a null pointer if also the heap is out of memory
+		*/
+		[[nodiscard]] void* allocate(size_t numberOfBytes, size_t alignment = DEFAULT_ALIGNMENT);
+
+		/**
+		*  @brief
+		*    Allocate an uninitialized array which stays valid until the end of the next frame
+		*
+		*  @param[in] numberOfElements
+		*    Number of array elements
+		*
+		*  @return
+		*    The allocated array, don't free it, can be a null pointer if also the heap is out of memory
+		*/
+		template <typename TYPE>
+		[[nodiscard]] inline TYPE* allocateArray(size_t numberOfElements)
+		{
+			static_assert(std::is_trivially_destructible<TYPE>::value, "The frame allocator never calls destructors");
+			return static_cast<TYPE*>(allocate(sizeof(TYPE) * numberOfElements, alignof(TYPE)));
+		}
+
+		/**
+		*  @brief
+		*    Switch to the next frame, the arena of the frame before the last frame is reset
+		*
+		*  @note
+		*    - Call this once per frame, this is done by "Renderer::IRenderer::update()"
+		*/
+		void nextFrame();
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		struct Arena final
+		{
+			uint8_t*			  memory = nullptr;
+			std::atomic<size_t>	  numberOfUsedBytes = 0;
+			std::atomic<uint32_t> numberOfAllocations = 0;
+			std::mutex			  overflowMutex;
+			std::vector<void*>	  overflowAllocations;
+		};
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		explicit FrameAllocator(const FrameAllocator&) = delete;
+		FrameAllocator& operator=(const FrameAllocator&) = delete;
+		[[nodiscard]] void* allocateOverflow(Arena& arena, size_t numberOfBytes, size_t alignment);
+		void resetArena(Arena& arena);
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		Rhi::IAllocator& mAllocator;
+		const size_t	 mNumberOfBytesPerArena;
+		Arena			 mArenas[NUMBER_OF_ARENAS];
+		uint32_t		 mCurrentArenaIndex;
+		bool			 mEnabled;
+		bool			 mEnabledNextFrame;
+		Statistics		 mStatistics;
+
+
+	};
+
+	/**
+	*  @brief
+	*    Per-thread frame sub-allocator
+	*
+	*  @remarks
+	*    Grabs chunks from the frame allocator and bumps inside them without any synchronization. Create one instance on the stack of each worker
+	*    task which performs many tiny transient allocations, the memory has the same lifetime as memory directly requested from the frame allocator.
+	*/
+	class FrameSubAllocator final
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Public definitions                                    ]
+	//[-------------------------------------------------------]
+	public:
+		static constexpr size_t DEFAULT_NUMBER_OF_BYTES_PER_CHUNK = 16 * 1024;
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		inline explicit FrameSubAllocator(FrameAllocator& frameAllocator, size_t numberOfBytesPerChunk = DEFAULT_NUMBER_OF_BYTES_PER_CHUNK) :
+			mFrameAllocator(frameAllocator),
+			mNumberOfBytesPerChunk(numberOfBytesPerChunk),
+			mCurrent(nullptr),
+			mEnd(nullptr)
+		{
+			// Nothing here
+		}
+
+		inline ~FrameSubAllocator()
+		{
+			// Nothing here, the chunks belong to the frame allocator
+		}
+
+		[[nodiscard]] inline FrameAllocator& getFrameAllocator() const
+		{
+			return mFrameAllocator;
+		}
+
+		[[nodiscard]] void* allocate(size_t numberOfBytes, size_t alignment = FrameAllocator::DEFAULT_ALIGNMENT)
+		{
+			uintptr_t aligned = (reinterpret_cast<uintptr_t>(mCurrent) + alignment - 1) & ~static_cast<uintptr_t>(alignment - 1);
+			if (nullptr == mCurrent || aligned + numberOfBytes > reinterpret_cast<uintptr_t>(mEnd))
+			{
+				// Allocations which would waste most of a chunk go directly to the frame allocator
+				if (numberOfBytes + alignment > mNumberOfBytesPerChunk / 2)
+				{
+					return mFrameAllocator.allocate(numberOfBytes, alignment);
+				}
+
+				// Start a new chunk, the rest of the current chunk is lost
+				mCurrent = static_cast<uint8_t*>(mFrameAllocator.allocate(mNumberOfBytesPerChunk));
+				if (nullptr == mCurrent)
+				{
+					mEnd = nullptr;
+					return nullptr;
+				}
+				mEnd = mCurrent + mNumberOfBytesPerChunk;
+				aligned = (reinterpret_cast<uintptr_t>(mCurrent) + alignment - 1) & ~static_cast<uintptr_t>(alignment - 1);
+			}
+			mCurrent = reinterpret_cast<uint8_t*>(aligned + numberOfBytes);
+			return reinterpret_cast<void*>(aligned);
+		}
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		explicit FrameSubAllocator(const FrameSubAllocator&) = delete;
+		FrameSubAllocator& operator=(const FrameSubAllocator&) = delete;
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		FrameAllocator& mFrameAllocator;
+		const size_t	mNumberOfBytesPerChunk;
+		uint8_t*		mCurrent;	///< Current position inside the current chunk, can be a null pointer
+		uint8_t*		mEnd;		///< End of the current chunk, can be a null pointer
+
+
+	};
+
+	/**
+	*  @brief
+	*    STL-compatible allocator adapter for "Renderer::FrameAllocator" and "Renderer::FrameSubAllocator"
+	*
+	*  @note
+	*    - Deallocation does nothing, the memory is reclaimed when the frame arena is reset
+	*    - Containers using this allocator must not live longer than the next frame
+	*    - Not final by intent, STL implementations might derive from the allocator
+	*/
+	template <typename TYPE, typename ALLOCATOR = FrameAllocator>
+	class FrameStlAllocator
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Public definitions                                    ]
+	//[-------------------------------------------------------]
+	public:
+		typedef TYPE value_type;
+		template <typename OTHER_TYPE>
+		struct rebind
+		{
+			typedef FrameStlAllocator<OTHER_TYPE, ALLOCATOR> other;
+		};
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		inline explicit FrameStlAllocator(ALLOCATOR& allocator) :
+			mAllocator(&allocator)
+		{
+			// Nothing here
+		}
+
+		template <typename OTHER_TYPE>
+		inline FrameStlAllocator(const FrameStlAllocator<OTHER_TYPE, ALLOCATOR>& other) :
+			mAllocator(&other.getAllocator())
+		{
+			// Nothing here
+		}
+
+		[[nodiscard]] inline ALLOCATOR& getAllocator() const
+		{
+			return *mAllocator;
+		}
+
+		[[nodiscard]] inline TYPE* allocate(size_t numberOfElements)
+		{
+			return static_cast<TYPE*>(mAllocator->allocate(sizeof(TYPE) * numberOfElements, alignof(TYPE)));
+		}
+
+		inline void deallocate(TYPE*, size_t)
+		{
+			// Nothing here, see class documentation
+		}
+
+		template <typename OTHER_TYPE>
+		[[nodiscard]] inline bool operator==(const FrameStlAllocator<OTHER_TYPE, ALLOCATOR>& other) const
+		{
+			return (mAllocator == &other.getAllocator());
+		}
+
+		template <typename OTHER_TYPE>
+		[[nodiscard]] inline bool operator!=(const FrameStlAllocator<OTHER_TYPE, ALLOCATOR>& other) const
+		{
+			return (mAllocator != &other.getAllocator());
+		}
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		ALLOCATOR* mAllocator;	///< Always valid
+
+
+	};
+
+
+	//[-------------------------------------------------------]
+	//[ Type definitions                                      ]
+	//[-------------------------------------------------------]
+	template <typename TYPE> using FrameVector = std::vector<TYPE, FrameStlAllocator<TYPE>>;
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // Renderer
@@ -46,6 +46,14 @@ namespace
 			return (left.framebufferSignature.getFramebufferSignatureId() < right.framebufferSignature.getFramebufferSignatureId());
 		}
 
+		[[nodiscard]] uint32_t getFramebufferElementIndexByFramebufferSignatureId(const std::vector<Renderer::FramebufferManager::FramebufferElement>& sortedFramebufferVector, Renderer::FramebufferSignatureId framebufferSignatureId)
+		{
+			// The framebuffer elements are sorted by their framebuffer signature ID, which is a hash, so a binary search is sufficient
+			std::vector<Renderer::FramebufferManager::FramebufferElement>::const_iterator iterator = std::lower_bound(sortedFramebufferVector.cbegin(), sortedFramebufferVector.cend(), framebufferSignatureId,
+				[](const Renderer::FramebufferManager::FramebufferElement& framebufferElement, Renderer::FramebufferSignatureId value) { return (framebufferElement.framebufferSignature.getFramebufferSignatureId() < value); });
+			return (iterator != sortedFramebufferVector.cend() && iterator->framebufferSignature.getFramebufferSignatureId() == framebufferSignatureId) ? static_cast<uint32_t>(iterator - sortedFramebufferVector.cbegin()) : Renderer::getInvalid<uint32_t>();
+		}
+
 
 //[-------------------------------------------------------]
 //[ Anonymous detail namespace                            ]
@@ -103,6 +111,22 @@ namespace Renderer
 		mCompositorFramebufferIdToFramebufferSignatureId.emplace(compositorFramebufferId, framebufferSignature.getFramebufferSignatureId());
 	}
 
+	const FramebufferSignature* FramebufferManager::getFramebufferSignatureByCompositorFramebufferId(CompositorFramebufferId compositorFramebufferId) const
+	{
+		CompositorFramebufferIdToFramebufferSignatureId::const_iterator iterator = mCompositorFramebufferIdToFramebufferSignatureId.find(compositorFramebufferId);
+		if (mCompositorFramebufferIdToFramebufferSignatureId.cend() != iterator)
+		{
+			const uint32_t index = ::detail::getFramebufferElementIndexByFramebufferSignatureId(mSortedFramebufferVector, iterator->second);
+			if (isValid(index))
+			{
+				return &mSortedFramebufferVector[index].framebufferSignature;
+			}
+		}
+
+		// Unknown compositor framebuffer ID
+		return nullptr;
+	}
+
 	Rhi::IFramebuffer* FramebufferManager::getFramebufferByCompositorFramebufferId(CompositorFramebufferId compositorFramebufferId) const
 	{
 		Rhi::IFramebuffer* framebuffer = nullptr;
@@ -111,16 +135,10 @@ namespace Renderer
 		CompositorFramebufferIdToFramebufferSignatureId::const_iterator iterator = mCompositorFramebufferIdToFramebufferSignatureId.find(compositorFramebufferId);
 		if (mCompositorFramebufferIdToFramebufferSignatureId.cend() != iterator)
 		{
-			// TODO(co) Is there need for a more efficient search?
-			const FramebufferSignatureId framebufferSignatureId = iterator->second;
-			for (const FramebufferElement& framebufferElement : mSortedFramebufferVector)
+			const uint32_t index = ::detail::getFramebufferElementIndexByFramebufferSignatureId(mSortedFramebufferVector, iterator->second);
+			if (isValid(index))
 			{
-				const FramebufferSignature& framebufferSignature = framebufferElement.framebufferSignature;
-				if (framebufferSignature.getFramebufferSignatureId() == framebufferSignatureId)
-				{
-					framebuffer = framebufferElement.framebuffer;
-					break;
-				}
+				framebuffer = mSortedFramebufferVector[index].framebuffer;
 			}
 			ASSERT(nullptr != framebuffer, "Invalid framebuffer")
 		}
@@ -142,73 +160,69 @@ namespace Renderer
 		CompositorFramebufferIdToFramebufferSignatureId::const_iterator iterator = mCompositorFramebufferIdToFramebufferSignatureId.find(compositorFramebufferId);
 		if (mCompositorFramebufferIdToFramebufferSignatureId.cend() != iterator)
 		{
-			// TODO(co) Is there need for a more efficient search?
-			const FramebufferSignatureId framebufferSignatureId = iterator->second;
-			for (FramebufferElement& framebufferElement : mSortedFramebufferVector)
+			const uint32_t index = ::detail::getFramebufferElementIndexByFramebufferSignatureId(mSortedFramebufferVector, iterator->second);
+			if (isValid(index))
 			{
+				FramebufferElement& framebufferElement = mSortedFramebufferVector[index];
 				const FramebufferSignature& framebufferSignature = framebufferElement.framebufferSignature;
-				if (framebufferSignature.getFramebufferSignatureId() == framebufferSignatureId)
+				// Do we need to create the RHI framebuffer instance right now?
+				if (nullptr == framebufferElement.framebuffer)
 				{
-					// Do we need to create the RHI framebuffer instance right now?
-					if (nullptr == framebufferElement.framebuffer)
+					// Get the color texture instances
+					Rhi::TextureFormat::Enum colorTextureFormats[8] = { Rhi::TextureFormat::Enum::UNKNOWN, Rhi::TextureFormat::Enum::UNKNOWN, Rhi::TextureFormat::Enum::UNKNOWN, Rhi::TextureFormat::Enum::UNKNOWN, Rhi::TextureFormat::Enum::UNKNOWN, Rhi::TextureFormat::Enum::UNKNOWN, Rhi::TextureFormat::Enum::UNKNOWN, Rhi::TextureFormat::Enum::UNKNOWN };
+					const uint8_t numberOfColorAttachments = framebufferSignature.getNumberOfColorAttachments();
+					ASSERT(numberOfColorAttachments < 8, "Invalid number of color attachments")
+					Rhi::FramebufferAttachment colorFramebufferAttachments[8];
+					uint8_t usedNumberOfMultisamples = 0;
+					for (uint8_t i = 0; i < numberOfColorAttachments; ++i)
 					{
-						// Get the color texture instances
-						Rhi::TextureFormat::Enum colorTextureFormats[8] = { Rhi::TextureFormat::Enum::UNKNOWN, Rhi::TextureFormat::Enum::UNKNOWN, Rhi::TextureFormat::Enum::UNKNOWN, Rhi::TextureFormat::Enum::UNKNOWN, Rhi::TextureFormat::Enum::UNKNOWN, Rhi::TextureFormat::Enum::UNKNOWN, Rhi::TextureFormat::Enum::UNKNOWN, Rhi::TextureFormat::Enum::UNKNOWN };
-						const uint8_t numberOfColorAttachments = framebufferSignature.getNumberOfColorAttachments();
-						ASSERT(numberOfColorAttachments < 8, "Invalid number of color attachments")
-						Rhi::FramebufferAttachment colorFramebufferAttachments[8];
-						uint8_t usedNumberOfMultisamples = 0;
-						for (uint8_t i = 0; i < numberOfColorAttachments; ++i)
+						const FramebufferSignatureAttachment& framebufferSignatureAttachment = framebufferSignature.getColorFramebufferSignatureAttachment(i);
+						const AssetId colorTextureAssetId = framebufferSignatureAttachment.textureAssetId;
+						const RenderTargetTextureSignature* colorRenderTargetTextureSignature = nullptr;
+						Rhi::FramebufferAttachment& framebufferAttachment = colorFramebufferAttachments[i];
+						framebufferAttachment.texture = isValid(colorTextureAssetId) ? mRenderTargetTextureManager.getTextureByAssetId(colorTextureAssetId, renderTarget, numberOfMultisamples, resolutionScale, &colorRenderTargetTextureSignature) : nullptr;
+						ASSERT(nullptr != framebufferAttachment.texture, "Invalid framebuffer attachment texture")
+						framebufferAttachment.mipmapIndex = framebufferSignatureAttachment.mipmapIndex;
+						framebufferAttachment.layerIndex = framebufferSignatureAttachment.layerIndex;
+						ASSERT(nullptr != colorRenderTargetTextureSignature, "Invalid color render target texture signature")
+						if (0 == usedNumberOfMultisamples)
+						{
+							usedNumberOfMultisamples = ((colorRenderTargetTextureSignature->getFlags() & RenderTargetTextureSignature::Flag::ALLOW_MULTISAMPLE) != 0) ? numberOfMultisamples : 1u;
+						}
+						else
 						{
-							const FramebufferSignatureAttachment& framebufferSignatureAttachment = framebufferSignature.getColorFramebufferSignatureAttachment(i);
-							const AssetId colorTextureAssetId = framebufferSignatureAttachment.textureAssetId;
-							const RenderTargetTextureSignature* colorRenderTargetTextureSignature = nullptr;
-							Rhi::FramebufferAttachment& framebufferAttachment = colorFramebufferAttachments[i];
-							framebufferAttachment.texture = isValid(colorTextureAssetId) ? mRenderTargetTextureManager.getTextureByAssetId(colorTextureAssetId, renderTarget, numberOfMultisamples, resolutionScale, &colorRenderTargetTextureSignature) : nullptr;
-							ASSERT(nullptr != framebufferAttachment.texture, "Invalid framebuffer attachment texture")
-							framebufferAttachment.mipmapIndex = framebufferSignatureAttachment.mipmapIndex;
-							framebufferAttachment.layerIndex = framebufferSignatureAttachment.layerIndex;
-							ASSERT(nullptr != colorRenderTargetTextureSignature, "Invalid color render target texture signature")
-							if (0 == usedNumberOfMultisamples)
-							{
-								usedNumberOfMultisamples = ((colorRenderTargetTextureSignature->getFlags() & RenderTargetTextureSignature::Flag::ALLOW_MULTISAMPLE) != 0) ? numberOfMultisamples : 1u;
-							}
-							else
-							{
-								ASSERT(1 == usedNumberOfMultisamples || ((colorRenderTargetTextureSignature->getFlags() & RenderTargetTextureSignature::Flag::ALLOW_MULTISAMPLE) != 0), "Invalid number of multisamples")
-							}
-							colorTextureFormats[i] = colorRenderTargetTextureSignature->getTextureFormat();
+							ASSERT(1 == usedNumberOfMultisamples || ((colorRenderTargetTextureSignature->getFlags() & RenderTargetTextureSignature::Flag::ALLOW_MULTISAMPLE) != 0), "Invalid number of multisamples")
 						}
+						colorTextureFormats[i] = colorRenderTargetTextureSignature->getTextureFormat();
+					}
 
-						// Get the depth stencil texture instances
-						const FramebufferSignatureAttachment& depthStencilFramebufferSignatureAttachment = framebufferSignature.getDepthStencilFramebufferSignatureAttachment();
-						const RenderTargetTextureSignature* depthStencilRenderTargetTextureSignature = nullptr;
-						Rhi::FramebufferAttachment depthStencilFramebufferAttachment(isValid(depthStencilFramebufferSignatureAttachment.textureAssetId) ? mRenderTargetTextureManager.getTextureByAssetId(depthStencilFramebufferSignatureAttachment.textureAssetId, renderTarget, numberOfMultisamples, resolutionScale, &depthStencilRenderTargetTextureSignature) : nullptr, depthStencilFramebufferSignatureAttachment.mipmapIndex, depthStencilFramebufferSignatureAttachment.layerIndex);
-						if (nullptr != depthStencilRenderTargetTextureSignature)
+					// Get the depth stencil texture instances
+					const FramebufferSignatureAttachment& depthStencilFramebufferSignatureAttachment = framebufferSignature.getDepthStencilFramebufferSignatureAttachment();
+					const RenderTargetTextureSignature* depthStencilRenderTargetTextureSignature = nullptr;
+					Rhi::FramebufferAttachment depthStencilFramebufferAttachment(isValid(depthStencilFramebufferSignatureAttachment.textureAssetId) ? mRenderTargetTextureManager.getTextureByAssetId(depthStencilFramebufferSignatureAttachment.textureAssetId, renderTarget, numberOfMultisamples, resolutionScale, &depthStencilRenderTargetTextureSignature) : nullptr, depthStencilFramebufferSignatureAttachment.mipmapIndex, depthStencilFramebufferSignatureAttachment.layerIndex);
+					if (nullptr != depthStencilRenderTargetTextureSignature)
+					{
+						if (0 == usedNumberOfMultisamples)
+						{
+							usedNumberOfMultisamples = ((depthStencilRenderTargetTextureSignature->getFlags() & RenderTargetTextureSignature::Flag::ALLOW_MULTISAMPLE) != 0) ? numberOfMultisamples : 1u;
+						}
+						else
 						{
-							if (0 == usedNumberOfMultisamples)
-							{
-								usedNumberOfMultisamples = ((depthStencilRenderTargetTextureSignature->getFlags() & RenderTargetTextureSignature::Flag::ALLOW_MULTISAMPLE) != 0) ? numberOfMultisamples : 1u;
-							}
-							else
-							{
-								ASSERT(1 == usedNumberOfMultisamples || ((depthStencilRenderTargetTextureSignature->getFlags() & RenderTargetTextureSignature::Flag::ALLOW_MULTISAMPLE) != 0), "Invalid number of multisamples")
-							}
+							ASSERT(1 == usedNumberOfMultisamples || ((depthStencilRenderTargetTextureSignature->getFlags() & RenderTargetTextureSignature::Flag::ALLOW_MULTISAMPLE) != 0), "Invalid number of multisamples")
 						}
-						const Rhi::TextureFormat::Enum depthStencilTextureFormat = (nullptr != depthStencilRenderTargetTextureSignature) ? depthStencilRenderTargetTextureSignature->getTextureFormat() : Rhi::TextureFormat::Enum::UNKNOWN;
+					}
+					const Rhi::TextureFormat::Enum depthStencilTextureFormat = (nullptr != depthStencilRenderTargetTextureSignature) ? depthStencilRenderTargetTextureSignature->getTextureFormat() : Rhi::TextureFormat::Enum::UNKNOWN;
 
-						// Get or create the managed render pass
-						Rhi::IRenderPass* renderPass = mRenderPassManager.getOrCreateRenderPass(numberOfColorAttachments, colorTextureFormats, depthStencilTextureFormat, usedNumberOfMultisamples);
-						ASSERT(nullptr != renderPass, "Invalid render pass")
+					// Get or create the managed render pass
+					Rhi::IRenderPass* renderPass = mRenderPassManager.getOrCreateRenderPass(numberOfColorAttachments, colorTextureFormats, depthStencilTextureFormat, usedNumberOfMultisamples);
+					ASSERT(nullptr != renderPass, "Invalid render pass")
 
-						// Create the framebuffer object (FBO) instance
-						// -> The framebuffer automatically adds a reference to the provided textures
-						framebufferElement.framebuffer = mRenderTargetTextureManager.getRenderer().getRhi().createFramebuffer(*renderPass, colorFramebufferAttachments, ((nullptr != depthStencilFramebufferAttachment.texture) ? &depthStencilFramebufferAttachment : nullptr) RHI_RESOURCE_DEBUG_NAME("Framebuffer manager"));
-						framebufferElement.framebuffer->addReference();
-					}
-					framebuffer = framebufferElement.framebuffer;
-					break;
+					// Create the framebuffer object (FBO) instance
+					// -> The framebuffer automatically adds a reference to the provided textures
+					framebufferElement.framebuffer = mRenderTargetTextureManager.getRenderer().getRhi().createFramebuffer(*renderPass, colorFramebufferAttachments, ((nullptr != depthStencilFramebufferAttachment.texture) ? &depthStencilFramebufferAttachment : nullptr) RHI_RESOURCE_DEBUG_NAME("Framebuffer manager"));
+					framebufferElement.framebuffer->addReference();
 				}
+				framebuffer = framebufferElement.framebuffer;
 			}
 			ASSERT(nullptr != framebuffer, "Invalid framebuffer")
 		}
@@ -126,6 +126,7 @@ namespace Renderer
 		void clear();
 		void clearRhiResources();
 		void addFramebuffer(CompositorFramebufferId compositorFramebufferId, const FramebufferSignature& framebufferSignature);
+		[[nodiscard]] const FramebufferSignature* getFramebufferSignatureByCompositorFramebufferId(CompositorFramebufferId compositorFramebufferId) const;
 		[[nodiscard]] Rhi::IFramebuffer* getFramebufferByCompositorFramebufferId(CompositorFramebufferId compositorFramebufferId) const;
 		[[nodiscard]] Rhi::IFramebuffer* getFramebufferByCompositorFramebufferId(CompositorFramebufferId compositorFramebufferId, const Rhi::IRenderTarget& mainRenderTarget, uint8_t numberOfMultisamples, float resolutionScale);
 		void releaseFramebufferBySignature(const FramebufferSignature& framebufferSignature);
@@ -24,6 +24,7 @@
 #include "Renderer/Public/Core/Renderer/RenderTargetTextureManager.h"
 #include "Renderer/Public/Resource/Texture/TextureResourceManager.h"
 #include "Renderer/Public/Resource/Texture/TextureResource.h"
+#include "Renderer/Public/Core/Math/Math.h"
 #include "Renderer/Public/IRenderer.h"
 
 #include <algorithm>
@@ -46,6 +47,29 @@ namespace
 			return (left.renderTargetTextureSignature.getRenderTargetTextureSignatureId() < right.renderTargetTextureSignature.getRenderTargetTextureSignatureId());
 		}
 
+		[[nodiscard]] uint32_t calculateRenderTargetTextureDescriptionHash(uint32_t width, uint32_t height, Rhi::TextureFormat::Enum textureFormat, uint32_t textureFlags, uint8_t numberOfMultisamples)
+		{
+			uint32_t hash = Renderer::Math::calculateFNV1a32(reinterpret_cast<const uint8_t*>(&width), sizeof(uint32_t));
+			hash = Renderer::Math::calculateFNV1a32(reinterpret_cast<const uint8_t*>(&height), sizeof(uint32_t), hash);
+			hash = Renderer::Math::calculateFNV1a32(reinterpret_cast<const uint8_t*>(&textureFormat), sizeof(Rhi::TextureFormat::Enum), hash);
+			hash = Renderer::Math::calculateFNV1a32(reinterpret_cast<const uint8_t*>(&textureFlags), sizeof(uint32_t), hash);
+			return Renderer::Math::calculateFNV1a32(&numberOfMultisamples, sizeof(uint8_t), hash);
+		}
+
+		[[nodiscard]] uint64_t getRenderTargetTextureNumberOfBytes(uint32_t width, uint32_t height, Rhi::TextureFormat::Enum textureFormat, bool generateMipmaps, uint8_t numberOfMultisamples)
+		{
+			// Only an estimate, the RHI implementation and the GPU driver might add padding and alignment
+			uint64_t numberOfBytes = 0;
+			const uint32_t numberOfMipmaps = generateMipmaps ? Rhi::ITexture::getNumberOfMipmaps(width, height) : 1u;
+			for (uint32_t mipmap = 0; mipmap < numberOfMipmaps; ++mipmap)
+			{
+				numberOfBytes += Rhi::TextureFormat::getNumberOfBytesPerSlice(textureFormat, width, height);
+				width = std::max(width >> 1, 1u);
+				height = std::max(height >> 1, 1u);
+			}
+			return numberOfBytes * numberOfMultisamples;
+		}
+
 
 //[-------------------------------------------------------]
 //[ Anonymous detail namespace                            ]
@@ -92,6 +116,17 @@ namespace Renderer
 				renderTargetTextureElement.texture = nullptr;
 			}
 		}
+
+		// Release the RHI texture references of the aliasable textures, the lifetimes might change until the render target textures are requested the next time
+		for (AliasableTexture& aliasableTexture : mAliasableTextures)
+		{
+			aliasableTexture.texture->releaseReference();
+		}
+		mAliasableTextures.clear();
+		mTextureDescriptionHashToAliasableTextureIndex.clear();
+		mNumberOfAllocatedBytes = 0;
+		mNumberOfUnaliasedBytes = 0;
+		mNumberOfAliasedRenderTargetTextures = 0;
 	}
 
 	void RenderTargetTextureManager::addRenderTargetTexture(AssetId assetId, const RenderTargetTextureSignature& renderTargetTextureSignature)
@@ -124,6 +159,44 @@ namespace Renderer
 		*/
 	}
 
+	void RenderTargetTextureManager::updateRenderTargetTextureLifetime(AssetId assetId, const CompositorWorkspaceInstance& compositorWorkspaceInstance, uint32_t passIndex)
+	{
+		AssetIdToIndex::const_iterator iterator = mAssetIdToIndex.find(assetId);
+		if (mAssetIdToIndex.cend() != iterator)
+		{
+			RenderTargetTextureElement& renderTargetTextureElement = mSortedRenderTargetTextureVector[iterator->second];
+			if (isInvalid(renderTargetTextureElement.firstPassIndex))
+			{
+				renderTargetTextureElement.firstPassIndex = passIndex;
+				renderTargetTextureElement.lastPassIndex = passIndex;
+				renderTargetTextureElement.lifetimeCompositorWorkspaceInstance = &compositorWorkspaceInstance;
+			}
+			else if (renderTargetTextureElement.lifetimeCompositorWorkspaceInstance != &compositorWorkspaceInstance)
+			{
+				// Referenced by multiple compositor workspace instances, the pass indices can't be compared so the render target texture must not be aliased
+				renderTargetTextureElement.lifetimeCompositorWorkspaceInstance = nullptr;
+			}
+			else
+			{
+				renderTargetTextureElement.firstPassIndex = std::min(renderTargetTextureElement.firstPassIndex, passIndex);
+				renderTargetTextureElement.lastPassIndex = std::max(renderTargetTextureElement.lastPassIndex, passIndex);
+			}
+		}
+	}
+
+	void RenderTargetTextureManager::resetRenderTargetTextureLifetimes(const CompositorWorkspaceInstance& compositorWorkspaceInstance)
+	{
+		for (RenderTargetTextureElement& renderTargetTextureElement : mSortedRenderTargetTextureVector)
+		{
+			if (renderTargetTextureElement.lifetimeCompositorWorkspaceInstance == &compositorWorkspaceInstance)
+			{
+				setInvalid(renderTargetTextureElement.firstPassIndex);
+				setInvalid(renderTargetTextureElement.lastPassIndex);
+				renderTargetTextureElement.lifetimeCompositorWorkspaceInstance = nullptr;
+			}
+		}
+	}
+
 	Rhi::ITexture* RenderTargetTextureManager::getTextureByAssetId(AssetId assetId, const Rhi::IRenderTarget& renderTarget, uint8_t numberOfMultisamples, float resolutionScale, const RenderTargetTextureSignature** outRenderTargetTextureSignature)
 	{
 		Rhi::ITexture* texture = nullptr;
@@ -202,12 +275,62 @@ namespace Renderer
 						textureFlags |= Rhi::TextureFlag::RENDER_TARGET;	// Needed when generating mipmaps
 					}
 
+					// Get the number of multisamples
+					const Rhi::TextureFormat::Enum textureFormat = renderTargetTextureSignature.getTextureFormat();
+					const uint8_t usedNumberOfMultisamples = ((renderTargetTextureSignature.getFlags() & RenderTargetTextureSignature::Flag::ALLOW_MULTISAMPLE) != 0) ? numberOfMultisamples : 1u;
+					const uint64_t numberOfBytes = ::detail::getRenderTargetTextureNumberOfBytes(width, height, textureFormat, (textureFlags & Rhi::TextureFlag::GENERATE_MIPMAPS) != 0, usedNumberOfMultisamples);
+					mNumberOfUnaliasedBytes += numberOfBytes;
+
+					// Try to share the RHI texture of a compatible render target texture of the same compositor workspace instance whose lifetime doesn't overlap with ours
+					const bool aliasable = ((renderTargetTextureSignature.getFlags() & RenderTargetTextureSignature::Flag::ALLOW_ALIASING) != 0 && nullptr != renderTargetTextureElement.lifetimeCompositorWorkspaceInstance);
+					const uint32_t textureDescriptionHash = aliasable ? ::detail::calculateRenderTargetTextureDescriptionHash(width, height, textureFormat, textureFlags, usedNumberOfMultisamples) : 0;
+					if (aliasable)
+					{
+						typedef std::pair<TextureDescriptionHashToAliasableTextureIndex::const_iterator, TextureDescriptionHashToAliasableTextureIndex::const_iterator> Range;
+						const Range range = mTextureDescriptionHashToAliasableTextureIndex.equal_range(textureDescriptionHash);
+						for (TextureDescriptionHashToAliasableTextureIndex::const_iterator aliasableTextureIterator = range.first; aliasableTextureIterator != range.second; ++aliasableTextureIterator)
+						{
+							AliasableTexture& aliasableTexture = mAliasableTextures[aliasableTextureIterator->second];
+							if (aliasableTexture.compositorWorkspaceInstance == renderTargetTextureElement.lifetimeCompositorWorkspaceInstance && aliasableTexture.width == width && aliasableTexture.height == height && aliasableTexture.textureFormat == textureFormat && aliasableTexture.textureFlags == textureFlags && aliasableTexture.numberOfMultisamples == usedNumberOfMultisamples)
+							{
+								bool overlapping = false;
+								for (const AliasableTexture::Lifetime& lifetime : aliasableTexture.lifetimes)
+								{
+									if (renderTargetTextureElement.firstPassIndex <= lifetime.second && lifetime.first <= renderTargetTextureElement.lastPassIndex)
+									{
+										overlapping = true;
+										break;
+									}
+								}
+								if (!overlapping)
+								{
+									aliasableTexture.lifetimes.emplace_back(renderTargetTextureElement.firstPassIndex, renderTargetTextureElement.lastPassIndex);
+									renderTargetTextureElement.texture = aliasableTexture.texture;
+									++mNumberOfAliasedRenderTargetTextures;
+									break;
+								}
+							}
+						}
+					}
+
 					// Create the texture instance, but without providing texture data (we use the texture as render target)
 					// -> Use the "Rhi::TextureFlag::RENDER_TARGET"-flag to mark this texture as a render target
 					// -> Required for Vulkan, Direct3D 9, Direct3D 10, Direct3D 11 and Direct3D 12
 					// -> Not required for OpenGL and OpenGL ES 3
 					// -> The optimized texture clear value is a Direct3D 12 related option
-					renderTargetTextureElement.texture = mRenderer.getTextureManager().createTexture2D(width, height, renderTargetTextureSignature.getTextureFormat(), nullptr, textureFlags, Rhi::TextureUsage::DEFAULT, (((renderTargetTextureSignature.getFlags() & RenderTargetTextureSignature::Flag::ALLOW_MULTISAMPLE) != 0) ? numberOfMultisamples : 1u), nullptr RHI_RESOURCE_DEBUG_NAME("Render target texture manager"));
+					if (nullptr == renderTargetTextureElement.texture)
+					{
+						renderTargetTextureElement.texture = mRenderer.getTextureManager().createTexture2D(width, height, textureFormat, nullptr, textureFlags, Rhi::TextureUsage::DEFAULT, usedNumberOfMultisamples, nullptr RHI_RESOURCE_DEBUG_NAME("Render target texture manager"));
+						mNumberOfAllocatedBytes += numberOfBytes;
+
+						// Offer the new RHI texture to other render target textures with non-overlapping lifetimes
+						if (aliasable)
+						{
+							renderTargetTextureElement.texture->addReference();
+							mTextureDescriptionHashToAliasableTextureIndex.emplace(textureDescriptionHash, static_cast<uint32_t>(mAliasableTextures.size()));
+							mAliasableTextures.push_back({ renderTargetTextureElement.texture, renderTargetTextureElement.lifetimeCompositorWorkspaceInstance, width, height, textureFormat, textureFlags, usedNumberOfMultisamples, { AliasableTexture::Lifetime(renderTargetTextureElement.firstPassIndex, renderTargetTextureElement.lastPassIndex) } });
+						}
+					}
 					renderTargetTextureElement.texture->addReference();
 
 					{ // Tell the texture resource manager about our render target texture so it can be referenced inside e.g. compositor nodes
@@ -47,6 +47,7 @@ PRAGMA_WARNING_POP
 namespace Renderer
 {
 	class IRenderer;
+	class CompositorWorkspaceInstance;
 }
 
 
@@ -80,11 +81,17 @@ namespace Renderer
 			RenderTargetTextureSignature renderTargetTextureSignature;
 			Rhi::ITexture*				 texture;				///< Can be a null pointer, no "Rhi::ITexturePtr" to not have overhead when internally reallocating
 			uint32_t					 numberOfReferences;	///< Number of texture references (don't misuse the RHI texture reference counter for this)
+			uint32_t					 firstPassIndex;		///< Index of the first compositor workspace pass referencing this render target texture, invalid if unknown
+			uint32_t					 lastPassIndex;			///< Index of the last compositor workspace pass referencing this render target texture, invalid if unknown
+			const CompositorWorkspaceInstance* lifetimeCompositorWorkspaceInstance;	///< Compositor workspace instance the pass indices belong to, null pointer if unknown or if referenced by multiple compositor workspace instances (never aliased in this case), don't destroy the instance
 
 			inline RenderTargetTextureElement() :
 				assetId(getInvalid<AssetId>()),
 				texture(nullptr),
-				numberOfReferences(0)
+				numberOfReferences(0),
+				firstPassIndex(getInvalid<uint32_t>()),
+				lastPassIndex(getInvalid<uint32_t>()),
+				lifetimeCompositorWorkspaceInstance(nullptr)
 			{
 				// Nothing here
 			}
@@ -93,7 +100,10 @@ namespace Renderer
 				assetId(getInvalid<AssetId>()),
 				renderTargetTextureSignature(_renderTargetTextureSignature),
 				texture(nullptr),
-				numberOfReferences(0)
+				numberOfReferences(0),
+				firstPassIndex(getInvalid<uint32_t>()),
+				lastPassIndex(getInvalid<uint32_t>()),
+				lifetimeCompositorWorkspaceInstance(nullptr)
 			{
 				// Nothing here
 			}
@@ -102,7 +112,10 @@ namespace Renderer
 				assetId(_assetId),
 				renderTargetTextureSignature(_renderTargetTextureSignature),
 				texture(nullptr),
-				numberOfReferences(0)
+				numberOfReferences(0),
+				firstPassIndex(getInvalid<uint32_t>()),
+				lastPassIndex(getInvalid<uint32_t>()),
+				lifetimeCompositorWorkspaceInstance(nullptr)
 			{
 				// Nothing here
 			}
@@ -111,7 +124,10 @@ namespace Renderer
 				assetId(_assetId),
 				renderTargetTextureSignature(_renderTargetTextureSignature),
 				texture(&_texture),
-				numberOfReferences(0)
+				numberOfReferences(0),
+				firstPassIndex(getInvalid<uint32_t>()),
+				lastPassIndex(getInvalid<uint32_t>()),
+				lifetimeCompositorWorkspaceInstance(nullptr)
 			{
 				// Nothing here
 			}
@@ -123,7 +139,10 @@ namespace Renderer
 	//[-------------------------------------------------------]
 	public:
 		inline explicit RenderTargetTextureManager(IRenderer& renderer) :
-			mRenderer(renderer)
+			mRenderer(renderer),
+			mNumberOfAllocatedBytes(0),
+			mNumberOfUnaliasedBytes(0),
+			mNumberOfAliasedRenderTargetTextures(0)
 		{
 			// Nothing here
 		}
@@ -141,9 +160,66 @@ namespace Renderer
 			return mRenderer;
 		}
 
+		/**
+		*  @brief
+		*    Return the number of bytes of all currently allocated RHI render target textures
+		*
+		*  @return
+		*    The number of allocated bytes, aliased render target textures share their memory
+		*/
+		[[nodiscard]] inline uint64_t getNumberOfAllocatedBytes() const
+		{
+			return mNumberOfAllocatedBytes;
+		}
+
+		/**
+		*  @brief
+		*    Return the number of bytes all currently used render target textures would need without aliasing
+		*
+		*  @return
+		*    The number of bytes without aliasing
+		*/
+		[[nodiscard]] inline uint64_t getNumberOfUnaliasedBytes() const
+		{
+			return mNumberOfUnaliasedBytes;
+		}
+
+		[[nodiscard]] inline uint32_t getNumberOfAliasedRenderTargetTextures() const
+		{
+			return mNumberOfAliasedRenderTargetTextures;
+		}
+
 		void clear();
 		void clearRhiResources();
 		void addRenderTargetTexture(AssetId assetId, const RenderTargetTextureSignature& renderTargetTextureSignature);
+
+		/**
+		*  @brief
+		*    Extend the lifetime of a render target texture by a compositor workspace pass referencing it
+		*
+		*  @param[in] assetId
+		*    Asset ID of the render target texture, unknown asset IDs (e.g. regular textures) are silently ignored
+		*  @param[in] compositorWorkspaceInstance
+		*    Compositor workspace instance the pass belongs to, pass indices of different compositor workspace instances are never compared
+		*  @param[in] passIndex
+		*    Index of the compositor workspace pass referencing the render target texture, the pass index is running over all compositor node instances of the compositor workspace instance
+		*
+		*  @note
+		*    - Only render target textures with the "Renderer::RenderTargetTextureSignature::Flag::ALLOW_ALIASING" flag and a known lifetime are aliased
+		*    - Render target textures referenced by multiple compositor workspace instances are never aliased since the manager is shared by all of them
+		*    - Lifetimes only have an effect on RHI textures created afterwards, already created RHI textures are kept until "Renderer::RenderTargetTextureManager::clearRhiResources()"
+		*/
+		void updateRenderTargetTextureLifetime(AssetId assetId, const CompositorWorkspaceInstance& compositorWorkspaceInstance, uint32_t passIndex);
+
+		/**
+		*  @brief
+		*    Forget about the render target texture lifetimes gathered for a compositor workspace instance
+		*
+		*  @param[in] compositorWorkspaceInstance
+		*    Compositor workspace instance to forget the lifetimes of, must be called before the compositor workspace instance gathers its lifetimes again
+		*/
+		void resetRenderTargetTextureLifetimes(const CompositorWorkspaceInstance& compositorWorkspaceInstance);
+
 		[[nodiscard]] Rhi::ITexture* getTextureByAssetId(AssetId assetId, const Rhi::IRenderTarget& renderTarget, uint8_t numberOfMultisamples, float resolutionScale, const RenderTargetTextureSignature** outRenderTargetTextureSignature);
 		void releaseRenderTargetTextureBySignature(const RenderTargetTextureSignature& renderTargetTextureSignature);
 
@@ -156,15 +232,41 @@ namespace Renderer
 		typedef std::unordered_map<uint32_t, RenderTargetTextureSignatureId> AssetIdToRenderTargetTextureSignatureId;	///< Key = "Renderer::AssetId"
 		typedef std::unordered_map<uint32_t, uint32_t>						 AssetIdToIndex;							///< Key = "Renderer::AssetId"
 
+		/**
+		*  @brief
+		*    RHI render target texture which can be shared by render target textures with non-overlapping lifetimes
+		*/
+		struct AliasableTexture final
+		{
+			typedef std::pair<uint32_t, uint32_t> Lifetime;	///< First and last compositor workspace pass index, both inclusive
+			typedef std::vector<Lifetime>		  Lifetimes;
+
+			Rhi::ITexture*			 texture;	///< RHI texture, we own a reference, always valid
+			const CompositorWorkspaceInstance* compositorWorkspaceInstance;	///< Compositor workspace instance the lifetimes belong to, always valid, don't destroy the instance
+			uint32_t				 width;
+			uint32_t				 height;
+			Rhi::TextureFormat::Enum textureFormat;
+			uint32_t				 textureFlags;	///< Texture flags, see "Rhi::TextureFlag"
+			uint8_t					 numberOfMultisamples;
+			Lifetimes				 lifetimes;		///< Lifetimes of the render target textures sharing this RHI texture, never overlapping
+		};
+		typedef std::vector<AliasableTexture>					AliasableTextures;
+		typedef std::unordered_multimap<uint32_t, uint32_t>		TextureDescriptionHashToAliasableTextureIndex;	///< Key = FNV1a hash of the texture description, value = index inside "mAliasableTextures"
+
 
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
-		IRenderer&								mRenderer;
-		SortedRenderTargetTextureVector			mSortedRenderTargetTextureVector;
-		AssetIdToRenderTargetTextureSignatureId	mAssetIdToRenderTargetTextureSignatureId;
-		AssetIdToIndex							mAssetIdToIndex;
+		IRenderer&										mRenderer;
+		SortedRenderTargetTextureVector					mSortedRenderTargetTextureVector;
+		AssetIdToRenderTargetTextureSignatureId			mAssetIdToRenderTargetTextureSignatureId;
+		AssetIdToIndex									mAssetIdToIndex;
+		AliasableTextures								mAliasableTextures;
+		TextureDescriptionHashToAliasableTextureIndex	mTextureDescriptionHashToAliasableTextureIndex;
+		uint64_t										mNumberOfAllocatedBytes;				///< Number of bytes of all currently allocated RHI render target textures
+		uint64_t										mNumberOfUnaliasedBytes;				///< Number of bytes all currently used render target textures would need without aliasing
+		uint32_t										mNumberOfAliasedRenderTargetTextures;	///< Number of render target textures which are sharing the RHI texture of another render target texture
 
 
 	};
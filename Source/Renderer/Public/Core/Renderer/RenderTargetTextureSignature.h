@@ -68,7 +68,8 @@ namespace Renderer
 				RENDER_TARGET          = 1u << 2u,	///< This texture can be used as framebuffer object (FBO) attachment render target
 				ALLOW_MULTISAMPLE      = 1u << 3u,	///< Allow multisample
 				GENERATE_MIPMAPS       = 1u << 4u,	///< Generate mipmaps
-				ALLOW_RESOLUTION_SCALE = 1u << 5u	///< Allow resolution scale
+				ALLOW_RESOLUTION_SCALE = 1u << 5u,	///< Allow resolution scale
+				ALLOW_ALIASING         = 1u << 6u	///< Allow the RHI texture to be shared with other compatible render target textures whose compositor pass lifetimes don't overlap, only use this for transient render target textures which are exclusively referenced by compositor passes and whose content doesn't need to survive outside of their lifetime (e.g. into the next frame)
 			};
 		};
 
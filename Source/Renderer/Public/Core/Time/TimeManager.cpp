@@ -38,7 +38,7 @@ namespace Renderer
 	{
 		// Stop the stopwatch and get the past milliseconds
 		mStopwatch.stop();
-		mPastSecondsSinceLastFrame = mStopwatch.getSeconds();
+		mPastSecondsSinceLastFrame = (mFixedPastSecondsSinceLastFrame > 0.0f) ? mFixedPastSecondsSinceLastFrame : mStopwatch.getSeconds();
 		if (mPastSecondsSinceLastFrame <= 0.0f)
 		{
 			// Don't allow zero or time advancing enforcement asserts will get more complicated
@@ -61,6 +61,7 @@ namespace Renderer
 	public:
 		inline TimeManager() :
 			mPastSecondsSinceLastFrame(std::numeric_limits<float>::min()),	// Don't initialize with zero or time advancing enforcement asserts will get more complicated
+			mFixedPastSecondsSinceLastFrame(0.0f),
 			mGlobalTimeInSeconds(0.0f),
 			mNumberOfRenderedFrames(0)
 		{
@@ -77,6 +78,21 @@ namespace Renderer
 			return mPastSecondsSinceLastFrame;
 		}
 
+		/**
+		*  @brief
+		*    Set a fixed time step
+		*
+		*  @param[in] fixedPastSecondsSinceLastFrame
+		*    Past seconds each frame advances the time, zero to advance the time by the measured wall-clock time
+		*
+		*  @note
+		*    - Use a fixed time step for deterministic and reproducible results, e.g. for benchmarks
+		*/
+		inline void setFixedPastSecondsSinceLastFrame(float fixedPastSecondsSinceLastFrame)
+		{
+			mFixedPastSecondsSinceLastFrame = fixedPastSecondsSinceLastFrame;
+		}
+
 		[[nodiscard]] inline float getGlobalTimeInSeconds() const
 		{
 			return mGlobalTimeInSeconds;
@@ -111,6 +127,7 @@ namespace Renderer
 	private:
 		Stopwatch mStopwatch;
 		float	  mPastSecondsSinceLastFrame;
+		float	  mFixedPastSecondsSinceLastFrame;	///< Zero if the measured wall-clock time is used
 		float	  mGlobalTimeInSeconds;
 		uint64_t  mNumberOfRenderedFrames;
 
@@ -0,0 +1,520 @@
+/*********************************************************\
+ * Copyright (c) 2012-2020 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+#ifndef RENDERER_PROFILER
+	#error "Do only include this header if the RENDERER_PROFILER preprocessor definition is set"
+#endif
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Renderer/Public/Core/IProfiler.h"
+#include "Renderer/Public/Core/GetInvalid.h"
+#include "Renderer/Public/Core/File/IFile.h"
+#include "Renderer/Public/Core/File/IFileManager.h"
+
+#include <Rhi/Public/Rhi.h>
+
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4365)	// warning C4365: 'argument': conversion from 'long' to 'unsigned int', signed/unsigned mismatch
+	PRAGMA_WARNING_DISABLE_MSVC(4571)	// warning C4571: Informational: catch(...) semantics changed since Visual C++ 7.1; structured exceptions (SEH) are no longer caught
+	PRAGMA_WARNING_DISABLE_MSVC(4625)	// warning C4625: 'std::codecvt_base': copy constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4626)	// warning C4626: 'std::codecvt_base': assignment operator was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4774)	// warning C4774: 'sprintf_s' : format string expected in argument 3 is not a string literal
+	#include <chrono>
+	#include <cstdio>
+	#include <cstring>
+	#include <algorithm>
+	#include <string>
+	#include <vector>
+PRAGMA_WARNING_POP
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Classes                                               ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Timestamp profiler implementation class one can use, CPU samples are measured by using a high-resolution clock while GPU samples are measured by using RHI timestamp query pools
+	*
+	*  @remarks
+	*    The profiler keeps a ring of frames of hierarchical CPU and GPU samples. GPU timestamps are read back asynchronously without
+	*    stalling, a frame becomes resolved as soon as all of its GPU timestamps are available. Resolved frames can be visualized
+	*    using "Renderer::DebugGuiHelper::drawTimestampProfiler()" or be exported as Chrome trace event JSON file which can be opened
+	*    with "chrome://tracing" or https://ui.perfetto.dev for offline analysis.
+	*
+	*  @note
+	*    - Designed to be instanced and used inside a single C++ file
+	*    - Not thread-safe, all samples must be begun and ended by the thread which is filling the command buffers
+	*    - "Renderer::TimestampProfiler::nextFrame()" must be called once per frame after all command buffers of the frame have been submitted
+	*    - "Renderer::IProfiler::beginCommandBufferFrame()" must be called once per frame before any GPU sample and outside of render passes, it records the timestamp query pool reset of the frame
+	*    - Works headless: In case the RHI implementation doesn't support timestamp query pools (e.g. the null RHI) only CPU samples are gathered
+	*    - GPU timestamps are converted from RHI ticks into nanoseconds by using "Rhi::Capabilities::timestampPeriod"
+	*    - The GPU sample track is aligned to the CPU frame begin, there's no calibration between the CPU and the GPU clock
+	*/
+	class TimestampProfiler final : public IProfiler
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Public definitions                                    ]
+	//[-------------------------------------------------------]
+	public:
+		static constexpr uint32_t MAXIMUM_SAMPLE_NAME_LENGTH = 64;	///< Including the terminating zero, longer sample names are truncated
+		struct Sample final
+		{
+			char	 name[MAXIMUM_SAMPLE_NAME_LENGTH];	///< Sample name, always finished by a terminating zero
+			uint32_t parentIndex;						///< Index of the parent sample inside the same frame, "Renderer::getInvalid<uint32_t>()" for root samples
+			uint32_t depth;								///< Sample hierarchy depth, 0 for root samples
+			uint64_t beginNanoseconds;					///< Sample begin time in nanoseconds, for CPU samples relative to the profiler creation
+			uint64_t endNanoseconds;					///< Sample end time in nanoseconds, for CPU samples relative to the profiler creation
+		};
+		typedef std::vector<Sample> Samples;
+		struct Frame final
+		{
+			uint64_t		   frameNumber				   = 0;			///< Frame number, starting with 0
+			uint64_t		   cpuBeginNanoseconds		   = 0;			///< CPU frame begin time in nanoseconds relative to the profiler creation
+			uint64_t		   cpuEndNanoseconds		   = 0;			///< CPU frame end time in nanoseconds relative to the profiler creation
+			Samples			   cpuSamples;								///< CPU samples in begin order
+			Samples			   gpuSamples;								///< GPU samples in begin order, timestamps are only valid if the frame is resolved
+			bool			   resolved					   = false;		///< "true" if the frame is complete and all GPU timestamps are available
+			uint32_t		   numberOfDroppedGpuSamples   = 0;			///< Number of GPU samples which couldn't be recorded due to the per frame GPU sample limit or a missing "Renderer::IProfiler::beginCommandBufferFrame()" call
+			Rhi::IQueryPoolPtr timestampQueryPoolPtr;					///< Timestamp query pool with two queries per GPU sample, can be a null pointer
+			bool			   timestampQueryPoolReset	   = false;		///< "true" if the reset of the timestamp query pool was already recorded into a command buffer during this frame by "Renderer::IProfiler::beginCommandBufferFrame()"
+		};
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Constructor
+		*
+		*  @param[in] rhi
+		*    RHI instance to use, must stay valid as long as the timestamp profiler instance exists
+		*  @param[in] numberOfFrames
+		*    Number of frames inside the frame ring, must be at least two since GPU timestamps are read back with a latency of at least one frame
+		*  @param[in] maximumNumberOfGpuSamplesPerFrame
+		*    Maximum number of GPU samples per frame, additional GPU samples are dropped
+		*/
+		inline explicit TimestampProfiler(Rhi::IRhi& rhi, uint32_t numberOfFrames = 8, uint32_t maximumNumberOfGpuSamplesPerFrame = 256) :
+			mRhi(rhi),
+			mMaximumNumberOfGpuSamplesPerFrame(maximumNumberOfGpuSamplesPerFrame),
+			mTimestampPeriod(static_cast<double>(rhi.getCapabilities().timestampPeriod)),
+			mCreationTime(std::chrono::steady_clock::now()),
+			mFrames(numberOfFrames),
+			mCurrentFrameIndex(0),
+			mNumberOfFrames(0)
+		{
+			ASSERT(numberOfFrames >= 2, "The timestamp profiler needs at least two frames inside the frame ring")
+
+			// Create one timestamp query pool per frame, not supported by all RHI implementations
+			if (mTimestampPeriod > 0.0)
+			{
+				for (Frame& frame : mFrames)
+				{
+					frame.timestampQueryPoolPtr = mRhi.createQueryPool(Rhi::QueryType::TIMESTAMP, mMaximumNumberOfGpuSamplesPerFrame * 2 RHI_RESOURCE_DEBUG_NAME("Timestamp profiler"));
+				}
+			}
+			mTimestamps.resize(static_cast<size_t>(mMaximumNumberOfGpuSamplesPerFrame) * 2);
+
+			// Begin the first frame
+			mFrames[0].cpuBeginNanoseconds = getCpuNanoseconds();
+		}
+
+		inline virtual ~TimestampProfiler() override
+		{
+			ASSERT(mCpuSampleStack.empty() && mGpuSampleStack.empty(), "Profiler sampling leak detected, not all begun samples were ended")
+		}
+
+		/**
+		*  @brief
+		*    Finish the current frame and begin the next one
+		*
+		*  @note
+		*    - Must be called once per frame after all command buffers of the frame have been submitted and outside of any sample
+		*    - Polls the GPU timestamps of the previous frames without waiting for them
+		*/
+		inline void nextFrame()
+		{
+			ASSERT(mCpuSampleStack.empty() && mGpuSampleStack.empty(), "Timestamp profiler frame change is not allowed while there are begun samples")
+			const uint64_t cpuNanoseconds = getCpuNanoseconds();
+			mFrames[mCurrentFrameIndex].cpuEndNanoseconds = cpuNanoseconds;
+
+			// Switch to the next frame inside the frame ring
+			mCurrentFrameIndex = (mCurrentFrameIndex + 1) % static_cast<uint32_t>(mFrames.size());
+			++mNumberOfFrames;
+
+			// Poll the GPU timestamps of the finished frames which aren't resolved, yet, this is the last chance for the frame which is recycled
+			for (Frame& frame : mFrames)
+			{
+				if (!frame.resolved && frame.cpuEndNanoseconds > 0)
+				{
+					resolveFrame(frame);
+				}
+			}
+
+			// Recycle the frame, unresolved GPU samples are lost
+			Frame& frame = mFrames[mCurrentFrameIndex];
+			frame.frameNumber				= mNumberOfFrames;
+			frame.cpuBeginNanoseconds		= cpuNanoseconds;
+			frame.cpuEndNanoseconds			= 0;
+			frame.cpuSamples.clear();
+			frame.gpuSamples.clear();
+			frame.resolved					= false;
+			frame.numberOfDroppedGpuSamples = 0;
+			frame.timestampQueryPoolReset	= false;
+		}
+
+		/**
+		*  @brief
+		*    Return the number of the current frame
+		*
+		*  @return
+		*    The number of the current frame, starting with 0 and incremented by each "Renderer::TimestampProfiler::nextFrame()" call
+		*/
+		[[nodiscard]] inline uint64_t getCurrentFrameNumber() const
+		{
+			return mNumberOfFrames;
+		}
+
+		/**
+		*  @brief
+		*    Return whether or not GPU samples are supported by the used RHI implementation
+		*
+		*  @return
+		*    "true" if GPU samples are supported, else "false" (only CPU samples are gathered)
+		*/
+		[[nodiscard]] inline bool isGpuSamplingSupported() const
+		{
+			return (nullptr != mFrames[0].timestampQueryPoolPtr);
+		}
+
+		/**
+		*  @brief
+		*    Return the frame ring
+		*
+		*  @return
+		*    The frame ring, only resolved frames contain complete data
+		*/
+		[[nodiscard]] inline const std::vector<Frame>& getFrames() const
+		{
+			return mFrames;
+		}
+
+		/**
+		*  @brief
+		*    Return the most recent resolved frame
+		*
+		*  @return
+		*    The most recent resolved frame, can be a null pointer, don't destroy the instance
+		*/
+		[[nodiscard]] inline const Frame* getLastResolvedFrame() const
+		{
+			const Frame* lastResolvedFrame = nullptr;
+			for (const Frame& frame : mFrames)
+			{
+				if (frame.resolved && (nullptr == lastResolvedFrame || frame.frameNumber > lastResolvedFrame->frameNumber))
+				{
+					lastResolvedFrame = &frame;
+				}
+			}
+			return lastResolvedFrame;
+		}
+
+		/**
+		*  @brief
+		*    Export all resolved frames as Chrome trace event JSON file
+		*
+		*  @param[in] fileManager
+		*    File manager to use
+		*  @param[in] virtualFilename
+		*    UTF-8 virtual filename of the JSON file to write, e.g. "LocalData/Profiler/Trace.json"
+		*
+		*  @return
+		*    "true" if all went fine, else "false"
+		*
+		*  @note
+		*    - CPU samples are written as thread 0, GPU samples as thread 1
+		*/
+		[[nodiscard]] inline bool exportChromeTrace(const IFileManager& fileManager, VirtualFilename virtualFilename) const
+		{
+			// Gather the resolved frames ordered by frame number
+			std::vector<const Frame*> frames;
+			frames.reserve(mFrames.size());
+			for (uint32_t i = 1; i <= mFrames.size(); ++i)
+			{
+				const Frame& frame = mFrames[(mCurrentFrameIndex + i) % mFrames.size()];
+				if (frame.resolved)
+				{
+					frames.push_back(&frame);
+				}
+			}
+
+			// Build the JSON text
+			std::string json = "{\"traceEvents\":[\n"
+							   "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":0,\"args\":{\"name\":\"CPU\"}},\n"
+							   "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":1,\"args\":{\"name\":\"GPU\"}}";
+			for (const Frame* frame : frames)
+			{
+				appendChromeTraceEvent(json, "Frame", 0, frame->cpuBeginNanoseconds, frame->cpuEndNanoseconds);
+				for (const Sample& sample : frame->cpuSamples)
+				{
+					appendChromeTraceEvent(json, sample.name, 0, sample.beginNanoseconds, sample.endNanoseconds);
+				}
+				if (!frame->gpuSamples.empty())
+				{
+					// There's no calibration between the CPU and the GPU clock, so align the first GPU timestamp with the CPU frame begin
+					const uint64_t gpuFrameBeginNanoseconds = frame->gpuSamples[0].beginNanoseconds;
+					for (const Sample& sample : frame->gpuSamples)
+					{
+						appendChromeTraceEvent(json, sample.name, 1, frame->cpuBeginNanoseconds + (sample.beginNanoseconds - gpuFrameBeginNanoseconds), frame->cpuBeginNanoseconds + (sample.endNanoseconds - gpuFrameBeginNanoseconds));
+					}
+				}
+			}
+			json += "\n]}\n";
+
+			// Write the JSON file
+			IFile* file = fileManager.openFile(IFileManager::FileMode::WRITE, virtualFilename);
+			if (nullptr != file)
+			{
+				file->write(json.data(), json.size());
+				fileManager.closeFile(*file);
+				return true;
+			}
+
+			// Error!
+			return false;
+		}
+
+
+	//[-------------------------------------------------------]
+	//[ Public virtual Renderer::IProfiler methods            ]
+	//[-------------------------------------------------------]
+	public:
+		virtual void beginCommandBufferFrame(Rhi::CommandBuffer& commandBuffer) override
+		{
+			// Reset the timestamp query pool once per frame before the first timestamp is written, resets aren't allowed inside render passes
+			Frame& frame = mFrames[mCurrentFrameIndex];
+			if (nullptr != frame.timestampQueryPoolPtr && !frame.timestampQueryPoolReset)
+			{
+				Rhi::Command::ResetQueryPool::create(commandBuffer, *frame.timestampQueryPoolPtr, 0, mMaximumNumberOfGpuSamplesPerFrame * 2);
+				frame.timestampQueryPoolReset = true;
+			}
+		}
+
+		virtual void beginCpuSample(const char* name, [[maybe_unused]] uint32_t* hashCache) override
+		{
+			beginSample(mFrames[mCurrentFrameIndex].cpuSamples, mCpuSampleStack, name);
+			mFrames[mCurrentFrameIndex].cpuSamples.back().beginNanoseconds = getCpuNanoseconds();
+		}
+
+		virtual void endCpuSample() override
+		{
+			ASSERT(!mCpuSampleStack.empty(), "Timestamp profiler CPU sample end without begin")
+			mFrames[mCurrentFrameIndex].cpuSamples[mCpuSampleStack.back()].endNanoseconds = getCpuNanoseconds();
+			mCpuSampleStack.pop_back();
+		}
+
+		virtual void beginGpuSample([[maybe_unused]] const char* name, [[maybe_unused]] uint32_t* hashCache) override
+		{
+			// Without a command buffer there's no way to write a timestamp, still keep track of the sample hierarchy
+			mGpuSampleStack.push_back(getInvalid<uint32_t>());
+		}
+
+		virtual void endGpuSample() override
+		{
+			endCommandBufferGpuSampleInternal(nullptr);
+		}
+
+
+	//[-------------------------------------------------------]
+	//[ Protected virtual Renderer::IProfiler methods         ]
+	//[-------------------------------------------------------]
+	protected:
+		virtual void onBeginCommandBufferGpuSample(Rhi::CommandBuffer& commandBuffer, const char* name, [[maybe_unused]] uint32_t* hashCache) override
+		{
+			Frame& frame = mFrames[mCurrentFrameIndex];
+			if (nullptr == frame.timestampQueryPoolPtr)
+			{
+				mGpuSampleStack.push_back(getInvalid<uint32_t>());
+			}
+			else if (!frame.timestampQueryPoolReset || frame.gpuSamples.size() >= mMaximumNumberOfGpuSamplesPerFrame)
+			{
+				// Without a timestamp query pool reset during this frame, which has to be recorded outside of render passes, writing timestamps isn't allowed
+				++frame.numberOfDroppedGpuSamples;
+				mGpuSampleStack.push_back(getInvalid<uint32_t>());
+			}
+			else
+			{
+				// Write the begin timestamp
+				beginSample(frame.gpuSamples, mGpuSampleStack, name);
+				Rhi::Command::WriteTimestampQuery::create(commandBuffer, *frame.timestampQueryPoolPtr, mGpuSampleStack.back() * 2);
+			}
+		}
+
+		virtual void onEndCommandBufferGpuSample(Rhi::CommandBuffer& commandBuffer) override
+		{
+			endCommandBufferGpuSampleInternal(&commandBuffer);
+		}
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		explicit TimestampProfiler(const TimestampProfiler&) = delete;
+		TimestampProfiler& operator=(const TimestampProfiler&) = delete;
+
+		[[nodiscard]] inline uint64_t getCpuNanoseconds() const
+		{
+			return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - mCreationTime).count());
+		}
+
+		[[nodiscard]] inline uint64_t ticksToNanoseconds(uint64_t ticks) const
+		{
+			return static_cast<uint64_t>(static_cast<double>(ticks) * mTimestampPeriod);
+		}
+
+		inline void beginSample(Samples& samples, std::vector<uint32_t>& sampleStack, const char* name) const
+		{
+			// Find the parent sample, skipped samples inside the hierarchy are not taken into account
+			uint32_t parentIndex = getInvalid<uint32_t>();
+			for (auto iterator = sampleStack.crbegin(); iterator != sampleStack.crend(); ++iterator)
+			{
+				if (isValid(*iterator))
+				{
+					parentIndex = *iterator;
+					break;
+				}
+			}
+
+			// Add the sample
+			Sample& sample = samples.emplace_back();
+			strncpy(sample.name, name, MAXIMUM_SAMPLE_NAME_LENGTH);
+			sample.name[MAXIMUM_SAMPLE_NAME_LENGTH - 1] = '\0';
+			sample.parentIndex		= parentIndex;
+			sample.depth			= isValid(parentIndex) ? samples[parentIndex].depth + 1 : 0;
+			sample.beginNanoseconds = 0;
+			sample.endNanoseconds	= 0;
+			sampleStack.push_back(static_cast<uint32_t>(samples.size() - 1));
+		}
+
+		inline void endCommandBufferGpuSampleInternal(Rhi::CommandBuffer* commandBuffer)
+		{
+			ASSERT(!mGpuSampleStack.empty(), "Timestamp profiler GPU sample end without begin")
+			const uint32_t sampleIndex = mGpuSampleStack.back();
+			mGpuSampleStack.pop_back();
+			if (isValid(sampleIndex))
+			{
+				// Write the end timestamp
+				ASSERT(nullptr != commandBuffer, "Timestamp profiler GPU sample was begun with a command buffer but ended without one")
+				Rhi::Command::WriteTimestampQuery::create(*commandBuffer, *mFrames[mCurrentFrameIndex].timestampQueryPoolPtr, sampleIndex * 2 + 1);
+			}
+		}
+
+		inline void resolveFrame(Frame& frame)
+		{
+			const uint32_t numberOfGpuSamples = static_cast<uint32_t>(frame.gpuSamples.size());
+			if (0 == numberOfGpuSamples)
+			{
+				frame.resolved = true;
+			}
+			else
+			{
+				// Don't wait for the GPU, just try again during the next frame
+				const uint32_t numberOfQueries = numberOfGpuSamples * 2;
+				if (mRhi.getQueryPoolResults(*frame.timestampQueryPoolPtr, numberOfQueries * sizeof(uint64_t), reinterpret_cast<uint8_t*>(mTimestamps.data()), 0, numberOfQueries, sizeof(uint64_t), 0))
+				{
+					// Convert the RHI ticks into nanoseconds
+					for (uint32_t i = 0; i < numberOfGpuSamples; ++i)
+					{
+						Sample& sample = frame.gpuSamples[i];
+						sample.beginNanoseconds = ticksToNanoseconds(mTimestamps[i * 2]);
+						sample.endNanoseconds	= std::max(ticksToNanoseconds(mTimestamps[i * 2 + 1]), sample.beginNanoseconds);
+					}
+					frame.resolved = true;
+				}
+			}
+		}
+
+		static inline void appendChromeTraceEvent(std::string& json, const char* name, uint32_t threadId, uint64_t beginNanoseconds, uint64_t endNanoseconds)
+		{
+			// Escape the name, sample names are usually plain debug names
+			std::string escapedName;
+			for (const char* character = name; '\0' != *character; ++character)
+			{
+				if ('"' == *character || '\\' == *character)
+				{
+					escapedName += '\\';
+				}
+				if (static_cast<unsigned char>(*character) >= 0x20)
+				{
+					escapedName += *character;
+				}
+			}
+
+			// Chrome trace event times are in microseconds
+			char buffer[128];
+			snprintf(buffer, sizeof(buffer), "\",\"ph\":\"X\",\"pid\":0,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}", threadId, static_cast<double>(beginNanoseconds) / 1000.0, static_cast<double>(endNanoseconds - beginNanoseconds) / 1000.0);
+			json += ",\n{\"name\":\"";
+			json += escapedName;
+			json += buffer;
+		}
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		Rhi::IRhi&							  mRhi;									///< RHI instance to use
+		uint32_t							  mMaximumNumberOfGpuSamplesPerFrame;
+		double								  mTimestampPeriod;						///< Number of nanoseconds per GPU timestamp tick, see "Rhi::Capabilities::timestampPeriod", 0 if there's no support for timestamp queries
+		std::chrono::steady_clock::time_point mCreationTime;							///< CPU sample times are relative to this time point
+		std::vector<Frame>					  mFrames;								///< Frame ring
+		uint32_t							  mCurrentFrameIndex;					///< Index of the current frame inside the frame ring
+		uint64_t							  mNumberOfFrames;						///< Number of finished frames
+		std::vector<uint32_t>				  mCpuSampleStack;						///< Indices of the currently begun CPU samples inside the current frame
+		std::vector<uint32_t>				  mGpuSampleStack;						///< Indices of the currently begun GPU samples inside the current frame, "Renderer::getInvalid<uint32_t>()" for samples without timestamps
+		std::vector<uint64_t>				  mTimestamps;							///< Timestamp query results, kept as member to avoid reallocations
+
+
+	};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // Renderer
@@ -30,8 +30,19 @@
 #include "Renderer/Public/Resource/Scene/Item/Mesh/SkeletonMeshSceneItem.h"
 #include "Renderer/Public/Resource/Skeleton/SkeletonResourceManager.h"
 #include "Renderer/Public/Resource/Skeleton/SkeletonResource.h"
+#include "Renderer/Public/Resource/CompositorNode/CompositorNodeInstance.h"
+#include "Renderer/Public/Resource/CompositorNode/Pass/ICompositorInstancePass.h"
+#include "Renderer/Public/Resource/CompositorNode/Pass/ShadowMap/CompositorInstancePassShadowMap.h"
 #include "Renderer/Public/Resource/CompositorWorkspace/CompositorWorkspaceInstance.h"
+#include "Renderer/Public/Resource/CompositorWorkspace/CompositorWorkspaceResourceManager.h"
+#include "Renderer/Public/Core/Renderer/RenderTargetTextureManager.h"
+#include "Renderer/Public/Resource/Texture/TextureResourceManager.h"
+#include "Renderer/Public/Resource/Texture/TextureResource.h"
+#include "Renderer/Public/Asset/AssetManager.h"
 #include "Renderer/Public/IRenderer.h"
+#ifdef RENDERER_PROFILER
+	#include "Renderer/Public/Core/TimestampProfiler.h"
+#endif
 
 #include <ImGuizmo/ImGuizmo.h>
 
@@ -130,6 +141,16 @@ namespace
 			return outputBackup;
 		}
 
+		#ifdef RENDERER_PROFILER
+			void drawTimestampProfilerSamples(const Renderer::TimestampProfiler::Samples& samples)
+			{
+				for (const Renderer::TimestampProfiler::Sample& sample : samples)
+				{
+					ImGui::Text("%*s%s: %.3f ms", static_cast<int>(sample.depth * 2), "", sample.name, static_cast<double>(sample.endNanoseconds - sample.beginNanoseconds) / 1000000.0);
+				}
+			}
+		#endif
+
 
 //[-------------------------------------------------------]
 //[ Anonymous detail namespace                            ]
@@ -317,6 +338,46 @@ namespace Renderer
 		ImGui::End();
 	}
 
+	#ifdef RENDERER_PROFILER
+		void DebugGuiHelper::drawTimestampProfiler(const TimestampProfiler& timestampProfiler)
+		{
+			if (ImGui::Begin("Timestamp profiler"))
+			{
+				const TimestampProfiler::Frame* frame = timestampProfiler.getLastResolvedFrame();
+				if (nullptr != frame)
+				{
+					ImGui::Text("Frame %s: %.3f ms CPU", std::to_string(frame->frameNumber).c_str(), static_cast<double>(frame->cpuEndNanoseconds - frame->cpuBeginNanoseconds) / 1000000.0);
+					if (ImGui::TreeNodeEx("CpuSamples", ImGuiTreeNodeFlags_DefaultOpen, "CPU samples: %u", static_cast<uint32_t>(frame->cpuSamples.size())))
+					{
+						::detail::drawTimestampProfilerSamples(frame->cpuSamples);
+						ImGui::TreePop();
+					}
+					if (timestampProfiler.isGpuSamplingSupported())
+					{
+						if (ImGui::TreeNodeEx("GpuSamples", ImGuiTreeNodeFlags_DefaultOpen, "GPU samples: %u", static_cast<uint32_t>(frame->gpuSamples.size())))
+						{
+							::detail::drawTimestampProfilerSamples(frame->gpuSamples);
+							if (frame->numberOfDroppedGpuSamples > 0)
+							{
+								ImGui::TextColored(::detail::YELLOW_COLOR, "Dropped GPU samples: %u", frame->numberOfDroppedGpuSamples);
+							}
+							ImGui::TreePop();
+						}
+					}
+					else
+					{
+						ImGui::TextUnformatted("GPU samples are not supported by the RHI implementation");
+					}
+				}
+				else
+				{
+					ImGui::TextUnformatted("No resolved frame, yet");
+				}
+			}
+			ImGui::End();
+		}
+	#endif
+
 
 	//[-------------------------------------------------------]
 	//[ Private static methods                                ]
@@ -372,16 +433,14 @@ namespace Renderer
 				#else
 					uint32_t numberOfCommands = 0;
 					{
-						const uint8_t* commandPacketBuffer = commandBuffer.getCommandPacketBuffer();
-						Rhi::ConstCommandPacket constCommandPacket = commandPacketBuffer;
+						Rhi::ConstCommandPacket constCommandPacket = commandBuffer.getFirstCommandPacket();
 						while (nullptr != constCommandPacket)
 						{
 							// Count command packet
 							++numberOfCommands;
 
 							{ // Next command
-								const uint32_t nextCommandPacketByteIndex = Rhi::CommandPacketHelper::getNextCommandPacketByteIndex(constCommandPacket);
-								constCommandPacket = (~0u != nextCommandPacketByteIndex) ? &commandPacketBuffer[nextCommandPacketByteIndex] : nullptr;
+								constCommandPacket = Rhi::CommandPacketHelper::getNextCommandPacket(constCommandPacket);
 							}
 						}
 					}
@@ -390,16 +449,14 @@ namespace Renderer
 				{
 					// Loop through all commands and count them
 					uint32_t numberOfCommandFunctions[static_cast<uint8_t>(Rhi::CommandDispatchFunctionIndex::NUMBER_OF_FUNCTIONS)] = {};
-					const uint8_t* commandPacketBuffer = commandBuffer.getCommandPacketBuffer();
-					Rhi::ConstCommandPacket constCommandPacket = commandPacketBuffer;
+					Rhi::ConstCommandPacket constCommandPacket = commandBuffer.getFirstCommandPacket();
 					while (nullptr != constCommandPacket)
 					{
 						// Count command packet
 						++numberOfCommandFunctions[static_cast<uint32_t>(Rhi::CommandPacketHelper::loadCommandDispatchFunctionIndex(constCommandPacket))];
 
 						{ // Next command
-							const uint32_t nextCommandPacketByteIndex = Rhi::CommandPacketHelper::getNextCommandPacketByteIndex(constCommandPacket);
-							constCommandPacket = (~0u != nextCommandPacketByteIndex) ? &commandPacketBuffer[nextCommandPacketByteIndex] : nullptr;
+							constCommandPacket = Rhi::CommandPacketHelper::getNextCommandPacket(constCommandPacket);
 						}
 					}
 
@@ -424,6 +481,7 @@ namespace Renderer
 						"SetComputePipelineState",
 						"SetComputeResourceGroup",
 						"DispatchCompute",
+						"ComputeBufferBarrier",
 						// Resource
 						"SetTextureMinimumMaximumMipmapIndex",
 						"ResolveMultisampleFramebuffer",
@@ -446,10 +504,96 @@ namespace Renderer
 					ImGui::TreePop();
 				}
 
+				{ // Cached compositor instance pass command buffer metrics
+					uint32_t numberOfRecordedCommands = 0;
+					uint32_t numberOfReplayedCommands = 0;
+					for (const CompositorNodeInstance* compositorNodeInstance : compositorWorkspaceInstance->getSequentialCompositorNodeInstances())
+					{
+						for (const ICompositorInstancePass* compositorInstancePass : compositorNodeInstance->getCompositorInstancePasses())
+						{
+							numberOfRecordedCommands += compositorInstancePass->getNumberOfRecordedCommands();
+							numberOfReplayedCommands += compositorInstancePass->getNumberOfReplayedCommands();
+						}
+					}
+					ImGui::Text("Cached pass commands recorded %s", ::detail::stringFormatCommas(numberOfRecordedCommands, temporary));
+					ImGui::Text("Cached pass commands replayed %s", ::detail::stringFormatCommas(numberOfReplayedCommands, temporary));
+				}
+
+				{ // Shadow map metrics
+					const ICompositorInstancePass* compositorInstancePass = compositorWorkspaceInstance->getFirstCompositorInstancePassByCompositorPassTypeId(CompositorResourcePassShadowMap::TYPE_ID);
+					if (nullptr != compositorInstancePass)
+					{
+						const CompositorInstancePassShadowMap* compositorInstancePassShadowMap = static_cast<const CompositorInstancePassShadowMap*>(compositorInstancePass);
+						if (compositorInstancePassShadowMap->isEnabled())
+						{
+							for (uint8_t cascadeIndex = 0; cascadeIndex < compositorInstancePassShadowMap->getNumberOfShadowCascades(); ++cascadeIndex)
+							{
+								ImGui::Text("Shadow cascade %u casters %s", static_cast<uint32_t>(cascadeIndex), ::detail::stringFormatCommas(compositorInstancePassShadowMap->getNumberOfRenderedShadowCasters(cascadeIndex), temporary));
+							}
+						}
+					}
+				}
+
+				{ // Render target texture memory metrics, without aliasing every render target texture would need its own memory
+					const RenderTargetTextureManager& renderTargetTextureManager = compositorWorkspaceInstance->getRenderer().getCompositorWorkspaceResourceManager().getRenderTargetTextureManager();
+					ImGui::Text("Render target memory %s KiB", ::detail::stringFormatCommas(renderTargetTextureManager.getNumberOfAllocatedBytes() / 1024u, temporary));
+					ImGui::Text("Render target memory without aliasing %s KiB", ::detail::stringFormatCommas(renderTargetTextureManager.getNumberOfUnaliasedBytes() / 1024u, temporary));
+					ImGui::Text("Aliased render targets %s", ::detail::stringFormatCommas(renderTargetTextureManager.getNumberOfAliasedRenderTargetTextures(), temporary));
+				}
+
+				{ // Texture streaming metrics
+					const IRenderer& renderer = compositorWorkspaceInstance->getRenderer();
+					const TextureResourceManager& textureResourceManager = renderer.getTextureResourceManager();
+					const uint64_t numberOfResidentTextureBytes = textureResourceManager.getNumberOfResidentTextureBytes();
+					const uint64_t textureStreamingMemoryBudget = textureResourceManager.getTextureStreamingMemoryBudget();
+					ImGui::PushStyleColor(ImGuiCol_Text, (textureResourceManager.isTextureStreamingEnabled() && numberOfResidentTextureBytes > textureStreamingMemoryBudget) ? ::detail::RED_COLOR : ImGui::GetStyleColorVec4(ImGuiCol_Text));
+					ImGui::Text("Texture memory %s KiB", ::detail::stringFormatCommas(numberOfResidentTextureBytes / 1024u, temporary));
+					ImGui::PopStyleColor();
+					ImGui::Text("Texture streaming budget %s KiB%s", ::detail::stringFormatCommas(textureStreamingMemoryBudget / 1024u, temporary), textureResourceManager.isTextureStreamingEnabled() ? "" : " (disabled)");
+
+					// List the streamed textures, mipmap index 0 is the top mipmap
+					if (ImGui::TreeNode("TextureStreaming", "Streamed textures"))
+					{
+						const AssetManager& assetManager = renderer.getAssetManager();
+						const uint32_t numberOfTextureResources = textureResourceManager.getNumberOfResources();
+						for (uint32_t i = 0; i < numberOfTextureResources; ++i)
+						{
+							const TextureResource& textureResource = static_cast<const TextureResource&>(textureResourceManager.getResourceByIndex(i));
+							if (textureResource.getNumberOfMipmaps() > 1)
+							{
+								const Asset* asset = assetManager.tryGetAssetByAssetId(textureResource.getAssetId());
+								ImGui::Text("%s: Resident mip %u, requested mip %u, %u mips, %s KiB", (nullptr != asset) ? asset->virtualFilename : "-", static_cast<uint32_t>(textureResource.getNumberOfResidentTopMipmapsRemoved()), static_cast<uint32_t>(textureResource.getRequestedNumberOfTopMipmapsToRemove()), static_cast<uint32_t>(textureResource.getNumberOfMipmaps()), ::detail::stringFormatCommas(textureResource.getNumberOfResidentBytes() / 1024u, temporary));
+							}
+						}
+						ImGui::TreePop();
+					}
+				}
+
 				// RHI and pipeline statistics
 				#ifdef RHI_STATISTICS
 				{ // RHI statistics
 					const Rhi::Statistics& statistics = static_cast<const Rhi::IRhi&>(compositorWorkspaceInstance->getRenderer().getRhi()).getStatistics();
+					const Rhi::Statistics::FrameStatistics& frameStatistics = statistics.lastFrame;
+					if (ImGui::TreeNode("RhiFrame", "RHI frame: %s draws", ::detail::stringFormatCommas(frameStatistics.numberOfDraws, temporary)))
+					{
+						ImGui::Text("Submitted instances: %s", ::detail::stringFormatCommas(frameStatistics.numberOfSubmittedInstances, temporary));
+						ImGui::Text("Submitted vertices: %s", ::detail::stringFormatCommas(frameStatistics.numberOfSubmittedVertices, temporary));
+						ImGui::Text("Dispatches: %s", ::detail::stringFormatCommas(frameStatistics.numberOfCommandPackets[static_cast<uint32_t>(Rhi::CommandDispatchFunctionIndex::DISPATCH_COMPUTE)], temporary));
+						ImGui::Text("Graphics pipeline state binds: %s", ::detail::stringFormatCommas(frameStatistics.numberOfCommandPackets[static_cast<uint32_t>(Rhi::CommandDispatchFunctionIndex::SET_GRAPHICS_PIPELINE_STATE)], temporary));
+						ImGui::Text("Graphics resource group binds: %s", ::detail::stringFormatCommas(frameStatistics.numberOfCommandPackets[static_cast<uint32_t>(Rhi::CommandDispatchFunctionIndex::SET_GRAPHICS_RESOURCE_GROUP)], temporary));
+						ImGui::Text("Vertex array binds: %s", ::detail::stringFormatCommas(frameStatistics.numberOfCommandPackets[static_cast<uint32_t>(Rhi::CommandDispatchFunctionIndex::SET_GRAPHICS_VERTEX_ARRAY)], temporary));
+						ImGui::Text("Render target binds: %s", ::detail::stringFormatCommas(frameStatistics.numberOfCommandPackets[static_cast<uint32_t>(Rhi::CommandDispatchFunctionIndex::SET_GRAPHICS_RENDER_TARGET)], temporary));
+						ImGui::Text("Maps: %s", ::detail::stringFormatCommas(frameStatistics.numberOfMaps, temporary));
+						ImGui::Text("Unmaps: %s", ::detail::stringFormatCommas(frameStatistics.numberOfUnmaps, temporary));
+						ImGui::Text("Written: %s KiB", ::detail::stringFormatCommas(frameStatistics.numberOfWrittenBytes / 1024u, temporary));
+						ImGui::TreePop();
+					}
+					if (ImGui::TreeNode("RhiMemory", "RHI memory: %s KiB", ::detail::stringFormatCommas((statistics.currentNumberOfBufferBytes.load() + statistics.currentNumberOfTextureBytes.load()) / 1024u, temporary)))
+					{
+						ImGui::Text("Buffers: %s KiB", ::detail::stringFormatCommas(statistics.currentNumberOfBufferBytes.load() / 1024u, temporary));
+						ImGui::Text("Textures: %s KiB", ::detail::stringFormatCommas(statistics.currentNumberOfTextureBytes.load() / 1024u, temporary));
+						ImGui::TreePop();
+					}
 					if (ImGui::TreeNode("RhiResources", "RHI resources: %s", ::detail::stringFormatCommas(statistics.getNumberOfCurrentResources(), temporary)))
 					{
 						ImGui::Text("Root signatures: %s", ::detail::stringFormatCommas(statistics.currentNumberOfRootSignatures.load(), temporary));
@@ -39,6 +39,9 @@ namespace Renderer
 	class CameraSceneItem;
 	class SkeletonMeshSceneItem;
 	class CompositorWorkspaceInstance;
+	#ifdef RENDERER_PROFILER
+		class TimestampProfiler;
+	#endif
 }
 
 
@@ -98,6 +101,9 @@ namespace Renderer
 		RENDERER_API_EXPORT static void drawGizmo(const CameraSceneItem& cameraSceneItem, GizmoSettings& gizmoSettings, Transform& transform);	// Using "ImGuizmo" ( https://github.com/CedricGuillemet/ImGuizmo )
 		RENDERER_API_EXPORT static void drawSkeleton(const CameraSceneItem& cameraSceneItem, const SkeletonMeshSceneItem& skeletonMeshSceneItem);
 		RENDERER_API_EXPORT static void drawGrid(const CameraSceneItem& cameraSceneItem, float cellSize = 1.0f, double yPosition = 0.0f);
+		#ifdef RENDERER_PROFILER
+			RENDERER_API_EXPORT static void drawTimestampProfiler(const TimestampProfiler& timestampProfiler);	// Draws the most recent resolved frame of the timestamp profiler
+		#endif
 
 
 	//[-------------------------------------------------------]
@@ -51,6 +51,7 @@ namespace Renderer
 {
 	class Context;
 	class TimeManager;
+	class FrameAllocator;
 	class IFileManager;
 	class AssetManager;
 	class IRenderer;
@@ -225,6 +226,18 @@ namespace Renderer
 			return *mTimeManager;
 		}
 
+		/**
+		*  @brief
+		*    Return the frame allocator instance for transient per-frame data
+		*
+		*  @return
+		*    The frame allocator instance, do not release the returned instance
+		*/
+		[[nodiscard]] inline FrameAllocator& getFrameAllocator() const
+		{
+			return *mFrameAllocator;
+		}
+
 		//[-------------------------------------------------------]
 		//[ Resource                                              ]
 		//[-------------------------------------------------------]
@@ -527,6 +540,7 @@ namespace Renderer
 			mDefaultThreadPool(nullptr),
 			mAssetManager(nullptr),
 			mTimeManager(nullptr),
+			mFrameAllocator(nullptr),
 			// Resource
 			mRendererResourceManager(nullptr),
 			mResourceStreamer(nullptr),
@@ -573,6 +587,7 @@ namespace Renderer
 		DefaultThreadPool*	  mDefaultThreadPool;
 		AssetManager*		  mAssetManager;
 		TimeManager*		  mTimeManager;
+		FrameAllocator*		  mFrameAllocator;
 		// Resource
 		RendererResourceManager*			mRendererResourceManager;
 		ResourceStreamer*					mResourceStreamer;
@@ -0,0 +1,233 @@
+/*********************************************************\
+ * Copyright (c) 2012-2020 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Shader start                                          ]
+//[-------------------------------------------------------]
+#ifdef RHI_VULKAN
+if (rhi.getNameId() == Rhi::NameId::VULKAN)
+{
+
+
+//[-------------------------------------------------------]
+//[ Compute shader source code                            ]
+//[-------------------------------------------------------]
+// One compute shader invocation per instance, clears the draw count as well as the draw arguments
+clearComputeShaderSourceCode = R"(#version 450 core	// OpenGL 4.5
+
+// Same layout as "Renderer::GpuInstanceCuller::Mesh"
+struct Mesh
+{
+	uvec4 indexCountPerInstance;
+	uvec4 startIndexLocation;
+	ivec4 baseVertexLocation;
+	vec4  maximumLodDistance;
+	uint  numberOfLods;
+	uint  padding0;
+	uint  padding1;
+	uint  padding2;
+};
+
+// Same layout as "Renderer::GpuInstanceCuller::Instance"
+struct Instance
+{
+	vec4 objectSpaceToWorldSpace[3];
+	vec3 minimum;
+	uint meshIndex;
+	vec3 maximum;
+	uint startInstanceLocation;
+};
+
+// Same layout as "Rhi::DrawIndexedArguments"
+struct DrawIndexedArguments
+{
+	uint indexCountPerInstance;
+	uint instanceCount;
+	uint startIndexLocation;
+	int  baseVertexLocation;
+	uint startInstanceLocation;
+};
+
+// Input
+layout(std140, set = 0, binding = 0) uniform PassUniformBuffer
+{
+	mat4  CameraRelativeWorldSpaceToClipSpaceMatrix;
+	vec4  WorldSpaceCameraPosition;
+	uvec4 NumberOfInstances;
+};
+layout(std430, set = 0, binding = 1) readonly buffer InstanceStructuredBuffer
+{
+	Instance instances[];
+};
+layout(std430, set = 0, binding = 2) readonly buffer MeshStructuredBuffer
+{
+	Mesh meshes[];
+};
+
+// Output
+layout(std430, set = 0, binding = 3) buffer DrawIndexedArgumentsBuffer
+{
+	DrawIndexedArguments drawIndexedArguments[];
+};
+layout(std430, set = 0, binding = 4) buffer DrawCountStructuredBuffer
+{
+	uint drawCount;
+};
+
+// Programs
+layout (local_size_x = 64) in;
+void main()
+{
+	uint drawIndex = gl_GlobalInvocationID.x;
+	if (0 == drawIndex)
+	{
+		drawCount = 0u;
+	}
+	if (drawIndex < NumberOfInstances.x)
+	{
+		drawIndexedArguments[drawIndex] = DrawIndexedArguments(0u, 0u, 0u, 0, 0u);
+	}
+}
+)";
+
+// One compute shader invocation per instance, frustum culling and LOD selection writing compacted draw arguments (keep this in sync with "Renderer::GpuInstanceCuller::cullOnCpu()")
+cullComputeShaderSourceCode = R"(#version 450 core	// OpenGL 4.5
+
+// Same layout as "Renderer::GpuInstanceCuller::Mesh"
+struct Mesh
+{
+	uvec4 indexCountPerInstance;
+	uvec4 startIndexLocation;
+	ivec4 baseVertexLocation;
+	vec4  maximumLodDistance;
+	uint  numberOfLods;
+	uint  padding0;
+	uint  padding1;
+	uint  padding2;
+};
+
+// Same layout as "Renderer::GpuInstanceCuller::Instance"
+struct Instance
+{
+	vec4 objectSpaceToWorldSpace[3];
+	vec3 minimum;
+	uint meshIndex;
+	vec3 maximum;
+	uint startInstanceLocation;
+};
+
+// Same layout as "Rhi::DrawIndexedArguments"
+struct DrawIndexedArguments
+{
+	uint indexCountPerInstance;
+	uint instanceCount;
+	uint startIndexLocation;
+	int  baseVertexLocation;
+	uint startInstanceLocation;
+};
+
+// Input
+layout(std140, set = 0, binding = 0) uniform PassUniformBuffer
+{
+	mat4  CameraRelativeWorldSpaceToClipSpaceMatrix;
+	vec4  WorldSpaceCameraPosition;
+	uvec4 NumberOfInstances;
+};
+layout(std430, set = 0, binding = 1) readonly buffer InstanceStructuredBuffer
+{
+	Instance instances[];
+};
+layout(std430, set = 0, binding = 2) readonly buffer MeshStructuredBuffer
+{
+	Mesh meshes[];
+};
+
+// Output
+layout(std430, set = 0, binding = 3) buffer DrawIndexedArgumentsBuffer
+{
+	DrawIndexedArguments drawIndexedArguments[];
+};
+layout(std430, set = 0, binding = 4) buffer DrawCountStructuredBuffer
+{
+	uint drawCount;
+};
+
+// Functions
+bool isOutsideClipSpacePlane(vec4 plane, vec4 clipSpaceCenter, vec4 clipSpaceAxisX, vec4 clipSpaceAxisY, vec4 clipSpaceAxisZ)
+{
+	// The bounding box is on the outer side of the plane if its corner nearest to the inner side is on the outer side
+	return (dot(plane, clipSpaceCenter) + abs(dot(plane, clipSpaceAxisX)) + abs(dot(plane, clipSpaceAxisY)) + abs(dot(plane, clipSpaceAxisZ)) < 0.0);
+}
+
+// Programs
+layout (local_size_x = 64) in;
+void main()
+{
+	uint instanceIndex = gl_GlobalInvocationID.x;
+	if (instanceIndex >= NumberOfInstances.x)
+	{
+		return;
+	}
+	Instance instance = instances[instanceIndex];
+
+	// Camera relative world space bounding box center
+	vec4 objectSpaceCenter = vec4((instance.minimum + instance.maximum) * 0.5, 1.0);
+	vec3 objectSpaceHalfExtents = (instance.maximum - instance.minimum) * 0.5;
+	vec3 cameraRelativeCenter = vec3(dot(instance.objectSpaceToWorldSpace[0], objectSpaceCenter), dot(instance.objectSpaceToWorldSpace[1], objectSpaceCenter), dot(instance.objectSpaceToWorldSpace[2], objectSpaceCenter)) - WorldSpaceCameraPosition.xyz;
+
+	// Clip space bounding box center and half extent axes
+	vec4 clipSpaceCenter = CameraRelativeWorldSpaceToClipSpaceMatrix * vec4(cameraRelativeCenter, 1.0);
+	vec4 clipSpaceAxisX = CameraRelativeWorldSpaceToClipSpaceMatrix * vec4(vec3(instance.objectSpaceToWorldSpace[0].x, instance.objectSpaceToWorldSpace[1].x, instance.objectSpaceToWorldSpace[2].x) * objectSpaceHalfExtents.x, 0.0);
+	vec4 clipSpaceAxisY = CameraRelativeWorldSpaceToClipSpaceMatrix * vec4(vec3(instance.objectSpaceToWorldSpace[0].y, instance.objectSpaceToWorldSpace[1].y, instance.objectSpaceToWorldSpace[2].y) * objectSpaceHalfExtents.y, 0.0);
+	vec4 clipSpaceAxisZ = CameraRelativeWorldSpaceToClipSpaceMatrix * vec4(vec3(instance.objectSpaceToWorldSpace[0].z, instance.objectSpaceToWorldSpace[1].z, instance.objectSpaceToWorldSpace[2].z) * objectSpaceHalfExtents.z, 0.0);
+
+	// Frustum culling, the clip space depth is zero at the near plane and one at the far plane
+	if (isOutsideClipSpacePlane(vec4( 1.0,  0.0,  0.0, 1.0), clipSpaceCenter, clipSpaceAxisX, clipSpaceAxisY, clipSpaceAxisZ) ||
+		isOutsideClipSpacePlane(vec4(-1.0,  0.0,  0.0, 1.0), clipSpaceCenter, clipSpaceAxisX, clipSpaceAxisY, clipSpaceAxisZ) ||
+		isOutsideClipSpacePlane(vec4( 0.0,  1.0,  0.0, 1.0), clipSpaceCenter, clipSpaceAxisX, clipSpaceAxisY, clipSpaceAxisZ) ||
+		isOutsideClipSpacePlane(vec4( 0.0, -1.0,  0.0, 1.0), clipSpaceCenter, clipSpaceAxisX, clipSpaceAxisY, clipSpaceAxisZ) ||
+		isOutsideClipSpacePlane(vec4( 0.0,  0.0,  1.0, 0.0), clipSpaceCenter, clipSpaceAxisX, clipSpaceAxisY, clipSpaceAxisZ) ||
+		isOutsideClipSpacePlane(vec4( 0.0,  0.0, -1.0, 1.0), clipSpaceCenter, clipSpaceAxisX, clipSpaceAxisY, clipSpaceAxisZ))
+	{
+		return;
+	}
+
+	// LOD selection by using the camera distance to the bounding box center
+	Mesh mesh = meshes[instance.meshIndex];
+	float distance = length(cameraRelativeCenter);
+	uint lodIndex = 0u;
+	while (lodIndex + 1u < mesh.numberOfLods && distance > mesh.maximumLodDistance[lodIndex])
+	{
+		++lodIndex;
+	}
+
+	// Write the compacted draw arguments
+	uint drawIndex = atomicAdd(drawCount, 1u);
+	drawIndexedArguments[drawIndex] = DrawIndexedArguments(mesh.indexCountPerInstance[lodIndex], 1u, mesh.startIndexLocation[lodIndex], mesh.baseVertexLocation[lodIndex], instance.startInstanceLocation);
+}
+)";
+
+
+//[-------------------------------------------------------]
+//[ Shader end                                            ]
+//[-------------------------------------------------------]
+}
+else
+#endif
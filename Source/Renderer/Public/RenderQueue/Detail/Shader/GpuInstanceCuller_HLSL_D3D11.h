@@ -0,0 +1,199 @@
+/*********************************************************\
+ * Copyright (c) 2012-2020 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Shader start                                          ]
+//[-------------------------------------------------------]
+#ifdef RHI_DIRECT3D11
+if (rhi.getNameId() == Rhi::NameId::DIRECT3D11)
+{
+
+
+//[-------------------------------------------------------]
+//[ Compute shader source code                            ]
+//[-------------------------------------------------------]
+// One compute shader invocation per instance, clears the draw count as well as the draw arguments
+clearComputeShaderSourceCode = R"(
+// Same layout as "Renderer::GpuInstanceCuller::Mesh"
+struct Mesh
+{
+	uint4  indexCountPerInstance;
+	uint4  startIndexLocation;
+	int4   baseVertexLocation;
+	float4 maximumLodDistance;
+	uint   numberOfLods;
+	uint   padding0;
+	uint   padding1;
+	uint   padding2;
+};
+
+// Same layout as "Renderer::GpuInstanceCuller::Instance"
+struct Instance
+{
+	float4 objectSpaceToWorldSpace[3];
+	float3 minimum;
+	uint   meshIndex;
+	float3 maximum;
+	uint   startInstanceLocation;
+};
+
+// Input
+cbuffer PassUniformBuffer : register(b0)
+{
+	float4x4 CameraRelativeWorldSpaceToClipSpaceMatrix;
+	float4	 WorldSpaceCameraPosition;
+	uint4	 NumberOfInstances;
+};
+StructuredBuffer<Instance> InstanceStructuredBuffer : register(t0);
+StructuredBuffer<Mesh>	   MeshStructuredBuffer		: register(t1);
+
+// Output
+// -> Five 32 bit unsigned integers per draw, same layout as "Rhi::DrawIndexedArguments"
+// -> A structured indirect buffer isn't possible with Direct3D 11, see the compute shader example for details
+RWBuffer<uint>			   DrawIndexedArgumentsBuffer : register(u0);
+RWStructuredBuffer<uint>   DrawCountStructuredBuffer  : register(u1);
+
+// Programs
+[numthreads(64, 1, 1)]
+void main(uint3 dispatchThreadId : SV_DispatchThreadID)
+{
+	uint drawIndex = dispatchThreadId.x;
+	if (0 == drawIndex)
+	{
+		DrawCountStructuredBuffer[0] = 0;
+	}
+	if (drawIndex < NumberOfInstances.x)
+	{
+		for (uint i = 0; i < 5; ++i)
+		{
+			DrawIndexedArgumentsBuffer[drawIndex * 5 + i] = 0;
+		}
+	}
+}
+)";
+
+// One compute shader invocation per instance, frustum culling and LOD selection writing compacted draw arguments (keep this in sync with "Renderer::GpuInstanceCuller::cullOnCpu()")
+cullComputeShaderSourceCode = R"(
+// Same layout as "Renderer::GpuInstanceCuller::Mesh"
+struct Mesh
+{
+	uint4  indexCountPerInstance;
+	uint4  startIndexLocation;
+	int4   baseVertexLocation;
+	float4 maximumLodDistance;
+	uint   numberOfLods;
+	uint   padding0;
+	uint   padding1;
+	uint   padding2;
+};
+
+// Same layout as "Renderer::GpuInstanceCuller::Instance"
+struct Instance
+{
+	float4 objectSpaceToWorldSpace[3];
+	float3 minimum;
+	uint   meshIndex;
+	float3 maximum;
+	uint   startInstanceLocation;
+};
+
+// Input
+cbuffer PassUniformBuffer : register(b0)
+{
+	float4x4 CameraRelativeWorldSpaceToClipSpaceMatrix;
+	float4	 WorldSpaceCameraPosition;
+	uint4	 NumberOfInstances;
+};
+StructuredBuffer<Instance> InstanceStructuredBuffer : register(t0);
+StructuredBuffer<Mesh>	   MeshStructuredBuffer		: register(t1);
+
+// Output
+// -> Five 32 bit unsigned integers per draw, same layout as "Rhi::DrawIndexedArguments"
+// -> A structured indirect buffer isn't possible with Direct3D 11, see the compute shader example for details
+RWBuffer<uint>			   DrawIndexedArgumentsBuffer : register(u0);
+RWStructuredBuffer<uint>   DrawCountStructuredBuffer  : register(u1);
+
+// Functions
+bool isOutsideClipSpacePlane(float4 plane, float4 clipSpaceCenter, float4 clipSpaceAxisX, float4 clipSpaceAxisY, float4 clipSpaceAxisZ)
+{
+	// The bounding box is on the outer side of the plane if its corner nearest to the inner side is on the outer side
+	return (dot(plane, clipSpaceCenter) + abs(dot(plane, clipSpaceAxisX)) + abs(dot(plane, clipSpaceAxisY)) + abs(dot(plane, clipSpaceAxisZ)) < 0.0f);
+}
+
+// Programs
+[numthreads(64, 1, 1)]
+void main(uint3 dispatchThreadId : SV_DispatchThreadID)
+{
+	uint instanceIndex = dispatchThreadId.x;
+	if (instanceIndex >= NumberOfInstances.x)
+	{
+		return;
+	}
+	Instance instance = InstanceStructuredBuffer[instanceIndex];
+
+	// Camera relative world space bounding box center
+	float4 objectSpaceCenter = float4((instance.minimum + instance.maximum) * 0.5f, 1.0f);
+	float3 objectSpaceHalfExtents = (instance.maximum - instance.minimum) * 0.5f;
+	float3 cameraRelativeCenter = float3(dot(instance.objectSpaceToWorldSpace[0], objectSpaceCenter), dot(instance.objectSpaceToWorldSpace[1], objectSpaceCenter), dot(instance.objectSpaceToWorldSpace[2], objectSpaceCenter)) - WorldSpaceCameraPosition.xyz;
+
+	// Clip space bounding box center and half extent axes
+	float4 clipSpaceCenter = mul(CameraRelativeWorldSpaceToClipSpaceMatrix, float4(cameraRelativeCenter, 1.0f));
+	float4 clipSpaceAxisX = mul(CameraRelativeWorldSpaceToClipSpaceMatrix, float4(float3(instance.objectSpaceToWorldSpace[0].x, instance.objectSpaceToWorldSpace[1].x, instance.objectSpaceToWorldSpace[2].x) * objectSpaceHalfExtents.x, 0.0f));
+	float4 clipSpaceAxisY = mul(CameraRelativeWorldSpaceToClipSpaceMatrix, float4(float3(instance.objectSpaceToWorldSpace[0].y, instance.objectSpaceToWorldSpace[1].y, instance.objectSpaceToWorldSpace[2].y) * objectSpaceHalfExtents.y, 0.0f));
+	float4 clipSpaceAxisZ = mul(CameraRelativeWorldSpaceToClipSpaceMatrix, float4(float3(instance.objectSpaceToWorldSpace[0].z, instance.objectSpaceToWorldSpace[1].z, instance.objectSpaceToWorldSpace[2].z) * objectSpaceHalfExtents.z, 0.0f));
+
+	// Frustum culling, the clip space depth is zero at the near plane and one at the far plane
+	if (isOutsideClipSpacePlane(float4( 1.0f,  0.0f,  0.0f, 1.0f), clipSpaceCenter, clipSpaceAxisX, clipSpaceAxisY, clipSpaceAxisZ) ||
+		isOutsideClipSpacePlane(float4(-1.0f,  0.0f,  0.0f, 1.0f), clipSpaceCenter, clipSpaceAxisX, clipSpaceAxisY, clipSpaceAxisZ) ||
+		isOutsideClipSpacePlane(float4( 0.0f,  1.0f,  0.0f, 1.0f), clipSpaceCenter, clipSpaceAxisX, clipSpaceAxisY, clipSpaceAxisZ) ||
+		isOutsideClipSpacePlane(float4( 0.0f, -1.0f,  0.0f, 1.0f), clipSpaceCenter, clipSpaceAxisX, clipSpaceAxisY, clipSpaceAxisZ) ||
+		isOutsideClipSpacePlane(float4( 0.0f,  0.0f,  1.0f, 0.0f), clipSpaceCenter, clipSpaceAxisX, clipSpaceAxisY, clipSpaceAxisZ) ||
+		isOutsideClipSpacePlane(float4( 0.0f,  0.0f, -1.0f, 1.0f), clipSpaceCenter, clipSpaceAxisX, clipSpaceAxisY, clipSpaceAxisZ))
+	{
+		return;
+	}
+
+	// LOD selection by using the camera distance to the bounding box center
+	Mesh mesh = MeshStructuredBuffer[instance.meshIndex];
+	float distance = length(cameraRelativeCenter);
+	uint lodIndex = 0;
+	while (lodIndex + 1 < mesh.numberOfLods && distance > mesh.maximumLodDistance[lodIndex])
+	{
+		++lodIndex;
+	}
+
+	// Write the compacted draw arguments
+	uint drawIndex;
+	InterlockedAdd(DrawCountStructuredBuffer[0], 1, drawIndex);
+	DrawIndexedArgumentsBuffer[drawIndex * 5 + 0] = mesh.indexCountPerInstance[lodIndex];	// Rhi::DrawIndexedArguments::indexCountPerInstance
+	DrawIndexedArgumentsBuffer[drawIndex * 5 + 1] = 1;										// Rhi::DrawIndexedArguments::instanceCount
+	DrawIndexedArgumentsBuffer[drawIndex * 5 + 2] = mesh.startIndexLocation[lodIndex];		// Rhi::DrawIndexedArguments::startIndexLocation
+	DrawIndexedArgumentsBuffer[drawIndex * 5 + 3] = asuint(mesh.baseVertexLocation[lodIndex]);	// Rhi::DrawIndexedArguments::baseVertexLocation
+	DrawIndexedArgumentsBuffer[drawIndex * 5 + 4] = instance.startInstanceLocation;			// Rhi::DrawIndexedArguments::startInstanceLocation
+}
+)";
+
+
+//[-------------------------------------------------------]
+//[ Shader end                                            ]
+//[-------------------------------------------------------]
+}
+else
+#endif
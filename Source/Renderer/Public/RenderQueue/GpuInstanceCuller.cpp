@@ -0,0 +1,511 @@
+/*********************************************************\
+ * Copyright (c) 2012-2020 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Renderer/Public/RenderQueue/GpuInstanceCuller.h"
+#include "Renderer/Public/Core/IProfiler.h"
+#include "Renderer/Public/IRenderer.h"
+#include "Renderer/Public/Context.h"
+
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4464)	// warning C4464: relative include path contains '..'
+	#include <glm/detail/setup.hpp>	// For "GLM_COUNTOF()"
+PRAGMA_WARNING_POP
+
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4668)	// warning C4668: '_M_HYBRID_X86_ARM64' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
+	#include <algorithm>	// For "std::sort()"
+	#include <cstring>		// For "memcpy()"
+PRAGMA_WARNING_POP
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Structures                                            ]
+		//[-------------------------------------------------------]
+		struct GpuInstanceCullerPassData final	///< Same memory layout as the uniform buffer inside the compute shader
+		{
+			glm::mat4  cameraRelativeWorldSpaceToClipSpaceMatrix;
+			glm::vec4  worldSpaceCameraPosition;	///< w is unused
+			glm::uvec4 numberOfInstances;			///< y, z and w are unused
+		};
+
+
+		//[-------------------------------------------------------]
+		//[ Global definitions                                    ]
+		//[-------------------------------------------------------]
+		// Clip space planes of the view frustum, the clip space depth is zero at the near plane and one at the far plane
+		static const glm::vec4 CLIP_SPACE_FRUSTUM_PLANES[6] =
+		{
+			glm::vec4( 1.0f,  0.0f,  0.0f, 1.0f),	// Left
+			glm::vec4(-1.0f,  0.0f,  0.0f, 1.0f),	// Right
+			glm::vec4( 0.0f,  1.0f,  0.0f, 1.0f),	// Bottom
+			glm::vec4( 0.0f, -1.0f,  0.0f, 1.0f),	// Top
+			glm::vec4( 0.0f,  0.0f,  1.0f, 0.0f),	// Near
+			glm::vec4( 0.0f,  0.0f, -1.0f, 1.0f)	// Far
+		};
+
+
+		//[-------------------------------------------------------]
+		//[ Global functions                                      ]
+		//[-------------------------------------------------------]
+		[[nodiscard]] inline glm::vec4 getInstanceRow(const Renderer::GpuInstanceCuller::Instance& instance, int row)
+		{
+			return glm::vec4(instance.objectSpaceToWorldSpace[row][0], instance.objectSpaceToWorldSpace[row][1], instance.objectSpaceToWorldSpace[row][2], instance.objectSpaceToWorldSpace[row][3]);
+		}
+
+		[[nodiscard]] inline bool isDrawIndexedArgumentsLess(const Rhi::DrawIndexedArguments& left, const Rhi::DrawIndexedArguments& right)
+		{
+			if (left.startInstanceLocation != right.startInstanceLocation)
+			{
+				return (left.startInstanceLocation < right.startInstanceLocation);
+			}
+			if (left.startIndexLocation != right.startIndexLocation)
+			{
+				return (left.startIndexLocation < right.startIndexLocation);
+			}
+			if (left.indexCountPerInstance != right.indexCountPerInstance)
+			{
+				return (left.indexCountPerInstance < right.indexCountPerInstance);
+			}
+			if (left.baseVertexLocation != right.baseVertexLocation)
+			{
+				return (left.baseVertexLocation < right.baseVertexLocation);
+			}
+			return (left.instanceCount < right.instanceCount);
+		}
+
+		void gatherNonEmptyDraws(const Rhi::DrawIndexedArguments* drawIndexedArguments, uint32_t numberOfDraws, Renderer::GpuInstanceCuller::DrawIndexedArgumentsVector& nonEmptyDrawIndexedArguments)
+		{
+			nonEmptyDrawIndexedArguments.reserve(numberOfDraws);
+			for (uint32_t i = 0; i < numberOfDraws; ++i)
+			{
+				if (0 != drawIndexedArguments[i].indexCountPerInstance && 0 != drawIndexedArguments[i].instanceCount)
+				{
+					nonEmptyDrawIndexedArguments.push_back(drawIndexedArguments[i]);
+				}
+			}
+			std::sort(nonEmptyDrawIndexedArguments.begin(), nonEmptyDrawIndexedArguments.end(), isDrawIndexedArgumentsLess);
+		}
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Public static methods                                 ]
+	//[-------------------------------------------------------]
+	uint32_t GpuInstanceCuller::cullOnCpu(const Meshes& meshes, const Instances& instances, const glm::mat4& cameraRelativeWorldSpaceToClipSpaceMatrix, const glm::vec3& worldSpaceCameraPosition, Rhi::DrawIndexedArguments* drawIndexedArguments)
+	{
+		// Keep this in sync with the compute shader
+		uint32_t numberOfDraws = 0;
+		for (const Instance& instance : instances)
+		{
+			// Camera relative world space bounding box center
+			const glm::vec4 rows[3] = { ::detail::getInstanceRow(instance, 0), ::detail::getInstanceRow(instance, 1), ::detail::getInstanceRow(instance, 2) };
+			const glm::vec3 objectSpaceMinimum(instance.minimum[0], instance.minimum[1], instance.minimum[2]);
+			const glm::vec3 objectSpaceMaximum(instance.maximum[0], instance.maximum[1], instance.maximum[2]);
+			const glm::vec4 objectSpaceCenter((objectSpaceMinimum + objectSpaceMaximum) * 0.5f, 1.0f);
+			const glm::vec3 objectSpaceHalfExtents = (objectSpaceMaximum - objectSpaceMinimum) * 0.5f;
+			const glm::vec3 cameraRelativeCenter = glm::vec3(glm::dot(rows[0], objectSpaceCenter), glm::dot(rows[1], objectSpaceCenter), glm::dot(rows[2], objectSpaceCenter)) - worldSpaceCameraPosition;
+
+			// Clip space bounding box center and half extent axes
+			const glm::vec4 clipSpaceCenter = cameraRelativeWorldSpaceToClipSpaceMatrix * glm::vec4(cameraRelativeCenter, 1.0f);
+			const glm::vec4 clipSpaceAxisX = cameraRelativeWorldSpaceToClipSpaceMatrix * glm::vec4(glm::vec3(rows[0].x, rows[1].x, rows[2].x) * objectSpaceHalfExtents.x, 0.0f);
+			const glm::vec4 clipSpaceAxisY = cameraRelativeWorldSpaceToClipSpaceMatrix * glm::vec4(glm::vec3(rows[0].y, rows[1].y, rows[2].y) * objectSpaceHalfExtents.y, 0.0f);
+			const glm::vec4 clipSpaceAxisZ = cameraRelativeWorldSpaceToClipSpaceMatrix * glm::vec4(glm::vec3(rows[0].z, rows[1].z, rows[2].z) * objectSpaceHalfExtents.z, 0.0f);
+
+			// Frustum culling: The bounding box is invisible if all of its corners are on the outer side of one frustum plane
+			bool visible = true;
+			for (const glm::vec4& plane : ::detail::CLIP_SPACE_FRUSTUM_PLANES)
+			{
+				if (glm::dot(plane, clipSpaceCenter) + std::abs(glm::dot(plane, clipSpaceAxisX)) + std::abs(glm::dot(plane, clipSpaceAxisY)) + std::abs(glm::dot(plane, clipSpaceAxisZ)) < 0.0f)
+				{
+					visible = false;
+					break;
+				}
+			}
+			if (visible)
+			{
+				// LOD selection by using the camera distance to the bounding box center
+				const Mesh& mesh = meshes[instance.meshIndex];
+				const float distance = glm::length(cameraRelativeCenter);
+				uint32_t lodIndex = 0;
+				while (lodIndex + 1 < mesh.numberOfLods && distance > mesh.maximumLodDistance[lodIndex])
+				{
+					++lodIndex;
+				}
+
+				// Write the compacted draw arguments
+				drawIndexedArguments[numberOfDraws] = Rhi::DrawIndexedArguments(mesh.indexCountPerInstance[lodIndex], 1, mesh.startIndexLocation[lodIndex], mesh.baseVertexLocation[lodIndex], instance.startInstanceLocation);
+				++numberOfDraws;
+			}
+		}
+
+		// Done
+		return numberOfDraws;
+	}
+
+	bool GpuInstanceCuller::areDrawListsEquivalent(const Rhi::DrawIndexedArguments* firstDrawIndexedArguments, const Rhi::DrawIndexedArguments* secondDrawIndexedArguments, uint32_t numberOfDraws)
+	{
+		// Bring both draw lists into the same order
+		DrawIndexedArgumentsVector firstNonEmptyDrawIndexedArguments;
+		DrawIndexedArgumentsVector secondNonEmptyDrawIndexedArguments;
+		::detail::gatherNonEmptyDraws(firstDrawIndexedArguments, numberOfDraws, firstNonEmptyDrawIndexedArguments);
+		::detail::gatherNonEmptyDraws(secondDrawIndexedArguments, numberOfDraws, secondNonEmptyDrawIndexedArguments);
+		if (firstNonEmptyDrawIndexedArguments.size() != secondNonEmptyDrawIndexedArguments.size())
+		{
+			return false;
+		}
+
+		// Compare the draws
+		for (size_t i = 0; i < firstNonEmptyDrawIndexedArguments.size(); ++i)
+		{
+			if (::detail::isDrawIndexedArgumentsLess(firstNonEmptyDrawIndexedArguments[i], secondNonEmptyDrawIndexedArguments[i]) || ::detail::isDrawIndexedArgumentsLess(secondNonEmptyDrawIndexedArguments[i], firstNonEmptyDrawIndexedArguments[i]))
+			{
+				return false;
+			}
+		}
+
+		// Equivalent
+		return true;
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	GpuInstanceCuller::GpuInstanceCuller(const IRenderer& renderer, uint32_t maximumNumberOfInstances, uint32_t maximumNumberOfMeshes, bool forceCpuCulling) :
+		mRenderer(renderer),
+		mMaximumNumberOfInstances(maximumNumberOfInstances),
+		mMaximumNumberOfMeshes(maximumNumberOfMeshes),
+		mMeshesDirty(false),
+		mInstancesDirty(false),
+		mNumberOfDraws(0),
+		mCurrentCullPassIndex(0)
+	{
+		const Rhi::IRhi& rhi = renderer.getRhi();
+		const Rhi::Capabilities& capabilities = rhi.getCapabilities();
+
+		// Sanity checks
+		RHI_ASSERT(renderer.getContext(), maximumNumberOfInstances > 0, "The maximum number of GPU instance culler instances must not be zero")
+		RHI_ASSERT(renderer.getContext(), maximumNumberOfMeshes > 0, "The maximum number of GPU instance culler meshes must not be zero")
+		RHI_ASSERT(renderer.getContext(), sizeof(Rhi::DrawIndexedArguments) * maximumNumberOfInstances <= capabilities.maximumIndirectBufferSize, "The maximum number of GPU instance culler instances exceeds the maximum indirect buffer size")
+		mMeshes.reserve(maximumNumberOfMeshes);
+		mInstances.reserve(maximumNumberOfInstances);
+
+		// Use the compute shader path if possible
+		// -> Compute shader writes are synchronized with the following indirect draws via "Rhi::Command::ComputeBufferBarrier"
+		// -> Direct3D 12 structured buffers aren't implemented and the null RHI has no compute shaders doing actual work, so the CPU fallback is used instead
+		if (!forceCpuCulling && capabilities.computeShader && capabilities.maximumStructuredBufferSize > 0 && capabilities.maximumUniformBufferSize > 0 && (rhi.getNameId() == Rhi::NameId::VULKAN || rhi.getNameId() == Rhi::NameId::OPENGL || rhi.getNameId() == Rhi::NameId::DIRECT3D11))
+		{
+			createComputePipelineStates();
+		}
+
+		// Create the buffers
+		if (isGpuCulling())
+		{
+			// The meshes and instances are persistent and only uploaded again after they were changed
+			Rhi::IBufferManager& bufferManager = renderer.getBufferManager();
+			mMeshStructuredBuffer = bufferManager.createStructuredBuffer(static_cast<uint32_t>(sizeof(Mesh) * maximumNumberOfMeshes), nullptr, Rhi::BufferFlag::SHADER_RESOURCE, Rhi::BufferUsage::DYNAMIC_DRAW, sizeof(Mesh) RHI_RESOURCE_DEBUG_NAME("GPU instance culler meshes"));
+			mInstanceStructuredBuffer = bufferManager.createStructuredBuffer(static_cast<uint32_t>(sizeof(Instance) * maximumNumberOfInstances), nullptr, Rhi::BufferFlag::SHADER_RESOURCE, Rhi::BufferUsage::DYNAMIC_DRAW, sizeof(Instance) RHI_RESOURCE_DEBUG_NAME("GPU instance culler instances"));
+			mDrawCountStructuredBuffer = bufferManager.createStructuredBuffer(sizeof(uint32_t) * 4, nullptr, Rhi::BufferFlag::UNORDERED_ACCESS | Rhi::BufferFlag::SHADER_RESOURCE, Rhi::BufferUsage::STATIC_DRAW, sizeof(uint32_t) RHI_RESOURCE_DEBUG_NAME("GPU instance culler draw count"));
+		}
+		else
+		{
+			// The CPU fallback uploads the draw list of each culling
+			mCpuDrawIndexedArguments.resize(maximumNumberOfInstances, Rhi::DrawIndexedArguments(0));
+		}
+		addCullPass();
+	}
+
+	uint32_t GpuInstanceCuller::addMesh(const Mesh& mesh)
+	{
+		RHI_ASSERT(mRenderer.getContext(), mMeshes.size() < mMaximumNumberOfMeshes, "The maximum number of GPU instance culler meshes has been reached")
+		RHI_ASSERT(mRenderer.getContext(), mesh.numberOfLods > 0 && mesh.numberOfLods <= MAXIMUM_NUMBER_OF_LODS, "Invalid number of GPU instance culler mesh LODs")
+		mMeshes.push_back(mesh);
+		mMeshesDirty = true;
+		return static_cast<uint32_t>(mMeshes.size() - 1);
+	}
+
+	uint32_t GpuInstanceCuller::addInstance(const Instance& instance)
+	{
+		RHI_ASSERT(mRenderer.getContext(), mInstances.size() < mMaximumNumberOfInstances, "The maximum number of GPU instance culler instances has been reached")
+		RHI_ASSERT(mRenderer.getContext(), instance.meshIndex < mMeshes.size(), "Invalid GPU instance culler mesh index")
+		mInstances.push_back(instance);
+		mInstancesDirty = true;
+		return static_cast<uint32_t>(mInstances.size() - 1);
+	}
+
+	void GpuInstanceCuller::setInstance(uint32_t instanceIndex, const Instance& instance)
+	{
+		RHI_ASSERT(mRenderer.getContext(), instanceIndex < mInstances.size(), "Invalid GPU instance culler instance index")
+		RHI_ASSERT(mRenderer.getContext(), instance.meshIndex < mMeshes.size(), "Invalid GPU instance culler mesh index")
+		mInstances[instanceIndex] = instance;
+		mInstancesDirty = true;
+	}
+
+	void GpuInstanceCuller::clear()
+	{
+		mMeshes.clear();
+		mInstances.clear();
+		mMeshesDirty = mInstancesDirty = false;
+		mNumberOfDraws = 0;
+	}
+
+	bool GpuInstanceCuller::readBackDrawIndexedArguments(DrawIndexedArgumentsVector& drawIndexedArguments) const
+	{
+		drawIndexedArguments.resize(mNumberOfDraws, Rhi::DrawIndexedArguments(0));
+		if (0 == mNumberOfDraws)
+		{
+			// Nothing to read back
+			return true;
+		}
+		if (!isGpuCulling())
+		{
+			// The CPU fallback still has the uploaded draw list
+			memcpy(drawIndexedArguments.data(), mCpuDrawIndexedArguments.data(), sizeof(Rhi::DrawIndexedArguments) * mNumberOfDraws);
+			return true;
+		}
+
+		// Map the indirect buffer written by the compute shader for reading
+		Rhi::IRhi& rhi = mRenderer.getRhi();
+		Rhi::IIndirectBuffer& indirectBuffer = *getIndirectBufferPtr();
+		Rhi::MappedSubresource mappedSubresource;
+		if (rhi.map(indirectBuffer, 0, Rhi::MapType::READ, 0, mappedSubresource))
+		{
+			memcpy(drawIndexedArguments.data(), mappedSubresource.data, sizeof(Rhi::DrawIndexedArguments) * mNumberOfDraws);
+			rhi.unmap(indirectBuffer, 0);
+			return true;
+		}
+
+		// Error!
+		return false;
+	}
+
+	void GpuInstanceCuller::cull(const glm::mat4& cameraRelativeWorldSpaceToClipSpaceMatrix, const glm::vec3& worldSpaceCameraPosition, Rhi::CommandBuffer& commandBuffer)
+	{
+		RENDERER_SCOPED_PROFILER_EVENT(mRenderer.getContext(), commandBuffer, "GPU instance culler")
+		const uint32_t numberOfInstances = static_cast<uint32_t>(mInstances.size());
+		Rhi::IRhi& rhi = mRenderer.getRhi();
+		const CullPass& cullPass = getNextCullPass();
+		if (isGpuCulling())
+		{
+			// The GPU count can't be used to limit the number of draws, the draw arguments behind the visible instances are empty draws
+			mNumberOfDraws = numberOfInstances;
+			if (numberOfInstances > 0)
+			{
+				// Upload the persistent data which was changed since the last culling
+				if (mMeshesDirty)
+				{
+					uploadStructuredBuffer(*mMeshStructuredBuffer, mMeshes.data(), static_cast<uint32_t>(sizeof(Mesh) * mMeshes.size()));
+					mMeshesDirty = false;
+				}
+				if (mInstancesDirty)
+				{
+					uploadStructuredBuffer(*mInstanceStructuredBuffer, mInstances.data(), static_cast<uint32_t>(sizeof(Instance) * numberOfInstances));
+					mInstancesDirty = false;
+				}
+
+				{ // Update the uniform buffer
+					Rhi::MappedSubresource mappedSubresource;
+					if (rhi.map(*cullPass.uniformBuffer, 0, Rhi::MapType::WRITE_DISCARD, 0, mappedSubresource))
+					{
+						::detail::GpuInstanceCullerPassData* passData = static_cast<::detail::GpuInstanceCullerPassData*>(mappedSubresource.data);
+						passData->cameraRelativeWorldSpaceToClipSpaceMatrix = cameraRelativeWorldSpaceToClipSpaceMatrix;
+						passData->worldSpaceCameraPosition = glm::vec4(worldSpaceCameraPosition, 0.0f);
+						passData->numberOfInstances = glm::uvec4(numberOfInstances, 0, 0, 0);
+						rhi.unmap(*cullPass.uniformBuffer, 0);
+					}
+				}
+
+				// Record the compute pass: First clear the draw count and the draw arguments, then cull the instances and write the compacted draw arguments
+				// -> The barriers before the clearing let it wait for previous draws and cullings, the barriers between the dispatches order the clearing
+				//    before the culling and the final barriers make the draw list visible to the following indirect draws and other compute passes
+				const uint32_t numberOfThreadGroups = (numberOfInstances + NUMBER_OF_THREADS_PER_GROUP - 1) / NUMBER_OF_THREADS_PER_GROUP;
+				Rhi::Command::ComputeBufferBarrier::create(commandBuffer, *cullPass.indirectBuffer);
+				Rhi::Command::ComputeBufferBarrier::create(commandBuffer, *mDrawCountStructuredBuffer);
+				Rhi::Command::SetComputeRootSignature::create(commandBuffer, mRootSignature);
+				Rhi::Command::SetComputePipelineState::create(commandBuffer, mClearComputePipelineState);
+				Rhi::Command::SetComputeResourceGroup::create(commandBuffer, 0, cullPass.resourceGroup);
+				Rhi::Command::DispatchCompute::create(commandBuffer, numberOfThreadGroups, 1, 1);
+				Rhi::Command::ComputeBufferBarrier::create(commandBuffer, *cullPass.indirectBuffer);
+				Rhi::Command::ComputeBufferBarrier::create(commandBuffer, *mDrawCountStructuredBuffer);
+				Rhi::Command::SetComputePipelineState::create(commandBuffer, mCullComputePipelineState);
+				Rhi::Command::SetComputeResourceGroup::create(commandBuffer, 0, cullPass.resourceGroup);
+				Rhi::Command::DispatchCompute::create(commandBuffer, numberOfThreadGroups, 1, 1);
+				Rhi::Command::ComputeBufferBarrier::create(commandBuffer, *cullPass.indirectBuffer);
+				Rhi::Command::ComputeBufferBarrier::create(commandBuffer, *mDrawCountStructuredBuffer);
+			}
+		}
+		else
+		{
+			// CPU fallback: Cull into the CPU draw list and upload the compacted draw arguments
+			mNumberOfDraws = cullOnCpu(mMeshes, mInstances, cameraRelativeWorldSpaceToClipSpaceMatrix, worldSpaceCameraPosition, mCpuDrawIndexedArguments.data());
+			if (mNumberOfDraws > 0)
+			{
+				Rhi::MappedSubresource mappedSubresource;
+				if (rhi.map(*cullPass.indirectBuffer, 0, Rhi::MapType::WRITE_DISCARD, 0, mappedSubresource))
+				{
+					memcpy(mappedSubresource.data, mCpuDrawIndexedArguments.data(), sizeof(Rhi::DrawIndexedArguments) * mNumberOfDraws);
+					rhi.unmap(*cullPass.indirectBuffer, 0);
+				}
+			}
+		}
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	void GpuInstanceCuller::createComputePipelineStates()
+	{
+		Rhi::IRhi& rhi = mRenderer.getRhi();
+
+		{ // Create the root signature instance
+			// Vulkan and OpenGL are using a single binding namespace, the unordered access views are placed behind the shader resource views
+			const bool singleBindingNamespace = (rhi.getNameId() == Rhi::NameId::VULKAN || rhi.getNameId() == Rhi::NameId::OPENGL);
+			const uint32_t shaderResourceViewOffset = singleBindingNamespace ? 1u : 0u;
+			const uint32_t unorderedAccessViewOffset = singleBindingNamespace ? 3u : 0u;
+			Rhi::DescriptorRangeBuilder ranges[5];
+			ranges[0].initialize(Rhi::ResourceType::UNIFORM_BUFFER,	   0,							   "PassUniformBuffer",			 Rhi::ShaderVisibility::COMPUTE);
+			ranges[1].initialize(Rhi::ResourceType::STRUCTURED_BUFFER, 0u + shaderResourceViewOffset,  "InstanceStructuredBuffer",	 Rhi::ShaderVisibility::COMPUTE);
+			ranges[2].initialize(Rhi::ResourceType::STRUCTURED_BUFFER, 1u + shaderResourceViewOffset,  "MeshStructuredBuffer",		 Rhi::ShaderVisibility::COMPUTE);
+			ranges[3].initialize(Rhi::ResourceType::INDIRECT_BUFFER,   0u + unorderedAccessViewOffset, "DrawIndexedArgumentsBuffer", Rhi::ShaderVisibility::COMPUTE, Rhi::DescriptorRangeType::UAV);
+			ranges[4].initialize(Rhi::ResourceType::STRUCTURED_BUFFER, 1u + unorderedAccessViewOffset, "DrawCountStructuredBuffer",	 Rhi::ShaderVisibility::COMPUTE, Rhi::DescriptorRangeType::UAV);
+
+			Rhi::RootParameterBuilder rootParameters[1];
+			rootParameters[0].initializeAsDescriptorTable(static_cast<uint32_t>(GLM_COUNTOF(ranges)), &ranges[0]);
+
+			// Setup
+			Rhi::RootSignatureBuilder rootSignatureBuilder;
+			rootSignatureBuilder.initialize(static_cast<uint32_t>(GLM_COUNTOF(rootParameters)), rootParameters, 0, nullptr, Rhi::RootSignatureFlags::NONE);
+
+			// Create the instance
+			mRootSignature = rhi.createRootSignature(rootSignatureBuilder RHI_RESOURCE_DEBUG_NAME("GPU instance culler"));
+		}
+
+		{ // Create the compute pipeline states
+			// Get the shader source code (outsourced to keep an overview)
+			const char* clearComputeShaderSourceCode = nullptr;
+			const char* cullComputeShaderSourceCode = nullptr;
+			#include "Detail/Shader/GpuInstanceCuller_GLSL_450.h"	// For Vulkan
+			#include "Detail/Shader/GpuInstanceCuller_GLSL_430.h"	// OpenGL 4.3 is the minimum for compute shaders
+			#include "Detail/Shader/GpuInstanceCuller_HLSL_D3D11.h"
+			{
+				// Error! (unsupported RHI)
+				RHI_LOG(mRenderer.getContext(), CRITICAL, "The RHI implementation \"%s\" isn't supported by the GPU instance culler", rhi.getName())
+			}
+
+			// Create the compute shaders and the compute pipeline states
+			if (nullptr != mRootSignature && nullptr != clearComputeShaderSourceCode && nullptr != cullComputeShaderSourceCode)
+			{
+				Rhi::IShaderLanguage& shaderLanguage = rhi.getDefaultShaderLanguage();
+				Rhi::IComputeShaderPtr clearComputeShader(shaderLanguage.createComputeShaderFromSourceCode(clearComputeShaderSourceCode, nullptr RHI_RESOURCE_DEBUG_NAME("GPU instance culler clear")));
+				Rhi::IComputeShaderPtr cullComputeShader(shaderLanguage.createComputeShaderFromSourceCode(cullComputeShaderSourceCode, nullptr RHI_RESOURCE_DEBUG_NAME("GPU instance culler cull")));
+				if (nullptr != clearComputeShader && nullptr != cullComputeShader)
+				{
+					mClearComputePipelineState = rhi.createComputePipelineState(*mRootSignature, *clearComputeShader RHI_RESOURCE_DEBUG_NAME("GPU instance culler clear"));
+					mCullComputePipelineState = rhi.createComputePipelineState(*mRootSignature, *cullComputeShader RHI_RESOURCE_DEBUG_NAME("GPU instance culler cull"));
+				}
+			}
+		}
+
+		// Fall back to the CPU in case something went wrong
+		if (nullptr == mClearComputePipelineState || nullptr == mCullComputePipelineState)
+		{
+			RHI_LOG(mRenderer.getContext(), COMPATIBILITY_WARNING, "Failed to create the GPU instance culler compute pipeline states, using the CPU fallback instead")
+			mClearComputePipelineState = nullptr;
+			mCullComputePipelineState = nullptr;
+			mRootSignature = nullptr;
+		}
+	}
+
+	void GpuInstanceCuller::addCullPass()
+	{
+		Rhi::IBufferManager& bufferManager = mRenderer.getBufferManager();
+		const uint32_t numberOfIndirectBufferBytes = static_cast<uint32_t>(sizeof(Rhi::DrawIndexedArguments) * mMaximumNumberOfInstances);
+		CullPass& cullPass = mCullPasses.emplace_back();
+		if (isGpuCulling())
+		{
+			cullPass.indirectBuffer = bufferManager.createIndirectBuffer(numberOfIndirectBufferBytes, nullptr, Rhi::IndirectBufferFlag::UNORDERED_ACCESS | Rhi::IndirectBufferFlag::DRAW_INDEXED_ARGUMENTS, Rhi::BufferUsage::STATIC_DRAW RHI_RESOURCE_DEBUG_NAME("GPU instance culler"));
+			cullPass.uniformBuffer = bufferManager.createUniformBuffer(sizeof(::detail::GpuInstanceCullerPassData), nullptr, Rhi::BufferUsage::DYNAMIC_DRAW RHI_RESOURCE_DEBUG_NAME("GPU instance culler"));
+
+			{ // Create the resource group, same order as the root signature descriptor ranges
+				Rhi::IResource* resources[5] = { cullPass.uniformBuffer, mInstanceStructuredBuffer, mMeshStructuredBuffer, cullPass.indirectBuffer, mDrawCountStructuredBuffer };
+				cullPass.resourceGroup = mRootSignature->createResourceGroup(0, static_cast<uint32_t>(GLM_COUNTOF(resources)), resources, nullptr RHI_RESOURCE_DEBUG_NAME("GPU instance culler"));
+			}
+		}
+		else
+		{
+			cullPass.indirectBuffer = bufferManager.createIndirectBuffer(numberOfIndirectBufferBytes, nullptr, Rhi::IndirectBufferFlag::DRAW_INDEXED_ARGUMENTS, Rhi::BufferUsage::DYNAMIC_DRAW RHI_RESOURCE_DEBUG_NAME("GPU instance culler"));
+		}
+	}
+
+	GpuInstanceCuller::CullPass& GpuInstanceCuller::getNextCullPass()
+	{
+		// Each culling inside one command buffer execution needs its own buffers since they're filled while recording the command buffer
+		if (mCurrentCullPassIndex >= mCullPasses.size())
+		{
+			addCullPass();
+		}
+		++mCurrentCullPassIndex;
+		return mCullPasses[mCurrentCullPassIndex - 1];
+	}
+
+	void GpuInstanceCuller::uploadStructuredBuffer(Rhi::IStructuredBuffer& structuredBuffer, const void* data, uint32_t numberOfBytes)
+	{
+		Rhi::IRhi& rhi = mRenderer.getRhi();
+		Rhi::MappedSubresource mappedSubresource;
+		if (rhi.map(structuredBuffer, 0, Rhi::MapType::WRITE_DISCARD, 0, mappedSubresource))
+		{
+			memcpy(mappedSubresource.data, data, numberOfBytes);
+			rhi.unmap(structuredBuffer, 0);
+		}
+	}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // Renderer
@@ -0,0 +1,443 @@
+/*********************************************************\
+ * Copyright (c) 2012-2020 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Renderer/Public/Core/Manager.h"
+
+#include <Rhi/Public/Rhi.h>
+
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4201)	// warning C4201: nonstandard extension used: nameless struct/union
+	PRAGMA_WARNING_DISABLE_MSVC(4464)	// warning C4464: relative include path contains '..'
+	PRAGMA_WARNING_DISABLE_MSVC(4324)	// warning C4324: '<x>': structure was padded due to alignment specifier
+	#include <glm/glm.hpp>
+PRAGMA_WARNING_POP
+
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4365)	// warning C4365: 'argument': conversion from 'long' to 'unsigned int', signed/unsigned mismatch
+	PRAGMA_WARNING_DISABLE_MSVC(4571)	// warning C4571: Informational: catch(...) semantics changed since Visual C++ 7.1; structured exceptions (SEH) are no longer caught
+	PRAGMA_WARNING_DISABLE_MSVC(4625)	// warning C4625: 'std::codecvt_base': copy constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4626)	// warning C4626: 'std::codecvt_base': assignment operator was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4668)	// warning C4668: '_M_HYBRID_X86_ARM64' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
+	PRAGMA_WARNING_DISABLE_MSVC(4774)	// warning C4774: 'sprintf_s' : format string expected in argument 3 is not a string literal
+	#include <vector>
+PRAGMA_WARNING_POP
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+	class IRenderer;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Classes                                               ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    GPU instance culler generating compacted indirect draw arguments
+	*
+	*  @remarks
+	*    GPU driven alternative to filling indirect buffers on the CPU for huge numbers of instances. The workflow is:
+	*    - Register the meshes including their LODs as well as the instances once, the data is kept persistently inside structured buffers and only uploaded again after it was changed
+	*    - Call "Renderer::GpuInstanceCuller::cull()" per camera to record a compute pass doing frustum culling plus LOD selection for all instances
+	*    - The compute pass writes one compacted "Rhi::DrawIndexedArguments" per visible instance into an indirect buffer and counts the draws inside a structured buffer
+	*    - Consume the indirect buffer via multi-draw-indirect, usually by setting the GPU instance culler to a renderable (see "Renderer::Renderable::setGpuInstanceCuller()")
+	*      in which case the render queue takes care of the culling
+	*    - Call "Renderer::GpuInstanceCuller::onPostCommandBufferExecution()" after the command buffer was executed
+	*
+	*    The RHI has no draw-indirect-count command, so the GPU count can't limit the number of draws directly. Instead, the draw arguments behind the
+	*    visible instances are cleared to zero by the compute pass as well, resulting in empty draws. The GPU count is still available for other compute
+	*    passes. Compute shader writes are synchronized with the following indirect draws via "Rhi::Command::ComputeBufferBarrier". If compute shaders
+	*    aren't available or the RHI can't be used (Direct3D 12 structured buffers aren't implemented, the null RHI does no actual work), a CPU fallback
+	*    producing the same draw list is used instead.
+	*
+	*  @note
+	*    - All meshes must share the vertex and index buffer bound by the consumer, the mesh LODs are addressed by index and vertex offsets
+	*    - Each instance results in a single draw with an instance count of one, the start instance location can be used to fetch per instance data
+	*    - The draw order of the GPU path depends on the compute shader execution order, only the CPU fallback is guaranteed to keep the instance order
+	*/
+	class GpuInstanceCuller final : private Manager
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Public definitions                                    ]
+	//[-------------------------------------------------------]
+	public:
+		static constexpr uint32_t MAXIMUM_NUMBER_OF_LODS	  = 4;
+		static constexpr uint32_t NUMBER_OF_THREADS_PER_GROUP = 64;	///< Must match the compute shader work group size
+
+		/**
+		*  @brief
+		*    Mesh with its LODs, same memory layout as inside the compute shader
+		*/
+		struct Mesh final
+		{
+			uint32_t indexCountPerInstance[MAXIMUM_NUMBER_OF_LODS];	///< Number of indices per LOD
+			uint32_t startIndexLocation[MAXIMUM_NUMBER_OF_LODS];	///< Start index location per LOD
+			int32_t  baseVertexLocation[MAXIMUM_NUMBER_OF_LODS];	///< Base vertex location per LOD
+			float	 maximumLodDistance[MAXIMUM_NUMBER_OF_LODS];	///< Maximum camera distance in world units per LOD, the last LOD is used beyond the maximum distance of the second last LOD
+			uint32_t numberOfLods;									///< Number of valid LODs, must be between one and "Renderer::GpuInstanceCuller::MAXIMUM_NUMBER_OF_LODS"
+			uint32_t padding[3];
+		};
+		typedef std::vector<Mesh> Meshes;
+
+		/**
+		*  @brief
+		*    Instance, same memory layout as inside the compute shader
+		*/
+		struct Instance final
+		{
+			float	 objectSpaceToWorldSpace[3][4];	///< Rows of the 32 bit object space to world space matrix, the translation is inside the fourth column
+			float	 minimum[3];					///< Object space bounding box minimum
+			uint32_t meshIndex;						///< Index of the mesh, see "Renderer::GpuInstanceCuller::addMesh()"
+			float	 maximum[3];					///< Object space bounding box maximum
+			uint32_t startInstanceLocation;			///< Start instance location of the draw, e.g. used to fetch per instance data
+
+			inline Instance()
+			{
+				// Nothing here
+			}
+
+			inline Instance(const glm::mat4& _objectSpaceToWorldSpace, const glm::vec3& _minimum, const glm::vec3& _maximum, uint32_t _meshIndex, uint32_t _startInstanceLocation) :
+				meshIndex(_meshIndex),
+				startInstanceLocation(_startInstanceLocation)
+			{
+				for (int row = 0; row < 3; ++row)
+				{
+					for (int column = 0; column < 4; ++column)
+					{
+						objectSpaceToWorldSpace[row][column] = _objectSpaceToWorldSpace[column][row];
+					}
+					minimum[row] = _minimum[row];
+					maximum[row] = _maximum[row];
+				}
+			}
+		};
+		typedef std::vector<Instance> Instances;
+		typedef std::vector<Rhi::DrawIndexedArguments> DrawIndexedArgumentsVector;
+
+		/**
+		*  @brief
+		*    Per culling data, each culling inside one command buffer execution needs its own data since buffers are filled while recording
+		*/
+		struct CullPass final
+		{
+			Rhi::IIndirectBufferPtr	indirectBuffer;	///< Receives the draw list
+			Rhi::IUniformBufferPtr	uniformBuffer;	///< Camera data, GPU path only
+			Rhi::IResourceGroupPtr	resourceGroup;	///< GPU path only
+		};
+		typedef std::vector<CullPass> CullPasses;
+
+
+	//[-------------------------------------------------------]
+	//[ Public static methods                                 ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Cull the instances on the CPU, this is the reference implementation of the compute shader
+		*
+		*  @param[in] meshes
+		*    Meshes
+		*  @param[in] instances
+		*    Instances
+		*  @param[in] cameraRelativeWorldSpaceToClipSpaceMatrix
+		*    Camera relative world space to clip space matrix
+		*  @param[in] worldSpaceCameraPosition
+		*    32 bit world space camera position
+		*  @param[out] drawIndexedArguments
+		*    Receives the compacted draw arguments of the visible instances in instance order, must be valid for at least the number of instances
+		*
+		*  @return
+		*    The number of visible instances
+		*/
+		RENDERER_API_EXPORT static uint32_t cullOnCpu(const Meshes& meshes, const Instances& instances, const glm::mat4& cameraRelativeWorldSpaceToClipSpaceMatrix, const glm::vec3& worldSpaceCameraPosition, Rhi::DrawIndexedArguments* drawIndexedArguments);
+
+		/**
+		*  @brief
+		*    Check whether or not two draw lists are equivalent
+		*
+		*  @param[in] firstDrawIndexedArguments
+		*    First draw list
+		*  @param[in] secondDrawIndexedArguments
+		*    Second draw list
+		*  @param[in] numberOfDraws
+		*    Number of draws inside both draw lists
+		*
+		*  @return
+		*    "true" if both draw lists contain the same draws independent of their order, else "false"
+		*
+		*  @note
+		*    - Used to validate the GPU path against the CPU fallback, the GPU path draw order isn't deterministic
+		*    - Empty draws are ignored, this way the cleared draw arguments of the GPU path behind the visible instances don't matter
+		*/
+		[[nodiscard]] RENDERER_API_EXPORT static bool areDrawListsEquivalent(const Rhi::DrawIndexedArguments* firstDrawIndexedArguments, const Rhi::DrawIndexedArguments* secondDrawIndexedArguments, uint32_t numberOfDraws);
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Constructor
+		*
+		*  @param[in] renderer
+		*    Renderer instance to use, must stay valid as long as the GPU instance culler instance exists
+		*  @param[in] maximumNumberOfInstances
+		*    Maximum number of instances
+		*  @param[in] maximumNumberOfMeshes
+		*    Maximum number of meshes
+		*  @param[in] forceCpuCulling
+		*    Use the CPU fallback even if compute shaders are available, e.g. for validation
+		*/
+		GpuInstanceCuller(const IRenderer& renderer, uint32_t maximumNumberOfInstances, uint32_t maximumNumberOfMeshes, bool forceCpuCulling = false);
+
+		inline ~GpuInstanceCuller()
+		{
+			// Nothing here
+		}
+
+		/**
+		*  @brief
+		*    Return whether or not the compute shader path is used
+		*
+		*  @return
+		*    "true" if the instances are culled on the GPU, "false" if the CPU fallback is used
+		*/
+		[[nodiscard]] inline bool isGpuCulling() const
+		{
+			return (nullptr != mCullComputePipelineState);
+		}
+
+		[[nodiscard]] inline uint32_t getMaximumNumberOfInstances() const
+		{
+			return mMaximumNumberOfInstances;
+		}
+
+		[[nodiscard]] inline const Meshes& getMeshes() const
+		{
+			return mMeshes;
+		}
+
+		[[nodiscard]] inline const Instances& getInstances() const
+		{
+			return mInstances;
+		}
+
+		/**
+		*  @brief
+		*    Add a mesh
+		*
+		*  @param[in] mesh
+		*    Mesh to add
+		*
+		*  @return
+		*    The mesh index to use inside instances
+		*/
+		uint32_t addMesh(const Mesh& mesh);
+
+		/**
+		*  @brief
+		*    Add an instance
+		*
+		*  @param[in] instance
+		*    Instance to add
+		*
+		*  @return
+		*    The instance index
+		*/
+		uint32_t addInstance(const Instance& instance);
+
+		/**
+		*  @brief
+		*    Change an instance, e.g. after it was moved
+		*
+		*  @param[in] instanceIndex
+		*    Index of the instance to change
+		*  @param[in] instance
+		*    New instance data
+		*/
+		void setInstance(uint32_t instanceIndex, const Instance& instance);
+
+		/**
+		*  @brief
+		*    Remove all meshes and instances
+		*/
+		void clear();
+
+		/**
+		*  @brief
+		*    Cull the instances and generate the draw list
+		*
+		*  @param[in] cameraRelativeWorldSpaceToClipSpaceMatrix
+		*    Camera relative world space to clip space matrix
+		*  @param[in] worldSpaceCameraPosition
+		*    32 bit world space camera position
+		*  @param[out] commandBuffer
+		*    Command buffer to fill with the compute pass, unused by the CPU fallback
+		*
+		*  @note
+		*    - Call this method before the draw list is consumed, each call inside one command buffer execution gets its own indirect buffer so several cameras can be culled
+		*    - Vulkan can't record compute work inside a render pass: Either record the compute pass before the graphics render target is set or after the render target was set
+		*      but before anything was drawn into it (Vulkan render passes begin lazily at the first draw call)
+		*/
+		void cull(const glm::mat4& cameraRelativeWorldSpaceToClipSpaceMatrix, const glm::vec3& worldSpaceCameraPosition, Rhi::CommandBuffer& commandBuffer);
+
+		/**
+		*  @brief
+		*    Called post command buffer execution, the per culling data can be reused afterwards
+		*/
+		inline void onPostCommandBufferExecution()
+		{
+			mCurrentCullPassIndex = 0;
+		}
+
+		/**
+		*  @brief
+		*    Return the indirect buffer containing the draw list of the last culling
+		*
+		*  @return
+		*    The indirect buffer containing "Rhi::DrawIndexedArguments", the indirect buffer instance changes with the culling, so don't keep it around
+		*/
+		[[nodiscard]] inline const Rhi::IIndirectBufferPtr& getIndirectBufferPtr() const
+		{
+			return mCullPasses[(mCurrentCullPassIndex > 0) ? mCurrentCullPassIndex - 1 : 0].indirectBuffer;
+		}
+
+		/**
+		*  @brief
+		*    Return the number of draws to use when consuming the draw list of the last culling
+		*
+		*  @return
+		*    The number of visible instances for the CPU fallback, the number of instances for the GPU path since the GPU count can't be read back without stalling
+		*/
+		[[nodiscard]] inline uint32_t getNumberOfDraws() const
+		{
+			return mNumberOfDraws;
+		}
+
+		/**
+		*  @brief
+		*    Return the structured buffer containing the GPU count
+		*
+		*  @return
+		*    The structured buffer containing the number of visible instances as first 32 bit unsigned integer, null pointer if the CPU fallback is used
+		*/
+		[[nodiscard]] inline const Rhi::IStructuredBufferPtr& getDrawCountStructuredBufferPtr() const
+		{
+			return mDrawCountStructuredBuffer;
+		}
+
+		/**
+		*  @brief
+		*    Return the draw list of the last culling done by the CPU fallback
+		*
+		*  @return
+		*    The draw list of the last culling, only the first "Renderer::GpuInstanceCuller::getNumberOfDraws()" entries are valid, empty if the GPU path is used
+		*/
+		[[nodiscard]] inline const DrawIndexedArgumentsVector& getCpuDrawIndexedArguments() const
+		{
+			return mCpuDrawIndexedArguments;
+		}
+
+		/**
+		*  @brief
+		*    Read back the draw list of the last culling
+		*
+		*  @param[out] drawIndexedArguments
+		*    Receives the "Renderer::GpuInstanceCuller::getNumberOfDraws()" draw arguments of the last culling
+		*
+		*  @return
+		*    "true" if all went fine, else "false"
+		*
+		*  @note
+		*    - The GPU path maps the indirect buffer for reading, so the command buffer containing the culling must have been executed and finished on the GPU (see "Rhi::IRhi::finish()")
+		*    - Stalls the GPU, only meant for validation
+		*/
+		[[nodiscard]] RENDERER_API_EXPORT bool readBackDrawIndexedArguments(DrawIndexedArgumentsVector& drawIndexedArguments) const;
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		explicit GpuInstanceCuller(const GpuInstanceCuller&) = delete;
+		GpuInstanceCuller& operator=(const GpuInstanceCuller&) = delete;
+		void createComputePipelineStates();
+		void addCullPass();
+		[[nodiscard]] CullPass& getNextCullPass();
+		void uploadStructuredBuffer(Rhi::IStructuredBuffer& structuredBuffer, const void* data, uint32_t numberOfBytes);
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		const IRenderer&			  mRenderer;
+		uint32_t					  mMaximumNumberOfInstances;
+		uint32_t					  mMaximumNumberOfMeshes;
+		Meshes						  mMeshes;
+		Instances					  mInstances;
+		bool						  mMeshesDirty;						///< "true" if the meshes need to be uploaded again, GPU path only
+		bool						  mInstancesDirty;					///< "true" if the instances need to be uploaded again, GPU path only
+		uint32_t					  mNumberOfDraws;
+		CullPasses					  mCullPasses;						///< Grows on demand, there's always at least one entry
+		uint32_t					  mCurrentCullPassIndex;			///< Index of the next cull pass to use, reset by "Renderer::GpuInstanceCuller::onPostCommandBufferExecution()"
+		// CPU fallback only
+		DrawIndexedArgumentsVector	  mCpuDrawIndexedArguments;
+		// GPU path only
+		Rhi::IRootSignaturePtr		  mRootSignature;
+		Rhi::IComputePipelineStatePtr mClearComputePipelineState;		///< Clears the draw count and the draw arguments
+		Rhi::IComputePipelineStatePtr mCullComputePipelineState;		///< Culls the instances and writes the compacted draw arguments
+		Rhi::IStructuredBufferPtr	  mMeshStructuredBuffer;
+		Rhi::IStructuredBufferPtr	  mInstanceStructuredBuffer;
+		Rhi::IStructuredBufferPtr	  mDrawCountStructuredBuffer;
+
+
+	};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // Renderer
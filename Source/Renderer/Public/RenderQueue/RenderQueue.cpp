@@ -23,7 +23,9 @@
 //[-------------------------------------------------------]
 #include "Renderer/Public/RenderQueue/RenderQueue.h"
 #include "Renderer/Public/RenderQueue/RenderableManager.h"
+#include "Renderer/Public/RenderQueue/GpuInstanceCuller.h"
 #include "Renderer/Public/Resource/CompositorWorkspace/CompositorContextData.h"
+#include "Renderer/Public/Resource/Scene/Item/Camera/CameraSceneItem.h"
 #include "Renderer/Public/Resource/Texture/TextureResource.h"
 #include "Renderer/Public/Resource/Texture/TextureResourceManager.h"
 #include "Renderer/Public/Resource/Mesh/MeshResourceManager.h"
@@ -40,6 +42,13 @@
 #include "Renderer/Public/Resource/MaterialBlueprint/BufferManager/TextureInstanceBufferManager.h"
 #include "Renderer/Public/Core/IProfiler.h"
 #include "Renderer/Public/Core/Math/Transform.h"
+#include "Renderer/Public/Core/Math/Math.h"
+
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4464)	// warning C4464: relative include path contains '..'
+	#include <glm/gtc/matrix_transform.hpp>
+PRAGMA_WARNING_POP
 
 #include <array>
 #include <algorithm>
@@ -210,6 +219,12 @@ namespace
 				static constexpr uint32_t SINGLE_PASS_STEREO_INSTANCING = STRING_ID("SinglePassStereoInstancing");
 				scratchOptimizedShaderProperties.setPropertyValue(SINGLE_PASS_STEREO_INSTANCING, 1);
 			}
+
+			// Automatic build-in "UseQuantizedVertices"-property setting, selects the quantized vertex attributes of the material blueprint
+			if (renderable.hasQuantizedVertices())
+			{
+				scratchOptimizedShaderProperties.setPropertyValue(Renderer::MaterialBlueprintResource::USE_QUANTIZED_VERTICES, 1);
+			}
 		}
 
 
@@ -259,6 +274,19 @@ namespace Renderer
 		}
 	}
 
+	void RenderQueue::onPostCommandBufferExecution()
+	{
+		// Directly clear the render queue as soon as the frame rendering has been finished to avoid evil dangling pointers
+		clear();
+
+		// The GPU instance cullers can reuse their per culling data now
+		for (GpuInstanceCuller* gpuInstanceCuller : mUsedGpuInstanceCullers)
+		{
+			gpuInstanceCuller->onPostCommandBufferExecution();
+		}
+		mUsedGpuInstanceCullers.clear();
+	}
+
 	void RenderQueue::addRenderablesFromRenderableManager(const RenderableManager& renderableManager, MaterialTechniqueId materialTechniqueId, const CompositorContextData& compositorContextData, bool castShadows)
 	{
 		// Sanity check
@@ -297,6 +325,9 @@ namespace Renderer
 			lodIndex = static_cast<uint8_t>(static_cast<int>(numberOfLods) - 1);
 		}
 
+		// Texture streaming feedback is only provided by visible renderables and not by shadow casters
+		const float screenSpaceSize = castShadows ? 0.0f : renderableManager.getCachedScreenSpaceSize();
+
 		// Register the renderables inside our renderables queue
 		const MaterialResourceManager& materialResourceManager = mRenderer.getMaterialResourceManager();
 		const MaterialBlueprintResourceManager& materialBlueprintResourceManager = mRenderer.getMaterialBlueprintResourceManager();
@@ -326,6 +357,12 @@ namespace Renderer
 							MaterialBlueprintResource* materialBlueprintResource = materialBlueprintResourceManager.tryGetById(materialTechnique->getMaterialBlueprintResourceId());
 							if (nullptr != materialBlueprintResource && IResource::LoadingState::LOADED == materialBlueprintResource->getLoadingState())
 							{
+								// Texture streaming feedback
+								if (screenSpaceSize > 0.0f)
+								{
+									materialTechnique->setTextureStreamingFeedback(mRenderer, screenSpaceSize);
+								}
+
 								// Get the pipeline state object (PSO) to use, preferably by using cached information
 								Rhi::IPipelineState* foundPipelineState = nullptr;
 								if (isValid(materialBlueprintResource->getComputeShaderBlueprintResourceId()))
@@ -377,6 +414,12 @@ namespace Renderer
 										}
 									}
 								}
+								else if (renderable.hasQuantizedVertices() && isInvalid(materialBlueprintResource->getQuantizedVertexAttributesResourceId()))
+								{
+									// The vertex data doesn't match the vertex attributes of the material blueprint, the mesh was compiled using "QuantizeVertices" but the material blueprint has no "QuantizedVertexAttributes"
+									// -> Drawing the renderable would read the vertex data using the wrong layout, so skip it
+									materialBlueprintResource->logMissingQuantizedVertexAttributesOnce();
+								}
 								else
 								{
 									// Graphics material blueprint resource
@@ -497,8 +540,14 @@ namespace Renderer
 
 		// No combined scoped profiler CPU and GPU sample as well as renderer debug event command by intent, this is something the caller has to take care of
 		// RENDERER_SCOPED_PROFILER_EVENT(mRenderer.getContext(), commandBuffer, "Graphics render queue")
+		RENDERER_PROFILER_SCOPED_CPU_SAMPLE(mRenderer.getContext(), "Render queue")
 
-		// TODO(co) This is just a dummy implementation. For example automatic instancing has to be incorporated as well as more efficient buffer management.
+		// Huge numbers of instances are drawn GPU driven: Renderables with a GPU instance culler get their instances culled by a compute pass
+		// which writes the indirect draw list, everything else is gathered on the CPU into the managed indirect buffer below
+		// -> Recorded before anything is drawn since Vulkan can't record compute work inside a render pass, which begins lazily at the first draw call
+		cullGpuInstances(renderTarget, compositorContextData, commandBuffer);
+
+		// Get the buffer managers
 		const MaterialBlueprintResourceManager& materialBlueprintResourceManager = mRenderer.getMaterialBlueprintResourceManager();
 		UniformInstanceBufferManager& uniformInstanceBufferManager = materialBlueprintResourceManager.getUniformInstanceBufferManager();
 		TextureInstanceBufferManager& textureInstanceBufferManager = materialBlueprintResourceManager.getTextureInstanceBufferManager();
@@ -573,7 +622,28 @@ namespace Renderer
 
 			// Render the specified geometric primitive, based on indexing into an array of vertices
 			// -> Please note that it's valid that there are no indices, for example "Renderer::CompositorInstancePassDebugGui" is using the render queue only to set the material resource blueprint
-			if (0 != renderable.getNumberOfIndices())
+			const GpuInstanceCuller* gpuInstanceCuller = renderable.getGpuInstanceCuller();
+			if (nullptr != gpuInstanceCuller)
+			{
+				// Use the draw list generated by the GPU instance culler
+				if (gpuInstanceCuller->getNumberOfDraws() > 0)
+				{
+					Rhi::Command::DrawIndexedGraphics::create(commandBuffer, *gpuInstanceCuller->getIndirectBufferPtr(), 0, gpuInstanceCuller->getNumberOfDraws());
+				}
+			}
+			else if (nullptr != renderable.getIndirectBufferPtr())
+			{
+				// Use a given indirect buffer which content is e.g. filled by a compute shader
+				if (renderable.getDrawIndexed())
+				{
+					Rhi::Command::DrawIndexedGraphics::create(commandBuffer, *renderable.getIndirectBufferPtr(), renderable.getIndirectBufferOffset(), renderable.getNumberOfDraws());
+				}
+				else
+				{
+					Rhi::Command::DrawGraphics::create(commandBuffer, *renderable.getIndirectBufferPtr(), renderable.getIndirectBufferOffset(), renderable.getNumberOfDraws());
+				}
+			}
+			else if (0 != renderable.getNumberOfIndices())
 			{
 				// Fill indirect buffer
 				if (renderable.getDrawIndexed())
@@ -733,7 +803,8 @@ namespace Renderer
 						}
 
 						// Emit draw command, if necessary
-						const Rhi::IIndirectBufferPtr& renderableIndirectBufferPtr = renderable.getIndirectBufferPtr();
+						const GpuInstanceCuller* gpuInstanceCuller = renderable.getGpuInstanceCuller();
+						const Rhi::IIndirectBufferPtr& renderableIndirectBufferPtr = (nullptr != gpuInstanceCuller) ? gpuInstanceCuller->getIndirectBufferPtr() : renderable.getIndirectBufferPtr();
 						if (renderable.getDrawIndexed() != currentDrawIndexed || !mScratchCommandBuffer.isEmpty() || nullptr != renderableIndirectBufferPtr)
 						{
 							if (currentDrawIndexed)
@@ -759,7 +830,15 @@ namespace Renderer
 						}
 
 						// Render the specified geometric primitive, based on indexing into an array of vertices
-						if (nullptr != renderableIndirectBufferPtr)
+						if (nullptr != gpuInstanceCuller)
+						{
+							// Use the draw list generated by the GPU instance culler
+							if (gpuInstanceCuller->getNumberOfDraws() > 0)
+							{
+								Rhi::Command::DrawIndexedGraphics::create(commandBuffer, *renderableIndirectBufferPtr, 0, gpuInstanceCuller->getNumberOfDraws());
+							}
+						}
+						else if (nullptr != renderableIndirectBufferPtr)
 						{
 							// Use a given indirect buffer which content is e.g. filled by a compute shader
 							if (renderable.getDrawIndexed())
@@ -827,6 +906,51 @@ namespace Renderer
 		}
 	}
 
+	void RenderQueue::cullGpuInstances(const Rhi::IRenderTarget& renderTarget, const CompositorContextData& compositorContextData, Rhi::CommandBuffer& commandBuffer)
+	{
+		// Gather the GPU instance cullers of the queued renderables, multiple renderables can share one GPU instance culler which is culled only once
+		mScratchGpuInstanceCullers.clear();
+		for (const Queue& queue : mQueues)
+		{
+			for (const QueuedRenderable& queuedRenderable : queue.queuedRenderables)
+			{
+				GpuInstanceCuller* gpuInstanceCuller = queuedRenderable.renderable->getGpuInstanceCuller();
+				if (nullptr != gpuInstanceCuller && std::find(mScratchGpuInstanceCullers.cbegin(), mScratchGpuInstanceCullers.cend(), gpuInstanceCuller) == mScratchGpuInstanceCullers.cend())
+				{
+					RHI_ASSERT(mRenderer.getContext(), queuedRenderable.renderable->getDrawIndexed(), "Renderables using a GPU instance culler must be drawn indexed")
+					mScratchGpuInstanceCullers.push_back(gpuInstanceCuller);
+				}
+			}
+		}
+		if (mScratchGpuInstanceCullers.empty())
+		{
+			// Nothing to do in here
+			return;
+		}
+		RHI_ASSERT(mRenderer.getContext(), !compositorContextData.getSinglePassStereoInstancing(), "Single pass stereo instancing isn't supported by GPU instance cullers since they draw each instance once")
+
+		// Get the camera relative world space to clip space matrix, same as done by "Renderer::MaterialBlueprintResourceListener::beginFillPass()" without virtual reality
+		uint32_t renderTargetWidth = 1;
+		uint32_t renderTargetHeight = 1;
+		renderTarget.getWidthAndHeight(renderTargetWidth, renderTargetHeight);
+		const float aspectRatio = static_cast<float>(renderTargetWidth) / static_cast<float>(renderTargetHeight);
+		const CameraSceneItem* cameraSceneItem = compositorContextData.getCameraSceneItem();
+		const glm::mat4 cameraRelativeWorldSpaceToClipSpaceMatrix = (nullptr != cameraSceneItem) ?
+			(cameraSceneItem->getViewSpaceToClipSpaceMatrix(aspectRatio) * cameraSceneItem->getCameraRelativeWorldSpaceToViewSpaceMatrix()) :
+			(glm::perspective(CameraSceneItem::DEFAULT_FOV_Y, aspectRatio, CameraSceneItem::DEFAULT_NEAR_Z, CameraSceneItem::DEFAULT_FAR_Z) * glm::lookAt(Math::VEC3_ZERO, Math::VEC3_FORWARD, Math::VEC3_UP));
+		const glm::vec3 worldSpaceCameraPosition(compositorContextData.getWorldSpaceCameraPosition());
+
+		// Record the compute passes
+		for (GpuInstanceCuller* gpuInstanceCuller : mScratchGpuInstanceCullers)
+		{
+			gpuInstanceCuller->cull(cameraRelativeWorldSpaceToClipSpaceMatrix, worldSpaceCameraPosition, commandBuffer);
+			if (std::find(mUsedGpuInstanceCullers.cbegin(), mUsedGpuInstanceCullers.cend(), gpuInstanceCuller) == mUsedGpuInstanceCullers.cend())
+			{
+				mUsedGpuInstanceCullers.push_back(gpuInstanceCuller);
+			}
+		}
+	}
+
 	void RenderQueue::fillComputeCommandBuffer(const CompositorContextData& compositorContextData, Rhi::CommandBuffer& commandBuffer)
 	{
 		// Sanity check
@@ -835,6 +959,7 @@ namespace Renderer
 
 		// No combined scoped profiler CPU and GPU sample as well as renderer debug event command by intent, this is something the caller has to take care of
 		// RENDERER_SCOPED_PROFILER_EVENT(mRenderer.getContext(), commandBuffer, "Compute render queue")
+		RENDERER_PROFILER_SCOPED_CPU_SAMPLE(mRenderer.getContext(), "Render queue")
 
 		// TODO(co) This is just a dummy implementation. For example automatic instancing has to be incorporated as well as more efficient buffer management.
 		const TextureResourceManager& textureResourceManager = mRenderer.getTextureResourceManager();
@@ -54,6 +54,7 @@ namespace Renderer
 	class MaterialTechnique;
 	class RenderableManager;
 	class CompositorContextData;
+	class GpuInstanceCuller;
 	class IndirectBufferManager;
 	class MaterialBlueprintResource;
 }
@@ -134,6 +135,13 @@ namespace Renderer
 		}
 
 		void clear();
+
+		/**
+		*  @brief
+		*    Called post command buffer execution, clears the render queue and informs the GPU instance cullers used since the last call
+		*/
+		void onPostCommandBufferExecution();
+
 		void addRenderablesFromRenderableManager(const RenderableManager& renderableManager, MaterialTechniqueId materialTechniqueId, const CompositorContextData& compositorContextData, bool castShadows = false);
 		void fillGraphicsCommandBuffer(const Rhi::IRenderTarget& renderTarget, const CompositorContextData& compositorContextData, Rhi::CommandBuffer& commandBuffer);
 		void fillComputeCommandBuffer(const CompositorContextData& compositorContextData, Rhi::CommandBuffer& commandBuffer);
@@ -145,6 +153,7 @@ namespace Renderer
 	private:
 		explicit RenderQueue(const RenderQueue&) = delete;
 		RenderQueue& operator=(const RenderQueue&) = delete;
+		void cullGpuInstances(const Rhi::IRenderTarget& renderTarget, const CompositorContextData& compositorContextData, Rhi::CommandBuffer& commandBuffer);
 
 
 	//[-------------------------------------------------------]
@@ -190,6 +199,8 @@ namespace Renderer
 		};
 		typedef std::vector<Queue> Queues;
 
+		typedef std::vector<GpuInstanceCuller*> GpuInstanceCullers;
+
 
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
@@ -206,8 +217,10 @@ namespace Renderer
 		bool					mPositionOnlyPass;
 		bool					mTransparentPass;
 		bool					mDoSort;
+		GpuInstanceCullers		mUsedGpuInstanceCullers;	///< GPU instance cullers used since the last post command buffer execution, we don't own the instances so don't delete them
 		// Scratch buffers to reduce dynamic memory allocations
 		Rhi::CommandBuffer		mScratchCommandBuffer;
+		GpuInstanceCullers		mScratchGpuInstanceCullers;
 		ShaderProperties		mScratchShaderProperties;
 		ShaderProperties		mScratchOptimizedShaderProperties;
 
@@ -68,12 +68,17 @@ namespace Renderer
 		#endif
 		// Data
 		mRenderableManager(::detail::NullRenderableManager),
+		mGpuInstanceCuller(nullptr),
 		mStartIndexLocation(0),
 		mNumberOfIndices(0),
 		mInstanceCount(1),
 		mMaterialResourceId(getInvalid<MaterialResourceId>()),
 		mSkeletonResourceId(getInvalid<SkeletonResourceId>()),
+		mPositionDequantizationOffset(0.0f),
+		mPositionDequantizationScale(1.0f),
 		mDrawIndexed(false),
+		mQuantizedVertices(false),
+		mQuantizedPositions(false),
 		// Cached material data
 		mRenderQueueIndex(0),
 		mCastShadows(false),
@@ -93,12 +98,17 @@ namespace Renderer
 		// Data
 		mRenderableManager(renderableManager),
 		mVertexArrayPtr(vertexArrayPtr),
+		mGpuInstanceCuller(nullptr),
 		mStartIndexLocation(startIndexLocation),
 		mNumberOfIndices(numberOfIndices),
 		mInstanceCount(instanceCount),
 		mMaterialResourceId(getInvalid<MaterialResourceId>()),
 		mSkeletonResourceId(skeletonResourceId),
+		mPositionDequantizationOffset(0.0f),
+		mPositionDequantizationScale(1.0f),
 		mDrawIndexed(drawIndexed),
+		mQuantizedVertices(false),
+		mQuantizedPositions(false),
 		// Cached material data
 		mRenderQueueIndex(0),
 		mCastShadows(false),
@@ -128,12 +138,17 @@ namespace Renderer
 		mRenderableManager(renderableManager),
 		mVertexArrayPtr(vertexArrayPtr),
 		mIndirectBufferPtr(indirectBufferPtr),
+		mGpuInstanceCuller(nullptr),
 		mIndirectBufferOffset(indirectBufferOffset),	// Indirect buffer used
 		mNumberOfIndices(~0u),							// Invalid since read from the indirect buffer
 		mNumberOfDraws(numberOfDraws),					// Indirect buffer used
 		mMaterialResourceId(getInvalid<MaterialResourceId>()),
 		mSkeletonResourceId(skeletonResourceId),
+		mPositionDequantizationOffset(0.0f),
+		mPositionDequantizationScale(1.0f),
 		mDrawIndexed(drawIndexed),
+		mQuantizedVertices(false),
+		mQuantizedPositions(false),
 		// Cached material data
 		mRenderQueueIndex(0),
 		mCastShadows(false),
@@ -163,12 +178,17 @@ namespace Renderer
 		mRenderableManager(renderableManager),
 		mVertexArrayPtr(vertexArrayPtr),
 		mPositionOnlyVertexArrayPtr(positionOnlyVertexArrayPtr),
+		mGpuInstanceCuller(nullptr),
 		mStartIndexLocation(startIndexLocation),
 		mNumberOfIndices(numberOfIndices),
 		mInstanceCount(instanceCount),
 		mMaterialResourceId(getInvalid<MaterialResourceId>()),
 		mSkeletonResourceId(skeletonResourceId),
+		mPositionDequantizationOffset(0.0f),
+		mPositionDequantizationScale(1.0f),
 		mDrawIndexed(drawIndexed),
+		mQuantizedVertices(false),
+		mQuantizedPositions(false),
 		// Cached material data
 		mRenderQueueIndex(0),
 		mCastShadows(false),
@@ -199,12 +219,17 @@ namespace Renderer
 		mVertexArrayPtr(vertexArrayPtr),
 		mPositionOnlyVertexArrayPtr(positionOnlyVertexArrayPtr),
 		mIndirectBufferPtr(indirectBufferPtr),
+		mGpuInstanceCuller(nullptr),
 		mIndirectBufferOffset(indirectBufferOffset),	// Indirect buffer used
 		mNumberOfIndices(~0u),							// Invalid since read from the indirect buffer
 		mNumberOfDraws(numberOfDraws),					// Indirect buffer used
 		mMaterialResourceId(getInvalid<MaterialResourceId>()),
 		mSkeletonResourceId(skeletonResourceId),
+		mPositionDequantizationOffset(0.0f),
+		mPositionDequantizationScale(1.0f),
 		mDrawIndexed(drawIndexed),
+		mQuantizedVertices(false),
+		mQuantizedPositions(false),
 		// Cached material data
 		mRenderQueueIndex(0),
 		mCastShadows(false),
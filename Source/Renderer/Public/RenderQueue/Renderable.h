@@ -29,6 +29,15 @@
 //[-------------------------------------------------------]
 #include "Renderer/Public/Export.h"
 
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4127)	// warning C4127: conditional expression is constant
+	PRAGMA_WARNING_DISABLE_MSVC(4201)	// warning C4201: nonstandard extension used: nameless struct/union
+	PRAGMA_WARNING_DISABLE_MSVC(4464)	// warning C4464: relative include path contains '..'
+	PRAGMA_WARNING_DISABLE_MSVC(4324)	// warning C4324: '<x>': structure was padded due to alignment specifier
+	#include <glm/glm.hpp>
+PRAGMA_WARNING_POP
+
 // Disable warnings in external headers, we can't fix them
 PRAGMA_WARNING_PUSH
 	PRAGMA_WARNING_DISABLE_MSVC(4365)	// warning C4365: 'argument': conversion from 'long' to 'unsigned int', signed/unsigned mismatch
@@ -43,6 +52,7 @@ PRAGMA_WARNING_POP
 //[-------------------------------------------------------]
 namespace Renderer
 {
+	class GpuInstanceCuller;
 	class RenderableManager;
 	class MaterialResourceManager;
 }
@@ -166,6 +176,27 @@ namespace Renderer
 			mIndirectBufferPtr = indirectBufferPtr;
 		}
 
+		[[nodiscard]] inline GpuInstanceCuller* getGpuInstanceCuller() const
+		{
+			return mGpuInstanceCuller;
+		}
+
+		/**
+		*  @brief
+		*    Set the GPU instance culler generating the draw list
+		*
+		*  @param[in] gpuInstanceCuller
+		*    GPU instance culler to use, can be a null pointer, must stay valid as long as it's set
+		*
+		*  @note
+		*    - The render queue culls the instances when filling the command buffer and draws the indirect buffer of the GPU instance culler instead of
+		*      the indirect buffer of the renderable, the number of draws is taken from the GPU instance culler as well
+		*/
+		inline void setGpuInstanceCuller(GpuInstanceCuller* gpuInstanceCuller)
+		{
+			mGpuInstanceCuller = gpuInstanceCuller;
+		}
+
 		[[nodiscard]] inline bool getDrawIndexed() const
 		{
 			return mDrawIndexed;
@@ -176,6 +207,56 @@ namespace Renderer
 			mDrawIndexed = drawIndexed;
 		}
 
+		[[nodiscard]] inline bool hasQuantizedVertices() const
+		{
+			return mQuantizedVertices;
+		}
+
+		inline void setQuantizedVertices(bool quantizedVertices)
+		{
+			// The renderable pipeline state caches were created for the previous vertex attributes layout
+			if (mQuantizedVertices != quantizedVertices)
+			{
+				mQuantizedVertices = quantizedVertices;
+				mPipelineStateCaches.clear();
+			}
+		}
+
+		[[nodiscard]] inline bool hasQuantizedPositions() const
+		{
+			return mQuantizedPositions;
+		}
+
+		[[nodiscard]] inline const glm::vec3& getPositionDequantizationOffset() const
+		{
+			return mPositionDequantizationOffset;
+		}
+
+		[[nodiscard]] inline const glm::vec3& getPositionDequantizationScale() const
+		{
+			return mPositionDequantizationScale;
+		}
+
+		/**
+		*  @brief
+		*    Set the position dequantization of vertex data using 16 bit signed normalized positions
+		*
+		*  @param[in] offset
+		*    Object space offset added to the scaled quantized position, the bounding box center of the mesh
+		*  @param[in] scale
+		*    Object space scale of the quantized position, the bounding box half extents of the mesh
+		*
+		*  @note
+		*    - Folded into the "POSITION_ROTATION_SCALE" instance data by "Renderer::TextureInstanceBufferManager", so the vertex shaders stay untouched
+		*    - "Renderer::UniformInstanceBufferManager" only passes on the world space position and can't dequantize positions, use material blueprints with an instance texture buffer for such renderables
+		*/
+		inline void setPositionDequantization(const glm::vec3& offset, const glm::vec3& scale)
+		{
+			mPositionDequantizationOffset = offset;
+			mPositionDequantizationScale = scale;
+			mQuantizedPositions = true;
+		}
+
 		[[nodiscard]] inline uint32_t getStartIndexLocation() const
 		{
 			return mStartIndexLocation;
@@ -311,6 +392,7 @@ namespace Renderer
 		Rhi::IVertexArrayPtr			mVertexArrayPtr;				///< Optional vertex array object (VAO), can be a null pointer
 		Rhi::IVertexArrayPtr			mPositionOnlyVertexArrayPtr;	///< Optional position-only vertex array object (VAO) which can reduce the number of processed vertices up to half, can be a null pointer, can be used for position-only rendering (e.g. shadow map rendering) using the same vertex data that the original vertex array object (VAO) uses
 		Rhi::IIndirectBufferPtr			mIndirectBufferPtr;				///< Optional indirect buffer, can be a null pointer
+		GpuInstanceCuller*				mGpuInstanceCuller;				///< Optional GPU instance culler filling the indirect buffer, can be a null pointer, don't destroy the instance
 		union
 		{
 			uint32_t					mStartIndexLocation;			///< Used in case there's no indirect buffer
@@ -324,7 +406,11 @@ namespace Renderer
 		};
 		MaterialResourceId				mMaterialResourceId;
 		SkeletonResourceId				mSkeletonResourceId;
+		glm::vec3						mPositionDequantizationOffset;	///< Only used if "mQuantizedPositions" is "true"
+		glm::vec3						mPositionDequantizationScale;	///< Only used if "mQuantizedPositions" is "true"
 		bool							mDrawIndexed;					///< Placed at this location due to padding
+		bool							mQuantizedVertices;				///< "true" if the vertex array uses the quantized vertex attributes layout of "Renderer::MeshResource", placed at this location due to padding
+		bool							mQuantizedPositions;			///< "true" if the vertex array uses 16 bit signed normalized positions which need the position dequantization, placed at this location due to padding
 		// Cached material data
 		uint8_t							mRenderQueueIndex;
 		bool							mCastShadows;
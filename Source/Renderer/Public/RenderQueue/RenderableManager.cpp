@@ -65,6 +65,7 @@ namespace Renderer
 		mTransform(&::detail::IdentityTransform),
 		mVisible(true),
 		mCachedDistanceToCamera(getInvalid<float>()),
+		mCachedScreenSpaceSize(0.0f),
 		mMinimumRenderQueueIndex(0),
 		mMaximumRenderQueueIndex(0),
 		mCastShadows(false)
@@ -161,6 +161,16 @@ namespace Renderer
 			mCachedDistanceToCamera = distanceToCamera;
 		}
 
+		[[nodiscard]] inline float getCachedScreenSpaceSize() const
+		{
+			return mCachedScreenSpaceSize;
+		}
+
+		inline void setCachedScreenSpaceSize(float screenSpaceSize)
+		{
+			mCachedScreenSpaceSize = screenSpaceSize;
+		}
+
 		/**
 		*  @brief
 		*    Return the minimum renderables render queue index (inclusive)
@@ -241,6 +251,7 @@ namespace Renderer
 		bool			 mVisible;
 		// Cached data
 		float			 mCachedDistanceToCamera;	///< Cached distance to camera is updated during the culling phase
+		float			 mCachedScreenSpaceSize;	///< Cached on-screen size in pixels of the bounding sphere is updated during the culling phase, used as texture streaming feedback, 0 if unknown
 		uint8_t			 mMinimumRenderQueueIndex;	///< The minimum renderables render queue index (inclusive, set inside "Renderer::RenderableManager::updateCachedRenderablesData()")
 		uint8_t			 mMaximumRenderQueueIndex;	///< The maximum renderables render queue index (inclusive, set inside "Renderer::RenderableManager::updateCachedRenderablesData()")
 		bool			 mCastShadows;				///< "true" if at least one of the renderables is casting shadows, else "false" (set inside "Renderer::RenderableManager::updateCachedRenderablesData()")
@@ -24,7 +24,9 @@
 #include "Renderer/Public/RendererImpl.h"
 #include "Renderer/Public/Asset/AssetManager.h"
 #include "Renderer/Public/Core/File/MemoryFile.h"
+#include "Renderer/Public/Core/IProfiler.h"
 #include "Renderer/Public/Core/Time/TimeManager.h"
+#include "Renderer/Public/Core/Memory/FrameAllocator.h"
 #include "Renderer/Public/Core/File/IFileManager.h"
 #include "Renderer/Public/Core/Thread/ThreadPool.h"
 #include "Renderer/Public/Resource/ResourceStreamer.h"
@@ -87,6 +89,7 @@ namespace
 			static constexpr uint32_t FORMAT_TYPE	 = STRING_ID("PipelineStateCache");
 			static constexpr uint32_t FORMAT_VERSION = 1;
 		}
+		static constexpr size_t NUMBER_OF_FRAME_ALLOCATOR_BYTES_PER_ARENA = 1024 * 1024;	///< Transient per-frame renderer data is usually tiny, one MiB per arena is plenty
 
 
 		//[-------------------------------------------------------]
@@ -182,6 +185,7 @@ namespace Renderer
 		mDefaultThreadPool = new DefaultThreadPool();
 		mAssetManager = new AssetManager(*this);
 		mTimeManager = new TimeManager();
+		mFrameAllocator = new FrameAllocator(context.getAllocator(), ::detail::NUMBER_OF_FRAME_ALLOCATOR_BYTES_PER_ARENA);
 
 		// Create the resource manager instances
 		mRendererResourceManager = new RendererResourceManager(*this);
@@ -266,6 +270,7 @@ namespace Renderer
 		delete mResourceStreamer;
 
 		// Destroy the core manager instances
+		delete mFrameAllocator;
 		delete mTimeManager;
 		delete mAssetManager;
 		delete mDefaultThreadPool;
@@ -305,6 +310,14 @@ namespace Renderer
 		// Update the time manager
 		mTimeManager->update();
 
+		// Recycle the transient per-frame memory of the frame before the last frame
+		mFrameAllocator->nextFrame();
+
+		// Start a new RHI statistics frame
+		#ifdef RHI_STATISTICS
+			mRhi->nextStatisticsFrame();
+		#endif
+
 		{ // Handle resource reloading requests
 			std::unique_lock<std::mutex> assetIdsOfResourcesToReloadMutexLock(mAssetIdsOfResourcesToReloadMutex);
 			if (!mAssetIdsOfResourcesToReload.empty())
@@ -322,10 +335,15 @@ namespace Renderer
 			}
 		}
 
-		// Pipeline state compiler and resource streamer update
-		mGraphicsPipelineStateCompiler->dispatch();
-		mComputePipelineStateCompiler->dispatch();
-		mResourceStreamer->dispatch();
+		{ // Pipeline state compiler update
+			RENDERER_PROFILER_SCOPED_CPU_SAMPLE(mContext, "Pipeline state compiler")
+			mGraphicsPipelineStateCompiler->dispatch();
+			mComputePipelineStateCompiler->dispatch();
+		}
+		{ // Resource streamer update
+			RENDERER_PROFILER_SCOPED_CPU_SAMPLE(mContext, "Resource streaming")
+			mResourceStreamer->dispatch();
+		}
 
 		// Inform the individual resource manager instances
 		const size_t numberOfResourceManagers = mResourceManagers.size();
@@ -25,6 +25,9 @@
 #include "Renderer/Public/Resource/CompositorNode/CompositorTarget.h"
 #include "Renderer/Public/Resource/CompositorNode/Pass/ICompositorInstancePass.h"
 #include "Renderer/Public/Resource/CompositorNode/Pass/ICompositorResourcePass.h"
+#include "Renderer/Public/Resource/CompositorWorkspace/CompositorWorkspaceInstance.h"
+#include "Renderer/Public/Core/IProfiler.h"
+#include "Renderer/Public/IRenderer.h"
 
 #include <limits>
 
@@ -89,7 +92,67 @@ namespace Renderer
 				}
 
 				// Let the compositor instance pass fill the command buffer
-				compositorInstancePass->onFillCommandBuffer(currentRenderTarget, compositorContextData, commandBuffer);
+				if (compositorInstancePass->mCommandBufferCachingEnabled)
+				{
+					// Record the cached command buffer, if necessary
+					if (!compositorInstancePass->mCachedCommandBufferValid || compositorInstancePass->mCachedRenderTarget != currentRenderTarget || !compositorInstancePass->isCachedCommandBufferValid(currentRenderTarget))
+					{
+						Rhi::CommandBuffer& cachedCommandBuffer = compositorInstancePass->mCachedCommandBuffer;
+						cachedCommandBuffer.clear();
+						#ifdef RENDERER_PROFILER
+							// GPU samples baked into the cached command buffer would reference stale profiler data when being replayed during later frames, so keep the
+							// GPU samples of all profiler implementations outside of the recorded region and sample the replay below instead
+							IProfiler& profiler = mCompositorWorkspaceInstance.getRenderer().getContext().getProfiler();
+							profiler.setCommandBufferGpuSamplesSuspended(true);
+							compositorInstancePass->onFillCommandBuffer(currentRenderTarget, compositorContextData, cachedCommandBuffer);
+							profiler.setCommandBufferGpuSamplesSuspended(false);
+						#else
+							compositorInstancePass->onFillCommandBuffer(currentRenderTarget, compositorContextData, cachedCommandBuffer);
+						#endif
+						compositorInstancePass->mCachedCommandBufferValid = true;
+						compositorInstancePass->mCachedRenderTarget = currentRenderTarget;
+
+						// Count the recorded commands
+						uint32_t numberOfCachedCommands = 0;
+						Rhi::ConstCommandPacket constCommandPacket = cachedCommandBuffer.getFirstCommandPacket();
+						while (nullptr != constCommandPacket)
+						{
+							++numberOfCachedCommands;
+							constCommandPacket = Rhi::CommandPacketHelper::getNextCommandPacket(constCommandPacket);
+						}
+						compositorInstancePass->mNumberOfCachedCommands = numberOfCachedCommands;
+						compositorInstancePass->mNumberOfRecordedCommands = numberOfCachedCommands;
+						compositorInstancePass->mNumberOfReplayedCommands = 0;
+					}
+					else
+					{
+						compositorInstancePass->mNumberOfRecordedCommands = 0;
+						compositorInstancePass->mNumberOfReplayedCommands = compositorInstancePass->mNumberOfCachedCommands;
+					}
+
+					// Replay the cached command buffer, it's owned by the compositor instance pass so there's no need to copy the command packets
+					if (!compositorInstancePass->mCachedCommandBuffer.isEmpty())
+					{
+						#ifdef RENDERER_PROFILER
+							// Sample the replayed cached command buffer inside the command buffer of the current frame instead
+							IProfiler& profiler = mCompositorWorkspaceInstance.getRenderer().getContext().getProfiler();
+							profiler.beginCommandBufferGpuSample(commandBuffer, compositorResourcePass.getDebugName(), nullptr);
+							compositorInstancePass->mCachedCommandBuffer.submitToCommandBufferByReference(commandBuffer);
+							profiler.endCommandBufferGpuSample(commandBuffer);
+						#else
+							compositorInstancePass->mCachedCommandBuffer.submitToCommandBufferByReference(commandBuffer);
+						#endif
+					}
+				}
+				else
+				{
+					compositorInstancePass->onFillCommandBuffer(currentRenderTarget, compositorContextData, commandBuffer);
+				}
+			}
+			else
+			{
+				compositorInstancePass->mNumberOfRecordedCommands = 0;
+				compositorInstancePass->mNumberOfReplayedCommands = 0;
 			}
 
 			// Update the number of compositor instance pass execution requests and don't forget to avoid integer range overflow
@@ -63,7 +63,8 @@ namespace Renderer
 	CompositorInstancePassClear::CompositorInstancePassClear(const CompositorResourcePassClear& compositorResourcePassClear, const CompositorNodeInstance& compositorNodeInstance) :
 		ICompositorInstancePass(compositorResourcePassClear, compositorNodeInstance)
 	{
-		// Nothing here
+		// The clear parameters are static, so record the clear once and replay it
+		setCommandBufferCachingEnabled(true);
 	}
 
 
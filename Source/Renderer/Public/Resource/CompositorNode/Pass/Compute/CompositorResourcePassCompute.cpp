@@ -77,6 +77,18 @@ namespace Renderer
 		ASSERT(!(isValid(mMaterialAssetId) && isValid(mMaterialBlueprintAssetId)), "Invalid material asset")
 	}
 
+	void CompositorResourcePassCompute::getReferencedResources(TextureAssetIds& textureAssetIds, [[maybe_unused]] CompositorFramebufferIds& compositorFramebufferIds) const
+	{
+		// Textures used via material property overrides, textures referenced by the material asset or the material blueprint itself aren't known here
+		for (const MaterialProperty& materialProperty : mMaterialProperties.getSortedPropertyVector())
+		{
+			if (materialProperty.getValueType() == MaterialProperty::ValueType::TEXTURE_ASSET_ID)
+			{
+				textureAssetIds.push_back(materialProperty.getTextureAssetIdValue());
+			}
+		}
+	}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -122,6 +122,7 @@ namespace Renderer
 		}
 
 		virtual void deserialize(uint32_t numberOfBytes, const uint8_t* data) override;
+		virtual void getReferencedResources(TextureAssetIds& textureAssetIds, CompositorFramebufferIds& compositorFramebufferIds) const override;
 
 
 	//[-------------------------------------------------------]
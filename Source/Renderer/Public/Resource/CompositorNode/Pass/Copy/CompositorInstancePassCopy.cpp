@@ -65,6 +65,12 @@ namespace Renderer
 			if (nullptr != destinationTexturePtr && nullptr != sourceTexturePtr)
 			{
 				Rhi::Command::CopyResource::create(commandBuffer, *destinationTexturePtr, *sourceTexturePtr);
+
+				// Remember the textures the cached command buffer is recorded for
+				mDestinationTextureResourceId = destinationTextureResource->getId();
+				mSourceTextureResourceId = sourceTextureResource->getId();
+				mDestinationTexturePtr = destinationTexturePtr;
+				mSourceTexturePtr = sourceTexturePtr;
 			}
 			else
 			{
@@ -80,13 +86,34 @@ namespace Renderer
 	}
 
 
+	bool CompositorInstancePassCopy::isCachedCommandBufferValid(const Rhi::IRenderTarget*) const
+	{
+		// The texture resources might have been reloaded in the meantime, in which case the cached command buffer references the previous RHI textures
+		if (isValid(mDestinationTextureResourceId) && isValid(mSourceTextureResourceId))
+		{
+			const TextureResourceManager& textureResourceManager = getCompositorNodeInstance().getCompositorWorkspaceInstance().getRenderer().getTextureResourceManager();
+			const IResource* destinationResource = textureResourceManager.tryGetResourceByResourceId(mDestinationTextureResourceId);
+			const IResource* sourceResource = textureResourceManager.tryGetResourceByResourceId(mSourceTextureResourceId);
+			return (nullptr != destinationResource && nullptr != sourceResource &&
+					static_cast<const TextureResource*>(destinationResource)->getTexturePtr() == mDestinationTexturePtr &&
+					static_cast<const TextureResource*>(sourceResource)->getTexturePtr() == mSourceTexturePtr);
+		}
+
+		// Nothing was recorded, try again
+		return false;
+	}
+
+
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
 	//[-------------------------------------------------------]
 	CompositorInstancePassCopy::CompositorInstancePassCopy(const CompositorResourcePassCopy& compositorResourcePassCopy, const CompositorNodeInstance& compositorNodeInstance) :
-		ICompositorInstancePass(compositorResourcePassCopy, compositorNodeInstance)
+		ICompositorInstancePass(compositorResourcePassCopy, compositorNodeInstance),
+		mDestinationTextureResourceId(getInvalid<TextureResourceId>()),
+		mSourceTextureResourceId(getInvalid<TextureResourceId>())
 	{
-		// Nothing here
+		// The resource copy only references persistent RHI textures, so record it once and replay it
+		setCommandBufferCachingEnabled(true);
 	}
 
 
@@ -39,6 +39,15 @@ namespace Renderer
 }
 
 
+//[-------------------------------------------------------]
+//[ Global definitions                                    ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+	typedef uint32_t TextureResourceId;	///< POD texture resource identifier
+}
+
+
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
@@ -64,6 +73,7 @@ namespace Renderer
 	//[-------------------------------------------------------]
 	protected:
 		virtual void onFillCommandBuffer(const Rhi::IRenderTarget* renderTarget, const CompositorContextData& compositorContextData, Rhi::CommandBuffer& commandBuffer) override;
+		[[nodiscard]] virtual bool isCachedCommandBufferValid(const Rhi::IRenderTarget* renderTarget) const override;
 
 
 	//[-------------------------------------------------------]
@@ -81,6 +91,17 @@ namespace Renderer
 		CompositorInstancePassCopy& operator=(const CompositorInstancePassCopy&) = delete;
 
 
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		// The cached command buffer was recorded for these textures, we keep a reference to the RHI textures so a reused memory address can't fool the comparison
+		TextureResourceId mDestinationTextureResourceId;
+		TextureResourceId mSourceTextureResourceId;
+		Rhi::ITexturePtr  mDestinationTexturePtr;
+		Rhi::ITexturePtr  mSourceTexturePtr;
+
+
 	};
 
 
@@ -89,6 +89,12 @@ namespace Renderer
 
 		virtual void deserialize(uint32_t numberOfBytes, const uint8_t* data) override;
 
+		inline virtual void getReferencedResources(TextureAssetIds& textureAssetIds, [[maybe_unused]] CompositorFramebufferIds& compositorFramebufferIds) const override
+		{
+			textureAssetIds.push_back(mDestinationTextureAssetId);
+			textureAssetIds.push_back(mSourceTextureAssetId);
+		}
+
 
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
@@ -163,12 +163,30 @@ namespace Renderer
 				if (nullptr != texture)
 				{
 					Rhi::Command::GenerateMipmaps::create(commandBuffer, *texture);
+
+					// Remember the texture the cached command buffer is recorded for
+					mTextureResourceId = textureResource->getId();
+					mTexturePtr = texture;
 				}
 			}
 		}
 	}
 
 
+	bool CompositorInstancePassGenerateMipmaps::isCachedCommandBufferValid(const Rhi::IRenderTarget*) const
+	{
+		// The texture resource might have been reloaded in the meantime, in which case the cached command buffer references the previous RHI texture
+		if (isValid(mTextureResourceId))
+		{
+			const IResource* resource = getCompositorNodeInstance().getCompositorWorkspaceInstance().getRenderer().getTextureResourceManager().tryGetResourceByResourceId(mTextureResourceId);
+			return (nullptr != resource && static_cast<const TextureResource*>(resource)->getTexturePtr() == mTexturePtr);
+		}
+
+		// Nothing was recorded, try again
+		return false;
+	}
+
+
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
 	//[-------------------------------------------------------]
@@ -177,7 +195,8 @@ namespace Renderer
 		mCompositorResourcePassCompute(nullptr),
 		mCompositorInstancePassCompute(nullptr),
 		mRenderTargetWidth(getInvalid<uint32_t>()),
-		mRenderTargetHeight(getInvalid<uint32_t>())
+		mRenderTargetHeight(getInvalid<uint32_t>()),
+		mTextureResourceId(getInvalid<TextureResourceId>())
 	{
 		// Handle texture mipmap generation via custom material blueprint
 		const AssetId materialBlueprintAssetId = compositorResourcePassGenerateMipmaps.getMaterialBlueprintAssetId();
@@ -199,6 +218,10 @@ namespace Renderer
 		{
 			// Sanity check
 			RHI_ASSERT(getCompositorNodeInstance().getCompositorWorkspaceInstance().getRenderer().getContext(), isInvalid(compositorResourcePassGenerateMipmaps.getTextureMaterialBlueprintProperty()), "Invalid compositor resource pass generate mipmaps texture material blueprint property")
+
+			// RHI texture mipmap generation only references a persistent RHI texture, so record it once and replay it
+			// -> Not possible for mipmap generation via custom material blueprint since the material blueprint buffer managers recycle their per-frame buffers
+			setCommandBufferCachingEnabled(true);
 		}
 	}
 
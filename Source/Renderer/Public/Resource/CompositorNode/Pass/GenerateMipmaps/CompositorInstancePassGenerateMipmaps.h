@@ -43,6 +43,15 @@ namespace Renderer
 }
 
 
+//[-------------------------------------------------------]
+//[ Global definitions                                    ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+	typedef uint32_t TextureResourceId;	///< POD texture resource identifier
+}
+
+
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
@@ -68,6 +77,7 @@ namespace Renderer
 	//[-------------------------------------------------------]
 	protected:
 		virtual void onFillCommandBuffer(const Rhi::IRenderTarget* renderTarget, const CompositorContextData& compositorContextData, Rhi::CommandBuffer& commandBuffer) override;
+		[[nodiscard]] virtual bool isCachedCommandBufferValid(const Rhi::IRenderTarget* renderTarget) const override;
 
 
 	//[-------------------------------------------------------]
@@ -98,6 +108,9 @@ namespace Renderer
 		uint32_t					   mRenderTargetWidth;
 		uint32_t					   mRenderTargetHeight;
 		FramebufferPtrs				   mFramebuffersPtrs;
+		// For RHI texture mipmap generation, the cached command buffer was recorded for this texture, we keep a reference to the RHI texture so a reused memory address can't fool the comparison
+		TextureResourceId			   mTextureResourceId;
+		Rhi::ITexturePtr			   mTexturePtr;
 
 
 	};
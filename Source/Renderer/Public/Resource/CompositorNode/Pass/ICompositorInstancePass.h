@@ -81,6 +81,21 @@ namespace Renderer
 			return mRenderTarget;
 		}
 
+		[[nodiscard]] inline bool isCommandBufferCachingEnabled() const
+		{
+			return mCommandBufferCachingEnabled;
+		}
+
+		[[nodiscard]] inline uint32_t getNumberOfRecordedCommands() const	// Number of commands recorded into the cached command buffer during the last execution, zero if the cached command buffer was replayed
+		{
+			return mNumberOfRecordedCommands;
+		}
+
+		[[nodiscard]] inline uint32_t getNumberOfReplayedCommands() const	// Number of cached commands replayed during the last execution, zero if the cached command buffer was recorded
+		{
+			return mNumberOfReplayedCommands;
+		}
+
 
 	//[-------------------------------------------------------]
 	//[ Protected virtual Renderer::ICompositorInstancePass methods ]
@@ -124,6 +139,27 @@ namespace Renderer
 			// Nothing here
 		}
 
+		/**
+		*  @brief
+		*    Check whether or not the cached command buffer can still be replayed
+		*
+		*  @param[in] renderTarget
+		*    RHI render target to render into, can be a null pointer (e.g. for compute shader or resource copy compositor passes)
+		*
+		*  @return
+		*    "true" if the cached command buffer can be replayed, else "false" to record it again
+		*
+		*  @note
+		*    - Only called if command buffer caching has been enabled via "Renderer::ICompositorInstancePass::setCommandBufferCachingEnabled()"
+		*    - Render target changes as well as recreated framebuffers and render target textures (resolution or multisample changes) are already tracked by the caller
+		*    - Overwrite this method to track additional invalidating inputs like reloaded resources
+		*    - The default implementation always returns "true"
+		*/
+		[[nodiscard]] inline virtual bool isCachedCommandBufferValid([[maybe_unused]] const Rhi::IRenderTarget* renderTarget) const
+		{
+			return true;
+		}
+
 
 	//[-------------------------------------------------------]
 	//[ Protected methods                                     ]
@@ -133,7 +169,13 @@ namespace Renderer
 			mCompositorResourcePass(compositorResourcePass),
 			mCompositorNodeInstance(compositorNodeInstance),
 			mRenderTarget(nullptr),
-			mNumberOfExecutionRequests(0)
+			mNumberOfExecutionRequests(0),
+			mCommandBufferCachingEnabled(false),
+			mCachedCommandBufferValid(false),
+			mCachedRenderTarget(nullptr),
+			mNumberOfCachedCommands(0),
+			mNumberOfRecordedCommands(0),
+			mNumberOfReplayedCommands(0)
 		{
 			// Nothing here
 		}
@@ -146,6 +188,29 @@ namespace Renderer
 		explicit ICompositorInstancePass(const ICompositorInstancePass&) = delete;
 		ICompositorInstancePass& operator=(const ICompositorInstancePass&) = delete;
 
+		/**
+		*  @brief
+		*    Enable or disable command buffer caching
+		*
+		*  @param[in] commandBufferCachingEnabled
+		*    "true" to record "Renderer::ICompositorInstancePass::onFillCommandBuffer()" once and replay the recorded commands until invalidated, else "false"
+		*
+		*  @note
+		*    - Only opt-in if the filled commands solely reference persistent RHI resources, per-frame data like pass uniform buffers, instance buffers or indirect buffers are recycled each frame and must never be replayed
+		*    - The compositor context data must not influence the filled commands since it's not tracked
+		*    - Command buffer GPU profiler samples are suspended while recording, the caller samples each replay of the cached command buffer as a whole using the compositor resource pass debug name
+		*/
+		inline void setCommandBufferCachingEnabled(bool commandBufferCachingEnabled)
+		{
+			mCommandBufferCachingEnabled = commandBufferCachingEnabled;
+			invalidateCachedCommandBuffer();
+		}
+
+		inline void invalidateCachedCommandBuffer()
+		{
+			mCachedCommandBufferValid = false;
+		}
+
 
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
@@ -155,6 +220,14 @@ namespace Renderer
 		const CompositorNodeInstance&  mCompositorNodeInstance;
 		Rhi::IRenderTarget*			   mRenderTarget;	/// Render target, can be a null pointer, don't destroy the instance
 		uint32_t					   mNumberOfExecutionRequests;
+		// Optional cached command buffer, see "Renderer::ICompositorInstancePass::setCommandBufferCachingEnabled()"
+		bool					  mCommandBufferCachingEnabled;
+		bool					  mCachedCommandBufferValid;
+		const Rhi::IRenderTarget* mCachedRenderTarget;			///< Render target the cached command buffer was recorded for, can be a null pointer, don't destroy the instance
+		uint32_t				  mNumberOfCachedCommands;
+		uint32_t				  mNumberOfRecordedCommands;	///< Number of commands recorded during the last execution
+		uint32_t				  mNumberOfReplayedCommands;	///< Number of commands replayed during the last execution
+		Rhi::CommandBuffer		  mCachedCommandBuffer;
 
 
 	};
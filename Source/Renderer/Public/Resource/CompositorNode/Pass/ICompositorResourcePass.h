@@ -30,6 +30,14 @@
 #include "Renderer/Public/Core/StringId.h"
 #include "Renderer/Public/Core/GetInvalid.h"
 
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4365)	// warning C4365: 'argument': conversion from 'long' to 'unsigned int', signed/unsigned mismatch
+	PRAGMA_WARNING_DISABLE_MSVC(4571)	// warning C4571: Informational: catch(...) semantics changed since Visual C++ 7.1; structured exceptions (SEH) are no longer caught
+	PRAGMA_WARNING_DISABLE_MSVC(4668)	// warning C4668: '_M_HYBRID_X86_ARM64' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
+	#include <vector>
+PRAGMA_WARNING_POP
+
 
 //[-------------------------------------------------------]
 //[ Forward declarations                                  ]
@@ -50,7 +58,9 @@ namespace Renderer
 	//[-------------------------------------------------------]
 	//[ Global definitions                                    ]
 	//[-------------------------------------------------------]
-	typedef StringId CompositorPassTypeId;	///< Compositor pass type identifier, internally just a POD "uint32_t"
+	typedef StringId AssetId;					///< Asset identifier, internally just a POD "uint32_t", string ID scheme is "<project name>/<asset directory>/<asset name>"
+	typedef StringId CompositorPassTypeId;		///< Compositor pass type identifier, internally just a POD "uint32_t"
+	typedef StringId CompositorFramebufferId;	///< Compositor framebuffer identifier, internally just a POD "uint32_t"
 
 
 	//[-------------------------------------------------------]
@@ -71,6 +81,8 @@ namespace Renderer
 	//[-------------------------------------------------------]
 	public:
 		static constexpr uint32_t MAXIMUM_PASS_NAME_LENGTH = 63 + 1;	// +1 for the terminating zero
+		typedef std::vector<AssetId>				 TextureAssetIds;
+		typedef std::vector<CompositorFramebufferId> CompositorFramebufferIds;
 
 
 	//[-------------------------------------------------------]
@@ -182,6 +194,24 @@ namespace Renderer
 			return false;
 		}
 
+		/**
+		*  @brief
+		*    Return the resources referenced by this compositor resource pass
+		*
+		*   @param[out] textureAssetIds
+		*     Receives the asset IDs of the textures read or written by this compositor resource pass, the list isn't cleared before adding
+		*   @param[out] compositorFramebufferIds
+		*     Receives the IDs of the compositor framebuffers read or written by this compositor resource pass, the list isn't cleared before adding
+		*
+		*  @note
+		*    - The compositor framebuffer of the owning compositor target isn't included
+		*    - Used by the compositor workspace instance to compute the lifetime of render target textures, resources referenced only from inside material assets or material blueprints are unknown at this level
+		*/
+		inline virtual void getReferencedResources([[maybe_unused]] TextureAssetIds& textureAssetIds, [[maybe_unused]] CompositorFramebufferIds& compositorFramebufferIds) const
+		{
+			// This compositor resource pass doesn't reference any resources
+		}
+
 
 	//[-------------------------------------------------------]
 	//[ Protected methods                                     ]
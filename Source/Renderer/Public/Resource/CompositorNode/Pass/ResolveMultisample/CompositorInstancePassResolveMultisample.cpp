@@ -72,7 +72,8 @@ namespace Renderer
 	CompositorInstancePassResolveMultisample::CompositorInstancePassResolveMultisample(const CompositorResourcePassResolveMultisample& compositorResourcePassResolveMultisample, const CompositorNodeInstance& compositorNodeInstance) :
 		ICompositorInstancePass(compositorResourcePassResolveMultisample, compositorNodeInstance)
 	{
-		// Nothing here
+		// The source multisample framebuffer only changes together with the render target, which is tracked by the caller, so record the resolve once and replay it
+		setCommandBufferCachingEnabled(true);
 	}
 
 
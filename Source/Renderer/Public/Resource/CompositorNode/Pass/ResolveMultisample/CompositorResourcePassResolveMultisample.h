@@ -84,6 +84,11 @@ namespace Renderer
 
 		virtual void deserialize(uint32_t numberOfBytes, const uint8_t* data) override;
 
+		inline virtual void getReferencedResources([[maybe_unused]] TextureAssetIds& textureAssetIds, CompositorFramebufferIds& compositorFramebufferIds) const override
+		{
+			compositorFramebufferIds.push_back(mSourceMultisampleCompositorFramebufferId);
+		}
+
 
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
@@ -71,7 +71,7 @@ namespace Renderer
 		inline virtual void onPostCommandBufferExecution() override
 		{
 			// Directly clear the render queue as soon as the frame rendering has been finished to avoid evil dangling pointers
-			mRenderQueue.clear();
+			mRenderQueue.onPostCommandBufferExecution();
 		}
 
 
@@ -29,6 +29,8 @@
 #include "Renderer/Public/Resource/Texture/TextureResourceManager.h"
 #include "Renderer/Public/Resource/Scene/Item/Camera/CameraSceneItem.h"
 #include "Renderer/Public/Resource/Scene/Item/Light/LightSceneItem.h"
+#include "Renderer/Public/Resource/Scene/Culling/SceneCullingManager.h"
+#include "Renderer/Public/Resource/Scene/SceneResource.h"
 #include "Renderer/Public/Resource/Scene/SceneNode.h"
 #include "Renderer/Public/RenderQueue/RenderableManager.h"
 #include "Renderer/Public/Core/Math/Math.h"
@@ -58,6 +60,7 @@ namespace
 		//[-------------------------------------------------------]
 		static constexpr float	  SHADOW_MAP_FILTER_SIZE							  = 7.0f;
 		static constexpr uint8_t  INTERMEDIATE_CASCADE_INDEX						  = 3;
+		static constexpr float	  MINIMUM_CASCADE_DEPTH_RANGE						  = 0.01f;	///< Minimum depth range covered by the shadow cascades in normalized clip range units when using depth based cascade fitting
 		static constexpr uint32_t DEPTH_SHADOW_MAP_TEXTURE_ASSET_ID					  = ASSET_ID("Unrimp/Texture/DynamicByCode/DepthShadowMap");
 		static constexpr uint32_t INTERMEDIATE_DEPTH_BLUR_SHADOW_MAP_TEXTURE_ASSET_ID = ASSET_ID("Unrimp/Texture/DynamicByCode/IntermediateDepthBlurShadowMap");
 
@@ -130,6 +133,12 @@ namespace Renderer
 			createShadowMapRenderTarget();
 		}
 
+		// Reset the shadow cascade metrics
+		for (uint32_t& numberOfRenderedShadowCasters : mNumberOfRenderedShadowCasters)
+		{
+			numberOfRenderedShadowCasters = 0;
+		}
+
 		// Early escape if shadow is disabled
 		if (!mEnabled)
 		{
@@ -148,9 +157,24 @@ namespace Renderer
 			const bool stabilizeCascades = false;
 //			const bool stabilizeCascades = mStabilizeCascades;
 
-			// TODO(co) The minimum and maximum distance need to be calculated dynamically via depth buffer reduction as seen inside e.g. https://github.com/TheRealMJP/MSAAFilter/tree/master/MSAAFilter
-			const float minimumDistance = 0.0f;
-			const float maximumDistance = 0.5f;
+			// Get the minimum and maximum distance
+			// -> Instead of a depth buffer reduction as seen inside e.g. https://github.com/TheRealMJP/MSAAFilter/tree/master/MSAAFilter the bounding spheres of the
+			//    scene items which survived the camera culling are used, this is conservative and doesn't need to wait for the GPU
+			float minimumDistance = 0.0f;
+			float maximumDistance = 0.5f;
+			if (mDepthBasedCascadeFitting)
+			{
+				float minimumViewSpaceDepth = 0.0f;
+				float maximumViewSpaceDepth = 0.0f;
+				if (cameraSceneItem->getSceneResource().getSceneCullingManager().getVisibleViewSpaceDepthRange(minimumViewSpaceDepth, maximumViewSpaceDepth))
+				{
+					// Only tighten the shadow cascades and ensure they never become degenerated
+					const float nearClip = cameraSceneItem->getNearZ();
+					const float clipRange = cameraSceneItem->getFarZ() - nearClip;
+					minimumDistance = glm::clamp((minimumViewSpaceDepth - nearClip) / clipRange, 0.0f, maximumDistance);
+					maximumDistance = std::max(glm::clamp((maximumViewSpaceDepth - nearClip) / clipRange, 0.0f, maximumDistance), minimumDistance + ::detail::MINIMUM_CASCADE_DEPTH_RANGE);
+				}
+			}
 
 			// Compute the split distances based on the partitioning mode
 			float cascadeSplits[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
@@ -339,11 +363,23 @@ namespace Renderer
 						Rhi::Command::ClearGraphics::create(commandBuffer, Rhi::ClearFlag::DEPTH, color);
 					}
 
-					// Render shadow casters
-					// TODO(co) Optimization: Do only render stuff which calls into the current shadow cascade
+					// Gather the shadow casters
+					// -> Either only the shadow casters inside the shadow cascade volume extruded toward the light, which also includes shadow casters
+					//    outside the camera frustum, or all shadow casters visible to the camera
 					RHI_ASSERT(renderer.getContext(), nullptr != mRenderQueueIndexRange, "Invalid render queue index range")
-					const MaterialTechniqueId materialTechniqueId = static_cast<const CompositorResourcePassScene&>(getCompositorResourcePass()).getMaterialTechniqueId();
-					for (const RenderableManager* renderableManager : mRenderQueueIndexRange->renderableManagers)
+					const CompositorResourcePassScene& compositorResourcePassScene = static_cast<const CompositorResourcePassScene&>(getCompositorResourcePass());
+					const CompositorWorkspaceInstance::RenderableManagers* renderableManagers = &mRenderQueueIndexRange->renderableManagers;
+					if (mShadowCasterCulling)
+					{
+						mShadowCasterRenderableManagers.clear();
+						cameraSceneItem->getSceneResource().getSceneCullingManager().gatherShadowCasterRenderableManagers(*cameraSceneItem, viewSpaceToClipSpace, compositorResourcePassScene.getMinimumRenderQueueIndex(), compositorResourcePassScene.getMaximumRenderQueueIndex(), mShadowCasterRenderableManagers);
+						renderableManagers = &mShadowCasterRenderableManagers;
+					}
+
+					// Render shadow casters
+					const MaterialTechniqueId materialTechniqueId = compositorResourcePassScene.getMaterialTechniqueId();
+					uint32_t numberOfRenderedShadowCasters = 0;
+					for (const RenderableManager* renderableManager : *renderableManagers)
 					{
 						// The render queue index range covered by this compositor instance pass scene might be smaller than the range of the
 						// cached render queue index range. So, we could add a range check in here to reject renderable managers, but it's not
@@ -351,8 +387,10 @@ namespace Renderer
 						if (renderableManager->getCastShadows())
 						{
 							mRenderQueue.addRenderablesFromRenderableManager(*renderableManager, materialTechniqueId, shadowCompositorContextData, true);
+							++numberOfRenderedShadowCasters;
 						}
 					}
+					mNumberOfRenderedShadowCasters[cascadeIndex] = numberOfRenderedShadowCasters;
 					if (mRenderQueue.getNumberOfDrawCalls() > 0)
 					{
 						mRenderQueue.fillGraphicsCommandBuffer(*mDepthFramebufferPtr, shadowCompositorContextData, commandBuffer);
@@ -449,6 +487,8 @@ namespace Renderer
 		mNumberOfShadowMultisamples(2),
 		mCascadeSplitsLambda(0.99f),
 		mShadowFilterSize(8.0f),
+		mShadowCasterCulling(true),
+		mDepthBasedCascadeFitting(false),
 		mStabilizeCascades(true),
 		// Internal
 		mSettingsGenerationCounter(0),
@@ -467,6 +507,7 @@ namespace Renderer
 		for (int i = 0; i < CompositorResourcePassShadowMap::MAXIMUM_NUMBER_OF_SHADOW_CASCADES; ++i)
 		{
 			mPassData.shadowCascadeScales[i] = Math::VEC4_ONE;
+			mNumberOfRenderedShadowCasters[i] = 0;
 		}
 		createShadowMapRenderTarget();
 	}
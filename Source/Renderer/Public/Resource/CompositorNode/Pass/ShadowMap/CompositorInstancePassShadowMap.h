@@ -179,6 +179,26 @@ namespace Renderer
 			mStabilizeCascades = stabilizeCascades;
 		}
 
+		[[nodiscard]] inline bool getShadowCasterCulling() const
+		{
+			return mShadowCasterCulling;
+		}
+
+		inline void setShadowCasterCulling(bool shadowCasterCulling)
+		{
+			mShadowCasterCulling = shadowCasterCulling;
+		}
+
+		[[nodiscard]] inline bool getDepthBasedCascadeFitting() const
+		{
+			return mDepthBasedCascadeFitting;
+		}
+
+		inline void setDepthBasedCascadeFitting(bool depthBasedCascadeFitting)
+		{
+			mDepthBasedCascadeFitting = depthBasedCascadeFitting;
+		}
+
 		//[-------------------------------------------------------]
 		//[ Internal                                              ]
 		//[-------------------------------------------------------]
@@ -187,6 +207,11 @@ namespace Renderer
 			return mPassData;
 		}
 
+		[[nodiscard]] inline uint32_t getNumberOfRenderedShadowCasters(uint8_t cascadeIndex) const	// Number of shadow casting renderable managers rendered into the given shadow cascade during the last execution
+		{
+			return mNumberOfRenderedShadowCasters[cascadeIndex];
+		}
+
 
 	//[-------------------------------------------------------]
 	//[ Protected virtual Renderer::ICompositorInstancePass methods ]
@@ -223,11 +248,15 @@ namespace Renderer
 		uint8_t  mNumberOfShadowMultisamples;	///< The number of shadow multisamples per pixel (valid values: 1, 2, 4, 8)
 		float	 mCascadeSplitsLambda;			///< Cascade splits lambda
 		float	 mShadowFilterSize;				///< Shadow filter size
+		bool	 mShadowCasterCulling;			///< Cull the shadow casters per shadow cascade against the shadow cascade volume extruded toward the light? If disabled, each shadow cascade renders all shadow casters visible to the camera.
+		bool	 mDepthBasedCascadeFitting;		///< Fit the shadow cascades to the view space depth range of the visible scene items?
 		bool	 mStabilizeCascades;			///< Keeps consistent sizes for each cascade, and snaps each cascade so that they move in texel-sized increments. Reduces temporal aliasing artifacts, but reduces the effective resolution of the cascades. See Valient, M., "Stable Rendering of Cascaded Shadow Maps", In: Engel, W. F ., et al., "ShaderX6: Advanced Rendering Techniques", Charles River Media, 2008, ISBN 1-58450-544-3.
 		// Internal
 		uint32_t					   mSettingsGenerationCounter;	// Most simple solution to detect settings changes which make internal data invalid
 		uint32_t					   mUsedSettingsGenerationCounter;
 		PassData					   mPassData;
+		CompositorWorkspaceInstance::RenderableManagers mShadowCasterRenderableManagers;	///< Culled shadow casters of the current shadow cascade, kept as member to avoid reallocations
+		uint32_t					   mNumberOfRenderedShadowCasters[CompositorResourcePassShadowMap::MAXIMUM_NUMBER_OF_SHADOW_CASCADES];
 		Rhi::IFramebufferPtr		   mDepthFramebufferPtr;
 		Rhi::IFramebufferPtr		   mVarianceFramebufferPtr[CompositorResourcePassShadowMap::MAXIMUM_NUMBER_OF_SHADOW_CASCADES];
 		Rhi::IFramebufferPtr		   mIntermediateFramebufferPtr;
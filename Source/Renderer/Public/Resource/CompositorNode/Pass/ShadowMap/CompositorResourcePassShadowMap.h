@@ -99,6 +99,11 @@ namespace Renderer
 
 		virtual void deserialize(uint32_t numberOfBytes, const uint8_t* data) override;
 
+		inline virtual void getReferencedResources(TextureAssetIds& textureAssetIds, [[maybe_unused]] CompositorFramebufferIds& compositorFramebufferIds) const override
+		{
+			textureAssetIds.push_back(mTextureAssetId);
+		}
+
 
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
@@ -229,13 +229,18 @@ namespace Renderer
 						Rhi::Command::ResetAndBeginQuery::create(mCommandBuffer, *mPipelineStatisticsQueryPoolPtr, mCurrentPipelineStatisticsQueryIndex);
 					}
 				#endif
+				#ifdef RENDERER_PROFILER
+					mRenderer.getContext().getProfiler().beginCommandBufferFrame(mCommandBuffer);
+				#endif
 
 				const CompositorContextData compositorContextData(this, cameraSceneItem, singlePassStereoInstancing, lightSceneItem, mCompositorInstancePassShadowMap);
 				if (nullptr != cameraSceneItem)
 				{
-					// Gather render queue index ranges renderable managers
-					mExecuteOnRenderingSceneItems.clear();
-					cameraSceneItem->getSceneResource().getSceneCullingManager().gatherRenderQueueIndexRangesRenderableManagers(renderTarget, compositorContextData, mRenderQueueIndexRanges, mExecuteOnRenderingSceneItems);
+					{ // Gather render queue index ranges renderable managers
+						RENDERER_PROFILER_SCOPED_CPU_SAMPLE(mRenderer.getContext(), "Culling")
+						mExecuteOnRenderingSceneItems.clear();
+						cameraSceneItem->getSceneResource().getSceneCullingManager().gatherRenderQueueIndexRangesRenderableManagers(renderTarget, compositorContextData, mRenderQueueIndexRanges, mExecuteOnRenderingSceneItems);
+					}
 
 					// Execute on rendering scene items
 					for (ISceneItem* sceneItem : mExecuteOnRenderingSceneItems)
@@ -243,8 +248,10 @@ namespace Renderer
 						sceneItem->onExecuteOnRendering(renderTarget, compositorContextData, mCommandBuffer);
 					}
 
-					// Fill the light buffer manager
-					materialBlueprintResourceManager.getLightBufferManager().fillBuffer(compositorContextData.getWorldSpaceCameraPosition(), cameraSceneItem->getSceneResource(), mCommandBuffer);
+					{ // Fill the light buffer manager
+						RENDERER_PROFILER_SCOPED_CPU_SAMPLE(mRenderer.getContext(), "Light buffer")
+						materialBlueprintResourceManager.getLightBufferManager().fillBuffer(compositorContextData.getWorldSpaceCameraPosition(), cameraSceneItem->getSceneResource(), mCommandBuffer);
+					}
 				}
 
 				{ // Scene rendering
@@ -270,7 +277,10 @@ namespace Renderer
 							Rhi::Command::EndQuery::create(mCommandBuffer, *mPipelineStatisticsQueryPoolPtr, mCurrentPipelineStatisticsQueryIndex);
 						}
 					#endif
-					mCommandBuffer.submitToRhi(rhi);
+					{
+						RENDERER_PROFILER_SCOPED_CPU_SAMPLE(mRenderer.getContext(), "Command buffer submission")
+						mCommandBuffer.submitToRhi(rhi);
+					}
 
 					// The command buffer has been submitted, inform everyone who cares about this
 					for (const CompositorNodeInstance* compositorNodeInstance : mSequentialCompositorNodeInstances)
@@ -419,6 +429,9 @@ namespace Renderer
 				}
 			}
 
+			// Now that all compositor nodes announced their render target textures and framebuffers, tell the render target texture manager when they're used
+			updateRenderTargetTextureLifetimes();
+
 			// Merge the render queue index ranges using the algorithm described at http://stackoverflow.com/a/5276789
 			if (!individualRenderQueueIndexRanges.empty())
 			{
@@ -476,6 +489,55 @@ namespace Renderer
 		destroyFramebuffersAndRenderTargetTextures(true);
 	}
 
+	void CompositorWorkspaceInstance::updateRenderTargetTextureLifetimes() const
+	{
+		CompositorWorkspaceResourceManager& compositorWorkspaceResourceManager = mRenderer.getCompositorWorkspaceResourceManager();
+		RenderTargetTextureManager& renderTargetTextureManager = compositorWorkspaceResourceManager.getRenderTargetTextureManager();
+		const FramebufferManager& framebufferManager = compositorWorkspaceResourceManager.getFramebufferManager();
+		ICompositorResourcePass::TextureAssetIds textureAssetIds;
+		ICompositorResourcePass::CompositorFramebufferIds compositorFramebufferIds;
+		uint32_t passIndex = 0;
+		renderTargetTextureManager.resetRenderTargetTextureLifetimes(*this);
+		for (const CompositorNodeInstance* compositorNodeInstance : mSequentialCompositorNodeInstances)
+		{
+			for (const ICompositorInstancePass* compositorInstancePass : compositorNodeInstance->mCompositorInstancePasses)
+			{
+				// Gather the resources referenced by the compositor pass, including the framebuffer it renders into
+				const ICompositorResourcePass& compositorResourcePass = compositorInstancePass->getCompositorResourcePass();
+				textureAssetIds.clear();
+				compositorFramebufferIds.clear();
+				compositorResourcePass.getReferencedResources(textureAssetIds, compositorFramebufferIds);
+				const CompositorFramebufferId compositorFramebufferId = compositorResourcePass.getCompositorTarget().getCompositorFramebufferId();
+				if (isValid(compositorFramebufferId))
+				{
+					compositorFramebufferIds.push_back(compositorFramebufferId);
+				}
+
+				// Resolve the framebuffer attachments
+				for (const CompositorFramebufferId& referencedCompositorFramebufferId : compositorFramebufferIds)
+				{
+					const FramebufferSignature* framebufferSignature = framebufferManager.getFramebufferSignatureByCompositorFramebufferId(referencedCompositorFramebufferId);
+					if (nullptr != framebufferSignature)
+					{
+						const uint8_t numberOfColorAttachments = framebufferSignature->getNumberOfColorAttachments();
+						for (uint8_t i = 0; i < numberOfColorAttachments; ++i)
+						{
+							textureAssetIds.push_back(framebufferSignature->getColorFramebufferSignatureAttachment(i).textureAssetId);
+						}
+						textureAssetIds.push_back(framebufferSignature->getDepthStencilFramebufferSignatureAttachment().textureAssetId);
+					}
+				}
+
+				// Extend the render target texture lifetimes, unknown and invalid texture asset IDs are ignored by the render target texture manager
+				for (const AssetId& textureAssetId : textureAssetIds)
+				{
+					renderTargetTextureManager.updateRenderTargetTextureLifetime(textureAssetId, *this, passIndex);
+				}
+				++passIndex;
+			}
+		}
+	}
+
 	void CompositorWorkspaceInstance::createFramebuffersAndRenderTargetTextures(const Rhi::IRenderTarget& mainRenderTarget)
 	{
 		RHI_ASSERT(mRenderer.getContext(), !mFramebufferManagerInitialized, "Framebuffer manager is already initialized")
@@ -526,6 +588,7 @@ namespace Renderer
 			{
 				compositorInstancePass->mRenderTarget = nullptr;
 				compositorInstancePass->mNumberOfExecutionRequests = 0;
+				compositorInstancePass->invalidateCachedCommandBuffer();
 			}
 		}
 
@@ -95,6 +95,9 @@ namespace Renderer
 			MaterialBlueprintResource* materialBlueprintResource = materialBlueprintResourceManager.tryGetById(materialBlueprintResourceId);
 			if (nullptr != materialBlueprintResource)
 			{
+				// The material properties of the material blueprint resource are needed right now, so we have to block until it's fully loaded
+				materialBlueprintResource->enforceFullyLoaded();
+
 				// TODO(co) Possible optimization: Right now we don't filter for "Renderer::MaterialProperty::Usage::GLOBAL_REFERENCE_FALLBACK" properties.
 				//          Only the material blueprint resource needs to store such properties while they're useless inside material resources. The filtering
 				//          makes the following more complex and it might not bring any real benefit. So, review this place in here later when we have more pressure on the system.
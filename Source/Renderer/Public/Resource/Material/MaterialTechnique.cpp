@@ -31,6 +31,7 @@
 #include "Renderer/Public/Resource/Texture/TextureResource.h"
 #include "Renderer/Public/Resource/RendererResourceManager.h"
 #include "Renderer/Public/Core/Math/Math.h"
+#include "Renderer/Public/Core/Memory/FrameAllocator.h"
 #include "Renderer/Public/IRenderer.h"
 
 
@@ -132,6 +133,19 @@ namespace Renderer
 		fillCommandBuffer(renderer, resourceGroupRootParameterIndex, resourceGroup);
 	}
 
+	void MaterialTechnique::setTextureStreamingFeedback(const IRenderer& renderer, float screenSpaceSize)
+	{
+		// Gathering the textures also ensures the texture resources exist so they receive the feedback from the very first frame on
+		TextureResourceManager& textureResourceManager = renderer.getTextureResourceManager();
+		for (const Texture& texture : getTextures(renderer))
+		{
+			if (MaterialProperty::Usage::TEXTURE_REFERENCE == texture.materialProperty.getUsage() && isValid(texture.materialProperty.getMaterialPropertyId()))
+			{
+				textureResourceManager.setTextureStreamingFeedback(texture.textureResourceId, screenSpaceSize);
+			}
+		}
+	}
+
 
 	//[-------------------------------------------------------]
 	//[ Protected virtual Renderer::IResourceListener methods ]
@@ -324,9 +338,10 @@ namespace Renderer
 				const MaterialBlueprintResource* materialBlueprintResource = getMaterialResourceManager().getRenderer().getMaterialBlueprintResourceManager().tryGetById(mMaterialBlueprintResourceId);
 				RHI_ASSERT(renderer.getContext(), nullptr != materialBlueprintResource, "Invalid material blueprint resource")
 
-				// Create texture resource group
-				std::vector<Rhi::IResource*> resources;
-				std::vector<Rhi::ISamplerState*> samplerStates;
+				// Create texture resource group, the temporary lists are only needed until the resource group has been created
+				FrameAllocator& frameAllocator = renderer.getFrameAllocator();
+				FrameVector<Rhi::IResource*> resources{FrameStlAllocator<Rhi::IResource*>(frameAllocator)};
+				FrameVector<Rhi::ISamplerState*> samplerStates{FrameStlAllocator<Rhi::ISamplerState*>(frameAllocator)};
 				uint32_t textureStartIndex = 0;
 				if (nullptr != mStructuredBufferPtr)
 				{
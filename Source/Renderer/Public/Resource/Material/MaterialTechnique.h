@@ -184,6 +184,20 @@ namespace Renderer
 		*/
 		void fillComputeCommandBuffer(const IRenderer& renderer, Rhi::CommandBuffer& commandBuffer, uint32_t& resourceGroupRootParameterIndex, Rhi::IResourceGroup** resourceGroup);
 
+		/**
+		*  @brief
+		*    Provide the texture streaming with the on-screen size of visible geometry using this material technique
+		*
+		*  @param[in] renderer
+		*    Renderer to use
+		*  @param[in] screenSpaceSize
+		*    On-screen size in pixels of the visible geometry using this material technique
+		*
+		*  @note
+		*    - Only material textures are taken into account, material blueprint textures which can't be changed by materials (e.g. global lookup textures) are kept at full resolution
+		*/
+		void setTextureStreamingFeedback(const IRenderer& renderer, float screenSpaceSize);
+
 
 	//[-------------------------------------------------------]
 	//[ Protected virtual Renderer::IResourceListener methods ]
@@ -253,7 +253,14 @@ namespace Renderer
 		{ // Fill the texture buffer
 			{ // "POSITION_ROTATION_SCALE"-semantic
 				// xyz position adjusted for camera relative rendering: While we're using a 64 bit world space position in general, for relative positions 32 bit are sufficient
-				const glm::vec3 position = objectSpaceToWorldSpaceTransform.position - worldSpaceCameraPosition;
+				// -> Quantized positions are dequantized by folding the object space offset and scale into the transform: rotation * (scale * (dequantizationScale * p + dequantizationOffset)) + position
+				glm::vec3 position = objectSpaceToWorldSpaceTransform.position - worldSpaceCameraPosition;
+				glm::vec3 scale = objectSpaceToWorldSpaceTransform.scale;
+				if (renderable.hasQuantizedPositions())
+				{
+					position += objectSpaceToWorldSpaceTransform.rotation * (scale * renderable.getPositionDequantizationOffset());
+					scale *= renderable.getPositionDequantizationScale();
+				}
 				memcpy(mCurrentTextureBufferPointer, glm::value_ptr(position), sizeof(float) * 3);
 				mCurrentTextureBufferPointer += 4;
 
@@ -264,7 +271,7 @@ namespace Renderer
 				mCurrentTextureBufferPointer += 4;
 
 				// xyz scale
-				memcpy(mCurrentTextureBufferPointer, glm::value_ptr(objectSpaceToWorldSpaceTransform.scale), sizeof(float) * 3);
+				memcpy(mCurrentTextureBufferPointer, glm::value_ptr(scale), sizeof(float) * 3);
 				mCurrentTextureBufferPointer += 4;
 			}
 
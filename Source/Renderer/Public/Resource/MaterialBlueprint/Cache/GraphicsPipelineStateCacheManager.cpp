@@ -26,8 +26,14 @@
 #include "Renderer/Public/Resource/MaterialBlueprint/Cache/GraphicsPipelineStateCache.h"
 #include "Renderer/Public/Resource/MaterialBlueprint/MaterialBlueprintResourceManager.h"
 #include "Renderer/Public/Resource/MaterialBlueprint/MaterialBlueprintResource.h"
+#include "Renderer/Public/Resource/ShaderBlueprint/ShaderBlueprintResourceManager.h"
+#include "Renderer/Public/Resource/ShaderBlueprint/ShaderBlueprintResource.h"
+#include "Renderer/Public/Core/Time/Stopwatch.h"
+#include "Renderer/Public/Core/Math/Math.h"
 #include "Renderer/Public/IRenderer.h"
 
+#include <algorithm>
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -84,7 +90,7 @@ namespace Renderer
 
 		// Create the new graphics pipeline state cache instance
 		GraphicsPipelineStateCache* graphicsPipelineStateCache = new GraphicsPipelineStateCache(mTemporaryGraphicsPipelineStateSignature);
-		mGraphicsPipelineStateCacheByGraphicsPipelineStateSignatureId.emplace(mTemporaryGraphicsPipelineStateSignature.getGraphicsPipelineStateSignatureId(), graphicsPipelineStateCache);
+		registerGraphicsPipelineStateCache(*graphicsPipelineStateCache);
 		mPipelineStateObjectCacheNeedSaving = true;
 
 		// If we've got a fallback graphics pipeline state cache then commit the asynchronous pipeline state compiler request now, else we must proceed synchronous (risk of notable runtime hiccups)
@@ -111,6 +117,20 @@ namespace Renderer
 	}
 
 	void GraphicsPipelineStateCacheManager::clearCache()
+	{
+		if (!mGraphicsPipelineStateCacheByGraphicsPipelineStateSignatureId.empty())
+		{
+			// Compiler requests inside the graphics pipeline state compiler stages reference the graphics pipeline state caches we're about to destroy
+			mMaterialBlueprintResource.getResourceManager<MaterialBlueprintResourceManager>().getRenderer().getGraphicsPipelineStateCompiler().flushInFlightCompilerRequests();
+			destroyGraphicsPipelineStateCaches();
+		}
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	void GraphicsPipelineStateCacheManager::destroyGraphicsPipelineStateCaches()
 	{
 		if (!mGraphicsPipelineStateCacheByGraphicsPipelineStateSignatureId.empty())
 		{
@@ -119,76 +139,97 @@ namespace Renderer
 				delete graphicsPipelineStateCacheElement.second;
 			}
 			mGraphicsPipelineStateCacheByGraphicsPipelineStateSignatureId.clear();
+			mGraphicsPipelineStateCacheByFallbackKey.clear();
 			mPipelineStateObjectCacheNeedSaving = true;
 		}
 	}
 
+	void GraphicsPipelineStateCacheManager::registerGraphicsPipelineStateCache(GraphicsPipelineStateCache& graphicsPipelineStateCache)
+	{
+		const GraphicsPipelineStateSignature& graphicsPipelineStateSignature = graphicsPipelineStateCache.getGraphicsPipelineStateSignature();
+		mGraphicsPipelineStateCacheByGraphicsPipelineStateSignatureId.emplace(graphicsPipelineStateSignature.getGraphicsPipelineStateSignatureId(), &graphicsPipelineStateCache);
+
+		// Index the graphics pipeline state cache by its fallback key, the first registered graphics pipeline state cache wins
+		mGraphicsPipelineStateCacheByFallbackKey.emplace(gatherFallbackProperties(graphicsPipelineStateSignature.getSerializedGraphicsPipelineStateHash(), graphicsPipelineStateSignature.getShaderProperties()), &graphicsPipelineStateCache);
+	}
 
-	//[-------------------------------------------------------]
-	//[ Private methods                                       ]
-	//[-------------------------------------------------------]
 	GraphicsPipelineStateCache* GraphicsPipelineStateCacheManager::getFallbackGraphicsPipelineStateCache(uint32_t serializedGraphicsPipelineStateHash, const ShaderProperties& shaderProperties)
 	{
 		// Look for a suitable already available pipeline state cache which content we can use as fallback while the pipeline state compiler is working. We
 		// do this by reducing the shader properties set until we find something, hopefully. In case no fallback can be found we have to switch to synchronous processing.
+		// -> The fallback ordering is computed once: The most useless shader property is sacrificed first, mandatory shader combination shader properties are never removed
+		// -> Each reduced shader properties set is probed by using the fallback key index, there's no need to generate a graphics pipeline state signature per probe
+		const Stopwatch stopwatch(true);
+		++mNumberOfFallbackLookups;
+		uint32_t fallbackKey = gatherFallbackProperties(serializedGraphicsPipelineStateHash, shaderProperties);
+		std::stable_sort(mFallbackProperties.begin(), mFallbackProperties.end(), [](const FallbackProperty& left, const FallbackProperty& right) { return (left.visualImportance < right.visualImportance); });
+
+		// Sacrifice one victim after another
+		GraphicsPipelineStateCache* fallbackGraphicsPipelineStateCache = nullptr;
+		for (const FallbackProperty& fallbackProperty : mFallbackProperties)
+		{
+			if (MaterialBlueprintResource::MANDATORY_SHADER_PROPERTY == fallbackProperty.visualImportance)
+			{
+				// No chance, no goats left
+				break;
+			}
+			fallbackKey -= fallbackProperty.hash;
+			++mNumberOfFallbackProbes;
+			GraphicsPipelineStateCacheByFallbackKey::const_iterator iterator = mGraphicsPipelineStateCacheByFallbackKey.find(fallbackKey);
+			if (iterator != mGraphicsPipelineStateCacheByFallbackKey.cend())
+			{
+				// We don't care whether or not the graphics pipeline state cache is currently using fallback data due to asynchronous complication
+				fallbackGraphicsPipelineStateCache = iterator->second;
+				break;
+			}
+		}
+
+		// Done
+		mFallbackLookupMicroseconds += stopwatch.getMicroseconds();
+		return fallbackGraphicsPipelineStateCache;
+	}
 
-		// Start with the full shader properties and then clear one shader property after another
-		mFallbackShaderProperties = shaderProperties;
-		ShaderProperties::SortedPropertyVector& sortedFallbackPropertyVector = mFallbackShaderProperties.getSortedPropertyVector();
-		while (!sortedFallbackPropertyVector.empty())
+	uint32_t GraphicsPipelineStateCacheManager::gatherFallbackProperties(uint32_t serializedGraphicsPipelineStateHash, const ShaderProperties& shaderProperties)
+	{
+		// Gather the referenced shader properties of the shader blueprints used by the material blueprint
+		const ShaderProperties* referencedShaderProperties[NUMBER_OF_GRAPHICS_SHADER_TYPES] = {};
+		uint8_t numberOfReferencedShaderProperties = 0;
+		const ShaderBlueprintResourceManager& shaderBlueprintResourceManager = mMaterialBlueprintResource.getResourceManager<MaterialBlueprintResourceManager>().getRenderer().getShaderBlueprintResourceManager();
+		for (uint8_t i = 0; i < NUMBER_OF_GRAPHICS_SHADER_TYPES; ++i)
 		{
-			{ // Remove a fallback shader property
-				// Find the most useless shader property, we're going to sacrifice it
-				ShaderProperties::SortedPropertyVector::iterator worstHitShaderPropertyIterator = sortedFallbackPropertyVector.end();
-				int32_t worstHitVisualImportanceOfShaderProperty = getInvalid<int32_t>();
-				ShaderProperties::SortedPropertyVector::iterator iterator = sortedFallbackPropertyVector.begin();
-				while (iterator != sortedFallbackPropertyVector.end())
-				{
-					// Do not remove mandatory shader combination shader properties, at least not inside this pass
-					const int32_t visualImportanceOfShaderProperty = mMaterialBlueprintResource.getVisualImportanceOfShaderProperty(iterator->shaderPropertyId);
-					if (MaterialBlueprintResource::MANDATORY_SHADER_PROPERTY != visualImportanceOfShaderProperty)
-					{
-						if (isValid(worstHitVisualImportanceOfShaderProperty))
-						{
-							// Lower visual importance value = lower probability that someone will miss the shader property
-							if (worstHitVisualImportanceOfShaderProperty > visualImportanceOfShaderProperty)
-							{
-								worstHitVisualImportanceOfShaderProperty = visualImportanceOfShaderProperty;
-								worstHitShaderPropertyIterator = iterator;
-							}
-						}
-						else
-						{
-							worstHitShaderPropertyIterator = iterator;
-							worstHitVisualImportanceOfShaderProperty = visualImportanceOfShaderProperty;
-						}
-					}
-
-					// Next shader property on the to-kill-list, please
-					++iterator;
-				}
+			const ShaderBlueprintResource* shaderBlueprintResource = shaderBlueprintResourceManager.tryGetById(mMaterialBlueprintResource.getGraphicsShaderBlueprintResourceId(static_cast<GraphicsShaderType>(i)));
+			if (nullptr != shaderBlueprintResource)
+			{
+				referencedShaderProperties[numberOfReferencedShaderProperties] = &shaderBlueprintResource->getReferencedShaderProperties();
+				++numberOfReferencedShaderProperties;
+			}
+		}
 
-				// Sacrifice our victim
-				if (sortedFallbackPropertyVector.end() == worstHitShaderPropertyIterator)
+		// Gather the shader properties which have an influence on the graphics pipeline state signature
+		uint32_t fallbackKey = Math::calculateFNV1a32(reinterpret_cast<const uint8_t*>(&serializedGraphicsPipelineStateHash), sizeof(uint32_t));
+		if (shaderProperties.hasPropertyValue(MaterialBlueprintResource::USE_QUANTIZED_VERTICES))
+		{
+			// The vertex attributes must always match the vertex data, so the build-in "UseQuantizedVertices"-property is never sacrificed
+			fallbackKey = Math::calculateFNV1a32(reinterpret_cast<const uint8_t*>(&MaterialBlueprintResource::USE_QUANTIZED_VERTICES), sizeof(uint32_t), fallbackKey);
+		}
+		mFallbackProperties.clear();
+		for (const ShaderProperties::Property& property : shaderProperties.getSortedPropertyVector())
+		{
+			for (uint8_t i = 0; i < numberOfReferencedShaderProperties; ++i)
+			{
+				if (referencedShaderProperties[i]->hasPropertyValue(property.shaderPropertyId))
 				{
-					// No chance, no goats left
+					uint32_t hash = Math::calculateFNV1a32(reinterpret_cast<const uint8_t*>(&property.shaderPropertyId), sizeof(uint32_t));
+					hash = Math::calculateFNV1a32(reinterpret_cast<const uint8_t*>(&property.value), sizeof(int32_t), hash);
+					mFallbackProperties.push_back({hash, mMaterialBlueprintResource.getVisualImportanceOfShaderProperty(property.shaderPropertyId)});
+					fallbackKey += hash;
 					break;
 				}
-				sortedFallbackPropertyVector.erase(worstHitShaderPropertyIterator);
-			}
-
-			// Generate the current fallback graphics pipeline state signature
-			mFallbackGraphicsPipelineStateSignature.set(mMaterialBlueprintResource, serializedGraphicsPipelineStateHash, mFallbackShaderProperties);
-			GraphicsPipelineStateCacheByGraphicsPipelineStateSignatureId::const_iterator iterator = mGraphicsPipelineStateCacheByGraphicsPipelineStateSignatureId.find(mFallbackGraphicsPipelineStateSignature.getGraphicsPipelineStateSignatureId());
-			if (iterator != mGraphicsPipelineStateCacheByGraphicsPipelineStateSignatureId.cend())
-			{
-				// We don't care whether or not the graphics pipeline state cache is currently using fallback data due to asynchronous complication
-				return iterator->second;
 			}
 		}
 
-		// No fallback graphics pipeline state cache found
-		return nullptr;
+		// Done
+		return fallbackKey;
 	}
 
 	void GraphicsPipelineStateCacheManager::loadPipelineStateObjectCache(IFile& file)
@@ -224,7 +265,7 @@ namespace Renderer
 			// Register
 			mTemporaryGraphicsPipelineStateSignature.set(mMaterialBlueprintResource, serializedGraphicsPipelineStateHash, shaderProperties);
 			GraphicsPipelineStateCache* graphicsPipelineStateCache = new GraphicsPipelineStateCache(mTemporaryGraphicsPipelineStateSignature);
-			mGraphicsPipelineStateCacheByGraphicsPipelineStateSignatureId.emplace(mTemporaryGraphicsPipelineStateSignature.getGraphicsPipelineStateSignatureId(), graphicsPipelineStateCache);
+			registerGraphicsPipelineStateCache(*graphicsPipelineStateCache);
 			graphicsPipelineStateCompiler.instantSynchronousCompilerRequest(mMaterialBlueprintResource, *graphicsPipelineStateCache);
 		}
 
@@ -40,7 +40,9 @@ PRAGMA_WARNING_PUSH
 	PRAGMA_WARNING_DISABLE_MSVC(4774)	// warning C4774: 'sprintf_s' : format string expected in argument 3 is not a string literal
 	PRAGMA_WARNING_DISABLE_MSVC(5026)	// warning C5026: 'std::_Generic_error_category': move constructor was implicitly defined as deleted
 	PRAGMA_WARNING_DISABLE_MSVC(5027)	// warning C5027: 'std::_Generic_error_category': move assignment operator was implicitly defined as deleted
+	#include <ctime>
 	#include <string>
+	#include <vector>
 PRAGMA_WARNING_POP
 
 
@@ -169,9 +171,44 @@ namespace Renderer
 		/**
 		*  @brief
 		*    Clear the pipeline state cache manager
+		*
+		*  @note
+		*    - Waits until the graphics pipeline state compiler has dispatched all in flight compiler requests, they might reference graphics pipeline state caches of this manager
 		*/
 		void clearCache();
 
+		//[-------------------------------------------------------]
+		//[ Fallback statistics                                   ]
+		//[-------------------------------------------------------]
+		[[nodiscard]] inline uint32_t getNumberOfFallbackLookups() const
+		{
+			return mNumberOfFallbackLookups;
+		}
+
+		[[nodiscard]] inline uint32_t getNumberOfFallbackProbes() const
+		{
+			return mNumberOfFallbackProbes;
+		}
+
+		/**
+		*  @brief
+		*    Return the accumulated time spent inside fallback graphics pipeline state cache lookups
+		*
+		*  @return
+		*    Accumulated fallback lookup time in microseconds
+		*/
+		[[nodiscard]] inline std::time_t getFallbackLookupMicroseconds() const
+		{
+			return mFallbackLookupMicroseconds;
+		}
+
+		inline void resetFallbackStatistics()
+		{
+			mNumberOfFallbackLookups = 0;
+			mNumberOfFallbackProbes = 0;
+			mFallbackLookupMicroseconds = 0;
+		}
+
 
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
@@ -180,7 +217,10 @@ namespace Renderer
 		inline explicit GraphicsPipelineStateCacheManager(MaterialBlueprintResource& materialBlueprintResource) :
 			mMaterialBlueprintResource(materialBlueprintResource),
 			mGraphicsProgramCacheManager(*this),
-			mPipelineStateObjectCacheNeedSaving(false)
+			mPipelineStateObjectCacheNeedSaving(false),
+			mNumberOfFallbackLookups(0),
+			mNumberOfFallbackProbes(0),
+			mFallbackLookupMicroseconds(0)
 		{
 			// Nothing here
 		}
@@ -189,13 +229,34 @@ namespace Renderer
 
 		inline ~GraphicsPipelineStateCacheManager()
 		{
-			clearCache();
+			// The graphics pipeline state compiler is already destroyed at this point in time, so there are no in flight compiler requests left
+			destroyGraphicsPipelineStateCaches();
 		}
 
 		GraphicsPipelineStateCacheManager& operator=(const GraphicsPipelineStateCacheManager&) = delete;
 
+		void destroyGraphicsPipelineStateCaches();
+		void registerGraphicsPipelineStateCache(GraphicsPipelineStateCache& graphicsPipelineStateCache);
 		GraphicsPipelineStateCache* getFallbackGraphicsPipelineStateCache(uint32_t serializedGraphicsPipelineStateHash, const ShaderProperties& shaderProperties);
 
+		/**
+		*  @brief
+		*    Gather the shader properties which have an influence on the graphics pipeline state signature and generate the fallback key
+		*
+		*  @param[in] serializedGraphicsPipelineStateHash
+		*    FNV1a hash of "Rhi::SerializedGraphicsPipelineState"
+		*  @param[in] shaderProperties
+		*    Shader properties to gather
+		*
+		*  @return
+		*    The fallback key, "Renderer::GraphicsPipelineStateCacheManager::mFallbackProperties" is filled with the gathered shader properties
+		*
+		*  @note
+		*    - Shader properties not referenced by any shader blueprint of the material blueprint are skipped since they don't influence the graphics pipeline state signature
+		*    - The fallback key is the sum of the shader property hashes, hence it's independent of the shader property order and a shader property can be removed by subtracting its hash
+		*/
+		[[nodiscard]] uint32_t gatherFallbackProperties(uint32_t serializedGraphicsPipelineStateHash, const ShaderProperties& shaderProperties);
+
 		//[-------------------------------------------------------]
 		//[ Pipeline state object cache                           ]
 		//[-------------------------------------------------------]
@@ -214,21 +275,34 @@ namespace Renderer
 	//[-------------------------------------------------------]
 	private:
 		typedef std::unordered_map<GraphicsPipelineStateSignatureId, GraphicsPipelineStateCache*> GraphicsPipelineStateCacheByGraphicsPipelineStateSignatureId;
+		typedef std::unordered_map<uint32_t, GraphicsPipelineStateCache*> GraphicsPipelineStateCacheByFallbackKey;
+
+		struct FallbackProperty final
+		{
+			uint32_t hash;				///< FNV1a hash of the shader property ID and value
+			int32_t  visualImportance;	///< Visual importance of the shader property, "Renderer::MaterialBlueprintResource::MANDATORY_SHADER_PROPERTY" for mandatory shader properties
+		};
+		typedef std::vector<FallbackProperty> FallbackProperties;
 
 
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
-		MaterialBlueprintResource&									 mMaterialBlueprintResource;			///< Owner material blueprint resource
+		MaterialBlueprintResource&									 mMaterialBlueprintResource;				///< Owner material blueprint resource
 		GraphicsProgramCacheManager									 mGraphicsProgramCacheManager;
 		GraphicsPipelineStateCacheByGraphicsPipelineStateSignatureId mGraphicsPipelineStateCacheByGraphicsPipelineStateSignatureId;
-		bool														 mPipelineStateObjectCacheNeedSaving;	///< "true" if a cache needs saving due to changes during runtime, else "false"
+		bool														 mPipelineStateObjectCacheNeedSaving;		///< "true" if a cache needs saving due to changes during runtime, else "false"
+		GraphicsPipelineStateCacheByFallbackKey						 mGraphicsPipelineStateCacheByFallbackKey;	///< Index of the graphics pipeline state caches by their reduced shader property set, see "Renderer::GraphicsPipelineStateCacheManager::gatherFallbackProperties()"
+
+		// Fallback statistics
+		uint32_t	 mNumberOfFallbackLookups;
+		uint32_t	 mNumberOfFallbackProbes;
+		std::time_t	 mFallbackLookupMicroseconds;
 
 		// Temporary instances to reduce the number of memory allocations/deallocations
 		GraphicsPipelineStateSignature mTemporaryGraphicsPipelineStateSignature;
-		ShaderProperties			   mFallbackShaderProperties;
-		GraphicsPipelineStateSignature mFallbackGraphicsPipelineStateSignature;
+		FallbackProperties			   mFallbackProperties;
 
 
 	};
@@ -93,25 +93,17 @@ namespace Renderer
 		}
 	}
 
+	void GraphicsPipelineStateCompiler::resetStatistics()
+	{
+		mNumberOfDispatchedCompilerRequests = 0;
+		mBuilderStageMicroseconds = 0;
+		mCompilerStageMicroseconds = 0;
+		mDispatchStageMicroseconds = 0;
+	}
+
 	void GraphicsPipelineStateCompiler::dispatch()
 	{
-		// Synchronous dispatch
-		// TODO(co) Add maximum dispatch time budget
-		// TODO(co) More clever mutex usage in order to reduce pipeline state compiler stalls due to synchronization
-		std::lock_guard<std::mutex> dispatchMutexLock(mDispatchMutex);
-		while (!mDispatchQueue.empty())
-		{
-			// Get the compiler request
-			CompilerRequest compilerRequest(mDispatchQueue.back());
-			mDispatchQueue.pop_back();
-
-			// Tell the graphics pipeline state cache about the real compiled graphics pipeline state object
-			GraphicsPipelineStateCache& graphicsPipelineStateCache = compilerRequest.graphicsPipelineStateCache;
-			graphicsPipelineStateCache.mGraphicsPipelineStateObjectPtr = compilerRequest.graphicsPipelineStateObject;
-			graphicsPipelineStateCache.mIsUsingFallback = false;
-			RHI_ASSERT(mRenderer.getContext(), 0 != mNumberOfInFlightCompilerRequests, "Invalid number of in flight compiler requests")
-			--mNumberOfInFlightCompilerRequests;
-		}
+		dispatchCompilerRequests(mMaximumDispatchTimeBudget);
 	}
 
 
@@ -125,7 +117,15 @@ namespace Renderer
 		mNumberOfInFlightCompilerRequests(0),
 		mShutdownBuilderThread(false),
 		mBuilderThread(&GraphicsPipelineStateCompiler::builderThreadWorker, this),
-		mShutdownCompilerThread(false)
+		mShutdownCompilerThread(false),
+		mMaximumDispatchTimeBudget(1000),
+		mNumberOfBuilderStageRequests(0),
+		mNumberOfCompilerStageRequests(0),
+		mNumberOfDispatchStageRequests(0),
+		mNumberOfDispatchedCompilerRequests(0),
+		mBuilderStageMicroseconds(0),
+		mCompilerStageMicroseconds(0),
+		mDispatchStageMicroseconds(0)
 	{
 		// Create and start the threads
 		setNumberOfCompilerThreads(2);
@@ -147,6 +147,7 @@ namespace Renderer
 		// Push the load request into the builder queue
 		RHI_ASSERT(mRenderer.getContext(), mAsynchronousCompilationEnabled, "Asynchronous compilation isn't enabled")
 		++mNumberOfInFlightCompilerRequests;
+		++mNumberOfBuilderStageRequests;
 		std::unique_lock<std::mutex> builderMutexLock(mBuilderMutex);
 		mBuilderQueue.emplace_back(CompilerRequest(graphicsPipelineStateCache));
 		builderMutexLock.unlock();
@@ -163,7 +164,7 @@ namespace Renderer
 			const Rhi::IGraphicsProgramPtr& graphicsProgramPtr = graphicsProgramCache->getGraphicsProgramPtr();
 			if (nullptr != graphicsProgramPtr)
 			{
-				graphicsPipelineStateCache.mGraphicsPipelineStateObjectPtr = createGraphicsPipelineState(materialBlueprintResource, graphicsPipelineStateSignature.getSerializedGraphicsPipelineStateHash(), *graphicsProgramPtr);
+				graphicsPipelineStateCache.mGraphicsPipelineStateObjectPtr = createGraphicsPipelineState(materialBlueprintResource, graphicsPipelineStateSignature, *graphicsProgramPtr);
 			}
 		}
 	}
@@ -177,7 +178,7 @@ namespace Renderer
 				std::lock_guard<std::mutex> compilerMutexLock(mutex);
 				everythingFlushed = compilerRequests.empty();
 			}
-			dispatch();
+			dispatchCompilerRequests(0);
 
 			// Wait for a moment to not totally pollute the CPU
 			if (!everythingFlushed)
@@ -188,6 +189,84 @@ namespace Renderer
 		} while (!everythingFlushed);
 	}
 
+	void GraphicsPipelineStateCompiler::flushInFlightCompilerRequests()
+	{
+		while (0 != mNumberOfInFlightCompilerRequests)
+		{
+			dispatchCompilerRequests(0);
+
+			// Wait for a moment to not totally pollute the CPU
+			if (0 != mNumberOfInFlightCompilerRequests)
+			{
+				using namespace std::chrono_literals;
+				std::this_thread::sleep_for(1ms);
+			}
+		}
+	}
+
+	void GraphicsPipelineStateCompiler::dispatchCompilerRequests(std::time_t maximumDispatchTimeBudget)
+	{
+		// Take over the compiler requests which are ready for dispatch
+		// -> The dispatch mutex is only held for swapping the queue so the builder and compiler threads aren't stalled by the main thread
+		if (0 != mNumberOfDispatchStageRequests)
+		{
+			CompilerRequests compilerRequests;
+			{
+				std::lock_guard<std::mutex> dispatchMutexLock(mDispatchMutex);
+				compilerRequests.swap(mDispatchQueue);
+			}
+			if (mPendingDispatchQueue.empty())
+			{
+				mPendingDispatchQueue.swap(compilerRequests);
+			}
+			else
+			{
+				for (const CompilerRequest& compilerRequest : compilerRequests)
+				{
+					mPendingDispatchQueue.emplace_back(compilerRequest);
+				}
+			}
+		}
+
+		// Synchronous dispatch, oldest compiler requests first
+		// -> At least one compiler request is dispatched per call to ensure progress, remaining compiler requests exceeding the time budget are dispatched during the next call
+		const Stopwatch stopwatch(0 != maximumDispatchTimeBudget);
+		while (!mPendingDispatchQueue.empty())
+		{
+			{ // Tell the graphics pipeline state cache about the real compiled graphics pipeline state object
+				const CompilerRequest& compilerRequest = mPendingDispatchQueue.front();
+				GraphicsPipelineStateCache& graphicsPipelineStateCache = compilerRequest.graphicsPipelineStateCache;
+				graphicsPipelineStateCache.mGraphicsPipelineStateObjectPtr = compilerRequest.graphicsPipelineStateObject;
+				graphicsPipelineStateCache.mIsUsingFallback = false;
+				mDispatchStageMicroseconds += compilerRequest.stageStopwatch.getMicroseconds();
+			}
+			mPendingDispatchQueue.pop_front();
+			RHI_ASSERT(mRenderer.getContext(), 0 != mNumberOfInFlightCompilerRequests, "Invalid number of in flight compiler requests")
+			--mNumberOfInFlightCompilerRequests;
+			--mNumberOfDispatchStageRequests;
+			++mNumberOfDispatchedCompilerRequests;
+
+			// Time budget exceeded?
+			if (0 != maximumDispatchTimeBudget && stopwatch.getMicroseconds() >= maximumDispatchTimeBudget)
+			{
+				break;
+			}
+		}
+	}
+
+	void GraphicsPipelineStateCompiler::pushToDispatchQueue(CompilerRequest& compilerRequest, std::atomic<std::time_t>& stageMicroseconds, std::atomic<uint32_t>& numberOfStageRequests)
+	{
+		// Leave the current stage
+		stageMicroseconds += compilerRequest.stageStopwatch.getMicroseconds();
+		compilerRequest.stageStopwatch.start();
+		--numberOfStageRequests;
+
+		// Push the compiler request into the queue of the synchronous shader dispatch
+		std::lock_guard<std::mutex> dispatchMutexLock(mDispatchMutex);
+		mDispatchQueue.emplace_back(compilerRequest);
+		++mNumberOfDispatchStageRequests;
+	}
+
 	void GraphicsPipelineStateCompiler::builderThreadWorker()
 	{
 		const MaterialBlueprintResourceManager& materialBlueprintResourceManager = mRenderer.getMaterialBlueprintResourceManager();
@@ -238,7 +317,7 @@ namespace Renderer
 							// Shortcut since the graphics program cache entry already exists: Just create the graphics pipeline state and be done with it
 
 							// Create the graphics pipeline state object (PSO)
-							compilerRequest.graphicsPipelineStateObject = createGraphicsPipelineState(materialBlueprintResource, graphicsPipelineStateSignature.getSerializedGraphicsPipelineStateHash(), *iterator->second->getGraphicsProgramPtr());
+							compilerRequest.graphicsPipelineStateObject = createGraphicsPipelineState(materialBlueprintResource, graphicsPipelineStateSignature, *iterator->second->getGraphicsProgramPtr());
 							pushToCompilerQueue = false;
 						}
 						else
@@ -336,6 +415,10 @@ namespace Renderer
 					if (pushToCompilerQueue)
 					{
 						// Push the compiler request into the queue of the asynchronous shader compilation
+						mBuilderStageMicroseconds += compilerRequest.stageStopwatch.getMicroseconds();
+						compilerRequest.stageStopwatch.start();
+						--mNumberOfBuilderStageRequests;
+						++mNumberOfCompilerStageRequests;
 						std::unique_lock<std::mutex> compilerMutexLock(mCompilerMutex);
 						mCompilerQueue.emplace_back(compilerRequest);
 						compilerMutexLock.unlock();
@@ -344,8 +427,7 @@ namespace Renderer
 					else
 					{
 						// Shortcut: Push the compiler request into the queue of the synchronous shader dispatch
-						std::lock_guard<std::mutex> dispatchMutexLock(mDispatchMutex);
-						mDispatchQueue.emplace_back(compilerRequest);
+						pushToDispatchQueue(compilerRequest, mBuilderStageMicroseconds, mNumberOfBuilderStageRequests);
 					}
 
 					// We're ready for the next round
@@ -399,8 +481,9 @@ namespace Renderer
 								{
 									case GraphicsShaderType::Vertex:
 									{
-										const MaterialBlueprintResource& materialBlueprintResource = materialBlueprintResourceManager.getById(compilerRequest.graphicsPipelineStateCache.getGraphicsPipelineStateSignature().getMaterialBlueprintResourceId());
-										const Rhi::VertexAttributes& vertexAttributes = mRenderer.getVertexAttributesResourceManager().getById(materialBlueprintResource.getVertexAttributesResourceId()).getVertexAttributes();
+										const GraphicsPipelineStateSignature& graphicsPipelineStateSignature = compilerRequest.graphicsPipelineStateCache.getGraphicsPipelineStateSignature();
+										const MaterialBlueprintResource& materialBlueprintResource = materialBlueprintResourceManager.getById(graphicsPipelineStateSignature.getMaterialBlueprintResourceId());
+										const Rhi::VertexAttributes& vertexAttributes = mRenderer.getVertexAttributesResourceManager().getById(materialBlueprintResource.getVertexAttributesResourceId(graphicsPipelineStateSignature.getShaderProperties())).getVertexAttributes();
 										shader = shaderLanguage.createVertexShaderFromSourceCode(vertexAttributes, shaderSourceCode.c_str(), &shaderCache->mShaderBytecode RHI_RESOURCE_DEBUG_NAME("Pipeline state compiler"));
 										break;
 									}
@@ -438,7 +521,7 @@ namespace Renderer
 
 						// Create the graphics program
 						Rhi::IGraphicsProgram* graphicsProgram = shaderLanguage.createGraphicsProgram(*materialBlueprintResource.getRootSignaturePtr(),
-							mRenderer.getVertexAttributesResourceManager().getById(materialBlueprintResource.getVertexAttributesResourceId()).getVertexAttributes(),
+							mRenderer.getVertexAttributesResourceManager().getById(materialBlueprintResource.getVertexAttributesResourceId(graphicsPipelineStateSignature.getShaderProperties())).getVertexAttributes(),
 							static_cast<Rhi::IVertexShader*>(shaders[static_cast<int>(GraphicsShaderType::Vertex)]),
 							static_cast<Rhi::ITessellationControlShader*>(shaders[static_cast<int>(GraphicsShaderType::TessellationControl)]),
 							static_cast<Rhi::ITessellationEvaluationShader*>(shaders[static_cast<int>(GraphicsShaderType::TessellationEvaluation)]),
@@ -448,7 +531,7 @@ namespace Renderer
 						);
 
 						// Create the graphics pipeline state object (PSO)
-						compilerRequest.graphicsPipelineStateObject = createGraphicsPipelineState(materialBlueprintResource, graphicsPipelineStateSignature.getSerializedGraphicsPipelineStateHash(), *graphicsProgram);
+						compilerRequest.graphicsPipelineStateObject = createGraphicsPipelineState(materialBlueprintResource, graphicsPipelineStateSignature, *graphicsProgram);
 
 						{ // Graphics program cache entry
 							GraphicsProgramCacheManager& graphicsProgramCacheManager = materialBlueprintResource.getGraphicsPipelineStateCacheManager().getGraphicsProgramCacheManager();
@@ -469,8 +552,7 @@ namespace Renderer
 					}
 
 					// Push the compiler request into the queue of the synchronous shader dispatch
-					std::lock_guard<std::mutex> dispatchMutexLock(mDispatchMutex);
-					mDispatchQueue.emplace_back(compilerRequest);
+					pushToDispatchQueue(compilerRequest, mCompilerStageMicroseconds, mNumberOfCompilerStageRequests);
 				}
 
 				// We're ready for the next round
@@ -484,18 +566,18 @@ namespace Renderer
 		}
 	}
 
-	Rhi::IGraphicsPipelineState* GraphicsPipelineStateCompiler::createGraphicsPipelineState(const MaterialBlueprintResource& materialBlueprintResource, uint32_t serializedGraphicsPipelineStateHash, Rhi::IGraphicsProgram& graphicsProgram) const
+	Rhi::IGraphicsPipelineState* GraphicsPipelineStateCompiler::createGraphicsPipelineState(const MaterialBlueprintResource& materialBlueprintResource, const GraphicsPipelineStateSignature& graphicsPipelineStateSignature, Rhi::IGraphicsProgram& graphicsProgram) const
 	{
 		// Start with the graphics pipeline state of the material blueprint resource, then copy over serialized graphics pipeline state
 		Rhi::GraphicsPipelineState graphicsPipelineState = materialBlueprintResource.getGraphicsPipelineState();
-		materialBlueprintResource.getResourceManager<MaterialBlueprintResourceManager>().applySerializedGraphicsPipelineState(serializedGraphicsPipelineStateHash, graphicsPipelineState);
+		materialBlueprintResource.getResourceManager<MaterialBlueprintResourceManager>().applySerializedGraphicsPipelineState(graphicsPipelineStateSignature.getSerializedGraphicsPipelineStateHash(), graphicsPipelineState);
 
 		// Setup the dynamic part of the pipeline state
 		const IRenderer& renderer = materialBlueprintResource.getResourceManager<MaterialBlueprintResourceManager>().getRenderer();
 		const Rhi::IRootSignaturePtr& rootSignaturePtr = materialBlueprintResource.getRootSignaturePtr();
 		graphicsPipelineState.rootSignature	   = rootSignaturePtr;
 		graphicsPipelineState.graphicsProgram  = &graphicsProgram;
-		graphicsPipelineState.vertexAttributes = renderer.getVertexAttributesResourceManager().getById(materialBlueprintResource.getVertexAttributesResourceId()).getVertexAttributes();
+		graphicsPipelineState.vertexAttributes = renderer.getVertexAttributesResourceManager().getById(materialBlueprintResource.getVertexAttributesResourceId(graphicsPipelineStateSignature.getShaderProperties())).getVertexAttributes();
 
 		{ // TODO(co) Render pass related update, the render pass in here is currently just a dummy so the debug compositor works
 			Rhi::IRhi& rhi = rootSignaturePtr->getRhi();
@@ -29,6 +29,7 @@
 //[-------------------------------------------------------]
 #include "Renderer/Public/Resource/ShaderBlueprint/GraphicsShaderType.h"
 #include "Renderer/Public/Core/GetInvalid.h"
+#include "Renderer/Public/Core/Time/Stopwatch.h"
 
 // Disable warnings in external headers, we can't fix them
 PRAGMA_WARNING_PUSH
@@ -67,6 +68,7 @@ namespace Renderer
 	class IRenderer;
 	class MaterialBlueprintResource;
 	class GraphicsPipelineStateCache;
+	class GraphicsPipelineStateSignature;
 }
 
 
@@ -94,10 +96,15 @@ namespace Renderer
 	*    A graphics pipeline state must master the following stages in order to archive the inner wisdom:
 	*    1. Asynchronous shader building
 	*    2. Asynchronous shader compilation
-	*    3. Synchronous RHI implementation dispatch TODO(co) Asynchronous RHI implementation dispatch if supported by the RHI implementation
+	*    3. Synchronous dispatch of the created graphics pipeline state objects to their graphics pipeline state caches
+	*
+	*    When asynchronous compilation is enabled (default if the RHI implementation reports native multithreading support), RHI graphics pipeline
+	*    state objects are created by the builder and compiler threads and the main thread only has to hand the results over. The dispatch
+	*    stage is limited by a per-frame time budget, requests exceeding the budget are carried over to the next frame.
 	*
 	*  @note
 	*    - Takes care of asynchronous graphics pipeline state compilation
+	*    - The per-stage statistics are meant for profiling, the values are sampled without synchronization with the stages
 	*/
 	class GraphicsPipelineStateCompiler final
 	{
@@ -133,6 +140,83 @@ namespace Renderer
 			return mNumberOfInFlightCompilerRequests;
 		}
 
+		/**
+		*  @brief
+		*    Return the maximum time the main thread is allowed to spend inside "Renderer::GraphicsPipelineStateCompiler::dispatch()" per call
+		*
+		*  @return
+		*    The maximum dispatch time budget in microseconds, 0 for no limit, default is 1000 (= 1 ms)
+		*/
+		[[nodiscard]] inline std::time_t getMaximumDispatchTimeBudget() const
+		{
+			return mMaximumDispatchTimeBudget;
+		}
+
+		/**
+		*  @brief
+		*    Set the maximum time the main thread is allowed to spend inside "Renderer::GraphicsPipelineStateCompiler::dispatch()" per call
+		*
+		*  @param[in] maximumDispatchTimeBudget
+		*    The maximum dispatch time budget in microseconds, 0 for no limit
+		*
+		*  @note
+		*    - At least one compiler request is dispatched per call to ensure progress
+		*/
+		inline void setMaximumDispatchTimeBudget(std::time_t maximumDispatchTimeBudget)
+		{
+			mMaximumDispatchTimeBudget = maximumDispatchTimeBudget;
+		}
+
+		//[-------------------------------------------------------]
+		//[ Statistics                                            ]
+		//[-------------------------------------------------------]
+		[[nodiscard]] inline uint32_t getNumberOfBuilderStageRequests() const
+		{
+			return mNumberOfBuilderStageRequests;
+		}
+
+		[[nodiscard]] inline uint32_t getNumberOfCompilerStageRequests() const
+		{
+			return mNumberOfCompilerStageRequests;
+		}
+
+		[[nodiscard]] inline uint32_t getNumberOfDispatchStageRequests() const
+		{
+			return mNumberOfDispatchStageRequests;
+		}
+
+		[[nodiscard]] inline uint32_t getNumberOfDispatchedCompilerRequests() const
+		{
+			return mNumberOfDispatchedCompilerRequests;
+		}
+
+		/**
+		*  @brief
+		*    Return the accumulated time compiler requests spent inside the builder stage, including waiting inside the builder queue
+		*
+		*  @return
+		*    Accumulated builder stage time in microseconds, divide by "Renderer::GraphicsPipelineStateCompiler::getNumberOfDispatchedCompilerRequests()" to get the average latency
+		*/
+		[[nodiscard]] inline std::time_t getBuilderStageMicroseconds() const
+		{
+			return mBuilderStageMicroseconds;
+		}
+
+		[[nodiscard]] inline std::time_t getCompilerStageMicroseconds() const
+		{
+			return mCompilerStageMicroseconds;
+		}
+
+		[[nodiscard]] inline std::time_t getDispatchStageMicroseconds() const
+		{
+			return mDispatchStageMicroseconds;
+		}
+
+		void resetStatistics();
+
+		//[-------------------------------------------------------]
+		//[ Queues                                                ]
+		//[-------------------------------------------------------]
 		inline void flushBuilderQueue()
 		{
 			flushQueue(mBuilderMutex, mBuilderQueue);
@@ -165,11 +249,13 @@ namespace Renderer
 			ShaderCache*				 shaderCache[NUMBER_OF_GRAPHICS_SHADER_TYPES];
 			std::string					 shaderSourceCode[NUMBER_OF_GRAPHICS_SHADER_TYPES];
 			Rhi::IGraphicsPipelineState* graphicsPipelineStateObject;
+			Stopwatch					 stageStopwatch;	///< Measures the time spent inside the current stage, restarted on each stage transition
 
 			inline explicit CompilerRequest(GraphicsPipelineStateCache& _graphicsPipelineStateCache) :
 				graphicsPipelineStateCache(_graphicsPipelineStateCache),
 				graphicsProgramCacheId(getInvalid<GraphicsProgramCacheId>()),
-				graphicsPipelineStateObject(nullptr)
+				graphicsPipelineStateObject(nullptr),
+				stageStopwatch(true)
 			{
 				for (uint8_t i = 0; i < NUMBER_OF_GRAPHICS_SHADER_TYPES; ++i)
 				{
@@ -179,7 +265,8 @@ namespace Renderer
 			inline explicit CompilerRequest(const CompilerRequest& compilerRequest) :
 				graphicsPipelineStateCache(compilerRequest.graphicsPipelineStateCache),
 				graphicsProgramCacheId(compilerRequest.graphicsProgramCacheId),
-				graphicsPipelineStateObject(compilerRequest.graphicsPipelineStateObject)
+				graphicsPipelineStateObject(compilerRequest.graphicsPipelineStateObject),
+				stageStopwatch(compilerRequest.stageStopwatch)
 			{
 				for (uint8_t i = 0; i < NUMBER_OF_GRAPHICS_SHADER_TYPES; ++i)
 				{
@@ -206,9 +293,22 @@ namespace Renderer
 		void addAsynchronousCompilerRequest(GraphicsPipelineStateCache& graphicsPipelineStateCache);
 		void instantSynchronousCompilerRequest(MaterialBlueprintResource& materialBlueprintResource, GraphicsPipelineStateCache& graphicsPipelineStateCache);
 		void flushQueue(std::mutex& mutex, const CompilerRequests& compilerRequests);
+
+		/**
+		*  @brief
+		*    Wait until all in flight compiler requests have been dispatched
+		*
+		*  @note
+		*    - Unlike "Renderer::GraphicsPipelineStateCompiler::flushAllQueues()" this also waits for compiler requests currently processed by the builder or a compiler thread, they're inside no queue
+		*    - Must be called before destroying graphics pipeline state caches which might be referenced by compiler requests
+		*/
+		void flushInFlightCompilerRequests();
+
+		void dispatchCompilerRequests(std::time_t maximumDispatchTimeBudget);
+		void pushToDispatchQueue(CompilerRequest& compilerRequest, std::atomic<std::time_t>& stageMicroseconds, std::atomic<uint32_t>& numberOfStageRequests);
 		void builderThreadWorker();
 		void compilerThreadWorker();
-		[[nodiscard]] Rhi::IGraphicsPipelineState* createGraphicsPipelineState(const MaterialBlueprintResource& materialBlueprintResource, uint32_t serializedGraphicsPipelineStateHash, Rhi::IGraphicsProgram& graphicsProgram) const;
+		[[nodiscard]] Rhi::IGraphicsPipelineState* createGraphicsPipelineState(const MaterialBlueprintResource& materialBlueprintResource, const GraphicsPipelineStateSignature& graphicsPipelineStateSignature, Rhi::IGraphicsProgram& graphicsProgram) const;
 
 
 	//[-------------------------------------------------------]
@@ -236,9 +336,20 @@ namespace Renderer
 		CompilerRequests		mCompilerQueue;
 		CompilerThreads			mCompilerThreads;
 
-		// Synchronous dispatch
+		// Synchronous dispatch (cheap), the compiler threads fill the dispatch queue which is swapped into the main thread owned pending dispatch queue
 		std::mutex		 mDispatchMutex;
 		CompilerRequests mDispatchQueue;
+		CompilerRequests mPendingDispatchQueue;			///< Only accessed by the main thread, holds the compiler requests which didn't fit into the dispatch time budget
+		std::time_t		 mMaximumDispatchTimeBudget;	///< Maximum dispatch time budget in microseconds, 0 for no limit
+
+		// Statistics
+		std::atomic<uint32_t>	 mNumberOfBuilderStageRequests;			///< Number of compiler requests inside the builder stage
+		std::atomic<uint32_t>	 mNumberOfCompilerStageRequests;		///< Number of compiler requests inside the compiler stage
+		std::atomic<uint32_t>	 mNumberOfDispatchStageRequests;		///< Number of compiler requests inside the dispatch stage
+		std::atomic<uint32_t>	 mNumberOfDispatchedCompilerRequests;
+		std::atomic<std::time_t> mBuilderStageMicroseconds;
+		std::atomic<std::time_t> mCompilerStageMicroseconds;
+		std::atomic<std::time_t> mDispatchStageMicroseconds;
 
 
 	};
@@ -115,6 +115,12 @@ namespace Renderer
 		mGraphicsPipelineStateSignatureId = Math::calculateFNV1a32(reinterpret_cast<const uint8_t*>(&mMaterialBlueprintResourceId), sizeof(uint32_t), mGraphicsPipelineStateSignatureId);
 		mGraphicsPipelineStateSignatureId = Math::calculateFNV1a32(reinterpret_cast<const uint8_t*>(&mSerializedGraphicsPipelineStateHash), sizeof(uint32_t), mGraphicsPipelineStateSignatureId);
 
+		// Incorporate the build-in "UseQuantizedVertices"-property: It selects the vertex attributes of the pipeline state object (PSO) but isn't referenced by shaders
+		if (mShaderProperties.hasPropertyValue(MaterialBlueprintResource::USE_QUANTIZED_VERTICES))
+		{
+			mGraphicsPipelineStateSignatureId = Math::calculateFNV1a32(reinterpret_cast<const uint8_t*>(&MaterialBlueprintResource::USE_QUANTIZED_VERTICES), sizeof(uint32_t), mGraphicsPipelineStateSignatureId);
+		}
+
 		// Incorporate shader related hashes
 		const ShaderBlueprintResourceManager& shaderBlueprintResourceManager = materialBlueprintResource.getResourceManager<MaterialBlueprintResourceManager>().getRenderer().getShaderBlueprintResourceManager();
 		for (uint8_t i = 0; i < NUMBER_OF_GRAPHICS_SHADER_TYPES; ++i)
@@ -100,7 +100,7 @@ namespace Renderer
 
 			// Create the graphics program
 			Rhi::IGraphicsProgram* graphicsProgram = shaderLanguage.createGraphicsProgram(*rootSignaturePtr,
-				renderer.getVertexAttributesResourceManager().getById(materialBlueprintResource.getVertexAttributesResourceId()).getVertexAttributes(),
+				renderer.getVertexAttributesResourceManager().getById(materialBlueprintResource.getVertexAttributesResourceId(graphicsPipelineStateSignature.getShaderProperties())).getVertexAttributes(),
 				static_cast<Rhi::IVertexShader*>(shaders[static_cast<int>(GraphicsShaderType::Vertex)]),
 				static_cast<Rhi::ITessellationControlShader*>(shaders[static_cast<int>(GraphicsShaderType::TessellationControl)]),
 				static_cast<Rhi::ITessellationEvaluationShader*>(shaders[static_cast<int>(GraphicsShaderType::TessellationEvaluation)]),
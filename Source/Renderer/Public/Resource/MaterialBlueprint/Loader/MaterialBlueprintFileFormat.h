@@ -62,7 +62,7 @@ namespace Renderer
 		//[ Definitions                                           ]
 		//[-------------------------------------------------------]
 		static constexpr uint32_t FORMAT_TYPE	 = STRING_ID("MaterialBlueprint");
-		static constexpr uint32_t FORMAT_VERSION = 11;
+		static constexpr uint32_t FORMAT_VERSION = 12;
 
 		#pragma pack(push)
 		#pragma pack(1)
@@ -180,8 +180,9 @@ namespace Renderer
 		// Read in the graphics pipeline state in case there's no compute pipeline state
 		if (isInvalid(mComputeShaderBlueprintAssetId))
 		{
-			// Read vertex attributes asset ID
+			// Read vertex attributes asset IDs, the quantized vertex attributes asset ID is optional
 			mMemoryFile.read(&mVertexAttributesAssetId, sizeof(AssetId));
+			mMemoryFile.read(&mQuantizedVertexAttributesAssetId, sizeof(AssetId));
 
 			// Read in the shader blueprints
 			mMemoryFile.read(&mGraphicsShaderBlueprintAssetId, sizeof(AssetId) * NUMBER_OF_GRAPHICS_SHADER_TYPES);
@@ -297,6 +298,10 @@ namespace Renderer
 		{ // Graphics pipeline state
 			// Get the used vertex attributes resource
 			mRenderer.getVertexAttributesResourceManager().loadVertexAttributesResourceByAssetId(mVertexAttributesAssetId, mMaterialBlueprintResource->mVertexAttributesResourceId);
+			if (isValid(mQuantizedVertexAttributesAssetId))
+			{
+				mRenderer.getVertexAttributesResourceManager().loadVertexAttributesResourceByAssetId(mQuantizedVertexAttributesAssetId, mMaterialBlueprintResource->mQuantizedVertexAttributesResourceId);
+			}
 
 			{ // Get the used shader blueprint resources
 				ShaderBlueprintResourceManager& shaderBlueprintResourceManager = mRenderer.getShaderBlueprintResourceManager();
@@ -470,6 +475,11 @@ namespace Renderer
 			// Not fully loaded
 			return false;
 		}
+		if (isValid(mMaterialBlueprintResource->mQuantizedVertexAttributesResourceId) && IResource::LoadingState::LOADED != mRenderer.getVertexAttributesResourceManager().getResourceByResourceId(mMaterialBlueprintResource->mQuantizedVertexAttributesResourceId).getLoadingState())
+		{
+			// Not fully loaded
+			return false;
+		}
 
 		// We only demand that all referenced shader blueprint resources are loaded, not yet loaded texture resources can be handled during runtime
 		const ShaderBlueprintResourceManager& shaderBlueprintResourceManager = mRenderer.getShaderBlueprintResourceManager();
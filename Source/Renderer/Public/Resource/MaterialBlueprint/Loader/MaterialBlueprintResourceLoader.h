@@ -121,6 +121,7 @@ namespace Renderer
 			mMaximumNumberOfRootParameters(0),
 			mMaximumNumberOfDescriptorRanges(0),
 			mVertexAttributesAssetId(getInvalid<AssetId>()),
+			mQuantizedVertexAttributesAssetId(getInvalid<AssetId>()),
 			mGraphicsShaderBlueprintAssetId{getInvalid<AssetId>(), getInvalid<AssetId>(), getInvalid<AssetId>(), getInvalid<AssetId>(), getInvalid<AssetId>()},
 			mComputeShaderBlueprintAssetId(getInvalid<AssetId>()),
 			mMaximumNumberOfMaterialBlueprintSamplerStates(0),
@@ -156,6 +157,7 @@ namespace Renderer
 
 		// Temporary data for graphics pipeline state: Vertex attributes and graphics shader blueprints
 		AssetId mVertexAttributesAssetId;
+		AssetId mQuantizedVertexAttributesAssetId;
 		AssetId mGraphicsShaderBlueprintAssetId[NUMBER_OF_GRAPHICS_SHADER_TYPES];
 
 		// Temporary data for compute pipeline state: Compute shader blueprint
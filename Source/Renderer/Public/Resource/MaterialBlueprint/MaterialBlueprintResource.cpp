@@ -29,11 +29,9 @@
 #include "Renderer/Public/Resource/ShaderPiece/ShaderPieceResourceManager.h"
 #include "Renderer/Public/Resource/ResourceStreamer.h"
 #include "Renderer/Public/Asset/AssetManager.h"
+#include "Renderer/Public/Core/Memory/FrameAllocator.h"
 #include "Renderer/Public/IRenderer.h"
 
-#include <chrono>
-#include <thread>
-
 
 // Disable warnings
 // TODO(co) See "Renderer::MaterialBlueprintResource::MaterialBlueprintResource()": How the heck should we avoid such a situation without using complicated solutions like a pointer to an instance? (= more individual allocations/deallocations)
@@ -239,18 +237,20 @@ namespace Renderer
 		}
 	}
 
-	void MaterialBlueprintResource::enforceFullyLoaded()
+	void MaterialBlueprintResource::logMissingQuantizedVertexAttributesOnce()
 	{
-		// TODO(co) Implement more efficient solution: We need to extend "::ResourceStreamer" to request emergency immediate processing of requested resources
-		ResourceStreamer& resourceStreamer = getResourceManager<MaterialBlueprintResourceManager>().getRenderer().getResourceStreamer();
-		while (LoadingState::LOADED != getLoadingState())
+		if (!mMissingQuantizedVertexAttributesLogged)
 		{
-			using namespace std::chrono_literals;
-			std::this_thread::sleep_for(1ms);
-			resourceStreamer.dispatch();
+			RHI_LOG(getResourceManager<MaterialBlueprintResourceManager>().getRenderer().getContext(), CRITICAL, "The material blueprint asset %u has no \"QuantizedVertexAttributes\", renderables of meshes compiled using \"QuantizeVertices\" are not drawn with it", getAssetId().getId())
+			mMissingQuantizedVertexAttributesLogged = true;
 		}
 	}
 
+	void MaterialBlueprintResource::enforceFullyLoaded()
+	{
+		getResourceManager<MaterialBlueprintResourceManager>().getRenderer().getResourceStreamer().processEmergencyLoadRequest(*this);
+	}
+
 	void MaterialBlueprintResource::fillGraphicsCommandBuffer(Rhi::CommandBuffer& commandBuffer)
 	{
 		// Set the used graphics root signature
@@ -268,7 +268,7 @@ namespace Renderer
 			// Create sampler resource group, if needed
 			if (nullptr == mSamplerStateGroup)
 			{
-				std::vector<Rhi::IResource*> resources;
+				FrameVector<Rhi::IResource*> resources{FrameStlAllocator<Rhi::IResource*>(getResourceManager<MaterialBlueprintResourceManager>().getRenderer().getFrameAllocator())};
 				const size_t numberOfSamplerStates = mSamplerStates.size();
 				resources.resize(numberOfSamplerStates);
 				for (size_t i = 0; i < numberOfSamplerStates; ++i)
@@ -307,7 +307,7 @@ namespace Renderer
 			// Create sampler resource group, if needed
 			if (nullptr == mSamplerStateGroup)
 			{
-				std::vector<Rhi::IResource*> resources;
+				FrameVector<Rhi::IResource*> resources{FrameStlAllocator<Rhi::IResource*>(getResourceManager<MaterialBlueprintResourceManager>().getRenderer().getFrameAllocator())};
 				const size_t numberOfSamplerStates = mSamplerStates.size();
 				resources.resize(numberOfSamplerStates);
 				for (size_t i = 0; i < numberOfSamplerStates; ++i)
@@ -453,6 +453,8 @@ namespace Renderer
 		mComputePipelineStateCacheManager(*this),
 		mGraphicsPipelineState(Rhi::GraphicsPipelineStateBuilder()),
 		mVertexAttributesResourceId(getInvalid<VertexAttributesResourceId>()),
+		mQuantizedVertexAttributesResourceId(getInvalid<VertexAttributesResourceId>()),
+		mMissingQuantizedVertexAttributesLogged(false),
 		mGraphicsShaderBlueprintResourceId{getInvalid<ShaderBlueprintResourceId>(), getInvalid<ShaderBlueprintResourceId>(), getInvalid<ShaderBlueprintResourceId>(), getInvalid<ShaderBlueprintResourceId>(), getInvalid<ShaderBlueprintResourceId>()},
 		mComputeShaderBlueprintResourceId(getInvalid<ShaderBlueprintResourceId>()),
 		mPassUniformBuffer(nullptr),
@@ -560,6 +562,8 @@ namespace Renderer
 	{
 		// TODO(co) Reset everything
 		setInvalid(mVertexAttributesResourceId);
+		setInvalid(mQuantizedVertexAttributesResourceId);
+		mMissingQuantizedVertexAttributesLogged = false;
 		memset(mGraphicsShaderBlueprintResourceId, static_cast<int>(getInvalid<ShaderBlueprintResourceId>()), sizeof(ShaderBlueprintResourceId) * NUMBER_OF_GRAPHICS_SHADER_TYPES);
 		setInvalid(mComputeShaderBlueprintResourceId);
 
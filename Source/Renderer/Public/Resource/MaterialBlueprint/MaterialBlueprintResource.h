@@ -112,7 +112,8 @@ namespace Renderer
 	//[ Public definitions                                    ]
 	//[-------------------------------------------------------]
 	public:
-		static constexpr int32_t MANDATORY_SHADER_PROPERTY = std::numeric_limits<int32_t>::max();	///< Visual importance value for mandatory shader properties (such properties are not removed when finding a fallback pipeline state)
+		static constexpr int32_t  MANDATORY_SHADER_PROPERTY = std::numeric_limits<int32_t>::max();	///< Visual importance value for mandatory shader properties (such properties are not removed when finding a fallback pipeline state)
+		static constexpr uint32_t USE_QUANTIZED_VERTICES	= STRING_ID("UseQuantizedVertices");		///< Build-in shader property automatically set for renderables with quantized vertices, selects the quantized vertex attributes
 
 		/**
 		*  @brief
@@ -327,6 +328,45 @@ namespace Renderer
 			return mVertexAttributesResourceId;
 		}
 
+		/**
+		*  @brief
+		*    Return the quantized vertex attributes resource ID
+		*
+		*  @return
+		*    The requested quantized vertex attributes resource ID, invalid if the material blueprint has no "QuantizedVertexAttributes"
+		*/
+		[[nodiscard]] inline VertexAttributesResourceId getQuantizedVertexAttributesResourceId() const
+		{
+			return mQuantizedVertexAttributesResourceId;
+		}
+
+		/**
+		*  @brief
+		*    Return the vertex attributes resource ID to use for a shader combination
+		*
+		*  @param[in] shaderProperties
+		*    Shader properties of the shader combination, the build-in "UseQuantizedVertices" shader property selects the quantized vertex attributes
+		*
+		*  @return
+		*    The vertex attributes resource ID to use, can be invalid
+		*
+		*  @note
+		*    - Both vertex attributes layouts must use the same attribute names, shaders and graphics programs are shared, only the pipeline state objects (PSO) differ
+		*/
+		[[nodiscard]] inline VertexAttributesResourceId getVertexAttributesResourceId(const ShaderProperties& shaderProperties) const
+		{
+			return (isValid(mQuantizedVertexAttributesResourceId) && shaderProperties.hasPropertyValue(USE_QUANTIZED_VERTICES)) ? mQuantizedVertexAttributesResourceId : mVertexAttributesResourceId;
+		}
+
+		/**
+		*  @brief
+		*    Log that renderables with quantized vertices can't be drawn since the material blueprint has no "QuantizedVertexAttributes"
+		*
+		*  @note
+		*    - Called by the render queue each frame such a renderable is skipped, so the message is logged only once per material blueprint resource
+		*/
+		void logMissingQuantizedVertexAttributesOnce();
+
 		/**
 		*  @brief
 		*    Return a graphics shader blueprint resource ID
@@ -589,6 +629,8 @@ namespace Renderer
 		// Graphics pipeline state
 		Rhi::GraphicsPipelineState		mGraphicsPipelineState;
 		VertexAttributesResourceId		mVertexAttributesResourceId;
+		VertexAttributesResourceId		mQuantizedVertexAttributesResourceId;	///< Optional vertex attributes used for meshes with quantized vertices, can be invalid
+		bool							mMissingQuantizedVertexAttributesLogged;	///< "true" if "Renderer::MaterialBlueprintResource::logMissingQuantizedVertexAttributesOnce()" already logged
 		ShaderBlueprintResourceId		mGraphicsShaderBlueprintResourceId[NUMBER_OF_GRAPHICS_SHADER_TYPES];
 		// Compute pipeline state
 		ShaderBlueprintResourceId mComputeShaderBlueprintResourceId;
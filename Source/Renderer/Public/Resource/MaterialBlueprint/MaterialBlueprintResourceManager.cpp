@@ -37,6 +37,8 @@
 #include "Renderer/Public/Core/Time/TimeManager.h"
 #include "Renderer/Public/Context.h"
 
+#include <algorithm>
+
 
 //[-------------------------------------------------------]
 //[ Anonymous detail namespace                            ]
@@ -125,17 +127,12 @@ namespace Renderer
 			// Commit resource streamer asset load request
 			mRenderer.getResourceStreamer().commitLoadRequest(ResourceStreamer::LoadRequest(*asset, resourceLoaderTypeId, reload, *this, materialBlueprintResourceId));
 
-			// TODO(co) Currently material blueprint resource loading is a blocking process.
-			//          Later on, we can probably just write "mInternalResourceManager->loadResourceByAssetId(assetId, meshResourceId, resourceListener, reload, resourceLoaderTypeId);" and be done in this method.
-			materialBlueprintResource->enforceFullyLoaded();
-
-			// Create default pipeline state caches
-			// -> Material blueprints should be loaded by a cache manager upfront so that the following expensive call doesn't cause runtime hiccups
+			// Create default pipeline state caches as soon as the material blueprint resource is fully loaded, see "Renderer::MaterialBlueprintResourceManager::update()"
+			// -> Material blueprints should be loaded by a cache manager upfront so that the expensive pipeline state compilation doesn't cause runtime hiccups
 			// -> Runtime hiccups would also be there without fallback pipeline state caches, so there's no real way around
-			// -> We must enforce fully loaded material blueprint resource state for this
-			if (mCreateInitialPipelineStateCaches && createInitialPipelineStateCaches)
+			if (mCreateInitialPipelineStateCaches && createInitialPipelineStateCaches && std::find(mPendingInitialPipelineStateCaches.cbegin(), mPendingInitialPipelineStateCaches.cend(), materialBlueprintResourceId) == mPendingInitialPipelineStateCaches.cend())
 			{
-				materialBlueprintResource->createPipelineStateCaches(true);
+				mPendingInitialPipelineStateCaches.push_back(materialBlueprintResourceId);
 			}
 		}
 	}
@@ -260,8 +257,10 @@ namespace Renderer
 				}
 
 				// Reload material blueprint resource
+				// -> The following material property updates need the reloaded data, so the material blueprint resource must be fully loaded right now
 				MaterialBlueprintResourceId materialBlueprintResourceId = getInvalid<MaterialBlueprintResourceId>();
 				loadMaterialBlueprintResourceByAssetId(assetId, materialBlueprintResourceId, nullptr, true, materialBlueprintResource.getResourceLoaderTypeId());
+				materialBlueprintResource.enforceFullyLoaded();
 
 				// Clear pipeline state cache manager
 				materialBlueprintResource.clearPipelineStateObjectCache();
@@ -317,6 +316,26 @@ namespace Renderer
 			mGlobalMaterialProperties.setPropertyById(STRING_ID("PreviousGlobalTimeInSeconds"), (nullptr != materialProperty) ? *materialProperty : MaterialPropertyValue::fromFloat(timeManager.getGlobalTimeInSeconds()), MaterialProperty::Usage::SHADER_UNIFORM);
 		}
 		mGlobalMaterialProperties.setPropertyById(STRING_ID("GlobalTimeInSeconds"), MaterialPropertyValue::fromFloat(timeManager.getGlobalTimeInSeconds()), MaterialProperty::Usage::SHADER_UNIFORM);
+
+		// Create the initial pipeline state caches of material blueprint resources which have been fully loaded in the meantime
+		// -> The graphics and compute pipeline state compilers are performing the expensive work asynchronously on their compiler threads
+		MaterialBlueprintResourceIds::iterator iterator = mPendingInitialPipelineStateCaches.begin();
+		while (iterator != mPendingInitialPipelineStateCaches.end())
+		{
+			MaterialBlueprintResource* materialBlueprintResource = tryGetById(*iterator);
+			if (nullptr == materialBlueprintResource || IResource::LoadingState::LOADING != materialBlueprintResource->getLoadingState())
+			{
+				if (nullptr != materialBlueprintResource && IResource::LoadingState::LOADED == materialBlueprintResource->getLoadingState())
+				{
+					materialBlueprintResource->createPipelineStateCaches(true);
+				}
+				iterator = mPendingInitialPipelineStateCaches.erase(iterator);
+			}
+			else
+			{
+				++iterator;
+			}
+		}
 	}
 
 
@@ -442,16 +461,27 @@ namespace Renderer
 				materialBlueprintCacheEntries.resize(numberOfElements);
 				file.read(materialBlueprintCacheEntries.data(), sizeof(::detail::MaterialBlueprintCacheEntry) * numberOfElements);
 
+				// Request all material blueprint resources to be loaded at once so the resource streamer can work on them in parallel
+				MaterialBlueprintResourceIds materialBlueprintResourceIds;
+				materialBlueprintResourceIds.resize(numberOfElements);
+				for (uint32_t i = 0; i < numberOfElements; ++i)
+				{
+					setInvalid(materialBlueprintResourceIds[i]);
+					loadMaterialBlueprintResourceByAssetId(materialBlueprintCacheEntries[i].materialBlueprintAssetId, materialBlueprintResourceIds[i], nullptr, false, getInvalid<ResourceLoaderTypeId>(), false);
+				}
+
 				// Loop through all material blueprint resources and read the cache entries
+				// -> The cache entries are read sequentially from the file, so we have to wait for each material blueprint resource in turn
 				for (uint32_t i = 0; i < numberOfElements; ++i)
 				{
-					// TODO(co) Currently material blueprint resource loading is a blocking process
-					const ::detail::MaterialBlueprintCacheEntry& materialBlueprintCacheEntry = materialBlueprintCacheEntries[i];
-					MaterialBlueprintResourceId materialBlueprintResourceId = getInvalid<MaterialBlueprintResourceId>();
-					loadMaterialBlueprintResourceByAssetId(materialBlueprintCacheEntry.materialBlueprintAssetId, materialBlueprintResourceId, nullptr, false, getInvalid<ResourceLoaderTypeId>(), false);
-					if (isValid(materialBlueprintResourceId))
+					MaterialBlueprintResource* materialBlueprintResource = tryGetById(materialBlueprintResourceIds[i]);
+					if (nullptr != materialBlueprintResource)
+					{
+						materialBlueprintResource->enforceFullyLoaded();
+					}
+					if (nullptr != materialBlueprintResource && IResource::LoadingState::LOADED == materialBlueprintResource->getLoadingState())
 					{
-						mInternalResourceManager->getResources().getElementById(materialBlueprintResourceId).loadPipelineStateObjectCache(file);
+						materialBlueprintResource->loadPipelineStateObjectCache(file);
 					}
 					else
 					{
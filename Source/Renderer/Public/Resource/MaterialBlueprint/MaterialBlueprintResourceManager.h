@@ -98,6 +98,7 @@ namespace Renderer
 	//[-------------------------------------------------------]
 	public:
 		typedef std::unordered_map<uint32_t, Rhi::SerializedGraphicsPipelineState> SerializedGraphicsPipelineStates;	///< Key = FNV1a hash of "Rhi::SerializedGraphicsPipelineState"
+		typedef std::vector<MaterialBlueprintResourceId> MaterialBlueprintResourceIds;
 
 
 	//[-------------------------------------------------------]
@@ -263,6 +264,7 @@ namespace Renderer
 		TextureInstanceBufferManager*		mTextureInstanceBufferManager;				///< Texture instance buffer manager, always valid in a sane none-legacy environment
 		IndirectBufferManager*				mIndirectBufferManager;						///< Indirect buffer manager, always valid in a sane none-legacy environment
 		LightBufferManager*					mLightBufferManager;						///< Light buffer manager, always valid in a sane none-legacy environment
+		MaterialBlueprintResourceIds		mPendingInitialPipelineStateCaches;			///< Currently loading material blueprint resources which need their initial pipeline state caches as soon as they're fully loaded
 
 		// Internal resource manager implementation
 		ResourceManagerTemplate<MaterialBlueprintResource, MaterialBlueprintResourceLoader, MaterialBlueprintResourceId, 64>* mInternalResourceManager;
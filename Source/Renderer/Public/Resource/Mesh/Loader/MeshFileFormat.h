@@ -55,7 +55,7 @@ namespace Renderer
 	// Mesh file format content:
 	// - File format header
 	// - Mesh header
-	// - Vertex and index buffer data (directly containing also the index data of all LODs)
+	// - Vertex and index buffer data (directly containing also the index data of all LODs), optionally compressed using the "meshoptimizer" vertex and index buffer codecs
 	// - Vertex array attribute definitions
 	// - Sub-meshes and LODs
 	// - Optional skeleton
@@ -67,7 +67,7 @@ namespace Renderer
 		//[ Definitions                                           ]
 		//[-------------------------------------------------------]
 		static constexpr uint32_t FORMAT_TYPE	 = STRING_ID("Mesh");
-		static constexpr uint32_t FORMAT_VERSION = 9;
+		static constexpr uint32_t FORMAT_VERSION = 12;
 
 		#pragma pack(push)
 		#pragma pack(1)
@@ -85,6 +85,11 @@ namespace Renderer
 				uint32_t numberOfIndices;
 				uint8_t  numberOfVertexAttributes;
 				bool	 hasPositionOnlyIndices;
+				bool	 hasQuantizedVertices;	// Vertex data uses "Renderer::MeshResource::QUANTIZED_VERTEX_ATTRIBUTES" (positions relative to the bounding box) or "Renderer::MeshResource::QUANTIZED_SKINNED_VERTEX_ATTRIBUTES"
+				// Optional "meshoptimizer" vertex and index buffer codecs, zero means the data is stored uncompressed
+				uint32_t numberOfEncodedVertexBufferBytes;
+				uint32_t numberOfEncodedIndexBufferBytes;
+				uint32_t numberOfEncodedPositionOnlyIndexBufferBytes;
 				// Sub-meshes and LODs
 				uint16_t numberOfSubMeshes;
 				uint8_t  numberOfLods;	// There's always at least one LOD, namely the original none reduced version
@@ -38,6 +38,12 @@ PRAGMA_WARNING_PUSH
 	#include <glm/glm.hpp>
 PRAGMA_WARNING_POP
 
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4365)	// warning C4365: 'initializing': conversion from 'unsigned int' to 'int', signed/unsigned mismatch
+	#include <meshoptimizer/meshoptimizer.h>
+PRAGMA_WARNING_POP
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -76,6 +82,7 @@ namespace Renderer
 		mMeshResource->setBoundingSpherePositionRadius(meshHeader.boundingSpherePosition, meshHeader.boundingSphereRadius);
 		mMeshResource->setNumberOfVertices(meshHeader.numberOfVertices);
 		mMeshResource->setNumberOfIndices(meshHeader.numberOfIndices);
+		mMeshResource->setQuantizedVertices(meshHeader.hasQuantizedVertices);
 		mMeshResource->setNumberOfLods(meshHeader.numberOfLods);
 
 		{ // Read in the vertex buffer
@@ -88,8 +95,17 @@ namespace Renderer
 				mVertexBufferData = new uint8_t[mNumberOfVertexBufferDataBytes];
 			}
 
-			// Read in the vertex buffer
-			mMemoryFile.read(mVertexBufferData, mNumberOfUsedVertexBufferDataBytes);
+			// Read in the vertex buffer, decode it in case it was encoded by using the "meshoptimizer" vertex buffer codec
+			if (0 != meshHeader.numberOfEncodedVertexBufferBytes)
+			{
+				readEncodedBufferData(meshHeader.numberOfEncodedVertexBufferBytes);
+				[[maybe_unused]] const int result = meshopt_decodeVertexBuffer(mVertexBufferData, meshHeader.numberOfVertices, meshHeader.numberOfBytesPerVertex, mEncodedBufferData, meshHeader.numberOfEncodedVertexBufferBytes);
+				RHI_ASSERT(mRenderer.getContext(), 0 == result, "Failed to decode the \"meshoptimizer\" encoded mesh vertex buffer")
+			}
+			else
+			{
+				mMemoryFile.read(mVertexBufferData, mNumberOfUsedVertexBufferDataBytes);
+			}
 		}
 
 		// Read in the index buffer
@@ -105,8 +121,17 @@ namespace Renderer
 				mIndexBufferData = new uint8_t[mNumberOfIndexBufferDataBytes];
 			}
 
-			// Read in the index buffer
-			mMemoryFile.read(mIndexBufferData, mNumberOfUsedIndexBufferDataBytes);
+			// Read in the index buffer, decode it in case it was encoded by using the "meshoptimizer" index buffer codec
+			if (0 != meshHeader.numberOfEncodedIndexBufferBytes)
+			{
+				readEncodedBufferData(meshHeader.numberOfEncodedIndexBufferBytes);
+				[[maybe_unused]] const int result = meshopt_decodeIndexBuffer(mIndexBufferData, meshHeader.numberOfIndices, mNumberOfUsedIndexBufferDataBytes / meshHeader.numberOfIndices, mEncodedBufferData, meshHeader.numberOfEncodedIndexBufferBytes);
+				RHI_ASSERT(mRenderer.getContext(), 0 == result, "Failed to decode the \"meshoptimizer\" encoded mesh index buffer")
+			}
+			else
+			{
+				mMemoryFile.read(mIndexBufferData, mNumberOfUsedIndexBufferDataBytes);
+			}
 		}
 
 		// Read in the position-only index buffer
@@ -123,8 +148,17 @@ namespace Renderer
 					mPositionOnlyIndexBufferData = new uint8_t[mNumberOfPositionOnlyIndexBufferDataBytes];
 				}
 
-				// Read in the position-only index buffer
-				mMemoryFile.read(mPositionOnlyIndexBufferData, mNumberOfUsedPositionOnlyIndexBufferDataBytes);
+				// Read in the position-only index buffer, decode it in case it was encoded by using the "meshoptimizer" index buffer codec
+				if (0 != meshHeader.numberOfEncodedPositionOnlyIndexBufferBytes)
+				{
+					readEncodedBufferData(meshHeader.numberOfEncodedPositionOnlyIndexBufferBytes);
+					[[maybe_unused]] const int result = meshopt_decodeIndexBuffer(mPositionOnlyIndexBufferData, meshHeader.numberOfIndices, mNumberOfUsedPositionOnlyIndexBufferDataBytes / meshHeader.numberOfIndices, mEncodedBufferData, meshHeader.numberOfEncodedPositionOnlyIndexBufferBytes);
+					RHI_ASSERT(mRenderer.getContext(), 0 == result, "Failed to decode the \"meshoptimizer\" encoded mesh position-only index buffer")
+				}
+				else
+				{
+					mMemoryFile.read(mPositionOnlyIndexBufferData, mNumberOfUsedPositionOnlyIndexBufferDataBytes);
+				}
 			}
 		}
 		else
@@ -276,7 +310,10 @@ namespace Renderer
 		mSubMeshes(nullptr),
 		// Optional temporary skeleton
 		mNumberOfBones(0),
-		mSkeletonData(nullptr)
+		mSkeletonData(nullptr),
+		// Temporary "meshoptimizer" encoded vertex or index buffer
+		mNumberOfEncodedBufferDataBytes(0),
+		mEncodedBufferData(nullptr)
 	{
 		// Nothing here
 	}
@@ -289,6 +326,7 @@ namespace Renderer
 		delete [] mVertexAttributes;
 		delete [] mSubMeshes;
 		delete [] mSkeletonData;	// In case the mesh resource loaded was never dispatched
+		delete [] mEncodedBufferData;
 	}
 
 	void MeshResourceLoader::createVertexArrays()
@@ -319,6 +357,20 @@ namespace Renderer
 		}
 	}
 
+	void MeshResourceLoader::readEncodedBufferData(uint32_t numberOfEncodedBytes)
+	{
+		// Allocate memory for the temporary encoded buffer data
+		if (mNumberOfEncodedBufferDataBytes < numberOfEncodedBytes)
+		{
+			mNumberOfEncodedBufferDataBytes = numberOfEncodedBytes;
+			delete [] mEncodedBufferData;
+			mEncodedBufferData = new uint8_t[mNumberOfEncodedBufferDataBytes];
+		}
+
+		// Read in the encoded buffer data
+		mMemoryFile.read(mEncodedBufferData, numberOfEncodedBytes);
+	}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -117,6 +117,15 @@ namespace Renderer
 		MeshResourceLoader& operator=(const MeshResourceLoader&) = delete;
 		void createVertexArrays();
 
+		/**
+		*  @brief
+		*    Read "meshoptimizer" encoded buffer data from the memory file into the temporary encoded buffer
+		*
+		*  @param[in] numberOfEncodedBytes
+		*    Number of encoded bytes to read
+		*/
+		void readEncodedBufferData(uint32_t numberOfEncodedBytes);
+
 
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
@@ -159,6 +168,10 @@ namespace Renderer
 		uint8_t  mNumberOfBones;
 		uint8_t* mSkeletonData;
 
+		// Temporary "meshoptimizer" encoded vertex or index buffer
+		uint32_t mNumberOfEncodedBufferDataBytes;
+		uint8_t* mEncodedBufferData;
+
 
 	};
 
@@ -169,6 +169,134 @@ namespace
 				0																// instancesPerElement (uint32_t)
 			}
 		};
+		// Quantized vertex input layout: Identical to the default one but with 16 bit signed normalized positions relative to the mesh bounding box and 16 bit floating point texture coordinates
+		// -> The position dequantization is folded into the instance transform, see "Renderer::Renderable::setPositionDequantization()"
+		static constexpr Rhi::VertexAttribute QuantizedStaticVertexAttributesLayout[] =
+		{
+			{ // Attribute 0
+				// Data destination
+				Rhi::VertexAttributeFormat::SHORT_4_SNORM,						// vertexAttributeFormat (Rhi::VertexAttributeFormat)
+				"Position",														// name[32] (char)
+				"POSITION",														// semanticName[32] (char)
+				0,																// semanticIndex (uint32_t)
+				// Data source
+				0,																// inputSlot (uint32_t)
+				0,																// alignedByteOffset (uint32_t)
+				sizeof(short) * 4 + sizeof(uint16_t) * 2 + sizeof(short) * 4,	// strideInBytes (uint32_t)
+				0																// instancesPerElement (uint32_t)
+			},
+			{ // Attribute 1
+				// Data destination
+				Rhi::VertexAttributeFormat::HALF_2,								// vertexAttributeFormat (Rhi::VertexAttributeFormat)
+				"TexCoord",														// name[32] (char)
+				"TEXCOORD",														// semanticName[32] (char)
+				0,																// semanticIndex (uint32_t)
+				// Data source
+				0,																// inputSlot (uint32_t)
+				sizeof(short) * 4,												// alignedByteOffset (uint32_t)
+				sizeof(short) * 4 + sizeof(uint16_t) * 2 + sizeof(short) * 4,	// strideInBytes (uint32_t)
+				0																// instancesPerElement (uint32_t)
+			},
+			{ // Attribute 2
+				// Data destination
+				Rhi::VertexAttributeFormat::SHORT_4,							// vertexAttributeFormat (Rhi::VertexAttributeFormat)
+				"QTangent",														// name[32] (char)
+				"TEXCOORD",														// semanticName[32] (char)
+				1,																// semanticIndex (uint32_t)
+				// Data source
+				0,																// inputSlot (uint32_t)
+				sizeof(short) * 4 + sizeof(uint16_t) * 2,						// alignedByteOffset (uint32_t)
+				sizeof(short) * 4 + sizeof(uint16_t) * 2 + sizeof(short) * 4,	// strideInBytes (uint32_t)
+				0																// instancesPerElement (uint32_t)
+			},
+			{ // Attribute 3, see "17/11/2012 Surviving without gl_DrawID" - https://www.g-truc.net/post-0518.html
+				// Data destination
+				Rhi::VertexAttributeFormat::UINT_1,								// vertexAttributeFormat (Rhi::VertexAttributeFormat)
+				"drawId",														// name[32] (char)
+				"DRAWID",														// semanticName[32] (char)
+				0,																// semanticIndex (uint32_t)
+				// Data source
+				1,																// inputSlot (uint32_t)
+				0,																// alignedByteOffset (uint32_t)
+				sizeof(uint32_t),												// strideInBytes (uint32_t)
+				1																// instancesPerElement (uint32_t)
+			}
+		};
+		static constexpr Rhi::VertexAttribute QuantizedSkinnedVertexAttributesLayout[] =
+		{
+			{ // Attribute 0
+				// Data destination
+				Rhi::VertexAttributeFormat::FLOAT_3,												// vertexAttributeFormat (Rhi::VertexAttributeFormat)
+				"Position",																			// name[32] (char)
+				"POSITION",																			// semanticName[32] (char)
+				0,																					// semanticIndex (uint32_t)
+				// Data source
+				0,																					// inputSlot (uint32_t)
+				0,																					// alignedByteOffset (uint32_t)
+				sizeof(float) * 3 + sizeof(uint16_t) * 2 + sizeof(short) * 4 + sizeof(uint8_t) * 8,	// strideInBytes (uint32_t)
+				0																					// instancesPerElement (uint32_t)
+			},
+			{ // Attribute 1
+				// Data destination
+				Rhi::VertexAttributeFormat::HALF_2,													// vertexAttributeFormat (Rhi::VertexAttributeFormat)
+				"TexCoord",																			// name[32] (char)
+				"TEXCOORD",																			// semanticName[32] (char)
+				0,																					// semanticIndex (uint32_t)
+				// Data source
+				0,																					// inputSlot (uint32_t)
+				sizeof(float) * 3,																	// alignedByteOffset (uint32_t)
+				sizeof(float) * 3 + sizeof(uint16_t) * 2 + sizeof(short) * 4 + sizeof(uint8_t) * 8,	// strideInBytes (uint32_t)
+				0																					// instancesPerElement (uint32_t)
+			},
+			{ // Attribute 2
+				// Data destination
+				Rhi::VertexAttributeFormat::SHORT_4,												// vertexAttributeFormat (Rhi::VertexAttributeFormat)
+				"QTangent",																			// name[32] (char)
+				"TEXCOORD",																			// semanticName[32] (char)
+				1,																					// semanticIndex (uint32_t)
+				// Data source
+				0,																					// inputSlot (uint32_t)
+				sizeof(float) * 3 + sizeof(uint16_t) * 2,											// alignedByteOffset (uint32_t)
+				sizeof(float) * 3 + sizeof(uint16_t) * 2 + sizeof(short) * 4 + sizeof(uint8_t) * 8,	// strideInBytes (uint32_t)
+				0																					// instancesPerElement (uint32_t)
+			},
+			{ // Attribute 3, see "17/11/2012 Surviving without gl_DrawID" - https://www.g-truc.net/post-0518.html
+				// Data destination
+				Rhi::VertexAttributeFormat::UINT_1,													// vertexAttributeFormat (Rhi::VertexAttributeFormat)
+				"drawId",																			// name[32] (char)
+				"DRAWID",																			// semanticName[32] (char)
+				0,																					// semanticIndex (uint32_t)
+				// Data source
+				1,																					// inputSlot (uint32_t)
+				0,																					// alignedByteOffset (uint32_t)
+				sizeof(uint32_t),																	// strideInBytes (uint32_t)
+				1																					// instancesPerElement (uint32_t)
+			},
+			{ // Attribute 4
+				// Data destination
+				Rhi::VertexAttributeFormat::R8G8B8A8_UINT,											// vertexAttributeFormat (Rhi::VertexAttributeFormat)
+				"BlendIndices",																		// name[32] (char)
+				"BLENDINDICES",																		// semanticName[32] (char)
+				0,																					// semanticIndex (uint32_t)
+				// Data source
+				0,																					// inputSlot (uint32_t)
+				sizeof(float) * 3 + sizeof(uint16_t) * 2 + sizeof(short) * 4,						// alignedByteOffset (uint32_t)
+				sizeof(float) * 3 + sizeof(uint16_t) * 2 + sizeof(short) * 4 + sizeof(uint8_t) * 8,	// strideInBytes (uint32_t)
+				0																					// instancesPerElement (uint32_t)
+			},
+			{ // Attribute 5
+				// Data destination
+				Rhi::VertexAttributeFormat::R8G8B8A8_UINT,											// vertexAttributeFormat (Rhi::VertexAttributeFormat)
+				"BlendWeights",																		// name[32] (char)
+				"BLENDWEIGHT",																		// semanticName[32] (char)
+				0,																					// semanticIndex (uint32_t)
+				// Data source
+				0,																					// inputSlot (uint32_t)
+				sizeof(float) * 3 + sizeof(uint16_t) * 2 + sizeof(short) * 4 + sizeof(uint8_t) * 4,	// alignedByteOffset (uint32_t)
+				sizeof(float) * 3 + sizeof(uint16_t) * 2 + sizeof(short) * 4 + sizeof(uint8_t) * 8,	// strideInBytes (uint32_t)
+				0																					// instancesPerElement (uint32_t)
+			}
+		};
 
 
 //[-------------------------------------------------------]
@@ -190,6 +318,8 @@ namespace Renderer
 	//[-------------------------------------------------------]
 	const Rhi::VertexAttributes MeshResource::VERTEX_ATTRIBUTES(static_cast<uint32_t>(GLM_COUNTOF(::detail::StaticVertexAttributesLayout)), ::detail::StaticVertexAttributesLayout);
 	const Rhi::VertexAttributes MeshResource::SKINNED_VERTEX_ATTRIBUTES(static_cast<uint32_t>(GLM_COUNTOF(::detail::SkinnedVertexAttributesLayout)), ::detail::SkinnedVertexAttributesLayout);
+	const Rhi::VertexAttributes MeshResource::QUANTIZED_VERTEX_ATTRIBUTES(static_cast<uint32_t>(GLM_COUNTOF(::detail::QuantizedStaticVertexAttributesLayout)), ::detail::QuantizedStaticVertexAttributesLayout);
+	const Rhi::VertexAttributes MeshResource::QUANTIZED_SKINNED_VERTEX_ATTRIBUTES(static_cast<uint32_t>(GLM_COUNTOF(::detail::QuantizedSkinnedVertexAttributesLayout)), ::detail::QuantizedSkinnedVertexAttributesLayout);
 
 
 //[-------------------------------------------------------]
@@ -96,8 +96,10 @@ namespace Renderer
 	//[ Public definitions                                    ]
 	//[-------------------------------------------------------]
 	public:
-		RENDERER_API_EXPORT static const Rhi::VertexAttributes VERTEX_ATTRIBUTES;			///< Default vertex attributes layout, whenever possible stick to this to be as compatible as possible to the rest
-		RENDERER_API_EXPORT static const Rhi::VertexAttributes SKINNED_VERTEX_ATTRIBUTES;	///< Default skinned vertex attributes layout, whenever possible stick to this to be as compatible as possible to the rest
+		RENDERER_API_EXPORT static const Rhi::VertexAttributes VERTEX_ATTRIBUTES;					///< Default vertex attributes layout, whenever possible stick to this to be as compatible as possible to the rest
+		RENDERER_API_EXPORT static const Rhi::VertexAttributes SKINNED_VERTEX_ATTRIBUTES;			///< Default skinned vertex attributes layout, whenever possible stick to this to be as compatible as possible to the rest
+		RENDERER_API_EXPORT static const Rhi::VertexAttributes QUANTIZED_VERTEX_ATTRIBUTES;			///< Quantized vertex attributes layout (16 bit signed normalized bounding box relative positions, 16 bit floating point texture coordinates), opt-in via the mesh asset compiler "QuantizeVertices" property
+		RENDERER_API_EXPORT static const Rhi::VertexAttributes QUANTIZED_SKINNED_VERTEX_ATTRIBUTES;	///< Quantized skinned vertex attributes layout (16 bit floating point texture coordinates, positions stay 32 bit since the bones are applied in object space), opt-in via the mesh asset compiler "QuantizeVertices" property
 
 
 	//[-------------------------------------------------------]
@@ -178,6 +180,16 @@ namespace Renderer
 			mPositionOnlyVertexArray = positionOnlyVertexArray;
 		}
 
+		[[nodiscard]] inline bool hasQuantizedVertices() const
+		{
+			return mQuantizedVertices;
+		}
+
+		inline void setQuantizedVertices(bool quantizedVertices)
+		{
+			mQuantizedVertices = quantizedVertices;
+		}
+
 		//[-------------------------------------------------------]
 		//[ Sub-meshes and LODs                                   ]
 		//[-------------------------------------------------------]
@@ -228,6 +240,7 @@ namespace Renderer
 			// Vertex and index data
 			mNumberOfVertices(0),
 			mNumberOfIndices(0),
+			mQuantizedVertices(false),
 			// Sub-meshes and LODs
 			mNumberOfLods(0),
 			// Optional skeleton
@@ -292,6 +305,7 @@ namespace Renderer
 			mNumberOfIndices = 0;
 			mVertexArray = nullptr;
 			mPositionOnlyVertexArray = nullptr;
+			mQuantizedVertices = false;
 			mSubMeshes.clear();
 			mNumberOfIndices = 0;
 			setInvalid(mSkeletonResourceId);
@@ -315,6 +329,7 @@ namespace Renderer
 		uint32_t			 mNumberOfIndices;			///< Number of indices
 		Rhi::IVertexArrayPtr mVertexArray;				///< Vertex array object (VAO), can be a null pointer, directly containing also the index data of all LODs
 		Rhi::IVertexArrayPtr mPositionOnlyVertexArray;	///< Optional position-only vertex array object (VAO) which can reduce the number of processed vertices up to half, can be a null pointer, can be used for position-only rendering (e.g. shadow map rendering) using the same vertex data that the original vertex array object (VAO) uses, directly containing also the index data of all LODs
+		bool				 mQuantizedVertices;		///< "true" if the vertex data uses the quantized vertex attributes layout, the material blueprint resource then selects its quantized vertex attributes
 		// Sub-meshes and LODs
 		SubMeshes			 mSubMeshes;			///< Sub-meshes, directly containing also the sub-meshes of all LODs, each LOD has the same number of sub-meshes
 		uint8_t				 mNumberOfLods;			///< Number of LODs, there's always at least one LOD, namely the original none reduced version
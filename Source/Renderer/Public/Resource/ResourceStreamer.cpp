@@ -26,12 +26,50 @@
 #include "Renderer/Public/Resource/IResourceManager.h"
 #include "Renderer/Public/Core/Platform/PlatformManager.h"
 #include "Renderer/Public/Core/File/IFileManager.h"
+#include "Renderer/Public/Core/Time/Stopwatch.h"
 #include "Renderer/Public/IRenderer.h"
 
 // TODO(co) Can we do something about the warning which does not involve using "std::thread"-pointers?
 PRAGMA_WARNING_DISABLE_MSVC(4355)	// warning C4355: 'this': used in base member initializer list
 
 
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Global functions                                      ]
+		//[-------------------------------------------------------]
+		[[nodiscard]] std::deque<Renderer::ResourceStreamer::LoadRequest>::iterator findLoadRequest(std::deque<Renderer::ResourceStreamer::LoadRequest>& loadRequests, const Renderer::IResource* resource)
+		{
+			// No resource given means any load request will do
+			if (nullptr == resource)
+			{
+				return loadRequests.begin();
+			}
+			const Renderer::IResourceManager* resourceManager = &resource->getResourceManager();
+			const Renderer::ResourceId resourceId = resource->getId();
+			std::deque<Renderer::ResourceStreamer::LoadRequest>::iterator iterator = loadRequests.begin();
+			while (iterator != loadRequests.end() && (iterator->resourceManager != resourceManager || iterator->resourceId != resourceId))
+			{
+				++iterator;
+			}
+			return iterator;
+		}
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
+
+
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
@@ -65,6 +103,27 @@ namespace Renderer
 		mDeserializationConditionVariable.notify_one();
 	}
 
+	void ResourceStreamer::processEmergencyLoadRequest(const IResource& resource)
+	{
+		if (IResource::LoadingState::LOADING == resource.getLoadingState())
+		{
+			const Stopwatch stopwatch(true);
+			do
+			{
+				// Pull the load request of the resource out of the queues and process it right now on the calling thread. If that's not possible because
+				// it's in-flight inside a resource streamer thread or waiting for dependencies, help out by processing other queued load requests.
+				if (!processQueuedLoadRequest(&resource) && !processQueuedLoadRequest(nullptr))
+				{
+					// Nothing left which can be done on the calling thread, give the resource streamer threads a moment
+					std::this_thread::yield();
+				}
+				dispatch();
+			} while (IResource::LoadingState::LOADING == resource.getLoadingState());
+			++mNumberOfEmergencyLoadRequests;
+			mEmergencyLoadRequestsMicroseconds += stopwatch.getMicroseconds();
+		}
+	}
+
 	void ResourceStreamer::flushAllQueues()
 	{
 		bool everythingFlushed = false;
@@ -123,15 +182,7 @@ namespace Renderer
 			dispatchMutexLock.unlock();
 
 			// Do the work
-			if (loadRequest.loadingFailed || loadRequest.resourceLoader->onDispatch())
-			{
-				// Load request is finished now
-				finalizeLoadRequest(loadRequest);
-			}
-			else
-			{
-				mFullyLoadedWaitingQueue.push_back(loadRequest);
-			}
+			dispatchLoadRequest(loadRequest);
 		}
 
 		// Check fully loaded waiting queue
@@ -161,6 +212,8 @@ namespace Renderer
 	ResourceStreamer::ResourceStreamer(IRenderer& renderer) :
 		mRenderer(renderer),
 		mNumberOfInFlightLoadRequests(0),
+		mNumberOfEmergencyLoadRequests(0),
+		mEmergencyLoadRequestsMicroseconds(0),
 		mShutdownDeserializationThread(false),
 		mDeserializationWaitingQueueRequests(0),
 		mDeserializationThread(&ResourceStreamer::deserializationThreadWorker, this),
@@ -206,104 +259,29 @@ namespace Renderer
 				LoadRequest loadRequest = mDeserializationQueue.front();
 				mDeserializationQueue.pop_front();
 
-				{ // Get resource loader instance
-					std::lock_guard<std::mutex> resourceManagerMutexLock(mResourceManagerMutex);
-					const ResourceLoaderTypeId resourceLoaderTypeId = loadRequest.resourceLoaderTypeId;
-					ResourceLoaderTypeManager::iterator iterator = mResourceLoaderTypeManager.find(resourceLoaderTypeId);
-					if (mResourceLoaderTypeManager.cend() == iterator)
-					{
-						// The resource loader type ID is unknown, yet
-						ResourceLoaderType resourceLoaderType;
-						resourceLoaderType.numberOfInstances = 1;
-						mResourceLoaderTypeManager.emplace(resourceLoaderTypeId, resourceLoaderType);
-						loadRequest.resourceLoader = loadRequest.resourceManager->createResourceLoaderInstance(resourceLoaderTypeId);
-					}
-					else
-					{
-						// The resource loader type ID is already known
-
-						// First check whether or not we're able to reuse a free resource loader instance
-						ResourceLoaderType& resourceLoaderType = iterator->second;
-						ResourceLoaders& freeResourceLoaders = resourceLoaderType.freeResourceLoaders;
-						if (freeResourceLoaders.empty())
-						{
-							// In order to keep the memory consumption under control, we limit the number of simultaneous resource loader type instances
-							if (resourceLoaderType.numberOfInstances < 5)
-							{
-								loadRequest.resourceLoader = loadRequest.resourceManager->createResourceLoaderInstance(resourceLoaderTypeId);
-								RHI_ASSERT(mRenderer.getContext(), nullptr != loadRequest.resourceLoader, "Invalid load request resource loader")
-								++resourceLoaderType.numberOfInstances;
-							}
-							else
-							{
-								// We were unable to acquire a resource loader instance, we just have to try it later again
-								resourceLoaderType.waitingLoadRequests.push_back(loadRequest);
-								++mDeserializationWaitingQueueRequests;
-							}
-						}
-						else
-						{
-							loadRequest.resourceLoader = freeResourceLoaders.back();
-							freeResourceLoaders.pop_back();
-						}
-					}
-				}
-
 				// If we've got a resource loader instance now, let's continue with the resource streaming pipeline
-				if (nullptr != loadRequest.resourceLoader)
+				if (acquireResourceLoader(loadRequest, false))
 				{
 					deserializationMutexLock.unlock();
-					loadRequest.resourceLoader->initialize(*loadRequest.asset, loadRequest.reload, loadRequest.getResource());
 
 					// Do the work
-					if (loadRequest.resourceLoader->hasDeserialization())
-					{
-						IFileManager& fileManager = mRenderer.getFileManager();
-						IFile* file = fileManager.openFile(IFileManager::FileMode::READ, loadRequest.resourceLoader->getAsset().virtualFilename);
-						if (nullptr != file)
-						{
-							if (loadRequest.resourceLoader->onDeserialization(*file))
-							{
-								// Push the load request into the queue of the next resource streamer pipeline stage
-								if (loadRequest.resourceLoader->hasProcessing())
-								{
-									// Resource streamer stage: 2. Asynchronous processing
-									std::unique_lock<std::mutex> processingMutexLock(mProcessingMutex);
-									mProcessingQueue.push_back(loadRequest);
-									processingMutexLock.unlock();
-									mProcessingConditionVariable.notify_one();
-								}
-								else
-								{
-									// Resource streamer stage: 3. Synchronous dispatch to e.g. the RHI implementation
-									std::lock_guard<std::mutex> dispatchMutexLock(mDispatchMutex);
-									mDispatchQueue.push_back(loadRequest);
-								}
-							}
-							else
-							{
-								// Resource streamer stage: 3. Synchronous dispatch to finish off the failed loading attempt
-								loadRequest.loadingFailed = true;
-								std::lock_guard<std::mutex> dispatchMutexLock(mDispatchMutex);
-								mDispatchQueue.push_back(loadRequest);
-							}
-							fileManager.closeFile(*file);
-						}
-						else
-						{
-							// Error! This is horrible, now we've got a zombie inside the resource streamer. We could let it crash, but maybe the zombie won't directly eat brains.
-							RHI_ASSERT(mRenderer.getContext(), false, "We should never end up in here")
-						}
-					}
-					else
+					deserializeLoadRequest(loadRequest);
+
+					// Push the load request into the queue of the next resource streamer pipeline stage
+					if (!loadRequest.loadingFailed && (!loadRequest.resourceLoader->hasDeserialization() || loadRequest.resourceLoader->hasProcessing()))
 					{
-						// Push the load request into the queue of the next resource streamer pipeline stage
-						// -> Resource streamer stage: 2. Asynchronous processing
+						// Resource streamer stage: 2. Asynchronous processing
 						std::unique_lock<std::mutex> processingMutexLock(mProcessingMutex);
 						mProcessingQueue.push_back(loadRequest);
 						processingMutexLock.unlock();
 						mProcessingConditionVariable.notify_one();
 					}
+					else
+					{
+						// Resource streamer stage: 3. Synchronous dispatch to e.g. the RHI implementation (also used to finish off a failed loading attempt)
+						std::lock_guard<std::mutex> dispatchMutexLock(mDispatchMutex);
+						mDispatchQueue.push_back(loadRequest);
+					}
 
 					// We're ready for the next round
 					deserializationMutexLock.lock();
@@ -344,6 +322,181 @@ namespace Renderer
 		}
 	}
 
+	bool ResourceStreamer::acquireResourceLoader(LoadRequest& loadRequest, bool emergency)
+	{
+		// Get resource loader instance
+		std::lock_guard<std::mutex> resourceManagerMutexLock(mResourceManagerMutex);
+		const ResourceLoaderTypeId resourceLoaderTypeId = loadRequest.resourceLoaderTypeId;
+		ResourceLoaderTypeManager::iterator iterator = mResourceLoaderTypeManager.find(resourceLoaderTypeId);
+		if (mResourceLoaderTypeManager.cend() == iterator)
+		{
+			// The resource loader type ID is unknown, yet
+			ResourceLoaderType resourceLoaderType;
+			resourceLoaderType.numberOfInstances = 1;
+			mResourceLoaderTypeManager.emplace(resourceLoaderTypeId, resourceLoaderType);
+			loadRequest.resourceLoader = loadRequest.resourceManager->createResourceLoaderInstance(resourceLoaderTypeId);
+		}
+		else
+		{
+			// The resource loader type ID is already known
+
+			// First check whether or not we're able to reuse a free resource loader instance
+			ResourceLoaderType& resourceLoaderType = iterator->second;
+			ResourceLoaders& freeResourceLoaders = resourceLoaderType.freeResourceLoaders;
+			if (freeResourceLoaders.empty())
+			{
+				// In order to keep the memory consumption under control, we limit the number of simultaneous resource loader type instances
+				// -> An emergency load request can't wait for a free resource loader instance
+				if (resourceLoaderType.numberOfInstances < 5 || emergency)
+				{
+					loadRequest.resourceLoader = loadRequest.resourceManager->createResourceLoaderInstance(resourceLoaderTypeId);
+					RHI_ASSERT(mRenderer.getContext(), nullptr != loadRequest.resourceLoader, "Invalid load request resource loader")
+					++resourceLoaderType.numberOfInstances;
+				}
+				else
+				{
+					// We were unable to acquire a resource loader instance, we just have to try it later again
+					resourceLoaderType.waitingLoadRequests.push_back(loadRequest);
+					++mDeserializationWaitingQueueRequests;
+				}
+			}
+			else
+			{
+				loadRequest.resourceLoader = freeResourceLoaders.back();
+				freeResourceLoaders.pop_back();
+			}
+		}
+
+		// Done
+		return (nullptr != loadRequest.resourceLoader);
+	}
+
+	void ResourceStreamer::deserializeLoadRequest(LoadRequest& loadRequest)
+	{
+		// Resource streamer stage: 1. Asynchronous deserialization
+		loadRequest.resourceLoader->initialize(*loadRequest.asset, loadRequest.reload, loadRequest.getResource());
+		if (loadRequest.resourceLoader->hasDeserialization())
+		{
+			IFileManager& fileManager = mRenderer.getFileManager();
+			IFile* file = fileManager.openFile(IFileManager::FileMode::READ, loadRequest.resourceLoader->getAsset().virtualFilename);
+			if (nullptr != file)
+			{
+				if (!loadRequest.resourceLoader->onDeserialization(*file))
+				{
+					loadRequest.loadingFailed = true;
+				}
+				fileManager.closeFile(*file);
+			}
+			else
+			{
+				// Error! Finish off the failed loading attempt, else we would end up with a zombie inside the resource streamer
+				RHI_ASSERT(mRenderer.getContext(), false, "We should never end up in here")
+				loadRequest.loadingFailed = true;
+			}
+		}
+	}
+
+	void ResourceStreamer::dispatchLoadRequest(const LoadRequest& loadRequest)
+	{
+		// Resource streamer stage: 3. Synchronous dispatch to e.g. the RHI implementation
+		if (loadRequest.loadingFailed || loadRequest.resourceLoader->onDispatch())
+		{
+			// Load request is finished now
+			finalizeLoadRequest(loadRequest);
+		}
+		else
+		{
+			mFullyLoadedWaitingQueue.push_back(loadRequest);
+		}
+	}
+
+	void ResourceStreamer::processLoadRequest(LoadRequest& loadRequest)
+	{
+		// Process all resource streamer stages at once on the calling thread
+		deserializeLoadRequest(loadRequest);
+		if (!loadRequest.loadingFailed && (!loadRequest.resourceLoader->hasDeserialization() || loadRequest.resourceLoader->hasProcessing()))
+		{
+			loadRequest.resourceLoader->onProcessing();
+		}
+		dispatchLoadRequest(loadRequest);
+	}
+
+	bool ResourceStreamer::processQueuedLoadRequest(const IResource* resource)
+	{
+		// Search for the load request of the given resource, or any load request if no resource is given, beginning at the earliest resource streamer stage
+
+		{ // Resource streamer stage: 1. Asynchronous deserialization
+			std::unique_lock<std::mutex> deserializationMutexLock(mDeserializationMutex);
+			LoadRequests::iterator iterator = ::detail::findLoadRequest(mDeserializationQueue, resource);
+			if (mDeserializationQueue.end() != iterator)
+			{
+				LoadRequest loadRequest = *iterator;
+				mDeserializationQueue.erase(iterator);
+				const bool resourceLoaderAcquired = acquireResourceLoader(loadRequest, nullptr != resource);
+				deserializationMutexLock.unlock();
+				if (resourceLoaderAcquired)
+				{
+					processLoadRequest(loadRequest);
+				}
+				return true;
+			}
+		}
+
+		// Resource streamer stage: 1. Asynchronous deserialization, load request waiting for a free resource loader instance
+		if (nullptr != resource)
+		{
+			std::unique_lock<std::mutex> resourceManagerMutexLock(mResourceManagerMutex);
+			for (auto& resourceLoaderType : mResourceLoaderTypeManager)
+			{
+				LoadRequests& waitingLoadRequests = resourceLoaderType.second.waitingLoadRequests;
+				LoadRequests::iterator iterator = ::detail::findLoadRequest(waitingLoadRequests, resource);
+				if (waitingLoadRequests.end() != iterator)
+				{
+					LoadRequest loadRequest = *iterator;
+					waitingLoadRequests.erase(iterator);
+					RHI_ASSERT(mRenderer.getContext(), 0 != mDeserializationWaitingQueueRequests, "Invalid deserialization waiting queue requests")
+					--mDeserializationWaitingQueueRequests;
+					resourceManagerMutexLock.unlock();
+					if (acquireResourceLoader(loadRequest, true))
+					{
+						processLoadRequest(loadRequest);
+					}
+					return true;
+				}
+			}
+		}
+
+		{ // Resource streamer stage: 2. Asynchronous processing
+			std::unique_lock<std::mutex> processingMutexLock(mProcessingMutex);
+			LoadRequests::iterator iterator = ::detail::findLoadRequest(mProcessingQueue, resource);
+			if (mProcessingQueue.end() != iterator)
+			{
+				LoadRequest loadRequest = *iterator;
+				mProcessingQueue.erase(iterator);
+				processingMutexLock.unlock();
+				loadRequest.resourceLoader->onProcessing();
+				dispatchLoadRequest(loadRequest);
+				return true;
+			}
+		}
+
+		{ // Resource streamer stage: 3. Synchronous dispatch to e.g. the RHI implementation
+			std::unique_lock<std::mutex> dispatchMutexLock(mDispatchMutex);
+			LoadRequests::iterator iterator = ::detail::findLoadRequest(mDispatchQueue, resource);
+			if (mDispatchQueue.end() != iterator)
+			{
+				LoadRequest loadRequest = *iterator;
+				mDispatchQueue.erase(iterator);
+				dispatchMutexLock.unlock();
+				dispatchLoadRequest(loadRequest);
+				return true;
+			}
+		}
+
+		// Nothing to process on the calling thread
+		return false;
+	}
+
 	void ResourceStreamer::finalizeLoadRequest(const LoadRequest& loadRequest)
 	{
 		{ // Release the resource loader instance
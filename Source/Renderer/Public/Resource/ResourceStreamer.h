@@ -38,6 +38,7 @@ PRAGMA_WARNING_PUSH
 	PRAGMA_WARNING_DISABLE_MSVC(5027)	// warning C5027: 'std::_UInt_is_zero': move assignment operator was implicitly defined as deleted
 	PRAGMA_WARNING_DISABLE_MSVC(5039)	// warning C5039: '_Thrd_start': pointer or reference to potentially throwing function passed to extern C function under -EHc. Undefined behavior may occur if this function throws an exception.
 	#include <atomic>	// For "std::atomic<>"
+	#include <ctime>	// For "std::time_t"
 	#include <deque>
 	#include <mutex>
 	#include <thread>
@@ -145,7 +146,36 @@ namespace Renderer
 			return mNumberOfInFlightLoadRequests;
 		}
 
+		[[nodiscard]] inline uint32_t getNumberOfEmergencyLoadRequests() const
+		{
+			return mNumberOfEmergencyLoadRequests;
+		}
+
+		[[nodiscard]] inline std::time_t getEmergencyLoadRequestsMicroseconds() const
+		{
+			return mEmergencyLoadRequestsMicroseconds;
+		}
+
 		void commitLoadRequest(const LoadRequest& loadRequest);
+
+		/**
+		*  @brief
+		*    Emergency immediate processing of the load request of the given resource
+		*
+		*  @param[in] resource
+		*    Resource to fully load, if the resource isn't currently loading nothing happens
+		*
+		*  @remarks
+		*    Only use this if something truly must block. Instead of waiting for the asynchronous resource streamer threads, the load request of
+		*    the resource is pulled out of the resource streamer queues and processed on the calling thread. While waiting for in-flight work or
+		*    for resource dependencies, the calling thread helps out by processing other queued load requests instead of sleeping.
+		*
+		*  @note
+		*    - Must be called by the thread which is also calling "Renderer::ResourceStreamer::dispatch()"
+		*    - Blocks until the resource loading state is no longer "Renderer::IResource::LoadingState::LOADING"
+		*/
+		void processEmergencyLoadRequest(const IResource& resource);
+
 		void flushAllQueues();
 
 		/**
@@ -168,6 +198,11 @@ namespace Renderer
 		ResourceStreamer& operator=(const ResourceStreamer&) = delete;
 		void deserializationThreadWorker();
 		void processingThreadWorker();
+		[[nodiscard]] bool acquireResourceLoader(LoadRequest& loadRequest, bool emergency);
+		void deserializeLoadRequest(LoadRequest& loadRequest);
+		void dispatchLoadRequest(const LoadRequest& loadRequest);
+		void processLoadRequest(LoadRequest& loadRequest);
+		[[nodiscard]] bool processQueuedLoadRequest(const IResource* resource);
 		void finalizeLoadRequest(const LoadRequest& loadRequest);
 
 
@@ -193,6 +228,8 @@ namespace Renderer
 		IRenderer&			  mRenderer;	///< Renderer instance, do not destroy the instance
 		std::mutex			  mResourceManagerMutex;
 		std::atomic<uint32_t> mNumberOfInFlightLoadRequests;
+		uint32_t			  mNumberOfEmergencyLoadRequests;		///< Number of emergency load requests which had to block the calling thread
+		std::time_t			  mEmergencyLoadRequestsMicroseconds;	///< Total time in microseconds the calling thread was blocked by emergency load requests
 		// Resource streamer stage: 1. Asynchronous deserialization
 		std::atomic<bool>		    mShutdownDeserializationThread;
 		std::mutex					mDeserializationMutex;
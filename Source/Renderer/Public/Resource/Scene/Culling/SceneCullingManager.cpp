@@ -23,14 +23,18 @@
 //[-------------------------------------------------------]
 #include "Renderer/Public/Resource/Scene/Culling/SceneCullingManager.h"
 #include "Renderer/Public/Resource/Scene/Culling/SceneItemSet.h"
+#include "Renderer/Public/Resource/Scene/Culling/SoftwareOcclusionCuller.h"
 #include "Renderer/Public/Resource/Scene/Item/Camera/CameraSceneItem.h"
+#include "Renderer/Public/Resource/Scene/SceneResource.h"
 #include "Renderer/Public/Resource/Scene/SceneNode.h"
 #include "Renderer/Public/Resource/CompositorWorkspace/CompositorContextData.h"
 #include "Renderer/Public/Resource/CompositorWorkspace/CompositorWorkspaceInstance.h"
 #include "Renderer/Public/RenderQueue/RenderableManager.h"
 #include "Renderer/Public/Core/Thread/ThreadPool.h"
+#include "Renderer/Public/Core/Memory/FrameAllocator.h"
 #include "Renderer/Public/Core/Math/Math.h"
 #include "Renderer/Public/Core/Math/Frustum.h"
+#include "Renderer/Public/Core/IProfiler.h"
 #ifdef RENDERER_OPENVR
 	#include "Renderer/Public/Vr/IVrManager.h"
 #endif
@@ -265,7 +269,7 @@ namespace
 			}
 		}
 
-		FORCEINLINE void gatherRenderQueueIndexRangesRenderableManagersBySceneItem(Renderer::ISceneItem& sceneItem, const glm::dvec3& cameraPosition, Renderer::CompositorWorkspaceInstance::RenderQueueIndexRanges& renderQueueIndexRanges, std::vector<Renderer::ISceneItem*>& executeOnRenderingSceneItems)
+		FORCEINLINE void gatherRenderQueueIndexRangesRenderableManagersBySceneItem(Renderer::ISceneItem& sceneItem, const glm::dvec3& cameraPosition, float boundingSphereRadius, float screenSpaceScale, Renderer::CompositorWorkspaceInstance::RenderQueueIndexRanges& renderQueueIndexRanges, std::vector<Renderer::ISceneItem*>& executeOnRenderingSceneItems)
 		{
 			Renderer::RenderableManager* renderableManager = const_cast<Renderer::RenderableManager*>(sceneItem.getRenderableManager());	// TODO(co) Get rid of the evil const-cast
 			if (nullptr != renderableManager && renderableManager->isVisible() && !renderableManager->getRenderables().empty())
@@ -287,7 +291,12 @@ namespace
 				{
 					// Calculate the distance to the camera
 					// -> While using a 64 bit world space position, a 32 bit distance to camera is sufficient
-					renderableManager->setCachedDistanceToCamera(static_cast<float>(glm::distance(cameraPosition, sceneItem.getParentSceneNodeSafe().getGlobalTransform().position)));
+					const float distanceToCamera = static_cast<float>(glm::distance(cameraPosition, sceneItem.getParentSceneNodeSafe().getGlobalTransform().position));
+					renderableManager->setCachedDistanceToCamera(distanceToCamera);
+
+					// Calculate the on-screen size in pixels of the bounding sphere, used as texture streaming feedback
+					// -> Clamp the distance to the radius so a camera inside the bounding sphere results in a full screen size instead of an exploding one
+					renderableManager->setCachedScreenSpaceSize((boundingSphereRadius > 0.0f) ? screenSpaceScale * (boundingSphereRadius / std::max(distanceToCamera, boundingSphereRadius)) : 0.0f);
 
 					// Execute scene item on rendering?
 					if (sceneItem.getCallExecuteOnRendering())
@@ -300,10 +309,29 @@ namespace
 		}
 
 
+		inline void gatherShadowCasterRenderableManagerBySceneItem(Renderer::ISceneItem& sceneItem, const glm::dvec3& cameraPosition, uint8_t minimumRenderQueueIndex, uint8_t maximumRenderQueueIndex, Renderer::CompositorWorkspaceInstance::RenderableManagers& renderableManagers)
+		{
+			Renderer::RenderableManager* renderableManager = const_cast<Renderer::RenderableManager*>(sceneItem.getRenderableManager());	// TODO(co) Get rid of the evil const-cast
+			if (nullptr != renderableManager && renderableManager->isVisible() && renderableManager->getCastShadows() && !renderableManager->getRenderables().empty())
+			{
+				const uint8_t renderableManagerMinimumRenderQueueIndex = renderableManager->getMinimumRenderQueueIndex();
+				const uint8_t renderableManagerMaximumRenderQueueIndex = renderableManager->getMaximumRenderQueueIndex();
+				if ((renderableManagerMinimumRenderQueueIndex >= minimumRenderQueueIndex && renderableManagerMinimumRenderQueueIndex <= maximumRenderQueueIndex) ||
+					(renderableManagerMaximumRenderQueueIndex >= minimumRenderQueueIndex && renderableManagerMaximumRenderQueueIndex <= maximumRenderQueueIndex))
+				{
+					// Shadow casters outside the camera frustum were not touched by the camera culling, so update the distance to the camera as well
+					// -> While using a 64 bit world space position, a 32 bit distance to camera is sufficient
+					renderableManager->setCachedDistanceToCamera(static_cast<float>(glm::distance(cameraPosition, sceneItem.getParentSceneNodeSafe().getGlobalTransform().position)));
+					renderableManagers.push_back(renderableManager);
+				}
+			}
+		}
+
+
 		//[-------------------------------------------------------]
 		//[ Global thread functions                               ]
 		//[-------------------------------------------------------]
-		void simdSphereCulling(const float4 worldSpaceCameraPosition[3], const SimdPlane planes[6], const Renderer::SceneItemSet& sceneItemSet, size_t threadSceneItemIndexStart, size_t threadSceneItemIndexEnd, uint32_t* RESTRICT visibilityFlag)
+		void simdSphereCulling(const float4 cullingOriginRelativeCameraPosition[3], const SimdPlane planes[6], const Renderer::SceneItemSet& sceneItemSet, size_t threadSceneItemIndexStart, size_t threadSceneItemIndexEnd, uint32_t* RESTRICT visibilityFlag)
 		{
 			// Get pointers to the necessary members of the object set
 			const float* RESTRICT spherePositionXData = sceneItemSet.spherePositionX.data();
@@ -328,10 +356,10 @@ namespace
 				#endif
 
 				// Get camera relative world space center position of bounding sphere
-				// -> After this step we no longer need a 64 bit world space position and a 32 bit world space position is sufficient for the rest of the calculations
-				const float4 spherePositionX = xsimd::load_aligned(&spherePositionXData[sceneItemIndex]) - worldSpaceCameraPosition[0];
-				const float4 spherePositionY = xsimd::load_aligned(&spherePositionYData[sceneItemIndex]) - worldSpaceCameraPosition[1];
-				const float4 spherePositionZ = xsimd::load_aligned(&spherePositionZData[sceneItemIndex]) - worldSpaceCameraPosition[2];
+				// -> Both positions are relative to the culling origin which is near the camera, so 32 bit positions are sufficient
+				const float4 spherePositionX = xsimd::load_aligned(&spherePositionXData[sceneItemIndex]) - cullingOriginRelativeCameraPosition[0];
+				const float4 spherePositionY = xsimd::load_aligned(&spherePositionYData[sceneItemIndex]) - cullingOriginRelativeCameraPosition[1];
+				const float4 spherePositionZ = xsimd::load_aligned(&spherePositionZData[sceneItemIndex]) - cullingOriginRelativeCameraPosition[2];
 
 				// Get negative world space radius of bounding sphere
 				const float4 negativeRadius = xsimd::load_aligned(&negativeRadiusData[sceneItemIndex]);
@@ -361,7 +389,7 @@ namespace
 			}
 		}
 
-		void simdOobbCulling([[maybe_unused]] const float4 worldSpaceCameraPositionFloat4[3], const SimdMatrix& viewSpaceToClipSpaceMatrix, const Renderer::SceneItemSet& sceneItemSet, const uint32_t* RESTRICT indirection, size_t threadSceneItemIndexStart, size_t threadSceneItemIndexEnd, uint32_t* RESTRICT visibilityFlag)
+		void simdOobbCulling(const float4 cullingOriginRelativeCameraPosition[3], const SimdMatrix& cameraRelativeWorldSpaceToClipSpaceMatrix, const Renderer::SceneItemSet& sceneItemSet, const uint32_t* RESTRICT indirection, size_t threadSceneItemIndexStart, size_t threadSceneItemIndexEnd, uint32_t* RESTRICT visibilityFlag)
 		{
 			// Get pointers to the necessary members of the object set
 
@@ -375,8 +403,7 @@ namespace
 			const float* RESTRICT maximumY = sceneItemSet.maximumY.data();
 			const float* RESTRICT maximumZ = sceneItemSet.maximumZ.data();
 
-			// TODO(co) Add camera relative rendering ("worldSpaceCameraPositionFloat4") and 64 bit world space position support
-			// Get object space to world space matrix
+			// Get object space to world space matrix, the position is relative to the culling origin
 			const float* RESTRICT worldXX = sceneItemSet.worldXX.data();
 			const float* RESTRICT worldXY = sceneItemSet.worldXY.data();
 			const float* RESTRICT worldXZ = sceneItemSet.worldXZ.data();
@@ -445,29 +472,31 @@ namespace
 				}
 				#endif
 
+				// The SIMD math transforms row vectors, while the scene item set stores the rows of a matrix transforming column vectors, so transpose while loading
+				// -> Make the position camera relative, both positions are relative to the culling origin which is near the camera, so 32 bit positions are sufficient
 				SimdMatrix world;
 				world.x.x = float4(worldXX[i0], worldXX[i1], worldXX[i2], worldXX[i3]);
-				world.x.y = float4(worldXY[i0], worldXY[i1], worldXY[i2], worldXY[i3]);
-				world.x.z = float4(worldXZ[i0], worldXZ[i1], worldXZ[i2], worldXZ[i3]);
-				world.x.w = float4(worldXW[i0], worldXW[i1], worldXW[i2], worldXW[i3]);
+				world.x.y = float4(worldYX[i0], worldYX[i1], worldYX[i2], worldYX[i3]);
+				world.x.z = float4(worldZX[i0], worldZX[i1], worldZX[i2], worldZX[i3]);
+				world.x.w = float4(worldWX[i0], worldWX[i1], worldWX[i2], worldWX[i3]);
 
-				world.y.x = float4(worldYX[i0], worldYX[i1], worldYX[i2], worldYX[i3]);
+				world.y.x = float4(worldXY[i0], worldXY[i1], worldXY[i2], worldXY[i3]);
 				world.y.y = float4(worldYY[i0], worldYY[i1], worldYY[i2], worldYY[i3]);
-				world.y.z = float4(worldYZ[i0], worldYZ[i1], worldYZ[i2], worldYZ[i3]);
-				world.y.w = float4(worldYW[i0], worldYW[i1], worldYW[i2], worldYW[i3]);
+				world.y.z = float4(worldZY[i0], worldZY[i1], worldZY[i2], worldZY[i3]);
+				world.y.w = float4(worldWY[i0], worldWY[i1], worldWY[i2], worldWY[i3]);
 
-				world.z.x = float4(worldZX[i0], worldZX[i1], worldZX[i2], worldZX[i3]);
-				world.z.y = float4(worldZY[i0], worldZY[i1], worldZY[i2], worldZY[i3]);
+				world.z.x = float4(worldXZ[i0], worldXZ[i1], worldXZ[i2], worldXZ[i3]);
+				world.z.y = float4(worldYZ[i0], worldYZ[i1], worldYZ[i2], worldYZ[i3]);
 				world.z.z = float4(worldZZ[i0], worldZZ[i1], worldZZ[i2], worldZZ[i3]);
-				world.z.w = float4(worldZW[i0], worldZW[i1], worldZW[i2], worldZW[i3]);
+				world.z.w = float4(worldWZ[i0], worldWZ[i1], worldWZ[i2], worldWZ[i3]);
 
-				world.w.x = float4(worldWX[i0], worldWX[i1], worldWX[i2], worldWX[i3]);
-				world.w.y = float4(worldWY[i0], worldWY[i1], worldWY[i2], worldWY[i3]);
-				world.w.z = float4(worldWZ[i0], worldWZ[i1], worldWZ[i2], worldWZ[i3]);
+				world.w.x = float4(worldXW[i0], worldXW[i1], worldXW[i2], worldXW[i3]) - cullingOriginRelativeCameraPosition[0];
+				world.w.y = float4(worldYW[i0], worldYW[i1], worldYW[i2], worldYW[i3]) - cullingOriginRelativeCameraPosition[1];
+				world.w.z = float4(worldZW[i0], worldZW[i1], worldZW[i2], worldZW[i3]) - cullingOriginRelativeCameraPosition[2];
 				world.w.w = float4(worldWW[i0], worldWW[i1], worldWW[i2], worldWW[i3]);
 
-				// Create the matrix to go from object->world->view->clip space
-				const SimdMatrix clip = simdMultiply(viewSpaceToClipSpaceMatrix, world);
+				// Create the matrix to go from object->camera relative world->clip space
+				const SimdMatrix clip = simdMultiply(world, cameraRelativeWorldSpaceToClipSpaceMatrix);
 
 				// Load the minimum and maximum corner positions of the bounding box in object space
 				SimdVector minimumPosition;
@@ -526,8 +555,79 @@ namespace
 
 				// TODO(co) Add "contribution culling" as mentioned at http://bitsquid.blogspot.de/2016/10/the-implementation-of-frustum-culling.html - "Conclusion"
 
-				// Store the result in the "visibilityFlag"-array in a compacted way
-				xsimd::store_aligned(reinterpret_cast<bool4*>(&visibilityFlag[sceneItemIndex]), inside);
+				// Store the result in the "visibilityFlag"-array at the scene item indices, "removeNotVisible()" reads it through the indirection table
+				alignas(XSIMD_DEFAULT_ALIGNMENT) uint32_t insideFlag[4];
+				xsimd::store_aligned(reinterpret_cast<bool4*>(insideFlag), inside);
+				visibilityFlag[i0] = insideFlag[0];
+				visibilityFlag[i1] = insideFlag[1];
+				visibilityFlag[i2] = insideFlag[2];
+				visibilityFlag[i3] = insideFlag[3];
+			}
+		}
+
+		/**
+		*  @brief
+		*    Arguments of a multi-threaded frustum-sphere culling task
+		*
+		*  @note
+		*    - Lives inside the frame allocator, the queued thread pool task only captures a pointer to it which fits into the small buffer of "std::function" (the "std::bind()" result didn't and hence was a heap allocation per task)
+		*/
+		struct SphereCullingTask final
+		{
+			const float4*				  cullingOriginRelativeCameraPosition;
+			const SimdPlane*			  planes;
+			const Renderer::SceneItemSet* sceneItemSet;
+			size_t						  threadSceneItemIndexStart;
+			size_t						  threadSceneItemIndexEnd;
+			uint32_t*					  visibilityFlag;
+		};
+
+		/**
+		*  @brief
+		*    Arguments of a multi-threaded frustum-OOBB culling task, see "::detail::SphereCullingTask"
+		*/
+		struct OobbCullingTask final
+		{
+			const float4*				  cullingOriginRelativeCameraPosition;
+			const SimdMatrix*			  cameraRelativeWorldSpaceToClipSpaceMatrix;
+			const Renderer::SceneItemSet* sceneItemSet;
+			const uint32_t*				  indirection;
+			size_t						  threadSceneItemIndexStart;
+			size_t						  threadSceneItemIndexEnd;
+			uint32_t*					  visibilityFlag;
+		};
+
+		void simdSphereCullingMultiThreaded(Renderer::DefaultThreadPool& defaultThreadPool, Renderer::FrameAllocator& frameAllocator, const float4 cullingOriginRelativeCameraPosition[3], const SimdPlane planes[6], Renderer::SceneItemSet& sceneItemSet)
+		{
+			size_t itemCount = sceneItemSet.numberOfSceneItems;
+			size_t splitCount = SCENE_ITEMS_SPLIT_COUNT;	// Package size for each thread to work on (will change when maximum number of threads is reached)
+			const size_t threadCount = defaultThreadPool.getThreadCountAndSplitCount(itemCount, splitCount);
+			if (1 == threadCount)
+			{
+				// Just execute it directly inside the current thread, not worth the additional threading effort
+				simdSphereCulling(cullingOriginRelativeCameraPosition, planes, sceneItemSet, 0, itemCount, sceneItemSet.visibilityFlag.data());
+			}
+			else
+			{
+				// Multi-threaded
+				// -> Reserve all tasks upfront, the queued thread pool tasks point into the vector
+				Renderer::FrameVector<SphereCullingTask> sphereCullingTasks{Renderer::FrameStlAllocator<SphereCullingTask>(frameAllocator)};
+				sphereCullingTasks.reserve(threadCount);
+				size_t threadSceneItemIndexOffset = 0;
+				for (size_t threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+				{
+					const size_t numberOfItemsToProcess = (threadIndex >= threadCount - 1) ? itemCount : splitCount;	// The last thread has to do all the rest of the remaining work
+					const SphereCullingTask* sphereCullingTask = &sphereCullingTasks.emplace_back(SphereCullingTask{ cullingOriginRelativeCameraPosition, planes, &sceneItemSet, threadSceneItemIndexOffset, threadSceneItemIndexOffset + numberOfItemsToProcess, sceneItemSet.visibilityFlag.data() });
+					defaultThreadPool.queueTask([sphereCullingTask]()
+						{
+							simdSphereCulling(sphereCullingTask->cullingOriginRelativeCameraPosition, sphereCullingTask->planes, *sphereCullingTask->sceneItemSet, sphereCullingTask->threadSceneItemIndexStart, sphereCullingTask->threadSceneItemIndexEnd, sphereCullingTask->visibilityFlag);
+						});
+					itemCount -= splitCount;
+					threadSceneItemIndexOffset += splitCount;
+				}
+
+				// Wait that all worker threads have done their part of the calculation
+				defaultThreadPool.process();
 			}
 		}
 
@@ -551,15 +651,99 @@ namespace Renderer
 	//[-------------------------------------------------------]
 	SceneCullingManager::SceneCullingManager() :
 		mCullableSceneItemSet(new SceneItemSet()),
-		mCullableShadowCastersSceneItemSet(new SceneItemSet())
+		mSoftwareOcclusionCuller(nullptr),
+		mVisibleMinimumViewSpaceDepth(std::numeric_limits<float>::max()),
+		mVisibleMaximumViewSpaceDepth(std::numeric_limits<float>::lowest())
 	{
 		// Nothing here
 	}
 
 	SceneCullingManager::~SceneCullingManager()
 	{
+		delete mSoftwareOcclusionCuller;
 		delete mCullableSceneItemSet;
-		delete mCullableShadowCastersSceneItemSet;
+	}
+
+	void SceneCullingManager::setOcclusionCullingEnabled(bool enabled)
+	{
+		if (enabled)
+		{
+			if (nullptr == mSoftwareOcclusionCuller)
+			{
+				mSoftwareOcclusionCuller = new SoftwareOcclusionCuller();
+			}
+		}
+		else
+		{
+			delete mSoftwareOcclusionCuller;
+			mSoftwareOcclusionCuller = nullptr;
+		}
+	}
+
+	void SceneCullingManager::reserveSceneItems(uint32_t numberOfSceneItems)
+	{
+		// Take the cullable scene items which are already there into account
+		// -> Reserve the SIMD lane count aligned size as well as prefetch ("xsimd::prefetch()" -> "_mm_prefetch()") so there's no reallocation when aligning the cullable scene item set later on
+		const uint32_t size = ::detail::alignToSimdLaneCount(mCullableSceneItemSet->numberOfSceneItems + numberOfSceneItems) + xsimd::simd_type<float>::size;
+
+		// Minimum object space bounding box corner position
+		mCullableSceneItemSet->minimumX.reserve(size);
+		mCullableSceneItemSet->minimumY.reserve(size);
+		mCullableSceneItemSet->minimumZ.reserve(size);
+
+		// Maximum object space bounding box corner position
+		mCullableSceneItemSet->maximumX.reserve(size);
+		mCullableSceneItemSet->maximumY.reserve(size);
+		mCullableSceneItemSet->maximumZ.reserve(size);
+
+		// Object space to world space matrix
+		mCullableSceneItemSet->worldXX.reserve(size);
+		mCullableSceneItemSet->worldXY.reserve(size);
+		mCullableSceneItemSet->worldXZ.reserve(size);
+		mCullableSceneItemSet->worldXW.reserve(size);
+		mCullableSceneItemSet->worldYX.reserve(size);
+		mCullableSceneItemSet->worldYY.reserve(size);
+		mCullableSceneItemSet->worldYZ.reserve(size);
+		mCullableSceneItemSet->worldYW.reserve(size);
+		mCullableSceneItemSet->worldZX.reserve(size);
+		mCullableSceneItemSet->worldZY.reserve(size);
+		mCullableSceneItemSet->worldZZ.reserve(size);
+		mCullableSceneItemSet->worldZW.reserve(size);
+		mCullableSceneItemSet->worldWX.reserve(size);
+		mCullableSceneItemSet->worldWY.reserve(size);
+		mCullableSceneItemSet->worldWZ.reserve(size);
+		mCullableSceneItemSet->worldWW.reserve(size);
+		mCullableSceneItemSet->positionX.reserve(size);
+		mCullableSceneItemSet->positionY.reserve(size);
+		mCullableSceneItemSet->positionZ.reserve(size);
+
+		// World space center position of bounding sphere
+		mCullableSceneItemSet->spherePositionX.reserve(size);
+		mCullableSceneItemSet->spherePositionY.reserve(size);
+		mCullableSceneItemSet->spherePositionZ.reserve(size);
+		mCullableSceneItemSet->spherePosition64X.reserve(size);
+		mCullableSceneItemSet->spherePosition64Y.reserve(size);
+		mCullableSceneItemSet->spherePosition64Z.reserve(size);
+
+		// Negative world space radius of bounding sphere
+		mCullableSceneItemSet->negativeRadius.reserve(size);
+
+		mCullableSceneItemSet->visibilityFlag.reserve(size);
+		mCullableSceneItemSet->occluderFlag.reserve(size);
+		mCullableSceneItemSet->sceneItemVector.reserve(size);
+		mIndirection.reserve(size);
+	}
+
+	void SceneCullingManager::setCullingOrigin(const glm::dvec3& origin)
+	{
+		// Recalculate the 32 bit positions relative to the new culling origin by using the 64 bit world space positions, the precision of the 32 bit positions doesn't degrade this way
+		SceneItemSet& sceneItemSet = *mCullableSceneItemSet;
+		sceneItemSet.origin = origin;
+		for (uint32_t i = 0; i < sceneItemSet.numberOfSceneItems; ++i)
+		{
+			sceneItemSet.setWorldSpacePosition(i, glm::dvec3(sceneItemSet.positionX[i], sceneItemSet.positionY[i], sceneItemSet.positionZ[i]));
+			sceneItemSet.setWorldSpaceSpherePosition(i, glm::dvec3(sceneItemSet.spherePosition64X[i], sceneItemSet.spherePosition64Y[i], sceneItemSet.spherePosition64Z[i]));
+		}
 	}
 
 	void SceneCullingManager::gatherRenderQueueIndexRangesRenderableManagers(const Rhi::IRenderTarget& renderTarget, const CompositorContextData& compositorContextData, CompositorWorkspaceInstance::RenderQueueIndexRanges& renderQueueIndexRanges, std::vector<ISceneItem*>& executeOnRenderingSceneItems)
@@ -571,6 +755,7 @@ namespace Renderer
 		// - For objects that pass sphere test, kick jobs to do frustum vs object-oriented bounding box (OOBB) culling
 		//   - For each frustum plane, test plane vs OOBB
 		// - Wait for OOBB culling to finish
+		// - Optional: Cull the OOBB visible objects against the software rasterized occluders
 		const IRenderer& renderer = compositorContextData.getCompositorWorkspaceInstance()->getRenderer();
 
 		// Get the camera scene item
@@ -585,17 +770,21 @@ namespace Renderer
 				const IVrManager& vrManager = renderer.getVrManager();
 				if (compositorContextData.getSinglePassStereoInstancing() && vrManager.isRunning() && !cameraSceneItem->hasCustomWorldSpaceToViewSpaceMatrix() && !cameraSceneItem->hasCustomViewSpaceToClipSpaceMatrix())
 				{
+					// No culling means no visible depth range either
+					mVisibleMinimumViewSpaceDepth = std::numeric_limits<float>::max();
+					mVisibleMaximumViewSpaceDepth = std::numeric_limits<float>::lowest();
+
 					// TODO(co) There are currently multiple culling issues notable when using stereo rendering, so disabled culling for now until this has been resolved
 					// Fill render queue index ranges with the visible stuff
 					const glm::dvec3& cameraPosition = cameraSceneItem->getParentSceneNodeSafe().getGlobalTransform().position;	// 64 bit world space position of the camera
 					for (uint32_t i = 0; i < mCullableSceneItemSet->numberOfSceneItems; ++i)
 					{
-						::detail::gatherRenderQueueIndexRangesRenderableManagersBySceneItem(*mCullableSceneItemSet->sceneItemVector[i], cameraPosition, renderQueueIndexRanges, executeOnRenderingSceneItems);
+						::detail::gatherRenderQueueIndexRangesRenderableManagersBySceneItem(*mCullableSceneItemSet->sceneItemVector[i], cameraPosition, 0.0f, 0.0f, renderQueueIndexRanges, executeOnRenderingSceneItems);
 					}
 					// Fill render queue index ranges with the always-visible stuff
 					for (ISceneItem* sceneItem : mUncullableSceneItems)
 					{
-						::detail::gatherRenderQueueIndexRangesRenderableManagersBySceneItem(*sceneItem, cameraPosition, renderQueueIndexRanges, executeOnRenderingSceneItems);
+						::detail::gatherRenderQueueIndexRangesRenderableManagersBySceneItem(*sceneItem, cameraPosition, 0.0f, 0.0f, renderQueueIndexRanges, executeOnRenderingSceneItems);
 					}
 					return;
 
@@ -615,55 +804,101 @@ namespace Renderer
 			}
 		}
 
-		// Calculate frustum using a camera relative world space to clip space matrix
-		const Frustum frustum(viewSpaceToClipSpaceMatrix * cameraSceneItem->getCameraRelativeWorldSpaceToViewSpaceMatrix());
-		const glm::vec3 worldSpaceCameraPositionFloat = cameraSceneItem->getWorldSpaceCameraPosition();
-		::detail::float4 worldSpaceCameraPositionFloat4[3] = { ::detail::float4(worldSpaceCameraPositionFloat.x), ::detail::float4(worldSpaceCameraPositionFloat.y), ::detail::float4(worldSpaceCameraPositionFloat.z) };
+		// Cull the cullable scene items, the indices of the visible ones are inside the indirection array afterwards
+		const uint32_t numberOfOobbVisible = cullCamera(renderer, *cameraSceneItem, viewSpaceToClipSpaceMatrix);
 
-		// Splat out the planes to be able to do plane-sphere test with SIMD
-		const ::detail::SimdPlane planes[6] =
+		// Scale for calculating the on-screen size in pixels of a bounding sphere: "<on-screen size> = <scale> * <radius> / <distance to camera>"
+		float screenSpaceScale = 0.0f;
 		{
-			// Left clipping plane
-			::detail::float4(frustum.planes[Frustum::PLANE_LEFT].normal.x),
-			::detail::float4(frustum.planes[Frustum::PLANE_LEFT].normal.y),
-			::detail::float4(frustum.planes[Frustum::PLANE_LEFT].normal.z),
-			::detail::float4(frustum.planes[Frustum::PLANE_LEFT].d),
+			uint32_t renderTargetWidth = 0;
+			uint32_t renderTargetHeight = 0;
+			renderTarget.getWidthAndHeight(renderTargetWidth, renderTargetHeight);
+			screenSpaceScale = viewSpaceToClipSpaceMatrix[1][1] * static_cast<float>(renderTargetHeight);
+		}
 
-			// Right clipping plane
-			::detail::float4(frustum.planes[Frustum::PLANE_RIGHT].normal.x),
-			::detail::float4(frustum.planes[Frustum::PLANE_RIGHT].normal.y),
-			::detail::float4(frustum.planes[Frustum::PLANE_RIGHT].normal.z),
-			::detail::float4(frustum.planes[Frustum::PLANE_RIGHT].d),
+		// Fill render queue index ranges with the visible stuff
+		const glm::dvec3& cameraPosition = cameraSceneItem->getParentSceneNodeSafe().getGlobalTransform().position;
+		for (uint32_t indirectionIndex = 0; indirectionIndex < numberOfOobbVisible; ++indirectionIndex)
+		{
+			const uint32_t index = mIndirection[indirectionIndex];
+			::detail::gatherRenderQueueIndexRangesRenderableManagersBySceneItem(*mCullableSceneItemSet->sceneItemVector[index], cameraPosition, -mCullableSceneItemSet->negativeRadius[index], screenSpaceScale, renderQueueIndexRanges, executeOnRenderingSceneItems);
+		}
 
-			// Top clipping plane
-			::detail::float4(frustum.planes[Frustum::PLANE_TOP].normal.x),
-			::detail::float4(frustum.planes[Frustum::PLANE_TOP].normal.y),
-			::detail::float4(frustum.planes[Frustum::PLANE_TOP].normal.z),
-			::detail::float4(frustum.planes[Frustum::PLANE_TOP].d),
+		// Fill render queue index ranges with the always-visible stuff
+		// -> There's no bounding sphere, consider always-visible stuff to cover the whole screen
+		for (ISceneItem* sceneItem : mUncullableSceneItems)
+		{
+			::detail::gatherRenderQueueIndexRangesRenderableManagersBySceneItem(*sceneItem, cameraPosition, std::numeric_limits<float>::max(), screenSpaceScale, renderQueueIndexRanges, executeOnRenderingSceneItems);
+		}
+	}
 
-			// Bottom clipping plane
-			::detail::float4(frustum.planes[Frustum::PLANE_BOTTOM].normal.x),
-			::detail::float4(frustum.planes[Frustum::PLANE_BOTTOM].normal.y),
-			::detail::float4(frustum.planes[Frustum::PLANE_BOTTOM].normal.z),
-			::detail::float4(frustum.planes[Frustum::PLANE_BOTTOM].d),
+	void SceneCullingManager::gatherVisibleSceneItems(const IRenderer& renderer, const CameraSceneItem& cameraSceneItem, float aspectRatio, SceneItems& visibleSceneItems)
+	{
+		// Cull the cullable scene items
+		const uint32_t numberOfOobbVisible = cullCamera(renderer, cameraSceneItem, cameraSceneItem.getViewSpaceToClipSpaceMatrix(aspectRatio));
 
-			// Near clipping plane
-			::detail::float4(frustum.planes[Frustum::PLANE_NEAR].normal.x),
-			::detail::float4(frustum.planes[Frustum::PLANE_NEAR].normal.y),
-			::detail::float4(frustum.planes[Frustum::PLANE_NEAR].normal.z),
-			::detail::float4(frustum.planes[Frustum::PLANE_NEAR].d),
+		// Gather the visible scene items, the always-visible stuff isn't included
+		visibleSceneItems.reserve(visibleSceneItems.size() + numberOfOobbVisible);
+		for (uint32_t indirectionIndex = 0; indirectionIndex < numberOfOobbVisible; ++indirectionIndex)
+		{
+			visibleSceneItems.push_back(mCullableSceneItemSet->sceneItemVector[mIndirection[indirectionIndex]]);
+		}
+	}
 
-			// Far clipping plane
-			::detail::float4(frustum.planes[Frustum::PLANE_FAR].normal.x),
-			::detail::float4(frustum.planes[Frustum::PLANE_FAR].normal.y),
-			::detail::float4(frustum.planes[Frustum::PLANE_FAR].normal.z),
-			::detail::float4(frustum.planes[Frustum::PLANE_FAR].d),
-		};
+	void SceneCullingManager::gatherShadowCasterRenderableManagers(const CameraSceneItem& cameraSceneItem, const glm::mat4& worldSpaceToClipSpaceMatrix, uint8_t minimumRenderQueueIndex, uint8_t maximumRenderQueueIndex, CompositorWorkspaceInstance::RenderableManagers& renderableManagers)
+	{
+		// Calculate the light space volume using a camera relative world space to clip space matrix
+		const Frustum frustum(worldSpaceToClipSpaceMatrix);
+		const glm::vec3 cullingOriginRelativeCameraPosition = getCullingOriginRelativeCameraPosition(cameraSceneItem);
+		::detail::float4 cullingOriginRelativeCameraPositionFloat4[3] = { ::detail::float4(cullingOriginRelativeCameraPosition.x), ::detail::float4(cullingOriginRelativeCameraPosition.y), ::detail::float4(cullingOriginRelativeCameraPosition.z) };
 
-		// Make sure to align the size to the SIMD lane count
-		const uint32_t n_aligned_objects = ::detail::alignToSimdLaneCount(mCullableSceneItemSet->numberOfSceneItems);
+		// Splat out the planes to be able to do plane-sphere test with SIMD
+		// -> The near clipping plane is replaced by a plane every sphere passes, this extrudes the volume toward the light
+		::detail::SimdPlane planes[Frustum::NUMBER_OF_PLANES];
+		for (int i = 0; i < Frustum::NUMBER_OF_PLANES; ++i)
+		{
+			if (Frustum::PLANE_NEAR == i)
+			{
+				planes[i] = { ::detail::FLOAT4_ALL_ZERO, ::detail::FLOAT4_ALL_ZERO, ::detail::FLOAT4_ALL_ZERO, ::detail::float4(std::numeric_limits<float>::max()) };
+			}
+			else
+			{
+				const Plane& plane = frustum.planes[i];
+				planes[i] = { ::detail::float4(plane.normal.x), ::detail::float4(plane.normal.y), ::detail::float4(plane.normal.z), ::detail::float4(plane.d) };
+			}
+		}
+
+		// Do SIMD multi-threaded volume-sphere culling
+		alignCullableSceneItemSetToSimdLaneCount();
+		const IRenderer& renderer = cameraSceneItem.getSceneResource().getRenderer();
+		::detail::simdSphereCullingMultiThreaded(renderer.getDefaultThreadPool(), renderer.getFrameAllocator(), cullingOriginRelativeCameraPositionFloat4, planes, *mCullableSceneItemSet);
+
+		// Gather the shadow casters which survived the volume-sphere culling
+		const glm::dvec3& cameraPosition = cameraSceneItem.getParentSceneNodeSafe().getGlobalTransform().position;
+		const uint32_t* visibilityFlag = mCullableSceneItemSet->visibilityFlag.data();
+		for (uint32_t i = 0; i < mCullableSceneItemSet->numberOfSceneItems; ++i)
+		{
+			if (visibilityFlag[i])
+			{
+				::detail::gatherShadowCasterRenderableManagerBySceneItem(*mCullableSceneItemSet->sceneItemVector[i], cameraPosition, minimumRenderQueueIndex, maximumRenderQueueIndex, renderableManagers);
+			}
+		}
+
+		// Add the always-visible shadow casters
+		for (ISceneItem* sceneItem : mUncullableSceneItems)
+		{
+			::detail::gatherShadowCasterRenderableManagerBySceneItem(*sceneItem, cameraPosition, minimumRenderQueueIndex, maximumRenderQueueIndex, renderableManagers);
+		}
+	}
 
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	void SceneCullingManager::alignCullableSceneItemSetToSimdLaneCount()
+	{
 		// TODO(co) We need to ensure that scene item set fits the SIMD lane count, this is only done at this place for the culling kickoff
+		const uint32_t n_aligned_objects = ::detail::alignToSimdLaneCount(mCullableSceneItemSet->numberOfSceneItems);
 		if (mCullableSceneItemSet->minimumX.size() != n_aligned_objects)
 		{
 			// Determine the needed vector size which takes alignment as well as prefetch ("xsimd::prefetch()" -> "_mm_prefetch()") into account
@@ -696,74 +931,115 @@ namespace Renderer
 			mCullableSceneItemSet->worldWY.resize(size);
 			mCullableSceneItemSet->worldWZ.resize(size);
 			mCullableSceneItemSet->worldWW.resize(size);
+			mCullableSceneItemSet->positionX.resize(size);
+			mCullableSceneItemSet->positionY.resize(size);
+			mCullableSceneItemSet->positionZ.resize(size);
 
 			// World space center position of bounding sphere
 			mCullableSceneItemSet->spherePositionX.resize(size);
 			mCullableSceneItemSet->spherePositionY.resize(size);
 			mCullableSceneItemSet->spherePositionZ.resize(size);
+			mCullableSceneItemSet->spherePosition64X.resize(size);
+			mCullableSceneItemSet->spherePosition64Y.resize(size);
+			mCullableSceneItemSet->spherePosition64Z.resize(size);
 
 			// Negative world space radius of bounding sphere
 			mCullableSceneItemSet->negativeRadius.resize(size);
 
 			mCullableSceneItemSet->visibilityFlag.resize(size);
+			mCullableSceneItemSet->occluderFlag.resize(size);
 			mCullableSceneItemSet->sceneItemVector.resize(size);
 		}
+	}
+
+	uint32_t SceneCullingManager::cullCamera(const IRenderer& renderer, const CameraSceneItem& cameraSceneItem, const glm::mat4& viewSpaceToClipSpaceMatrix)
+	{
+		// Calculate frustum using a camera relative world space to clip space matrix
+		// -> The scene item set positions are relative to the culling origin, the culling makes them camera relative by using the camera position relative to the culling origin
+		const glm::mat4 cameraRelativeWorldSpaceToClipSpaceMatrix = viewSpaceToClipSpaceMatrix * cameraSceneItem.getCameraRelativeWorldSpaceToViewSpaceMatrix();
+		const Frustum frustum(cameraRelativeWorldSpaceToClipSpaceMatrix);
+		const glm::vec3 cullingOriginRelativeCameraPosition = getCullingOriginRelativeCameraPosition(cameraSceneItem);
+		::detail::float4 cullingOriginRelativeCameraPositionFloat4[3] = { ::detail::float4(cullingOriginRelativeCameraPosition.x), ::detail::float4(cullingOriginRelativeCameraPosition.y), ::detail::float4(cullingOriginRelativeCameraPosition.z) };
+
+		// Splat out the planes to be able to do plane-sphere test with SIMD
+		const ::detail::SimdPlane planes[6] =
+		{
+			// Left clipping plane
+			::detail::float4(frustum.planes[Frustum::PLANE_LEFT].normal.x),
+			::detail::float4(frustum.planes[Frustum::PLANE_LEFT].normal.y),
+			::detail::float4(frustum.planes[Frustum::PLANE_LEFT].normal.z),
+			::detail::float4(frustum.planes[Frustum::PLANE_LEFT].d),
+
+			// Right clipping plane
+			::detail::float4(frustum.planes[Frustum::PLANE_RIGHT].normal.x),
+			::detail::float4(frustum.planes[Frustum::PLANE_RIGHT].normal.y),
+			::detail::float4(frustum.planes[Frustum::PLANE_RIGHT].normal.z),
+			::detail::float4(frustum.planes[Frustum::PLANE_RIGHT].d),
+
+			// Top clipping plane
+			::detail::float4(frustum.planes[Frustum::PLANE_TOP].normal.x),
+			::detail::float4(frustum.planes[Frustum::PLANE_TOP].normal.y),
+			::detail::float4(frustum.planes[Frustum::PLANE_TOP].normal.z),
+			::detail::float4(frustum.planes[Frustum::PLANE_TOP].d),
+
+			// Bottom clipping plane
+			::detail::float4(frustum.planes[Frustum::PLANE_BOTTOM].normal.x),
+			::detail::float4(frustum.planes[Frustum::PLANE_BOTTOM].normal.y),
+			::detail::float4(frustum.planes[Frustum::PLANE_BOTTOM].normal.z),
+			::detail::float4(frustum.planes[Frustum::PLANE_BOTTOM].d),
+
+			// Near clipping plane
+			::detail::float4(frustum.planes[Frustum::PLANE_NEAR].normal.x),
+			::detail::float4(frustum.planes[Frustum::PLANE_NEAR].normal.y),
+			::detail::float4(frustum.planes[Frustum::PLANE_NEAR].normal.z),
+			::detail::float4(frustum.planes[Frustum::PLANE_NEAR].d),
+
+			// Far clipping plane
+			::detail::float4(frustum.planes[Frustum::PLANE_FAR].normal.x),
+			::detail::float4(frustum.planes[Frustum::PLANE_FAR].normal.y),
+			::detail::float4(frustum.planes[Frustum::PLANE_FAR].normal.z),
+			::detail::float4(frustum.planes[Frustum::PLANE_FAR].d),
+		};
+
+		// Make sure to align the size to the SIMD lane count
+		const uint32_t n_aligned_objects = ::detail::alignToSimdLaneCount(mCullableSceneItemSet->numberOfSceneItems);
+
+		// Ensure that the scene item set fits the SIMD lane count
+		alignCullableSceneItemSetToSimdLaneCount();
 
 		// Get the thread pool instance
 		DefaultThreadPool& defaultThreadPool = renderer.getDefaultThreadPool();
+		FrameAllocator& frameAllocator = renderer.getFrameAllocator();
 
-		{ // Do SIMD multi-threaded frustum-sphere culling
-			size_t itemCount = mCullableSceneItemSet->numberOfSceneItems;
-			size_t splitCount = ::detail::SCENE_ITEMS_SPLIT_COUNT;	// Package size for each thread to work on (will change when maximum number of threads is reached)
-			const size_t threadCount = defaultThreadPool.getThreadCountAndSplitCount(itemCount, splitCount);
-			if (1 == threadCount)
-			{
-				// Just execute it directly inside the current thread, not worth the additional threading effort
-				::detail::simdSphereCulling(worldSpaceCameraPositionFloat4, planes, *mCullableSceneItemSet, 0, itemCount, mCullableSceneItemSet->visibilityFlag.data());
-			}
-			else
-			{
-				// Multi-threaded
-				size_t threadSceneItemIndexOffset = 0;
-				for (size_t threadIndex = 0; threadIndex < threadCount; ++threadIndex)
-				{
-					const size_t numberOfItemsToProcess = (threadIndex >= threadCount - 1) ? itemCount : splitCount;	// The last thread has to do all the rest of the remaining work
-					defaultThreadPool.queueTask(std::bind(::detail::simdSphereCulling, worldSpaceCameraPositionFloat4, planes, *mCullableSceneItemSet, threadSceneItemIndexOffset, threadSceneItemIndexOffset + numberOfItemsToProcess, mCullableSceneItemSet->visibilityFlag.data()));
-					itemCount -= splitCount;
-					threadSceneItemIndexOffset += splitCount;
-				}
-
-				// Wait that all worker threads have done their part of the calculation
-				defaultThreadPool.process();
-			}
-		}
+		// Do SIMD multi-threaded frustum-sphere culling
+		::detail::simdSphereCullingMultiThreaded(defaultThreadPool, frameAllocator, cullingOriginRelativeCameraPositionFloat4, planes, *mCullableSceneItemSet);
 
 		// Store the indices of the objects that passed the frustum-sphere culling in the `indirection` array
 		mIndirection.resize(n_aligned_objects);
 		const uint32_t numberOfVisibleItems = ::detail::removeNotVisible(*mCullableSceneItemSet, mCullableSceneItemSet->numberOfSceneItems, nullptr, mIndirection.data());
 
-		// Construct the SimdMatrix "simd_view_proj"
+		// Construct the SimdMatrix "simd_view_proj", the columns of the "glm::mat4" are the rows of the SIMD matrix transforming row vectors
 		const ::detail::SimdMatrix simd_view_proj =
 		{
-			::detail::float4(viewSpaceToClipSpaceMatrix[0][0]),
-			::detail::float4(viewSpaceToClipSpaceMatrix[0][1]),
-			::detail::float4(viewSpaceToClipSpaceMatrix[0][2]),
-			::detail::float4(viewSpaceToClipSpaceMatrix[0][3]),
-
-			::detail::float4(viewSpaceToClipSpaceMatrix[1][0]),
-			::detail::float4(viewSpaceToClipSpaceMatrix[1][1]),
-			::detail::float4(viewSpaceToClipSpaceMatrix[1][2]),
-			::detail::float4(viewSpaceToClipSpaceMatrix[1][3]),
-
-			::detail::float4(viewSpaceToClipSpaceMatrix[2][0]),
-			::detail::float4(viewSpaceToClipSpaceMatrix[2][1]),
-			::detail::float4(viewSpaceToClipSpaceMatrix[2][2]),
-			::detail::float4(viewSpaceToClipSpaceMatrix[2][3]),
-
-			::detail::float4(viewSpaceToClipSpaceMatrix[3][0]),
-			::detail::float4(viewSpaceToClipSpaceMatrix[3][1]),
-			::detail::float4(viewSpaceToClipSpaceMatrix[3][2]),
-			::detail::float4(viewSpaceToClipSpaceMatrix[3][3]),
+			::detail::float4(cameraRelativeWorldSpaceToClipSpaceMatrix[0][0]),
+			::detail::float4(cameraRelativeWorldSpaceToClipSpaceMatrix[0][1]),
+			::detail::float4(cameraRelativeWorldSpaceToClipSpaceMatrix[0][2]),
+			::detail::float4(cameraRelativeWorldSpaceToClipSpaceMatrix[0][3]),
+
+			::detail::float4(cameraRelativeWorldSpaceToClipSpaceMatrix[1][0]),
+			::detail::float4(cameraRelativeWorldSpaceToClipSpaceMatrix[1][1]),
+			::detail::float4(cameraRelativeWorldSpaceToClipSpaceMatrix[1][2]),
+			::detail::float4(cameraRelativeWorldSpaceToClipSpaceMatrix[1][3]),
+
+			::detail::float4(cameraRelativeWorldSpaceToClipSpaceMatrix[2][0]),
+			::detail::float4(cameraRelativeWorldSpaceToClipSpaceMatrix[2][1]),
+			::detail::float4(cameraRelativeWorldSpaceToClipSpaceMatrix[2][2]),
+			::detail::float4(cameraRelativeWorldSpaceToClipSpaceMatrix[2][3]),
+
+			::detail::float4(cameraRelativeWorldSpaceToClipSpaceMatrix[3][0]),
+			::detail::float4(cameraRelativeWorldSpaceToClipSpaceMatrix[3][1]),
+			::detail::float4(cameraRelativeWorldSpaceToClipSpaceMatrix[3][2]),
+			::detail::float4(cameraRelativeWorldSpaceToClipSpaceMatrix[3][3]),
 		};
 
 		{ // Do SIMD multi-threaded frustum-OOBB culling
@@ -773,16 +1049,23 @@ namespace Renderer
 			if (1 == threadCount)
 			{
 				// Just execute it directly inside the current thread, not worth the additional threading effort
-				::detail::simdOobbCulling(worldSpaceCameraPositionFloat4, simd_view_proj, *mCullableSceneItemSet, mIndirection.data(), 0, itemCount, mCullableSceneItemSet->visibilityFlag.data());
+				::detail::simdOobbCulling(cullingOriginRelativeCameraPositionFloat4, simd_view_proj, *mCullableSceneItemSet, mIndirection.data(), 0, itemCount, mCullableSceneItemSet->visibilityFlag.data());
 			}
 			else
 			{
 				// Multi-threaded
+				// -> Reserve all tasks upfront, the queued thread pool tasks point into the vector
+				FrameVector<::detail::OobbCullingTask> oobbCullingTasks{FrameStlAllocator<::detail::OobbCullingTask>(frameAllocator)};
+				oobbCullingTasks.reserve(threadCount);
 				size_t threadSceneItemIndexOffset = 0;
 				for (size_t threadIndex = 0; threadIndex < threadCount; ++threadIndex)
 				{
 					const size_t numberOfItemsToProcess = (threadIndex >= threadCount - 1) ? itemCount : splitCount;	// The last thread has to do all the rest of the remaining work
-					defaultThreadPool.queueTask(std::bind(::detail::simdOobbCulling, worldSpaceCameraPositionFloat4, simd_view_proj, *mCullableSceneItemSet, mIndirection.data(), threadSceneItemIndexOffset, threadSceneItemIndexOffset + numberOfItemsToProcess, mCullableSceneItemSet->visibilityFlag.data()));
+					const ::detail::OobbCullingTask* oobbCullingTask = &oobbCullingTasks.emplace_back(::detail::OobbCullingTask{ cullingOriginRelativeCameraPositionFloat4, &simd_view_proj, mCullableSceneItemSet, mIndirection.data(), threadSceneItemIndexOffset, threadSceneItemIndexOffset + numberOfItemsToProcess, mCullableSceneItemSet->visibilityFlag.data() });
+					defaultThreadPool.queueTask([oobbCullingTask]()
+						{
+							::detail::simdOobbCulling(oobbCullingTask->cullingOriginRelativeCameraPosition, *oobbCullingTask->cameraRelativeWorldSpaceToClipSpaceMatrix, *oobbCullingTask->sceneItemSet, oobbCullingTask->indirection, oobbCullingTask->threadSceneItemIndexStart, oobbCullingTask->threadSceneItemIndexEnd, oobbCullingTask->visibilityFlag);
+						});
 					itemCount -= splitCount;
 					threadSceneItemIndexOffset += splitCount;
 				}
@@ -793,20 +1076,48 @@ namespace Renderer
 		}
 
 		// Build up the indirection array that represents the objects that survived the frustum-OOBB culling
-		const uint32_t numberOfOobbVisible = ::detail::removeNotVisible(*mCullableSceneItemSet, numberOfVisibleItems, mIndirection.data(), mIndirection.data());
+		uint32_t numberOfOobbVisible = ::detail::removeNotVisible(*mCullableSceneItemSet, numberOfVisibleItems, mIndirection.data(), mIndirection.data());
 
-		// Fill render queue index ranges with the visible stuff
-		const glm::dvec3& cameraPosition = cameraSceneItem->getParentSceneNodeSafe().getGlobalTransform().position;
-		for (uint32_t indirectionIndex = 0; indirectionIndex < numberOfOobbVisible; ++indirectionIndex)
+		// Do multi-threaded software occlusion culling and remove the occluded objects from the indirection array
+		if (nullptr != mSoftwareOcclusionCuller)
 		{
-			::detail::gatherRenderQueueIndexRangesRenderableManagersBySceneItem(*mCullableSceneItemSet->sceneItemVector[mIndirection[indirectionIndex]], cameraPosition, renderQueueIndexRanges, executeOnRenderingSceneItems);
+			RENDERER_PROFILER_SCOPED_CPU_SAMPLE(renderer.getContext(), "Occlusion culling")
+			mSoftwareOcclusionCuller->cull(defaultThreadPool, frameAllocator, cameraRelativeWorldSpaceToClipSpaceMatrix, cullingOriginRelativeCameraPosition, *mCullableSceneItemSet, mIndirection.data(), numberOfOobbVisible);
+			numberOfOobbVisible = ::detail::removeNotVisible(*mCullableSceneItemSet, numberOfOobbVisible, mIndirection.data(), mIndirection.data());
 		}
 
-		// Fill render queue index ranges with the always-visible stuff
-		for (ISceneItem* sceneItem : mUncullableSceneItems)
+		{ // Calculate the view space depth range of the visible stuff by using the bounding spheres
+			const glm::mat4& worldSpaceToViewSpaceMatrix = cameraSceneItem.getCameraRelativeWorldSpaceToViewSpaceMatrix();
+			float minimumViewSpaceDepth = std::numeric_limits<float>::max();
+			float maximumViewSpaceDepth = std::numeric_limits<float>::lowest();
+			for (uint32_t indirectionIndex = 0; indirectionIndex < numberOfOobbVisible; ++indirectionIndex)
+			{
+				const uint32_t index = mIndirection[indirectionIndex];
+				const glm::vec3 spherePosition = glm::vec3(mCullableSceneItemSet->spherePositionX[index], mCullableSceneItemSet->spherePositionY[index], mCullableSceneItemSet->spherePositionZ[index]) - cullingOriginRelativeCameraPosition;
+				const float viewSpaceDepth = worldSpaceToViewSpaceMatrix[0][2] * spherePosition.x + worldSpaceToViewSpaceMatrix[1][2] * spherePosition.y + worldSpaceToViewSpaceMatrix[2][2] * spherePosition.z + worldSpaceToViewSpaceMatrix[3][2];
+				const float negativeRadius = mCullableSceneItemSet->negativeRadius[index];
+				minimumViewSpaceDepth = std::min(minimumViewSpaceDepth, viewSpaceDepth + negativeRadius);
+				maximumViewSpaceDepth = std::max(maximumViewSpaceDepth, viewSpaceDepth - negativeRadius);
+			}
+			mVisibleMinimumViewSpaceDepth = minimumViewSpaceDepth;
+			mVisibleMaximumViewSpaceDepth = maximumViewSpaceDepth;
+		}
+
+		// Done
+		return numberOfOobbVisible;
+	}
+
+	glm::vec3 SceneCullingManager::getCullingOriginRelativeCameraPosition(const CameraSceneItem& cameraSceneItem)
+	{
+		// Lazily move the culling origin to the camera as soon as the camera moved too far away from it
+		const glm::dvec3& worldSpaceCameraPosition = cameraSceneItem.getWorldSpaceCameraPosition();
+		glm::dvec3 cullingOriginRelativeCameraPosition = worldSpaceCameraPosition - mCullableSceneItemSet->origin;
+		if (glm::dot(cullingOriginRelativeCameraPosition, cullingOriginRelativeCameraPosition) > CULLING_ORIGIN_REBASE_DISTANCE * CULLING_ORIGIN_REBASE_DISTANCE)
 		{
-			::detail::gatherRenderQueueIndexRangesRenderableManagersBySceneItem(*sceneItem, cameraPosition, renderQueueIndexRanges, executeOnRenderingSceneItems);
+			setCullingOrigin(worldSpaceCameraPosition);
+			cullingOriginRelativeCameraPosition = Math::DVEC3_ZERO;
 		}
+		return glm::vec3(cullingOriginRelativeCameraPosition);
 	}
 
 
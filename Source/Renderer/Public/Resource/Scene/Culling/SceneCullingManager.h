@@ -30,6 +30,12 @@
 #include "Renderer/Public/Core/Manager.h"
 #include "Renderer/Public/Resource/CompositorWorkspace/CompositorWorkspaceInstance.h"
 
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4464)	// warning C4464: relative include path contains '..'
+	#include <glm/fwd.hpp>
+PRAGMA_WARNING_POP
+
 
 //[-------------------------------------------------------]
 //[ Forward declarations                                  ]
@@ -40,9 +46,12 @@ namespace Rhi
 }
 namespace Renderer
 {
+	class IRenderer;
 	class ISceneItem;
+	class CameraSceneItem;
 	struct SceneItemSet;
 	class CompositorContextData;
+	class SoftwareOcclusionCuller;
 }
 
 
@@ -72,6 +81,7 @@ namespace Renderer
 	//[-------------------------------------------------------]
 	public:
 		typedef std::vector<ISceneItem*> SceneItems;	// TODO(co) No raw-pointers (but no smart pointers either, use handles)
+		static constexpr double CULLING_ORIGIN_REBASE_DISTANCE = 1024.0;	///< As soon as the camera is farther away from the culling origin, the culling origin is moved to the camera, inside this distance 32 bit positions have sub-millimeter precision
 
 
 	//[-------------------------------------------------------]
@@ -82,6 +92,95 @@ namespace Renderer
 		~SceneCullingManager();
 		void gatherRenderQueueIndexRangesRenderableManagers(const Rhi::IRenderTarget& renderTarget, const CompositorContextData& compositorContextData, CompositorWorkspaceInstance::RenderQueueIndexRanges& renderQueueIndexRanges, std::vector<ISceneItem*>& executeOnRenderingSceneItems);
 
+		/**
+		*  @brief
+		*    Cull the cullable scene items against the view frustum of a camera and gather the visible ones
+		*
+		*  @param[in] renderer
+		*    Renderer instance providing the thread pool and the frame allocator
+		*  @param[in] cameraSceneItem
+		*    Camera scene item to use
+		*  @param[in] aspectRatio
+		*    Aspect ratio of the render target the camera renders into
+		*  @param[out] visibleSceneItems
+		*    Receives the visible cullable scene items in no particular order, the given list isn't cleared
+		*
+		*  @note
+		*    - Culling only without render queue gathering, e.g. for checking and benchmarking the culling
+		*    - Performs exactly the same culling as "Renderer::SceneCullingManager::gatherRenderQueueIndexRangesRenderableManagers()", including the optional software occlusion culling
+		*    - The uncullable scene items are always visible and hence not gathered
+		*/
+		RENDERER_API_EXPORT void gatherVisibleSceneItems(const IRenderer& renderer, const CameraSceneItem& cameraSceneItem, float aspectRatio, SceneItems& visibleSceneItems);
+
+		/**
+		*  @brief
+		*    Gather the shadow casting renderable managers inside a light space volume
+		*
+		*  @param[in] cameraSceneItem
+		*    Camera scene item the world space to clip space matrix is relative to
+		*  @param[in] worldSpaceToClipSpaceMatrix
+		*    Camera relative world space to light clip space matrix
+		*  @param[in] minimumRenderQueueIndex
+		*    Minimum render queue index (inclusive)
+		*  @param[in] maximumRenderQueueIndex
+		*    Maximum render queue index (inclusive)
+		*  @param[out] renderableManagers
+		*    Receives the shadow casting renderable managers, the given list isn't cleared
+		*
+		*  @note
+		*    - The near clipping plane is ignored, this extrudes the volume toward the light so shadow casters in front of the volume are kept
+		*    - Only a conservative bounding sphere test is performed
+		*    - Shares the cullable scene item set with "Renderer::SceneCullingManager::gatherRenderQueueIndexRangesRenderableManagers()", call it after the camera culling has been done
+		*/
+		void gatherShadowCasterRenderableManagers(const CameraSceneItem& cameraSceneItem, const glm::mat4& worldSpaceToClipSpaceMatrix, uint8_t minimumRenderQueueIndex, uint8_t maximumRenderQueueIndex, CompositorWorkspaceInstance::RenderableManagers& renderableManagers);
+
+		/**
+		*  @brief
+		*    Return the view space depth range of the scene items which survived the last camera culling
+		*
+		*  @param[out] minimumViewSpaceDepth
+		*    Receives the minimum view space depth
+		*  @param[out] maximumViewSpaceDepth
+		*    Receives the maximum view space depth
+		*
+		*  @return
+		*    "true" if there's a valid depth range, else "false" (e.g. nothing cullable was visible)
+		*
+		*  @note
+		*    - Basing on the bounding spheres, hence a conservative CPU replacement for a depth buffer reduction
+		*/
+		[[nodiscard]] inline bool getVisibleViewSpaceDepthRange(float& minimumViewSpaceDepth, float& maximumViewSpaceDepth) const
+		{
+			minimumViewSpaceDepth = mVisibleMinimumViewSpaceDepth;
+			maximumViewSpaceDepth = mVisibleMaximumViewSpaceDepth;
+			return (mVisibleMinimumViewSpaceDepth <= mVisibleMaximumViewSpaceDepth);
+		}
+
+		/**
+		*  @brief
+		*    Reserve memory for the given number of scene items
+		*
+		*  @param[in] numberOfSceneItems
+		*    Number of scene items to reserve memory for, in case it's unknown whether or not a scene item is cullable, use the total number of scene items
+		*
+		*  @note
+		*    - Used for bulk scene item creation so the cullable scene item set data is filled in one pass without reallocations
+		*/
+		void reserveSceneItems(uint32_t numberOfSceneItems);
+
+		/**
+		*  @brief
+		*    Set the 64 bit world space culling origin the 32 bit positions of the cullable scene item set are relative to
+		*
+		*  @param[in] origin
+		*    64 bit world space culling origin
+		*
+		*  @note
+		*    - Recalculates the 32 bit positions of all cullable scene items by using their 64 bit world space positions, so don't call it each frame
+		*    - The culling calls this automatically as soon as the camera is more than "Renderer::SceneCullingManager::CULLING_ORIGIN_REBASE_DISTANCE" away from the culling origin
+		*/
+		void setCullingOrigin(const glm::dvec3& origin);
+
 		[[nodiscard]] inline SceneItemSet& getCullableSceneItemSet() const
 		{
 			// We know that this pointer is always valid
@@ -94,6 +193,36 @@ namespace Renderer
 			return mUncullableSceneItems;
 		}
 
+		/**
+		*  @brief
+		*    Enable or disable the software occlusion culling of the camera culling
+		*
+		*  @param[in] enabled
+		*    "true" to cull the frustum visible scene items against the scene items flagged as occluder (see "Renderer::ISceneItem::setOccluder()"), else "false"
+		*
+		*  @note
+		*    - Disabled by default
+		*    - Has no influence on the shadow caster gathering
+		*/
+		RENDERER_API_EXPORT void setOcclusionCullingEnabled(bool enabled);
+
+		[[nodiscard]] inline bool isOcclusionCullingEnabled() const
+		{
+			return (nullptr != mSoftwareOcclusionCuller);
+		}
+
+		/**
+		*  @brief
+		*    Return the software occlusion culler
+		*
+		*  @return
+		*    The software occlusion culler, e.g. to query statistics of the last camera culling, can be a null pointer, don't destroy the instance
+		*/
+		[[nodiscard]] inline const SoftwareOcclusionCuller* getSoftwareOcclusionCuller() const
+		{
+			return mSoftwareOcclusionCuller;
+		}
+
 
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
@@ -101,16 +230,21 @@ namespace Renderer
 	private:
 		explicit SceneCullingManager(const SceneCullingManager&) = delete;
 		SceneCullingManager& operator=(const SceneCullingManager&) = delete;
+		void alignCullableSceneItemSetToSimdLaneCount();
+		[[nodiscard]] uint32_t cullCamera(const IRenderer& renderer, const CameraSceneItem& cameraSceneItem, const glm::mat4& viewSpaceToClipSpaceMatrix);	// Returns the number of visible scene items, their cullable scene item set indices are inside the indirection array
+		[[nodiscard]] glm::vec3 getCullingOriginRelativeCameraPosition(const CameraSceneItem& cameraSceneItem);
 
 
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
-		SceneItemSet*		  mCullableSceneItemSet;				///< Cullable scene item set, always valid, destroy the instance if you no longer need it
-		SceneItemSet*		  mCullableShadowCastersSceneItemSet;	///< Cullable shadow casters scene item set, always valid, destroy the instance if you no longer need it	TODO(co) Implement me
-		SceneItems			  mUncullableSceneItems;				///< Scene items which can't be culled and hence are always considered to be visible
-		std::vector<uint32_t> mIndirection;
+		SceneItemSet*			 mCullableSceneItemSet;					///< Cullable scene item set, always valid, destroy the instance if you no longer need it
+		SceneItems				 mUncullableSceneItems;					///< Scene items which can't be culled and hence are always considered to be visible
+		std::vector<uint32_t>	 mIndirection;
+		SoftwareOcclusionCuller* mSoftwareOcclusionCuller;		///< Software occlusion culler, can be a null pointer if occlusion culling is disabled, destroy the instance if you no longer need it
+		float					 mVisibleMinimumViewSpaceDepth;				///< Minimum view space depth of the scene items which survived the last camera culling, greater as the maximum if there's no valid depth range
+		float					 mVisibleMaximumViewSpaceDepth;				///< Maximum view space depth of the scene items which survived the last camera culling
 
 
 	};
@@ -47,6 +47,14 @@ PRAGMA_WARNING_PUSH
 	#include <xsimd/xsimd.hpp>
 PRAGMA_WARNING_POP
 
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4201)	// warning C4201: nonstandard extension used: nameless struct/union
+	PRAGMA_WARNING_DISABLE_MSVC(4464)	// warning C4464: relative include path contains '..'
+	PRAGMA_WARNING_DISABLE_MSVC(4324)	// warning C4324: '<x>': structure was padded due to alignment specifier
+	#include <glm/glm.hpp>
+PRAGMA_WARNING_POP
+
 #include <vector>
 
 
@@ -73,6 +81,11 @@ namespace Renderer
 	*  @brief
 	*    Scene item set
 	*
+	*  @remarks
+	*    The 32 bit positions are relative to a 64 bit world space culling origin, this way they keep their precision far away from the world space origin.
+	*    The scene culling manager moves the culling origin to the camera as soon as the camera moved too far away from it and then recalculates the 32 bit
+	*    positions by using the 64 bit world space positions which are stored beside them (see "Renderer::SceneCullingManager::setCullingOrigin()").
+	*
 	*  @note
 	*    - Basing on "The Implementation of Frustum Culling in Stingray" - http://bitsquid.blogspot.de/2016/10/the-implementation-of-frustum-culling.html
 	*/
@@ -89,9 +102,54 @@ namespace Renderer
 		typedef std::vector<ISceneItem*, xsimd::aligned_allocator<ISceneItem*, XSIMD_DEFAULT_ALIGNMENT>> SceneItemVector;	// TODO(co) No raw pointers here (no smart pointers either, handles please)
 
 
+		//[-------------------------------------------------------]
+		//[ Public methods                                        ]
+		//[-------------------------------------------------------]
+		/**
+		*  @brief
+		*    Set the 64 bit world space position of the object space to world space matrix
+		*
+		*  @param[in] index
+		*    Scene item index
+		*  @param[in] position
+		*    64 bit world space position
+		*/
+		inline void setWorldSpacePosition(uint32_t index, const glm::dvec3& position)
+		{
+			positionX[index] = position.x;
+			positionY[index] = position.y;
+			positionZ[index] = position.z;
+			worldXW[index] = static_cast<float>(position.x - origin.x);
+			worldYW[index] = static_cast<float>(position.y - origin.y);
+			worldZW[index] = static_cast<float>(position.z - origin.z);
+		}
+
+		/**
+		*  @brief
+		*    Set the 64 bit world space center position of the bounding sphere
+		*
+		*  @param[in] index
+		*    Scene item index
+		*  @param[in] position
+		*    64 bit world space center position of the bounding sphere
+		*/
+		inline void setWorldSpaceSpherePosition(uint32_t index, const glm::dvec3& position)
+		{
+			spherePosition64X[index] = position.x;
+			spherePosition64Y[index] = position.y;
+			spherePosition64Z[index] = position.z;
+			spherePositionX[index] = static_cast<float>(position.x - origin.x);
+			spherePositionY[index] = static_cast<float>(position.y - origin.y);
+			spherePositionZ[index] = static_cast<float>(position.z - origin.z);
+		}
+
+
 		//[-------------------------------------------------------]
 		//[ Public data                                           ]
 		//[-------------------------------------------------------]
+		// 64 bit world space culling origin all 32 bit positions are relative to
+		glm::dvec3 origin = glm::dvec3(0.0);
+
 		// Minimum object space bounding box corner position
 		FloatVector minimumX;
 		FloatVector minimumY;
@@ -102,8 +160,7 @@ namespace Renderer
 		FloatVector maximumY;
 		FloatVector maximumZ;
 
-		// Object space to world space matrix
-		// TODO(co) Add 64 bit world space position support
+		// Object space to world space matrix, the position is relative to the culling origin
 		FloatVector worldXX;
 		FloatVector worldXY;
 		FloatVector worldXZ;
@@ -121,18 +178,30 @@ namespace Renderer
 		FloatVector worldWZ;
 		FloatVector worldWW;
 
-		// 32 bit world space position center of bounding sphere (the bounding sphere isn't always at the object center, so we need to store this beside the transform position)
-		// TODO(co) Add 64 bit world space position support
+		// 64 bit world space position of the object space to world space matrix, only used for moving the culling origin
+		DoubleVector positionX;
+		DoubleVector positionY;
+		DoubleVector positionZ;
+
+		// 32 bit center position of bounding sphere relative to the culling origin (the bounding sphere isn't always at the object center, so we need to store this beside the transform position)
 		FloatVector spherePositionX;
 		FloatVector spherePositionY;
 		FloatVector spherePositionZ;
 
+		// 64 bit world space center position of bounding sphere, only used for moving the culling origin
+		DoubleVector spherePosition64X;
+		DoubleVector spherePosition64Y;
+		DoubleVector spherePosition64Z;
+
 		// Negative world space radius of bounding sphere, the bounding sphere radius is enclosing the bounding box (don't use the inner bounding box radius)
 		FloatVector negativeRadius;
 
 		// Flag to indicate if an object is culled or not
 		IntegerVector visibilityFlag;
 
+		// Flag to indicate if an object is an occluder for the software occlusion culling
+		IntegerVector occluderFlag;
+
 		// The type and ID of an object
 		SceneItemVector sceneItemVector;
 
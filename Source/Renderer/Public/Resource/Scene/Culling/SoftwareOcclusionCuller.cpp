@@ -0,0 +1,503 @@
+/*********************************************************\
+ * Copyright (c) 2012-2020 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Renderer/Public/Resource/Scene/Culling/SoftwareOcclusionCuller.h"
+#include "Renderer/Public/Core/Thread/ThreadPool.h"
+#include "Renderer/Public/Core/Memory/FrameAllocator.h"
+#include "Renderer/Public/Core/Time/Stopwatch.h"
+#include "Renderer/Public/Core/Math/Math.h"
+
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4668)	// warning C4668: '_M_HYBRID_X86_ARM64' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
+	#include <limits>
+	#include <algorithm>	// For "std::min()", "std::max()", "std::fill()"
+PRAGMA_WARNING_POP
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Global definitions                                    ]
+		//[-------------------------------------------------------]
+		static constexpr size_t OCCLUSION_ROWS_SPLIT_COUNT		  = 16;		///< Number of depth buffer rows for each thread to rasterize	TODO(co) This value needs to be fine-tuned
+		static constexpr size_t OCCLUSION_SCENE_ITEMS_SPLIT_COUNT = 256;	///< Package size for each thread to test	TODO(co) This value needs to be fine-tuned
+		static constexpr int	OCCLUSION_MAXIMUM_TEST_TEXELS	  = 4;		///< Maximum number of tested hierarchical depth buffer texels per axis
+		static constexpr float	OCCLUSION_MINIMUM_W				  = 1e-6f;	///< Minimum clip space w, everything below is considered to be crossing the camera plane
+		typedef xsimd::batch_bool<float, 4> bool4;
+		typedef xsimd::simd_type<float> float4;
+
+
+		//[-------------------------------------------------------]
+		//[ Global functions                                      ]
+		//[-------------------------------------------------------]
+		[[nodiscard]] glm::mat4 getCameraRelativeObjectSpaceToWorldSpaceMatrix(const Renderer::SceneItemSet& sceneItemSet, uint32_t index, const glm::vec3& cullingOriginRelativeCameraPosition)
+		{
+			// The scene item set stores the rows of the matrix, "glm::mat4" is column-major
+			return glm::mat4(sceneItemSet.worldXX[index], sceneItemSet.worldYX[index], sceneItemSet.worldZX[index], sceneItemSet.worldWX[index],
+							 sceneItemSet.worldXY[index], sceneItemSet.worldYY[index], sceneItemSet.worldZY[index], sceneItemSet.worldWY[index],
+							 sceneItemSet.worldXZ[index], sceneItemSet.worldYZ[index], sceneItemSet.worldZZ[index], sceneItemSet.worldWZ[index],
+							 sceneItemSet.worldXW[index] - cullingOriginRelativeCameraPosition.x, sceneItemSet.worldYW[index] - cullingOriginRelativeCameraPosition.y, sceneItemSet.worldZW[index] - cullingOriginRelativeCameraPosition.z, sceneItemSet.worldWW[index]);
+		}
+
+		[[nodiscard]] glm::vec4 getBoundingBoxCorner(const Renderer::SceneItemSet& sceneItemSet, uint32_t index, uint32_t cornerIndex)
+		{
+			// Bit 0 selects the x, bit 1 the y and bit 2 the z component of the maximum corner
+			return glm::vec4((cornerIndex & 1) ? sceneItemSet.maximumX[index] : sceneItemSet.minimumX[index],
+							 (cornerIndex & 2) ? sceneItemSet.maximumY[index] : sceneItemSet.minimumY[index],
+							 (cornerIndex & 4) ? sceneItemSet.maximumZ[index] : sceneItemSet.minimumZ[index],
+							 1.0f);
+		}
+
+		[[nodiscard]] glm::vec3 clipSpaceToOcclusionScreenSpace(const glm::vec4& clipSpacePosition, float width, float height)
+		{
+			const float inverseW = 1.0f / clipSpacePosition.w;
+			return glm::vec3((clipSpacePosition.x * inverseW * 0.5f + 0.5f) * width, (clipSpacePosition.y * inverseW * 0.5f + 0.5f) * height, clipSpacePosition.z * inverseW);
+		}
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	SoftwareOcclusionCuller::SoftwareOcclusionCuller(uint32_t width, uint32_t height) :
+		mWidth(Math::makeMultipleOf(std::max(width, 1u), static_cast<uint32_t>(xsimd::simd_type<float>::size))),
+		mHeight(std::max(height, 1u)),
+		mNumberOfOccludedSceneItems(0),
+		mStatistics{}
+	{
+		// Depth buffer, cleared to the far plane
+		mDepthBuffer.resize(mWidth * mHeight, 1.0f);
+
+		// Hierarchical depth buffer levels, the first level is the depth buffer itself
+		uint32_t levelWidth = mWidth;
+		uint32_t levelHeight = mHeight;
+		uint32_t offset = 0;
+		mHierarchicalDepthLevels.push_back({ 0, levelWidth, levelHeight });
+		while (levelWidth > 1 || levelHeight > 1)
+		{
+			levelWidth = (levelWidth + 1) / 2;
+			levelHeight = (levelHeight + 1) / 2;
+			mHierarchicalDepthLevels.push_back({ offset, levelWidth, levelHeight });
+			offset += levelWidth * levelHeight;
+		}
+		mHierarchicalDepthBuffer.resize(offset, 1.0f);
+	}
+
+	void SoftwareOcclusionCuller::cull(DefaultThreadPool& defaultThreadPool, FrameAllocator& frameAllocator, const glm::mat4& cameraRelativeWorldSpaceToClipSpaceMatrix, const glm::vec3& cullingOriginRelativeCameraPosition, SceneItemSet& sceneItemSet, const uint32_t* indirection, uint32_t numberOfSceneItems)
+	{
+		mStatistics = {};
+		mTriangles.clear();
+		Stopwatch stopwatch(true);
+
+		{ // Gather the occluder triangles
+			const uint32_t* occluderFlag = sceneItemSet.occluderFlag.data();
+			for (uint32_t indirectionIndex = 0; indirectionIndex < numberOfSceneItems; ++indirectionIndex)
+			{
+				const uint32_t index = indirection[indirectionIndex];
+				if (occluderFlag[index])
+				{
+					addOccluder(cameraRelativeWorldSpaceToClipSpaceMatrix, cullingOriginRelativeCameraPosition, sceneItemSet, index);
+					++mStatistics.numberOfOccluders;
+				}
+			}
+			mStatistics.numberOfOccluderTriangles = static_cast<uint32_t>(mTriangles.size());
+		}
+
+		// Nothing to do if there's nothing which could occlude something
+		if (mTriangles.empty())
+		{
+			mStatistics.rasterizationMilliseconds = stopwatch.getMilliseconds();
+			return;
+		}
+
+		// Clear the depth buffer to the far plane
+		std::fill(mDepthBuffer.begin(), mDepthBuffer.end(), 1.0f);
+
+		{ // Rasterize the occluder triangles, each thread is working on its own band of depth buffer rows
+			size_t itemCount = mHeight;
+			size_t splitCount = ::detail::OCCLUSION_ROWS_SPLIT_COUNT;	// Package size for each thread to work on (will change when maximum number of threads is reached)
+			const size_t threadCount = defaultThreadPool.getThreadCountAndSplitCount(itemCount, splitCount);
+			if (1 == threadCount)
+			{
+				// Just execute it directly inside the current thread, not worth the additional threading effort
+				rasterizeBand(0, mHeight);
+			}
+			else
+			{
+				// Multi-threaded
+				// -> Reserve all tasks upfront, the queued thread pool tasks point into the vector
+				FrameVector<Task> tasks{FrameStlAllocator<Task>(frameAllocator)};
+				tasks.reserve(threadCount);
+				size_t threadRowOffset = 0;
+				for (size_t threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+				{
+					const size_t numberOfRowsToProcess = (threadIndex >= threadCount - 1) ? itemCount : splitCount;	// The last thread has to do all the rest of the remaining work
+					const Task* task = &tasks.emplace_back(Task{ this, nullptr, nullptr, nullptr, nullptr, static_cast<uint32_t>(threadRowOffset), static_cast<uint32_t>(threadRowOffset + numberOfRowsToProcess) });
+					defaultThreadPool.queueTask([task]()
+						{
+							task->softwareOcclusionCuller->rasterizeBand(task->startIndex, task->endIndex);
+						});
+					itemCount -= splitCount;
+					threadRowOffset += splitCount;
+				}
+
+				// Wait that all worker threads have done their part of the calculation
+				defaultThreadPool.process();
+			}
+		}
+		buildHierarchicalDepthBuffer();
+		mStatistics.rasterizationMilliseconds = stopwatch.getMilliseconds();
+
+		{ // Test the scene items against the hierarchical depth buffer
+			stopwatch.start();
+			mNumberOfOccludedSceneItems = 0;
+			size_t itemCount = numberOfSceneItems;
+			size_t splitCount = ::detail::OCCLUSION_SCENE_ITEMS_SPLIT_COUNT;	// Package size for each thread to work on (will change when maximum number of threads is reached)
+			const size_t threadCount = defaultThreadPool.getThreadCountAndSplitCount(itemCount, splitCount);
+			if (1 == threadCount)
+			{
+				// Just execute it directly inside the current thread, not worth the additional threading effort
+				testSceneItems(cameraRelativeWorldSpaceToClipSpaceMatrix, cullingOriginRelativeCameraPosition, sceneItemSet, indirection, 0, numberOfSceneItems);
+			}
+			else
+			{
+				// Multi-threaded
+				// -> Reserve all tasks upfront, the queued thread pool tasks point into the vector
+				FrameVector<Task> tasks{FrameStlAllocator<Task>(frameAllocator)};
+				tasks.reserve(threadCount);
+				size_t threadSceneItemIndexOffset = 0;
+				for (size_t threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+				{
+					const size_t numberOfItemsToProcess = (threadIndex >= threadCount - 1) ? itemCount : splitCount;	// The last thread has to do all the rest of the remaining work
+					const Task* task = &tasks.emplace_back(Task{ this, &cameraRelativeWorldSpaceToClipSpaceMatrix, &cullingOriginRelativeCameraPosition, &sceneItemSet, indirection, static_cast<uint32_t>(threadSceneItemIndexOffset), static_cast<uint32_t>(threadSceneItemIndexOffset + numberOfItemsToProcess) });
+					defaultThreadPool.queueTask([task]()
+						{
+							task->softwareOcclusionCuller->testSceneItems(*task->cameraRelativeWorldSpaceToClipSpaceMatrix, *task->cullingOriginRelativeCameraPosition, *task->sceneItemSet, task->indirection, task->startIndex, task->endIndex);
+						});
+					itemCount -= splitCount;
+					threadSceneItemIndexOffset += splitCount;
+				}
+
+				// Wait that all worker threads have done their part of the calculation
+				defaultThreadPool.process();
+			}
+			mStatistics.numberOfTestedSceneItems = numberOfSceneItems - mStatistics.numberOfOccluders;
+			mStatistics.numberOfOccludedSceneItems = mNumberOfOccludedSceneItems;
+			mStatistics.testMilliseconds = stopwatch.getMilliseconds();
+		}
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	void SoftwareOcclusionCuller::addOccluder(const glm::mat4& cameraRelativeWorldSpaceToClipSpaceMatrix, const glm::vec3& cullingOriginRelativeCameraPosition, const SceneItemSet& sceneItemSet, uint32_t index)
+	{
+		const glm::mat4 objectSpaceToWorldSpaceMatrix = ::detail::getCameraRelativeObjectSpaceToWorldSpaceMatrix(sceneItemSet, index, cullingOriginRelativeCameraPosition);
+		const glm::mat4 objectSpaceToClipSpaceMatrix = cameraRelativeWorldSpaceToClipSpaceMatrix * objectSpaceToWorldSpaceMatrix;
+
+		// Transform the bounding box corners into clip space
+		glm::vec4 clipSpaceCorners[8];
+		for (uint32_t cornerIndex = 0; cornerIndex < 8; ++cornerIndex)
+		{
+			clipSpaceCorners[cornerIndex] = objectSpaceToClipSpaceMatrix * ::detail::getBoundingBoxCorner(sceneItemSet, index, cornerIndex);
+		}
+
+		// Only the sides facing the camera are rasterized, they cover the projected bounding box and are nearer than the backsides
+		// -> The facing is decided in object space, this way mirroring transforms are handled as well
+		// -> If the camera is inside the bounding box no side is facing the camera, in this case the scene item can't occlude anything
+		const glm::vec4 objectSpaceCameraPosition = glm::inverse(objectSpaceToWorldSpaceMatrix) * glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);
+		const glm::vec3 minimum(sceneItemSet.minimumX[index], sceneItemSet.minimumY[index], sceneItemSet.minimumZ[index]);
+		const glm::vec3 maximum(sceneItemSet.maximumX[index], sceneItemSet.maximumY[index], sceneItemSet.maximumZ[index]);
+		for (uint32_t axis = 0; axis < 3; ++axis)
+		{
+			for (uint32_t side = 0; side < 2; ++side)
+			{
+				if (side ? (objectSpaceCameraPosition[axis] > maximum[axis]) : (objectSpaceCameraPosition[axis] < minimum[axis]))
+				{
+					const uint32_t firstAxisBit = 1u << ((axis + 1) % 3);
+					const uint32_t secondAxisBit = 1u << ((axis + 2) % 3);
+					const uint32_t sideBit = side << axis;
+					const glm::vec4 clipSpacePositions[4] =
+					{
+						clipSpaceCorners[sideBit],
+						clipSpaceCorners[sideBit | firstAxisBit],
+						clipSpaceCorners[sideBit | firstAxisBit | secondAxisBit],
+						clipSpaceCorners[sideBit | secondAxisBit]
+					};
+					addClippedPolygon(clipSpacePositions, 4);
+				}
+			}
+		}
+	}
+
+	void SoftwareOcclusionCuller::addClippedPolygon(const glm::vec4* clipSpacePositions, uint32_t numberOfClipSpacePositions)
+	{
+		// Clip the convex polygon against the near plane, the clip space depth is zero at the near plane
+		glm::vec4 clippedClipSpacePositions[8];
+		uint32_t numberOfClippedClipSpacePositions = 0;
+		for (uint32_t i = 0; i < numberOfClipSpacePositions; ++i)
+		{
+			const glm::vec4& current = clipSpacePositions[i];
+			const glm::vec4& next = clipSpacePositions[(i + 1) % numberOfClipSpacePositions];
+			const bool currentInside = (current.z >= 0.0f);
+			const bool nextInside = (next.z >= 0.0f);
+			if (currentInside)
+			{
+				clippedClipSpacePositions[numberOfClippedClipSpacePositions] = current;
+				++numberOfClippedClipSpacePositions;
+			}
+			if (currentInside != nextInside)
+			{
+				clippedClipSpacePositions[numberOfClippedClipSpacePositions] = current + (next - current) * (current.z / (current.z - next.z));
+				++numberOfClippedClipSpacePositions;
+			}
+		}
+		if (numberOfClippedClipSpacePositions < 3)
+		{
+			// Completely in front of the near plane
+			return;
+		}
+
+		// Project into screen space
+		const float width = static_cast<float>(mWidth);
+		const float height = static_cast<float>(mHeight);
+		glm::vec3 screenSpacePositions[8];
+		for (uint32_t i = 0; i < numberOfClippedClipSpacePositions; ++i)
+		{
+			if (clippedClipSpacePositions[i].w <= ::detail::OCCLUSION_MINIMUM_W)
+			{
+				// Can only happen with exotic projection matrices, leaving out parts of an occluder is always safe
+				return;
+			}
+			screenSpacePositions[i] = ::detail::clipSpaceToOcclusionScreenSpace(clippedClipSpacePositions[i], width, height);
+		}
+
+		// Triangle fan
+		for (uint32_t i = 1; i + 1 < numberOfClippedClipSpacePositions; ++i)
+		{
+			mTriangles.push_back({ { screenSpacePositions[0], screenSpacePositions[i], screenSpacePositions[i + 1] } });
+		}
+	}
+
+	void SoftwareOcclusionCuller::rasterizeBand(uint32_t startRow, uint32_t endRow)
+	{
+		const ::detail::float4 FLOAT4_ZERO(0.0f);
+		const ::detail::float4 laneOffsets(0.5f, 1.5f, 2.5f, 3.5f);	// Pixel centers
+		constexpr uint32_t simdSize = static_cast<uint32_t>(xsimd::simd_type<float>::size);
+		for (const Triangle& triangle : mTriangles)
+		{
+			// Ensure a counter-clockwise winding, so the edge functions are positive inside the triangle
+			const glm::vec3& v0 = triangle.vertices[0];
+			glm::vec3 v1 = triangle.vertices[1];
+			glm::vec3 v2 = triangle.vertices[2];
+			float area = (v1.x - v0.x) * (v2.y - v0.y) - (v1.y - v0.y) * (v2.x - v0.x);
+			if (0.0f == area)
+			{
+				// Degenerated triangle
+				continue;
+			}
+			if (area < 0.0f)
+			{
+				std::swap(v1, v2);
+				area = -area;
+			}
+
+			// Get the bounding rectangle clamped to the band, the horizontal start is aligned to the SIMD lane count
+			const float minimumX = std::max(std::min(std::min(v0.x, v1.x), v2.x), 0.0f);
+			const float maximumX = std::min(std::max(std::max(v0.x, v1.x), v2.x), static_cast<float>(mWidth));
+			const float minimumY = std::max(std::min(std::min(v0.y, v1.y), v2.y), static_cast<float>(startRow));
+			const float maximumY = std::min(std::max(std::max(v0.y, v1.y), v2.y), static_cast<float>(endRow));
+			if (minimumX >= maximumX || minimumY >= maximumY)
+			{
+				// Outside of the band
+				continue;
+			}
+			const uint32_t startX = static_cast<uint32_t>(minimumX) & ~(simdSize - 1);
+			const uint32_t endX = std::min(static_cast<uint32_t>(std::ceil(maximumX)), mWidth);
+			const uint32_t startY = static_cast<uint32_t>(minimumY);
+			const uint32_t endY = std::min(static_cast<uint32_t>(std::ceil(maximumY)), endRow);
+
+			// Edge functions "<edge>(x, y) = a * x + b * y + c", edge n is opposite to vertex n
+			const float a0 = v1.y - v2.y, b0 = v2.x - v1.x, c0 = (v2.y - v1.y) * v1.x - (v2.x - v1.x) * v1.y;
+			const float a1 = v2.y - v0.y, b1 = v0.x - v2.x, c1 = (v0.y - v2.y) * v2.x - (v0.x - v2.x) * v2.y;
+			const float a2 = v0.y - v1.y, b2 = v1.x - v0.x, c2 = (v1.y - v0.y) * v0.x - (v1.x - v0.x) * v0.y;
+
+			// Depth plane "depth(x, y) = a * x + b * y + c" using the barycentric coordinates
+			const float inverseArea = 1.0f / area;
+			const float depthA = (a0 * v0.z + a1 * v1.z + a2 * v2.z) * inverseArea;
+			const float depthB = (b0 * v0.z + b1 * v1.z + b2 * v2.z) * inverseArea;
+			const float depthC = (c0 * v0.z + c1 * v1.z + c2 * v2.z) * inverseArea;
+
+			// Rasterize the rows, SIMD lane count pixels at once
+			const ::detail::float4 edgeA0(a0), edgeA1(a1), edgeA2(a2), depthAFloat4(depthA);
+			for (uint32_t y = startY; y < endY; ++y)
+			{
+				const float pixelCenterY = static_cast<float>(y) + 0.5f;
+				const ::detail::float4 edgeRow0(b0 * pixelCenterY + c0);
+				const ::detail::float4 edgeRow1(b1 * pixelCenterY + c1);
+				const ::detail::float4 edgeRow2(b2 * pixelCenterY + c2);
+				const ::detail::float4 depthRow(depthB * pixelCenterY + depthC);
+				float* RESTRICT depthBuffer = mDepthBuffer.data() + y * mWidth;
+				for (uint32_t x = startX; x < endX; x += simdSize)
+				{
+					const ::detail::float4 pixelCenterX = ::detail::float4(static_cast<float>(x)) + laneOffsets;
+					const ::detail::bool4 inside = (edgeA0 * pixelCenterX + edgeRow0 >= FLOAT4_ZERO) & (edgeA1 * pixelCenterX + edgeRow1 >= FLOAT4_ZERO) & (edgeA2 * pixelCenterX + edgeRow2 >= FLOAT4_ZERO);
+					if (xsimd::any(inside))
+					{
+						const ::detail::float4 depth = xsimd::load_aligned(&depthBuffer[x]);
+						xsimd::store_aligned(&depthBuffer[x], xsimd::select(inside, xsimd::min(depth, depthAFloat4 * pixelCenterX + depthRow), depth));
+					}
+				}
+			}
+		}
+	}
+
+	void SoftwareOcclusionCuller::buildHierarchicalDepthBuffer()
+	{
+		// Each texel stores the farthest depth of the up to 2x2 texels of the previous level
+		const float* sourceData = mDepthBuffer.data();
+		for (size_t levelIndex = 1; levelIndex < mHierarchicalDepthLevels.size(); ++levelIndex)
+		{
+			const HierarchicalDepthLevel& sourceLevel = mHierarchicalDepthLevels[levelIndex - 1];
+			const HierarchicalDepthLevel& destinationLevel = mHierarchicalDepthLevels[levelIndex];
+			float* destinationData = mHierarchicalDepthBuffer.data() + destinationLevel.offset;
+			for (uint32_t y = 0; y < destinationLevel.height; ++y)
+			{
+				const float* sourceRow0 = sourceData + (y * 2) * sourceLevel.width;
+				const float* sourceRow1 = sourceData + std::min(y * 2 + 1, sourceLevel.height - 1) * sourceLevel.width;
+				for (uint32_t x = 0; x < destinationLevel.width; ++x)
+				{
+					const uint32_t sourceX0 = x * 2;
+					const uint32_t sourceX1 = std::min(sourceX0 + 1, sourceLevel.width - 1);
+					destinationData[y * destinationLevel.width + x] = std::max(std::max(sourceRow0[sourceX0], sourceRow0[sourceX1]), std::max(sourceRow1[sourceX0], sourceRow1[sourceX1]));
+				}
+			}
+			sourceData = destinationData;
+		}
+	}
+
+	void SoftwareOcclusionCuller::testSceneItems(const glm::mat4& cameraRelativeWorldSpaceToClipSpaceMatrix, const glm::vec3& cullingOriginRelativeCameraPosition, SceneItemSet& sceneItemSet, const uint32_t* indirection, uint32_t startIndex, uint32_t endIndex)
+	{
+		const float width = static_cast<float>(mWidth);
+		const float height = static_cast<float>(mHeight);
+		const uint32_t* occluderFlag = sceneItemSet.occluderFlag.data();
+		uint32_t* visibilityFlag = sceneItemSet.visibilityFlag.data();
+		uint32_t numberOfOccludedSceneItems = 0;
+		for (uint32_t indirectionIndex = startIndex; indirectionIndex < endIndex; ++indirectionIndex)
+		{
+			// Occluders are never considered to be occluded, avoids self-occlusion due to limited precision
+			const uint32_t index = indirection[indirectionIndex];
+			if (occluderFlag[index])
+			{
+				continue;
+			}
+
+			// Get the screen space bounding rectangle and the nearest depth of the bounding box
+			const glm::mat4 objectSpaceToClipSpaceMatrix = cameraRelativeWorldSpaceToClipSpaceMatrix * ::detail::getCameraRelativeObjectSpaceToWorldSpaceMatrix(sceneItemSet, index, cullingOriginRelativeCameraPosition);
+			glm::vec3 minimum(std::numeric_limits<float>::max());
+			glm::vec3 maximum(std::numeric_limits<float>::lowest());
+			bool crossesNearPlane = false;
+			for (uint32_t cornerIndex = 0; cornerIndex < 8; ++cornerIndex)
+			{
+				const glm::vec4 clipSpacePosition = objectSpaceToClipSpaceMatrix * ::detail::getBoundingBoxCorner(sceneItemSet, index, cornerIndex);
+				if (clipSpacePosition.z < 0.0f || clipSpacePosition.w <= ::detail::OCCLUSION_MINIMUM_W)
+				{
+					crossesNearPlane = true;
+					break;
+				}
+				const glm::vec3 screenSpacePosition = ::detail::clipSpaceToOcclusionScreenSpace(clipSpacePosition, width, height);
+				minimum = glm::min(minimum, screenSpacePosition);
+				maximum = glm::max(maximum, screenSpacePosition);
+			}
+			if (crossesNearPlane || maximum.x < 0.0f || maximum.y < 0.0f || minimum.x >= width || minimum.y >= height)
+			{
+				// Scene items crossing the near plane or outside the depth buffer are considered to be visible
+				continue;
+			}
+
+			// Test the covered pixels
+			const int minimumX = static_cast<int>(std::max(minimum.x, 0.0f));
+			const int minimumY = static_cast<int>(std::max(minimum.y, 0.0f));
+			const int maximumX = static_cast<int>(std::min(maximum.x, width - 1.0f));
+			const int maximumY = static_cast<int>(std::min(maximum.y, height - 1.0f));
+			if (isRectangleOccluded(minimumX, minimumY, maximumX, maximumY, minimum.z))
+			{
+				visibilityFlag[index] = 0;
+				++numberOfOccludedSceneItems;
+			}
+		}
+		mNumberOfOccludedSceneItems += numberOfOccludedSceneItems;
+	}
+
+	bool SoftwareOcclusionCuller::isRectangleOccluded(int minimumX, int minimumY, int maximumX, int maximumY, float nearestDepth) const
+	{
+		// Choose the finest hierarchical depth buffer level at which the rectangle covers only a few texels
+		uint32_t levelIndex = 0;
+		while (levelIndex + 1 < mHierarchicalDepthLevels.size() && ((maximumX >> levelIndex) - (minimumX >> levelIndex) >= ::detail::OCCLUSION_MAXIMUM_TEST_TEXELS || (maximumY >> levelIndex) - (minimumY >> levelIndex) >= ::detail::OCCLUSION_MAXIMUM_TEST_TEXELS))
+		{
+			++levelIndex;
+		}
+
+		// The rectangle is occluded if all covered texels have an occluder in front of the nearest depth
+		const HierarchicalDepthLevel& level = mHierarchicalDepthLevels[levelIndex];
+		const float* data = (0 == levelIndex) ? mDepthBuffer.data() : (mHierarchicalDepthBuffer.data() + level.offset);
+		for (int y = (minimumY >> levelIndex); y <= (maximumY >> levelIndex); ++y)
+		{
+			for (int x = (minimumX >> levelIndex); x <= (maximumX >> levelIndex); ++x)
+			{
+				if (data[static_cast<uint32_t>(y) * level.width + static_cast<uint32_t>(x)] >= nearestDepth)
+				{
+					return false;
+				}
+			}
+		}
+		return true;
+	}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // Renderer
@@ -0,0 +1,240 @@
+/*********************************************************\
+ * Copyright (c) 2012-2020 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Renderer/Public/Core/Manager.h"
+#include "Renderer/Public/Resource/Scene/Culling/SceneItemSet.h"
+
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4201)	// warning C4201: nonstandard extension used: nameless struct/union
+	PRAGMA_WARNING_DISABLE_MSVC(4464)	// warning C4464: relative include path contains '..'
+	PRAGMA_WARNING_DISABLE_MSVC(4324)	// warning C4324: '<x>': structure was padded due to alignment specifier
+	#include <glm/glm.hpp>
+PRAGMA_WARNING_POP
+
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4668)	// warning C4668: '_M_HYBRID_X86_ARM64' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
+	#include <atomic>	// For "std::atomic<>"
+PRAGMA_WARNING_POP
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+	class FrameAllocator;
+	template <typename ReturnType> class ThreadPool;
+	typedef ThreadPool<void> DefaultThreadPool;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Classes                                               ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Software occlusion culler
+	*
+	*  @remarks
+	*    CPU occlusion culling stage running after the frustum culling, no RHI involved. The workflow is:
+	*    - Gather the frustum visible scene items flagged as occluder (see "Renderer::ISceneItem::setOccluder()")
+	*    - Rasterize the camera facing sides of the occluder bounding boxes into a low resolution depth buffer, the rows are split into bands which are rasterized in parallel using SIMD
+	*    - Build a hierarchical depth buffer storing the farthest depth of each texel
+	*    - Test the screen space rectangle and nearest depth of each frustum visible scene item bounding box against the hierarchical depth buffer in parallel
+	*
+	*    The rasterized occluder is the bounding box, so only scene items which are solid within their bounding box (walls, buildings, terrain blocks) should be flagged as occluder.
+	*    Occluders and scene items crossing the near plane are never considered to be occluded. The depth is the non-linear clip space depth (zero at near, one at far).
+	*/
+	class SoftwareOcclusionCuller final : public Manager
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Public definitions                                    ]
+	//[-------------------------------------------------------]
+	public:
+		static constexpr uint32_t DEFAULT_WIDTH  = 256;
+		static constexpr uint32_t DEFAULT_HEIGHT = 128;
+
+		/**
+		*  @brief
+		*    Software occlusion culler statistics of the last culling
+		*/
+		struct Statistics final
+		{
+			uint32_t numberOfOccluders;				///< Number of rasterized occluders
+			uint32_t numberOfOccluderTriangles;		///< Number of rasterized occluder triangles after near plane clipping
+			uint32_t numberOfTestedSceneItems;		///< Number of scene items tested against the hierarchical depth buffer
+			uint32_t numberOfOccludedSceneItems;	///< Number of scene items which were considered to be occluded
+			float	 rasterizationMilliseconds;		///< CPU time spent on occluder setup, rasterization and building the hierarchical depth buffer
+			float	 testMilliseconds;				///< CPU time spent on testing the scene items
+		};
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Constructor
+		*
+		*  @param[in] width
+		*    Depth buffer width, will be made a multiple of the SIMD lane count
+		*  @param[in] height
+		*    Depth buffer height
+		*/
+		explicit SoftwareOcclusionCuller(uint32_t width = DEFAULT_WIDTH, uint32_t height = DEFAULT_HEIGHT);
+
+		inline ~SoftwareOcclusionCuller()
+		{
+			// Nothing here
+		}
+
+		[[nodiscard]] inline uint32_t getWidth() const
+		{
+			return mWidth;
+		}
+
+		[[nodiscard]] inline uint32_t getHeight() const
+		{
+			return mHeight;
+		}
+
+		/**
+		*  @brief
+		*    Return the depth buffer of the last culling
+		*
+		*  @return
+		*    The depth buffer of the last culling, "Renderer::SoftwareOcclusionCuller::getWidth()" * "Renderer::SoftwareOcclusionCuller::getHeight()" row-major depth values, e.g. for debug visualization
+		*/
+		[[nodiscard]] inline const float* getDepthBuffer() const
+		{
+			return mDepthBuffer.data();
+		}
+
+		[[nodiscard]] inline const Statistics& getStatistics() const
+		{
+			return mStatistics;
+		}
+
+		/**
+		*  @brief
+		*    Cull the frustum visible scene items against the occluders between them
+		*
+		*  @param[in] defaultThreadPool
+		*    Thread pool to use
+		*  @param[in] frameAllocator
+		*    Frame allocator to use for the transient thread pool task arguments
+		*  @param[in] cameraRelativeWorldSpaceToClipSpaceMatrix
+		*    Camera relative world space to clip space matrix
+		*  @param[in] cullingOriginRelativeCameraPosition
+		*    32 bit camera position relative to the culling origin of the scene item set
+		*  @param[in, out] sceneItemSet
+		*    Scene item set, the visibility flag of occluded scene items is cleared
+		*  @param[in] indirection
+		*    Indices of the frustum visible scene items
+		*  @param[in] numberOfSceneItems
+		*    Number of frustum visible scene items
+		*/
+		void cull(DefaultThreadPool& defaultThreadPool, FrameAllocator& frameAllocator, const glm::mat4& cameraRelativeWorldSpaceToClipSpaceMatrix, const glm::vec3& cullingOriginRelativeCameraPosition, SceneItemSet& sceneItemSet, const uint32_t* indirection, uint32_t numberOfSceneItems);
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		struct Triangle final
+		{
+			glm::vec3 vertices[3];	///< Screen space x and y in pixels, z is the clip space depth
+		};
+		typedef std::vector<Triangle> Triangles;
+		struct HierarchicalDepthLevel final
+		{
+			uint32_t offset;	///< Offset inside the hierarchical depth buffer
+			uint32_t width;
+			uint32_t height;
+		};
+		typedef std::vector<HierarchicalDepthLevel> HierarchicalDepthLevels;
+		struct Task final	///< Arguments of a multi-threaded rasterization or test task, the queued thread pool task only captures a pointer to it so the "std::function" doesn't need a heap allocation
+		{
+			SoftwareOcclusionCuller* softwareOcclusionCuller;
+			const glm::mat4*		 cameraRelativeWorldSpaceToClipSpaceMatrix;	///< Null pointer for rasterization tasks
+			const glm::vec3*		 cullingOriginRelativeCameraPosition;		///< Null pointer for rasterization tasks
+			SceneItemSet*			 sceneItemSet;								///< Null pointer for rasterization tasks
+			const uint32_t*			 indirection;								///< Null pointer for rasterization tasks
+			uint32_t				 startIndex;								///< Start row for rasterization tasks, start scene item index for test tasks
+			uint32_t				 endIndex;									///< End row for rasterization tasks, end scene item index for test tasks
+		};
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		explicit SoftwareOcclusionCuller(const SoftwareOcclusionCuller&) = delete;
+		SoftwareOcclusionCuller& operator=(const SoftwareOcclusionCuller&) = delete;
+		void addOccluder(const glm::mat4& cameraRelativeWorldSpaceToClipSpaceMatrix, const glm::vec3& cullingOriginRelativeCameraPosition, const SceneItemSet& sceneItemSet, uint32_t index);
+		void addClippedPolygon(const glm::vec4* clipSpacePositions, uint32_t numberOfClipSpacePositions);
+		void rasterizeBand(uint32_t startRow, uint32_t endRow);
+		void buildHierarchicalDepthBuffer();
+		void testSceneItems(const glm::mat4& cameraRelativeWorldSpaceToClipSpaceMatrix, const glm::vec3& cullingOriginRelativeCameraPosition, SceneItemSet& sceneItemSet, const uint32_t* indirection, uint32_t startIndex, uint32_t endIndex);
+		[[nodiscard]] bool isRectangleOccluded(int minimumX, int minimumY, int maximumX, int maximumY, float nearestDepth) const;
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		uint32_t				   mWidth;
+		uint32_t				   mHeight;
+		SceneItemSet::FloatVector  mDepthBuffer;					///< Row-major nearest occluder depth, the row stride is the width
+		std::vector<float>		   mHierarchicalDepthBuffer;		///< Farthest depth per texel of all hierarchical depth levels except the first one which is the depth buffer itself
+		HierarchicalDepthLevels	   mHierarchicalDepthLevels;
+		Triangles				   mTriangles;						///< Screen space occluder triangles of the current culling
+		std::atomic<uint32_t>	   mNumberOfOccludedSceneItems;
+		Statistics				   mStatistics;
+
+
+	};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // Renderer
@@ -25,6 +25,7 @@
 #include "Renderer/Public/Resource/Scene/SceneResource.h"
 #include "Renderer/Public/Resource/Scene/Culling/SceneItemSet.h"
 #include "Renderer/Public/Resource/Scene/Culling/SceneCullingManager.h"
+#include "Renderer/Public/Core/Math/Math.h"
 
 
 //[-------------------------------------------------------]
@@ -42,6 +43,19 @@ namespace Renderer
 		return mSceneResource.getRenderer().getContext();
 	}
 
+	void ISceneItem::setOccluder(bool occluder)
+	{
+		if (nullptr != mSceneItemSet)
+		{
+			mSceneItemSet->occluderFlag[mSceneItemSetIndex] = occluder;
+		}
+	}
+
+	bool ISceneItem::isOccluder() const
+	{
+		return (nullptr != mSceneItemSet && 0 != mSceneItemSet->occluderFlag[mSceneItemSetIndex]);
+	}
+
 
 	//[-------------------------------------------------------]
 	//[ Protected methods                                     ]
@@ -86,16 +100,27 @@ namespace Renderer
 			mSceneItemSet->worldWY.push_back(0.0f);
 			mSceneItemSet->worldWZ.push_back(0.0f);
 			mSceneItemSet->worldWW.push_back(1.0f);
+			mSceneItemSet->positionX.push_back(0.0);
+			mSceneItemSet->positionY.push_back(0.0);
+			mSceneItemSet->positionZ.push_back(0.0);
 
 			// Set world space center position of bounding sphere
 			mSceneItemSet->spherePositionX.push_back(0.0f);
 			mSceneItemSet->spherePositionY.push_back(0.0f);
 			mSceneItemSet->spherePositionZ.push_back(0.0f);
+			mSceneItemSet->spherePosition64X.push_back(0.0);
+			mSceneItemSet->spherePosition64Y.push_back(0.0);
+			mSceneItemSet->spherePosition64Z.push_back(0.0);
+
+			// The 32 bit positions are relative to the culling origin
+			mSceneItemSet->setWorldSpacePosition(mSceneItemSetIndex, Math::DVEC3_ZERO);
+			mSceneItemSet->setWorldSpaceSpherePosition(mSceneItemSetIndex, Math::DVEC3_ZERO);
 
 			// Set negative world space radius of bounding sphere
 			mSceneItemSet->negativeRadius.push_back(-1.0f);
 
 			mSceneItemSet->visibilityFlag.push_back(0);
+			mSceneItemSet->occluderFlag.push_back(0);
 			mSceneItemSet->sceneItemVector.push_back(this);
 			++mSceneItemSet->numberOfSceneItems;
 		}
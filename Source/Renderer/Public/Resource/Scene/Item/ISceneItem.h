@@ -116,6 +116,24 @@ namespace Renderer
 			return mCallExecuteOnRendering;
 		}
 
+		/**
+		*  @brief
+		*    Set whether or not the scene item is an occluder for the software occlusion culling
+		*
+		*  @param[in] occluder
+		*    "true" if the scene item bounding box is rasterized as occluder, else "false"
+		*
+		*  @note
+		*    - The bounding box is rasterized, so only scene items which are solid within their bounding box should be flagged as occluder
+		*    - Has no effect for scene items which can't be culled
+		*
+		*  @see
+		*    - "Renderer::SoftwareOcclusionCuller"
+		*/
+		RENDERER_API_EXPORT void setOccluder(bool occluder);
+
+		[[nodiscard]] RENDERER_API_EXPORT bool isOccluder() const;
+
 
 	//[-------------------------------------------------------]
 	//[ Public virtual Renderer::ISceneItem methods           ]
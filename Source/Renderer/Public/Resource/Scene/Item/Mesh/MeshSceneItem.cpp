@@ -160,17 +160,12 @@ namespace Renderer
 						const glm::vec3& boundingSpherePosition = meshResource.getBoundingSpherePosition();
 						if (nullptr != parentSceneNode)
 						{
-							const glm::vec3& position = parentSceneNode->getTransform().position;
-							const glm::vec3& scale = parentSceneNode->getTransform().scale;
-							mSceneItemSet->spherePositionX[mSceneItemSetIndex] = boundingSpherePosition.x * scale.x + position.x;
-							mSceneItemSet->spherePositionY[mSceneItemSetIndex] = boundingSpherePosition.y * scale.y + position.y;
-							mSceneItemSet->spherePositionZ[mSceneItemSetIndex] = boundingSpherePosition.z * scale.z + position.z;
+							const Transform& globalTransform = parentSceneNode->getGlobalTransform();
+							mSceneItemSet->setWorldSpaceSpherePosition(mSceneItemSetIndex, glm::dvec3(boundingSpherePosition * globalTransform.scale) + globalTransform.position);
 						}
 						else
 						{
-							mSceneItemSet->spherePositionX[mSceneItemSetIndex] = boundingSpherePosition.x;
-							mSceneItemSet->spherePositionY[mSceneItemSetIndex] = boundingSpherePosition.y;
-							mSceneItemSet->spherePositionZ[mSceneItemSetIndex] = boundingSpherePosition.z;
+							mSceneItemSet->setWorldSpaceSpherePosition(mSceneItemSetIndex, glm::dvec3(boundingSpherePosition));
 						}
 					}
 
@@ -200,7 +195,15 @@ namespace Renderer
 					for (size_t i = 0; i < numberOfSubMeshes; ++i)
 					{
 						const SubMesh& subMesh = subMeshes[i];
-						renderables.emplace_back(mRenderableManager, vertexArrayPtr, positionOnlyVertexArrayPtr, materialResourceManager, subMesh.getMaterialResourceId(), skeletonResourceId, true, subMesh.getStartIndexLocation(), subMesh.getNumberOfIndices(), 1 RHI_RESOURCE_DEBUG_NAME((std::string(debugName) + "[SubMesh" + std::to_string(i) + ']').c_str()));
+						Renderable& renderable = renderables.emplace_back(mRenderableManager, vertexArrayPtr, positionOnlyVertexArrayPtr, materialResourceManager, subMesh.getMaterialResourceId(), skeletonResourceId, true, subMesh.getStartIndexLocation(), subMesh.getNumberOfIndices(), 1 RHI_RESOURCE_DEBUG_NAME((std::string(debugName) + "[SubMesh" + std::to_string(i) + ']').c_str()));
+						renderable.setQuantizedVertices(meshResource.hasQuantizedVertices());
+						if (meshResource.hasQuantizedVertices() && isInvalid(skeletonResourceId))
+						{
+							// Static meshes compiled using "QuantizeVertices" store the positions relative to the bounding box, see "Renderer::MeshResource::QUANTIZED_VERTEX_ATTRIBUTES"
+							const glm::vec3& minimumBoundingBoxPosition = meshResource.getMinimumBoundingBoxPosition();
+							const glm::vec3& maximumBoundingBoxPosition = meshResource.getMaximumBoundingBoxPosition();
+							renderable.setPositionDequantization((minimumBoundingBoxPosition + maximumBoundingBoxPosition) * 0.5f, (maximumBoundingBoxPosition - minimumBoundingBoxPosition) * 0.5f);
+						}
 					}
 					mRenderableManager.setNumberOfLods(meshResource.getNumberOfLods());
 				}
@@ -50,6 +50,9 @@ namespace Renderer
 	// Scene file format content:
 	// - File format header
 	// - Scene header
+	// - Scene nodes, each followed by its scene items
+	// - Prefabs, each followed by its scene items
+	// - Prefab instances, each followed by a compact array of transforms
 	namespace v1Scene
 	{
 
@@ -58,26 +61,38 @@ namespace Renderer
 		//[ Definitions                                           ]
 		//[-------------------------------------------------------]
 		static constexpr uint32_t FORMAT_TYPE	 = STRING_ID("Scene");
-		static constexpr uint32_t FORMAT_VERSION = 5;
+		static constexpr uint32_t FORMAT_VERSION = 6;
 
 		#pragma pack(push)
 		#pragma pack(1)
 			struct SceneHeader final
 			{
-				uint32_t unused;	// TODO(co) Currently the scene header is unused
-			};
-
-			struct Nodes final
-			{
-				uint32_t numberOfNodes;
+				uint32_t numberOfNodes;				///< Number of scene nodes, prefab instances not included
+				uint32_t numberOfPrefabs;			///< Number of prefab definitions
+				uint32_t numberOfPrefabInstances;	///< Number of prefab instance arrays
+				uint32_t totalNumberOfNodes;		///< Total number of scene nodes including the prefab instances, used to reserve memory up-front
+				uint32_t totalNumberOfItems;		///< Total number of scene items including the prefab instances, used to reserve memory up-front
 			};
 
 			struct Node final
 			{
 				Transform transform;
+				uint32_t  parentNodeIndex;	///< Index of the parent scene node, must be smaller as the index of this scene node, invalid for root scene nodes
 				uint32_t  numberOfItems;
 			};
 
+			struct Prefab final
+			{
+				uint32_t numberOfItems;
+				uint32_t numberOfBytes;	///< Number of bytes of all scene items (including the item headers) following the prefab
+			};
+
+			struct PrefabInstances final
+			{
+				uint32_t prefabIndex;
+				uint32_t numberOfInstances;	///< Number of transforms following the prefab instances, each instance is a root scene node with a copy of the prefab scene items
+			};
+
 			struct ItemHeader final
 			{
 				SceneItemTypeId typeId;
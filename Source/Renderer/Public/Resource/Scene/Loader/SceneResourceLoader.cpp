@@ -25,6 +25,8 @@
 #include "Renderer/Public/Resource/Scene/Loader/SceneFileFormat.h"
 #include "Renderer/Public/Resource/Scene/Item/ISceneItem.h"
 #include "Renderer/Public/Resource/Scene/SceneResource.h"
+#include "Renderer/Public/Resource/Scene/SceneNode.h"
+#include "Renderer/Public/Core/Time/Stopwatch.h"
 #include "Renderer/Public/IRenderer.h"
 
 
@@ -43,71 +45,156 @@ namespace
 		//[-------------------------------------------------------]
 		//[ Global functions                                      ]
 		//[-------------------------------------------------------]
-		void itemDeserialization(Renderer::IFile& file, Renderer::SceneResource& sceneResource, Renderer::SceneNode& sceneNode)
+		[[nodiscard]] const uint8_t* itemDeserialization(const uint8_t* data, Renderer::SceneResource& sceneResource, Renderer::SceneNode& sceneNode)
 		{
-			// Read the scene item header
-			Renderer::v1Scene::ItemHeader itemHeader;
-			file.read(&itemHeader, sizeof(Renderer::v1Scene::ItemHeader));
+			// Read the scene item header, the data is packed so don't access it directly
+			// -> The header contains a string ID and isn't trivially copyable, so copy the fields individually
+			static_assert(sizeof(Renderer::v1Scene::ItemHeader) == sizeof(uint32_t) * 2, "Unexpected scene item header size");
+			uint32_t typeId = 0;
+			uint32_t numberOfBytes = 0;
+			memcpy(&typeId, data, sizeof(uint32_t));
+			memcpy(&numberOfBytes, data + sizeof(uint32_t), sizeof(uint32_t));
+			const Renderer::v1Scene::ItemHeader itemHeader = { Renderer::SceneItemTypeId(typeId), numberOfBytes };
+			data += sizeof(Renderer::v1Scene::ItemHeader);
 
 			// Create the scene item
 			Renderer::ISceneItem* sceneItem = sceneResource.createSceneItem(itemHeader.typeId, sceneNode);
-			if (nullptr != sceneItem && 0 != itemHeader.numberOfBytes)
+			if (nullptr != sceneItem)
 			{
-				// Load in the scene item data
-				// TODO(co) Get rid of the new/delete in here
-				uint8_t* data = new uint8_t[itemHeader.numberOfBytes];
-				file.read(data, itemHeader.numberOfBytes);
-
-				// Deserialize the scene item
-				sceneItem->deserialize(itemHeader.numberOfBytes, data);
-
-				// Cleanup
-				delete [] data;
+				// Deserialize the scene item directly from the scene data, no temporary copy required
+				if (0 != itemHeader.numberOfBytes)
+				{
+					sceneItem->deserialize(itemHeader.numberOfBytes, data);
+				}
 			}
 			else
 			{
 				// TODO(co) Error handling
 			}
+
+			// Return the start of the next scene item
+			return data + itemHeader.numberOfBytes;
+		}
+
+		[[nodiscard]] const uint8_t* itemsDeserialization(const uint8_t* data, uint32_t numberOfItems, Renderer::SceneResource& sceneResource, Renderer::SceneNode& sceneNode)
+		{
+			for (uint32_t i = 0; i < numberOfItems; ++i)
+			{
+				data = itemDeserialization(data, sceneResource, sceneNode);
+			}
+			return data;
 		}
 
-		void nodeDeserialization(Renderer::IFile& file, Renderer::SceneResource& sceneResource)
+		void nodesDeserialization(Renderer::MemoryFile& memoryFile, uint32_t numberOfNodes, Renderer::SceneResource& sceneResource)
 		{
-			// Read in the scene node
-			Renderer::v1Scene::Node node;
-			file.read(&node, sizeof(Renderer::v1Scene::Node));
+			// Parent scene node indices are relative to the first scene node of this scene
+			const size_t firstSceneNodeIndex = sceneResource.getSceneNodes().size();
 
-			// Create the scene node
-			Renderer::SceneNode* sceneNode = sceneResource.createSceneNode(node.transform);
-			if (nullptr != sceneNode)
+			// Read in the scene nodes
+			for (uint32_t i = 0; i < numberOfNodes; ++i)
 			{
-				// Read in the scene items
-				for (uint32_t i = 0; i < node.numberOfItems; ++i)
+				// Read in the scene node
+				Renderer::v1Scene::Node node;
+				memoryFile.read(&node, sizeof(Renderer::v1Scene::Node));
+
+				// Create the scene node
+				Renderer::SceneNode* sceneNode = sceneResource.createSceneNode(node.transform);
+				if (nullptr != sceneNode)
+				{
+					// Attach the scene node to its parent scene node
+					if (Renderer::isValid(node.parentNodeIndex))
+					{
+						ASSERT(node.parentNodeIndex < i, "Invalid parent scene node index")
+						sceneResource.getSceneNodes()[firstSceneNodeIndex + node.parentNodeIndex]->attachSceneNode(*sceneNode);
+					}
+
+					// Read in the scene items
+					if (0 != node.numberOfItems)
+					{
+						const uint8_t* data = memoryFile.getCurrentDataPointer();
+						memoryFile.skip(static_cast<size_t>(itemsDeserialization(data, node.numberOfItems, sceneResource, *sceneNode) - data));
+					}
+				}
+				else
 				{
-					itemDeserialization(file, sceneResource, *sceneNode);
+					// TODO(co) Error handling
 				}
 			}
-			else
+		}
+
+		void prefabsDeserialization(Renderer::MemoryFile& memoryFile, uint32_t numberOfPrefabs, std::vector<const uint8_t*>& prefabDataPointers)
+		{
+			// The prefab scene items are deserialized when instancing the prefabs, for now just remember where the prefabs are
+			prefabDataPointers.clear();
+			for (uint32_t i = 0; i < numberOfPrefabs; ++i)
 			{
-				// TODO(co) Error handling
+				prefabDataPointers.push_back(memoryFile.getCurrentDataPointer());
+				Renderer::v1Scene::Prefab prefab;
+				memoryFile.read(&prefab, sizeof(Renderer::v1Scene::Prefab));
+				if (0 != prefab.numberOfBytes)
+				{
+					memoryFile.skip(prefab.numberOfBytes);
+				}
 			}
 		}
 
-		void nodesDeserialization(Renderer::IFile& file, Renderer::SceneResource& sceneResource)
+		void prefabInstancesDeserialization(Renderer::MemoryFile& memoryFile, uint32_t numberOfPrefabInstances, const std::vector<const uint8_t*>& prefabDataPointers, Renderer::SceneResource& sceneResource)
 		{
-			// Read in the scene nodes
-			Renderer::v1Scene::Nodes nodes;
-			file.read(&nodes, sizeof(Renderer::v1Scene::Nodes));
+			for (uint32_t i = 0; i < numberOfPrefabInstances; ++i)
+			{
+				// Read in the prefab instances header
+				Renderer::v1Scene::PrefabInstances prefabInstances;
+				memoryFile.read(&prefabInstances, sizeof(Renderer::v1Scene::PrefabInstances));
+				ASSERT(prefabInstances.prefabIndex < prefabDataPointers.size(), "Invalid prefab index")
 
-			// Sanity check
-			ASSERT(nodes.numberOfNodes > 0, "Invalid scene asset without any nodes detected")
+				// Get the prefab, the data is packed so don't access it directly
+				const uint8_t* prefabData = prefabDataPointers[prefabInstances.prefabIndex];
+				Renderer::v1Scene::Prefab prefab;
+				memcpy(&prefab, prefabData, sizeof(Renderer::v1Scene::Prefab));
+				prefabData += sizeof(Renderer::v1Scene::Prefab);
 
-			// Read in the scene nodes
-			for (uint32_t i = 0; i < nodes.numberOfNodes; ++i)
-			{
-				nodeDeserialization(file, sceneResource);
+				// Each prefab instance is a root scene node with its own copy of the prefab scene items
+				for (uint32_t instanceIndex = 0; instanceIndex < prefabInstances.numberOfInstances; ++instanceIndex)
+				{
+					Renderer::Transform transform;
+					memoryFile.read(&transform, sizeof(Renderer::Transform));
+					Renderer::SceneNode* sceneNode = sceneResource.createSceneNode(transform);
+					if (nullptr != sceneNode)
+					{
+						[[maybe_unused]] const uint8_t* prefabDataEnd = itemsDeserialization(prefabData, prefab.numberOfItems, sceneResource, *sceneNode);
+						ASSERT(static_cast<uint32_t>(prefabDataEnd - prefabData) == prefab.numberOfBytes, "Invalid prefab number of bytes")
+					}
+					else
+					{
+						// TODO(co) Error handling
+					}
+				}
 			}
 		}
 
+		void sceneDeserialization(const Renderer::IRenderer& renderer, Renderer::MemoryFile& memoryFile, Renderer::SceneResource& sceneResource, std::vector<const uint8_t*>& prefabDataPointers)
+		{
+			const Renderer::Stopwatch stopwatch(true);
+
+			// Read in the scene header
+			Renderer::v1Scene::SceneHeader sceneHeader;
+			memoryFile.read(&sceneHeader, sizeof(Renderer::v1Scene::SceneHeader));
+
+			// Sanity check
+			ASSERT(sceneHeader.numberOfNodes > 0 || sceneHeader.numberOfPrefabInstances > 0, "Invalid scene asset without any nodes detected")
+
+			// Reserve everything up-front so creating the scene nodes and scene items, including filling the culling data, doesn't need to reallocate
+			sceneResource.reserveSceneNodesAndItems(sceneHeader.totalNumberOfNodes, sceneHeader.totalNumberOfItems);
+
+			// Read in the scene nodes, the prefabs and the prefab instances
+			nodesDeserialization(memoryFile, sceneHeader.numberOfNodes, sceneResource);
+			prefabsDeserialization(memoryFile, sceneHeader.numberOfPrefabs, prefabDataPointers);
+			prefabInstancesDeserialization(memoryFile, sceneHeader.numberOfPrefabInstances, prefabDataPointers, sceneResource);
+
+			// Done
+			RHI_LOG(renderer.getContext(), DEBUG, "Renderer created %u scene nodes and %u scene items in %.2f ms", sceneHeader.totalNumberOfNodes, sceneHeader.totalNumberOfItems, static_cast<double>(stopwatch.getMilliseconds()))
+		}
+
 
 //[-------------------------------------------------------]
 //[ Anonymous detail namespace                            ]
@@ -143,17 +230,12 @@ namespace Renderer
 		// Decompress LZ4 compressed data
 		mMemoryFile.decompress();
 
-		// Read in the scene header
-		// TODO(co) Currently the scene header is unused
-		v1Scene::SceneHeader sceneHeader;
-		mMemoryFile.read(&sceneHeader, sizeof(v1Scene::SceneHeader));
-
 		// Can we create the RHI resource asynchronous as well?
 		// -> For example scene items might create RHI resources, so we have to check for native RHI multithreading support in here
 		if (mRenderer.getRhi().getCapabilities().nativeMultithreading)
 		{
-			// Read in the scene resource nodes
-			::detail::nodesDeserialization(mMemoryFile, *mSceneResource);
+			// Read in the scene resource
+			::detail::sceneDeserialization(mRenderer, mMemoryFile, *mSceneResource, mPrefabDataPointers);
 		}
 	}
 
@@ -163,8 +245,8 @@ namespace Renderer
 		// -> For example scene items might create RHI resources, so we have to check for native RHI multithreading support in here
 		if (!mRenderer.getRhi().getCapabilities().nativeMultithreading)
 		{
-			// Read in the scene resource nodes
-			::detail::nodesDeserialization(mMemoryFile, *mSceneResource);
+			// Read in the scene resource
+			::detail::sceneDeserialization(mRenderer, mMemoryFile, *mSceneResource, mPrefabDataPointers);
 		}
 
 		// Fully loaded
@@ -145,24 +145,23 @@ namespace Renderer
 			const uint32_t sceneItemSetIndex = sceneItem.mSceneItemSetIndex;
 
 			{ // Set object space to world space matrix
+				// -> The 32 bit position is relative to the culling origin, so set it by using the 64 bit world space position
 				glm::mat4 objectSpaceToWorldSpace;
 				mGlobalTransform.getAsMatrix(objectSpaceToWorldSpace);
 				sceneItemSet->worldXX[sceneItemSetIndex] = objectSpaceToWorldSpace[0][0];
 				sceneItemSet->worldXY[sceneItemSetIndex] = objectSpaceToWorldSpace[1][0];
 				sceneItemSet->worldXZ[sceneItemSetIndex] = objectSpaceToWorldSpace[2][0];
-				sceneItemSet->worldXW[sceneItemSetIndex] = objectSpaceToWorldSpace[3][0];
 				sceneItemSet->worldYX[sceneItemSetIndex] = objectSpaceToWorldSpace[0][1];
 				sceneItemSet->worldYY[sceneItemSetIndex] = objectSpaceToWorldSpace[1][1];
 				sceneItemSet->worldYZ[sceneItemSetIndex] = objectSpaceToWorldSpace[2][1];
-				sceneItemSet->worldYW[sceneItemSetIndex] = objectSpaceToWorldSpace[3][1];
 				sceneItemSet->worldZX[sceneItemSetIndex] = objectSpaceToWorldSpace[0][2];
 				sceneItemSet->worldZY[sceneItemSetIndex] = objectSpaceToWorldSpace[1][2];
 				sceneItemSet->worldZZ[sceneItemSetIndex] = objectSpaceToWorldSpace[2][2];
-				sceneItemSet->worldZW[sceneItemSetIndex] = objectSpaceToWorldSpace[3][2];
 				sceneItemSet->worldWX[sceneItemSetIndex] = objectSpaceToWorldSpace[0][3];
 				sceneItemSet->worldWY[sceneItemSetIndex] = objectSpaceToWorldSpace[1][3];
 				sceneItemSet->worldWZ[sceneItemSetIndex] = objectSpaceToWorldSpace[2][3];
 				sceneItemSet->worldWW[sceneItemSetIndex] = objectSpaceToWorldSpace[3][3];
+				sceneItemSet->setWorldSpacePosition(sceneItemSetIndex, mGlobalTransform.position);
 			}
 
 			if (sceneItem.getSceneItemTypeId() == MeshSceneItem::TYPE_ID)
@@ -172,11 +171,7 @@ namespace Renderer
 				{
 					{ // Set world space center position of bounding sphere
 						const glm::vec3& boundingSpherePosition = meshResource->getBoundingSpherePosition();
-						const glm::dvec3& position = mGlobalTransform.position;
-						const glm::vec3& scale = mGlobalTransform.scale;
-						sceneItemSet->spherePositionX[sceneItemSetIndex] = static_cast<float>(boundingSpherePosition.x * scale.x + position.x);
-						sceneItemSet->spherePositionY[sceneItemSetIndex] = static_cast<float>(boundingSpherePosition.y * scale.y + position.y);
-						sceneItemSet->spherePositionZ[sceneItemSetIndex] = static_cast<float>(boundingSpherePosition.z * scale.z + position.z);
+						sceneItemSet->setWorldSpaceSpherePosition(sceneItemSetIndex, glm::dvec3(boundingSpherePosition * mGlobalTransform.scale) + mGlobalTransform.position);
 					}
 
 					// Set negative world space radius of bounding sphere
@@ -185,17 +180,13 @@ namespace Renderer
 				else
 				{
 					// Set world space center position of bounding sphere
-					sceneItemSet->spherePositionX[sceneItemSetIndex] = static_cast<float>(mGlobalTransform.position.x);
-					sceneItemSet->spherePositionY[sceneItemSetIndex] = static_cast<float>(mGlobalTransform.position.y);
-					sceneItemSet->spherePositionZ[sceneItemSetIndex] = static_cast<float>(mGlobalTransform.position.z);
+					sceneItemSet->setWorldSpaceSpherePosition(sceneItemSetIndex, mGlobalTransform.position);
 				}
 			}
 			else
 			{
 				// Set world space center position of bounding sphere
-				sceneItemSet->spherePositionX[sceneItemSetIndex] = static_cast<float>(mGlobalTransform.position.x);
-				sceneItemSet->spherePositionY[sceneItemSetIndex] = static_cast<float>(mGlobalTransform.position.y);
-				sceneItemSet->spherePositionZ[sceneItemSetIndex] = static_cast<float>(mGlobalTransform.position.z);
+				sceneItemSet->setWorldSpaceSpherePosition(sceneItemSetIndex, mGlobalTransform.position);
 			}
 		}
 	}
@@ -59,6 +59,13 @@ namespace Renderer
 		setLoadingState(IResource::LoadingState::UNLOADED);
 	}
 
+	void SceneResource::reserveSceneNodesAndItems(uint32_t numberOfSceneNodes, uint32_t numberOfSceneItems)
+	{
+		mSceneNodes.reserve(mSceneNodes.size() + numberOfSceneNodes);
+		mSceneItems.reserve(mSceneItems.size() + numberOfSceneItems);
+		getSceneCullingManager().reserveSceneItems(numberOfSceneItems);
+	}
+
 	SceneNode* SceneResource::createSceneNode(const Transform& transform)
 	{
 		SceneNode* sceneNode = new SceneNode(transform);
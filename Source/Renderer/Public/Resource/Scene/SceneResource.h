@@ -108,6 +108,20 @@ namespace Renderer
 
 		RENDERER_API_EXPORT void destroyAllSceneNodesAndItems();
 
+		/**
+		*  @brief
+		*    Reserve memory for bulk scene node and scene item creation
+		*
+		*  @param[in] numberOfSceneNodes
+		*    Number of scene nodes which are going to be created
+		*  @param[in] numberOfSceneItems
+		*    Number of scene items which are going to be created
+		*
+		*  @note
+		*    - Avoids reallocations of the scene node and scene item lists as well as of the culling data when creating e.g. a huge number of prefab instances in one go
+		*/
+		RENDERER_API_EXPORT void reserveSceneNodesAndItems(uint32_t numberOfSceneNodes, uint32_t numberOfSceneItems);
+
 		//[-------------------------------------------------------]
 		//[ Node                                                  ]
 		//[-------------------------------------------------------]
@@ -161,24 +161,10 @@ namespace
 			EXPR_VAR
 		};
 
-		struct Expression final
-		{
-			bool					result;
-			bool					negated;
-			ExpressionType			type;
-			std::vector<Expression>	children;
-			std::string				value;
-
-			Expression() :
-				result(false),
-				negated(false),
-				type(EXPR_VAR)
-			{
-			}
-		};
-
-		typedef std::vector<Expression> ExpressionVec;
-		typedef std::vector<std::string> StringVector;
+		typedef Renderer::ShaderBuilder::Expression		Expression;
+		typedef Renderer::ShaderBuilder::Expressions	Expressions;
+		typedef Renderer::ShaderBuilder::ArgumentValue	ArgumentValue;
+		typedef Renderer::ShaderBuilder::ArgumentValues	ArgumentValues;
 
 		template<uint32_t _N, typename _internalDataType, uint32_t _bits, uint32_t _mask> class cbitsetN
 		{
@@ -318,6 +304,12 @@ namespace
 				return retVal;
 			}
 
+			// Same as "0 == find(value, pos)" but without searching through the whole remaining buffer
+			[[nodiscard]] bool startsWith(const char* value, size_t length, size_t pos = 0) const
+			{
+				return (0 == mOriginal->compare(mStart + pos, length, value, length));
+			}
+
 			[[nodiscard]] bool matchEqual(const char* stringCompare) const
 			{
 				const char* origStr = mOriginal->c_str() + mStart;
@@ -395,6 +387,53 @@ namespace
 			return calculateLineCount(subString.getOriginalBuffer(), subString.getStart());
 		}
 
+		[[nodiscard]] inline const char* getArgumentValueString(const std::string& buffer, const ArgumentValue& argumentValue)
+		{
+			return buffer.c_str() + argumentValue.start;
+		}
+
+		[[nodiscard]] inline int getArgumentValueLength(const ArgumentValue& argumentValue)
+		{
+			return static_cast<int>(argumentValue.length);
+		}
+
+		[[nodiscard]] inline Renderer::StringId getArgumentValueStringId(const std::string& buffer, const ArgumentValue& argumentValue)
+		{
+			// Must match "Renderer::StringId::calculateFNV()" so we don't need to create a null terminated string first
+			uint32_t hash = Renderer::StringId::FNV1a_INITIAL_HASH_32;
+			const char* string = getArgumentValueString(buffer, argumentValue);
+			for (size_t i = 0; i < argumentValue.length; ++i)
+			{
+				hash = (hash ^ string[i]) * Renderer::StringId::FNV1a_MAGIC_PRIME_32;
+			}
+			return Renderer::StringId(hash);
+		}
+
+		// Behaves like "strtol()" with base 10 on a null terminated copy of the argument value: Returns "true" if at least one digit was consumed
+		[[nodiscard]] bool getArgumentValueInteger(const std::string& buffer, const ArgumentValue& argumentValue, int& value)
+		{
+			const char* string = getArgumentValueString(buffer, argumentValue);
+			size_t i = 0;
+			bool negative = false;
+			if (i < argumentValue.length && ('-' == string[i] || '+' == string[i]))
+			{
+				negative = ('-' == string[i]);
+				++i;
+			}
+			const size_t firstDigit = i;
+			long result = 0;
+			for ( ; i < argumentValue.length && string[i] >= '0' && string[i] <= '9'; ++i)
+			{
+				result = result * 10 + (string[i] - '0');
+			}
+			if (i == firstDigit)
+			{
+				return false;
+			}
+			value = static_cast<int>(negative ? -result : result);
+			return true;
+		}
+
 		// Returns true if we found an @end, false if we found
 		// \@else instead (can only happen if allowsElse=true).
 		bool findBlockEnd(const Rhi::Context& context, SubStringRef& outSubString, bool& syntaxError, bool allowsElse = false)
@@ -425,8 +464,7 @@ namespace
 				{
 					const SubStringRef subString(&outSubString.getOriginalBuffer(), it + 1);
 
-					size_t idx = subString.find("end");
-					if (0 == idx)
+					if (subString.startsWith("end", sizeof("end") - 1))
 					{
 						--nesting;
 						it += sizeof("end") - 1;
@@ -434,11 +472,7 @@ namespace
 					}
 					else
 					{
-						if (allowsElse)
-						{
-							idx = subString.find("else");
-						}
-						if (0 == idx)
+						if (allowsElse && subString.startsWith("else", sizeof("else") - 1))
 						{
 							if (!allowedElses.test(static_cast<size_t>(nesting)))
 							{
@@ -463,8 +497,7 @@ namespace
 						{
 							for (size_t i = 0; i < sizeof(blockNames) / sizeof(char*); ++i)
 							{
-								const size_t idxBlock = subString.find(blockNames[i]);
-								if (0 == idxBlock)
+								if (subString.startsWith(blockNames[i], strlen(blockNames[i])))
 								{
 									it = subString.begin() + static_cast<int64_t>(strlen(blockNames[i]));
 									if (3 == i)
@@ -544,45 +577,44 @@ namespace
 			return returnValue;
 		}
 
-		[[nodiscard]] bool evaluateExpressionRecursive(const Rhi::Context& context, const Renderer::ShaderProperties& shaderProperties, ExpressionVec& expression, bool& outSyntaxError)
+		[[nodiscard]] bool evaluateExpressionRecursive(const Rhi::Context& context, const Renderer::ShaderProperties& shaderProperties, const std::string& buffer, Expressions& expressions, int32_t firstExpression, bool& outSyntaxError)
 		{
-			ExpressionVec::iterator itor = expression.begin();
-			ExpressionVec::iterator end  = expression.end();
-
-			while (itor != end)
+			int32_t index = firstExpression;
+			while (-1 != index)
 			{
-				if (itor->value == "&&")
+				Expression& exp = expressions[static_cast<size_t>(index)];
+				if (2 == exp.valueLength && '&' == exp.valueFirstCharacter && '&' == exp.valueLastCharacter)
 				{
-					itor->type = EXPR_OPERATOR_AND;
+					exp.type = EXPR_OPERATOR_AND;
 				}
-				else if (itor->value == "||")
+				else if (2 == exp.valueLength && '|' == exp.valueFirstCharacter && '|' == exp.valueLastCharacter)
 				{
-					itor->type = EXPR_OPERATOR_OR;
+					exp.type = EXPR_OPERATOR_OR;
 				}
-				else if (!itor->children.empty())
+				else if (-1 != exp.firstChild)
 				{
-					itor->type = EXPR_OBJECT;
+					exp.type = EXPR_OBJECT;
 				}
 				else
 				{
-					itor->type = EXPR_VAR;
+					exp.type = EXPR_VAR;
 				}
 
-				++itor;
+				index = exp.nextSibling;
 			}
 
 			bool syntaxError = outSyntaxError;
 			bool lastExpWasOperator = true;
 
-			itor = expression.begin();
+			index = firstExpression;
 
-			while (itor != end && !syntaxError)
+			while (-1 != index && !syntaxError)
 			{
-				Expression& exp = *itor;
+				Expression& exp = expressions[static_cast<size_t>(index)];
 				if (((EXPR_OPERATOR_OR == exp.type || EXPR_OPERATOR_AND == exp.type) && lastExpWasOperator) || ((EXPR_VAR == exp.type || EXPR_OBJECT == exp.type) && !lastExpWasOperator))
 				{
 					syntaxError = true;
-					RHI_LOG(context, CRITICAL, "Renderer shader builder: Unrecognized token '%s'", exp.value.c_str())
+					RHI_LOG(context, CRITICAL, "Renderer shader builder: Unrecognized token '%.*s'", static_cast<int>(exp.valueEnd - exp.valueStart), buffer.c_str() + exp.valueStart)
 				}
 				else if (EXPR_OPERATOR_OR == exp.type || EXPR_OPERATOR_AND == exp.type)
 				{
@@ -591,33 +623,34 @@ namespace
 				else if (EXPR_VAR == exp.type)
 				{
 					int32_t propertyValue = 0;
-					shaderProperties.getPropertyValue(Renderer::StringId(exp.value.c_str()), propertyValue);
+					shaderProperties.getPropertyValue(Renderer::StringId(exp.valueHash), propertyValue);
 					exp.result = (propertyValue != 0);
 					lastExpWasOperator = false;
 				}
 				else
 				{
-					exp.result = evaluateExpressionRecursive(context, shaderProperties, exp.children, syntaxError);
+					exp.result = evaluateExpressionRecursive(context, shaderProperties, buffer, expressions, exp.firstChild, syntaxError);
 					lastExpWasOperator = false;
 				}
 
-				++itor;
+				index = exp.nextSibling;
 			}
 
 			bool retVal = true;
 
 			if (!syntaxError)
 			{
-				itor = expression.begin();
+				index = firstExpression;
 				bool andMode = true;
 
-				while (itor != end)
+				while (-1 != index)
 				{
-					if (EXPR_OPERATOR_OR == itor->type)
+					const Expression& exp = expressions[static_cast<size_t>(index)];
+					if (EXPR_OPERATOR_OR == exp.type)
 					{
 						andMode = false;
 					}
-					else if (EXPR_OPERATOR_AND == itor->type)
+					else if (EXPR_OPERATOR_AND == exp.type)
 					{
 						andMode = true;
 					}
@@ -625,15 +658,15 @@ namespace
 					{
 						if (andMode)
 						{
-							retVal &= itor->negated ? !itor->result : itor->result;
+							retVal &= exp.negated ? !exp.result : exp.result;
 						}
 						else
 						{
-							retVal |= itor->negated ? !itor->result : itor->result;
+							retVal |= exp.negated ? !exp.result : exp.result;
 						}
 					}
 
-					++itor;
+					index = exp.nextSibling;
 				}
 			}
 
@@ -642,7 +675,25 @@ namespace
 			return retVal;
 		}
 
-		[[nodiscard]] bool evaluateExpression(const Rhi::Context& context, const Renderer::ShaderProperties& shaderProperties, SubStringRef& outSubString, bool& outSyntaxError)
+		int32_t addChildExpression(Expressions& expressions, int32_t parent)
+		{
+			const int32_t child = static_cast<int32_t>(expressions.size());
+			expressions.emplace_back();
+			expressions.back().parent = parent;
+			Expression& parentExpression = expressions[static_cast<size_t>(parent)];
+			if (-1 == parentExpression.lastChild)
+			{
+				parentExpression.firstChild = child;
+			}
+			else
+			{
+				expressions[static_cast<size_t>(parentExpression.lastChild)].nextSibling = child;
+			}
+			parentExpression.lastChild = child;
+			return child;
+		}
+
+		[[nodiscard]] bool evaluateExpression(const Rhi::Context& context, const Renderer::ShaderProperties& shaderProperties, SubStringRef& outSubString, Expressions& expressions, bool& outSyntaxError)
 		{
 			const size_t expEnd = evaluateExpressionEnd(context, outSubString);
 			if (std::string::npos == expEnd)
@@ -659,13 +710,13 @@ namespace
 			bool syntaxError = false;
 			bool nextExpressionNegates = false;
 
-			std::vector<Expression*> expressionParents;
-			ExpressionVec outExpressions;
-			outExpressions.clear();
-			outExpressions.resize(1);
+			// The first expression is the root expression
+			expressions.clear();
+			expressions.emplace_back();
 
-			Expression* currentExpression = &outExpressions.back();
+			int32_t currentExpression = 0;
 
+			const std::string& buffer = subString.getOriginalBuffer();
 			std::string::const_iterator it = subString.begin();
 			std::string::const_iterator en = subString.end();
 
@@ -675,26 +726,23 @@ namespace
 
 				if ('(' == c)
 				{
-					currentExpression->children.push_back(Expression());
-					expressionParents.push_back(currentExpression);
-
-					currentExpression->children.back().negated = nextExpressionNegates;
+					const int32_t child = addChildExpression(expressions, currentExpression);
+					expressions[static_cast<size_t>(child)].negated = nextExpressionNegates;
 
 					textStarted = false;
 					nextExpressionNegates = false;
 
-					currentExpression = &currentExpression->children.back();
+					currentExpression = child;
 				}
 				else if (')' == c)
 				{
-					if (expressionParents.empty())
+					if (0 == currentExpression)
 					{
 						syntaxError = true;
 					}
 					else
 					{
-						currentExpression = expressionParents.back();
-						expressionParents.pop_back();
+						currentExpression = expressions[static_cast<size_t>(currentExpression)].parent;
 					}
 
 					textStarted = false;
@@ -712,23 +760,36 @@ namespace
 					if (!textStarted)
 					{
 						textStarted = true;
-						currentExpression->children.push_back(Expression());
-						currentExpression->children.back().negated = nextExpressionNegates;
+						const int32_t child = addChildExpression(expressions, currentExpression);
+						expressions[static_cast<size_t>(child)].negated = nextExpressionNegates;
 					}
 
 					if ('&' == c || '|' == c || '=' == c || '<' == c || '>' == c || '!' == c)	// ! can only mean "!="
 					{
-						if (currentExpression->children.empty() || nextExpressionNegates)
+						const int32_t lastChild = expressions[static_cast<size_t>(currentExpression)].lastChild;
+						if (-1 == lastChild || nextExpressionNegates)
 						{
 							syntaxError = true;
 						}
-						else if (!currentExpression->children.back().value.empty() && *(currentExpression->children.back().value.end() - 1) != c && '=' != c)
+						else if (0 != expressions[static_cast<size_t>(lastChild)].valueLength && expressions[static_cast<size_t>(lastChild)].valueLastCharacter != c && '=' != c)
 						{
-							currentExpression->children.push_back(Expression());
+							addChildExpression(expressions, currentExpression);
 						}
 					}
 
-					currentExpression->children.back().value.push_back(c);
+					{ // Append the character to the value of the current child expression
+						Expression& exp = expressions[static_cast<size_t>(expressions[static_cast<size_t>(currentExpression)].lastChild)];
+						const size_t position = static_cast<size_t>(it - buffer.begin());
+						if (0 == exp.valueLength)
+						{
+							exp.valueFirstCharacter = c;
+							exp.valueStart = position;
+						}
+						exp.valueLastCharacter = c;
+						exp.valueEnd = position + 1;
+						exp.valueHash = (exp.valueHash ^ c) * Renderer::StringId::FNV1a_MAGIC_PRIME_32;
+						++exp.valueLength;
+					}
 					nextExpressionNegates = false;
 				}
 
@@ -736,13 +797,13 @@ namespace
 			}
 
 			bool retVal = false;
-			if (!expressionParents.empty())
+			if (0 != currentExpression)
 			{
 				syntaxError = true;
 			}
 			if (!syntaxError)
 			{
-				retVal = evaluateExpressionRecursive(context, shaderProperties, outExpressions, syntaxError) != 0;
+				retVal = evaluateExpressionRecursive(context, shaderProperties, buffer, expressions, 0, syntaxError);
 			}
 			if (syntaxError)
 			{
@@ -752,7 +813,7 @@ namespace
 			return retVal;
 		}
 
-		void evaluateParamArgs(const Rhi::Context& context, SubStringRef& outSubString, StringVector& outArgs, bool& outSyntaxError)
+		void evaluateParamArgs(const Rhi::Context& context, SubStringRef& outSubString, ArgumentValues& outArgs, bool& outSyntaxError)
 		{
 			const size_t expEnd = evaluateExpressionEnd(context, outSubString);
 			if (std::string::npos == expEnd)
@@ -769,7 +830,7 @@ namespace
 			bool syntaxError = false;
 
 			outArgs.clear();
-			outArgs.push_back(std::string());
+			outArgs.emplace_back();
 
 			std::string::const_iterator it = subString.begin();
 			std::string::const_iterator en = subString.end();
@@ -792,7 +853,7 @@ namespace
 				else if (',' == c)
 				{
 					expressionState = 0;
-					outArgs.push_back(std::string());
+					outArgs.emplace_back();
 				}
 				else
 				{
@@ -803,7 +864,13 @@ namespace
 					}
 					else
 					{
-						outArgs.back().push_back(*it);
+						// Argument values are always contiguous, so we just need to remember the range
+						ArgumentValue& argumentValue = outArgs.back();
+						if (0 == argumentValue.length)
+						{
+							argumentValue.start = static_cast<size_t>(it - subString.getOriginalBuffer().begin());
+						}
+						++argumentValue.length;
 						expressionState = 1;
 					}
 				}
@@ -821,33 +888,27 @@ namespace
 
 		void copy(std::string& outBuffer, const SubStringRef& inSubString, size_t length)
 		{
-			std::string::const_iterator itor = inSubString.begin();
-			std::string::const_iterator end  = inSubString.begin() + static_cast<int>(length);
-
-			while (itor != end)
-			{
-				outBuffer.push_back(*itor++);
-			}
+			outBuffer.append(inSubString.getOriginalBuffer(), inSubString.getStart(), length);
 		}
 
-		void repeat(std::string& outBuffer, const SubStringRef& inSubString, size_t length, size_t passNum, const std::string& counterVar)
+		void repeat(std::string& outBuffer, const SubStringRef& inSubString, size_t length, size_t passNum, const char* counterVar, size_t counterVarLength)
 		{
 			std::string::const_iterator itor = inSubString.begin();
 			std::string::const_iterator end  = inSubString.begin() + static_cast<int>(length);
 
 			while (itor != end)
 			{
-				if ('@' == *itor && !counterVar.empty())
+				if ('@' == *itor && 0 != counterVarLength)
 				{
 					SubStringRef subString(&inSubString.getOriginalBuffer(), itor + 1);
-					if (subString.find(counterVar) == 0)
+					if (subString.startsWith(counterVar, counterVarLength))
 					{
 						{
 							char temp[16];
 							snprintf(temp, 16, "%lu", static_cast<unsigned long>(passNum));
 							outBuffer += temp;
 						}
-						itor += static_cast<int>(counterVar.size()) + 1;
+						itor += static_cast<int>(counterVarLength) + 1;
 					}
 					else
 					{
@@ -884,6 +945,7 @@ namespace Renderer
 		mShaderProperties = shaderProperties;
 		mShaderProperties.setPropertyValues(static_cast<const ShaderBlueprintResourceManager&>(shaderBlueprintResource.getResourceManager()).getRhiShaderProperties());
 		mDynamicShaderPieces.clear();
+		mDynamicShaderPiecesSourceCode.clear();
 		buildShader.assetIds.push_back(shaderBlueprintResource.getAssetId());
 		const AssetManager& assetManager = shaderPieceResourceManager.getRenderer().getAssetManager();
 		uint64_t combinedAssetFileHashes = Math::calculateFNV1a64(reinterpret_cast<const uint8_t*>(&assetManager.getAssetByAssetId(shaderBlueprintResource.getAssetId()).fileHash), sizeof(uint64_t), Math::FNV1a_INITIAL_HASH_64);
@@ -953,7 +1015,7 @@ namespace Renderer
 		outBuffer.clear();
 		outBuffer.reserve(inBuffer.size());
 
-		::detail::StringVector argValues;
+		::detail::ArgumentValues& argValues = mArgumentValues;
 		::detail::SubStringRef subString(&inBuffer, 0);
 
 		size_t pos = subString.find("@");
@@ -1005,21 +1067,20 @@ namespace Renderer
 			}
 			else
 			{
-				StringId dstProperty = StringId(argValues[0].c_str());
+				StringId dstProperty = ::detail::getArgumentValueStringId(inBuffer, argValues[0]);
 				size_t idx  = 1;
 				StringId srcProperty = dstProperty;
 				if (argValues.size() == 3)
 				{
-					srcProperty = StringId(argValues[idx++].c_str());
+					srcProperty = ::detail::getArgumentValueStringId(inBuffer, argValues[idx++]);
 				}
 				int op1Value = 0;
 				mShaderProperties.getPropertyValue(srcProperty, op1Value);
-				char* endPtr = nullptr;
-				int op2Value = strtol(argValues[idx].c_str(), &endPtr, 10);
-				if (argValues[idx].c_str() == endPtr)
+				int op2Value = 0;
+				if (!::detail::getArgumentValueInteger(inBuffer, argValues[idx], op2Value))
 				{
 					// Not a number, interpret as property
-					mShaderProperties.getPropertyValue(StringId(argValues[idx].c_str()), op2Value);
+					mShaderProperties.getPropertyValue(::detail::getArgumentValueStringId(inBuffer, argValues[idx]), op2Value);
 				}
 
 				const int result = ::detail::c_operations[keyword].opFunc(op1Value, op2Value);
@@ -1055,12 +1116,12 @@ namespace Renderer
 		return syntaxError;
 	}
 
-	bool ShaderBuilder::parseForEach(const std::string& inBuffer, std::string& outBuffer) const
+	bool ShaderBuilder::parseForEach(const std::string& inBuffer, std::string& outBuffer)
 	{
 		outBuffer.clear();
 		outBuffer.reserve(inBuffer.size());
 
-		::detail::StringVector argValues;
+		::detail::ArgumentValues& argValues = mArgumentValues;
 		::detail::SubStringRef subString(&inBuffer, 0);
 		size_t pos = subString.find("@foreach");
 
@@ -1079,30 +1140,30 @@ namespace Renderer
 
 			if (!syntaxError)
 			{
-				char* endPtr = nullptr;
-				int count = strtol(argValues[0].c_str(), &endPtr, 10);
-				if (argValues[0].c_str() == endPtr)
+				int count = 0;
+				if (!::detail::getArgumentValueInteger(inBuffer, argValues[0], count))
 				{
 					// This isn't a number. Let's try if it's a property. If it's no property default to 0 (property might have been optimized out).
-					mShaderProperties.getPropertyValue(StringId(argValues[0].c_str()), count);
+					mShaderProperties.getPropertyValue(::detail::getArgumentValueStringId(inBuffer, argValues[0]), count);
 				}
 
-				std::string counterVar;
+				const char* counterVar = nullptr;
+				size_t counterVarLength = 0;
 				if (argValues.size() > 1)
 				{
-					counterVar = argValues[1];
+					counterVar = ::detail::getArgumentValueString(inBuffer, argValues[1]);
+					counterVarLength = argValues[1].length;
 				}
 
 				int start = 0;
 				if (argValues.size() > 2)
 				{
-					start = strtol(argValues[2].c_str(), &endPtr, 10);
-					if (argValues[2].c_str() == endPtr)
+					if (!::detail::getArgumentValueInteger(inBuffer, argValues[2], start))
 					{
 						// This isn't a number. Let's try if it's a property.
-						if (!mShaderProperties.getPropertyValue(StringId(argValues[2].c_str()), start, -1))
+						if (!mShaderProperties.getPropertyValue(::detail::getArgumentValueStringId(inBuffer, argValues[2]), start, -1))
 						{
-							RHI_LOG(mContext, CRITICAL, "Renderer shader builder: Invalid parameter at line %lu (@foreach). '%s' is not a number nor a variable\n", static_cast<unsigned long>(calculateLineCount(blockSubString)), argValues[2].c_str())
+							RHI_LOG(mContext, CRITICAL, "Renderer shader builder: Invalid parameter at line %lu (@foreach). '%.*s' is not a number nor a variable\n", static_cast<unsigned long>(calculateLineCount(blockSubString)), ::detail::getArgumentValueLength(argValues[2]), ::detail::getArgumentValueString(inBuffer, argValues[2]))
 							syntaxError = true;
 							start = 0;
 							count = 0;
@@ -1112,7 +1173,7 @@ namespace Renderer
 
 				for (int i = start; i < count; ++i)
 				{
-					::detail::repeat(outBuffer, blockSubString, blockSubString.getSize(), static_cast<size_t>(i), counterVar);
+					::detail::repeat(outBuffer, blockSubString, blockSubString.getSize(), static_cast<size_t>(i), counterVar, counterVarLength);
 				}
 			}
 
@@ -1125,7 +1186,7 @@ namespace Renderer
 		return syntaxError;
 	}
 
-	bool ShaderBuilder::parseProperties(std::string& inBuffer, std::string& outBuffer) const
+	bool ShaderBuilder::parseProperties(std::string& inBuffer, std::string& outBuffer)
 	{
 		outBuffer.clear();
 		outBuffer.reserve(inBuffer.size());
@@ -1141,7 +1202,7 @@ namespace Renderer
 			copy(outBuffer, subString, pos);
 
 			subString.setStart(subString.getStart() + pos + sizeof("@property"));
-			const bool result = evaluateExpression(mContext, mShaderProperties, subString, syntaxError);
+			const bool result = evaluateExpression(mContext, mShaderProperties, subString, mExpressions, syntaxError);
 
 			::detail::SubStringRef blockSubString = subString;
 			const bool isElse = ::detail::findBlockEnd(mContext, blockSubString, syntaxError, true);
@@ -1186,7 +1247,7 @@ namespace Renderer
 		outBuffer.clear();
 		outBuffer.reserve(inBuffer.size());
 
-		::detail::StringVector argValues;
+		::detail::ArgumentValues& argValues = mArgumentValues;
 		::detail::SubStringRef subString(&inBuffer, 0);
 		size_t pos = subString.find("@piece");
 
@@ -1208,21 +1269,21 @@ namespace Renderer
 			}
 			else
 			{
-				const StringId pieceName(argValues[0].c_str());
-				DynamicShaderPieces::const_iterator it = mDynamicShaderPieces.find(pieceName);
-				if (it != mDynamicShaderPieces.end())
+				const uint32_t pieceName = ::detail::getArgumentValueStringId(inBuffer, argValues[0]);
+				DynamicShaderPieces::iterator it = std::lower_bound(mDynamicShaderPieces.begin(), mDynamicShaderPieces.end(), pieceName, [](const DynamicShaderPiece& dynamicShaderPiece, uint32_t pieceId) { return (dynamicShaderPiece.pieceId < pieceId); });
+				if (it != mDynamicShaderPieces.end() && it->pieceId == pieceName)
 				{
 					syntaxError = true;
-					RHI_LOG(mContext, CRITICAL, "Renderer shader builder: Error at line %lu: @piece '%s' already defined", static_cast<unsigned long>(calculateLineCount(subString)), argValues[0].c_str())
+					RHI_LOG(mContext, CRITICAL, "Renderer shader builder: Error at line %lu: @piece '%.*s' already defined", static_cast<unsigned long>(calculateLineCount(subString)), ::detail::getArgumentValueLength(argValues[0]), ::detail::getArgumentValueString(inBuffer, argValues[0]))
 				}
 				else
 				{
 					::detail::SubStringRef blockSubString = subString;
 					::detail::findBlockEnd(mContext, blockSubString, syntaxError);
 
-					std::string tempBuffer;
-					::detail::copy(tempBuffer, blockSubString, blockSubString.getSize());
-					mDynamicShaderPieces[pieceName] = tempBuffer;
+					// Append the piece source code to the dynamic shader pieces source code instead of allocating a string per piece
+					mDynamicShaderPieces.insert(it, { pieceName, mDynamicShaderPiecesSourceCode.size(), blockSubString.getSize() });
+					::detail::copy(mDynamicShaderPiecesSourceCode, blockSubString, blockSubString.getSize());
 
 					subString.setStart(blockSubString.getEnd() + sizeof("@end"));
 				}
@@ -1236,12 +1297,12 @@ namespace Renderer
 		return syntaxError;
 	}
 
-	bool ShaderBuilder::insertPieces(std::string& inBuffer, std::string& outBuffer) const
+	bool ShaderBuilder::insertPieces(std::string& inBuffer, std::string& outBuffer)
 	{
 		outBuffer.clear();
 		outBuffer.reserve(inBuffer.size());
 
-		::detail::StringVector argValues;
+		::detail::ArgumentValues& argValues = mArgumentValues;
 		::detail::SubStringRef subString(&inBuffer, 0);
 		size_t pos = subString.find("@insertpiece");
 
@@ -1263,15 +1324,15 @@ namespace Renderer
 			}
 			else
 			{
-				const StringId pieceName(argValues[0].c_str());
-				DynamicShaderPieces::const_iterator it = mDynamicShaderPieces.find(pieceName);
-				if (it != mDynamicShaderPieces.end())
+				const uint32_t pieceName = ::detail::getArgumentValueStringId(inBuffer, argValues[0]);
+				DynamicShaderPieces::const_iterator it = std::lower_bound(mDynamicShaderPieces.cbegin(), mDynamicShaderPieces.cend(), pieceName, [](const DynamicShaderPiece& dynamicShaderPiece, uint32_t pieceId) { return (dynamicShaderPiece.pieceId < pieceId); });
+				if (it != mDynamicShaderPieces.cend() && it->pieceId == pieceName)
 				{
-					outBuffer += it->second;
+					outBuffer.append(mDynamicShaderPiecesSourceCode, it->offset, it->length);
 				}
 				else
 				{
-					RHI_LOG(mContext, CRITICAL, "Renderer shader builder: Error at line %lu: @insertpiece is referencing unknown piece \"%s\"", static_cast<unsigned long>(calculateLineCount(subString)), argValues[0].c_str())
+					RHI_LOG(mContext, CRITICAL, "Renderer shader builder: Error at line %lu: @insertpiece is referencing unknown piece \"%.*s\"", static_cast<unsigned long>(calculateLineCount(subString)), ::detail::getArgumentValueLength(argValues[0]), ::detail::getArgumentValueString(inBuffer, argValues[0]))
 				}
 			}
 
@@ -1288,7 +1349,7 @@ namespace Renderer
 		outBuffer.clear();
 		outBuffer.reserve(inBuffer.size());
 
-		::detail::StringVector argValues;
+		::detail::ArgumentValues& argValues = mArgumentValues;
 		::detail::SubStringRef subString(&inBuffer, 0);
 
 		size_t pos = subString.find("@");
@@ -1354,7 +1415,7 @@ namespace Renderer
 
 				if (argValues.size() == 1)
 				{
-					dstProperty = StringId(argValues[0].c_str());
+					dstProperty = ::detail::getArgumentValueStringId(inBuffer, argValues[0]);
 					srcProperty = dstProperty;
 					mShaderProperties.getPropertyValue(srcProperty, op1Value);
 					op2Value = op1Value;
@@ -1373,20 +1434,18 @@ namespace Renderer
 				}
 				else
 				{
-					dstProperty = StringId(argValues[0].c_str());
+					dstProperty = ::detail::getArgumentValueStringId(inBuffer, argValues[0]);
 					size_t idx  = 1;
 					srcProperty = dstProperty;
 					if (argValues.size() == 3)
 					{
-						srcProperty = StringId(argValues[idx++].c_str());
+						srcProperty = ::detail::getArgumentValueStringId(inBuffer, argValues[idx++]);
 					}
 					mShaderProperties.getPropertyValue(srcProperty, op1Value);
-					char* endPtr = nullptr;
-					op2Value = strtol(argValues[idx].c_str(), &endPtr, 10);
-					if (argValues[idx].c_str() == endPtr)
+					if (!::detail::getArgumentValueInteger(inBuffer, argValues[idx], op2Value))
 					{
 						// Not a number, interpret as property
-						mShaderProperties.getPropertyValue(StringId(argValues[idx].c_str()), op2Value);
+						mShaderProperties.getPropertyValue(::detail::getArgumentValueStringId(inBuffer, argValues[idx]), op2Value);
 					}
 
 					const int result = ::detail::c_counterOperations[keyword].opFunc(op1Value, op2Value);
@@ -1423,7 +1482,7 @@ namespace Renderer
 		return syntaxError;
 	}
 
-	bool ShaderBuilder::parse(const std::string& inBuffer, std::string& outBuffer) const
+	bool ShaderBuilder::parse(const std::string& inBuffer, std::string& outBuffer)
 	{
 		outBuffer.clear();
 		outBuffer.reserve(inBuffer.size());
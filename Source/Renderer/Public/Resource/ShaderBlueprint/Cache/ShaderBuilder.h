@@ -40,8 +40,8 @@ PRAGMA_WARNING_PUSH
 	PRAGMA_WARNING_DISABLE_MSVC(4774)	// warning C4774: 'sprintf_s' : format string expected in argument 3 is not a string literal
 	PRAGMA_WARNING_DISABLE_MSVC(5026)	// warning C5026: 'std::_Generic_error_category': move constructor was implicitly defined as deleted
 	PRAGMA_WARNING_DISABLE_MSVC(5027)	// warning C5027: 'std::_Generic_error_category': move assignment operator was implicitly defined as deleted
-	#include <map>
 	#include <string>
+	#include <vector>
 PRAGMA_WARNING_POP
 
 
@@ -69,9 +69,8 @@ namespace Renderer
 	//[-------------------------------------------------------]
 	//[ Global definitions                                    ]
 	//[-------------------------------------------------------]
-	typedef StringId						AssetId;				///< Asset identifier, internally just a POD "uint32_t", string ID scheme is "<project name>/<asset directory>/<asset name>"
-	typedef std::vector<AssetId>			AssetIds;
-	typedef std::map<uint32_t, std::string> DynamicShaderPieces;	///< Key is "Renderer::StringId"	// TODO(co) Visual Studio 2017: "std::unordered_map" appears to have an inefficient assignment operator which does memory handling even if containers are empty all the time, "std::map" isn't the most effective structure either but currently still better
+	typedef StringId			 AssetId;	///< Asset identifier, internally just a POD "uint32_t", string ID scheme is "<project name>/<asset directory>/<asset name>"
+	typedef std::vector<AssetId> AssetIds;
 
 
 	//[-------------------------------------------------------]
@@ -83,6 +82,7 @@ namespace Renderer
 	*
 	*  @note
 	*   - Heavily basing on the OGRE 2.1 HLMS shader builder which is directly part of the OGRE class "Ogre::Hlms". So for syntax, have a look into the OGRE 2.1 documentation.
+	*   - A shader builder instance is meant to be reused for building multiple shaders, all internal working memory is kept between builds so that a warmed up shader builder doesn't perform heap allocations
 	*/
 	class ShaderBuilder final
 	{
@@ -100,6 +100,36 @@ namespace Renderer
 		};
 
 
+	//[-------------------------------------------------------]
+	//[ Public definitions                                    ]
+	//[-------------------------------------------------------]
+	public:
+		struct ArgumentValue final
+		{
+			size_t start  = 0;	///< Start of the argument value inside the parsed buffer
+			size_t length = 0;	///< Number of characters, 0 for an empty argument value
+		};
+		typedef std::vector<ArgumentValue> ArgumentValues;
+
+		struct Expression final
+		{
+			bool	 result		 = false;
+			bool	 negated	 = false;
+			uint8_t	 type		 = 0;	///< "::detail::ExpressionType"
+			int32_t	 parent		 = -1;	///< Index of the parent expression, -1 for the root expression
+			int32_t	 firstChild	 = -1;
+			int32_t	 lastChild	 = -1;
+			int32_t	 nextSibling = -1;
+			uint32_t valueHash	 = StringId::FNV1a_INITIAL_HASH_32;	///< FNV-1a hash of the value, identical to "Renderer::StringId" of the value string
+			uint32_t valueLength = 0;
+			char	 valueFirstCharacter = '\0';
+			char	 valueLastCharacter	 = '\0';
+			size_t	 valueStart	 = 0;	///< Only used for error logging
+			size_t	 valueEnd	 = 0;	///< Only used for error logging
+		};
+		typedef std::vector<Expression> Expressions;	///< Flat expression tree, first entry is the root expression
+
+
 	//[-------------------------------------------------------]
 	//[ Public methods                                        ]
 	//[-------------------------------------------------------]
@@ -136,7 +166,7 @@ namespace Renderer
 		*  @param[out] buildShader
 		*    Receives the build shader
 		*/
-		void createSourceCode(const ShaderPieceResourceManager& shaderPieceResourceManager, const ShaderBlueprintResource& shaderBlueprintResource, const ShaderProperties& shaderProperties, BuildShader& buildShader);
+		RENDERER_API_EXPORT void createSourceCode(const ShaderPieceResourceManager& shaderPieceResourceManager, const ShaderBlueprintResource& shaderBlueprintResource, const ShaderProperties& shaderProperties, BuildShader& buildShader);
 
 
 	//[-------------------------------------------------------]
@@ -146,12 +176,25 @@ namespace Renderer
 		explicit ShaderBuilder(const ShaderBuilder&) = delete;
 		ShaderBuilder& operator=(const ShaderBuilder&) = delete;
 		bool parseMath(const std::string& inBuffer, std::string& outBuffer);
-		bool parseForEach(const std::string& inBuffer, std::string& outBuffer) const;
-		bool parseProperties(std::string& inBuffer, std::string& outBuffer) const;
+		bool parseForEach(const std::string& inBuffer, std::string& outBuffer);
+		bool parseProperties(std::string& inBuffer, std::string& outBuffer);
 		bool collectPieces(const std::string& inBuffer, std::string& outBuffer);
-		bool insertPieces(std::string& inBuffer, std::string& outBuffer) const;
+		bool insertPieces(std::string& inBuffer, std::string& outBuffer);
 		bool parseCounter(const std::string& inBuffer, std::string& outBuffer);
-		bool parse(const std::string& inBuffer, std::string& outBuffer) const;
+		bool parse(const std::string& inBuffer, std::string& outBuffer);
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		struct DynamicShaderPiece final
+		{
+			uint32_t pieceId;	///< "Renderer::StringId" of the piece name
+			size_t	 offset;	///< Offset of the piece source code inside "mDynamicShaderPiecesSourceCode"
+			size_t	 length;	///< Length of the piece source code
+		};
+		typedef std::vector<DynamicShaderPiece> DynamicShaderPieces;	///< Sorted by piece ID
 
 
 	//[-------------------------------------------------------]
@@ -161,8 +204,11 @@ namespace Renderer
 		const Rhi::Context& mContext;
 		ShaderProperties	mShaderProperties;
 		DynamicShaderPieces	mDynamicShaderPieces;
-		std::string			mInString;	///< Could be a local variable, but when making it to a member we reduce memory allocations
-		std::string			mOutString;	///< Could be a local variable, but when making it to a member we reduce memory allocations
+		std::string			mDynamicShaderPiecesSourceCode;	///< Source code of all dynamic shader pieces, one after another, so there's no memory allocation per piece
+		std::string			mInString;						///< Could be a local variable, but when making it to a member we reduce memory allocations
+		std::string			mOutString;						///< Could be a local variable, but when making it to a member we reduce memory allocations
+		ArgumentValues		mArgumentValues;				///< Could be a local variable, but when making it to a member we reduce memory allocations
+		Expressions			mExpressions;					///< Could be a local variable, but when making it to a member we reduce memory allocations
 
 
 	};
@@ -34,6 +34,9 @@
 #include "Renderer/Public/Core/Math/Math.h"
 #include "Renderer/Public/IRenderer.h"
 
+#include <algorithm>
+#include <unordered_set>
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -77,7 +80,7 @@ namespace Renderer
 						{
 							case GraphicsShaderType::Vertex:
 							{
-								const Rhi::VertexAttributes& vertexAttributes = mShaderBlueprintResourceManager.getRenderer().getVertexAttributesResourceManager().getById(materialBlueprintResource.getVertexAttributesResourceId()).getVertexAttributes();
+								const Rhi::VertexAttributes& vertexAttributes = mShaderBlueprintResourceManager.getRenderer().getVertexAttributesResourceManager().getById(materialBlueprintResource.getVertexAttributesResourceId(graphicsPipelineStateSignature.getShaderProperties())).getVertexAttributes();
 								shaderCache->mShaderPtr = shaderLanguage.createVertexShaderFromBytecode(vertexAttributes, shaderCache->mShaderBytecode RHI_RESOURCE_DEBUG_NAME("From bytecode"));
 								break;
 							}
@@ -149,7 +152,7 @@ namespace Renderer
 							{
 								case GraphicsShaderType::Vertex:
 								{
-									const Rhi::VertexAttributes& vertexAttributes = mShaderBlueprintResourceManager.getRenderer().getVertexAttributesResourceManager().getById(materialBlueprintResource.getVertexAttributesResourceId()).getVertexAttributes();
+									const Rhi::VertexAttributes& vertexAttributes = mShaderBlueprintResourceManager.getRenderer().getVertexAttributesResourceManager().getById(materialBlueprintResource.getVertexAttributesResourceId(graphicsPipelineStateSignature.getShaderProperties())).getVertexAttributes();
 									shader = shaderLanguage.createVertexShaderFromSourceCode(vertexAttributes, sourceCode.c_str(), &shaderCache->mShaderBytecode RHI_RESOURCE_DEBUG_NAME(shaderBlueprintAsset.virtualFilename));
 									break;
 								}
@@ -179,6 +182,7 @@ namespace Renderer
 								shaderCache->mShaderPtr = shader;
 								mShaderCacheByShaderCacheId.emplace(shaderCacheId, shaderCache);
 								mShaderCacheByShaderSourceCodeId.emplace(shaderSourceCodeId, shaderCacheId);
+								registerMasterShaderCache(*shaderCache);
 								mCacheNeedsSaving = true;
 							}
 							else
@@ -283,6 +287,7 @@ namespace Renderer
 								shaderCache->mShaderPtr = shader;
 								mShaderCacheByShaderCacheId.emplace(shaderCacheId, shaderCache);
 								mShaderCacheByShaderSourceCodeId.emplace(shaderSourceCodeId, shaderCacheId);
+								registerMasterShaderCache(*shaderCache);
 								mCacheNeedsSaving = true;
 							}
 							else
@@ -307,6 +312,94 @@ namespace Renderer
 		return shaderCache;
 	}
 
+	uint32_t ShaderCacheManager::clearInfluencedCache(AssetId assetId, uint32_t& numberOfRetainedShaderCaches)
+	{
+		uint32_t numberOfClearedShaderCaches = 0;
+		std::unique_lock<std::mutex> mutexLock(mMutex);
+		MasterShaderCacheIdsByAssetId::iterator iterator = mMasterShaderCacheIdsByAssetId.find(assetId);
+		if (iterator != mMasterShaderCacheIdsByAssetId.end())
+		{
+			// Gather the influenced master shader caches and remove them from the reverse dependency index entries of all assets which took part in their creation
+			const ShaderCacheIds influencedMasterShaderCacheIds = std::move(iterator->second);
+			mMasterShaderCacheIdsByAssetId.erase(iterator);
+			std::unordered_set<ShaderCacheId> clearedMasterShaderCacheIds;
+			for (ShaderCacheId masterShaderCacheId : influencedMasterShaderCacheIds)
+			{
+				ShaderCacheByShaderCacheId::const_iterator shaderCacheIterator = mShaderCacheByShaderCacheId.find(masterShaderCacheId);
+				if (shaderCacheIterator != mShaderCacheByShaderCacheId.cend() && clearedMasterShaderCacheIds.insert(masterShaderCacheId).second)
+				{
+					for (AssetId otherAssetId : shaderCacheIterator->second->mAssetIds)
+					{
+						iterator = mMasterShaderCacheIdsByAssetId.find(otherAssetId);
+						if (iterator != mMasterShaderCacheIdsByAssetId.end())
+						{
+							ShaderCacheIds& shaderCacheIds = iterator->second;
+							shaderCacheIds.erase(std::remove(shaderCacheIds.begin(), shaderCacheIds.end(), masterShaderCacheId), shaderCacheIds.end());
+							if (shaderCacheIds.empty())
+							{
+								mMasterShaderCacheIdsByAssetId.erase(iterator);
+							}
+						}
+					}
+				}
+			}
+
+			// Destroy the slave shader caches of the influenced master shader caches, the master shader caches are destroyed last since the slave shader caches are pointing to them
+			std::vector<ShaderCache*> clearedMasterShaderCaches;
+			clearedMasterShaderCaches.reserve(clearedMasterShaderCacheIds.size());
+			ShaderCacheByShaderCacheId::iterator shaderCacheIterator = mShaderCacheByShaderCacheId.begin();
+			while (shaderCacheIterator != mShaderCacheByShaderCacheId.end())
+			{
+				ShaderCache* shaderCache = shaderCacheIterator->second;
+				if (nullptr == shaderCache->mMasterShaderCache)
+				{
+					if (clearedMasterShaderCacheIds.find(shaderCache->mShaderCacheId) != clearedMasterShaderCacheIds.cend())
+					{
+						clearedMasterShaderCaches.push_back(shaderCache);
+						shaderCacheIterator = mShaderCacheByShaderCacheId.erase(shaderCacheIterator);
+						continue;
+					}
+				}
+				else if (clearedMasterShaderCacheIds.find(shaderCache->mMasterShaderCache->mShaderCacheId) != clearedMasterShaderCacheIds.cend())
+				{
+					delete shaderCache;
+					++numberOfClearedShaderCaches;
+					shaderCacheIterator = mShaderCacheByShaderCacheId.erase(shaderCacheIterator);
+					continue;
+				}
+				++shaderCacheIterator;
+			}
+			for (ShaderCache* shaderCache : clearedMasterShaderCaches)
+			{
+				delete shaderCache;
+			}
+			numberOfClearedShaderCaches += static_cast<uint32_t>(clearedMasterShaderCaches.size());
+
+			// The shader source code of the influenced master shader caches is going to change, so the shader source code ID to shader cache ID mapping entries are no longer of use
+			ShaderCacheByShaderSourceCodeId::iterator shaderSourceCodeIdIterator = mShaderCacheByShaderSourceCodeId.begin();
+			while (shaderSourceCodeIdIterator != mShaderCacheByShaderSourceCodeId.end())
+			{
+				if (clearedMasterShaderCacheIds.find(shaderSourceCodeIdIterator->second) != clearedMasterShaderCacheIds.cend())
+				{
+					shaderSourceCodeIdIterator = mShaderCacheByShaderSourceCodeId.erase(shaderSourceCodeIdIterator);
+				}
+				else
+				{
+					++shaderSourceCodeIdIterator;
+				}
+			}
+			mCacheNeedsSaving = true;
+		}
+
+		// Done
+		numberOfRetainedShaderCaches = static_cast<uint32_t>(mShaderCacheByShaderCacheId.size());
+		return numberOfClearedShaderCaches;
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
 	void ShaderCacheManager::clearCache()
 	{
 		std::unique_lock<std::mutex> mutexLock(mMutex);
@@ -318,6 +411,7 @@ namespace Renderer
 			}
 			mShaderCacheByShaderCacheId.clear();
 			mShaderCacheByShaderSourceCodeId.clear();
+			mMasterShaderCacheIdsByAssetId.clear();
 			mCacheNeedsSaving = true;
 		}
 	}
@@ -423,6 +517,10 @@ namespace Renderer
 				if (nullptr != shaderCache)
 				{
 					mShaderCacheByShaderCacheId.emplace(shaderCache->mShaderCacheId, shaderCache);
+					if (nullptr == shaderCache->mMasterShaderCache)
+					{
+						registerMasterShaderCache(*shaderCache);
+					}
 				}
 			}
 		}
@@ -511,6 +609,15 @@ namespace Renderer
 		mCacheNeedsSaving = false;
 	}
 
+	void ShaderCacheManager::registerMasterShaderCache(const ShaderCache& shaderCache)
+	{
+		// Add the master shader cache to the reverse dependency index so a changed asset only clears the shader caches it took part in the creation of
+		for (AssetId assetId : shaderCache.mAssetIds)
+		{
+			mMasterShaderCacheIdsByAssetId[assetId].push_back(shaderCache.mShaderCacheId);
+		}
+	}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
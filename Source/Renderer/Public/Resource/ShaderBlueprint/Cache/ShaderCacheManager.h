@@ -28,6 +28,7 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "Renderer/Public/Core/Manager.h"
+#include "Renderer/Public/Core/StringId.h"
 #include "Renderer/Public/Resource/ShaderBlueprint/GraphicsShaderType.h"
 
 // Disable warnings in external headers, we can't fix them
@@ -39,6 +40,7 @@ PRAGMA_WARNING_PUSH
 	PRAGMA_WARNING_DISABLE_MSVC(5039)	// warning C5039: '_Thrd_start': pointer or reference to potentially throwing function passed to extern C function under -EHc. Undefined behavior may occur if this function throws an exception.
 	#include <mutex>
 	#include <unordered_map>
+	#include <vector>
 PRAGMA_WARNING_POP
 
 
@@ -70,6 +72,7 @@ namespace Renderer
 	//[-------------------------------------------------------]
 	//[ Global definitions                                    ]
 	//[-------------------------------------------------------]
+	typedef StringId AssetId;				///< Asset identifier, internally just a POD "uint32_t", string ID scheme is "<project name>/<asset directory>/<asset name>"
 	typedef uint32_t ShaderCacheId;			///< Shader cache identifier, often but not always identical to the shader combination ID
 	typedef uint32_t ShaderSourceCodeId;	///< Shader source code identifier, result of hashing the build shader source code
 
@@ -146,6 +149,23 @@ namespace Renderer
 		*/
 		[[nodiscard]] ShaderCache* getComputeShaderCache(const ComputePipelineStateSignature& computePipelineStateSignature, const MaterialBlueprintResource& materialBlueprintResource, Rhi::IShaderLanguage& shaderLanguage);
 
+		/**
+		*  @brief
+		*    Clear the shader caches which the given asset took part in the creation of
+		*
+		*  @param[in] assetId
+		*    ID of the changed asset (shader blueprint, shader piece)
+		*  @param[out] numberOfRetainedShaderCaches
+		*    Receives the number of shader caches which are still there
+		*
+		*  @return
+		*    The number of cleared shader caches, slave shader caches of cleared master shader caches included
+		*
+		*  @note
+		*    - Used for hot-reloading, shader caches which don't depend on the asset stay untouched and don't need to be compiled again
+		*/
+		uint32_t clearInfluencedCache(AssetId assetId, uint32_t& numberOfRetainedShaderCaches);
+
 
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
@@ -165,10 +185,7 @@ namespace Renderer
 
 		explicit ShaderCacheManager(const ShaderCacheManager&) = delete;
 		ShaderCacheManager& operator=(const ShaderCacheManager&) = delete;
-		// TODO(co) Make this private. See "TODO(co) Do only clear the influenced shader cache entries" for context.
-	public:
 		void clearCache();
-	private:
 		void loadCache(IFile& file);
 
 		[[nodiscard]] inline bool doesCacheNeedSaving() const
@@ -177,6 +194,7 @@ namespace Renderer
 		}
 
 		void saveCache(IFile& file);
+		void registerMasterShaderCache(const ShaderCache& shaderCache);
 
 
 	//[-------------------------------------------------------]
@@ -185,6 +203,8 @@ namespace Renderer
 	private:
 		typedef std::unordered_map<ShaderCacheId, ShaderCache*>		  ShaderCacheByShaderCacheId;
 		typedef std::unordered_map<ShaderSourceCodeId, ShaderCacheId> ShaderCacheByShaderSourceCodeId;
+		typedef std::vector<ShaderCacheId>							  ShaderCacheIds;
+		typedef std::unordered_map<uint32_t, ShaderCacheIds>		  MasterShaderCacheIdsByAssetId;	///< Key = POD asset ID
 
 
 	//[-------------------------------------------------------]
@@ -194,6 +214,7 @@ namespace Renderer
 		ShaderBlueprintResourceManager& mShaderBlueprintResourceManager;	///< Owner shader blueprint resource manager
 		ShaderCacheByShaderCacheId		mShaderCacheByShaderCacheId;		///< Manages the shader cache instances
 		ShaderCacheByShaderSourceCodeId	mShaderCacheByShaderSourceCodeId;	///< Shader source code ID to shader cache ID mapping
+		MasterShaderCacheIdsByAssetId	mMasterShaderCacheIdsByAssetId;		///< Reverse dependency index, asset (shader blueprint, shader piece) ID to the IDs of the master shader caches it took part in the creation of
 		bool							mCacheNeedsSaving;					///< "true" if a cache needs saving due to changes during runtime, else "false"
 		std::mutex						mMutex;								///< Mutex due to "Renderer::GraphicsPipelineStateCompiler" and "Renderer::ComputePipelineStateCompiler" interaction, no too fine granular lock/unlock required because usually it's only asynchronous or synchronous processing, not both at one and the same time
 
@@ -170,8 +170,10 @@ namespace Renderer
 				++const_cast<MaterialProperties&>(materialBlueprintResource->getMaterialProperties()).mShaderCombinationGenerationCounter;
 			}
 
-			// TODO(co) Do only clear the influenced shader cache entries
-			mRenderer.getShaderBlueprintResourceManager().getShaderCacheManager().clearCache();
+			// Only clear the shader cache entries the reloaded asset took part in the creation of, all other shader cache entries can be reused without compiling them again
+			uint32_t numberOfRetainedShaderCaches = 0;
+			const uint32_t numberOfClearedShaderCaches = mRenderer.getShaderBlueprintResourceManager().getShaderCacheManager().clearInfluencedCache(mShaderBlueprintResource->getAssetId(), numberOfRetainedShaderCaches);
+			RHI_LOG(mRenderer.getContext(), INFORMATION, "Renderer hot-reload of \"%s\": Invalidated %u shader caches and the pipeline state caches of %u material blueprints, retained %u shader caches and the pipeline state caches of %u material blueprints", getAsset().virtualFilename, numberOfClearedShaderCaches, static_cast<uint32_t>(materialBlueprintResourcePointers.size()), numberOfRetainedShaderCaches, numberOfElements - static_cast<uint32_t>(materialBlueprintResourcePointers.size()))
 		}
 
 		// Fully loaded?
@@ -27,6 +27,8 @@
 #include "Renderer/Public/Resource/SkeletonAnimation/Loader/SkeletonAnimationResourceLoader.h"
 #include "Renderer/Public/Resource/ResourceManagerTemplate.h"
 #include "Renderer/Public/Core/Time/TimeManager.h"
+#include "Renderer/Public/Core/IProfiler.h"
+#include "Renderer/Public/IRenderer.h"
 
 
 //[-------------------------------------------------------]
@@ -98,6 +100,7 @@ namespace Renderer
 	void SkeletonAnimationResourceManager::update()
 	{
 		// Update skeleton animation controllers
+		RENDERER_PROFILER_SCOPED_CPU_SAMPLE(mInternalResourceManager->getRenderer().getContext(), "Skeleton animation")
 		const float pastSecondsSinceLastFrame = mInternalResourceManager->getRenderer().getTimeManager().getPastSecondsSinceLastFrame();
 		for (SkeletonAnimationController* skeletonAnimationController : mSkeletonAnimationControllers)
 		{
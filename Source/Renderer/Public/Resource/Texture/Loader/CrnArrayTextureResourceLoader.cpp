@@ -23,7 +23,6 @@
 //[-------------------------------------------------------]
 #include "Renderer/Public/Resource/Texture/Loader/CrnArrayTextureResourceLoader.h"
 #include "Renderer/Public/Resource/Texture/Loader/CrnArrayFileFormat.h"
-#include "Renderer/Public/Resource/Texture/TextureResourceManager.h"
 #include "Renderer/Public/Resource/Texture/TextureResource.h"
 #include "Renderer/Public/Core/File/IFile.h"
 #include "Renderer/Public/IRenderer.h"
@@ -199,9 +198,9 @@ namespace Renderer
 			return;
 		}
 
-		// Handle optional top mipmap removal
+		// Handle optional top mipmap removal (global texture quality reduction as well as texture streaming)
 		// TODO(co) Possible optimization of optional top mipmap removal: Don't load in the skipped mipmaps into memory in the first place ("mFileData")
-		int startLevelIndex = mRenderer.getTextureResourceManager().getNumberOfTopMipmapsToRemove();
+		int startLevelIndex = mNumberOfTopMipmapsToRemove;
 		if (startLevelIndex >= static_cast<int>(numberOfLevels))
 		{
 			startLevelIndex = static_cast<int>(numberOfLevels) - 1;
@@ -312,6 +311,13 @@ namespace Renderer
 			crnd::crnd_unpack_end(crndUnpackContext);
 		}
 
+		// Texture streaming information
+		mOriginalWidth			   = mWidth;
+		mOriginalHeight			   = mHeight;
+		mOriginalNumberOfMipmaps   = static_cast<uint8_t>(numberOfLevels);
+		mNumberOfRemovedTopMipmaps = static_cast<uint8_t>(startLevelIndex);
+		mNumberOfTextureDataBytes  = mNumberOfUsedImageDataBytes;
+
 		// In case we removed top level mipmaps, we need to update the texture dimension
 		if (0 != startLevelIndex)
 		{
@@ -22,7 +22,6 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "Renderer/Public/Resource/Texture/Loader/CrnTextureResourceLoader.h"
-#include "Renderer/Public/Resource/Texture/TextureResourceManager.h"
 #include "Renderer/Public/Resource/Texture/TextureResource.h"
 #include "Renderer/Public/Core/File/IFile.h"
 #include "Renderer/Public/IRenderer.h"
@@ -185,9 +184,9 @@ namespace Renderer
 			return;
 		}
 
-		// Handle optional top mipmap removal
+		// Handle optional top mipmap removal (global texture quality reduction as well as texture streaming)
 		// TODO(co) Possible optimization of optional top mipmap removal: Don't load in the skipped mipmaps into memory in the first place ("mFileData")
-		int startLevelIndex = mRenderer.getTextureResourceManager().getNumberOfTopMipmapsToRemove();
+		int startLevelIndex = mNumberOfTopMipmapsToRemove;
 		if (startLevelIndex >= static_cast<int>(crnTextureInfo.m_levels))
 		{
 			startLevelIndex = static_cast<int>(crnTextureInfo.m_levels) - 1;
@@ -268,6 +267,13 @@ namespace Renderer
 		// Free allocated memory
 		crnd::crnd_unpack_end(crndUnpackContext);
 
+		// Texture streaming information
+		mOriginalWidth			   = mWidth;
+		mOriginalHeight			   = mHeight;
+		mOriginalNumberOfMipmaps   = static_cast<uint8_t>(crnTextureInfo.m_levels);
+		mNumberOfRemovedTopMipmaps = static_cast<uint8_t>(startLevelIndex);
+		mNumberOfTextureDataBytes  = mNumberOfUsedImageDataBytes;
+
 		// In case we removed top level mipmaps, we need to update the texture dimension
 		if (0 != startLevelIndex)
 		{
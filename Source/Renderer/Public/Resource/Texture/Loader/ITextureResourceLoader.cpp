@@ -23,6 +23,7 @@
 //[-------------------------------------------------------]
 #include "Renderer/Public/Resource/Texture/Loader/ITextureResourceLoader.h"
 #include "Renderer/Public/Resource/Texture/TextureResource.h"
+#include "Renderer/Public/Resource/Texture/TextureResourceManager.h"
 #include "Renderer/Public/IRenderer.h"
 
 
@@ -40,6 +41,17 @@ namespace Renderer
 	{
 		IResourceLoader::initialize(asset, reload);
 		mTextureResource = static_cast<TextureResource*>(&resource);
+
+		// The global texture quality reduction is the lower limit for the texture streaming request
+		// -> The requested number of top mipmaps to remove isn't changed by the texture resource manager while the texture resource is in-flight inside the resource streamer
+		mNumberOfTopMipmapsToRemove = std::max(mRenderer.getTextureResourceManager().getNumberOfTopMipmapsToRemove(), mTextureResource->mRequestedNumberOfTopMipmapsToRemove);
+
+		// Reset the texture streaming information, resource loader instances are reused
+		mOriginalWidth			   = 0;
+		mOriginalHeight			   = 0;
+		mOriginalNumberOfMipmaps   = 0;
+		mNumberOfRemovedTopMipmaps = 0;
+		mNumberOfTextureDataBytes  = 0;
 	}
 
 	bool ITextureResourceLoader::onDispatch()
@@ -47,6 +59,13 @@ namespace Renderer
 		// Create the RHI texture instance
 		mTextureResource->mTexture = (mRenderer.getRhi().getCapabilities().nativeMultithreading ? mTexture : createRhiTexture());
 
+		// Pass on the texture streaming information
+		mTextureResource->mWidth							 = mOriginalWidth;
+		mTextureResource->mHeight							 = mOriginalHeight;
+		mTextureResource->mNumberOfMipmaps					 = mOriginalNumberOfMipmaps;
+		mTextureResource->mNumberOfResidentTopMipmapsRemoved = mNumberOfRemovedTopMipmaps;
+		mTextureResource->mNumberOfResidentBytes			 = mNumberOfTextureDataBytes;
+
 		// Fully loaded
 		return true;
 	}
@@ -110,7 +110,13 @@ namespace Renderer
 			IResourceLoader(resourceManager),
 			mRenderer(renderer),
 			mTextureResource(nullptr),
-			mTexture(nullptr)
+			mTexture(nullptr),
+			mNumberOfTopMipmapsToRemove(0),
+			mOriginalWidth(0),
+			mOriginalHeight(0),
+			mOriginalNumberOfMipmaps(0),
+			mNumberOfRemovedTopMipmaps(0),
+			mNumberOfTextureDataBytes(0)
 		{
 			// Nothing here
 		}
@@ -128,9 +134,16 @@ namespace Renderer
 	//[ Protected data                                        ]
 	//[-------------------------------------------------------]
 	protected:
-		IRenderer&		 mRenderer;			///< Renderer instance, do not destroy the instance
-		TextureResource* mTextureResource;	///< Destination resource
-		Rhi::ITexture*	 mTexture;			///< In case the used RHI implementation supports native multithreading we also create the RHI resource asynchronous, but the final resource pointer reassignment must still happen synchronous
+		IRenderer&		 mRenderer;						///< Renderer instance, do not destroy the instance
+		TextureResource* mTextureResource;				///< Destination resource
+		Rhi::ITexture*	 mTexture;						///< In case the used RHI implementation supports native multithreading we also create the RHI resource asynchronous, but the final resource pointer reassignment must still happen synchronous
+		uint8_t			 mNumberOfTopMipmapsToRemove;	///< Number of top mipmaps to remove, set inside "Renderer::ITextureResourceLoader::initialize()" from the global texture quality reduction and the texture streaming request
+		// Texture streaming information, filled by texture resource loaders supporting top mipmap removal and passed on to the texture resource inside "Renderer::ITextureResourceLoader::onDispatch()"
+		uint32_t		 mOriginalWidth;				///< Width of the top mipmap of the complete texture, 0 if unknown
+		uint32_t		 mOriginalHeight;				///< Height of the top mipmap of the complete texture, 0 if unknown
+		uint8_t			 mOriginalNumberOfMipmaps;		///< Number of mipmaps of the complete texture, 0 if unknown
+		uint8_t			 mNumberOfRemovedTopMipmaps;	///< Number of top mipmaps which were actually removed
+		uint32_t		 mNumberOfTextureDataBytes;		///< Number of bytes of the texture data passed to the RHI, 0 if unknown
 
 
 	};
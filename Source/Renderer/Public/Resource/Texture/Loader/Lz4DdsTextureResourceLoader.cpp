@@ -132,7 +132,7 @@ namespace Renderer
 		mMemoryFile.decompress();
 
 		// TODO(co) Cleanup and complete, currently just a prototype
-		// TODO(co) Add optional top mipmap removal support (see "Renderer::TextureResourceManager::NumberOfTopMipmapsToRemove")
+		// TODO(co) Add optional top mipmap removal support for texture types other than 2D textures
 
 		#define MCHAR4(a, b, c, d) (a | (b << 8) | (c << 16) | (d << 24))
 
@@ -517,7 +517,74 @@ namespace Renderer
 				}
 			}
 
-			{ // Loop through all faces
+			// Handle optional top mipmap removal (global texture quality reduction as well as texture streaming)
+			// -> Currently only supported for 2D textures with mipmaps, other texture types are always loaded completely
+			if (1 == numberOfFaces && 1 == mNumberOfSlices && 1 == mDepth && numberOfMipmaps > 1 && mWidth > 1 && mHeight > 1)
+			{
+				const Rhi::TextureFormat::Enum textureFormat = static_cast<Rhi::TextureFormat::Enum>(mTextureFormat);
+				uint32_t startLevelIndex = std::min(static_cast<uint32_t>(mNumberOfTopMipmapsToRemove), numberOfMipmaps - 1);
+
+				// Optional top mipmap removal security checks
+				// -> Ensure we don't go below 4x4 to not get into troubles with 4x4 blocked based compression
+				// -> Ensure the base mipmap we tell the RHI about is a multiple of four. Even if the original base mipmap is a multiple of four, one of the lower mipmaps might not be.
+				if (Rhi::TextureFormat::isCompressed(textureFormat))
+				{
+					while (startLevelIndex > 0 && (std::max(1U, mWidth >> startLevelIndex) < 4 || std::max(1U, mHeight >> startLevelIndex) < 4))
+					{
+						--startLevelIndex;
+					}
+					while (startLevelIndex > 0 && (0 != (std::max(1U, mWidth >> startLevelIndex) % 4) || (0 != std::max(1U, mHeight >> startLevelIndex) % 4)))
+					{
+						--startLevelIndex;
+					}
+				}
+
+				// Gather the number of bytes of the skipped top mipmaps and of the mipmaps we're going to use
+				uint32_t numberOfSkippedImageDataBytes = 0;
+				mNumberOfUsedImageDataBytes = 0;
+				for (uint32_t levelIndex = 0; levelIndex < numberOfMipmaps; ++levelIndex)
+				{
+					const uint32_t numberOfBytesPerSlice = Rhi::TextureFormat::getNumberOfBytesPerSlice(textureFormat, std::max(1U, mWidth >> levelIndex), std::max(1U, mHeight >> levelIndex));
+					if (levelIndex < startLevelIndex)
+					{
+						numberOfSkippedImageDataBytes += numberOfBytesPerSlice;
+					}
+					else
+					{
+						mNumberOfUsedImageDataBytes += numberOfBytesPerSlice;
+					}
+				}
+				if (mNumberOfImageDataBytes < mNumberOfUsedImageDataBytes)
+				{
+					mNumberOfImageDataBytes = mNumberOfUsedImageDataBytes;
+					delete [] mImageData;
+					mImageData = new uint8_t[mNumberOfImageDataBytes];
+				}
+
+				// Skip the removed top mipmaps and read in the rest of the compressed data
+				if (0 != numberOfSkippedImageDataBytes)
+				{
+					mMemoryFile.skip(numberOfSkippedImageDataBytes);
+				}
+				mMemoryFile.read(mImageData, mNumberOfUsedImageDataBytes);
+
+				// Texture streaming information
+				mOriginalWidth			   = mWidth;
+				mOriginalHeight			   = mHeight;
+				mOriginalNumberOfMipmaps   = static_cast<uint8_t>(numberOfMipmaps);
+				mNumberOfRemovedTopMipmaps = static_cast<uint8_t>(startLevelIndex);
+				mNumberOfTextureDataBytes  = mNumberOfUsedImageDataBytes;
+
+				// In case we removed top level mipmaps, we need to update the texture dimension
+				if (0 != startLevelIndex)
+				{
+					mWidth = std::max(1U, mWidth >> startLevelIndex);
+					mHeight = std::max(1U, mHeight >> startLevelIndex);
+				}
+			}
+			else
+			{
+				// Loop through all faces
 				uint32_t width = mWidth;
 				uint32_t height = mHeight;
 				uint32_t depth = mDepth;
@@ -100,13 +100,93 @@ namespace Renderer
 			setLoadingState(LoadingState::LOADED);
 		}
 
+		//[-------------------------------------------------------]
+		//[ Texture streaming                                     ]
+		//[-------------------------------------------------------]
+		/**
+		*  @brief
+		*    Return the width of the top mipmap of the complete texture, not taking removed top mipmaps into account
+		*
+		*  @return
+		*    The width of the top mipmap of the complete texture, 0 if unknown (e.g. texture resources created during runtime)
+		*/
+		[[nodiscard]] inline uint32_t getWidth() const
+		{
+			return mWidth;
+		}
+
+		/**
+		*  @brief
+		*    Return the height of the top mipmap of the complete texture, not taking removed top mipmaps into account
+		*
+		*  @return
+		*    The height of the top mipmap of the complete texture, 0 if unknown (e.g. texture resources created during runtime)
+		*/
+		[[nodiscard]] inline uint32_t getHeight() const
+		{
+			return mHeight;
+		}
+
+		/**
+		*  @brief
+		*    Return the number of mipmaps of the complete texture
+		*
+		*  @return
+		*    The number of mipmaps of the complete texture, 0 if unknown, texture streaming is only performed for textures with more than one mipmap
+		*/
+		[[nodiscard]] inline uint8_t getNumberOfMipmaps() const
+		{
+			return mNumberOfMipmaps;
+		}
+
+		/**
+		*  @brief
+		*    Return the number of top mipmaps which were removed while loading the currently resident RHI texture
+		*/
+		[[nodiscard]] inline uint8_t getNumberOfResidentTopMipmapsRemoved() const
+		{
+			return mNumberOfResidentTopMipmapsRemoved;
+		}
+
+		/**
+		*  @brief
+		*    Return the number of top mipmaps the texture streaming requested to remove
+		*
+		*  @note
+		*    - The texture resource loader is free to remove less top mipmaps, e.g. to keep block compressed textures at least 4x4
+		*/
+		[[nodiscard]] inline uint8_t getRequestedNumberOfTopMipmapsToRemove() const
+		{
+			return mRequestedNumberOfTopMipmapsToRemove;
+		}
+
+		/**
+		*  @brief
+		*    Return the number of bytes the currently resident RHI texture data is using
+		*
+		*  @return
+		*    The number of bytes the currently resident RHI texture data is using, 0 if unknown (e.g. texture resources created during runtime)
+		*/
+		[[nodiscard]] inline uint32_t getNumberOfResidentBytes() const
+		{
+			return mNumberOfResidentBytes;
+		}
+
 
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
 	//[-------------------------------------------------------]
 	private:
 		inline TextureResource() :
-			mRgbHardwareGammaCorrection(false)
+			mRgbHardwareGammaCorrection(false),
+			mWidth(0),
+			mHeight(0),
+			mNumberOfMipmaps(0),
+			mNumberOfResidentTopMipmapsRemoved(0),
+			mRequestedNumberOfTopMipmapsToRemove(0),
+			mNumberOfResidentBytes(0),
+			mMaximumScreenSpaceSize(0.0f),
+			mStreamingFeedbackReceived(false)
 		{
 			// Nothing here
 		}
@@ -126,8 +206,16 @@ namespace Renderer
 			IResource::operator=(std::move(textureResource));
 
 			// Swap data
-			std::swap(mRgbHardwareGammaCorrection, textureResource.mRgbHardwareGammaCorrection);
-			std::swap(mTexture,					   textureResource.mTexture);
+			std::swap(mRgbHardwareGammaCorrection,			textureResource.mRgbHardwareGammaCorrection);
+			std::swap(mTexture,								textureResource.mTexture);
+			std::swap(mWidth,								textureResource.mWidth);
+			std::swap(mHeight,								textureResource.mHeight);
+			std::swap(mNumberOfMipmaps,						textureResource.mNumberOfMipmaps);
+			std::swap(mNumberOfResidentTopMipmapsRemoved,	textureResource.mNumberOfResidentTopMipmapsRemoved);
+			std::swap(mRequestedNumberOfTopMipmapsToRemove,	textureResource.mRequestedNumberOfTopMipmapsToRemove);
+			std::swap(mNumberOfResidentBytes,				textureResource.mNumberOfResidentBytes);
+			std::swap(mMaximumScreenSpaceSize,				textureResource.mMaximumScreenSpaceSize);
+			std::swap(mStreamingFeedbackReceived,			textureResource.mStreamingFeedbackReceived);
 
 			// Done
 			return *this;
@@ -149,6 +237,14 @@ namespace Renderer
 		{
 			// Reset everything
 			mTexture = nullptr;
+			mWidth = 0;
+			mHeight = 0;
+			mNumberOfMipmaps = 0;
+			mNumberOfResidentTopMipmapsRemoved = 0;
+			mRequestedNumberOfTopMipmapsToRemove = 0;
+			mNumberOfResidentBytes = 0;
+			mMaximumScreenSpaceSize = 0.0f;
+			mStreamingFeedbackReceived = false;
 
 			// Call base implementation
 			IResource::deinitializeElement();
@@ -159,8 +255,17 @@ namespace Renderer
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
-		bool			 mRgbHardwareGammaCorrection;	///< If true, sRGB texture formats will be used meaning the GPU will return linear space colors instead of gamma space colors when fetching texels inside a shader (the alpha channel always remains linear)
-		Rhi::ITexturePtr mTexture;						///< RHI texture, can be a null pointer
+		bool			 mRgbHardwareGammaCorrection;			///< If true, sRGB texture formats will be used meaning the GPU will return linear space colors instead of gamma space colors when fetching texels inside a shader (the alpha channel always remains linear)
+		Rhi::ITexturePtr mTexture;								///< RHI texture, can be a null pointer
+		// Texture streaming, see "Renderer::TextureResourceManager::update()"
+		uint32_t		 mWidth;								///< Width of the top mipmap of the complete texture, 0 if unknown
+		uint32_t		 mHeight;								///< Height of the top mipmap of the complete texture, 0 if unknown
+		uint8_t			 mNumberOfMipmaps;						///< Number of mipmaps of the complete texture, 0 if unknown
+		uint8_t			 mNumberOfResidentTopMipmapsRemoved;	///< Number of top mipmaps which were removed while loading the currently resident RHI texture
+		uint8_t			 mRequestedNumberOfTopMipmapsToRemove;	///< Number of top mipmaps the texture streaming requested to remove, read by the texture resource loader, don't change it while the texture resource is in-flight inside the resource streamer
+		uint32_t		 mNumberOfResidentBytes;				///< Number of bytes the currently resident RHI texture data is using, 0 if unknown
+		float			 mMaximumScreenSpaceSize;				///< Maximum on-screen size in pixels of visible geometry using this texture since the last texture streaming update, 0 if not visible
+		bool			 mStreamingFeedbackReceived;			///< "true" if visible geometry using this texture has been seen at least once, else "false" (textures never used by scene renderables, e.g. compositor or GUI textures, are kept at full resolution)
 
 
 	};
@@ -123,6 +123,27 @@ namespace
 			#undef CREATE_TEXTURE
 		}
 
+		[[nodiscard]] uint8_t calculateTextureStreamingNumberOfTopMipmapsToRemove(const Renderer::TextureResource& textureResource, float screenSpaceSize)
+		{
+			// Remove top mipmaps as long as the remaining top mipmap still covers the on-screen size
+			// -> Assumes the texture is mapped once over the geometry, which is a sufficient heuristic for deciding about the mipmaps to stream in
+			const uint32_t textureSize = std::max(textureResource.getWidth(), textureResource.getHeight());
+			uint8_t numberOfTopMipmapsToRemove = 0;
+			while (numberOfTopMipmapsToRemove + 1 < textureResource.getNumberOfMipmaps() && static_cast<float>(textureSize >> (numberOfTopMipmapsToRemove + 1)) >= screenSpaceSize)
+			{
+				++numberOfTopMipmapsToRemove;
+			}
+			return numberOfTopMipmapsToRemove;
+		}
+
+		[[nodiscard]] uint64_t estimateTextureStreamingNumberOfBytes(const Renderer::TextureResource& textureResource, uint8_t numberOfTopMipmapsToRemove)
+		{
+			// Each top mipmap roughly quadruples the number of bytes of a texture including its mipmap chain
+			const int shift = (static_cast<int>(textureResource.getNumberOfResidentTopMipmapsRemoved()) - static_cast<int>(numberOfTopMipmapsToRemove)) * 2;
+			const uint64_t numberOfResidentBytes = textureResource.getNumberOfResidentBytes();
+			return (shift >= 0) ? (numberOfResidentBytes << shift) : (numberOfResidentBytes >> -shift);
+		}
+
 
 //[-------------------------------------------------------]
 //[ Anonymous detail namespace                            ]
@@ -172,6 +193,19 @@ namespace Renderer
 	//[-------------------------------------------------------]
 	//[ Public methods                                        ]
 	//[-------------------------------------------------------]
+	void TextureResourceManager::setTextureStreamingFeedback(TextureResourceId textureResourceId, float screenSpaceSize) const
+	{
+		TextureResource* textureResource = tryGetById(textureResourceId);
+		if (nullptr != textureResource)
+		{
+			if (textureResource->mMaximumScreenSpaceSize < screenSpaceSize)
+			{
+				textureResource->mMaximumScreenSpaceSize = screenSpaceSize;
+			}
+			textureResource->mStreamingFeedbackReceived = true;
+		}
+	}
+
 	void TextureResourceManager::setNumberOfTopMipmapsToRemove(uint8_t numberOfTopMipmapsToRemove)
 	{
 		if (mNumberOfTopMipmapsToRemove != numberOfTopMipmapsToRemove)
@@ -224,6 +258,7 @@ namespace Renderer
 			textureResource->setAssetId(assetId);
 			textureResource->setResourceLoaderTypeId(resourceLoaderTypeId);
 			textureResource->mRgbHardwareGammaCorrection = rgbHardwareGammaCorrection;
+			textureResource->mRequestedNumberOfTopMipmapsToRemove = mTextureStreamingEnabled ? INITIAL_NUMBER_OF_TOP_MIPMAPS_TO_REMOVE : static_cast<uint8_t>(0);	// Texture streaming: Load the low mipmaps first
 			load = true;
 		}
 
@@ -369,6 +404,92 @@ namespace Renderer
 		}
 	}
 
+	void TextureResourceManager::update()
+	{
+		// Texture streaming: Gather the texture resources which want to change the number of resident mipmaps
+		// -> Visible texture resources: Stream in mipmaps until the top mipmap covers the on-screen size of the visible geometry using it. Only stream
+		//    out mipmaps if the top mipmap is at least twice as big as required, this avoids reload ping-pong for geometry moving around a mipmap boundary.
+		// -> Texture resources which have been visible before but currently aren't keep their mipmaps until the memory budget is exceeded
+		// -> Texture resources never used by visible geometry (e.g. compositor or GUI textures) are streamed in at full resolution
+		// -> The memory budget check uses the number of resident bytes of the previous update, it's updated while gathering
+		const bool overMemoryBudget = (mNumberOfResidentTextureBytes > mTextureStreamingMemoryBudget);
+		uint64_t numberOfResidentTextureBytes = 0;
+		mStreamingRequests.clear();
+		const uint32_t numberOfElements = mInternalResourceManager->getResources().getNumberOfElements();
+		for (uint32_t i = 0; i < numberOfElements; ++i)
+		{
+			TextureResource& textureResource = mInternalResourceManager->getResources().getElementByIndex(i);
+			numberOfResidentTextureBytes += textureResource.mNumberOfResidentBytes;
+			const float screenSpaceSize = textureResource.mMaximumScreenSpaceSize;
+			textureResource.mMaximumScreenSpaceSize = 0.0f;
+
+			// Only texture resources with known mipmaps can be streamed, don't touch texture resources which are in-flight inside the resource streamer
+			if (textureResource.mNumberOfMipmaps > 1 && IResource::LoadingState::LOADED == textureResource.getLoadingState())
+			{
+				const uint8_t requestedNumberOfTopMipmapsToRemove = textureResource.mRequestedNumberOfTopMipmapsToRemove;
+				uint8_t numberOfTopMipmapsToRemove = 0;
+				if (mTextureStreamingEnabled)
+				{
+					if (screenSpaceSize > 0.0f)
+					{
+						numberOfTopMipmapsToRemove = ::detail::calculateTextureStreamingNumberOfTopMipmapsToRemove(textureResource, screenSpaceSize);
+						if (numberOfTopMipmapsToRemove > requestedNumberOfTopMipmapsToRemove)
+						{
+							numberOfTopMipmapsToRemove = std::max(requestedNumberOfTopMipmapsToRemove, ::detail::calculateTextureStreamingNumberOfTopMipmapsToRemove(textureResource, screenSpaceSize * 2.0f));
+						}
+					}
+					else if (textureResource.mStreamingFeedbackReceived)
+					{
+						numberOfTopMipmapsToRemove = overMemoryBudget ? static_cast<uint8_t>(textureResource.mNumberOfMipmaps - 1) : requestedNumberOfTopMipmapsToRemove;
+					}
+				}
+				if (numberOfTopMipmapsToRemove != requestedNumberOfTopMipmapsToRemove)
+				{
+					mStreamingRequests.push_back({ textureResource.getId(), numberOfTopMipmapsToRemove, screenSpaceSize, numberOfTopMipmapsToRemove < requestedNumberOfTopMipmapsToRemove });
+				}
+			}
+		}
+		mNumberOfResidentTextureBytes = numberOfResidentTextureBytes;
+
+		// Commit the texture streaming requests
+		if (!mStreamingRequests.empty())
+		{
+			// Stream out first since this frees memory, after that stream in the texture resources with the biggest on-screen size first
+			std::sort(mStreamingRequests.begin(), mStreamingRequests.end(), [](const StreamingRequest& left, const StreamingRequest& right) { return ((left.streamIn != right.streamIn) ? right.streamIn : (left.screenSpaceSize > right.screenSpaceSize)); });
+
+			// Reload the texture resources, the resident RHI textures are kept until the reloaded ones are available
+			uint64_t projectedNumberOfResidentTextureBytes = numberOfResidentTextureBytes;
+			uint32_t numberOfCommittedStreamingRequests = 0;
+			for (const StreamingRequest& streamingRequest : mStreamingRequests)
+			{
+				if (numberOfCommittedStreamingRequests >= MAXIMUM_NUMBER_OF_STREAMING_REQUESTS_PER_UPDATE)
+				{
+					// The remaining texture resources will be reconsidered during the next updates
+					break;
+				}
+				TextureResource& textureResource = mInternalResourceManager->getResources().getElementById(streamingRequest.textureResourceId);
+				uint8_t numberOfTopMipmapsToRemove = streamingRequest.numberOfTopMipmapsToRemove;
+				if (streamingRequest.streamIn && mTextureStreamingEnabled)
+				{
+					// Only stream in as many mipmaps as the memory budget allows
+					const uint64_t numberOfResidentBytes = textureResource.mNumberOfResidentBytes;
+					while (numberOfTopMipmapsToRemove < textureResource.mRequestedNumberOfTopMipmapsToRemove && projectedNumberOfResidentTextureBytes - numberOfResidentBytes + ::detail::estimateTextureStreamingNumberOfBytes(textureResource, numberOfTopMipmapsToRemove) > mTextureStreamingMemoryBudget)
+					{
+						++numberOfTopMipmapsToRemove;
+					}
+					if (numberOfTopMipmapsToRemove == textureResource.mRequestedNumberOfTopMipmapsToRemove)
+					{
+						// Out of memory budget
+						continue;
+					}
+					projectedNumberOfResidentTextureBytes = projectedNumberOfResidentTextureBytes - numberOfResidentBytes + ::detail::estimateTextureStreamingNumberOfBytes(textureResource, numberOfTopMipmapsToRemove);
+				}
+				requestTextureStreaming(textureResource, numberOfTopMipmapsToRemove);
+				++numberOfCommittedStreamingRequests;
+			}
+		}
+	}
+
 
 	//[-------------------------------------------------------]
 	//[ Private virtual Renderer::IResourceManager methods    ]
@@ -406,7 +527,10 @@ namespace Renderer
 	//[ Private methods                                       ]
 	//[-------------------------------------------------------]
 	TextureResourceManager::TextureResourceManager(IRenderer& renderer) :
-		mNumberOfTopMipmapsToRemove(0)
+		mNumberOfTopMipmapsToRemove(0),
+		mTextureStreamingEnabled(true),
+		mTextureStreamingMemoryBudget(DEFAULT_TEXTURE_STREAMING_MEMORY_BUDGET),
+		mNumberOfResidentTextureBytes(0)
 	{
 		mInternalResourceManager = new ResourceManagerTemplate<TextureResource, ITextureResourceLoader, TextureResourceId, 2048>(renderer, *this);
 		::detail::createDefaultDynamicTextureAssets(renderer, *this);
@@ -417,6 +541,14 @@ namespace Renderer
 		delete mInternalResourceManager;
 	}
 
+	void TextureResourceManager::requestTextureStreaming(TextureResource& textureResource, uint8_t numberOfTopMipmapsToRemove)
+	{
+		// Reload the texture resource, "Renderer::ITextureResourceLoader" picks up the requested number of top mipmaps to remove
+		textureResource.mRequestedNumberOfTopMipmapsToRemove = numberOfTopMipmapsToRemove;
+		TextureResourceId textureResourceId = getInvalid<TextureResourceId>();
+		loadTextureResourceByAssetId(textureResource.getAssetId(), getInvalid<AssetId>(), textureResourceId, nullptr, textureResource.isRgbHardwareGammaCorrection(), true, textureResource.getResourceLoaderTypeId());
+	}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -78,6 +78,15 @@ namespace Renderer
 		friend class RendererImpl;
 
 
+	//[-------------------------------------------------------]
+	//[ Public definitions                                    ]
+	//[-------------------------------------------------------]
+	public:
+		static constexpr uint8_t  INITIAL_NUMBER_OF_TOP_MIPMAPS_TO_REMOVE			= 4;					///< Texture streaming loads the low mipmaps first, by default a 4096x4096 texture starts as 256x256 texture
+		static constexpr uint32_t MAXIMUM_NUMBER_OF_STREAMING_REQUESTS_PER_UPDATE	= 8;					///< Maximum number of texture streaming resource streamer load requests per texture resource manager update to not flood the resource streamer
+		static constexpr uint64_t DEFAULT_TEXTURE_STREAMING_MEMORY_BUDGET			= 512 * 1024 * 1024;	///< Default texture streaming memory budget in bytes
+
+
 	//[-------------------------------------------------------]
 	//[ Public static methods                                 ]
 	//[-------------------------------------------------------]
@@ -121,6 +130,60 @@ namespace Renderer
 		}
 
 		RENDERER_API_EXPORT void setNumberOfTopMipmapsToRemove(uint8_t numberOfTopMipmapsToRemove);
+
+		//[-------------------------------------------------------]
+		//[ Texture streaming                                     ]
+		//[-------------------------------------------------------]
+		[[nodiscard]] inline bool isTextureStreamingEnabled() const
+		{
+			return mTextureStreamingEnabled;
+		}
+
+		inline void setTextureStreamingEnabled(bool textureStreamingEnabled)	// When disabling texture streaming, streamed textures are reloaded at full resolution over the following updates
+		{
+			mTextureStreamingEnabled = textureStreamingEnabled;
+		}
+
+		[[nodiscard]] inline uint64_t getTextureStreamingMemoryBudget() const
+		{
+			return mTextureStreamingMemoryBudget;
+		}
+
+		inline void setTextureStreamingMemoryBudget(uint64_t textureStreamingMemoryBudget)	// In bytes
+		{
+			mTextureStreamingMemoryBudget = textureStreamingMemoryBudget;
+		}
+
+		/**
+		*  @brief
+		*    Return the number of bytes used by the resident texture data of texture resources loaded from texture assets
+		*
+		*  @return
+		*    The number of bytes used by the resident texture data, updated inside "Renderer::TextureResourceManager::update()"
+		*/
+		[[nodiscard]] inline uint64_t getNumberOfResidentTextureBytes() const
+		{
+			return mNumberOfResidentTextureBytes;
+		}
+
+		/**
+		*  @brief
+		*    Provide the texture streaming with the on-screen size of visible geometry using a texture resource
+		*
+		*  @param[in] textureResourceId
+		*    ID of the texture resource used by visible geometry, invalid texture resource IDs are silently ignored
+		*  @param[in] screenSpaceSize
+		*    On-screen size in pixels of the visible geometry using the texture resource
+		*
+		*  @note
+		*    - Usually called by "Renderer::MaterialTechnique::setTextureStreamingFeedback()" while filling render queues
+		*    - The maximum on-screen size since the last texture resource manager update is used to decide about the number of mipmaps to stream in
+		*/
+		RENDERER_API_EXPORT void setTextureStreamingFeedback(TextureResourceId textureResourceId, float screenSpaceSize) const;
+
+		//[-------------------------------------------------------]
+		//[ Texture resources                                     ]
+		//[-------------------------------------------------------]
 		[[nodiscard]] RENDERER_API_EXPORT TextureResource* getTextureResourceByAssetId(AssetId assetId) const;		// Considered to be inefficient, avoid method whenever possible
 		[[nodiscard]] RENDERER_API_EXPORT TextureResourceId getTextureResourceIdByAssetId(AssetId assetId) const;	// Considered to be inefficient, avoid method whenever possible
 		RENDERER_API_EXPORT void loadTextureResourceByAssetId(AssetId assetId, AssetId fallbackTextureAssetId, TextureResourceId& textureResourceId, IResourceListener* resourceListener = nullptr, bool rgbHardwareGammaCorrection = false, bool reload = false, ResourceLoaderTypeId resourceLoaderTypeId = getInvalid<ResourceLoaderTypeId>());	// Asynchronous
@@ -138,11 +201,7 @@ namespace Renderer
 		[[nodiscard]] virtual IResource& getResourceByResourceId(ResourceId resourceId) const override;
 		[[nodiscard]] virtual IResource* tryGetResourceByResourceId(ResourceId resourceId) const override;
 		virtual void reloadResourceByAssetId(AssetId assetId) override;
-
-		inline virtual void update() override
-		{
-			// Nothing here
-		}
+		virtual void update() override;
 
 
 	//[-------------------------------------------------------]
@@ -160,13 +219,32 @@ namespace Renderer
 		virtual ~TextureResourceManager() override;
 		explicit TextureResourceManager(const TextureResourceManager&) = delete;
 		TextureResourceManager& operator=(const TextureResourceManager&) = delete;
+		void requestTextureStreaming(TextureResource& textureResource, uint8_t numberOfTopMipmapsToRemove);
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		struct StreamingRequest final
+		{
+			TextureResourceId textureResourceId;
+			uint8_t			  numberOfTopMipmapsToRemove;
+			float			  screenSpaceSize;	///< Used for prioritization, 0 if the texture resource isn't visible
+			bool			  streamIn;			///< "true" if mipmaps are streamed in, "false" if mipmaps are streamed out
+		};
+		typedef std::vector<StreamingRequest> StreamingRequests;
 
 
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
-		uint8_t mNumberOfTopMipmapsToRemove;	///< The number of top mipmaps to remove while loading textures for efficient texture quality reduction. By setting this to e.g. two a 4096x4096 texture will become 1024x1024.
+		uint8_t			  mNumberOfTopMipmapsToRemove;		///< The number of top mipmaps to remove while loading textures for efficient texture quality reduction. By setting this to e.g. two a 4096x4096 texture will become 1024x1024. Also the lower limit for texture streaming.
+		bool			  mTextureStreamingEnabled;			///< If "true", texture resources loaded from texture assets start with low mipmaps and the higher mipmaps are streamed in and out depending on the on-screen size of visible geometry using them
+		uint64_t		  mTextureStreamingMemoryBudget;	///< Texture streaming memory budget in bytes, higher mipmaps are only streamed in as long as the resident texture data stays inside the budget
+		uint64_t		  mNumberOfResidentTextureBytes;	///< Number of bytes used by the resident texture data of texture resources loaded from texture assets, updated inside "Renderer::TextureResourceManager::update()"
+		StreamingRequests mStreamingRequests;				///< Streaming requests of the current update, only a member to reduce memory allocations
 
 		// Internal resource manager implementation
 		ResourceManagerTemplate<TextureResource, ITextureResourceLoader, TextureResourceId, 2048>* mInternalResourceManager;
@@ -177,6 +177,14 @@ namespace Renderer
 		{
 			mVertexAttributesResource->mVertexAttributes = Rhi::VertexAttributes(MeshResource::SKINNED_VERTEX_ATTRIBUTES.numberOfAttributes, MeshResource::SKINNED_VERTEX_ATTRIBUTES.attributes);
 		}
+		else if (ASSET_ID("Example/Blueprint/Mesh/VA_QuantizedMesh") == getAsset().assetId)
+		{
+			mVertexAttributesResource->mVertexAttributes = Rhi::VertexAttributes(MeshResource::QUANTIZED_VERTEX_ATTRIBUTES.numberOfAttributes, MeshResource::QUANTIZED_VERTEX_ATTRIBUTES.attributes);
+		}
+		else if (ASSET_ID("Example/Blueprint/Mesh/VA_QuantizedSkinnedMesh") == getAsset().assetId)
+		{
+			mVertexAttributesResource->mVertexAttributes = Rhi::VertexAttributes(MeshResource::QUANTIZED_SKINNED_VERTEX_ATTRIBUTES.numberOfAttributes, MeshResource::QUANTIZED_SKINNED_VERTEX_ATTRIBUTES.attributes);
+		}
 		else if (ASSET_ID("Example/Blueprint/Particles/VA_Particles") == getAsset().assetId ||
 				 ASSET_ID("Example/Blueprint/Grass/VA_Grass") == getAsset().assetId)
 		{
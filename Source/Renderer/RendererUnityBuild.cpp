@@ -36,6 +36,7 @@
 #include "Public/Core/Math/Frustum.cpp"
 #include "Public/Core/Math/Math.cpp"
 #include "Public/Core/Math/Transform.cpp"
+#include "Public/Core/Memory/FrameAllocator.cpp"
 #include "Public/Core/Platform/PlatformManager.cpp"
 #include "Public/Core/Renderer/FramebufferManager.cpp"
 #include "Public/Core/Renderer/FramebufferSignature.cpp"
@@ -56,6 +57,7 @@
 #include "Public/RenderQueue/Renderable.cpp"
 #include "Public/RenderQueue/RenderableManager.cpp"
 #include "Public/RenderQueue/RenderQueue.cpp"
+#include "Public/RenderQueue/GpuInstanceCuller.cpp"
 #include "Public/Resource/IResourceListener.cpp"
 #include "Public/Resource/CompositorNode/CompositorNodeInstance.cpp"
 #include "Public/Resource/CompositorNode/CompositorNodeResource.cpp"
@@ -120,6 +122,7 @@
 #include "Public/Resource/Scene/SceneResourceManager.cpp"
 #include "Public/Resource/Scene/Factory/SceneFactory.cpp"
 #include "Public/Resource/Scene/Culling/SceneCullingManager.cpp"
+#include "Public/Resource/Scene/Culling/SoftwareOcclusionCuller.cpp"
 #include "Public/Resource/Scene/Item/ISceneItem.cpp"
 #include "Public/Resource/Scene/Item/MaterialSceneItem.cpp"
 #include "Public/Resource/Scene/Item/Camera/CameraSceneItem.cpp"
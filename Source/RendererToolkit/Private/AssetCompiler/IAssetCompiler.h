@@ -222,11 +222,13 @@ namespace RendererToolkit
 			const rapidjson::Value&    rapidJsonValueTargets;
 			std::string				   rhiTarget;
 			QualityStrategy			   qualityStrategy;
-			Configuration(const rapidjson::Document& _rapidJsonDocumentAsset, const rapidjson::Value& _rapidJsonValueTargets, const std::string& _rhiTarget, QualityStrategy _qualityStrategy) :
+			uint32_t				   numberOfThreads;	///< Maximum number of threads an asset compiler is allowed to use for processing a single asset, always at least one
+			Configuration(const rapidjson::Document& _rapidJsonDocumentAsset, const rapidjson::Value& _rapidJsonValueTargets, const std::string& _rhiTarget, QualityStrategy _qualityStrategy, uint32_t _numberOfThreads) :
 				rapidJsonDocumentAsset(_rapidJsonDocumentAsset),
 				rapidJsonValueTargets(_rapidJsonValueTargets),
 				rhiTarget(_rhiTarget),
-				qualityStrategy(_qualityStrategy)
+				qualityStrategy(_qualityStrategy),
+				numberOfThreads(_numberOfThreads)
 			{
 				// Nothing here
 			}
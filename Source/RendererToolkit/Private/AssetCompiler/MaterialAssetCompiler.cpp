@@ -85,7 +85,7 @@ namespace RendererToolkit
 		CacheManager::CacheEntries cacheEntries;
 		std::vector<std::string> virtualInputFilenames;
 		virtualInputFilenames.emplace_back(virtualInputFilename);
-		if (input.cacheManager.needsToBeCompiled(configuration.rhiTarget, input.virtualAssetFilename, virtualInputFilenames, virtualOutputAssetFilename, Renderer::v1Material::FORMAT_VERSION, cacheEntries) || input.cacheManager.dependencyFilesChanged(virtualDependencyFilenames))
+		if (input.cacheManager.needsToBeCompiled(configuration.rhiTarget, input.virtualAssetFilename, virtualInputFilenames, virtualDependencyFilenames, virtualOutputAssetFilename, Renderer::v1Material::FORMAT_VERSION, cacheEntries))
 		{
 			Renderer::MemoryFile memoryFile(0, 1024);
 
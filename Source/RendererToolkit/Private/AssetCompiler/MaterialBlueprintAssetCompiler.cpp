@@ -179,7 +179,7 @@ namespace RendererToolkit
 
 		// Ask the cache manager whether or not we need to compile the source file (e.g. source changed or target not there)
 		CacheManager::CacheEntries cacheEntries;
-		if (input.cacheManager.needsToBeCompiled(configuration.rhiTarget, input.virtualAssetFilename, virtualInputFilename, virtualOutputAssetFilename, Renderer::v1MaterialBlueprint::FORMAT_VERSION, cacheEntries) || input.cacheManager.dependencyFilesChanged(virtualDependencyFilenames))
+		if (input.cacheManager.needsToBeCompiled(configuration.rhiTarget, input.virtualAssetFilename, {virtualInputFilename}, virtualDependencyFilenames, virtualOutputAssetFilename, Renderer::v1MaterialBlueprint::FORMAT_VERSION, cacheEntries))
 		{
 			Renderer::MemoryFile memoryFile(0, 4096);
 
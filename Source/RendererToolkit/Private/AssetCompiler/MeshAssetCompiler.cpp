@@ -32,6 +32,7 @@
 
 #include <Renderer/Public/Asset/AssetPackage.h>
 #include <Renderer/Public/Core/Math/Math.h>
+#include <Renderer/Public/Core/Time/Stopwatch.h>
 #include <Renderer/Public/Core/File/IFile.h>
 #include <Renderer/Public/Core/File/MemoryFile.h>
 #include <Renderer/Public/Core/File/IFileManager.h>
@@ -186,6 +187,8 @@ namespace
 		//[-------------------------------------------------------]
 		static constexpr uint8_t NUMBER_OF_BYTES_PER_VERTEX = 28;										///< Number of bytes per vertex (3 float position, 2 float texture coordinate, 4 short QTangent)
 		static constexpr uint8_t NUMBER_OF_BYTES_PER_SKINNED_VERTEX = NUMBER_OF_BYTES_PER_VERTEX + 8;	///< Number of bytes per skinned vertex (+4 byte bone indices, +4 byte bone weights)
+		static constexpr uint8_t NUMBER_OF_QUANTIZED_VERTEX_SAVED_BYTES = 4;							///< Number of bytes a quantized vertex is smaller (2 half instead of 2 float texture coordinate)
+		static constexpr uint8_t NUMBER_OF_QUANTIZED_POSITION_SAVED_BYTES = 4;							///< Number of bytes a quantized static vertex is additionally smaller (4 short instead of 3 float position)
 		typedef std::vector<Renderer::v1Mesh::SubMesh> SubMeshes;
 		typedef std::unordered_map<std::string, Renderer::AssetId> MaterialNameToAssetId;
 
@@ -697,6 +700,127 @@ namespace
 			}
 		}
 
+		/**
+		*  @brief
+		*    Quantize vertex buffer data in-place by converting the 32 bit floating point texture coordinates into 16 bit floating point texture coordinates and optionally the 32 bit floating point positions into 16 bit signed normalized positions
+		*
+		*  @param[in,out] vertexBufferData
+		*    Vertex buffer data using the default vertex layout, receives the tightly packed vertex buffer data using the quantized vertex layout
+		*  @param[in] numberOfVertices
+		*    Number of vertices
+		*  @param[in] numberOfBytesPerVertex
+		*    Number of bytes per vertex of the default vertex layout
+		*  @param[in] quantizePositions
+		*    Quantize the positions as well? Only valid for static meshes, skinned meshes apply the bones in object space and hence keep 32 bit floating point positions.
+		*  @param[in] minimumBoundingBoxPosition
+		*    Minimum bounding box position of all vertices, only used if the positions are quantized
+		*  @param[in] maximumBoundingBoxPosition
+		*    Maximum bounding box position of all vertices, only used if the positions are quantized
+		*
+		*  @note
+		*    - Everything behind the texture coordinate is just moved forward, see "Renderer::MeshResource::QUANTIZED_VERTEX_ATTRIBUTES" and "Renderer::MeshResource::QUANTIZED_SKINNED_VERTEX_ATTRIBUTES"
+		*    - The quantized vertex starts never behind the default vertex, so processing the vertices in ascending order never overwrites data which is still to be read
+		*    - Quantized positions are relative to the bounding box center and scaled by the inverse bounding box half extents, the renderer folds the inverse mapping into the instance transform (see "Renderer::Renderable::setPositionDequantization()")
+		*/
+		void quantizeVertexBufferData(uint8_t* vertexBufferData, uint32_t numberOfVertices, uint8_t numberOfBytesPerVertex, bool quantizePositions, const glm::vec3& minimumBoundingBoxPosition, const glm::vec3& maximumBoundingBoxPosition)
+		{
+			static constexpr uint32_t TEXTURE_COORDINATE_OFFSET = sizeof(float) * 3;
+			const uint32_t quantizedTextureCoordinateOffset = quantizePositions ? static_cast<uint32_t>(sizeof(int16_t) * 4) : TEXTURE_COORDINATE_OFFSET;
+			const uint32_t numberOfBytesPerQuantizedVertex = static_cast<uint32_t>(numberOfBytesPerVertex - NUMBER_OF_QUANTIZED_VERTEX_SAVED_BYTES - (quantizePositions ? NUMBER_OF_QUANTIZED_POSITION_SAVED_BYTES : 0));
+			const uint32_t numberOfBytesBehindTextureCoordinate = numberOfBytesPerVertex - TEXTURE_COORDINATE_OFFSET - sizeof(float) * 2;
+
+			// Map the bounding box to [-1, 1], an axis without extent maps to zero
+			const glm::vec3 boundingBoxCenter = (minimumBoundingBoxPosition + maximumBoundingBoxPosition) * 0.5f;
+			const glm::vec3 boundingBoxHalfExtents = (maximumBoundingBoxPosition - minimumBoundingBoxPosition) * 0.5f;
+			const glm::vec3 inverseBoundingBoxHalfExtents((boundingBoxHalfExtents.x > 0.0f) ? 1.0f / boundingBoxHalfExtents.x : 0.0f, (boundingBoxHalfExtents.y > 0.0f) ? 1.0f / boundingBoxHalfExtents.y : 0.0f, (boundingBoxHalfExtents.z > 0.0f) ? 1.0f / boundingBoxHalfExtents.z : 0.0f);
+
+			for (uint32_t vertexIndex = 0; vertexIndex < numberOfVertices; ++vertexIndex)
+			{
+				const uint8_t* sourceVertex = vertexBufferData + vertexIndex * numberOfBytesPerVertex;
+				uint8_t* destinationVertex = vertexBufferData + vertexIndex * numberOfBytesPerQuantizedVertex;
+
+				// 32 bit position or 16 bit signed normalized position, the fourth component is unused
+				glm::vec3 position;
+				glm::vec2 textureCoordinate;
+				memcpy(&position, sourceVertex, sizeof(float) * 3);
+				memcpy(&textureCoordinate, sourceVertex + TEXTURE_COORDINATE_OFFSET, sizeof(float) * 2);
+				if (quantizePositions)
+				{
+					const glm::vec3 normalizedPosition = glm::clamp((position - boundingBoxCenter) * inverseBoundingBoxHalfExtents, -1.0f, 1.0f) * 32767.0f;
+					const int16_t shortPosition[4] = { static_cast<int16_t>(glm::round(normalizedPosition.x)), static_cast<int16_t>(glm::round(normalizedPosition.y)), static_cast<int16_t>(glm::round(normalizedPosition.z)), 0 };
+					memcpy(destinationVertex, shortPosition, sizeof(int16_t) * 4);
+				}
+				else
+				{
+					memmove(destinationVertex, sourceVertex, sizeof(float) * 3);
+				}
+
+				// 16 bit texture coordinate
+				const uint32_t halfTextureCoordinate = glm::packHalf2x16(textureCoordinate);
+				memcpy(destinationVertex + quantizedTextureCoordinateOffset, &halfTextureCoordinate, sizeof(uint16_t) * 2);
+
+				// 16 bit QTangent and optional 8 bit bone indices and weights
+				memmove(destinationVertex + quantizedTextureCoordinateOffset + sizeof(uint16_t) * 2, sourceVertex + TEXTURE_COORDINATE_OFFSET + sizeof(float) * 2, numberOfBytesBehindTextureCoordinate);
+			}
+		}
+
+		/**
+		*  @brief
+		*    Encode index buffer data by using the "meshoptimizer" index buffer codec
+		*
+		*  @param[in] indexBufferData
+		*    Index buffer data to encode, must be a triangle list
+		*  @param[in] numberOfVertices
+		*    Number of vertices the index buffer data is referencing
+		*  @param[out] encodedIndexBufferData
+		*    Receives the encoded index buffer data
+		*/
+		void encodeIndexBufferData(const std::vector<uint32_t>& indexBufferData, uint32_t numberOfVertices, std::vector<uint8_t>& encodedIndexBufferData)
+		{
+			encodedIndexBufferData.resize(meshopt_encodeIndexBufferBound(indexBufferData.size(), numberOfVertices));
+			encodedIndexBufferData.resize(meshopt_encodeIndexBuffer(encodedIndexBufferData.data(), encodedIndexBufferData.size(), indexBufferData.data(), indexBufferData.size()));
+			if (encodedIndexBufferData.empty())
+			{
+				throw std::runtime_error("Failed to encode the index buffer by using the \"meshoptimizer\" index buffer codec");
+			}
+		}
+
+		/**
+		*  @brief
+		*    Compare decoded index buffer data against the index buffer data which would have been written down without encoding
+		*
+		*  @param[in] indexBufferFormat
+		*    Index buffer format the decoded index buffer data is using
+		*  @param[in] decodedIndexBufferData
+		*    Decoded index buffer data
+		*  @param[in] indexBufferData
+		*    Original 32-bit index buffer data
+		*  @param[in,out] temporaryShortIndexBufferData
+		*    Temporary short index buffer data to be able to reuse allocated memory
+		*
+		*  @return
+		*    "true" if the decoded index buffer data is identical to the original index buffer data, else "false"
+		*/
+		[[nodiscard]] bool isDecodedIndexBufferDataEqual(Rhi::IndexBufferFormat::Enum indexBufferFormat, const std::vector<uint8_t>& decodedIndexBufferData, const std::vector<uint32_t>& indexBufferData, std::vector<uint16_t>& temporaryShortIndexBufferData)
+		{
+			const size_t numberOfIndices = indexBufferData.size();
+			if (Rhi::IndexBufferFormat::UNSIGNED_INT == indexBufferFormat)
+			{
+				return (decodedIndexBufferData.size() == sizeof(uint32_t) * numberOfIndices && 0 == memcmp(decodedIndexBufferData.data(), indexBufferData.data(), sizeof(uint32_t) * numberOfIndices));
+			}
+			else
+			{
+				// Convert the 32-bit indices we have in memory to 16-bit indices, the same way it's done when writing them into a file
+				temporaryShortIndexBufferData.resize(numberOfIndices);
+				uint16_t* RESTRICT shortIndexBufferData = temporaryShortIndexBufferData.data();
+				for (size_t i = 0; i < numberOfIndices; ++i)
+				{
+					shortIndexBufferData[i] = static_cast<uint16_t>(indexBufferData[i]);
+				}
+				return (decodedIndexBufferData.size() == sizeof(uint16_t) * numberOfIndices && 0 == memcmp(decodedIndexBufferData.data(), shortIndexBufferData, sizeof(uint16_t) * numberOfIndices));
+			}
+		}
+
 
 //[-------------------------------------------------------]
 //[ Anonymous detail namespace                            ]
@@ -738,6 +862,7 @@ namespace RendererToolkit
 		if (input.cacheManager.needsToBeCompiled(configuration.rhiTarget, input.virtualAssetFilename, virtualInputFilename, virtualOutputAssetFilename, Renderer::v1Mesh::FORMAT_VERSION, cacheEntries))
 		{
 			Renderer::MemoryFile memoryFile(0, 42 * 1024);
+			std::string vertexMemoryReport;
 
 			// Setup "mikktspace" by Morten S. Mikkelsen for semi-standard tangent space generation (see e.g. https://wiki.blender.org/index.php/Dev:Shading/Tangent_Space_Normal_Maps for background information)
 			SMikkTSpaceInterface mikkTSpaceInterface;
@@ -814,9 +939,17 @@ namespace RendererToolkit
 				}
 				const Rhi::IndexBufferFormat::Enum indexBufferFormat = (numberOfVertices > std::numeric_limits<uint16_t>::max()) ? Rhi::IndexBufferFormat::UNSIGNED_INT : Rhi::IndexBufferFormat::UNSIGNED_SHORT;
 
+				// Optional quantized vertex layout using 16 bit floating point texture coordinates and for static meshes 16 bit signed normalized positions, selects the "QuantizedVertexAttributes" of the material blueprints at runtime
+				// -> While processing the mesh the default vertex layout is used, the quantization is the last step before writing down the vertex buffer
+				// -> Quantized positions are relative to the mesh bounding box written into the mesh header, the renderer dequantizes them via the instance transform
+				bool quantizeVertices = false;
+				JsonHelper::optionalBooleanProperty(rapidJsonValueMeshAssetCompiler, "QuantizeVertices", quantizeVertices);
+
 				// Is there an optional skeleton?
-				const Rhi::VertexAttributes& vertexAttributes = (numberOfBones > 0) ? Renderer::MeshResource::SKINNED_VERTEX_ATTRIBUTES : Renderer::MeshResource::VERTEX_ATTRIBUTES;
+				const Rhi::VertexAttributes& vertexAttributes = (numberOfBones > 0) ? (quantizeVertices ? Renderer::MeshResource::QUANTIZED_SKINNED_VERTEX_ATTRIBUTES : Renderer::MeshResource::SKINNED_VERTEX_ATTRIBUTES) : (quantizeVertices ? Renderer::MeshResource::QUANTIZED_VERTEX_ATTRIBUTES : Renderer::MeshResource::VERTEX_ATTRIBUTES);
 				const uint8_t numberOfBytesPerVertex = (numberOfBones > 0) ? ::detail::NUMBER_OF_BYTES_PER_SKINNED_VERTEX : ::detail::NUMBER_OF_BYTES_PER_VERTEX;
+				const bool quantizePositions = (quantizeVertices && 0 == numberOfBones);
+				const uint8_t numberOfBytesPerOutputVertex = quantizeVertices ? static_cast<uint8_t>(numberOfBytesPerVertex - ::detail::NUMBER_OF_QUANTIZED_VERTEX_SAVED_BYTES - (quantizePositions ? ::detail::NUMBER_OF_QUANTIZED_POSITION_SAVED_BYTES : 0)) : numberOfBytesPerVertex;
 
 				// Allocate memory for the local vertex and index buffer data
 				// -> Do also initialize the vertex buffer data with zero to handle not filled vertex bone weights
@@ -1097,9 +1230,65 @@ namespace RendererToolkit
 						}
 						*/
 					}
+				}
 
-					// "meshoptimizer" vertex/index buffer compression isn't used by intent. As of 22 December 2019 there's no 16-bit index support when using index compression and
-					// a quick'n'dirty test showed that when using vertex compression the resulting file got actually bigger instead of smaller (we're using LZ4 compressed files).
+				// Step six: Optional vertex quantization
+				if (quantizeVertices)
+				{
+					::detail::quantizeVertexBufferData(vertexBufferData, numberOfVertices, numberOfBytesPerVertex, quantizePositions, minimumBoundingBoxPosition, maximumBoundingBoxPosition);
+				}
+
+				// Step seven: Optional "meshoptimizer" vertex/index buffer codecs
+				// -> Opt-in since a quick'n'dirty test as of 22 December 2019 showed that when using vertex compression the resulting file got actually bigger instead of smaller (we're using LZ4 compressed files), so check the reported file size per mesh
+				// -> The index codec only encodes 32-bit indices, but the decoder writes 16-bit indices as well
+				std::vector<uint8_t> encodedVertexBufferData;
+				std::vector<uint8_t> encodedIndexBufferData;
+				std::vector<uint8_t> encodedPositionOnlyIndexBufferData;
+				uint32_t decodeMicroseconds = 0;
+				{
+					bool encodeVertexAndIndexBuffers = false;
+					JsonHelper::optionalBooleanProperty(rapidJsonValueMeshAssetCompiler, "EncodeVertexAndIndexBuffers", encodeVertexAndIndexBuffers);
+					if (encodeVertexAndIndexBuffers)
+					{
+						// Encode
+						encodedVertexBufferData.resize(meshopt_encodeVertexBufferBound(numberOfVertices, numberOfBytesPerOutputVertex));
+						encodedVertexBufferData.resize(meshopt_encodeVertexBuffer(encodedVertexBufferData.data(), encodedVertexBufferData.size(), vertexBufferData, numberOfVertices, numberOfBytesPerOutputVertex));
+						if (encodedVertexBufferData.empty())
+						{
+							throw std::runtime_error("Failed to encode the vertex buffer by using the \"meshoptimizer\" vertex buffer codec");
+						}
+						if (numberOfIndices > 0)
+						{
+							::detail::encodeIndexBufferData(indexBufferData, numberOfVertices, encodedIndexBufferData);
+						}
+						if (!positionOnlyIndexBufferData.empty())
+						{
+							::detail::encodeIndexBufferData(positionOnlyIndexBufferData, numberOfVertices, encodedPositionOnlyIndexBufferData);
+						}
+
+						{ // Decode once the way the mesh resource loader does to validate the encoded data and to measure the decode time the mesh resource loader will have
+							const uint32_t numberOfBytesPerIndex = Rhi::IndexBufferFormat::getNumberOfBytesPerElement(indexBufferFormat);
+							std::vector<uint8_t> decodedVertexBufferData(numberOfBytesPerOutputVertex * numberOfVertices);
+							std::vector<uint8_t> decodedIndexBufferData(encodedIndexBufferData.empty() ? 0 : numberOfBytesPerIndex * numberOfIndices);
+							std::vector<uint8_t> decodedPositionOnlyIndexBufferData(encodedPositionOnlyIndexBufferData.empty() ? 0 : numberOfBytesPerIndex * numberOfIndices);
+							const Renderer::Stopwatch stopwatch(true);
+							if (0 != meshopt_decodeVertexBuffer(decodedVertexBufferData.data(), numberOfVertices, numberOfBytesPerOutputVertex, encodedVertexBufferData.data(), encodedVertexBufferData.size()) ||
+								(!encodedIndexBufferData.empty() && 0 != meshopt_decodeIndexBuffer(decodedIndexBufferData.data(), numberOfIndices, numberOfBytesPerIndex, encodedIndexBufferData.data(), encodedIndexBufferData.size())) ||
+								(!encodedPositionOnlyIndexBufferData.empty() && 0 != meshopt_decodeIndexBuffer(decodedPositionOnlyIndexBufferData.data(), numberOfIndices, numberOfBytesPerIndex, encodedPositionOnlyIndexBufferData.data(), encodedPositionOnlyIndexBufferData.size())))
+							{
+								throw std::runtime_error("Failed to decode the \"meshoptimizer\" encoded vertex and index buffers");
+							}
+							decodeMicroseconds = static_cast<uint32_t>(stopwatch.getMicroseconds());
+
+							// The decoded data must be identical to the data which would have been written down without encoding
+							if (0 != memcmp(decodedVertexBufferData.data(), vertexBufferData, decodedVertexBufferData.size()) ||
+								(!encodedIndexBufferData.empty() && !::detail::isDecodedIndexBufferDataEqual(indexBufferFormat, decodedIndexBufferData, indexBufferData, temporaryShortIndexBufferData)) ||
+								(!encodedPositionOnlyIndexBufferData.empty() && !::detail::isDecodedIndexBufferDataEqual(indexBufferFormat, decodedPositionOnlyIndexBufferData, positionOnlyIndexBufferData, temporaryShortIndexBufferData)))
+							{
+								throw std::runtime_error("The \"meshoptimizer\" decoded vertex and index buffers don't match the original vertex and index buffers");
+							}
+						}
+					}
 				}
 
 				{ // Write down the mesh header
@@ -1113,12 +1302,18 @@ namespace RendererToolkit
 					meshHeader.boundingSphereRadius		  = Renderer::Math::calculateInnerBoundingSphereRadius(minimumBoundingBoxPosition, maximumBoundingBoxPosition);
 
 					// Vertex and index data
-					meshHeader.numberOfBytesPerVertex	= numberOfBytesPerVertex;
+					meshHeader.numberOfBytesPerVertex	= numberOfBytesPerOutputVertex;
 					meshHeader.numberOfVertices			= numberOfVertices;
 					meshHeader.indexBufferFormat		= static_cast<uint8_t>(indexBufferFormat);
 					meshHeader.numberOfIndices			= numberOfIndices;
 					meshHeader.numberOfVertexAttributes = static_cast<uint8_t>(vertexAttributes.numberOfAttributes);
 					meshHeader.hasPositionOnlyIndices	= !positionOnlyIndexBufferData.empty();
+					meshHeader.hasQuantizedVertices		= quantizeVertices;
+
+					// Optional "meshoptimizer" vertex and index buffer codecs
+					meshHeader.numberOfEncodedVertexBufferBytes			   = static_cast<uint32_t>(encodedVertexBufferData.size());
+					meshHeader.numberOfEncodedIndexBufferBytes			   = static_cast<uint32_t>(encodedIndexBufferData.size());
+					meshHeader.numberOfEncodedPositionOnlyIndexBufferBytes = static_cast<uint32_t>(encodedPositionOnlyIndexBufferData.size());
 
 					// Sub-meshes and LODs
 					meshHeader.numberOfSubMeshes = static_cast<uint16_t>(subMeshes.size());
@@ -1132,18 +1327,40 @@ namespace RendererToolkit
 				}
 
 				// Write down the vertex and index buffer (directly containing also the index data of all LODs)
-				memoryFile.write(vertexBufferData, numberOfBytesPerVertex * numberOfVertices);
-				if (numberOfIndices > 0)
+				if (encodedVertexBufferData.empty())
+				{
+					memoryFile.write(vertexBufferData, numberOfBytesPerOutputVertex * numberOfVertices);
+				}
+				else
+				{
+					memoryFile.write(encodedVertexBufferData.data(), encodedVertexBufferData.size());
+				}
+				if (!encodedIndexBufferData.empty())
+				{
+					memoryFile.write(encodedIndexBufferData.data(), encodedIndexBufferData.size());
+				}
+				else if (numberOfIndices > 0)
 				{
 					::detail::writeIndexBufferData(indexBufferFormat, indexBufferData, temporaryShortIndexBufferData, memoryFile);
 				}
 
 				// Write down the optional position-only index buffer (directly containing also the index data of all LODs)
-				if (!positionOnlyIndexBufferData.empty())
+				if (!encodedPositionOnlyIndexBufferData.empty())
+				{
+					memoryFile.write(encodedPositionOnlyIndexBufferData.data(), encodedPositionOnlyIndexBufferData.size());
+				}
+				else if (!positionOnlyIndexBufferData.empty())
 				{
 					::detail::writeIndexBufferData(indexBufferFormat, positionOnlyIndexBufferData, temporaryShortIndexBufferData, memoryFile);
 				}
 
+				// Report the vertex memory, the file size is reported after the LZ4 compressed output file has been written
+				vertexMemoryReport = std::to_string(numberOfVertices) + " vertices using " + std::to_string(numberOfBytesPerOutputVertex * numberOfVertices) + " bytes vertex memory (" + std::to_string(numberOfBytesPerOutputVertex) + " bytes per vertex)";
+				if (!encodedVertexBufferData.empty())
+				{
+					vertexMemoryReport += ", " + std::to_string(encodedVertexBufferData.size() + encodedIndexBufferData.size() + encodedPositionOnlyIndexBufferData.size()) + " bytes encoded vertex and index data decoded in " + std::to_string(decodeMicroseconds) + " microseconds";
+				}
+
 				// Destroy local vertex and input buffer data
 				delete [] vertexBufferData;
 				indexBufferData.clear();
@@ -1180,6 +1397,7 @@ namespace RendererToolkit
 			{
 				throw std::runtime_error("Failed to write LZ4 compressed output file \"" + virtualOutputAssetFilename + '\"');
 			}
+			RHI_LOG(input.context, DEBUG, "Mesh \"%s\": %s, %s bytes file size", virtualOutputAssetFilename.c_str(), vertexMemoryReport.c_str(), std::to_string(input.context.getFileManager().getFileSize(virtualOutputAssetFilename.c_str())).c_str())
 
 			// Store new cache entries or update existing ones
 			input.cacheManager.storeOrUpdateCacheEntries(cacheEntries);
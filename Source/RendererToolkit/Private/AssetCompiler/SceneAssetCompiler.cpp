@@ -166,6 +166,286 @@ namespace
 			}
 		}
 
+		void readTransform(const rapidjson::Value& rapidJsonValueProperties, Renderer::Transform& transform)
+		{
+			// Position, rotation and scale
+			RendererToolkit::JsonHelper::optionalUnitNProperty(rapidJsonValueProperties, "Position", &transform.position.x, 3);
+			RendererToolkit::JsonHelper::optionalRotationQuaternionProperty(rapidJsonValueProperties, "Rotation", transform.rotation);
+			RendererToolkit::JsonHelper::optionalFactorNProperty(rapidJsonValueProperties, "Scale", &transform.scale.x, 3);
+		}
+
+		[[nodiscard]] uint32_t getPrefabIndex(const std::unordered_map<uint32_t, uint32_t>& prefabIndices, const rapidjson::Value& rapidJsonValuePrefabInstance)
+		{
+			const char* prefabName = rapidJsonValuePrefabInstance["Prefab"].GetString();
+			std::unordered_map<uint32_t, uint32_t>::const_iterator iterator = prefabIndices.find(Renderer::StringId(prefabName));
+			if (prefabIndices.cend() == iterator)
+			{
+				throw std::runtime_error("Prefab \"" + std::string(prefabName) + "\" is unknown");
+			}
+			return iterator->second;
+		}
+
+		void writeSceneItems(const RendererToolkit::IAssetCompiler::Input& input, const rapidjson::Value& rapidJsonValueItems, Renderer::MemoryFile& memoryFile)
+		{
+			for (rapidjson::Value::ConstMemberIterator rapidJsonMemberIteratorItems = rapidJsonValueItems.MemberBegin(); rapidJsonMemberIteratorItems != rapidJsonValueItems.MemberEnd(); ++rapidJsonMemberIteratorItems)
+			{
+				const rapidjson::Value& rapidJsonValueItem = rapidJsonMemberIteratorItems->value;
+				const Renderer::SceneItemTypeId typeId = Renderer::StringId(rapidJsonMemberIteratorItems->name.GetString());
+
+				// Get the scene item type specific data number of bytes
+				// TODO(co) Make this more generic via scene factory
+				uint32_t numberOfBytes = 0;
+				Renderer::MaterialProperties::SortedPropertyVector sortedMaterialPropertyVector;
+				switch (typeId)
+				{
+					case Renderer::CameraSceneItem::TYPE_ID:
+						// Nothing here
+						break;
+
+					case Renderer::LightSceneItem::TYPE_ID:
+						numberOfBytes = sizeof(Renderer::v1Scene::LightItem);
+						break;
+
+					case Renderer::SunlightSceneItem::TYPE_ID:
+						numberOfBytes = sizeof(Renderer::v1Scene::SunlightItem);
+						break;
+
+					case Renderer::MeshSceneItem::TYPE_ID:
+					case Renderer::SkeletonMeshSceneItem::TYPE_ID:
+					{
+						const uint32_t numberOfSubMeshMaterialAssetIds = rapidJsonValueItem.HasMember("SubMeshMaterials") ? rapidJsonValueItem["SubMeshMaterials"].Size() : 0;
+						numberOfBytes = sizeof(Renderer::v1Scene::MeshItem) + sizeof(Renderer::AssetId) * numberOfSubMeshMaterialAssetIds;
+						if (Renderer::SkeletonMeshSceneItem::TYPE_ID == typeId)
+						{
+							numberOfBytes += sizeof(Renderer::v1Scene::SkeletonMeshItem);
+						}
+						break;
+					}
+
+					case Renderer::SkySceneItem::TYPE_ID:
+					case Renderer::VolumeSceneItem::TYPE_ID:
+					case Renderer::GrassSceneItem::TYPE_ID:
+					case Renderer::TerrainSceneItem::TYPE_ID:
+					case Renderer::ParticlesSceneItem::TYPE_ID:
+						::detail::fillSortedMaterialPropertyVector(input, rapidJsonValueItem, sortedMaterialPropertyVector);
+						numberOfBytes = static_cast<uint32_t>(sizeof(Renderer::v1Scene::MaterialItem) + sizeof(Renderer::MaterialProperty) * sortedMaterialPropertyVector.size());
+						break;
+
+					default:
+						// Error!
+						throw std::runtime_error("Scene item type \"" + std::string(rapidJsonMemberIteratorItems->name.GetString()) + "\" is unknown");
+				}
+
+				{ // Write down the scene item header
+					Renderer::v1Scene::ItemHeader itemHeader;
+					itemHeader.typeId		 = typeId;
+					itemHeader.numberOfBytes = numberOfBytes;
+					memoryFile.write(&itemHeader, sizeof(Renderer::v1Scene::ItemHeader));
+				}
+
+				// Write down the scene item type specific data, if there is any
+				if (0 != numberOfBytes)
+				{
+					switch (typeId)
+					{
+						case Renderer::CameraSceneItem::TYPE_ID:
+							// Nothing here
+							break;
+
+						case Renderer::LightSceneItem::TYPE_ID:
+						{
+							Renderer::v1Scene::LightItem lightItem;
+
+							// Read properties
+							::detail::optionalLightTypeProperty(rapidJsonValueItem, "LightType", lightItem.lightType);
+							RendererToolkit::JsonHelper::optionalRgbColorProperty(rapidJsonValueItem, "Color", lightItem.color);
+							RendererToolkit::JsonHelper::optionalUnitNProperty(rapidJsonValueItem, "Radius", &lightItem.radius, 1);
+							RendererToolkit::JsonHelper::optionalAngleProperty(rapidJsonValueItem, "InnerAngle", lightItem.innerAngle);
+							RendererToolkit::JsonHelper::optionalAngleProperty(rapidJsonValueItem, "OuterAngle", lightItem.outerAngle);
+							RendererToolkit::JsonHelper::optionalUnitNProperty(rapidJsonValueItem, "NearClipDistance", &lightItem.nearClipDistance, 1);
+							RendererToolkit::JsonHelper::optionalIntegerNProperty(rapidJsonValueItem, "IesLightProfileIndex", &lightItem.iesLightProfileIndex, 1);
+
+							// Sanity checks
+							if (lightItem.color[0] < 0.0f || lightItem.color[1] < 0.0f || lightItem.color[2] < 0.0f)
+							{
+								throw std::runtime_error("All light item color components must be positive");
+							}
+							if (lightItem.lightType != Renderer::LightSceneItem::LightType::DIRECTIONAL && lightItem.radius <= 0.0f)
+							{
+								throw std::runtime_error("For point or spot light items the radius must be greater as zero");
+							}
+							if (lightItem.lightType == Renderer::LightSceneItem::LightType::DIRECTIONAL && lightItem.radius != 0.0f)
+							{
+								throw std::runtime_error("For directional light items the radius must be zero");
+							}
+							if (lightItem.innerAngle < 0.0f)
+							{
+								throw std::runtime_error("The inner spot light angle must be >= 0 degrees");
+							}
+							if (lightItem.outerAngle >= glm::radians(90.0f))
+							{
+								throw std::runtime_error("The outer spot light angle must be < 90 degrees");
+							}
+							if (lightItem.innerAngle >= lightItem.outerAngle)
+							{
+								throw std::runtime_error("The inner spot light angle must be smaller as the outer spot light angle");
+							}
+							if (lightItem.nearClipDistance < 0.0f)
+							{
+								throw std::runtime_error("The spot light near clip distance must be greater as zero");
+							}
+							if (lightItem.iesLightProfileIndex >= 0 && (rapidJsonValueItem.HasMember("InnerAngle") || rapidJsonValueItem.HasMember("OuterAngle")))
+							{
+								throw std::runtime_error("\"InnerAngle\" and \"OuterAngle\" are unused if \"IesLightProfileIndex\" is used");
+							}
+
+							// Write down
+							memoryFile.write(&lightItem, sizeof(Renderer::v1Scene::LightItem));
+							break;
+						}
+
+						case Renderer::SunlightSceneItem::TYPE_ID:
+						{
+							Renderer::v1Scene::SunlightItem sunlightItem;
+
+							// Read properties
+							RendererToolkit::JsonHelper::optionalTimeOfDayProperty(rapidJsonValueItem, "SunriseTime", sunlightItem.sunriseTime);
+							RendererToolkit::JsonHelper::optionalTimeOfDayProperty(rapidJsonValueItem, "SunsetTime", sunlightItem.sunsetTime);
+							RendererToolkit::JsonHelper::optionalAngleProperty(rapidJsonValueItem, "EastDirection", sunlightItem.eastDirection);
+							RendererToolkit::JsonHelper::optionalAngleProperty(rapidJsonValueItem, "AngleOfIncidence", sunlightItem.angleOfIncidence);
+							RendererToolkit::JsonHelper::optionalTimeOfDayProperty(rapidJsonValueItem, "TimeOfDay", sunlightItem.timeOfDay);
+
+							// Write down
+							memoryFile.write(&sunlightItem, sizeof(Renderer::v1Scene::SunlightItem));
+							break;
+						}
+
+						case Renderer::MeshSceneItem::TYPE_ID:
+						case Renderer::SkeletonMeshSceneItem::TYPE_ID:
+						{
+							// Skeleton mesh scene item
+							if (Renderer::SkeletonMeshSceneItem::TYPE_ID == typeId)
+							{
+								Renderer::v1Scene::SkeletonMeshItem skeletonMeshItem;
+
+								// Optional skeleton animation: Map the source asset ID to the compiled asset ID
+								skeletonMeshItem.skeletonAnimationAssetId = Renderer::getInvalid<Renderer::AssetId>();
+								RendererToolkit::JsonHelper::optionalCompiledAssetId(input, rapidJsonValueItem, "SkeletonAnimation", skeletonMeshItem.skeletonAnimationAssetId);
+
+								// Write down
+								memoryFile.write(&skeletonMeshItem, sizeof(Renderer::v1Scene::SkeletonMeshItem));
+							}
+
+							// Mesh scene item
+							Renderer::v1Scene::MeshItem meshItem;
+
+							// Map the source asset ID to the compiled asset ID
+							meshItem.meshAssetId = RendererToolkit::JsonHelper::getCompiledAssetId(input, rapidJsonValueItem, "Mesh");
+
+							// Optional sub-mesh material asset IDs to be able to overwrite the original material asset ID of sub-meshes
+							std::vector<Renderer::AssetId> subMeshMaterialAssetIds;
+							if (rapidJsonValueItem.HasMember("SubMeshMaterials"))
+							{
+								const rapidjson::Value& rapidJsonValueSubMeshMaterialAssetIds = rapidJsonValueItem["SubMeshMaterials"];
+								const uint32_t numberOfSubMeshMaterialAssetIds = rapidJsonValueSubMeshMaterialAssetIds.Size();
+								subMeshMaterialAssetIds.resize(numberOfSubMeshMaterialAssetIds);
+								for (uint32_t i = 0; i < numberOfSubMeshMaterialAssetIds; ++i)
+								{
+									// Empty string means "Don't overwrite the original material asset ID of the sub-mesh"
+									const std::string valueAsString = rapidJsonValueSubMeshMaterialAssetIds[i].GetString();
+									subMeshMaterialAssetIds[i] = valueAsString.empty() ? Renderer::getInvalid<Renderer::AssetId>() : RendererToolkit::StringHelper::getAssetIdByString(valueAsString, input);
+								}
+							}
+							meshItem.numberOfSubMeshMaterialAssetIds = static_cast<uint32_t>(subMeshMaterialAssetIds.size());
+
+							// Write down
+							memoryFile.write(&meshItem, sizeof(Renderer::v1Scene::MeshItem));
+							if (!subMeshMaterialAssetIds.empty())
+							{
+								// Write down all sub-mesh material asset IDs
+								memoryFile.write(subMeshMaterialAssetIds.data(), sizeof(Renderer::AssetId) * subMeshMaterialAssetIds.size());
+							}
+							break;
+						}
+
+						case Renderer::SkySceneItem::TYPE_ID:
+						{
+							Renderer::v1Scene::SkyItem skyItem;
+							::detail::readMaterialSceneItem(input, sortedMaterialPropertyVector, rapidJsonValueItem, skyItem);
+
+							// Write down
+							memoryFile.write(&skyItem, sizeof(Renderer::v1Scene::SkyItem));
+							if (!sortedMaterialPropertyVector.empty())
+							{
+								// Write down all material properties
+								memoryFile.write(sortedMaterialPropertyVector.data(), sizeof(Renderer::MaterialProperty) * sortedMaterialPropertyVector.size());
+							}
+							break;
+						}
+
+						case Renderer::VolumeSceneItem::TYPE_ID:
+						{
+							Renderer::v1Scene::VolumeItem volumeItem;
+							::detail::readMaterialSceneItem(input, sortedMaterialPropertyVector, rapidJsonValueItem, volumeItem);
+
+							// Write down
+							memoryFile.write(&volumeItem, sizeof(Renderer::v1Scene::VolumeItem));
+							if (!sortedMaterialPropertyVector.empty())
+							{
+								// Write down all material properties
+								memoryFile.write(sortedMaterialPropertyVector.data(), sizeof(Renderer::MaterialProperty) * sortedMaterialPropertyVector.size());
+							}
+							break;
+						}
+
+						case Renderer::GrassSceneItem::TYPE_ID:
+						{
+							Renderer::v1Scene::GrassItem grassItem;
+							::detail::readMaterialSceneItem(input, sortedMaterialPropertyVector, rapidJsonValueItem, grassItem);
+
+							// Write down
+							memoryFile.write(&grassItem, sizeof(Renderer::v1Scene::GrassItem));
+							if (!sortedMaterialPropertyVector.empty())
+							{
+								// Write down all material properties
+								memoryFile.write(sortedMaterialPropertyVector.data(), sizeof(Renderer::MaterialProperty) * sortedMaterialPropertyVector.size());
+							}
+							break;
+						}
+
+						case Renderer::TerrainSceneItem::TYPE_ID:
+						{
+							Renderer::v1Scene::TerrainItem terrainItem;
+							::detail::readMaterialSceneItem(input, sortedMaterialPropertyVector, rapidJsonValueItem, terrainItem);
+
+							// Write down
+							memoryFile.write(&terrainItem, sizeof(Renderer::v1Scene::TerrainItem));
+							if (!sortedMaterialPropertyVector.empty())
+							{
+								// Write down all material properties
+								memoryFile.write(sortedMaterialPropertyVector.data(), sizeof(Renderer::MaterialProperty) * sortedMaterialPropertyVector.size());
+							}
+							break;
+						}
+
+						case Renderer::ParticlesSceneItem::TYPE_ID:
+						{
+							Renderer::v1Scene::ParticlesItem particlesItem;
+							::detail::readMaterialSceneItem(input, sortedMaterialPropertyVector, rapidJsonValueItem, particlesItem);
+
+							// Write down
+							memoryFile.write(&particlesItem, sizeof(Renderer::v1Scene::ParticlesItem));
+							if (!sortedMaterialPropertyVector.empty())
+							{
+								// Write down all material properties
+								memoryFile.write(sortedMaterialPropertyVector.data(), sizeof(Renderer::MaterialProperty) * sortedMaterialPropertyVector.size());
+							}
+							break;
+						}
+					}
+				}
+			}
+		}
 
 //[-------------------------------------------------------]
 //[ Anonymous detail namespace                            ]
@@ -212,27 +492,61 @@ namespace RendererToolkit
 				rapidjson::Document rapidJsonDocument;
 				JsonHelper::loadDocumentByFilename(input.context.getFileManager(), virtualInputFilename, "SceneAsset", "1", rapidJsonDocument);
 
-				{ // Write down the scene resource header
-					Renderer::v1Scene::SceneHeader sceneHeader;
-					sceneHeader.unused = 42;	// TODO(co) Currently the scene header is unused
-					memoryFile.write(&sceneHeader, sizeof(Renderer::v1Scene::SceneHeader));
-				}
-
-				// Mandatory main sections of the material blueprint
+				// Mandatory main sections of the scene asset
 				const rapidjson::Value& rapidJsonValueSceneAsset = rapidJsonDocument["SceneAsset"];
 				const rapidjson::Value& rapidJsonValueNodes = rapidJsonValueSceneAsset["Nodes"];
 
+				// Optional main sections of the scene asset
+				const rapidjson::Value* rapidJsonValuePrefabs = rapidJsonValueSceneAsset.HasMember("Prefabs") ? &rapidJsonValueSceneAsset["Prefabs"] : nullptr;
+				const rapidjson::Value* rapidJsonValuePrefabInstances = rapidJsonValueSceneAsset.HasMember("PrefabInstances") ? &rapidJsonValueSceneAsset["PrefabInstances"] : nullptr;
+
 				// Sanity check
 				if (rapidJsonValueNodes.Empty())
 				{
 					throw std::runtime_error("Scene asset \"" + virtualInputFilename + "\" has no nodes");
 				}
 
+				// Gather the prefabs, key = prefab name as "Renderer::StringId", value = prefab index
+				typedef std::unordered_map<uint32_t, uint32_t> PrefabIndices;
+				PrefabIndices prefabIndices;
+				std::vector<uint32_t> prefabNumberOfItems;
+				if (nullptr != rapidJsonValuePrefabs)
+				{
+					for (rapidjson::Value::ConstMemberIterator rapidJsonMemberIteratorPrefabs = rapidJsonValuePrefabs->MemberBegin(); rapidJsonMemberIteratorPrefabs != rapidJsonValuePrefabs->MemberEnd(); ++rapidJsonMemberIteratorPrefabs)
+					{
+						const rapidjson::Value& rapidJsonValuePrefab = rapidJsonMemberIteratorPrefabs->value;
+						prefabIndices.emplace(Renderer::StringId(rapidJsonMemberIteratorPrefabs->name.GetString()), static_cast<uint32_t>(prefabNumberOfItems.size()));
+						prefabNumberOfItems.push_back(rapidJsonValuePrefab.HasMember("Items") ? rapidJsonValuePrefab["Items"].MemberCount() : 0);
+					}
+				}
+
+				{ // Write down the scene resource header
+					Renderer::v1Scene::SceneHeader sceneHeader;
+					sceneHeader.numberOfNodes			= rapidJsonValueNodes.Size();
+					sceneHeader.numberOfPrefabs			= static_cast<uint32_t>(prefabNumberOfItems.size());
+					sceneHeader.numberOfPrefabInstances	= (nullptr != rapidJsonValuePrefabInstances) ? rapidJsonValuePrefabInstances->Size() : 0;
+					sceneHeader.totalNumberOfNodes		= sceneHeader.numberOfNodes;
+					sceneHeader.totalNumberOfItems		= 0;
+					for (rapidjson::SizeType nodeIndex = 0; nodeIndex < sceneHeader.numberOfNodes; ++nodeIndex)
+					{
+						const rapidjson::Value& rapidJsonValueNode = rapidJsonValueNodes[nodeIndex];
+						if (rapidJsonValueNode.HasMember("Items"))
+						{
+							sceneHeader.totalNumberOfItems += rapidJsonValueNode["Items"].MemberCount();
+						}
+					}
+					for (uint32_t prefabInstancesIndex = 0; prefabInstancesIndex < sceneHeader.numberOfPrefabInstances; ++prefabInstancesIndex)
+					{
+						const rapidjson::Value& rapidJsonValuePrefabInstance = (*rapidJsonValuePrefabInstances)[prefabInstancesIndex];
+						const uint32_t numberOfInstances = rapidJsonValuePrefabInstance["Transforms"].Size();
+						sceneHeader.totalNumberOfNodes += numberOfInstances;
+						sceneHeader.totalNumberOfItems += numberOfInstances * prefabNumberOfItems[::detail::getPrefabIndex(prefabIndices, rapidJsonValuePrefabInstance)];
+					}
+					memoryFile.write(&sceneHeader, sizeof(Renderer::v1Scene::SceneHeader));
+				}
+
 				{ // Write down the scene nodes
 					const rapidjson::SizeType numberOfNodes = rapidJsonValueNodes.Size();
-					Renderer::v1Scene::Nodes nodes;
-					nodes.numberOfNodes = numberOfNodes;
-					memoryFile.write(&nodes, sizeof(Renderer::v1Scene::Nodes));
 
 					// Loop through all scene nodes
 					for (rapidjson::SizeType nodeIndex = 0; nodeIndex < numberOfNodes; ++nodeIndex)
@@ -243,16 +557,18 @@ namespace RendererToolkit
 						{ // Write down the scene node
 							Renderer::v1Scene::Node node;
 
-							// Get the scene node transform
+							// Get the scene node transform and the optional parent scene node
 							node.transform.scale = Renderer::Math::VEC3_ONE;
+							node.parentNodeIndex = Renderer::getInvalid<uint32_t>();
 							if (rapidJsonValueNode.HasMember("Properties"))
 							{
 								const rapidjson::Value& rapidJsonValueProperties = rapidJsonValueNode["Properties"];
-
-								// Position, rotation and scale
-								JsonHelper::optionalUnitNProperty(rapidJsonValueProperties, "Position", &node.transform.position.x, 3);
-								JsonHelper::optionalRotationQuaternionProperty(rapidJsonValueProperties, "Rotation", node.transform.rotation);
-								JsonHelper::optionalFactorNProperty(rapidJsonValueProperties, "Scale", &node.transform.scale.x, 3);
+								::detail::readTransform(rapidJsonValueProperties, node.transform);
+								JsonHelper::optionalIntegerProperty(rapidJsonValueProperties, "Parent", node.parentNodeIndex);
+								if (Renderer::isValid(node.parentNodeIndex) && node.parentNodeIndex >= nodeIndex)
+								{
+									throw std::runtime_error("Scene asset \"" + virtualInputFilename + "\" node " + std::to_string(nodeIndex) + " parent node index must be smaller as the node index");
+								}
 							}
 
 							// Write down the scene node
@@ -263,264 +579,59 @@ namespace RendererToolkit
 						// Write down the scene items
 						if (nullptr != rapidJsonValueItems)
 						{
-							for (rapidjson::Value::ConstMemberIterator rapidJsonMemberIteratorItems = rapidJsonValueItems->MemberBegin(); rapidJsonMemberIteratorItems != rapidJsonValueItems->MemberEnd(); ++rapidJsonMemberIteratorItems)
-							{
-								const rapidjson::Value& rapidJsonValueItem = rapidJsonMemberIteratorItems->value;
-								const Renderer::SceneItemTypeId typeId = Renderer::StringId(rapidJsonMemberIteratorItems->name.GetString());
-
-								// Get the scene item type specific data number of bytes
-								// TODO(co) Make this more generic via scene factory
-								uint32_t numberOfBytes = 0;
-								Renderer::MaterialProperties::SortedPropertyVector sortedMaterialPropertyVector;
-								switch (typeId)
-								{
-									case Renderer::CameraSceneItem::TYPE_ID:
-										// Nothing here
-										break;
-
-									case Renderer::LightSceneItem::TYPE_ID:
-										numberOfBytes = sizeof(Renderer::v1Scene::LightItem);
-										break;
-
-									case Renderer::SunlightSceneItem::TYPE_ID:
-										numberOfBytes = sizeof(Renderer::v1Scene::SunlightItem);
-										break;
-
-									case Renderer::MeshSceneItem::TYPE_ID:
-									case Renderer::SkeletonMeshSceneItem::TYPE_ID:
-									{
-										const uint32_t numberOfSubMeshMaterialAssetIds = rapidJsonValueItem.HasMember("SubMeshMaterials") ? rapidJsonValueItem["SubMeshMaterials"].Size() : 0;
-										numberOfBytes = sizeof(Renderer::v1Scene::MeshItem) + sizeof(Renderer::AssetId) * numberOfSubMeshMaterialAssetIds;
-										if (Renderer::SkeletonMeshSceneItem::TYPE_ID == typeId)
-										{
-											numberOfBytes += sizeof(Renderer::v1Scene::SkeletonMeshItem);
-										}
-										break;
-									}
-
-									case Renderer::SkySceneItem::TYPE_ID:
-									case Renderer::VolumeSceneItem::TYPE_ID:
-									case Renderer::GrassSceneItem::TYPE_ID:
-									case Renderer::TerrainSceneItem::TYPE_ID:
-									case Renderer::ParticlesSceneItem::TYPE_ID:
-										::detail::fillSortedMaterialPropertyVector(input, rapidJsonValueItem, sortedMaterialPropertyVector);
-										numberOfBytes = static_cast<uint32_t>(sizeof(Renderer::v1Scene::MaterialItem) + sizeof(Renderer::MaterialProperty) * sortedMaterialPropertyVector.size());
-										break;
-
-									default:
-										// Error!
-										throw std::runtime_error("Scene item type \"" + std::string(rapidJsonMemberIteratorItems->name.GetString()) + "\" is unknown");
-								}
+							::detail::writeSceneItems(input, *rapidJsonValueItems, memoryFile);
+						}
+					}
+				}
 
-								{ // Write down the scene item header
-									Renderer::v1Scene::ItemHeader itemHeader;
-									itemHeader.typeId		 = typeId;
-									itemHeader.numberOfBytes = numberOfBytes;
-									memoryFile.write(&itemHeader, sizeof(Renderer::v1Scene::ItemHeader));
-								}
+				// Write down the prefabs
+				if (nullptr != rapidJsonValuePrefabs)
+				{
+					for (rapidjson::Value::ConstMemberIterator rapidJsonMemberIteratorPrefabs = rapidJsonValuePrefabs->MemberBegin(); rapidJsonMemberIteratorPrefabs != rapidJsonValuePrefabs->MemberEnd(); ++rapidJsonMemberIteratorPrefabs)
+					{
+						const rapidjson::Value& rapidJsonValuePrefab = rapidJsonMemberIteratorPrefabs->value;
 
-								// Write down the scene item type specific data, if there is any
-								if (0 != numberOfBytes)
-								{
-									switch (typeId)
-									{
-										case Renderer::CameraSceneItem::TYPE_ID:
-											// Nothing here
-											break;
-
-										case Renderer::LightSceneItem::TYPE_ID:
-										{
-											Renderer::v1Scene::LightItem lightItem;
-
-											// Read properties
-											::detail::optionalLightTypeProperty(rapidJsonValueItem, "LightType", lightItem.lightType);
-											JsonHelper::optionalRgbColorProperty(rapidJsonValueItem, "Color", lightItem.color);
-											JsonHelper::optionalUnitNProperty(rapidJsonValueItem, "Radius", &lightItem.radius, 1);
-											JsonHelper::optionalAngleProperty(rapidJsonValueItem, "InnerAngle", lightItem.innerAngle);
-											JsonHelper::optionalAngleProperty(rapidJsonValueItem, "OuterAngle", lightItem.outerAngle);
-											JsonHelper::optionalUnitNProperty(rapidJsonValueItem, "NearClipDistance", &lightItem.nearClipDistance, 1);
-											JsonHelper::optionalIntegerNProperty(rapidJsonValueItem, "IesLightProfileIndex", &lightItem.iesLightProfileIndex, 1);
-
-											// Sanity checks
-											if (lightItem.color[0] < 0.0f || lightItem.color[1] < 0.0f || lightItem.color[2] < 0.0f)
-											{
-												throw std::runtime_error("All light item color components must be positive");
-											}
-											if (lightItem.lightType != Renderer::LightSceneItem::LightType::DIRECTIONAL && lightItem.radius <= 0.0f)
-											{
-												throw std::runtime_error("For point or spot light items the radius must be greater as zero");
-											}
-											if (lightItem.lightType == Renderer::LightSceneItem::LightType::DIRECTIONAL && lightItem.radius != 0.0f)
-											{
-												throw std::runtime_error("For directional light items the radius must be zero");
-											}
-											if (lightItem.innerAngle < 0.0f)
-											{
-												throw std::runtime_error("The inner spot light angle must be >= 0 degrees");
-											}
-											if (lightItem.outerAngle >= glm::radians(90.0f))
-											{
-												throw std::runtime_error("The outer spot light angle must be < 90 degrees");
-											}
-											if (lightItem.innerAngle >= lightItem.outerAngle)
-											{
-												throw std::runtime_error("The inner spot light angle must be smaller as the outer spot light angle");
-											}
-											if (lightItem.nearClipDistance < 0.0f)
-											{
-												throw std::runtime_error("The spot light near clip distance must be greater as zero");
-											}
-											if (lightItem.iesLightProfileIndex >= 0 && (rapidJsonValueItem.HasMember("InnerAngle") || rapidJsonValueItem.HasMember("OuterAngle")))
-											{
-												throw std::runtime_error("\"InnerAngle\" and \"OuterAngle\" are unused if \"IesLightProfileIndex\" is used");
-											}
-
-											// Write down
-											memoryFile.write(&lightItem, sizeof(Renderer::v1Scene::LightItem));
-											break;
-										}
-
-										case Renderer::SunlightSceneItem::TYPE_ID:
-										{
-											Renderer::v1Scene::SunlightItem sunlightItem;
-
-											// Read properties
-											JsonHelper::optionalTimeOfDayProperty(rapidJsonValueItem, "SunriseTime", sunlightItem.sunriseTime);
-											JsonHelper::optionalTimeOfDayProperty(rapidJsonValueItem, "SunsetTime", sunlightItem.sunsetTime);
-											JsonHelper::optionalAngleProperty(rapidJsonValueItem, "EastDirection", sunlightItem.eastDirection);
-											JsonHelper::optionalAngleProperty(rapidJsonValueItem, "AngleOfIncidence", sunlightItem.angleOfIncidence);
-											JsonHelper::optionalTimeOfDayProperty(rapidJsonValueItem, "TimeOfDay", sunlightItem.timeOfDay);
-
-											// Write down
-											memoryFile.write(&sunlightItem, sizeof(Renderer::v1Scene::SunlightItem));
-											break;
-										}
-
-										case Renderer::MeshSceneItem::TYPE_ID:
-										case Renderer::SkeletonMeshSceneItem::TYPE_ID:
-										{
-											// Skeleton mesh scene item
-											if (Renderer::SkeletonMeshSceneItem::TYPE_ID == typeId)
-											{
-												Renderer::v1Scene::SkeletonMeshItem skeletonMeshItem;
-
-												// Optional skeleton animation: Map the source asset ID to the compiled asset ID
-												skeletonMeshItem.skeletonAnimationAssetId = Renderer::getInvalid<Renderer::AssetId>();
-												JsonHelper::optionalCompiledAssetId(input, rapidJsonValueItem, "SkeletonAnimation", skeletonMeshItem.skeletonAnimationAssetId);
-
-												// Write down
-												memoryFile.write(&skeletonMeshItem, sizeof(Renderer::v1Scene::SkeletonMeshItem));
-											}
-
-											// Mesh scene item
-											Renderer::v1Scene::MeshItem meshItem;
-
-											// Map the source asset ID to the compiled asset ID
-											meshItem.meshAssetId = JsonHelper::getCompiledAssetId(input, rapidJsonValueItem, "Mesh");
-
-											// Optional sub-mesh material asset IDs to be able to overwrite the original material asset ID of sub-meshes
-											std::vector<Renderer::AssetId> subMeshMaterialAssetIds;
-											if (rapidJsonValueItem.HasMember("SubMeshMaterials"))
-											{
-												const rapidjson::Value& rapidJsonValueSubMeshMaterialAssetIds = rapidJsonValueItem["SubMeshMaterials"];
-												const uint32_t numberOfSubMeshMaterialAssetIds = rapidJsonValueSubMeshMaterialAssetIds.Size();
-												subMeshMaterialAssetIds.resize(numberOfSubMeshMaterialAssetIds);
-												for (uint32_t i = 0; i < numberOfSubMeshMaterialAssetIds; ++i)
-												{
-													// Empty string means "Don't overwrite the original material asset ID of the sub-mesh"
-													const std::string valueAsString = rapidJsonValueSubMeshMaterialAssetIds[i].GetString();
-													subMeshMaterialAssetIds[i] = valueAsString.empty() ? Renderer::getInvalid<Renderer::AssetId>() : StringHelper::getAssetIdByString(valueAsString, input);
-												}
-											}
-											meshItem.numberOfSubMeshMaterialAssetIds = static_cast<uint32_t>(subMeshMaterialAssetIds.size());
-
-											// Write down
-											memoryFile.write(&meshItem, sizeof(Renderer::v1Scene::MeshItem));
-											if (!subMeshMaterialAssetIds.empty())
-											{
-												// Write down all sub-mesh material asset IDs
-												memoryFile.write(subMeshMaterialAssetIds.data(), sizeof(Renderer::AssetId) * subMeshMaterialAssetIds.size());
-											}
-											break;
-										}
-
-										case Renderer::SkySceneItem::TYPE_ID:
-										{
-											Renderer::v1Scene::SkyItem skyItem;
-											::detail::readMaterialSceneItem(input, sortedMaterialPropertyVector, rapidJsonValueItem, skyItem);
-
-											// Write down
-											memoryFile.write(&skyItem, sizeof(Renderer::v1Scene::SkyItem));
-											if (!sortedMaterialPropertyVector.empty())
-											{
-												// Write down all material properties
-												memoryFile.write(sortedMaterialPropertyVector.data(), sizeof(Renderer::MaterialProperty) * sortedMaterialPropertyVector.size());
-											}
-											break;
-										}
-
-										case Renderer::VolumeSceneItem::TYPE_ID:
-										{
-											Renderer::v1Scene::VolumeItem volumeItem;
-											::detail::readMaterialSceneItem(input, sortedMaterialPropertyVector, rapidJsonValueItem, volumeItem);
-
-											// Write down
-											memoryFile.write(&volumeItem, sizeof(Renderer::v1Scene::VolumeItem));
-											if (!sortedMaterialPropertyVector.empty())
-											{
-												// Write down all material properties
-												memoryFile.write(sortedMaterialPropertyVector.data(), sizeof(Renderer::MaterialProperty) * sortedMaterialPropertyVector.size());
-											}
-											break;
-										}
-
-										case Renderer::GrassSceneItem::TYPE_ID:
-										{
-											Renderer::v1Scene::GrassItem grassItem;
-											::detail::readMaterialSceneItem(input, sortedMaterialPropertyVector, rapidJsonValueItem, grassItem);
-
-											// Write down
-											memoryFile.write(&grassItem, sizeof(Renderer::v1Scene::GrassItem));
-											if (!sortedMaterialPropertyVector.empty())
-											{
-												// Write down all material properties
-												memoryFile.write(sortedMaterialPropertyVector.data(), sizeof(Renderer::MaterialProperty) * sortedMaterialPropertyVector.size());
-											}
-											break;
-										}
-
-										case Renderer::TerrainSceneItem::TYPE_ID:
-										{
-											Renderer::v1Scene::TerrainItem terrainItem;
-											::detail::readMaterialSceneItem(input, sortedMaterialPropertyVector, rapidJsonValueItem, terrainItem);
-
-											// Write down
-											memoryFile.write(&terrainItem, sizeof(Renderer::v1Scene::TerrainItem));
-											if (!sortedMaterialPropertyVector.empty())
-											{
-												// Write down all material properties
-												memoryFile.write(sortedMaterialPropertyVector.data(), sizeof(Renderer::MaterialProperty) * sortedMaterialPropertyVector.size());
-											}
-											break;
-										}
-
-										case Renderer::ParticlesSceneItem::TYPE_ID:
-										{
-											Renderer::v1Scene::ParticlesItem particlesItem;
-											::detail::readMaterialSceneItem(input, sortedMaterialPropertyVector, rapidJsonValueItem, particlesItem);
-
-											// Write down
-											memoryFile.write(&particlesItem, sizeof(Renderer::v1Scene::ParticlesItem));
-											if (!sortedMaterialPropertyVector.empty())
-											{
-												// Write down all material properties
-												memoryFile.write(sortedMaterialPropertyVector.data(), sizeof(Renderer::MaterialProperty) * sortedMaterialPropertyVector.size());
-											}
-											break;
-										}
-									}
-								}
-							}
+						// Write down the prefab header, the number of bytes is known after the scene items have been written down
+						const size_t prefabOffset = memoryFile.getByteVector().size();
+						Renderer::v1Scene::Prefab prefab;
+						prefab.numberOfItems = rapidJsonValuePrefab.HasMember("Items") ? rapidJsonValuePrefab["Items"].MemberCount() : 0;
+						prefab.numberOfBytes = 0;
+						memoryFile.write(&prefab, sizeof(Renderer::v1Scene::Prefab));
+
+						// Write down the scene items
+						if (0 != prefab.numberOfItems)
+						{
+							::detail::writeSceneItems(input, rapidJsonValuePrefab["Items"], memoryFile);
+							prefab.numberOfBytes = static_cast<uint32_t>(memoryFile.getByteVector().size() - prefabOffset - sizeof(Renderer::v1Scene::Prefab));
+							memcpy(memoryFile.getByteVector().data() + prefabOffset, &prefab, sizeof(Renderer::v1Scene::Prefab));
+						}
+					}
+				}
+
+				// Write down the prefab instances
+				if (nullptr != rapidJsonValuePrefabInstances)
+				{
+					const rapidjson::SizeType numberOfPrefabInstances = rapidJsonValuePrefabInstances->Size();
+					for (rapidjson::SizeType prefabInstancesIndex = 0; prefabInstancesIndex < numberOfPrefabInstances; ++prefabInstancesIndex)
+					{
+						const rapidjson::Value& rapidJsonValuePrefabInstance = (*rapidJsonValuePrefabInstances)[prefabInstancesIndex];
+						const rapidjson::Value& rapidJsonValueTransforms = rapidJsonValuePrefabInstance["Transforms"];
+
+						{ // Write down the prefab instances header
+							Renderer::v1Scene::PrefabInstances prefabInstances;
+							prefabInstances.prefabIndex			= ::detail::getPrefabIndex(prefabIndices, rapidJsonValuePrefabInstance);
+							prefabInstances.numberOfInstances	= rapidJsonValueTransforms.Size();
+							memoryFile.write(&prefabInstances, sizeof(Renderer::v1Scene::PrefabInstances));
+						}
+
+						// Write down the compact array of instance transforms
+						const rapidjson::SizeType numberOfInstances = rapidJsonValueTransforms.Size();
+						for (rapidjson::SizeType instanceIndex = 0; instanceIndex < numberOfInstances; ++instanceIndex)
+						{
+							Renderer::Transform transform;
+							transform.scale = Renderer::Math::VEC3_ONE;
+							::detail::readTransform(rapidJsonValueTransforms[instanceIndex], transform);
+							memoryFile.write(&transform, sizeof(Renderer::Transform));
 						}
 					}
 				}
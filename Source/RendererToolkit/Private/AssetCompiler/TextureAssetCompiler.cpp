@@ -31,6 +31,7 @@
 #include <Renderer/Public/Core/File/MemoryFile.h>
 #include <Renderer/Public/Core/File/IFileManager.h>
 #include <Renderer/Public/Core/File/FileSystemHelper.h>
+#include <Renderer/Public/Core/Time/Stopwatch.h>
 #include <Renderer/Public/Resource/Texture/Loader/CrnArrayFileFormat.h>
 #include <Renderer/Public/Resource/Texture/Loader/Lz4DdsTextureResourceLoader.h>
 
@@ -44,6 +45,20 @@ PRAGMA_WARNING_PUSH
 	#include <glm/gtc/constants.hpp>
 PRAGMA_WARNING_POP
 
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4100)	// warning C4100: 'address': unreferenced formal parameter
+	PRAGMA_WARNING_DISABLE_MSVC(4242)	// warning C4242: '=': conversion from 'int' to 'T', possible loss of data
+	PRAGMA_WARNING_DISABLE_MSVC(4244)	// warning C4244: '=': conversion from 'int' to 'T', possible loss of data
+	PRAGMA_WARNING_DISABLE_MSVC(4324)	// warning C4324: 'xsimd::hadd::<unnamed-tag>': structure was padded due to alignment specifier
+	PRAGMA_WARNING_DISABLE_MSVC(4365)	// warning C4365: '=': conversion from 'uint32_t' to 'int32_t', signed/unsigned mismatch
+	PRAGMA_WARNING_DISABLE_MSVC(4464)	// warning C4464: relative include path contains '..'
+	PRAGMA_WARNING_DISABLE_MSVC(4505)	// warning C4505: 'xsimd::detail::__ieee754_rem_pio2': unreferenced local function has been removed
+	#define XSIMD_INSTR_SET_NOT_AVAILABLE 0	// warning C4668: 'XSIMD_INSTR_SET_NOT_AVAILABLE' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
+	#define XSIMD_FORCE_X86_INSTR_SET XSIMD_X86_SSE4_2_VERSION	// Same as the renderer scene culling, see "Renderer::SceneItemSet"
+	#include <xsimd/xsimd.hpp>
+PRAGMA_WARNING_POP
+
 // Disable warnings in external headers, we can't fix them
 PRAGMA_WARNING_PUSH
 	PRAGMA_WARNING_DISABLE_MSVC(4005)						// warning C4005: '_HAS_EXCEPTIONS': macro redefinition
@@ -97,11 +112,12 @@ PRAGMA_WARNING_POP
 
 // Disable warnings in external headers, we can't fix them
 PRAGMA_WARNING_PUSH
-	PRAGMA_WARNING_DISABLE_MSVC(4625)	// warning C4625: 'std::atomic_flag': copy constructor was implicitly defined as deleted
-	PRAGMA_WARNING_DISABLE_MSVC(4626)	// warning C4626: 'std::atomic_flag': assignment operator was implicitly defined as deleted
-	PRAGMA_WARNING_DISABLE_MSVC(5026)	// warning C5026: 'std::atomic_flag': move constructor was implicitly defined as deleted
-	PRAGMA_WARNING_DISABLE_MSVC(5027)	// warning C5027: 'std::atomic_flag': move assignment operator was implicitly defined as deleted
-	#include <atomic>
+	PRAGMA_WARNING_DISABLE_MSVC(4625)	// warning C4625: 'std::mutex': copy constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4626)	// warning C4626: 'std::mutex': assignment operator was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(5026)	// warning C5026: 'std::mutex': move constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(5027)	// warning C5027: 'std::mutex': move assignment operator was implicitly defined as deleted
+	#include <mutex>
+	#include <future>
 PRAGMA_WARNING_POP
 
 
@@ -110,6 +126,98 @@ PRAGMA_WARNING_POP
 //[-------------------------------------------------------]
 namespace
 {
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Global definitions                                    ]
+		//[-------------------------------------------------------]
+		static constexpr size_t MINIMUM_NUMBER_OF_ROWS_PER_THREAD = 64;	///< Images with less rows aren't worth the threading overhead
+
+
+		//[-------------------------------------------------------]
+		//[ Global functions                                      ]
+		//[-------------------------------------------------------]
+		/**
+		*  @brief
+		*    Data parallel for-loop over the items [0, itemCount) using at most the given number of threads, including the calling thread
+		*
+		*  @param[in] numberOfThreads
+		*    Maximum number of threads to use, one means processing on the calling thread
+		*  @param[in] itemCount
+		*    Number of items, e.g. image rows or cube map faces
+		*  @param[in] splitCount
+		*    Minimum number of items a thread should work on, no additional threads are used for less items
+		*  @param[in] function
+		*    Function with the signature "void(size_t startItem, size_t endItem)" processing the item range [startItem, endItem)
+		*
+		*  @note
+		*    - Exceptions thrown by the function are rethrown on the calling thread
+		*    - The number of threads is the thread budget of a single asset compilation, which is already reduced by the caller when assets are compiled in parallel
+		*/
+		template <typename FUNCTION>
+		void parallelFor(uint32_t numberOfThreads, size_t itemCount, size_t splitCount, const FUNCTION& function)
+		{
+			if (numberOfThreads <= 1 || itemCount <= splitCount)
+			{
+				// Not worth the effort
+				function(size_t(0), itemCount);
+			}
+			else
+			{
+				// Split the items into packages, clamp the number of packages to the number of threads
+				size_t threadCount = (itemCount + splitCount - 1) / splitCount;
+				if (threadCount > numberOfThreads)
+				{
+					threadCount = numberOfThreads;
+					splitCount = itemCount / threadCount;
+				}
+
+				// Start the additional calculation threads, the calling thread processes the last package which has to do all the rest of the remaining work
+				std::vector<std::future<void>> futures;
+				futures.reserve(threadCount - 1);
+				size_t startItem = 0;
+				for (size_t threadIndex = 0; threadIndex < threadCount - 1; ++threadIndex)
+				{
+					futures.push_back(std::async(std::launch::async, [&function, startItem, splitCount]() { function(startItem, startItem + splitCount); }));
+					startItem += splitCount;
+				}
+				std::exception_ptr exceptionPtr;
+				try
+				{
+					function(startItem, itemCount);
+				}
+				catch (const std::exception&)
+				{
+					exceptionPtr = std::current_exception();
+				}
+
+				// Wait that all worker threads have done their part of the calculation and rethrow exceptions
+				for (std::future<void>& future : futures)
+				{
+					try
+					{
+						future.get();
+					}
+					catch (const std::exception&)
+					{
+						if (nullptr == exceptionPtr)
+						{
+							exceptionPtr = std::current_exception();
+						}
+					}
+				}
+				if (nullptr != exceptionPtr)
+				{
+					std::rethrow_exception(exceptionPtr);
+				}
+			}
+		}
+
+
+	} // detail
+
 	// Create Toksvig specular anti-aliasing to reduce shimmering
 	// -> Basing on "Specular Showdown in the Wild West" by Stephen Hill - http://blog.selfshadow.com/2011/07/22/specular-showdown/ - http://www.selfshadow.com/sandbox/toksvig.html
 	namespace toksvig
@@ -123,6 +231,25 @@ namespace
 		static constexpr float POWER = 100.0f;	///< Power {label:"Glossiness", default:100, min:0, max:256, step:1}
 		static constexpr float SIGMA = 0.5f;	///< Sigma {label:"Filter width", default:0.5, step:0.02}
 
+		typedef xsimd::simd_type<float> float4;	///< "float4::size" Toksvig filter texels are processed at once
+		typedef std::vector<float, xsimd::aligned_allocator<float, XSIMD_DEFAULT_ALIGNMENT>> FloatVector;
+		static constexpr size_t SIMD_SIZE = float4::size;
+
+		/**
+		*  @brief
+		*    Decoded and normalized normal map row as structure of arrays
+		*
+		*  @note
+		*    - Element 0 is the clamped texel left of the row and element "width + 1" and all following padding elements are the clamped texel right
+		*      of the row, so the 3x3 filter can load the previous, current and next texels of "float4::size" texels at once without bounds checks
+		*/
+		struct NormalRow final
+		{
+			FloatVector x;
+			FloatVector y;
+			FloatVector z;
+		};
+
 
 		//[-------------------------------------------------------]
 		//[ Global functions                                      ]
@@ -133,76 +260,170 @@ namespace
 			return exp(-glm::dot(offset, offset) / v) / (glm::pi<float>() * v);
 		}
 
-		[[nodiscard]] glm::vec4 fetch(crnlib::image_u8& normalMapCrunchImage, const glm::vec2& position, const glm::vec2& offset)
+		[[nodiscard]] inline size_t alignToSimdLaneCount(size_t value)
 		{
-			const crnlib::color_quad_u8& crunchColor = normalMapCrunchImage.get_clamped(static_cast<int>(position.x + offset.x), static_cast<int>(position.y + offset.y));
-			const glm::vec3 n((crunchColor.r / 255.0f) * 2.0f - 1.0f, (crunchColor.g / 255.0f) * 2.0f - 1.0f, (crunchColor.b / 255.0f) * 2.0f - 1.0f);
-			return glm::vec4(glm::normalize(n), 1.0f) * gaussianWeight(offset);
+			return (value + SIMD_SIZE - 1) / SIMD_SIZE * SIMD_SIZE;
 		}
 
-		[[nodiscard]] float calculateToksvig(crnlib::image_u8& normalMapCrunchImage, const glm::vec2& position, float power)
+		void decodeNormalRow(const crnlib::image_u8& normalMapCrunchImage, crnlib::uint y, NormalRow& normalRow)
 		{
-			// 3x3 filter
-			glm::vec4 n = fetch(normalMapCrunchImage, position, glm::vec2(-1.0f, -1.0f));
-			n += fetch(normalMapCrunchImage, position, glm::vec2( 0.0f, -1.0f));
-			n += fetch(normalMapCrunchImage, position, glm::vec2( 1.0f, -1.0f));
-
-			n += fetch(normalMapCrunchImage, position, glm::vec2(-1.0f,  0.0f));
-			n += fetch(normalMapCrunchImage, position, glm::vec2( 0.0f,  0.0f));
-			n += fetch(normalMapCrunchImage, position, glm::vec2( 1.0f,  0.0f));
-
-			n += fetch(normalMapCrunchImage, position, glm::vec2(-1.0f,  1.0f));
-			n += fetch(normalMapCrunchImage, position, glm::vec2( 0.0f,  1.0f));
-			n += fetch(normalMapCrunchImage, position, glm::vec2( 1.0f,  1.0f));
-
-			// Divide by weight sum
-			n.x /= n.w;
-			n.y /= n.w;
-			n.z /= n.w;
-
-			// Toksvig factor
-			const float length = glm::length(glm::vec3(n));
-			return length / glm::mix(power, 1.0f, length);
+			const size_t width = normalMapCrunchImage.get_width();
+			const size_t numberOfElements = alignToSimdLaneCount(width) + SIMD_SIZE;
+			normalRow.x.resize(numberOfElements);
+			normalRow.y.resize(numberOfElements);
+			normalRow.z.resize(numberOfElements);
+			float* RESTRICT normalX = normalRow.x.data();
+			float* RESTRICT normalY = normalRow.y.data();
+			float* RESTRICT normalZ = normalRow.z.data();
+
+			// Unpack the 8-bit texels including the clamped border and padding texels
+			const crnlib::color_quad_u8* crunchColors = normalMapCrunchImage.get_scanline(y);
+			for (size_t i = 0; i < numberOfElements; ++i)
+			{
+				const crnlib::color_quad_u8& crunchColor = crunchColors[std::min(std::max(i, size_t(1)), width) - 1];
+				normalX[i] = (crunchColor.r / 255.0f) * 2.0f - 1.0f;
+				normalY[i] = (crunchColor.g / 255.0f) * 2.0f - 1.0f;
+				normalZ[i] = (crunchColor.b / 255.0f) * 2.0f - 1.0f;
+			}
+
+			// Normalize, same operations as "glm::normalize()"
+			for (size_t i = 0; i < numberOfElements; i += SIMD_SIZE)
+			{
+				const float4 x = xsimd::load_aligned(&normalX[i]);
+				const float4 y = xsimd::load_aligned(&normalY[i]);
+				const float4 z = xsimd::load_aligned(&normalZ[i]);
+				const float4 inverseLength = float4(1.0f) / xsimd::sqrt(x * x + y * y + z * z);
+				xsimd::store_aligned(&normalX[i], x * inverseLength);
+				xsimd::store_aligned(&normalY[i], y * inverseLength);
+				xsimd::store_aligned(&normalZ[i], z * inverseLength);
+			}
 		}
 
-		void createToksvigRoughnessMap(const crnlib::mip_level& normalMapCrunchMipLevel, crnlib::mip_level& toksvigCrunchMipLevel)
+		/**
+		*  @brief
+		*    Calculate the Toksvig factor of the normal map texels inside the rows [startY, endY)
+		*
+		*  @param[in] normalMapCrunchImage
+		*    Normal map image to calculate the Toksvig factor for
+		*  @param[in] startY
+		*    First row to process
+		*  @param[in] endY
+		*    One after the last row to process
+		*  @param[in] function
+		*    Function with the signature "void(crnlib::uint x, crnlib::uint y, float toksvig)" receiving the unclamped Toksvig factor of each texel
+		*
+		*  @note
+		*    - The 3x3 Gaussian filter weights are constant, so they're calculated once instead of per texel and tap
+		*    - A rolling window of three decoded and normalized normal map rows is used, so each texel is decoded only once instead of nine times
+		*    - The filter processes "float4::size" texels at once, the floating point operations are the same as the ones of the former scalar "glm::vec3" implementation
+		*/
+		template <typename FUNCTION>
+		void calculateToksvigRows(const crnlib::image_u8& normalMapCrunchImage, crnlib::uint startY, crnlib::uint endY, float power, const FUNCTION& function)
+		{
+			const crnlib::uint width = normalMapCrunchImage.get_width();
+			const int height = static_cast<int>(normalMapCrunchImage.get_height());
+
+			// 3x3 Gaussian filter weights, the weight sum is the same for all texels since clamped taps are weighted as well
+			float4 weights[3][3];
+			float weightSum = 0.0f;
+			for (int offsetY = -1; offsetY <= 1; ++offsetY)
+			{
+				for (int offsetX = -1; offsetX <= 1; ++offsetX)
+				{
+					const float weight = gaussianWeight(glm::vec2(offsetX, offsetY));
+					weights[offsetY + 1][offsetX + 1] = float4(weight);
+					weightSum += weight;
+				}
+			}
+			const float4 simdWeightSum(weightSum);
+			const float4 simdPower(power);
+			const float4 simdOne(1.0f);
+
+			// Rolling window of three decoded and normalized normal map rows: Previous, current and next row
+			NormalRow rows[3];
+			const auto decodeRow = [&normalMapCrunchImage, height](int y, NormalRow& normalRow)
+			{
+				decodeNormalRow(normalMapCrunchImage, static_cast<crnlib::uint>(glm::clamp(y, 0, height - 1)), normalRow);
+			};
+			decodeRow(static_cast<int>(startY) - 1, rows[0]);
+			decodeRow(static_cast<int>(startY), rows[1]);
+			decodeRow(static_cast<int>(startY) + 1, rows[2]);
+
+			// Filter
+			alignas(XSIMD_DEFAULT_ALIGNMENT) float toksvig[SIMD_SIZE];
+			for (crnlib::uint y = startY; y < endY; ++y)
+			{
+				for (crnlib::uint x = 0; x < width; x += static_cast<crnlib::uint>(SIMD_SIZE))
+				{
+					// 3x3 filter, element "x" is the previous texel, "x + 1" the current texel and "x + 2" the next texel due to the left border texel
+					float4 nX(0.0f);
+					float4 nY(0.0f);
+					float4 nZ(0.0f);
+					for (int row = 0; row < 3; ++row)
+					{
+						const NormalRow& normalRow = rows[row];
+						const float4* rowWeights = weights[row];
+						nX += xsimd::load_unaligned(&normalRow.x[x]) * rowWeights[0] + xsimd::load_unaligned(&normalRow.x[x + 1]) * rowWeights[1] + xsimd::load_unaligned(&normalRow.x[x + 2]) * rowWeights[2];
+						nY += xsimd::load_unaligned(&normalRow.y[x]) * rowWeights[0] + xsimd::load_unaligned(&normalRow.y[x + 1]) * rowWeights[1] + xsimd::load_unaligned(&normalRow.y[x + 2]) * rowWeights[2];
+						nZ += xsimd::load_unaligned(&normalRow.z[x]) * rowWeights[0] + xsimd::load_unaligned(&normalRow.z[x + 1]) * rowWeights[1] + xsimd::load_unaligned(&normalRow.z[x + 2]) * rowWeights[2];
+					}
+
+					// Divide by weight sum
+					nX /= simdWeightSum;
+					nY /= simdWeightSum;
+					nZ /= simdWeightSum;
+
+					// Toksvig factor, "glm::mix(power, 1.0f, length)" is "power * (1.0f - length) + length"
+					const float4 length = xsimd::sqrt(nX * nX + nY * nY + nZ * nZ);
+					xsimd::store_aligned(toksvig, length / (simdPower * (simdOne - length) + length));
+					const crnlib::uint numberOfTexels = std::min(width - x, static_cast<crnlib::uint>(SIMD_SIZE));
+					for (crnlib::uint i = 0; i < numberOfTexels; ++i)
+					{
+						function(x + i, y, toksvig[i]);
+					}
+				}
+
+				// Move the rolling window one row down
+				std::swap(rows[0], rows[1]);
+				std::swap(rows[1], rows[2]);
+				decodeRow(static_cast<int>(y) + 2, rows[2]);
+			}
+		}
+
+		void createToksvigRoughnessMap(const crnlib::mip_level& normalMapCrunchMipLevel, crnlib::mip_level& toksvigCrunchMipLevel, uint32_t numberOfThreads)
 		{
-			const crnlib::uint width = normalMapCrunchMipLevel.get_width();
-			const crnlib::uint height = normalMapCrunchMipLevel.get_height();
 			crnlib::image_u8* normalMapCrunchImage = normalMapCrunchMipLevel.get_image();
 			crnlib::image_u8* crunchImage = toksvigCrunchMipLevel.get_image();
-			for (crnlib::uint y = 0; y < height; ++y)
+			::detail::parallelFor(numberOfThreads, normalMapCrunchMipLevel.get_height(), ::detail::MINIMUM_NUMBER_OF_ROWS_PER_THREAD, [normalMapCrunchImage, crunchImage](size_t startY, size_t endY)
 			{
-				for (crnlib::uint x = 0; x < width; ++x)
+				calculateToksvigRows(*normalMapCrunchImage, static_cast<crnlib::uint>(startY), static_cast<crnlib::uint>(endY), POWER, [crunchImage](crnlib::uint x, crnlib::uint y, float toksvig)
 				{
 					// Toksvig: Areas in the original normal map that were flat are white (glossy), whereas noisy, bumpy sections are darker
-					const float toksvig = glm::clamp(calculateToksvig(*normalMapCrunchImage, glm::vec2(x, y), POWER), 0.0f, 1.0f);
+					toksvig = glm::clamp(toksvig, 0.0f, 1.0f);
 
 					// Roughness = 1 - glossiness
 					(*crunchImage)(x, y) = static_cast<crnlib::uint8>((1.0f - toksvig) * 255.0f);
-				}
-			}
+				});
+			});
 		}
 
-		void compositeToksvigRoughnessMap(const crnlib::mip_level& roughnessMapCrunchMipLevel, const crnlib::mip_level& normalMapCrunchMipLevel, crnlib::mip_level& crunchMipLevel)
+		void compositeToksvigRoughnessMap(const crnlib::mip_level& roughnessMapCrunchMipLevel, const crnlib::mip_level& normalMapCrunchMipLevel, crnlib::mip_level& crunchMipLevel, uint32_t numberOfThreads)
 		{
-			const crnlib::uint width = normalMapCrunchMipLevel.get_width();
-			const crnlib::uint height = normalMapCrunchMipLevel.get_height();
 			crnlib::image_u8* roughnessMapCrunchImage = roughnessMapCrunchMipLevel.get_image();
 			crnlib::image_u8* normalMapCrunchImage = normalMapCrunchMipLevel.get_image();
 			crnlib::image_u8* crunchImage = crunchMipLevel.get_image();
-			for (crnlib::uint y = 0; y < height; ++y)
+			::detail::parallelFor(numberOfThreads, normalMapCrunchMipLevel.get_height(), ::detail::MINIMUM_NUMBER_OF_ROWS_PER_THREAD, [roughnessMapCrunchImage, normalMapCrunchImage, crunchImage](size_t startY, size_t endY)
 			{
-				for (crnlib::uint x = 0; x < width; ++x)
+				calculateToksvigRows(*normalMapCrunchImage, static_cast<crnlib::uint>(startY), static_cast<crnlib::uint>(endY), POWER, [roughnessMapCrunchImage, crunchImage](crnlib::uint x, crnlib::uint y, float toksvig)
 				{
 					// Toksvig: Areas in the original normal map that were flat are white (glossy), whereas noisy, bumpy sections are darker
-					const float toksvig = glm::clamp(calculateToksvig(*normalMapCrunchImage, glm::vec2(x, y), POWER), 0.0f, 1.0f);
+					toksvig = glm::clamp(toksvig, 0.0f, 1.0f);
 
 					// Roughness = 1 - glossiness
 					const float originalGlossiness = 1.0f - ((*roughnessMapCrunchImage)(x, y).r / 255.0f);
 					(*crunchImage)(x, y).r = 255u - static_cast<crnlib::uint8>(originalGlossiness * toksvig * 255.0f);
-				}
-			}
+				});
+			});
 		}
 
 
@@ -259,7 +480,8 @@ namespace
 		//[-------------------------------------------------------]
 		//[ Global variables                                      ]
 		//[-------------------------------------------------------]
-		static std::atomic<bool> g_CrunchInitialized = false;
+		static std::mutex g_CrunchMutex;
+		static uint32_t	  g_CrunchReferenceCount = 0;	///< There can be one texture asset compiler instance per asset compiler worker thread, Crunch is shared by all of them
 
 
 		//[-------------------------------------------------------]
@@ -651,7 +873,7 @@ namespace
 			}
 		}
 
-		void load2DCrunchMipmappedTexture(Renderer::IFileManager& fileManager, Renderer::VirtualFilename virtualSourceFilename, Renderer::VirtualFilename virtualSourceNormalMapFilename, crnlib::mipmapped_texture& crunchMipmappedTexture, crnlib::texture_conversion::convert_params& crunchConvertParams)
+		void load2DCrunchMipmappedTexture(Renderer::IFileManager& fileManager, Renderer::VirtualFilename virtualSourceFilename, Renderer::VirtualFilename virtualSourceNormalMapFilename, crnlib::mipmapped_texture& crunchMipmappedTexture, crnlib::texture_conversion::convert_params& crunchConvertParams, uint32_t numberOfThreads)
 		{
 			// Load, generate or compose mipmapped Crunch texture
 			if (nullptr != virtualSourceFilename && nullptr == virtualSourceNormalMapFilename)
@@ -675,7 +897,7 @@ namespace
 
 				// Create Toksvig specular anti-aliasing to reduce shimmering
 				crunchMipmappedTexture.init(normalMapCrunchMipmappedTexture.get_width(), normalMapCrunchMipmappedTexture.get_height(), 1, 1, crnlib::PIXEL_FMT_L8, "Toksvig", crnlib::cDefaultOrientationFlags);
-				::toksvig::createToksvigRoughnessMap(*normalMapCrunchMipmappedTexture.get_level(0, 0), *crunchMipmappedTexture.get_level(0, 0));
+				::toksvig::createToksvigRoughnessMap(*normalMapCrunchMipmappedTexture.get_level(0, 0), *crunchMipmappedTexture.get_level(0, 0), numberOfThreads);
 			}
 			else
 			{
@@ -698,7 +920,7 @@ namespace
 
 				// Create Toksvig specular anti-aliasing to reduce shimmering
 				crunchMipmappedTexture.init(normalMapCrunchMipmappedTexture.get_width(), normalMapCrunchMipmappedTexture.get_height(), 1, 1, crnlib::PIXEL_FMT_L8, "Toksvig", crnlib::cDefaultOrientationFlags);
-				::toksvig::compositeToksvigRoughnessMap(*roughnessMapCrunchMipmappedTexture.get_level(0, 0), *normalMapCrunchMipmappedTexture.get_level(0, 0), *crunchMipmappedTexture.get_level(0, 0));
+				::toksvig::compositeToksvigRoughnessMap(*roughnessMapCrunchMipmappedTexture.get_level(0, 0), *normalMapCrunchMipmappedTexture.get_level(0, 0), *crunchMipmappedTexture.get_level(0, 0), numberOfThreads);
 			}
 		}
 
@@ -745,7 +967,7 @@ namespace
 			TextureChannelPacking(Renderer::IFileManager& fileManager, const RendererToolkit::IAssetCompiler::Configuration& configuration, const rapidjson::Value& rapidJsonValueTextureAssetCompiler, const char* basePath, Renderer::VirtualFilename virtualSourceNormalMapFilename, crnlib::texture_conversion::convert_params& crunchConvertParams)
 			{
 				loadLayout(configuration, rapidJsonValueTextureAssetCompiler, crunchConvertParams);
-				loadSourceCrunchMipmappedTextures(fileManager, rapidJsonValueTextureAssetCompiler, basePath, virtualSourceNormalMapFilename);
+				loadSourceCrunchMipmappedTextures(fileManager, rapidJsonValueTextureAssetCompiler, basePath, virtualSourceNormalMapFilename, configuration.numberOfThreads);
 			}
 
 			[[nodiscard]] crnlib::uint getDestinationWidth() const
@@ -910,7 +1132,7 @@ namespace
 				return "";
 			}
 
-			void loadSourceCrunchMipmappedTextures(Renderer::IFileManager& fileManager, const rapidjson::Value& rapidJsonValueTextureAssetCompiler, const char* basePath, Renderer::VirtualFilename virtualSourceNormalMapFilename)
+			void loadSourceCrunchMipmappedTextures(Renderer::IFileManager& fileManager, const rapidjson::Value& rapidJsonValueTextureAssetCompiler, const char* basePath, Renderer::VirtualFilename virtualSourceNormalMapFilename, uint32_t numberOfThreads)
 			{
 				const bool toksvigSpecularAntiAliasing = isToksvigSpecularAntiAliasingEnabled(rapidJsonValueTextureAssetCompiler);
 
@@ -954,7 +1176,7 @@ namespace
 
 							// Load Crunch mipmapped texture
 							crnlib::texture_conversion::convert_params crunchConvertParams;
-							load2DCrunchMipmappedTexture(fileManager, (basePath + value).c_str(), usedSourceNormalMapFilename.empty() ? nullptr : usedSourceNormalMapFilename.c_str(), source.crunchMipmappedTexture, crunchConvertParams);
+							load2DCrunchMipmappedTexture(fileManager, (basePath + value).c_str(), usedSourceNormalMapFilename.empty() ? nullptr : usedSourceNormalMapFilename.c_str(), source.crunchMipmappedTexture, crunchConvertParams, numberOfThreads);
 
 							{ // Sanity check: Ensure the number of channels matches
 								const crnlib::image_u8* crunchImage = source.crunchMipmappedTexture.get_level(0, 0)->get_image();
@@ -981,14 +1203,17 @@ namespace
 								const crnlib::uint width = crunchMipLevel.get_width();
 								const crnlib::uint height = crunchMipLevel.get_height();
 								crnlib::image_u8* crunchImage = crunchMipLevel.get_image();
-								for (crnlib::uint y = 0; y < height; ++y)
+								::detail::parallelFor(numberOfThreads, height, ::detail::MINIMUM_NUMBER_OF_ROWS_PER_THREAD, [crunchImage, width](size_t startY, size_t endY)
 								{
-									for (crnlib::uint x = 0; x < width; ++x)
+									for (crnlib::uint y = static_cast<crnlib::uint>(startY); y < static_cast<crnlib::uint>(endY); ++y)
 									{
-										// Roughness = 1 - glossiness
-										(*crunchImage)(x, y).c[0] = 255u - (*crunchImage)(x, y).c[0];
+										for (crnlib::uint x = 0; x < width; ++x)
+										{
+											// Roughness = 1 - glossiness
+											(*crunchImage)(x, y).c[0] = 255u - (*crunchImage)(x, y).c[0];
+										}
 									}
-								}
+								});
 							}
 							break;
 						}
@@ -1014,7 +1239,7 @@ namespace
 								{
 									// Load Crunch mipmapped texture
 									crnlib::texture_conversion::convert_params crunchConvertParams;
-									load2DCrunchMipmappedTexture(fileManager, nullptr, usedSourceNormalMapFilename.c_str(), source.crunchMipmappedTexture, crunchConvertParams);
+									load2DCrunchMipmappedTexture(fileManager, nullptr, usedSourceNormalMapFilename.c_str(), source.crunchMipmappedTexture, crunchConvertParams, numberOfThreads);
 								}
 							}
 							break;
@@ -1200,24 +1425,29 @@ namespace
 
 		void initializeCrunch(const RendererToolkit::Context& context)
 		{
-			if (!g_CrunchInitialized)
+			std::lock_guard<std::mutex> mutexLock(g_CrunchMutex);
+			if (0 == g_CrunchReferenceCount)
 			{
 				// The Crunch console is using "printf()" by default if no console output function handles Crunch console output
 				// -> Redirect the Crunch console output into our log so we have an uniform handling of such information
 				crn_set_memory_callbacks(::detail::crunchRealloc, ::detail::crunchMsize, &context.getAllocator());
 				crnlib::console::add_console_output_func(crunchConsoleOutput, &const_cast<RendererToolkit::Context&>(context));
-				g_CrunchInitialized = true;
 			}
+			++g_CrunchReferenceCount;
 		}
 
 		void deinitializeCrunch()
 		{
-			if (g_CrunchInitialized)
+			std::lock_guard<std::mutex> mutexLock(g_CrunchMutex);
+			if (g_CrunchReferenceCount > 0)
 			{
-				crnlib::console::remove_console_output_func(crunchConsoleOutput);
-				crnlib::console::deinit();
-				crn_set_memory_callbacks(nullptr, nullptr, nullptr);
-				g_CrunchInitialized = false;
+				--g_CrunchReferenceCount;
+				if (0 == g_CrunchReferenceCount)
+				{
+					crnlib::console::remove_console_output_func(crunchConsoleOutput);
+					crnlib::console::deinit();
+					crn_set_memory_callbacks(nullptr, nullptr, nullptr);
+				}
 			}
 		}
 
@@ -1385,25 +1615,53 @@ namespace
 			}
 		}
 
-		void loadCubeCrunchMipmappedTexture(Renderer::IFileManager& fileManager, const rapidjson::Value& rapidJsonValueTextureAssetCompiler, const char* basePath, crnlib::mipmapped_texture& crunchMipmappedTexture)
+		void loadCubeCrunchMipmappedTexture(Renderer::IFileManager& fileManager, const rapidjson::Value& rapidJsonValueTextureAssetCompiler, const char* basePath, crnlib::mipmapped_texture& crunchMipmappedTexture, uint32_t numberOfThreads)
 		{
 			// The face order must be: +X, -X, -Y, +Y, +Z, -Z
 			const Filenames faceFilenames = getCubemapFilenames(rapidJsonValueTextureAssetCompiler, basePath);
-			for (rapidjson::SizeType faceIndex = 0; faceIndex < faceFilenames.size(); ++faceIndex)
+
+			// Load and decode the 2D source images in parallel, the face images are owned by the Crunch mipmapped texture as soon as they're assigned
+			std::vector<crnlib::image_u8*> source2DImages(faceFilenames.size(), nullptr);
+			const auto deleteSource2DImages = [&source2DImages]()
 			{
-				// Load the 2D source image
-				const std::string& virtualInputFilename = faceFilenames[faceIndex];
-				FileDataStreamSerializer fileDataStreamSerializer(fileManager, Renderer::IFileManager::FileMode::READ, virtualInputFilename.c_str());
-				crnlib::image_u8* source2DImage = crnlib::crnlib_new<crnlib::image_u8>();
-				if (!crnlib::image_utils::read_from_stream(*source2DImage, fileDataStreamSerializer))
+				for (crnlib::image_u8*& source2DImage : source2DImages)
 				{
-					throw std::runtime_error(std::string("Failed to load image \"") + virtualInputFilename + '\"');
+					crnlib::crnlib_delete(source2DImage);
+					source2DImage = nullptr;
 				}
+			};
+			try
+			{
+				::detail::parallelFor(numberOfThreads, faceFilenames.size(), 1, [&fileManager, &faceFilenames, &source2DImages](size_t startFaceIndex, size_t endFaceIndex)
+				{
+					for (size_t faceIndex = startFaceIndex; faceIndex < endFaceIndex; ++faceIndex)
+					{
+						const std::string& virtualInputFilename = faceFilenames[faceIndex];
+						FileDataStreamSerializer fileDataStreamSerializer(fileManager, Renderer::IFileManager::FileMode::READ, virtualInputFilename.c_str());
+						source2DImages[faceIndex] = crnlib::crnlib_new<crnlib::image_u8>();
+						if (!crnlib::image_utils::read_from_stream(*source2DImages[faceIndex], fileDataStreamSerializer))
+						{
+							throw std::runtime_error(std::string("Failed to load image \"") + virtualInputFilename + '\"');
+						}
+					}
+				});
+			}
+			catch (const std::exception&)
+			{
+				deleteSource2DImages();
+				throw;
+			}
+
+			// Assemble the cube map
+			for (rapidjson::SizeType faceIndex = 0; faceIndex < faceFilenames.size(); ++faceIndex)
+			{
+				crnlib::image_u8* source2DImage = source2DImages[faceIndex];
 
 				// Sanity check
 				const uint32_t width = source2DImage->get_width();
 				if (width != source2DImage->get_height())
 				{
+					deleteSource2DImages();
 					throw std::runtime_error("Cube map faces must have a width which is identical to the height");
 				}
 
@@ -1415,13 +1673,16 @@ namespace
 				}
 				else if (crunchMipmappedTexture.get_format() != pixelFormat)
 				{
+					deleteSource2DImages();
 					throw std::runtime_error("The pixel format of all cube map faces must be identical");
 				}
 				else if (crunchMipmappedTexture.get_width() != source2DImage->get_width())
 				{
+					deleteSource2DImages();
 					throw std::runtime_error("The size of all cube map faces must be identical");
 				}
 				crunchMipmappedTexture.get_level(faceIndex, 0)->assign(source2DImage);
+				source2DImages[faceIndex] = nullptr;
 			}
 		}
 
@@ -1449,25 +1710,34 @@ namespace
 					// Fill with source texture channel color
 					const crnlib::image_u8* sourceCrunchImage = source.crunchMipmappedTexture.get_level(0, 0)->get_image();
 					const uint8_t sourceChannel = destination.sourceChannel;
-					for (crnlib::uint y = 0; y < height; ++y)
+					::detail::parallelFor(configuration.numberOfThreads, height, ::detail::MINIMUM_NUMBER_OF_ROWS_PER_THREAD, [destinationCrunchImage, sourceCrunchImage, destinationChannel, sourceChannel, width](size_t startY, size_t endY)
 					{
-						for (crnlib::uint x = 0; x < width; ++x)
+						for (crnlib::uint y = static_cast<crnlib::uint>(startY); y < static_cast<crnlib::uint>(endY); ++y)
 						{
-							(*destinationCrunchImage)(x, y).c[destinationChannel] = (*sourceCrunchImage)(x, y).c[sourceChannel];
+							const crnlib::color_quad_u8* sourceColor = sourceCrunchImage->get_scanline(y);
+							crnlib::color_quad_u8* destinationColor = destinationCrunchImage->get_scanline(y);
+							for (crnlib::uint x = 0; x < width; ++x)
+							{
+								destinationColor[x].c[destinationChannel] = sourceColor[x].c[sourceChannel];
+							}
 						}
-					}
+					});
 				}
 				else
 				{
 					// Fill with uniform default color
 					const crnlib::uint8 value = static_cast<crnlib::uint8>(source.defaultColor[destination.sourceChannel] * 255.0f);
-					for (crnlib::uint y = 0; y < height; ++y)
+					::detail::parallelFor(configuration.numberOfThreads, height, ::detail::MINIMUM_NUMBER_OF_ROWS_PER_THREAD, [destinationCrunchImage, destinationChannel, value, width](size_t startY, size_t endY)
 					{
-						for (crnlib::uint x = 0; x < width; ++x)
+						for (crnlib::uint y = static_cast<crnlib::uint>(startY); y < static_cast<crnlib::uint>(endY); ++y)
 						{
-							(*destinationCrunchImage)(x, y).c[destinationChannel] = value;
+							crnlib::color_quad_u8* destinationColor = destinationCrunchImage->get_scanline(y);
+							for (crnlib::uint x = 0; x < width; ++x)
+							{
+								destinationColor[x].c[destinationChannel] = value;
+							}
 						}
-					}
+					});
 				}
 			}
 		}
@@ -1477,11 +1747,12 @@ namespace
 			crnlib::texture_conversion::convert_params crunchConvertParams;
 
 			// Load mipmapped Crunch texture
+			Renderer::Stopwatch stopwatch(true);
 			crnlib::mipmapped_texture crunchMipmappedTexture;
 			Renderer::IFileManager& fileManager = input.context.getFileManager();
 			if (TextureSemantic::REFLECTION_CUBE_MAP == textureSemantic)
 			{
-				loadCubeCrunchMipmappedTexture(fileManager, rapidJsonValueTextureAssetCompiler, basePath, crunchMipmappedTexture);
+				loadCubeCrunchMipmappedTexture(fileManager, rapidJsonValueTextureAssetCompiler, basePath, crunchMipmappedTexture, configuration.numberOfThreads);
 				crunchConvertParams.m_texture_type = crnlib::cTextureTypeCubemap;
 			}
 			else if (TextureSemantic::PACKED_CHANNELS == textureSemantic)
@@ -1494,8 +1765,9 @@ namespace
 				{
 					virtualSourceNormalMapFilename = nullptr;
 				}
-				load2DCrunchMipmappedTexture(fileManager, virtualSourceFilename, virtualSourceNormalMapFilename, crunchMipmappedTexture, crunchConvertParams);
+				load2DCrunchMipmappedTexture(fileManager, virtualSourceFilename, virtualSourceNormalMapFilename, crunchMipmappedTexture, crunchConvertParams, configuration.numberOfThreads);
 			}
+			const float loadMilliseconds = stopwatch.getMilliseconds();
 
 			// Get absolute destination filename
 			const std::string absoluteDestinationFilename = fileManager.mapVirtualToAbsoluteFilename(Renderer::IFileManager::FileMode::WRITE, virtualDestinationFilename);
@@ -1513,7 +1785,7 @@ namespace
 			crunchConvertParams.m_y_flip = true;
 			crunchConvertParams.m_no_stats = true;
 			crunchConvertParams.m_dst_format = crnlib::PIXEL_FMT_INVALID;
-			crunchConvertParams.m_comp_params.m_num_helper_threads = crnlib::g_number_of_processors - 1;
+			crunchConvertParams.m_comp_params.m_num_helper_threads = std::min(configuration.numberOfThreads - 1, static_cast<uint32_t>(cCRNMaxHelperThreads));
 
 			// The 4x4 block size based DXT compression format has no support for 1D textures
 			bool compression = true;
@@ -1707,6 +1979,7 @@ namespace
 			}
 
 			// Compress now
+			stopwatch.start();
 			crnlib::texture_conversion::convert_stats stats;
 			if (!crnlib::texture_conversion::process(crunchConvertParams, stats))
 			{
@@ -1719,12 +1992,18 @@ namespace
 					throw std::runtime_error(crunchConvertParams.m_error_message.get_ptr());
 				}
 			}
+			const float compressMilliseconds = stopwatch.getMilliseconds();
 
 			// Write LZ4 compressed memory file
+			stopwatch.start();
 			if (crnlib::texture_file_types::cFormatDDS == outputCrunchTextureFileType && !memoryStream.getMemoryFile().writeLz4CompressedDataByVirtualFilename(Renderer::Lz4DdsTextureResourceLoader::FORMAT_TYPE, Renderer::Lz4DdsTextureResourceLoader::FORMAT_VERSION, input.context.getFileManager(), virtualDestinationFilename))
 			{
 				throw std::runtime_error("Failed to write LZ4 compressed output file \"" + std::string(virtualDestinationFilename) + '\"');
 			}
+
+			// Per stage timing to be able to find out where the time of large texture sets is spent
+			// -> The texture compile micro-benchmark of the benchmark parses this message, keep the format in sync
+			RHI_LOG(input.context, DEBUG, "Texture \"%s\" %ux%u using up to %u threads: Load and process %.2f ms, compress %.2f ms, write %.2f ms", virtualDestinationFilename, crunchMipmappedTexture.get_width(), crunchMipmappedTexture.get_height(), configuration.numberOfThreads, loadMilliseconds, compressMilliseconds, stopwatch.getMilliseconds())
 		}
 
 		void convertColorCorrectionLookupTable(Renderer::IFileManager& fileManager, Renderer::VirtualFilename virtualInputAssetFilename, Renderer::VirtualFilename virtualOutputAssetFilename)
@@ -23,9 +23,64 @@
 //[-------------------------------------------------------]
 #include "RendererToolkit/Private/Helper/AssimpLogStream.h"
 
+#include <mutex>
 #include <stdexcept>
 
 
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Global classes                                        ]
+		//[-------------------------------------------------------]
+		/**
+		*  @brief
+		*    Assimp log stream forwarding messages to the Assimp log stream instance of the thread which emitted the message
+		*
+		*  @note
+		*    - The Assimp default logger is a global singleton, assets might be compiled in parallel so each worker thread must only see its own errors
+		*/
+		class AssimpLogStreamDispatcher final : public Assimp::LogStream
+		{
+		public:
+			virtual void write(const char* message) override;
+		};
+
+
+		//[-------------------------------------------------------]
+		//[ Global variables                                      ]
+		//[-------------------------------------------------------]
+		std::mutex										g_AssimpLoggerMutex;
+		uint32_t										g_AssimpLoggerReferenceCount = 0;
+		AssimpLogStreamDispatcher						g_AssimpLogStreamDispatcher;
+		thread_local RendererToolkit::AssimpLogStream*	g_CurrentThreadAssimpLogStream = nullptr;
+
+
+		//[-------------------------------------------------------]
+		//[ Global classes implementation                         ]
+		//[-------------------------------------------------------]
+		void AssimpLogStreamDispatcher::write(const char* message)
+		{
+			if (nullptr != g_CurrentThreadAssimpLogStream)
+			{
+				g_CurrentThreadAssimpLogStream->write(message);
+			}
+		}
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
+
+
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
@@ -36,16 +91,31 @@ namespace RendererToolkit
 	//[-------------------------------------------------------]
 	//[ Public methods                                        ]
 	//[-------------------------------------------------------]
-	AssimpLogStream::AssimpLogStream()
+	AssimpLogStream::AssimpLogStream() :
+		mPreviousThreadAssimpLogStream(::detail::g_CurrentThreadAssimpLogStream)
 	{
-		Assimp::DefaultLogger::create("", Assimp::Logger::NORMAL, aiDefaultLogStream_DEBUGGER);
-		Assimp::DefaultLogger::get()->attachStream(this, Assimp::DefaultLogger::Err);
+		{ // The Assimp default logger is shared by all threads, create it for the first user only
+			std::lock_guard<std::mutex> mutexLock(::detail::g_AssimpLoggerMutex);
+			if (0 == ::detail::g_AssimpLoggerReferenceCount)
+			{
+				Assimp::DefaultLogger::create("", Assimp::Logger::NORMAL, aiDefaultLogStream_DEBUGGER);
+				Assimp::DefaultLogger::get()->attachStream(&::detail::g_AssimpLogStreamDispatcher, Assimp::DefaultLogger::Err);
+			}
+			++::detail::g_AssimpLoggerReferenceCount;
+		}
+		::detail::g_CurrentThreadAssimpLogStream = this;
 	}
 
 	AssimpLogStream::~AssimpLogStream()
 	{
-		Assimp::DefaultLogger::get()->detatchStream(this, Assimp::DefaultLogger::Err);
-		Assimp::DefaultLogger::kill();
+		::detail::g_CurrentThreadAssimpLogStream = mPreviousThreadAssimpLogStream;
+		std::lock_guard<std::mutex> mutexLock(::detail::g_AssimpLoggerMutex);
+		--::detail::g_AssimpLoggerReferenceCount;
+		if (0 == ::detail::g_AssimpLoggerReferenceCount)
+		{
+			Assimp::DefaultLogger::get()->detatchStream(&::detail::g_AssimpLogStreamDispatcher, Assimp::DefaultLogger::Err);
+			Assimp::DefaultLogger::kill();
+		}
 	}
 
 
@@ -75,6 +75,8 @@ namespace RendererToolkit
 	public:
 		AssimpLogStream();
 		virtual ~AssimpLogStream() override;
+		explicit AssimpLogStream(const AssimpLogStream&) = delete;
+		AssimpLogStream& operator=(const AssimpLogStream&) = delete;
 
 
 	//[-------------------------------------------------------]
@@ -88,7 +90,8 @@ namespace RendererToolkit
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
-		std::string mLastErrorMessage;
+		std::string		 mLastErrorMessage;
+		AssimpLogStream* mPreviousThreadAssimpLogStream;	///< Assimp log stream of the current thread before this instance was created, can be a null pointer
 
 
 	};
@@ -49,6 +49,12 @@ namespace
 			static constexpr uint32_t FORMAT_TYPE	 = STRING_ID("RendererToolkitCache");
 			static constexpr uint32_t FORMAT_VERSION = 1;
 		}
+		namespace RendererToolkitOutputCacheIndex
+		{
+			static constexpr uint32_t FORMAT_TYPE	 = STRING_ID("RendererToolkitOutputCacheIndex");
+			static constexpr uint32_t FORMAT_VERSION = 1;
+		}
+		static constexpr uint32_t OUTPUT_CACHE_KEY_VERSION = 1;	///< Increase this to invalidate all output cache entries, e.g. when the output cache key calculation changes
 
 
 		//[-------------------------------------------------------]
@@ -79,6 +85,72 @@ namespace
 			return false;
 		}
 
+		[[nodiscard]] inline uint64_t hashValue(const void* value, size_t numberOfBytes, uint64_t hash)
+		{
+			return Renderer::Math::calculateFNV1a64(static_cast<const uint8_t*>(value), static_cast<uint32_t>(numberOfBytes), hash);
+		}
+
+		[[nodiscard]] std::string getOutputCacheVirtualFilename(const std::string& outputCacheVirtualDirectoryName, uint64_t outputContentHash)
+		{
+			static constexpr char HEXADECIMAL_DIGITS[] = "0123456789abcdef";
+			char hexadecimalOutputContentHash[17];
+			for (int i = 15; i >= 0; --i)
+			{
+				hexadecimalOutputContentHash[i] = HEXADECIMAL_DIGITS[outputContentHash & 0xf];
+				outputContentHash >>= 4;
+			}
+			hexadecimalOutputContentHash[16] = '\0';
+			return outputCacheVirtualDirectoryName + '/' + hexadecimalOutputContentHash + ".output";
+		}
+
+		[[nodiscard]] inline std::string getOutputCacheIndexVirtualFilename(const std::string& outputCacheVirtualDirectoryName)
+		{
+			return outputCacheVirtualDirectoryName + "/Index.renderer_toolkit_output_cache";
+		}
+
+		[[nodiscard]] bool copyFile(const Renderer::IFileManager& fileManager, const std::string& sourceVirtualFilename, const std::string& destinationVirtualFilename, uint64_t& numberOfBytes)
+		{
+			// Read the source file at once
+			if (!fileManager.doesFileExist(sourceVirtualFilename.c_str()))
+			{
+				return false;
+			}
+			Renderer::IFile* sourceFile = fileManager.openFile(Renderer::IFileManager::FileMode::READ, sourceVirtualFilename.c_str());
+			if (nullptr == sourceFile)
+			{
+				return false;
+			}
+			std::vector<uint8_t> bytes(sourceFile->getNumberOfBytes());
+			if (!bytes.empty())
+			{
+				sourceFile->read(bytes.data(), bytes.size());
+			}
+			fileManager.closeFile(*sourceFile);
+
+			// Write the destination file at once
+			Renderer::IFile* destinationFile = fileManager.openFile(Renderer::IFileManager::FileMode::WRITE, destinationVirtualFilename.c_str());
+			if (nullptr == destinationFile)
+			{
+				return false;
+			}
+			if (!bytes.empty())
+			{
+				destinationFile->write(bytes.data(), bytes.size());
+			}
+			fileManager.closeFile(*destinationFile);
+			numberOfBytes = bytes.size();
+
+			// Done
+			return true;
+		}
+
+		void removeFile(const Renderer::IFileManager& fileManager, const std::string& virtualFilename)
+		{
+			// There's no file removal in the file manager interface
+			std::error_code errorCode;
+			std_filesystem::remove(fileManager.mapVirtualToAbsoluteFilename(Renderer::IFileManager::FileMode::WRITE, virtualFilename.c_str()), errorCode);
+		}
+
 		void saveRendererToolkitCacheFile(const RendererToolkit::Context& context, const std::string& projectName, const Renderer::MemoryFile& memoryFile)
 		{
 			std::string virtualDirectoryName;
@@ -112,8 +184,25 @@ namespace RendererToolkit
 	CacheManager::CacheManager(const Context& context, const std::string& projectName) :
 		mContext(context),
 		mProjectName(projectName),
-		mDiskCacheDirty(false)
+		mDiskCacheDirty(false),
+		mConfigurationContentHash(0),
+		mOutputCacheSizeLimit(DEFAULT_OUTPUT_CACHE_SIZE_LIMIT),
+		mOutputCacheNumberOfBytes(0),
+		mOutputCacheUseCounter(0),
+		mOutputCacheIndexDirty(false)
 	{
+		// The output cache is shared by all projects and is only used if writing local data is allowed
+		const Renderer::IFileManager& fileManager = mContext.getFileManager();
+		if (nullptr != fileManager.getLocalDataMountPoint())
+		{
+			mOutputCacheVirtualDirectoryName = std::string(fileManager.getLocalDataMountPoint()) + "/RendererToolkitOutputCache";
+			if (!fileManager.createDirectories(mOutputCacheVirtualDirectoryName.c_str()))
+			{
+				mOutputCacheVirtualDirectoryName.clear();
+			}
+		}
+
+		// Load cache
 		loadCache();
 	}
 
@@ -130,6 +219,11 @@ namespace RendererToolkit
 	}
 
 	bool CacheManager::needsToBeCompiled(const std::string& rhiTarget, const std::string& virtualAssetFilename, const std::vector<std::string>& virtualSourceFilenames, const std::string& virtualDestinationFilename, uint32_t compilerVersion, CacheEntries& cacheEntries)
+	{
+		return needsToBeCompiled(rhiTarget, virtualAssetFilename, virtualSourceFilenames, {}, virtualDestinationFilename, compilerVersion, cacheEntries);
+	}
+
+	bool CacheManager::needsToBeCompiled(const std::string& rhiTarget, const std::string& virtualAssetFilename, const std::vector<std::string>& virtualSourceFilenames, const std::vector<std::string>& virtualDependencyFilenames, const std::string& virtualDestinationFilename, uint32_t compilerVersion, CacheEntries& cacheEntries)
 	{
 		if (virtualSourceFilenames.empty())
 		{
@@ -171,22 +265,53 @@ namespace RendererToolkit
 		{
 			// Mark the asset file as changed when asset needs to be compiled and asset file itself didn't changed
 			// -> This is needed to get asset dependencies properly checked
+			std::lock_guard<std::mutex> mutexLock(mMutex);
 			mCheckedFilesStatus[Renderer::StringId::calculateFNV(virtualAssetFilename.c_str())].changed = true;
 		}
 
-		// File needs to be compiled either destination doesn't exists, the source data has changed or the asset file has changed
-		return (sourceFilesChanged || assetFileChanged || !destinationExists);
+		// File needs to be compiled either destination doesn't exists, the source data has changed, the asset file has changed or a dependency has changed
+		bool result = (sourceFilesChanged || assetFileChanged || !destinationExists || dependencyFilesChanged(virtualDependencyFilenames));
+
+		// Content-addressed output cache: Restore an output compiled from identical inputs instead of compiling the asset again
+		cacheEntries.outputContentHash = calculateOutputContentHash(rhiTarget, virtualAssetFilename, virtualDependencyFilenames, compilerVersion, cacheEntries);
+		cacheEntries.virtualDestinationFilename = virtualDestinationFilename;
+		if (result && 0 != cacheEntries.outputContentHash)
+		{
+			if (restoreOutputFromCache(cacheEntries.outputContentHash, virtualDestinationFilename))
+			{
+				// The asset is now up-to-date
+				storeOrUpdateCacheEntries(cacheEntries);
+				result = false;
+			}
+			else
+			{
+				std::lock_guard<std::mutex> mutexLock(mMutex);
+				++mOutputCacheStatistics.numberOfMisses;
+			}
+		}
+
+		// Done
+		return result;
 	}
 
 	void CacheManager::storeOrUpdateCacheEntries(const CacheEntries& cacheEntries)
 	{
-		for (const CacheEntry& sourceCacheEntry : cacheEntries.sourceCacheEntries)
 		{
-			storeOrUpdateCacheEntry(sourceCacheEntry);
+			std::lock_guard<std::mutex> mutexLock(mMutex);
+			for (const CacheEntry& sourceCacheEntry : cacheEntries.sourceCacheEntries)
+			{
+				storeOrUpdateCacheEntry(sourceCacheEntry);
+			}
+
+			// There must always be an asset metadata file
+			storeOrUpdateCacheEntry(cacheEntries.assetCacheEntry);
 		}
 
-		// There must always be an asset metadata file
-		storeOrUpdateCacheEntry(cacheEntries.assetCacheEntry);
+		// Store the compiled output inside the output cache
+		if (0 != cacheEntries.outputContentHash && !cacheEntries.virtualDestinationFilename.empty())
+		{
+			storeOutputInCache(cacheEntries.outputContentHash, cacheEntries.virtualDestinationFilename);
+		}
 	}
 
 	bool CacheManager::checkIfFileIsModified(const std::string& rhiTarget, const std::string& virtualAssetFilename, const std::vector<std::string>& virtualSourceFilenames, const std::string& virtualDestinationFilename, uint32_t compilerVersion)
@@ -219,6 +344,7 @@ namespace RendererToolkit
 				{
 					// Asset file itself has not changed but the source file so mark the asset file as changed too
 					// Dependencies are defined via the asset file and with this change the asset which depends on this asset knows if the referenced asset has changed
+					std::lock_guard<std::mutex> mutexLock(mMutex);
 					mCheckedFilesStatus[Renderer::StringId::calculateFNV(virtualAssetFilename.c_str())].changed = true;
 				}
 			}
@@ -234,6 +360,7 @@ namespace RendererToolkit
 
 	bool CacheManager::dependencyFilesChanged(const std::vector<std::string>& virtualDependencyFilenames)
 	{
+		std::lock_guard<std::mutex> mutexLock(mMutex);
 		for (const std::string& virtualDependencyFilename : virtualDependencyFilenames)
 		{
 			CheckedFilesStatus::const_iterator iterator = mCheckedFilesStatus.find(Renderer::StringId::calculateFNV(virtualDependencyFilename.c_str()));
@@ -248,14 +375,34 @@ namespace RendererToolkit
 		return false;
 	}
 
+	void CacheManager::setOutputCacheSizeLimit(uint64_t numberOfBytes)
+	{
+		std::lock_guard<std::mutex> mutexLock(mMutex);
+		mOutputCacheSizeLimit = numberOfBytes;
+		if (0 != mOutputCacheSizeLimit)
+		{
+			evictOutputCacheEntries();
+		}
+	}
+
+	CacheManager::OutputCacheStatistics CacheManager::getOutputCacheStatistics()
+	{
+		std::lock_guard<std::mutex> mutexLock(mMutex);
+		return mOutputCacheStatistics;
+	}
+
 	void CacheManager::clearInternalCache()
 	{
+		std::lock_guard<std::mutex> mutexLock(mMutex);
 		mCheckedFilesStatus.clear();
+		mOutputContentHashByFileId.clear();
+		mOutputCacheStatistics = OutputCacheStatistics();
 	}
 
 	void CacheManager::saveCache()
 	{
 		// Do only save the renderer toolkit cache if writing local data is allowed
+		std::lock_guard<std::mutex> mutexLock(mMutex);
 		if (mDiskCacheDirty && nullptr != mContext.getFileManager().getLocalDataMountPoint())
 		{
 			const uint32_t numberOfStoredCacheEntries = static_cast<uint32_t>(mStoredCacheEntries.size());
@@ -270,6 +417,26 @@ namespace RendererToolkit
 			::detail::saveRendererToolkitCacheFile(mContext, mProjectName, memoryFile);
 			mDiskCacheDirty = false;
 		}
+
+		// Save the output cache index, only the least recently used information is stored since the output files themselves are the truth
+		if (mOutputCacheIndexDirty && !mOutputCacheVirtualDirectoryName.empty())
+		{
+			const uint32_t numberOfOutputCacheEntries = static_cast<uint32_t>(mOutputCacheEntries.size());
+			Renderer::MemoryFile memoryFile(0, sizeof(uint64_t) + sizeof(uint32_t) + numberOfOutputCacheEntries * (sizeof(uint64_t) + sizeof(OutputCacheEntry)));
+			memoryFile.write(&mOutputCacheUseCounter, sizeof(uint64_t));
+			memoryFile.write(&numberOfOutputCacheEntries, sizeof(uint32_t));
+			for (const auto& outputCacheEntryElement : mOutputCacheEntries)
+			{
+				memoryFile.write(&outputCacheEntryElement.first, sizeof(uint64_t));
+				memoryFile.write(&outputCacheEntryElement.second, sizeof(OutputCacheEntry));
+			}
+			const std::string virtualFilename = ::detail::getOutputCacheIndexVirtualFilename(mOutputCacheVirtualDirectoryName);
+			if (!memoryFile.writeLz4CompressedDataByVirtualFilename(::detail::RendererToolkitOutputCacheIndex::FORMAT_TYPE, ::detail::RendererToolkitOutputCacheIndex::FORMAT_VERSION, mContext.getFileManager(), virtualFilename.c_str()))
+			{
+				RHI_LOG(mContext, CRITICAL, "The renderer toolkit failed to save the output cache index to \"%s\"", virtualFilename.c_str())
+			}
+			mOutputCacheIndexDirty = false;
+		}
 	}
 
 
@@ -297,6 +464,207 @@ namespace RendererToolkit
 				mStoredCacheEntries.emplace(cacheEntry.getKey(), cacheEntry);
 			}
 		}
+
+		// Load the output cache index
+		mOutputCacheEntries.clear();
+		mOutputCacheNumberOfBytes = 0;
+		mOutputCacheUseCounter = 0;
+		mOutputCacheIndexDirty = false;
+		if (!mOutputCacheVirtualDirectoryName.empty())
+		{
+			const Renderer::IFileManager& fileManager = mContext.getFileManager();
+
+			{ // Least recently used information
+				const std::string virtualFilename = ::detail::getOutputCacheIndexVirtualFilename(mOutputCacheVirtualDirectoryName);
+				Renderer::MemoryFile indexMemoryFile;
+				if (fileManager.doesFileExist(virtualFilename.c_str()) && indexMemoryFile.loadLz4CompressedDataByVirtualFilename(::detail::RendererToolkitOutputCacheIndex::FORMAT_TYPE, ::detail::RendererToolkitOutputCacheIndex::FORMAT_VERSION, fileManager, virtualFilename.c_str()))
+				{
+					indexMemoryFile.decompress();
+					uint32_t numberOfOutputCacheEntries = 0;
+					indexMemoryFile.read(&mOutputCacheUseCounter, sizeof(uint64_t));
+					indexMemoryFile.read(&numberOfOutputCacheEntries, sizeof(uint32_t));
+					mOutputCacheEntries.reserve(numberOfOutputCacheEntries);
+					uint64_t outputContentHash = 0;
+					OutputCacheEntry outputCacheEntry;
+					for (uint32_t i = 0; i < numberOfOutputCacheEntries; ++i)
+					{
+						indexMemoryFile.read(&outputContentHash, sizeof(uint64_t));
+						indexMemoryFile.read(&outputCacheEntry, sizeof(OutputCacheEntry));
+						mOutputCacheEntries.emplace(outputContentHash, outputCacheEntry);
+					}
+				}
+			}
+
+			{ // The output files are the truth: Forget about index entries without output file and take output files without index entry into account (e.g. written by another renderer toolkit instance)
+				std::vector<std::string> virtualFilenames;
+				fileManager.enumerateFiles(mOutputCacheVirtualDirectoryName.c_str(), Renderer::IFileManager::EnumerationMode::FILES, virtualFilenames);
+				OutputCacheEntries outputCacheEntries;
+				outputCacheEntries.reserve(virtualFilenames.size());
+				for (const std::string& virtualFilename : virtualFilenames)
+				{
+					const std_filesystem::path path(virtualFilename);
+					if (path.extension().generic_string() == ".output")
+					{
+						uint64_t outputContentHash = 0;
+						try
+						{
+							outputContentHash = std::stoull(path.stem().generic_string(), nullptr, 16);
+						}
+						catch (const std::exception&)
+						{
+							// Not an output cache file, ignore it
+							continue;
+						}
+						OutputCacheEntry outputCacheEntry;
+						outputCacheEntry.numberOfBytes = static_cast<uint64_t>(fileManager.getFileSize(::detail::getOutputCacheVirtualFilename(mOutputCacheVirtualDirectoryName, outputContentHash).c_str()));
+						const OutputCacheEntries::const_iterator iterator = mOutputCacheEntries.find(outputContentHash);
+						outputCacheEntry.lastUse = (mOutputCacheEntries.cend() != iterator) ? iterator->second.lastUse : 0;
+						outputCacheEntries.emplace(outputContentHash, outputCacheEntry);
+						mOutputCacheNumberOfBytes += outputCacheEntry.numberOfBytes;
+					}
+				}
+				mOutputCacheIndexDirty = (outputCacheEntries.size() != mOutputCacheEntries.size());
+				mOutputCacheEntries.swap(outputCacheEntries);
+			}
+		}
+	}
+
+	uint64_t CacheManager::calculateOutputContentHash(const std::string& rhiTarget, const std::string& virtualAssetFilename, const std::vector<std::string>& virtualDependencyFilenames, uint32_t compilerVersion, const CacheEntries& cacheEntries)
+	{
+		// Output cache key: Hash of the project configuration, the RHI target, the asset (compiled asset IDs are derived from it), the compiler version, the asset options and the source file contents
+		uint64_t outputContentHash = Renderer::Math::FNV1a_INITIAL_HASH_64;
+		outputContentHash = ::detail::hashValue(&::detail::OUTPUT_CACHE_KEY_VERSION, sizeof(uint32_t), outputContentHash);
+		outputContentHash = ::detail::hashValue(&mConfigurationContentHash, sizeof(uint64_t), outputContentHash);
+		outputContentHash = ::detail::hashValue(rhiTarget.c_str(), rhiTarget.length(), outputContentHash);
+		outputContentHash = ::detail::hashValue(virtualAssetFilename.c_str(), virtualAssetFilename.length(), outputContentHash);
+		outputContentHash = ::detail::hashValue(&compilerVersion, sizeof(uint32_t), outputContentHash);
+		outputContentHash = ::detail::hashValue(&cacheEntries.assetCacheEntry.fileHash, sizeof(uint64_t), outputContentHash);
+		for (const CacheEntry& sourceCacheEntry : cacheEntries.sourceCacheEntries)
+		{
+			outputContentHash = ::detail::hashValue(&sourceCacheEntry.fileHash, sizeof(uint64_t), outputContentHash);
+		}
+
+		// The output content hashes of the dependencies, this way changes in e.g. the source of a base material blueprint are taken into account as well
+		std::lock_guard<std::mutex> mutexLock(mMutex);
+		for (const std::string& virtualDependencyFilename : virtualDependencyFilenames)
+		{
+			const OutputContentHashByFileId::const_iterator iterator = mOutputContentHashByFileId.find(Renderer::StringId::calculateFNV(virtualDependencyFilename.c_str()));
+			if (mOutputContentHashByFileId.cend() == iterator || 0 == iterator->second)
+			{
+				// Unknown output content hash, e.g. the dependency hasn't been checked during this compilation run, so caching isn't possible
+				outputContentHash = 0;
+				break;
+			}
+			outputContentHash = ::detail::hashValue(&iterator->second, sizeof(uint64_t), outputContentHash);
+		}
+
+		// Remember the output content hash for assets depending on this asset
+		mOutputContentHashByFileId[Renderer::StringId::calculateFNV(virtualAssetFilename.c_str())] = outputContentHash;
+
+		// Done
+		return outputContentHash;
+	}
+
+	bool CacheManager::restoreOutputFromCache(uint64_t outputContentHash, const std::string& virtualDestinationFilename)
+	{
+		{ // Is the output inside the output cache?
+			std::lock_guard<std::mutex> mutexLock(mMutex);
+			if (mOutputCacheVirtualDirectoryName.empty() || 0 == mOutputCacheSizeLimit)
+			{
+				return false;
+			}
+			OutputCacheEntries::iterator iterator = mOutputCacheEntries.find(outputContentHash);
+			if (mOutputCacheEntries.end() == iterator)
+			{
+				return false;
+			}
+			iterator->second.lastUse = ++mOutputCacheUseCounter;
+			mOutputCacheIndexDirty = true;
+		}
+
+		// Copy the output, the file I/O is done without holding the lock
+		uint64_t numberOfBytes = 0;
+		const bool result = ::detail::copyFile(mContext.getFileManager(), ::detail::getOutputCacheVirtualFilename(mOutputCacheVirtualDirectoryName, outputContentHash), virtualDestinationFilename, numberOfBytes);
+		std::lock_guard<std::mutex> mutexLock(mMutex);
+		if (result)
+		{
+			++mOutputCacheStatistics.numberOfHits;
+			mOutputCacheStatistics.numberOfRestoredBytes += numberOfBytes;
+		}
+		else
+		{
+			// The output cache file is gone, e.g. removed by another renderer toolkit instance
+			OutputCacheEntries::iterator iterator = mOutputCacheEntries.find(outputContentHash);
+			if (mOutputCacheEntries.end() != iterator)
+			{
+				mOutputCacheNumberOfBytes -= std::min(mOutputCacheNumberOfBytes, iterator->second.numberOfBytes);
+				mOutputCacheEntries.erase(iterator);
+			}
+		}
+		return result;
+	}
+
+	void CacheManager::storeOutputInCache(uint64_t outputContentHash, const std::string& virtualDestinationFilename)
+	{
+		{ // Is the output already inside the output cache?
+			std::lock_guard<std::mutex> mutexLock(mMutex);
+			if (mOutputCacheVirtualDirectoryName.empty() || 0 == mOutputCacheSizeLimit)
+			{
+				return;
+			}
+			OutputCacheEntries::iterator iterator = mOutputCacheEntries.find(outputContentHash);
+			if (mOutputCacheEntries.end() != iterator)
+			{
+				iterator->second.lastUse = ++mOutputCacheUseCounter;
+				mOutputCacheIndexDirty = true;
+				return;
+			}
+		}
+
+		// Copy the output, the file I/O is done without holding the lock
+		// -> No hard links since compilers overwrite their destination files in place which would modify the output cache as well
+		uint64_t numberOfBytes = 0;
+		if (::detail::copyFile(mContext.getFileManager(), virtualDestinationFilename, ::detail::getOutputCacheVirtualFilename(mOutputCacheVirtualDirectoryName, outputContentHash), numberOfBytes))
+		{
+			std::lock_guard<std::mutex> mutexLock(mMutex);
+			if (mOutputCacheEntries.emplace(outputContentHash, OutputCacheEntry{numberOfBytes, ++mOutputCacheUseCounter}).second)
+			{
+				mOutputCacheNumberOfBytes += numberOfBytes;
+			}
+			mOutputCacheIndexDirty = true;
+			evictOutputCacheEntries();
+		}
+	}
+
+	void CacheManager::evictOutputCacheEntries()
+	{
+		if (mOutputCacheNumberOfBytes > mOutputCacheSizeLimit)
+		{
+			// Sort the output cache entries by their last use, least recently used first
+			std::vector<std::pair<uint64_t, uint64_t>> lastUseAndOutputContentHashes;	// First = last use, second = output content hash
+			lastUseAndOutputContentHashes.reserve(mOutputCacheEntries.size());
+			for (const auto& outputCacheEntryElement : mOutputCacheEntries)
+			{
+				lastUseAndOutputContentHashes.emplace_back(outputCacheEntryElement.second.lastUse, outputCacheEntryElement.first);
+			}
+			std::sort(lastUseAndOutputContentHashes.begin(), lastUseAndOutputContentHashes.end());
+
+			// Evict least recently used output cache entries until the size limit is respected
+			const Renderer::IFileManager& fileManager = mContext.getFileManager();
+			for (const std::pair<uint64_t, uint64_t>& lastUseAndOutputContentHash : lastUseAndOutputContentHashes)
+			{
+				if (mOutputCacheNumberOfBytes <= mOutputCacheSizeLimit)
+				{
+					break;
+				}
+				OutputCacheEntries::iterator iterator = mOutputCacheEntries.find(lastUseAndOutputContentHash.second);
+				::detail::removeFile(fileManager, ::detail::getOutputCacheVirtualFilename(mOutputCacheVirtualDirectoryName, iterator->first));
+				mOutputCacheNumberOfBytes -= std::min(mOutputCacheNumberOfBytes, iterator->second.numberOfBytes);
+				mOutputCacheEntries.erase(iterator);
+				++mOutputCacheStatistics.numberOfEvictions;
+			}
+			mOutputCacheIndexDirty = true;
+		}
 	}
 
 	bool CacheManager::fillEntryForFile(const std::string& rhiTarget, Renderer::StringId fileId, CacheEntry& cacheEntry)
@@ -330,26 +698,56 @@ namespace RendererToolkit
 
 		// Get cache entry data if an entry exists
 		Renderer::StringId fileId(virtualFilename);
-		const bool hasFileEntry = fillEntryForFile(rhiTarget, fileId, cacheEntry);
-		if (hasFileEntry)
+		bool hasFileEntry = false;
 		{
-			// A file might be referenced by different assets so first check if the file was already checked by a previous call to this method
-			// If so return the result (the file shouldn't change between two checks while a compilation is running)
+			std::lock_guard<std::mutex> mutexLock(mMutex);
+			hasFileEntry = fillEntryForFile(rhiTarget, fileId, cacheEntry);
+			if (hasFileEntry)
 			{
-				CheckedFilesStatus::const_iterator iterator = mCheckedFilesStatus.find(fileId);
-				if (mCheckedFilesStatus.end() != iterator)
+				// A file might be referenced by different assets so first check if the file was already checked by a previous call to this method
+				// If so return the result (the file shouldn't change between two checks while a compilation is running)
 				{
-					// Copy cache entry data from stored one
-					cacheEntry = iterator->second.cacheEntry;
+					CheckedFilesStatus::const_iterator iterator = mCheckedFilesStatus.find(fileId);
+					if (mCheckedFilesStatus.end() != iterator)
+					{
+						// Copy cache entry data from stored one
+						cacheEntry = iterator->second.cacheEntry;
+
+						// The file was already checked before simply return the result
+						return iterator->second.changed;
+					}
+				}
+
+				// First and faster step: Check file size and file time as well as the compiler version (needed so that we also detect compiler version changes here too)
+				if (cacheEntry.fileSize == fileSize && cacheEntry.fileTime == fileTime && cacheEntry.compilerVersion == compilerVersion)
+				{
+					// The file has not changed -> store the result
+					CheckedFile& checkedFile = mCheckedFilesStatus[fileId];
+					checkedFile.changed = false;
+					checkedFile.cacheEntry = cacheEntry;
 
-					// The file was already checked before simply return the result
-					return iterator->second.changed;
+					// Source file didn't changed
+					return false;
 				}
 			}
+		}
 
-			// First and faster step: Check file size and file time as well as the compiler version (needed so that we also detect compiler version changes here too)
-			if (cacheEntry.fileSize == fileSize && cacheEntry.fileTime == fileTime && cacheEntry.compilerVersion == compilerVersion)
+		// Calculate the 64-bit FNV-1a hash
+		// -> Can be expensive for huge source files, so don't hold the lock while doing so or assets compiled in parallel would be serialized
+		const uint64_t fileHash = Renderer::Math::calculateFileFNV1a64ByVirtualFilename(fileManager, virtualFilename);
+		std::lock_guard<std::mutex> mutexLock(mMutex);
+		if (hasFileEntry)
+		{
+			// Current file differs in file size and/or file time do the second step:
+			// Check the compiler version and the 64-bit FNV-1a hash
+			if (cacheEntry.fileHash == fileHash && cacheEntry.compilerVersion == compilerVersion)
 			{
+				// Hash of the file and compiler version didn't changed but store the changed file size/time
+				cacheEntry.fileSize		   = fileSize;
+				cacheEntry.fileTime		   = fileTime;
+				cacheEntry.compilerVersion = compilerVersion;
+				storeOrUpdateCacheEntry(cacheEntry);
+
 				// The file has not changed -> store the result
 				CheckedFile& checkedFile = mCheckedFilesStatus[fileId];
 				checkedFile.changed = false;
@@ -360,38 +758,16 @@ namespace RendererToolkit
 			}
 			else
 			{
-				// Current file differs in file size and/or file time do the second step:
-				// Check the compiler version and the 64-bit FNV-1a hash
-				const uint64_t fileHash = Renderer::Math::calculateFileFNV1a64ByVirtualFilename(fileManager, virtualFilename);
-				if (cacheEntry.fileHash == fileHash && cacheEntry.compilerVersion == compilerVersion)
-				{
-					// Hash of the file and compiler version didn't changed but store the changed file size/time
-					cacheEntry.fileSize		   = fileSize;
-					cacheEntry.fileTime		   = fileTime;
-					cacheEntry.compilerVersion = compilerVersion;
-					storeOrUpdateCacheEntry(cacheEntry);
-
-					// The file has not changed -> store the result
-					CheckedFile& checkedFile = mCheckedFilesStatus[fileId];
-					checkedFile.changed = false;
-					checkedFile.cacheEntry = cacheEntry;
-
-					// Source file didn't changed
-					return false;
-				}
-				else
-				{
-					cacheEntry.fileSize		   = fileSize;
-					cacheEntry.fileTime		   = fileTime;
-					cacheEntry.fileHash		   = fileHash;
-					cacheEntry.compilerVersion = compilerVersion;
-					storeOrUpdateCacheEntry(cacheEntry);
+				cacheEntry.fileSize		   = fileSize;
+				cacheEntry.fileTime		   = fileTime;
+				cacheEntry.fileHash		   = fileHash;
+				cacheEntry.compilerVersion = compilerVersion;
+				storeOrUpdateCacheEntry(cacheEntry);
 
-					// The file has changed -> store the result
-					CheckedFile& checkedFile = mCheckedFilesStatus[fileId];
-					checkedFile.changed = true;
-					checkedFile.cacheEntry = cacheEntry;
-				}
+				// The file has changed -> store the result
+				CheckedFile& checkedFile = mCheckedFilesStatus[fileId];
+				checkedFile.changed = true;
+				checkedFile.cacheEntry = cacheEntry;
 			}
 		}
 		else
@@ -401,7 +777,7 @@ namespace RendererToolkit
 			cacheEntry.fileId			= fileId;
 			cacheEntry.fileSize			= fileSize;
 			cacheEntry.fileTime			= fileTime;
-			cacheEntry.fileHash			= Renderer::Math::calculateFileFNV1a64ByVirtualFilename(fileManager, virtualFilename);
+			cacheEntry.fileHash			= fileHash;
 			cacheEntry.compilerVersion	= compilerVersion;
 			storeOrUpdateCacheEntry(cacheEntry);
 
@@ -40,6 +40,7 @@ PRAGMA_WARNING_PUSH
 	PRAGMA_WARNING_DISABLE_MSVC(4626)	// warning C4626: 'std::codecvt<char16_t,char,_Mbstatet>': assignment operator was implicitly defined as deleted
 	PRAGMA_WARNING_DISABLE_MSVC(4668)	// warning C4668: '_M_HYBRID_X86_ARM64' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
 	PRAGMA_WARNING_DISABLE_MSVC(4774)	// warning C4774: 'sprintf_s' : format string expected in argument 3 is not a string literal
+	#include <mutex>
 	#include <string>
 	#include <vector>
 	#include <unordered_map>
@@ -75,6 +76,11 @@ namespace RendererToolkit
 	*
 	*  @note
 	*    - This manager caches the content hash of source assets to speed up project compilation when the source doesn't changes
+	*    - Thread-safe since assets are compiled in parallel, file content hashes are calculated without holding the lock
+	*    - Additionally there's a content-addressed output cache inside a local directory which is shared by all projects, RHI targets and branches:
+	*      The compiled output of an asset is stored by the hash of its inputs (source file contents, dependency output content hashes, compiler version,
+	*      RHI target, asset options and project configuration). If an asset needs to be compiled and there's already an output for identical inputs,
+	*      the output is copied instead of compiling the asset again. The output cache has a size limit, the least recently used outputs are evicted.
 	*/
 	class CacheManager final
 	{
@@ -109,8 +115,20 @@ namespace RendererToolkit
 		{
 			std::vector<CacheEntry>	sourceCacheEntries;
 			CacheEntry				assetCacheEntry;
+			uint64_t				outputContentHash = 0;		///< Output cache key, 0 if the output can't be cached
+			std::string				virtualDestinationFilename;	///< Virtual UTF-8 filename of the compiled output, stored inside the output cache by "RendererToolkit::CacheManager::storeOrUpdateCacheEntries()"
 		};
 
+		struct OutputCacheStatistics final
+		{
+			uint32_t numberOfHits		   = 0;	///< Number of assets which needed to be compiled and were restored from the output cache
+			uint32_t numberOfMisses		   = 0;	///< Number of assets which needed to be compiled and weren't inside the output cache
+			uint32_t numberOfEvictions	   = 0;	///< Number of outputs evicted from the output cache due to the size limit
+			uint64_t numberOfRestoredBytes = 0;	///< Number of bytes copied from the output cache
+		};
+
+		static constexpr uint64_t DEFAULT_OUTPUT_CACHE_SIZE_LIMIT = 10ull * 1024ull * 1024ull * 1024ull;	///< Default output cache size limit in bytes
+
 
 	//[-------------------------------------------------------]
 	//[ Public methods                                        ]
@@ -177,12 +195,42 @@ namespace RendererToolkit
 		*/
 		[[nodiscard]] bool needsToBeCompiled(const std::string& rhiTarget, const std::string& virtualAssetFilename, const std::vector<std::string>& virtualSourceFilenames, const std::string& virtualDestinationFilename, uint32_t compilerVersion, CacheEntries& cacheEntries);
 
+		/**
+		*  @brief
+		*    Return if an asset needs to be compiled
+		*
+		*  @param[in] rhiTarget
+		*    The UTF-8 rhi target name for which the asset should be compiled
+		*  @param[in] virtualAssetFilename
+		*    Virtual UTF-8 filename of the file containing the asset metadata
+		*  @param[in] virtualSourceFilenames
+		*    Virtual UTF-8 source filenames of the assets
+		*  @param[in] virtualDependencyFilenames
+		*    Virtual UTF-8 filenames of the assets the asset depends on, see "RendererToolkit::CacheManager::dependencyFilesChanged()"
+		*  @param[in] virtualDestinationFilename
+		*    The virtual UTF-8 filename of the destination file of the asset which contains the compiled data of the source
+		*  @param[in] compilerVersion
+		*    Compiler version so we can detect compiler version changes and enforce compiling even if the source data has not been changed
+		*  @param[out] cacheEntries
+		*    Receives information about the cache entries; to be passed into "RendererToolkit::CacheManager::storeOrUpdateCacheEntries()"
+		*
+		*  @return
+		*    "true" if the file needs to be compiled (aka source or dependency changed, destination doesn't exists or is yet unknown file) otherwise "false"
+		*
+		*  @note
+		*    - In case the asset needs to be compiled but the output cache contains an output for identical inputs, the destination file is restored from the output cache and "false" is returned
+		*/
+		[[nodiscard]] bool needsToBeCompiled(const std::string& rhiTarget, const std::string& virtualAssetFilename, const std::vector<std::string>& virtualSourceFilenames, const std::vector<std::string>& virtualDependencyFilenames, const std::string& virtualDestinationFilename, uint32_t compilerVersion, CacheEntries& cacheEntries);
+
 		/**
 		*  @brief
 		*    Store new cache entries or update existing ones
 		*
 		*  @param[in] cacheEntries
 		*    The cache entries data to store / update
+		*
+		*  @note
+		*    - Call this after the destination file has been written, the destination file is stored inside the output cache
 		*/
 		void storeOrUpdateCacheEntries(const CacheEntries& cacheEntries);
 
@@ -223,7 +271,37 @@ namespace RendererToolkit
 
 		/**
 		*  @brief
-		*    Clear the internal cache for file changes
+		*    Set the content hash of the project configuration influencing all compiled outputs
+		*
+		*  @param[in] configurationContentHash
+		*    Content hash of e.g. the RHI targets and the quality strategy, part of each output cache key
+		*/
+		inline void setConfigurationContentHash(uint64_t configurationContentHash)
+		{
+			mConfigurationContentHash = configurationContentHash;
+		}
+
+		/**
+		*  @brief
+		*    Set the output cache size limit
+		*
+		*  @param[in] numberOfBytes
+		*    Output cache size limit in bytes, 0 to disable the output cache
+		*/
+		void setOutputCacheSizeLimit(uint64_t numberOfBytes);
+
+		/**
+		*  @brief
+		*    Return the output cache statistics since the last "RendererToolkit::CacheManager::clearInternalCache()"-call
+		*
+		*  @return
+		*    The output cache statistics
+		*/
+		[[nodiscard]] OutputCacheStatistics getOutputCacheStatistics();
+
+		/**
+		*  @brief
+		*    Clear the internal cache for file changes as well as the output cache statistics
 		*/
 		void clearInternalCache();
 
@@ -244,6 +322,39 @@ namespace RendererToolkit
 		*/
 		void loadCache();
 
+		/**
+		*  @brief
+		*    Calculate the output cache key of an asset and remember it for assets depending on this asset
+		*
+		*  @return
+		*    The output content hash, 0 if the output can't be cached (e.g. output content hash of a dependency is unknown)
+		*/
+		[[nodiscard]] uint64_t calculateOutputContentHash(const std::string& rhiTarget, const std::string& virtualAssetFilename, const std::vector<std::string>& virtualDependencyFilenames, uint32_t compilerVersion, const CacheEntries& cacheEntries);
+
+		/**
+		*  @brief
+		*    Copy an output from the output cache to the given destination file
+		*
+		*  @return
+		*    "true" if the output was restored, else "false"
+		*/
+		[[nodiscard]] bool restoreOutputFromCache(uint64_t outputContentHash, const std::string& virtualDestinationFilename);
+
+		/**
+		*  @brief
+		*    Copy the given destination file into the output cache, evict least recently used outputs if the size limit has been exceeded
+		*/
+		void storeOutputInCache(uint64_t outputContentHash, const std::string& virtualDestinationFilename);
+
+		/**
+		*  @brief
+		*    Evict least recently used outputs until the output cache size limit is respected
+		*
+		*  @note
+		*    - The caller must hold "RendererToolkit::CacheManager::mMutex"
+		*/
+		void evictOutputCacheEntries();
+
 		/**
 		*  @brief
 		*    Fill an cache entry with the stored data, if it exists
@@ -257,6 +368,9 @@ namespace RendererToolkit
 		*
 		*  @return
 		*    "true" if a cache entry exists otherwise "false"
+		*
+		*  @note
+		*    - The caller must hold "RendererToolkit::CacheManager::mMutex"
 		*/
 		[[nodiscard]] bool fillEntryForFile(const std::string& rhiTarget, Renderer::StringId fileId, CacheEntry& cacheEntry);
 
@@ -287,6 +401,9 @@ namespace RendererToolkit
 		*
 		*  @param[in] cacheEntry
 		*    The cache entry data to store / update
+		*
+		*  @note
+		*    - The caller must hold "RendererToolkit::CacheManager::mMutex"
 		*/
 		void storeOrUpdateCacheEntry(const CacheEntry& cacheEntry);
 
@@ -307,6 +424,14 @@ namespace RendererToolkit
 		};
 		typedef std::unordered_map<uint32_t, CheckedFile> CheckedFilesStatus;
 
+		struct OutputCacheEntry final
+		{
+			uint64_t numberOfBytes;
+			uint64_t lastUse;	///< Value of the output cache use counter when the output was used the last time, for least recently used eviction
+		};
+		typedef std::unordered_map<uint64_t, OutputCacheEntry> OutputCacheEntries;		///< Key = output content hash
+		typedef std::unordered_map<uint32_t, uint64_t> OutputContentHashByFileId;	///< Key = file ID of the virtual asset filename, value = output content hash
+
 
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
@@ -314,12 +439,24 @@ namespace RendererToolkit
 	private:
 		const Context&	   mContext;
 		const std::string  mProjectName;	///< UTF-8 name of the project this cache is for
+		std::mutex		   mMutex;			///< Guards all data below
 		StoredCacheEntries mStoredCacheEntries;
 		bool			   mDiskCacheDirty;
 
 		// We use here "uint32_t" instead of "Renderer::StringId" because we don't define a "std::hash"-method for "Renderer::StringId", which internal stores an "uint32_t"
 		CheckedFilesStatus mCheckedFilesStatus;	///< Holds the status of each file checked via "RendererToolkit::CacheManager::checkIfFileChanged()"
 
+		// Content-addressed output cache
+		uint64_t				  mConfigurationContentHash;
+		std::string				  mOutputCacheVirtualDirectoryName;		///< Empty if there's no output cache (e.g. writing local data isn't allowed or size limit is 0)
+		uint64_t				  mOutputCacheSizeLimit;				///< Output cache size limit in bytes
+		uint64_t				  mOutputCacheNumberOfBytes;			///< Current output cache size in bytes
+		uint64_t				  mOutputCacheUseCounter;				///< Increased each time an output is used, for least recently used eviction
+		OutputCacheEntries		  mOutputCacheEntries;
+		bool					  mOutputCacheIndexDirty;
+		OutputContentHashByFileId mOutputContentHashByFileId;			///< Output content hashes of the assets checked during the current compilation run
+		OutputCacheStatistics	  mOutputCacheStatistics;
+
 
 	};
 
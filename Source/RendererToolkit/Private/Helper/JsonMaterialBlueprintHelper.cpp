@@ -1221,9 +1221,11 @@ namespace RendererToolkit
 			file.write(&computeShaderBlueprintAssetId, sizeof(Renderer::AssetId));
 		}
 
-		{ // Vertex attributes asset ID
+		{ // Vertex attributes asset IDs, the quantized vertex attributes are optional and used for meshes compiled with "QuantizeVertices"
 			const Renderer::AssetId vertexAttributesAssetId = StringHelper::getAssetIdByString(rapidJsonValueGraphicsPipelineState["VertexAttributes"].GetString(), input);
 			file.write(&vertexAttributesAssetId, sizeof(Renderer::AssetId));
+			const Renderer::AssetId quantizedVertexAttributesAssetId = rapidJsonValueGraphicsPipelineState.HasMember("QuantizedVertexAttributes") ? StringHelper::getAssetIdByString(rapidJsonValueGraphicsPipelineState["QuantizedVertexAttributes"].GetString(), input) : Renderer::getInvalid<Renderer::AssetId>();
+			file.write(&quantizedVertexAttributesAssetId, sizeof(Renderer::AssetId));
 		}
 
 		{ // Shader blueprints
@@ -47,6 +47,7 @@
 #include <Renderer/Public/Core/File/MemoryFile.h>
 #include <Renderer/Public/Core/File/IFileManager.h>
 #include <Renderer/Public/Core/File/FileSystemHelper.h>
+#include <Renderer/Public/Core/Time/Stopwatch.h>
 #include <Renderer/Public/Core/Platform/PlatformManager.h>
 #include <Renderer/Public/Asset/AssetPackage.h>
 #include <Renderer/Public/Asset/Loader/AssetPackageFileFormat.h>
@@ -65,7 +66,10 @@ PRAGMA_WARNING_PUSH
 	#include <rapidjson/document.h>
 PRAGMA_WARNING_POP
 
+#include <thread>
+#include <atomic>
 #include <algorithm>
+#include <exception>
 #include <unordered_set>
 
 
@@ -78,6 +82,52 @@ namespace
 	{
 
 
+		//[-------------------------------------------------------]
+		//[ Global definitions                                    ]
+		//[-------------------------------------------------------]
+		typedef std::unordered_map<uint32_t, uint32_t> DependencyLevelByAssetCompilerClassId;	///< Key = "RendererToolkit::AssetCompilerClassId", value = dependency level, assets of dependency level 0 don't depend on other assets
+
+		struct AssetCompilerDependency final
+		{
+			uint32_t assetCompilerClassId;				///< "RendererToolkit::AssetCompilerClassId" of the depending assets
+			uint32_t dependencyAssetCompilerClassId;	///< "RendererToolkit::AssetCompilerClassId" of the assets which must be compiled first
+		};
+
+		/**
+		*  @brief
+		*    Acyclic dependency graph between the asset types
+		*
+		*  @note
+		*    - Asset compilers only read source assets, but compiling dependencies first ensures the cache manager has seen changed dependencies and
+		*      the asset monitor reloads resources in an order in which e.g. a material doesn't get reloaded before its material blueprint
+		*/
+		static constexpr AssetCompilerDependency ASSET_COMPILER_DEPENDENCIES[] =
+		{
+			{ RendererToolkit::ShaderBlueprintAssetCompiler::CLASS_ID,		RendererToolkit::ShaderPieceAssetCompiler::CLASS_ID },
+			{ RendererToolkit::MaterialBlueprintAssetCompiler::CLASS_ID,	RendererToolkit::ShaderBlueprintAssetCompiler::CLASS_ID },
+			{ RendererToolkit::MaterialBlueprintAssetCompiler::CLASS_ID,	RendererToolkit::VertexAttributesAssetCompiler::CLASS_ID },
+			{ RendererToolkit::MaterialBlueprintAssetCompiler::CLASS_ID,	RendererToolkit::TextureAssetCompiler::CLASS_ID },
+			{ RendererToolkit::MaterialAssetCompiler::CLASS_ID,				RendererToolkit::MaterialBlueprintAssetCompiler::CLASS_ID },
+			{ RendererToolkit::MaterialAssetCompiler::CLASS_ID,				RendererToolkit::TextureAssetCompiler::CLASS_ID },
+			{ RendererToolkit::SkeletonAnimationAssetCompiler::CLASS_ID,	RendererToolkit::SkeletonAssetCompiler::CLASS_ID },
+			{ RendererToolkit::MeshAssetCompiler::CLASS_ID,					RendererToolkit::MaterialAssetCompiler::CLASS_ID },
+			{ RendererToolkit::MeshAssetCompiler::CLASS_ID,					RendererToolkit::SkeletonAssetCompiler::CLASS_ID },
+			{ RendererToolkit::SceneAssetCompiler::CLASS_ID,				RendererToolkit::MeshAssetCompiler::CLASS_ID },
+			{ RendererToolkit::SceneAssetCompiler::CLASS_ID,				RendererToolkit::MaterialAssetCompiler::CLASS_ID },
+			{ RendererToolkit::SceneAssetCompiler::CLASS_ID,				RendererToolkit::SkeletonAnimationAssetCompiler::CLASS_ID },
+			{ RendererToolkit::CompositorNodeAssetCompiler::CLASS_ID,		RendererToolkit::MaterialAssetCompiler::CLASS_ID },
+			{ RendererToolkit::CompositorNodeAssetCompiler::CLASS_ID,		RendererToolkit::MaterialBlueprintAssetCompiler::CLASS_ID },
+			{ RendererToolkit::CompositorWorkspaceAssetCompiler::CLASS_ID,	RendererToolkit::CompositorNodeAssetCompiler::CLASS_ID }
+		};
+
+		struct AssetCompilerStatistics final
+		{
+			uint32_t	numberOfAssets = 0;
+			std::time_t microseconds   = 0;	///< Accumulated compile time of all assets, not wall time
+		};
+		typedef std::unordered_map<uint32_t, AssetCompilerStatistics> AssetCompilerStatisticsByClassId;	///< Key = "RendererToolkit::AssetCompilerClassId"
+
+
 		//[-------------------------------------------------------]
 		//[ Global functions                                      ]
 		//[-------------------------------------------------------]
@@ -113,7 +163,74 @@ namespace
 			}
 		}
 
-		void outputAsset(const Renderer::IFileManager& fileManager, const std::string& assetIdAsString, const std::string& virtualOutputAssetFilename, Renderer::AssetPackage& outputAssetPackage)
+		[[nodiscard]] DependencyLevelByAssetCompilerClassId getDependencyLevelByAssetCompilerClassId()
+		{
+			// The dependency level of an asset type is the longest path to an asset type without dependencies
+			DependencyLevelByAssetCompilerClassId dependencyLevelByAssetCompilerClassId;
+			bool changed = true;
+			while (changed)
+			{
+				changed = false;
+				for (const AssetCompilerDependency& assetCompilerDependency : ASSET_COMPILER_DEPENDENCIES)
+				{
+					const uint32_t minimumDependencyLevel = dependencyLevelByAssetCompilerClassId[assetCompilerDependency.dependencyAssetCompilerClassId] + 1;
+					uint32_t& dependencyLevel = dependencyLevelByAssetCompilerClassId[assetCompilerDependency.assetCompilerClassId];
+					if (dependencyLevel < minimumDependencyLevel)
+					{
+						dependencyLevel = minimumDependencyLevel;
+						changed = true;
+					}
+				}
+			}
+			return dependencyLevelByAssetCompilerClassId;
+		}
+
+		[[nodiscard]] const char* getAssetCompilerName(uint32_t assetCompilerClassId)
+		{
+			switch (assetCompilerClassId)
+			{
+				case RendererToolkit::TextureAssetCompiler::CLASS_ID:
+					return "Texture";
+
+				case RendererToolkit::ShaderPieceAssetCompiler::CLASS_ID:
+					return "Shader piece";
+
+				case RendererToolkit::ShaderBlueprintAssetCompiler::CLASS_ID:
+					return "Shader blueprint";
+
+				case RendererToolkit::MaterialBlueprintAssetCompiler::CLASS_ID:
+					return "Material blueprint";
+
+				case RendererToolkit::MaterialAssetCompiler::CLASS_ID:
+					return "Material";
+
+				case RendererToolkit::SkeletonAssetCompiler::CLASS_ID:
+					return "Skeleton";
+
+				case RendererToolkit::SkeletonAnimationAssetCompiler::CLASS_ID:
+					return "Skeleton animation";
+
+				case RendererToolkit::MeshAssetCompiler::CLASS_ID:
+					return "Mesh";
+
+				case RendererToolkit::SceneAssetCompiler::CLASS_ID:
+					return "Scene";
+
+				case RendererToolkit::CompositorNodeAssetCompiler::CLASS_ID:
+					return "Compositor node";
+
+				case RendererToolkit::CompositorWorkspaceAssetCompiler::CLASS_ID:
+					return "Compositor workspace";
+
+				case RendererToolkit::VertexAttributesAssetCompiler::CLASS_ID:
+					return "Vertex attributes";
+
+				default:
+					return "Unknown";
+			}
+		}
+
+		void outputAsset(const Renderer::IFileManager& fileManager, const std::string& assetIdAsString, const std::string& virtualOutputAssetFilename, Renderer::AssetPackage& outputAssetPackage, std::mutex* outputAssetPackageMutex)
 		{
 			// Sanity check
 			const std::string virtualFilename = assetIdAsString + std_filesystem::path(virtualOutputAssetFilename).extension().generic_string();
@@ -126,6 +243,12 @@ namespace
 			Renderer::Asset outputAsset;
 			outputAsset.assetId = Renderer::AssetId(assetIdAsString.c_str());
 			outputAsset.fileHash = Renderer::Math::calculateFileFNV1a64ByVirtualFilename(fileManager, virtualOutputAssetFilename.c_str());
+			std::unique_lock<std::mutex> mutexLock;
+			if (nullptr != outputAssetPackageMutex)
+			{
+				// Assets are compiled in parallel
+				mutexLock = std::unique_lock<std::mutex>(*outputAssetPackageMutex);
+			}
 			Renderer::Asset* asset = outputAssetPackage.tryGetWritableAssetByAssetId(outputAsset.assetId);
 			if (nullptr != asset)
 			{
@@ -163,9 +286,9 @@ namespace RendererToolkit
 		mRendererToolkitImpl(rendererToolkitImpl),
 		mContext(rendererToolkitImpl.getContext()),
 		mQualityStrategy(QualityStrategy::PRODUCTION),
+		mNumberOfThreadsPerAssetCompiler(1),
 		mRapidJsonDocument(nullptr),
 		mProjectAssetMonitor(nullptr),
-		mShutdownThread(false),
 		mCacheManager(nullptr)
 	{
 		// Nothing here
@@ -175,16 +298,19 @@ namespace RendererToolkit
 	{
 		if (isInitialized())
 		{
-			// Shutdown worker thread
-			mShutdownThread = true;
-			mThread.join();
-
 			// Clear
 			clear();
 			for (const auto& pair : mAssetCompilerByClassId)
 			{
 				delete pair.second;
 			}
+			for (const AssetCompilerByClassId& assetCompilerByClassId : mWorkerAssetCompilers)
+			{
+				for (const auto& pair : assetCompilerByClassId)
+				{
+					delete pair.second;
+				}
+			}
 
 			// Destroy the cache manager
 			delete mCacheManager;
@@ -232,7 +358,7 @@ namespace RendererToolkit
 			// Compile the asset
 			RHI_ASSERT(getContext(), nullptr != assetCompiler, "Invalid asset compiler")
 			RHI_ASSERT(getContext(), nullptr != mRapidJsonDocument, "Invalid renderer toolkit Rapid JSON document")
-			const IAssetCompiler::Configuration configuration(rapidJsonDocument, (*mRapidJsonDocument)["Targets"], rhiTarget, mQualityStrategy);
+			const IAssetCompiler::Configuration configuration(rapidJsonDocument, (*mRapidJsonDocument)["Targets"], rhiTarget, mQualityStrategy, mNumberOfThreadsPerAssetCompiler);
 			return assetCompiler->checkIfChanged(input, configuration);
 		}
 		catch (const std::exception& e)
@@ -248,57 +374,8 @@ namespace RendererToolkit
 
 	void ProjectImpl::compileAsset(const Renderer::Asset& asset, const char* rhiTarget, Renderer::AssetPackage& outputAssetPackage)
 	{
-		try
-		{
-			// The renderer toolkit is now considered to be busy
-			mRendererToolkitImpl.setState(IRendererToolkit::State::BUSY);
-
-			// Get asset compiler class instance
-			const std::string& virtualAssetFilename = asset.virtualFilename;
-			rapidjson::Document rapidJsonDocument(rapidjson::kObjectType);
-			const IAssetCompiler* assetCompiler = getSourceAssetCompilerAndRapidJsonDocument(virtualAssetFilename, rapidJsonDocument);
-
-			// Dispatch asset compiler
-			// TODO(co) Add multithreading support: Add compiler queue which is processed in the background, ensure compiler instances are reused
-
-			// Get the asset input directory and asset output directory
-			const std::string virtualAssetPackageInputDirectory = mProjectName + '/' + mAssetPackageDirectoryName;
-			const std::string virtualAssetInputDirectory = std_filesystem::path(virtualAssetFilename).parent_path().generic_string();
-			const std::string assetDirectory = virtualAssetInputDirectory.substr(virtualAssetInputDirectory.find('/') + 1);
-			const std::string renderTargetDataRootDirectory = getRenderTargetDataRootDirectory(rhiTarget);
-			const std::string virtualAssetOutputDirectory = renderTargetDataRootDirectory + '/' + mProjectName + '/' + mAssetPackageDirectoryName + '/' + assetDirectory;
-
-			// Ensure that the asset output directory exists, else creating output file streams will fail
-			Renderer::IFileManager& fileManager = mContext.getFileManager();
-			fileManager.createDirectories(virtualAssetOutputDirectory.c_str());
-
-			// Do we need to mount a directory now? (e.g. "DataPc", "DataMobile" etc.)
-			if (fileManager.getMountPoint(renderTargetDataRootDirectory.c_str()) == nullptr)
-			{
-				fileManager.mountDirectory((fileManager.getAbsoluteRootDirectory() + '/' + renderTargetDataRootDirectory).c_str(), renderTargetDataRootDirectory.c_str());
-			}
-
-			// Asset compiler input
-			IAssetCompiler::Input input(mContext, mProjectName, *mCacheManager, virtualAssetPackageInputDirectory, virtualAssetFilename, virtualAssetInputDirectory, virtualAssetOutputDirectory, mSourceAssetIdToCompiledAssetId, mCompiledAssetIdToSourceAssetId, mSourceAssetIdToVirtualFilename, mDefaultTextureAssetIds);
-
-			// Asset compiler configuration
-			RHI_ASSERT(getContext(), nullptr != mRapidJsonDocument, "Invalid renderer toolkit Rapid JSON document")
-			const IAssetCompiler::Configuration configuration(rapidJsonDocument, (*mRapidJsonDocument)["Targets"], rhiTarget, mQualityStrategy);
-
-			// Compile the asset
-			RHI_ASSERT(getContext(), nullptr != assetCompiler, "Invalid asset compiler")
-			assetCompiler->compile(input, configuration);
-
-			{ // Update the output asset package
-				const std::string assetName = std_filesystem::path(input.virtualAssetFilename).stem().generic_string();
-				const std::string assetIdAsString = input.projectName + '/' + assetDirectory + '/' + assetName;
-				::detail::outputAsset(input.context.getFileManager(), assetIdAsString, assetCompiler->getVirtualOutputAssetFilename(input, configuration), outputAssetPackage);
-			}
-		}
-		catch (const std::exception& e)
-		{
-			throw std::runtime_error("Failed to compile asset with filename \"" + std::string(asset.virtualFilename) + "\": " + std::string(e.what()));
-		}
+		// Compile the asset
+		compileAssetByAssetCompilers(asset, rhiTarget, mAssetCompilerByClassId, mNumberOfThreadsPerAssetCompiler, outputAssetPackage, nullptr);
 
 		// Save renderer toolkit cache
 		mCacheManager->saveCache();
@@ -324,6 +401,14 @@ namespace RendererToolkit
 
 	void ProjectImpl::onCompilationRunFinished()
 	{
+		{ // Log the content-addressed output cache statistics
+			const CacheManager::OutputCacheStatistics outputCacheStatistics = mCacheManager->getOutputCacheStatistics();
+			if (outputCacheStatistics.numberOfHits + outputCacheStatistics.numberOfMisses > 0)
+			{
+				RHI_LOG(mContext, INFORMATION, "Renderer toolkit output cache: %u hits, %u misses, %u evictions, %.2f MiB restored", outputCacheStatistics.numberOfHits, outputCacheStatistics.numberOfMisses, outputCacheStatistics.numberOfEvictions, static_cast<double>(outputCacheStatistics.numberOfRestoredBytes) / (1024.0 * 1024.0))
+			}
+		}
+
 		// Compilation run finished clear internal cache of cache manager
 		mCacheManager->saveCache();
 		mCacheManager->clearInternalCache();
@@ -382,12 +467,26 @@ namespace RendererToolkit
 			}
 			readTargetsByFilename(rapidJsonValueProject["TargetsFilename"].GetString());
 			::detail::optionalQualityStrategy(rapidJsonValueProject, "QualityStrategy", mQualityStrategy);
+			{ // Optional number of threads per asset compiler, zero means using all hardware threads
+				unsigned int numberOfThreadsPerAssetCompiler = 0;
+				JsonHelper::optionalIntegerProperty(rapidJsonValueProject, "NumberOfThreadsPerAssetCompiler", numberOfThreadsPerAssetCompiler);
+				mNumberOfThreadsPerAssetCompiler = (0 == numberOfThreadsPerAssetCompiler) ? std::max(std::thread::hardware_concurrency(), 1u) : numberOfThreadsPerAssetCompiler;
+			}
 			RHI_LOG(mContext, INFORMATION, "Found %u assets", mAssetPackage.getSortedAssetVector().size())
 		}
 
 		// Setup project folder for cache manager, it will store there its data
 		mCacheManager = new CacheManager(mContext, mProjectName);
 
+		{ // Setup the content-addressed output cache: Outputs depend on the targets and the quality strategy as well
+			uint64_t configurationContentHash = Renderer::Math::calculateFileFNV1a64ByVirtualFilename(fileManager, (mProjectName + '/' + rapidJsonValueProject["TargetsFilename"].GetString()).c_str());
+			configurationContentHash = Renderer::Math::calculateFNV1a64(reinterpret_cast<const uint8_t*>(&mQualityStrategy), sizeof(QualityStrategy), configurationContentHash);
+			mCacheManager->setConfigurationContentHash(configurationContentHash);
+			unsigned int outputCacheSizeLimitInMiB = static_cast<unsigned int>(CacheManager::DEFAULT_OUTPUT_CACHE_SIZE_LIMIT / (1024 * 1024));
+			JsonHelper::optionalIntegerProperty(rapidJsonValueProject, "OutputCacheSizeLimitInMiB", outputCacheSizeLimitInMiB);
+			mCacheManager->setOutputCacheSizeLimit(static_cast<uint64_t>(outputCacheSizeLimitInMiB) * 1024 * 1024);
+		}
+
 		// The renderer toolkit is now considered to be idle
 		mRendererToolkitImpl.setState(IRendererToolkit::State::IDLE);
 	}
@@ -473,70 +572,33 @@ namespace RendererToolkit
 			}
 
 			// Compile all changed assets
+			std::vector<const Renderer::Asset*> assetsToCompile;
 			if (outputAssetPackage.getSortedAssetVector().empty())
 			{
 				// Slow path: Failed to load an already existing compiled asset package, we need to build a complete one
+				// -> Reminder: Assets might not be fully compiled but just collect needed information
 				outputAssetPackage.getWritableSortedAssetVector().reserve(numberOfAssets);
+				assetsToCompile.reserve(numberOfAssets);
 				for (size_t i = 0; i < numberOfAssets; ++i)
 				{
-					// Reminder: Assets might not be fully compiled but just collect needed information
-					RHI_LOG(mContext, INFORMATION, "Compiling asset %u of %u", i + 1, numberOfAssets)
-					const Renderer::Asset& asset = sortedAssetVector[i];
-					compileAsset(asset, rhiTarget, outputAssetPackage);
-					if (nullptr != mProjectAssetMonitor)
-					{
-						// In case a shutdown was requested while we're compiling the changed assets, shutdown immediately
-						if (mProjectAssetMonitor->mShutdownThread)
-						{
-							break;
-						}
-
-						// Call "Renderer::IRenderer::reloadResourceByAssetId()" directly after an asset has been compiled to see changes as early as possible
-						const Renderer::AssetId sourceAssetId = asset.assetId;
-						if (std::find(changedAssetIds.cbegin(), changedAssetIds.cend(), sourceAssetId) != changedAssetIds.cend())
-						{
-							SourceAssetIdToCompiledAssetId::const_iterator iterator = mSourceAssetIdToCompiledAssetId.find(sourceAssetId);
-							if (iterator == mSourceAssetIdToCompiledAssetId.cend())
-							{
-								throw std::runtime_error(std::string("Source asset ID ") + std::to_string(sourceAssetId) + " is unknown");
-							}
-							mProjectAssetMonitor->mRenderer.reloadResourceByAssetId(iterator->second);
-						}
-					}
+					assetsToCompile.push_back(&sortedAssetVector[i]);
 				}
 			}
 			else
 			{
 				// Fast path: We were able to load a previously compiled asset package and now only have to care about the changed assets
-				const size_t numberOfChangedAssets = changedAssetIds.size();
-				for (size_t i = 0; i < numberOfChangedAssets; ++i)
+				assetsToCompile.reserve(changedAssetIds.size());
+				for (const Renderer::AssetId& sourceAssetId : changedAssetIds)
 				{
-					const Renderer::AssetId sourceAssetId = changedAssetIds[i];
 					const Renderer::Asset* asset = mAssetPackage.tryGetAssetByAssetId(sourceAssetId);
 					if (nullptr == asset)
 					{
 						throw std::runtime_error(std::string("Source asset ID ") + std::to_string(sourceAssetId) + " is unknown");
 					}
-					RHI_LOG(mContext, INFORMATION, "Compiling asset %u of %u", i + 1, numberOfChangedAssets)
-					compileAsset(*asset, rhiTarget, outputAssetPackage);
-					if (nullptr != mProjectAssetMonitor)
-					{
-						// In case a shutdown was requested while we're compiling the changed assets, shutdown immediately
-						if (mProjectAssetMonitor->mShutdownThread)
-						{
-							break;
-						}
-
-						// Call "Renderer::IRenderer::reloadResourceByAssetId()" directly after an asset has been compiled to see changes as early as possible
-						SourceAssetIdToCompiledAssetId::const_iterator iterator = mSourceAssetIdToCompiledAssetId.find(sourceAssetId);
-						if (iterator == mSourceAssetIdToCompiledAssetId.cend())
-						{
-							throw std::runtime_error(std::string("Source asset ID ") + std::to_string(sourceAssetId) + " is unknown");
-						}
-						mProjectAssetMonitor->mRenderer.reloadResourceByAssetId(iterator->second);
-					}
+					assetsToCompile.push_back(asset);
 				}
 			}
+			compileAssetsInParallel(assetsToCompile, changedAssetIds, rhiTarget, outputAssetPackage);
 
 			{ // Write asset package
 				Renderer::AssetPackage::SortedAssetVector& sortedOutputAssetVector = outputAssetPackage.getWritableSortedAssetVector();
@@ -602,22 +664,8 @@ namespace RendererToolkit
 	//[-------------------------------------------------------]
 	void ProjectImpl::initialize()
 	{
-		mThread = std::thread(&ProjectImpl::threadWorker, this);
-
 		// Setup asset compilers map
-		// TODO(co) Currently this is fixed build in, later on me might want to have this dynamic so we can plugin additional asset compilers
-		mAssetCompilerByClassId.emplace(TextureAssetCompiler::CLASS_ID, new TextureAssetCompiler(mContext));
-		mAssetCompilerByClassId.emplace(ShaderPieceAssetCompiler::CLASS_ID, new ShaderPieceAssetCompiler());
-		mAssetCompilerByClassId.emplace(ShaderBlueprintAssetCompiler::CLASS_ID, new ShaderBlueprintAssetCompiler());
-		mAssetCompilerByClassId.emplace(MaterialBlueprintAssetCompiler::CLASS_ID, new MaterialBlueprintAssetCompiler());
-		mAssetCompilerByClassId.emplace(MaterialAssetCompiler::CLASS_ID, new MaterialAssetCompiler());
-		mAssetCompilerByClassId.emplace(SkeletonAssetCompiler::CLASS_ID, new SkeletonAssetCompiler());
-		mAssetCompilerByClassId.emplace(SkeletonAnimationAssetCompiler::CLASS_ID, new SkeletonAnimationAssetCompiler());
-		mAssetCompilerByClassId.emplace(MeshAssetCompiler::CLASS_ID, new MeshAssetCompiler());
-		mAssetCompilerByClassId.emplace(SceneAssetCompiler::CLASS_ID, new SceneAssetCompiler());
-		mAssetCompilerByClassId.emplace(CompositorNodeAssetCompiler::CLASS_ID, new CompositorNodeAssetCompiler());
-		mAssetCompilerByClassId.emplace(CompositorWorkspaceAssetCompiler::CLASS_ID, new CompositorWorkspaceAssetCompiler());
-		mAssetCompilerByClassId.emplace(VertexAttributesAssetCompiler::CLASS_ID, new VertexAttributesAssetCompiler());
+		createAssetCompilers(mAssetCompilerByClassId);
 		for (const auto& element : mAssetCompilerByClassId)
 		{
 			const std::string_view& filenameExtension = element.second->getOptionalUniqueAssetFilenameExtension();
@@ -644,6 +692,7 @@ namespace RendererToolkit
 		shutdownAssetMonitor();
 		mProjectName.clear();
 		mQualityStrategy = QualityStrategy::PRODUCTION;
+		mNumberOfThreadsPerAssetCompiler = 1;
 		mAbsoluteProjectDirectory.clear();
 		mAssetPackage.clear();
 		mAssetPackageDirectoryName.clear();
@@ -657,6 +706,23 @@ namespace RendererToolkit
 		}
 	}
 
+	void ProjectImpl::createAssetCompilers(AssetCompilerByClassId& assetCompilerByClassId) const
+	{
+		// TODO(co) Currently this is fixed build in, later on me might want to have this dynamic so we can plugin additional asset compilers
+		assetCompilerByClassId.emplace(TextureAssetCompiler::CLASS_ID, new TextureAssetCompiler(mContext));
+		assetCompilerByClassId.emplace(ShaderPieceAssetCompiler::CLASS_ID, new ShaderPieceAssetCompiler());
+		assetCompilerByClassId.emplace(ShaderBlueprintAssetCompiler::CLASS_ID, new ShaderBlueprintAssetCompiler());
+		assetCompilerByClassId.emplace(MaterialBlueprintAssetCompiler::CLASS_ID, new MaterialBlueprintAssetCompiler());
+		assetCompilerByClassId.emplace(MaterialAssetCompiler::CLASS_ID, new MaterialAssetCompiler());
+		assetCompilerByClassId.emplace(SkeletonAssetCompiler::CLASS_ID, new SkeletonAssetCompiler());
+		assetCompilerByClassId.emplace(SkeletonAnimationAssetCompiler::CLASS_ID, new SkeletonAnimationAssetCompiler());
+		assetCompilerByClassId.emplace(MeshAssetCompiler::CLASS_ID, new MeshAssetCompiler());
+		assetCompilerByClassId.emplace(SceneAssetCompiler::CLASS_ID, new SceneAssetCompiler());
+		assetCompilerByClassId.emplace(CompositorNodeAssetCompiler::CLASS_ID, new CompositorNodeAssetCompiler());
+		assetCompilerByClassId.emplace(CompositorWorkspaceAssetCompiler::CLASS_ID, new CompositorWorkspaceAssetCompiler());
+		assetCompilerByClassId.emplace(VertexAttributesAssetCompiler::CLASS_ID, new VertexAttributesAssetCompiler());
+	}
+
 	void ProjectImpl::readAssetPackageByDirectory(const std::string& directoryName)
 	{
 		// Get the asset package name
@@ -864,13 +930,229 @@ namespace RendererToolkit
 		return assetCompiler;
 	}
 
-	void ProjectImpl::threadWorker()
+	AssetCompilerClassId ProjectImpl::compileAssetByAssetCompilers(const Renderer::Asset& asset, const char* rhiTarget, const AssetCompilerByClassId& assetCompilerByClassId, uint32_t numberOfThreads, Renderer::AssetPackage& outputAssetPackage, std::mutex* outputAssetPackageMutex)
 	{
-		Renderer::PlatformManager::setCurrentThreadName("Project worker", "Renderer toolkit: Project worker");
+		try
+		{
+			// The renderer toolkit is now considered to be busy
+			mRendererToolkitImpl.setState(IRendererToolkit::State::BUSY);
+
+			// Get asset compiler class instance
+			// -> Each asset compiler worker thread has its own asset compiler instances
+			const std::string& virtualAssetFilename = asset.virtualFilename;
+			rapidjson::Document rapidJsonDocument(rapidjson::kObjectType);
+			const IAssetCompiler* assetCompiler = getSourceAssetCompilerAndRapidJsonDocument(virtualAssetFilename, rapidJsonDocument);
+			RHI_ASSERT(getContext(), nullptr != assetCompiler, "Invalid asset compiler")
+			const AssetCompilerClassId assetCompilerClassId = assetCompiler->getAssetCompilerClassId();
+			{
+				AssetCompilerByClassId::const_iterator iterator = assetCompilerByClassId.find(assetCompilerClassId);
+				RHI_ASSERT(getContext(), assetCompilerByClassId.cend() != iterator, "Invalid asset compiler")
+				assetCompiler = iterator->second;
+			}
+
+			// Get the asset input directory and asset output directory
+			const std::string virtualAssetPackageInputDirectory = mProjectName + '/' + mAssetPackageDirectoryName;
+			const std::string virtualAssetInputDirectory = std_filesystem::path(virtualAssetFilename).parent_path().generic_string();
+			const std::string assetDirectory = virtualAssetInputDirectory.substr(virtualAssetInputDirectory.find('/') + 1);
+			const std::string renderTargetDataRootDirectory = getRenderTargetDataRootDirectory(rhiTarget);
+			const std::string virtualAssetOutputDirectory = renderTargetDataRootDirectory + '/' + mProjectName + '/' + mAssetPackageDirectoryName + '/' + assetDirectory;
+
+			// Ensure that the asset output directory exists, else creating output file streams will fail
+			Renderer::IFileManager& fileManager = mContext.getFileManager();
+			fileManager.createDirectories(virtualAssetOutputDirectory.c_str());
+
+			// Do we need to mount a directory now? (e.g. "DataPc", "DataMobile" etc.)
+			// -> When compiling assets in parallel, the directory has already been mounted before the asset compiler worker threads were started
+			if (fileManager.getMountPoint(renderTargetDataRootDirectory.c_str()) == nullptr)
+			{
+				fileManager.mountDirectory((fileManager.getAbsoluteRootDirectory() + '/' + renderTargetDataRootDirectory).c_str(), renderTargetDataRootDirectory.c_str());
+			}
+
+			// Asset compiler input
+			IAssetCompiler::Input input(mContext, mProjectName, *mCacheManager, virtualAssetPackageInputDirectory, virtualAssetFilename, virtualAssetInputDirectory, virtualAssetOutputDirectory, mSourceAssetIdToCompiledAssetId, mCompiledAssetIdToSourceAssetId, mSourceAssetIdToVirtualFilename, mDefaultTextureAssetIds);
+
+			// Asset compiler configuration
+			RHI_ASSERT(getContext(), nullptr != mRapidJsonDocument, "Invalid renderer toolkit Rapid JSON document")
+			const IAssetCompiler::Configuration configuration(rapidJsonDocument, (*mRapidJsonDocument)["Targets"], rhiTarget, mQualityStrategy, numberOfThreads);
+
+			// Compile the asset
+			assetCompiler->compile(input, configuration);
+
+			{ // Update the output asset package
+				const std::string assetName = std_filesystem::path(input.virtualAssetFilename).stem().generic_string();
+				const std::string assetIdAsString = input.projectName + '/' + assetDirectory + '/' + assetName;
+				::detail::outputAsset(input.context.getFileManager(), assetIdAsString, assetCompiler->getVirtualOutputAssetFilename(input, configuration), outputAssetPackage, outputAssetPackageMutex);
+			}
+
+			// Done
+			return assetCompilerClassId;
+		}
+		catch (const std::exception& e)
+		{
+			throw std::runtime_error("Failed to compile asset with filename \"" + std::string(asset.virtualFilename) + "\": " + std::string(e.what()));
+		}
+	}
+
+	void ProjectImpl::compileAssetsInParallel(const std::vector<const Renderer::Asset*>& assets, const std::vector<Renderer::AssetId>& changedAssetIds, const char* rhiTarget, Renderer::AssetPackage& outputAssetPackage)
+	{
+		const size_t numberOfAssets = assets.size();
+		if (0 == numberOfAssets)
+		{
+			// Nothing to do
+			return;
+		}
+		const Renderer::Stopwatch stopwatch(true);
+
+		// Build the dependency graph: Sort the assets into dependency levels, the assets of one dependency level can be compiled in parallel
+		std::vector<std::vector<const Renderer::Asset*>> assetsByDependencyLevel;
+		{
+			const ::detail::DependencyLevelByAssetCompilerClassId dependencyLevelByAssetCompilerClassId = ::detail::getDependencyLevelByAssetCompilerClassId();
+			for (const Renderer::Asset* asset : assets)
+			{
+				uint32_t dependencyLevel = 0;
+				try
+				{
+					rapidjson::Document rapidJsonDocument(rapidjson::kObjectType);
+					const IAssetCompiler* assetCompiler = getSourceAssetCompilerAndRapidJsonDocument(asset->virtualFilename, rapidJsonDocument);
+					::detail::DependencyLevelByAssetCompilerClassId::const_iterator iterator = dependencyLevelByAssetCompilerClassId.find(assetCompiler->getAssetCompilerClassId());
+					if (dependencyLevelByAssetCompilerClassId.cend() != iterator)
+					{
+						dependencyLevel = iterator->second;
+					}
+				}
+				catch (const std::exception&)
+				{
+					// Nothing here, compiling the asset will fail with a meaningful error message
+				}
+				if (assetsByDependencyLevel.size() <= dependencyLevel)
+				{
+					assetsByDependencyLevel.resize(dependencyLevel + 1);
+				}
+				assetsByDependencyLevel[dependencyLevel].push_back(asset);
+			}
+		}
 
-		while (!mShutdownThread)
+		// Create the asset compiler instances of the additional asset compiler worker threads, the calling thread is used as asset compiler worker thread as well
+		const size_t numberOfWorkerThreads = std::min(static_cast<size_t>(std::max(std::thread::hardware_concurrency(), 1u)), numberOfAssets);
+		while (mWorkerAssetCompilers.size() + 1 < numberOfWorkerThreads)
 		{
-			// TODO(co) Implement me
+			mWorkerAssetCompilers.emplace_back();
+			createAssetCompilers(mWorkerAssetCompilers.back());
+		}
+
+		// Compile the assets dependency level by dependency level
+		std::mutex mutex;	// Guards the output asset package, the asset compiler statistics and the exception pointer
+		std::exception_ptr exceptionPtr;
+		::detail::AssetCompilerStatisticsByClassId assetCompilerStatisticsByClassId;
+		std::atomic<bool> cancel = false;
+		std::atomic<size_t> numberOfStartedAssets = 0;
+		for (const std::vector<const Renderer::Asset*>& dependencyLevelAssets : assetsByDependencyLevel)
+		{
+			// Worker function, the assets are pulled from the dependency level one by one so long running asset compilations don't stall the other workers
+			// -> Split the threads an asset compiler may use between the worker threads, else e.g. each parallel texture compilation would start as many threads as there are hardware threads
+			const size_t numberOfThreads = std::min(numberOfWorkerThreads, dependencyLevelAssets.size());
+			const uint32_t numberOfThreadsPerAssetCompiler = std::max(mNumberOfThreadsPerAssetCompiler / static_cast<uint32_t>(numberOfThreads), 1u);
+			std::atomic<size_t> nextAssetIndex = 0;
+			const auto workerFunction = [&](const AssetCompilerByClassId& assetCompilerByClassId)
+			{
+				::detail::AssetCompilerStatisticsByClassId workerAssetCompilerStatisticsByClassId;
+				for (size_t assetIndex = nextAssetIndex++; assetIndex < dependencyLevelAssets.size() && !cancel; assetIndex = nextAssetIndex++)
+				{
+					const Renderer::Asset& asset = *dependencyLevelAssets[assetIndex];
+					RHI_LOG(mContext, INFORMATION, "Compiling asset %u of %u: \"%s\"", ++numberOfStartedAssets, numberOfAssets, asset.virtualFilename)
+					try
+					{
+						const Renderer::Stopwatch assetStopwatch(true);
+						const AssetCompilerClassId assetCompilerClassId = compileAssetByAssetCompilers(asset, rhiTarget, assetCompilerByClassId, numberOfThreadsPerAssetCompiler, outputAssetPackage, &mutex);
+						::detail::AssetCompilerStatistics& assetCompilerStatistics = workerAssetCompilerStatisticsByClassId[assetCompilerClassId];
+						++assetCompilerStatistics.numberOfAssets;
+						assetCompilerStatistics.microseconds += assetStopwatch.getMicroseconds();
+					}
+					catch (const std::exception&)
+					{
+						// Remember the first error, it's thrown again as soon as all asset compiler worker threads are finished
+						std::lock_guard<std::mutex> mutexLock(mutex);
+						if (nullptr == exceptionPtr)
+						{
+							exceptionPtr = std::current_exception();
+						}
+						cancel = true;
+					}
+
+					// In case a shutdown was requested while we're compiling the assets, shutdown immediately
+					if (nullptr != mProjectAssetMonitor && mProjectAssetMonitor->mShutdownThread)
+					{
+						cancel = true;
+					}
+				}
+
+				// Merge the asset compiler statistics
+				std::lock_guard<std::mutex> mutexLock(mutex);
+				for (const auto& pair : workerAssetCompilerStatisticsByClassId)
+				{
+					::detail::AssetCompilerStatistics& assetCompilerStatistics = assetCompilerStatisticsByClassId[pair.first];
+					assetCompilerStatistics.numberOfAssets += pair.second.numberOfAssets;
+					assetCompilerStatistics.microseconds += pair.second.microseconds;
+				}
+			};
+
+			{ // Compile the assets of this dependency level
+				std::vector<std::thread> threads;
+				threads.reserve(numberOfThreads);
+				for (size_t i = 1; i < numberOfThreads; ++i)
+				{
+					const AssetCompilerByClassId& assetCompilerByClassId = mWorkerAssetCompilers[i - 1];
+					threads.emplace_back([&workerFunction, &assetCompilerByClassId]()
+					{
+						Renderer::PlatformManager::setCurrentThreadName("Asset compiler", "Renderer toolkit: Asset compiler worker");
+						workerFunction(assetCompilerByClassId);
+					});
+				}
+				workerFunction(mAssetCompilerByClassId);
+				for (std::thread& thread : threads)
+				{
+					thread.join();
+				}
+			}
+			if (nullptr != exceptionPtr)
+			{
+				std::rethrow_exception(exceptionPtr);
+			}
+			if (cancel)
+			{
+				break;
+			}
+
+			// Call "Renderer::IRenderer::reloadResourceByAssetId()" directly after a dependency level has been compiled to see changes as early as possible
+			if (nullptr != mProjectAssetMonitor)
+			{
+				for (const Renderer::Asset* asset : dependencyLevelAssets)
+				{
+					const Renderer::AssetId sourceAssetId = asset->assetId;
+					if (std::find(changedAssetIds.cbegin(), changedAssetIds.cend(), sourceAssetId) != changedAssetIds.cend())
+					{
+						SourceAssetIdToCompiledAssetId::const_iterator iterator = mSourceAssetIdToCompiledAssetId.find(sourceAssetId);
+						if (iterator == mSourceAssetIdToCompiledAssetId.cend())
+						{
+							throw std::runtime_error(std::string("Source asset ID ") + std::to_string(sourceAssetId) + " is unknown");
+						}
+						mProjectAssetMonitor->mRenderer.reloadResourceByAssetId(iterator->second);
+					}
+				}
+			}
+		}
+
+		{ // Log a summary
+			uint32_t numberOfCompiledAssets = 0;
+			for (const auto& pair : assetCompilerStatisticsByClassId)
+			{
+				numberOfCompiledAssets += pair.second.numberOfAssets;
+			}
+			RHI_LOG(mContext, INFORMATION, "Compiled %u assets in %.2f seconds wall time using %u asset compiler worker threads", numberOfCompiledAssets, stopwatch.getSeconds(), numberOfWorkerThreads)
+			for (const auto& pair : assetCompilerStatisticsByClassId)
+			{
+				RHI_LOG(mContext, INFORMATION, "%s: %u assets in %.2f seconds accumulated compile time", ::detail::getAssetCompilerName(pair.first), pair.second.numberOfAssets, static_cast<double>(pair.second.microseconds) / 1000000.0)
+			}
 		}
 	}
 
@@ -42,8 +42,8 @@ PRAGMA_WARNING_PUSH
 	PRAGMA_WARNING_DISABLE_MSVC(5026)	// warning C5026: 'std::atomic_flag': move constructor was implicitly defined as deleted
 	PRAGMA_WARNING_DISABLE_MSVC(5027)	// warning C5027: 'std::atomic_flag': move assignment operator was implicitly defined as deleted
 	PRAGMA_WARNING_DISABLE_MSVC(5039)	// warning C5039: '_Thrd_start': pointer or reference to potentially throwing function passed to extern C function under -EHc. Undefined behavior may occur if this function throws an exception.
-	#include <thread>
-	#include <atomic>	// For "std::atomic<>"
+	#include <mutex>
+	#include <vector>
 	#include <string_view>
 	#include <unordered_set>
 PRAGMA_WARNING_POP
@@ -170,6 +170,15 @@ namespace RendererToolkit
 		virtual void selfDestruct() override;
 
 
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		typedef std::unordered_map<uint32_t, IAssetCompiler*> AssetCompilerByClassId;
+		typedef std::unordered_map<std::string_view, IAssetCompiler*> AssetCompilerByFilenameExtension;
+		typedef std::vector<AssetCompilerByClassId> WorkerAssetCompilers;
+
+
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
 	//[-------------------------------------------------------]
@@ -184,20 +193,55 @@ namespace RendererToolkit
 
 		void initialize();
 		void clear();
+		void createAssetCompilers(AssetCompilerByClassId& assetCompilerByClassId) const;
 		void readAssetPackageByDirectory(const std::string& directoryName);	// Directory name has no "/" at the end
 		void readTargetsByFilename(const std::string& relativeFilename);
 		[[nodiscard]] std::string getRenderTargetDataRootDirectory(const char* rhiTarget) const;	// Directory name has no "/" at the end
 		void buildSourceAssetIdToCompiledAssetId();
 		const IAssetCompiler* getSourceAssetCompilerAndRapidJsonDocument(const std::string& virtualAssetFilename, rapidjson::Document& rapidJsonDocument) const;
-		void threadWorker();
 
+		/**
+		*  @brief
+		*    Compile an asset by using the given asset compiler instances
+		*
+		*  @param[in] asset
+		*    Asset to compile
+		*  @param[in] rhiTarget
+		*    RHI target to compile the asset for
+		*  @param[in] assetCompilerByClassId
+		*    Asset compiler instances owned by the calling thread
+		*  @param[in] numberOfThreads
+		*    Maximum number of threads the asset compiler is allowed to use for this asset, always at least one
+		*  @param[in, out] outputAssetPackage
+		*    Output asset package receiving the compiled asset
+		*  @param[in] outputAssetPackageMutex
+		*    Mutex guarding the output asset package in case assets are compiled in parallel, can be a null pointer
+		*
+		*  @return
+		*    The asset compiler class ID of the compiled asset
+		*/
+		AssetCompilerClassId compileAssetByAssetCompilers(const Renderer::Asset& asset, const char* rhiTarget, const AssetCompilerByClassId& assetCompilerByClassId, uint32_t numberOfThreads, Renderer::AssetPackage& outputAssetPackage, std::mutex* outputAssetPackageMutex);
 
-	//[-------------------------------------------------------]
-	//[ Private definitions                                   ]
-	//[-------------------------------------------------------]
-	private:
-		typedef std::unordered_map<uint32_t, IAssetCompiler*> AssetCompilerByClassId;
-		typedef std::unordered_map<std::string_view, IAssetCompiler*> AssetCompilerByFilenameExtension;
+		/**
+		*  @brief
+		*    Compile the given assets in parallel
+		*
+		*  @param[in] assets
+		*    Assets to compile, must be valid
+		*  @param[in] changedAssetIds
+		*    Source asset IDs of the changed assets, used to inform the renderer about compiled assets when the asset monitor is running
+		*  @param[in] rhiTarget
+		*    RHI target to compile the assets for
+		*  @param[in, out] outputAssetPackage
+		*    Output asset package receiving the compiled assets
+		*
+		*  @note
+		*    - The assets are grouped into dependency levels by their asset type (e.g. shader piece -> shader blueprint -> material blueprint -> material -> mesh -> scene),
+		*      the assets of one dependency level are compiled in parallel by a pool of worker threads, each worker thread has its own asset compiler instances
+		*    - The hardware threads are split between the worker threads, so an asset compiler running in parallel to others uses less threads for a single asset
+		*    - Logs a summary of the wall time as well as the accumulated compile time per asset type
+		*/
+		void compileAssetsInParallel(const std::vector<const Renderer::Asset*>& assets, const std::vector<Renderer::AssetId>& changedAssetIds, const char* rhiTarget, Renderer::AssetPackage& outputAssetPackage);
 
 
 	//[-------------------------------------------------------]
@@ -209,6 +253,7 @@ namespace RendererToolkit
 		std::string							mProjectName;						///< UTF-8 project name
 		std::string							mAbsoluteProjectDirectory;			///< UTF-8 project directory, Has no "/" at the end
 		QualityStrategy						mQualityStrategy;
+		uint32_t							mNumberOfThreadsPerAssetCompiler;	///< Maximum number of threads a single asset compilation is allowed to use (e.g. texture processing and compression), always at least one
 		Renderer::AssetPackage				mAssetPackage;
 		std::string							mAssetPackageDirectoryName;			///< UTF-8 asset package name, has no "/" at the end
 		SourceAssetIdToCompiledAssetId		mSourceAssetIdToCompiledAssetId;
@@ -217,11 +262,10 @@ namespace RendererToolkit
 		DefaultTextureAssetIds				mDefaultTextureAssetIds;
 		rapidjson::Document*				mRapidJsonDocument;					///< There's no real benefit in trying to store the targets data in custom data structures, so we just stick to the read in JSON object
 		ProjectAssetMonitor*				mProjectAssetMonitor;
-		std::atomic<bool>					mShutdownThread;
-		std::thread							mThread;
 		CacheManager*						mCacheManager;						///< Cache manager, can be a null pointer, destroy the instance if no longer needed
 		AssetCompilerByClassId				mAssetCompilerByClassId;			///< List of asset compilers by key "RendererToolkit::AssetCompilerClassId" (type not used directly or we would need to define a hash-function for it)
 		AssetCompilerByFilenameExtension	mAssetCompilerByFilenameExtension;	///< List of asset compilers by key "unique asset filename extension"
+		WorkerAssetCompilers				mWorkerAssetCompilers;				///< Asset compilers of the additional asset compiler worker threads, created on demand and reused by following compilation runs
 
 
 	};
@@ -1875,6 +1875,13 @@ typedef struct D3D10_QUERY_DATA_PIPELINE_STATISTICS
 	UINT64 PSInvocations;
 } D3D10_QUERY_DATA_PIPELINE_STATISTICS;
 
+// "Microsoft DirectX SDK (June 2010)" -> "D3D10.h"
+typedef struct D3D10_QUERY_DATA_TIMESTAMP_DISJOINT
+{
+	UINT64 Frequency;
+	BOOL Disjoint;
+} D3D10_QUERY_DATA_TIMESTAMP_DISJOINT;
+
 // "Microsoft DirectX SDK (June 2010)" -> "D3D10SDKLayers.h"
 MIDL_INTERFACE("9B7E4E01-342C-4106-A19F-4F2704F689F0")
 ID3D10Debug : public IUnknown
@@ -3040,7 +3047,9 @@ namespace Direct3D10Rhi
 				DXGI_FORMAT_R8G8B8A8_UINT,		// Rhi::VertexAttributeFormat::R8G8B8A8_UINT
 				DXGI_FORMAT_R16G16_SINT,		// Rhi::VertexAttributeFormat::SHORT_2
 				DXGI_FORMAT_R16G16B16A16_SINT,	// Rhi::VertexAttributeFormat::SHORT_4
-				DXGI_FORMAT_R32_UINT			// Rhi::VertexAttributeFormat::UINT_1
+				DXGI_FORMAT_R32_UINT,			// Rhi::VertexAttributeFormat::UINT_1
+				DXGI_FORMAT_R16G16_FLOAT,		// Rhi::VertexAttributeFormat::HALF_2
+				DXGI_FORMAT_R16G16B16A16_SNORM	// Rhi::VertexAttributeFormat::SHORT_4_SNORM
 			};
 			return MAPPING[static_cast<int>(vertexAttributeFormat)];
 		}
@@ -3556,6 +3565,11 @@ namespace Direct3D10Rhi
 			IVertexBuffer(direct3D10Rhi RHI_RESOURCE_DEBUG_PASS_PARAMETER),
 			mD3D10Buffer(nullptr)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsNumberOfBytes(numberOfBytes);
+			#endif
+
 			// Direct3D 10 buffer description
 			D3D10_BUFFER_DESC d3d10BufferDesc;
 			d3d10BufferDesc.ByteWidth        = numberOfBytes;
@@ -3682,6 +3696,11 @@ namespace Direct3D10Rhi
 			mD3D10Buffer(nullptr),
 			mDXGIFormat(DXGI_FORMAT_UNKNOWN)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsNumberOfBytes(numberOfBytes);
+			#endif
+
 			// "Rhi::IndexBufferFormat::UNSIGNED_CHAR" is not supported by Direct3D 10
 			if (Rhi::IndexBufferFormat::UNSIGNED_CHAR == indexBufferFormat)
 			{
@@ -4028,6 +4047,11 @@ namespace Direct3D10Rhi
 			mD3D10Buffer(nullptr),
 			mD3D10ShaderResourceView(nullptr)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsNumberOfBytes(numberOfBytes);
+			#endif
+
 			// Sanity check
 			RHI_ASSERT(direct3D10Rhi.getContext(), (numberOfBytes % Rhi::TextureFormat::getNumberOfBytesPerElement(textureFormat)) == 0, "The Direct3D 10 texture buffer size must be a multiple of the selected texture format bytes per texel")
 
@@ -4199,6 +4223,11 @@ namespace Direct3D10Rhi
 			mNumberOfBytes(numberOfBytes),
 			mData(nullptr)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsNumberOfBytes(numberOfBytes);
+			#endif
+
 			// Sanity checks
 			RHI_ASSERT(direct3D10Rhi.getContext(), (indirectBufferFlags & Rhi::IndirectBufferFlag::DRAW_ARGUMENTS) != 0 || (indirectBufferFlags & Rhi::IndirectBufferFlag::DRAW_INDEXED_ARGUMENTS) != 0, "Invalid Direct3D 10 flags, indirect buffer element type specification \"DRAW_ARGUMENTS\" or \"DRAW_INDEXED_ARGUMENTS\" is missing")
 			RHI_ASSERT(direct3D10Rhi.getContext(), !((indirectBufferFlags & Rhi::IndirectBufferFlag::DRAW_ARGUMENTS) != 0 && (indirectBufferFlags & Rhi::IndirectBufferFlag::DRAW_INDEXED_ARGUMENTS) != 0), "Invalid Direct3D 10 flags, indirect buffer element type specification \"DRAW_ARGUMENTS\" or \"DRAW_INDEXED_ARGUMENTS\" must be set, but not both at one and the same time")
@@ -4315,6 +4344,11 @@ namespace Direct3D10Rhi
 			Rhi::IUniformBuffer(direct3D10Rhi RHI_RESOURCE_DEBUG_PASS_PARAMETER),
 			mD3D10Buffer(nullptr)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsNumberOfBytes(numberOfBytes);
+			#endif
+
 			{ // Sanity check
 				// Check the given number of bytes, if we don't do this we might get told
 				//   "... the ByteWidth (value = <x>) must be a multiple of 16 and be less than or equal to 65536"
@@ -4600,6 +4634,11 @@ namespace Direct3D10Rhi
 			mD3D10Texture1D(nullptr),
 			mD3D10ShaderResourceView(nullptr)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsTextureDescription(textureFormat, textureFlags, width);
+			#endif
+
 			// Sanity checks
 			RHI_ASSERT(direct3D10Rhi.getContext(), 0 == (textureFlags & Rhi::TextureFlag::DATA_CONTAINS_MIPMAPS) || nullptr != data, "Invalid Direct3D 10 texture parameters")
 			RHI_ASSERT(direct3D10Rhi.getContext(), (textureFlags & Rhi::TextureFlag::RENDER_TARGET) == 0 || nullptr == data, "Direct3D 10 render target textures can't be filled using provided data")
@@ -4872,6 +4911,11 @@ namespace Direct3D10Rhi
 			mD3D10Texture1D(nullptr),
 			mD3D10ShaderResourceView(nullptr)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsTextureDescription(textureFormat, textureFlags, width, 1, 1, numberOfSlices);
+			#endif
+
 			// Sanity checks
 			RHI_ASSERT(direct3D10Rhi.getContext(), (textureFlags & Rhi::TextureFlag::RENDER_TARGET) == 0 || nullptr == data, "Direct3D 10 render target textures can't be filled using provided data")
 
@@ -5178,6 +5222,11 @@ namespace Direct3D10Rhi
 			mD3D10Texture2D(nullptr),
 			mD3D10ShaderResourceView(nullptr)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsTextureDescription(textureFormat, textureFlags, width, height, 1, 1, numberOfMultisamples);
+			#endif
+
 			// Sanity checks
 			RHI_ASSERT(direct3D10Rhi.getContext(), numberOfMultisamples == 1 || numberOfMultisamples == 2 || numberOfMultisamples == 4 || numberOfMultisamples == 8, "Invalid Direct3D 10 texture parameters")
 			RHI_ASSERT(direct3D10Rhi.getContext(), numberOfMultisamples == 1 || nullptr == data, "Invalid Direct3D 10 texture parameters")
@@ -5505,6 +5554,11 @@ namespace Direct3D10Rhi
 			mD3D10Texture2D(nullptr),
 			mD3D10ShaderResourceView(nullptr)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsTextureDescription(textureFormat, textureFlags, width, height, 1, numberOfSlices);
+			#endif
+
 			// Sanity checks
 			RHI_ASSERT(direct3D10Rhi.getContext(), (textureFlags & Rhi::TextureFlag::RENDER_TARGET) == 0 || nullptr == data, "Direct3D 10 render target textures can't be filled using provided data")
 
@@ -5827,6 +5881,11 @@ namespace Direct3D10Rhi
 			mD3D10Texture3D(nullptr),
 			mD3D10ShaderResourceView(nullptr)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsTextureDescription(textureFormat, textureFlags, width, height, depth);
+			#endif
+
 			// Sanity checks
 			RHI_ASSERT(direct3D10Rhi.getContext(), 0 == (textureFlags & Rhi::TextureFlag::DATA_CONTAINS_MIPMAPS) || nullptr != data, "Invalid Direct3D 10 texture parameters")
 			RHI_ASSERT(direct3D10Rhi.getContext(), (textureFlags & Rhi::TextureFlag::RENDER_TARGET) == 0 || nullptr == data, "Direct3D 10 render target textures can't be filled using provided data")
@@ -6105,6 +6164,11 @@ namespace Direct3D10Rhi
 			mD3D10TextureCube(nullptr),
 			mD3D10ShaderResourceView(nullptr)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsTextureDescription(textureFormat, textureFlags, width, width, 1, 6);
+			#endif
+
 			static constexpr uint32_t NUMBER_OF_SLICES = 6;	// In Direct3D 10, a cube map is a 2D array texture with six slices
 
 			// Sanity checks
@@ -9405,6 +9469,11 @@ namespace
 				RHI_LOG(static_cast<Direct3D10Rhi::Direct3D10Rhi&>(rhi).getContext(), CRITICAL, "Direct3D 10 doesn't support compute dispatch")
 			}
 
+			void ComputeBufferBarrier(const void*, Rhi::IRhi& rhi)
+			{
+				RHI_LOG(static_cast<Direct3D10Rhi::Direct3D10Rhi&>(rhi).getContext(), CRITICAL, "Direct3D 10 doesn't support compute buffer barrier")
+			}
+
 			//[-------------------------------------------------------]
 			//[ Resource                                              ]
 			//[-------------------------------------------------------]
@@ -9524,6 +9593,7 @@ namespace
 			&ImplementationDispatch::SetComputePipelineState,
 			&ImplementationDispatch::SetComputeResourceGroup,
 			&ImplementationDispatch::DispatchCompute,
+			&ImplementationDispatch::ComputeBufferBarrier,
 			// Resource
 			&ImplementationDispatch::SetTextureMinimumMaximumMipmapIndex,
 			&ImplementationDispatch::ResolveMultisampleFramebuffer,
@@ -10911,6 +10981,10 @@ namespace Direct3D10Rhi
 	//[-------------------------------------------------------]
 	bool Direct3D10Rhi::map(Rhi::IResource& resource, uint32_t subresource, Rhi::MapType mapType, uint32_t mapFlags, Rhi::MappedSubresource& mappedSubresource)
 	{
+		#ifdef RHI_STATISTICS
+			getStatistics().currentFrame.countMap(resource, subresource, mapType);
+		#endif
+
 		// The "Rhi::MapType" values directly map to Direct3D 10 & 11 constants, do not change them
 		// The "Rhi::MappedSubresource" structure directly maps to Direct3D 11, do not change it
 
@@ -11031,6 +11105,10 @@ namespace Direct3D10Rhi
 
 	void Direct3D10Rhi::unmap(Rhi::IResource& resource, uint32_t subresource)
 	{
+		#ifdef RHI_STATISTICS
+			++getStatistics().currentFrame.numberOfUnmaps;
+		#endif
+
 		// Define helper macro
 		#define TEXTURE_RESOURCE(type, typeClass, d3dClass) \
 			case type: \
@@ -11136,7 +11214,7 @@ namespace Direct3D10Rhi
 		switch (d3d10QueryPool.getQueryType())
 		{
 			case Rhi::QueryType::OCCLUSION:
-			case Rhi::QueryType::TIMESTAMP:	// TODO(co) Convert time to nanoseconds, see e.g. http://reedbeta.com/blog/gpu-profiling-101/
+			case Rhi::QueryType::TIMESTAMP:	// Ticks, see "Rhi::Capabilities::timestampPeriod"
 			{
 				uint8_t* currentData = data;
 				ID3D10Query** d3D10Queries = d3d10QueryPool.getD3D10Queries();
@@ -11229,19 +11307,20 @@ namespace Direct3D10Rhi
 		RHI_ASSERT(mContext, !commandBuffer.isEmpty(), "The Direct3D 10 command buffer to execute mustn't be empty")
 
 		// Loop through all commands
-		const uint8_t* commandPacketBuffer = commandBuffer.getCommandPacketBuffer();
-		Rhi::ConstCommandPacket constCommandPacket = commandPacketBuffer;
+		Rhi::ConstCommandPacket constCommandPacket = commandBuffer.getFirstCommandPacket();
 		while (nullptr != constCommandPacket)
 		{
 			{ // Submit command packet
 				const Rhi::CommandDispatchFunctionIndex commandDispatchFunctionIndex = Rhi::CommandPacketHelper::loadCommandDispatchFunctionIndex(constCommandPacket);
 				const void* command = Rhi::CommandPacketHelper::loadCommand(constCommandPacket);
+				#ifdef RHI_STATISTICS
+					getStatistics().currentFrame.countCommandPacket(commandDispatchFunctionIndex, command);
+				#endif
 				detail::DISPATCH_FUNCTIONS[static_cast<uint32_t>(commandDispatchFunctionIndex)](command, *this);
 			}
 
 			{ // Next command
-				const uint32_t nextCommandPacketByteIndex = Rhi::CommandPacketHelper::getNextCommandPacketByteIndex(constCommandPacket);
-				constCommandPacket = (~0u != nextCommandPacketByteIndex) ? &commandPacketBuffer[nextCommandPacketByteIndex] : nullptr;
+				constCommandPacket = Rhi::CommandPacketHelper::getNextCommandPacket(constCommandPacket);
 			}
 		}
 	}
@@ -11369,6 +11448,30 @@ namespace Direct3D10Rhi
 		// -> One element = float4 = 16 bytes
 		mCapabilities.maximumUniformBufferSize = 4096 * 16;
 
+		{ // Timestamp period, Direct3D 10 timestamp queries return ticks of a frequency which is only available through a timestamp disjoint query
+			// -> The frequency doesn't change during runtime in practice, so we just ask once and wait for the result, see e.g. http://reedbeta.com/blog/gpu-profiling-101/
+			D3D10_QUERY_DESC d3d10QueryDesc = {};
+			d3d10QueryDesc.Query = D3D10_QUERY_TIMESTAMP_DISJOINT;
+			ID3D10Query* d3d10Query = nullptr;
+			if (SUCCEEDED(mD3D10Device->CreateQuery(&d3d10QueryDesc, &d3d10Query)))
+			{
+				d3d10Query->Begin();
+				d3d10Query->End();
+				D3D10_QUERY_DATA_TIMESTAMP_DISJOINT d3d10QueryDataTimestampDisjoint = {};
+				HRESULT d3d10QueryResult = S_FALSE;
+				do
+				{
+					d3d10QueryResult = d3d10Query->GetData(&d3d10QueryDataTimestampDisjoint, sizeof(D3D10_QUERY_DATA_TIMESTAMP_DISJOINT), 0);
+				}
+				while (S_FALSE == d3d10QueryResult);
+				if (S_OK == d3d10QueryResult && d3d10QueryDataTimestampDisjoint.Frequency > 0)
+				{
+					mCapabilities.timestampPeriod = static_cast<float>(1e9 / static_cast<double>(d3d10QueryDataTimestampDisjoint.Frequency));
+				}
+				d3d10Query->Release();
+			}
+		}
+
 		// Maximum number of multisamples (always at least 1, usually 8)
 		// TODO(co) Currently Direct3D 10 instead of Direct3D 10.1 is used causing
 		// "D3D11 ERROR: ID3D10Device::CreateTexture2D: If the feature level is less than D3D_FEATURE_LEVEL_10_1, a Texture2D with sample count > 1 cannot have both D3D11_BIND_DEPTH_STENCIL and D3D11_BIND_SHADER_RESOURCE.  This call may appear to incorrectly return success on older/current D3D runtimes due to missing validation, despite this debug layer message.  [ STATE_CREATION ERROR #99: CREATETEXTURE2D_INVALIDBINDFLAGS]"
@@ -2308,6 +2308,13 @@ typedef struct D3D11_QUERY_DATA_PIPELINE_STATISTICS
 	UINT64 CSInvocations;
 } D3D11_QUERY_DATA_PIPELINE_STATISTICS;
 
+// "Microsoft DirectX SDK (June 2010)" -> "D3D11.h"
+typedef struct D3D11_QUERY_DATA_TIMESTAMP_DISJOINT
+{
+	UINT64 Frequency;
+	BOOL Disjoint;
+} D3D11_QUERY_DATA_TIMESTAMP_DISJOINT;
+
 // "Microsoft DirectX SDK (June 2010)" -> "D3D11SDKLayers.h"
 typedef enum D3D11_RLDO_FLAGS
 {
@@ -3778,7 +3785,9 @@ namespace Direct3D11Rhi
 				DXGI_FORMAT_R8G8B8A8_UINT,		// Rhi::VertexAttributeFormat::R8G8B8A8_UINT
 				DXGI_FORMAT_R16G16_SINT,		// Rhi::VertexAttributeFormat::SHORT_2
 				DXGI_FORMAT_R16G16B16A16_SINT,	// Rhi::VertexAttributeFormat::SHORT_4
-				DXGI_FORMAT_R32_UINT			// Rhi::VertexAttributeFormat::UINT_1
+				DXGI_FORMAT_R32_UINT,			// Rhi::VertexAttributeFormat::UINT_1
+				DXGI_FORMAT_R16G16_FLOAT,		// Rhi::VertexAttributeFormat::HALF_2
+				DXGI_FORMAT_R16G16B16A16_SNORM	// Rhi::VertexAttributeFormat::SHORT_4_SNORM
 			};
 			return MAPPING[static_cast<int>(vertexAttributeFormat)];
 		}
@@ -4298,6 +4307,11 @@ namespace Direct3D11Rhi
 			mD3D11ShaderResourceView(nullptr),
 			mD3D11UnorderedAccessView(nullptr)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsNumberOfBytes(numberOfBytes);
+			#endif
+
 			// Direct3D 11 buffer description
 			D3D11_BUFFER_DESC d3d11BufferDesc;
 			d3d11BufferDesc.ByteWidth           = numberOfBytes;
@@ -4523,6 +4537,11 @@ namespace Direct3D11Rhi
 			mD3D11ShaderResourceView(nullptr),
 			mD3D11UnorderedAccessView(nullptr)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsNumberOfBytes(numberOfBytes);
+			#endif
+
 			// "Rhi::IndexBufferFormat::UnsignedChar" is not supported by Direct3D 11
 			// -> See "Input assembler index buffer resources" ("D3D11_FORMAT_SUPPORT_IA_INDEX_BUFFER"): https://msdn.microsoft.com/en-us/library/windows/desktop/ff471325%28v=vs.85%29.aspx
 			if (Rhi::IndexBufferFormat::UNSIGNED_CHAR == indexBufferFormat)
@@ -4963,6 +4982,11 @@ namespace Direct3D11Rhi
 			mD3D11ShaderResourceView(nullptr),
 			mD3D11UnorderedAccessView(nullptr)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsNumberOfBytes(numberOfBytes);
+			#endif
+
 			// Sanity check
 			RHI_ASSERT(direct3D11Rhi.getContext(), (numberOfBytes % Rhi::TextureFormat::getNumberOfBytesPerElement(textureFormat)) == 0, "The Direct3D 11 texture buffer size must be a multiple of the selected texture format bytes per texel")
 
@@ -5186,6 +5210,11 @@ namespace Direct3D11Rhi
 			mD3D11ShaderResourceView(nullptr),
 			mD3D11UnorderedAccessView(nullptr)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsNumberOfBytes(numberOfBytes);
+			#endif
+
 			// Sanity checks
 			RHI_ASSERT(direct3D11Rhi.getContext(), (numberOfBytes % numberOfStructureBytes) == 0, "The Direct3D 11 structured buffer size must be a multiple of the given number of structure bytes")
 			RHI_ASSERT(direct3D11Rhi.getContext(), (numberOfBytes % (sizeof(float) * 4)) == 0, "Performance: The Direct3D 11 structured buffer should be aligned to a 128-bit stride, see \"Understanding Structured Buffer Performance\" by Evan Hart, posted Apr 17 2015 at 11:33AM - https://developer.nvidia.com/content/understanding-structured-buffer-performance")
@@ -5407,9 +5436,16 @@ namespace Direct3D11Rhi
 			IIndirectBuffer(direct3D11Rhi RHI_RESOURCE_DEBUG_PASS_PARAMETER),
 			mD3D11Buffer(nullptr),
 			mStagingD3D11Buffer(nullptr),
+			mReadBackD3D11Buffer(nullptr),
+			mReadBackMapped(false),
 			mD3D11ShaderResourceView(nullptr),
 			mD3D11UnorderedAccessView(nullptr)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsNumberOfBytes(numberOfBytes);
+			#endif
+
 			// Sanity checks
 			RHI_ASSERT(direct3D11Rhi.getContext(), (indirectBufferFlags & Rhi::IndirectBufferFlag::DRAW_ARGUMENTS) != 0 || (indirectBufferFlags & Rhi::IndirectBufferFlag::DRAW_INDEXED_ARGUMENTS) != 0, "Invalid Direct3D 11 flags, indirect buffer element type specification \"DRAW_ARGUMENTS\" or \"DRAW_INDEXED_ARGUMENTS\" is missing")
 			RHI_ASSERT(direct3D11Rhi.getContext(), !((indirectBufferFlags & Rhi::IndirectBufferFlag::DRAW_ARGUMENTS) != 0 && (indirectBufferFlags & Rhi::IndirectBufferFlag::DRAW_INDEXED_ARGUMENTS) != 0), "Invalid Direct3D 11 flags, indirect buffer element type specification \"DRAW_ARGUMENTS\" or \"DRAW_INDEXED_ARGUMENTS\" must be set, but not both at one and the same time")
@@ -5565,6 +5601,11 @@ namespace Direct3D11Rhi
 				mStagingD3D11Buffer->Release();
 				mStagingD3D11Buffer = nullptr;
 			}
+			if (nullptr != mReadBackD3D11Buffer)
+			{
+				mReadBackD3D11Buffer->Release();
+				mReadBackD3D11Buffer = nullptr;
+			}
 		}
 
 		/**
@@ -5584,6 +5625,45 @@ namespace Direct3D11Rhi
 			return mStagingD3D11Buffer;
 		}
 
+		/**
+		*  @brief
+		*    Return the Direct3D read back indirect buffer instance, created on first request
+		*
+		*  @return
+		*    The Direct3D read back indirect buffer instance, can be a null pointer, do not release the returned instance unless you added an own reference to it
+		*
+		*  @note
+		*    - Indirect buffers written by compute shaders can't be mapped for reading in Direct3D 11, so the content is copied into this CPU readable staging buffer
+		*/
+		[[nodiscard]] ID3D11Buffer* getReadBackD3D11Buffer()
+		{
+			if (nullptr == mReadBackD3D11Buffer && nullptr != mD3D11Buffer)
+			{
+				// Direct3D 11 buffer description
+				D3D11_BUFFER_DESC d3d11BufferDesc;
+				mD3D11Buffer->GetDesc(&d3d11BufferDesc);
+				d3d11BufferDesc.Usage				= D3D11_USAGE_STAGING;
+				d3d11BufferDesc.BindFlags			= 0;
+				d3d11BufferDesc.CPUAccessFlags		= D3D11_CPU_ACCESS_READ;
+				d3d11BufferDesc.MiscFlags			= 0;
+				d3d11BufferDesc.StructureByteStride	= 0;
+
+				// Create the Direct3D 11 read back indirect buffer
+				FAILED_DEBUG_BREAK(static_cast<Direct3D11Rhi&>(getRhi()).getD3D11Device()->CreateBuffer(&d3d11BufferDesc, nullptr, &mReadBackD3D11Buffer))
+			}
+			return mReadBackD3D11Buffer;
+		}
+
+		[[nodiscard]] inline bool isReadBackMapped() const
+		{
+			return mReadBackMapped;
+		}
+
+		inline void setReadBackMapped(bool readBackMapped)
+		{
+			mReadBackMapped = readBackMapped;
+		}
+
 		/**
 		*  @brief
 		*    Return the Direct3D shader resource view instance
@@ -5647,6 +5727,8 @@ namespace Direct3D11Rhi
 	private:
 		ID3D11Buffer*			   mD3D11Buffer;				///< Direct3D indirect buffer instance, can be a null pointer
 		ID3D11Buffer*			   mStagingD3D11Buffer;			///< Staging Direct3D indirect buffer instance, can be a null pointer
+		ID3D11Buffer*			   mReadBackD3D11Buffer;		///< CPU readable staging Direct3D indirect buffer instance, created on first read mapping, can be a null pointer
+		bool					   mReadBackMapped;				///< "true" if the read back Direct3D indirect buffer instance is currently mapped
 		ID3D11ShaderResourceView*  mD3D11ShaderResourceView;	///< Direct3D 11 shader resource view, can be a null pointer
 		ID3D11UnorderedAccessView* mD3D11UnorderedAccessView;	///< Direct3D 11 unordered access view, can be a null pointer
 
@@ -5688,6 +5770,11 @@ namespace Direct3D11Rhi
 			Rhi::IUniformBuffer(direct3D11Rhi RHI_RESOURCE_DEBUG_PASS_PARAMETER),
 			mD3D11Buffer(nullptr)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsNumberOfBytes(numberOfBytes);
+			#endif
+
 			{ // Sanity check
 				// Check the given number of bytes, if we don't do this we might get told
 				//   "... the ByteWidth (value = <x>) must be a multiple of 16 and be less than or equal to 65536"
@@ -5975,6 +6062,11 @@ namespace Direct3D11Rhi
 			mD3D11ShaderResourceView(nullptr),
 			mD3D11UnorderedAccessView(nullptr)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsTextureDescription(textureFormat, textureFlags, width);
+			#endif
+
 			// Sanity checks
 			RHI_ASSERT(direct3D11Rhi.getContext(), 0 == (textureFlags & Rhi::TextureFlag::DATA_CONTAINS_MIPMAPS) || nullptr != data, "Invalid Direct3D 11 texture parameters")
 			RHI_ASSERT(direct3D11Rhi.getContext(), (textureFlags & Rhi::TextureFlag::RENDER_TARGET) == 0 || nullptr == data, "Direct3D 11 render target textures can't be filled using provided data")
@@ -6281,6 +6373,11 @@ namespace Direct3D11Rhi
 			mD3D11ShaderResourceView(nullptr),
 			mD3D11UnorderedAccessView(nullptr)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsTextureDescription(textureFormat, textureFlags, width, 1, 1, numberOfSlices);
+			#endif
+
 			// Sanity checks
 			RHI_ASSERT(direct3D11Rhi.getContext(), (textureFlags & Rhi::TextureFlag::RENDER_TARGET) == 0 || nullptr == data, "Direct3D 11 render target textures can't be filled using provided data")
 
@@ -6611,6 +6708,11 @@ namespace Direct3D11Rhi
 			mD3D11ShaderResourceView(nullptr),
 			mD3D11UnorderedAccessView(nullptr)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsTextureDescription(textureFormat, textureFlags, width, height, 1, 1, numberOfMultisamples);
+			#endif
+
 			// Sanity checks
 			RHI_ASSERT(direct3D11Rhi.getContext(), numberOfMultisamples == 1 || numberOfMultisamples == 2 || numberOfMultisamples == 4 || numberOfMultisamples == 8, "Invalid Direct3D 11 texture parameters")
 			RHI_ASSERT(direct3D11Rhi.getContext(), numberOfMultisamples == 1 || nullptr == data, "Invalid Direct3D 11 texture parameters")
@@ -6972,6 +7074,11 @@ namespace Direct3D11Rhi
 			mD3D11ShaderResourceView(nullptr),
 			mD3D11UnorderedAccessView(nullptr)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsTextureDescription(textureFormat, textureFlags, width, height, 1, numberOfSlices);
+			#endif
+
 			// Sanity checks
 			RHI_ASSERT(direct3D11Rhi.getContext(), (textureFlags & Rhi::TextureFlag::RENDER_TARGET) == 0 || nullptr == data, "Direct3D 11 render target textures can't be filled using provided data")
 
@@ -7322,6 +7429,11 @@ namespace Direct3D11Rhi
 			mD3D11ShaderResourceView(nullptr),
 			mD3D11UnorderedAccessView(nullptr)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsTextureDescription(textureFormat, textureFlags, width, height, depth);
+			#endif
+
 			// Sanity checks
 			RHI_ASSERT(direct3D11Rhi.getContext(), 0 == (textureFlags & Rhi::TextureFlag::DATA_CONTAINS_MIPMAPS) || nullptr != data, "Invalid Direct3D 11 texture parameters")
 			RHI_ASSERT(direct3D11Rhi.getContext(), (textureFlags & Rhi::TextureFlag::RENDER_TARGET) == 0 || nullptr == data, "Direct3D 11 render target textures can't be filled using provided data")
@@ -7636,6 +7748,11 @@ namespace Direct3D11Rhi
 			mD3D11ShaderResourceView(nullptr),
 			mD3D11UnorderedAccessView(nullptr)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsTextureDescription(textureFormat, textureFlags, width, width, 1, 6);
+			#endif
+
 			static constexpr uint32_t NUMBER_OF_SLICES = 6;	// In Direct3D 11, a cube map is a 2D array texture with six slices
 
 			// Sanity checks
@@ -7965,6 +8082,11 @@ namespace Direct3D11Rhi
 			mD3D11ShaderResourceView(nullptr),
 			mD3D11UnorderedAccessView(nullptr)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsTextureDescription(textureFormat, textureFlags, width, width, 1, 6 * numberOfSlices);
+			#endif
+
 			static constexpr uint32_t NUMBER_OF_SLICES = 6;	// In Direct3D 11, a cube map is a 2D array texture with six slices
 			const uint32_t arraySize = NUMBER_OF_SLICES * numberOfSlices;
 
@@ -12057,6 +12179,11 @@ namespace
 				static_cast<Direct3D11Rhi::Direct3D11Rhi&>(rhi).dispatchCompute(realData->groupCountX, realData->groupCountY, realData->groupCountZ);
 			}
 
+			void ComputeBufferBarrier(const void*, Rhi::IRhi&)
+			{
+				// Nothing here, Direct3D 11 tracks the hazards of unordered access views on its own
+			}
+
 			//[-------------------------------------------------------]
 			//[ Resource                                              ]
 			//[-------------------------------------------------------]
@@ -12176,6 +12303,7 @@ namespace
 			&ImplementationDispatch::SetComputePipelineState,
 			&ImplementationDispatch::SetComputeResourceGroup,
 			&ImplementationDispatch::DispatchCompute,
+			&ImplementationDispatch::ComputeBufferBarrier,
 			// Resource
 			&ImplementationDispatch::SetTextureMinimumMaximumMipmapIndex,
 			&ImplementationDispatch::ResolveMultisampleFramebuffer,
@@ -14245,6 +14373,10 @@ namespace Direct3D11Rhi
 	//[-------------------------------------------------------]
 	bool Direct3D11Rhi::map(Rhi::IResource& resource, uint32_t subresource, Rhi::MapType mapType, uint32_t mapFlags, Rhi::MappedSubresource& mappedSubresource)
 	{
+		#ifdef RHI_STATISTICS
+			getStatistics().currentFrame.countMap(resource, subresource, mapType);
+		#endif
+
 		// The "Rhi::MapType" values directly map to Direct3D 10 & 11 constants, do not change them
 		// The "Rhi::MappedSubresource" structure directly maps to Direct3D 11, do not change it
 
@@ -14281,7 +14413,24 @@ namespace Direct3D11Rhi
 				return (S_OK == mD3D11DeviceContext->Map(static_cast<StructuredBuffer&>(resource).getD3D11Buffer(), subresource, static_cast<D3D11_MAP>(mapType), mapFlags, reinterpret_cast<D3D11_MAPPED_SUBRESOURCE*>(&mappedSubresource)));
 
 			case Rhi::ResourceType::INDIRECT_BUFFER:
-				return (S_OK == mD3D11DeviceContext->Map(static_cast<IndirectBuffer&>(resource).getStagingD3D11Buffer(), subresource, static_cast<D3D11_MAP>(mapType), mapFlags, reinterpret_cast<D3D11_MAPPED_SUBRESOURCE*>(&mappedSubresource)));
+			{
+				IndirectBuffer& indirectBuffer = static_cast<IndirectBuffer&>(resource);
+				if (Rhi::MapType::READ == mapType)
+				{
+					// Read back the GPU written content, e.g. by a compute shader, through a CPU readable staging buffer
+					ID3D11Buffer* readBackD3D11Buffer = indirectBuffer.getReadBackD3D11Buffer();
+					if (nullptr == readBackD3D11Buffer)
+					{
+						// Error!
+						return false;
+					}
+					mD3D11DeviceContext->CopyResource(readBackD3D11Buffer, indirectBuffer.getD3D11Buffer());
+					const bool result = (S_OK == mD3D11DeviceContext->Map(readBackD3D11Buffer, subresource, D3D11_MAP_READ, mapFlags, reinterpret_cast<D3D11_MAPPED_SUBRESOURCE*>(&mappedSubresource)));
+					indirectBuffer.setReadBackMapped(result);
+					return result;
+				}
+				return (S_OK == mD3D11DeviceContext->Map(indirectBuffer.getStagingD3D11Buffer(), subresource, static_cast<D3D11_MAP>(mapType), mapFlags, reinterpret_cast<D3D11_MAPPED_SUBRESOURCE*>(&mappedSubresource)));
+			}
 
 			case Rhi::ResourceType::UNIFORM_BUFFER:
 				return (S_OK == mD3D11DeviceContext->Map(static_cast<UniformBuffer&>(resource).getD3D11Buffer(), subresource, static_cast<D3D11_MAP>(mapType), mapFlags, reinterpret_cast<D3D11_MAPPED_SUBRESOURCE*>(&mappedSubresource)));
@@ -14327,6 +14476,10 @@ namespace Direct3D11Rhi
 
 	void Direct3D11Rhi::unmap(Rhi::IResource& resource, uint32_t subresource)
 	{
+		#ifdef RHI_STATISTICS
+			++getStatistics().currentFrame.numberOfUnmaps;
+		#endif
+
 		// Define helper macro
 		#define TEXTURE_RESOURCE(type, typeClass) \
 			case type: \
@@ -14363,9 +14516,18 @@ namespace Direct3D11Rhi
 			case Rhi::ResourceType::INDIRECT_BUFFER:
 			{
 				IndirectBuffer& indirectBuffer = static_cast<IndirectBuffer&>(resource);
-				ID3D11Buffer* stagingD3D11Buffer = indirectBuffer.getStagingD3D11Buffer();
-				mD3D11DeviceContext->Unmap(stagingD3D11Buffer, subresource);
-				mD3D11DeviceContext->CopyResource(indirectBuffer.getD3D11Buffer(), stagingD3D11Buffer);
+				if (indirectBuffer.isReadBackMapped())
+				{
+					// Nothing to upload, the read back staging buffer is a copy of the GPU content
+					mD3D11DeviceContext->Unmap(indirectBuffer.getReadBackD3D11Buffer(), subresource);
+					indirectBuffer.setReadBackMapped(false);
+				}
+				else
+				{
+					ID3D11Buffer* stagingD3D11Buffer = indirectBuffer.getStagingD3D11Buffer();
+					mD3D11DeviceContext->Unmap(stagingD3D11Buffer, subresource);
+					mD3D11DeviceContext->CopyResource(indirectBuffer.getD3D11Buffer(), stagingD3D11Buffer);
+				}
 				break;
 			}
 
@@ -14426,7 +14588,7 @@ namespace Direct3D11Rhi
 		switch (d3d11QueryPool.getQueryType())
 		{
 			case Rhi::QueryType::OCCLUSION:
-			case Rhi::QueryType::TIMESTAMP:	// TODO(co) Convert time to nanoseconds, see e.g. http://reedbeta.com/blog/gpu-profiling-101/
+			case Rhi::QueryType::TIMESTAMP:	// Ticks, see "Rhi::Capabilities::timestampPeriod"
 			{
 				uint8_t* currentData = data;
 				ID3D11Query** d3D11Queries = d3d11QueryPool.getD3D11Queries();
@@ -14581,19 +14743,20 @@ namespace Direct3D11Rhi
 		}
 
 		// Loop through all commands
-		const uint8_t* commandPacketBuffer = commandBuffer.getCommandPacketBuffer();
-		Rhi::ConstCommandPacket constCommandPacket = commandPacketBuffer;
+		Rhi::ConstCommandPacket constCommandPacket = commandBuffer.getFirstCommandPacket();
 		while (nullptr != constCommandPacket)
 		{
 			{ // Submit command packet
 				const Rhi::CommandDispatchFunctionIndex commandDispatchFunctionIndex = Rhi::CommandPacketHelper::loadCommandDispatchFunctionIndex(constCommandPacket);
 				const void* command = Rhi::CommandPacketHelper::loadCommand(constCommandPacket);
+				#ifdef RHI_STATISTICS
+					getStatistics().currentFrame.countCommandPacket(commandDispatchFunctionIndex, command);
+				#endif
 				detail::DISPATCH_FUNCTIONS[static_cast<uint32_t>(commandDispatchFunctionIndex)](command, *this);
 			}
 
 			{ // Next command
-				const uint32_t nextCommandPacketByteIndex = Rhi::CommandPacketHelper::getNextCommandPacketByteIndex(constCommandPacket);
-				constCommandPacket = (~0u != nextCommandPacketByteIndex) ? &commandPacketBuffer[nextCommandPacketByteIndex] : nullptr;
+				constCommandPacket = Rhi::CommandPacketHelper::getNextCommandPacket(constCommandPacket);
 			}
 		}
 	}
@@ -14963,6 +15126,30 @@ namespace Direct3D11Rhi
 		// -> One element = float4 = 16 bytes
 		mCapabilities.maximumUniformBufferSize = 4096 * 16;
 
+		{ // Timestamp period, Direct3D 11 timestamp queries return ticks of a frequency which is only available through a timestamp disjoint query
+			// -> The frequency doesn't change during runtime in practice, so we just ask once and wait for the result, see e.g. http://reedbeta.com/blog/gpu-profiling-101/
+			D3D11_QUERY_DESC d3d11QueryDesc = {};
+			d3d11QueryDesc.Query = D3D11_QUERY_TIMESTAMP_DISJOINT;
+			ID3D11Query* d3d11Query = nullptr;
+			if (SUCCEEDED(mD3D11Device->CreateQuery(&d3d11QueryDesc, &d3d11Query)))
+			{
+				mD3D11DeviceContext->Begin(d3d11Query);
+				mD3D11DeviceContext->End(d3d11Query);
+				D3D11_QUERY_DATA_TIMESTAMP_DISJOINT d3d11QueryDataTimestampDisjoint = {};
+				HRESULT d3d11QueryResult = S_FALSE;
+				do
+				{
+					d3d11QueryResult = mD3D11DeviceContext->GetData(d3d11Query, &d3d11QueryDataTimestampDisjoint, sizeof(D3D11_QUERY_DATA_TIMESTAMP_DISJOINT), 0);
+				}
+				while (S_FALSE == d3d11QueryResult);
+				if (S_OK == d3d11QueryResult && d3d11QueryDataTimestampDisjoint.Frequency > 0)
+				{
+					mCapabilities.timestampPeriod = static_cast<float>(1e9 / static_cast<double>(d3d11QueryDataTimestampDisjoint.Frequency));
+				}
+				d3d11Query->Release();
+			}
+		}
+
 		// Left-handed coordinate system with clip space depth value range 0..1
 		mCapabilities.upperLeftOrigin = mCapabilities.zeroToOneClipZ = true;
 
@@ -4245,6 +4245,7 @@ namespace Direct3D12Rhi
 		void setComputePipelineState(Rhi::IComputePipelineState* computePipelineState);
 		void setComputeResourceGroup(uint32_t rootParameterIndex, Rhi::IResourceGroup* resourceGroup);
 		void dispatchCompute(uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ);
+		void computeBufferBarrier(Rhi::IBuffer& buffer);
 		//[-------------------------------------------------------]
 		//[ Resource                                              ]
 		//[-------------------------------------------------------]
@@ -4884,7 +4885,9 @@ namespace Direct3D12Rhi
 				DXGI_FORMAT_R8G8B8A8_UINT,		// Rhi::VertexAttributeFormat::R8G8B8A8_UINT
 				DXGI_FORMAT_R16G16_SINT,		// Rhi::VertexAttributeFormat::SHORT_2
 				DXGI_FORMAT_R16G16B16A16_SINT,	// Rhi::VertexAttributeFormat::SHORT_4
-				DXGI_FORMAT_R32_UINT			// Rhi::VertexAttributeFormat::UINT_1
+				DXGI_FORMAT_R32_UINT,			// Rhi::VertexAttributeFormat::UINT_1
+				DXGI_FORMAT_R16G16_FLOAT,		// Rhi::VertexAttributeFormat::HALF_2
+				DXGI_FORMAT_R16G16B16A16_SNORM	// Rhi::VertexAttributeFormat::SHORT_4_SNORM
 			};
 			return MAPPING[static_cast<int>(vertexAttributeFormat)];
 		}
@@ -5509,6 +5512,11 @@ namespace Direct3D12Rhi
 			mNumberOfBytes(numberOfBytes),
 			mD3D12Resource(nullptr)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsNumberOfBytes(numberOfBytes);
+			#endif
+
 			// TODO(co) This is only meant for the Direct3D 12 RHI implementation kickoff.
 			// Note: using upload heaps to transfer static data like vert buffers is not 
 			// recommended. Every time the GPU needs it, the upload heap will be marshalled 
@@ -5658,6 +5666,11 @@ namespace Direct3D12Rhi
 			IIndexBuffer(direct3D12Rhi RHI_RESOURCE_DEBUG_PASS_PARAMETER),
 			mD3D12Resource(nullptr)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsNumberOfBytes(numberOfBytes);
+			#endif
+
 			// "Rhi::IndexBufferFormat::UnsignedChar" is not supported by Direct3D 12
 			// TODO(co) Check this, there's "DXGI_FORMAT_R8_UINT" which might work in Direct3D 12
 			if (Rhi::IndexBufferFormat::UNSIGNED_CHAR == indexBufferFormat)
@@ -6009,6 +6022,11 @@ namespace Direct3D12Rhi
 			mTextureFormat(textureFormat),
 			mD3D12Resource(nullptr)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsNumberOfBytes(numberOfBytes);
+			#endif
+
 			// Sanity check
 			RHI_ASSERT(direct3D12Rhi.getContext(), (numberOfBytes % Rhi::TextureFormat::getNumberOfBytesPerElement(textureFormat)) == 0, "The Direct3D 12 texture buffer size must be a multiple of the selected texture format bytes per texel")
 
@@ -6174,6 +6192,11 @@ namespace Direct3D12Rhi
 		//	mD3D12Buffer(nullptr),
 		//	mD3D12ShaderResourceViewTexture(nullptr)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsNumberOfBytes(numberOfBytes);
+			#endif
+
 			// Sanity checks
 			RHI_ASSERT(direct3D12Rhi.getContext(), (numberOfBytes % numberOfStructureBytes) == 0, "The Direct3D 12 structured buffer size must be a multiple of the given number of structure bytes")
 			RHI_ASSERT(direct3D12Rhi.getContext(), (numberOfBytes % (sizeof(float) * 4)) == 0, "Performance: The Direct3D 12 structured buffer should be aligned to a 128-bit stride, see \"Understanding Structured Buffer Performance\" by Evan Hart, posted Apr 17 2015 at 11:33AM - https://developer.nvidia.com/content/understanding-structured-buffer-performance")
@@ -6327,6 +6350,11 @@ namespace Direct3D12Rhi
 			mD3D12CommandSignature(nullptr),
 			mD3D12Resource(nullptr)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsNumberOfBytes(numberOfBytes);
+			#endif
+
 			// Sanity checks
 			RHI_ASSERT(direct3D12Rhi.getContext(), (indirectBufferFlags & Rhi::IndirectBufferFlag::DRAW_ARGUMENTS) != 0 || (indirectBufferFlags & Rhi::IndirectBufferFlag::DRAW_INDEXED_ARGUMENTS) != 0, "Invalid Direct3D 12 flags, indirect buffer element type specification \"DRAW_ARGUMENTS\" or \"DRAW_INDEXED_ARGUMENTS\" is missing")
 			RHI_ASSERT(direct3D12Rhi.getContext(), !((indirectBufferFlags & Rhi::IndirectBufferFlag::DRAW_ARGUMENTS) != 0 && (indirectBufferFlags & Rhi::IndirectBufferFlag::DRAW_INDEXED_ARGUMENTS) != 0), "Invalid Direct3D 12 flags, indirect buffer element type specification \"DRAW_ARGUMENTS\" or \"DRAW_INDEXED_ARGUMENTS\" must be set, but not both at one and the same time")
@@ -6513,6 +6541,11 @@ namespace Direct3D12Rhi
 			mD3D12Resource(nullptr),
 			mMappedData(nullptr)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsNumberOfBytes(numberOfBytes);
+			#endif
+
 			// TODO(co) Add buffer usage setting support
 			const CD3DX12_HEAP_PROPERTIES d3d12XHeapProperties(D3D12_HEAP_TYPE_UPLOAD);
 			const CD3DX12_RESOURCE_DESC d3d12XResourceDesc = CD3DX12_RESOURCE_DESC::Buffer(mNumberOfBytesOnGpu);
@@ -6801,6 +6834,11 @@ namespace Direct3D12Rhi
 			mNumberOfMipmaps(0),
 			mD3D12Resource(nullptr)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsTextureDescription(textureFormat, textureFlags, width);
+			#endif
+
 			// Calculate the number of mipmaps
 			const bool dataContainsMipmaps = (textureFlags & Rhi::TextureFlag::DATA_CONTAINS_MIPMAPS);
 			const bool generateMipmaps = (!dataContainsMipmaps && (textureFlags & Rhi::TextureFlag::GENERATE_MIPMAPS));
@@ -6959,6 +6997,11 @@ namespace Direct3D12Rhi
 			mNumberOfSlices(numberOfSlices),
 			mD3D12Resource(nullptr)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsTextureDescription(textureFormat, textureFlags, width, 1, 1, numberOfSlices);
+			#endif
+
 			// TODO(co) Add "Rhi::TextureFlag::GENERATE_MIPMAPS" support, also for render target textures
 
 			// Calculate the number of mipmaps
@@ -7149,6 +7192,11 @@ namespace Direct3D12Rhi
 			mNumberOfMipmaps(0),
 			mD3D12Resource(nullptr)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsTextureDescription(textureFormat, textureFlags, width, height, 1, 1, numberOfMultisamples);
+			#endif
+
 			// Sanity checks
 			RHI_ASSERT(direct3D12Rhi.getContext(), numberOfMultisamples == 1 || numberOfMultisamples == 2 || numberOfMultisamples == 4 || numberOfMultisamples == 8, "Invalid Direct3D 12 texture parameters")
 			RHI_ASSERT(direct3D12Rhi.getContext(), numberOfMultisamples == 1 || nullptr == data, "Invalid Direct3D 12 texture parameters")
@@ -7335,6 +7383,11 @@ namespace Direct3D12Rhi
 			mNumberOfSlices(numberOfSlices),
 			mD3D12Resource(nullptr)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsTextureDescription(textureFormat, textureFlags, width, height, 1, numberOfSlices);
+			#endif
+
 			// TODO(co) Add "Rhi::TextureFlag::GENERATE_MIPMAPS" support, also for render target textures
 
 			// Calculate the number of mipmaps
@@ -7524,6 +7577,11 @@ namespace Direct3D12Rhi
 			mNumberOfMipmaps(0),
 			mD3D12Resource(nullptr)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsTextureDescription(textureFormat, textureFlags, width, height, depth);
+			#endif
+
 			// TODO(co) Add "Rhi::TextureFlag::GENERATE_MIPMAPS" support, also for render target textures
 
 			// Calculate the number of mipmaps
@@ -7687,6 +7745,11 @@ namespace Direct3D12Rhi
 			mNumberOfMipmaps(0),
 			mD3D12Resource(nullptr)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsTextureDescription(textureFormat, textureFlags, width, width, 1, 6);
+			#endif
+
 			static constexpr uint32_t NUMBER_OF_SLICES = 6;	// In Direct3D 12, a cube map is a 2D array texture with six slices
 
 			// TODO(co) Add "Rhi::TextureFlag::GENERATE_MIPMAPS" support, also for render target textures
@@ -8394,7 +8457,7 @@ namespace Direct3D12Rhi
 					break;
 				}
 
-				case Rhi::QueryType::TIMESTAMP:	// TODO(co) Convert time to nanoseconds, see e.g. http://reedbeta.com/blog/gpu-profiling-101/
+				case Rhi::QueryType::TIMESTAMP:	// Ticks, see "Rhi::Capabilities::timestampPeriod"
 				{
 					RHI_ASSERT(getRhi().getContext(), 1 == numberOfQueries || sizeof(uint64_t) == strideInBytes, "Direct3D 12 stride in bytes must be 8 bytes for timestamp query type")
 					d3d12QueryType = D3D12_QUERY_TYPE_TIMESTAMP;
@@ -11794,6 +11857,12 @@ namespace
 				static_cast<Direct3D12Rhi::Direct3D12Rhi&>(rhi).dispatchCompute(realData->groupCountX, realData->groupCountY, realData->groupCountZ);
 			}
 
+			void ComputeBufferBarrier(const void* data, Rhi::IRhi& rhi)
+			{
+				const Rhi::Command::ComputeBufferBarrier* realData = static_cast<const Rhi::Command::ComputeBufferBarrier*>(data);
+				static_cast<Direct3D12Rhi::Direct3D12Rhi&>(rhi).computeBufferBarrier(*realData->buffer);
+			}
+
 			//[-------------------------------------------------------]
 			//[ Resource                                              ]
 			//[-------------------------------------------------------]
@@ -11920,6 +11989,7 @@ namespace
 			&ImplementationDispatch::SetComputePipelineState,
 			&ImplementationDispatch::SetComputeResourceGroup,
 			&ImplementationDispatch::DispatchCompute,
+			&ImplementationDispatch::ComputeBufferBarrier,
 			// Resource
 			&ImplementationDispatch::SetTextureMinimumMaximumMipmapIndex,
 			&ImplementationDispatch::ResolveMultisampleFramebuffer,
@@ -12863,6 +12933,72 @@ namespace Direct3D12Rhi
 		mD3D12GraphicsCommandList->Dispatch(groupCountX, groupCountY, groupCountZ);
 	}
 
+	void Direct3D12Rhi::computeBufferBarrier(Rhi::IBuffer& buffer)
+	{
+		// Sanity check
+		RHI_MATCH_CHECK(*this, buffer)
+
+		// Get the Direct3D 12 resource
+		// -> "Direct3D12Rhi::StructuredBuffer" has no Direct3D 12 resource yet, a null pointer unordered access view barrier covers all unordered access views
+		ID3D12Resource* d3d12Resource = nullptr;
+		switch (buffer.getResourceType())
+		{
+			case Rhi::ResourceType::VERTEX_BUFFER:
+				d3d12Resource = static_cast<VertexBuffer&>(buffer).getD3D12Resource();
+				break;
+
+			case Rhi::ResourceType::INDEX_BUFFER:
+				d3d12Resource = static_cast<IndexBuffer&>(buffer).getD3D12Resource();
+				break;
+
+			case Rhi::ResourceType::TEXTURE_BUFFER:
+				d3d12Resource = static_cast<TextureBuffer&>(buffer).getD3D12Resource();
+				break;
+
+			case Rhi::ResourceType::INDIRECT_BUFFER:
+				d3d12Resource = static_cast<IndirectBuffer&>(buffer).getD3D12Resource();
+				break;
+
+			case Rhi::ResourceType::STRUCTURED_BUFFER:
+				break;
+
+			case Rhi::ResourceType::UNIFORM_BUFFER:
+			case Rhi::ResourceType::ROOT_SIGNATURE:
+			case Rhi::ResourceType::RESOURCE_GROUP:
+			case Rhi::ResourceType::GRAPHICS_PROGRAM:
+			case Rhi::ResourceType::VERTEX_ARRAY:
+			case Rhi::ResourceType::RENDER_PASS:
+			case Rhi::ResourceType::QUERY_POOL:
+			case Rhi::ResourceType::SWAP_CHAIN:
+			case Rhi::ResourceType::FRAMEBUFFER:
+			case Rhi::ResourceType::TEXTURE_1D:
+			case Rhi::ResourceType::TEXTURE_1D_ARRAY:
+			case Rhi::ResourceType::TEXTURE_2D:
+			case Rhi::ResourceType::TEXTURE_2D_ARRAY:
+			case Rhi::ResourceType::TEXTURE_3D:
+			case Rhi::ResourceType::TEXTURE_CUBE:
+			case Rhi::ResourceType::TEXTURE_CUBE_ARRAY:
+			case Rhi::ResourceType::GRAPHICS_PIPELINE_STATE:
+			case Rhi::ResourceType::COMPUTE_PIPELINE_STATE:
+			case Rhi::ResourceType::SAMPLER_STATE:
+			case Rhi::ResourceType::VERTEX_SHADER:
+			case Rhi::ResourceType::TESSELLATION_CONTROL_SHADER:
+			case Rhi::ResourceType::TESSELLATION_EVALUATION_SHADER:
+			case Rhi::ResourceType::GEOMETRY_SHADER:
+			case Rhi::ResourceType::FRAGMENT_SHADER:
+			case Rhi::ResourceType::COMPUTE_SHADER:
+			default:
+				// Error!
+				RHI_ASSERT(mContext, false, "Invalid Direct3D 12 compute buffer barrier resource type")
+				return;
+		}
+
+		// Inform Direct3D 12 about the unordered access view barrier
+		// TODO(co) Direct3D 12 buffer resource state transitions, e.g. into "D3D12_RESOURCE_STATE_INDIRECT_ARGUMENT", aren't tracked by the RHI implementation yet
+		CD3DX12_RESOURCE_BARRIER d3d12XResourceBarrier = CD3DX12_RESOURCE_BARRIER::UAV(d3d12Resource);
+		mD3D12GraphicsCommandList->ResourceBarrier(1, &d3d12XResourceBarrier);
+	}
+
 
 	//[-------------------------------------------------------]
 	//[ Resource                                              ]
@@ -13164,8 +13300,12 @@ namespace Direct3D12Rhi
 	//[-------------------------------------------------------]
 	//[ Resource handling                                     ]
 	//[-------------------------------------------------------]
-	bool Direct3D12Rhi::map(Rhi::IResource& resource, uint32_t, Rhi::MapType, uint32_t, Rhi::MappedSubresource& mappedSubresource)
+	bool Direct3D12Rhi::map(Rhi::IResource& resource, [[maybe_unused]] uint32_t subresource, [[maybe_unused]] Rhi::MapType mapType, uint32_t, Rhi::MappedSubresource& mappedSubresource)
 	{
+		#ifdef RHI_STATISTICS
+			getStatistics().currentFrame.countMap(resource, subresource, mapType);
+		#endif
+
 		// The "Rhi::MapType" values directly map to Direct3D 10 & 11 constants, do not change them
 		// The "Rhi::MappedSubresource" structure directly maps to Direct3D 11, do not change it
 
@@ -13274,6 +13414,10 @@ namespace Direct3D12Rhi
 
 	void Direct3D12Rhi::unmap(Rhi::IResource& resource, uint32_t)
 	{
+		#ifdef RHI_STATISTICS
+			++getStatistics().currentFrame.numberOfUnmaps;
+		#endif
+
 		// Define helper macro
 		// TODO(co): Port to Direct3D 12
 		#define TEXTURE_RESOURCE(type, typeClass) \
@@ -13410,19 +13554,20 @@ namespace Direct3D12Rhi
 		RHI_ASSERT(mContext, !commandBuffer.isEmpty(), "The Direct3D 12 command buffer to execute mustn't be empty")
 
 		// Loop through all commands
-		const uint8_t* commandPacketBuffer = commandBuffer.getCommandPacketBuffer();
-		Rhi::ConstCommandPacket constCommandPacket = commandPacketBuffer;
+		Rhi::ConstCommandPacket constCommandPacket = commandBuffer.getFirstCommandPacket();
 		while (nullptr != constCommandPacket)
 		{
 			{ // Submit command packet
 				const Rhi::CommandDispatchFunctionIndex commandDispatchFunctionIndex = Rhi::CommandPacketHelper::loadCommandDispatchFunctionIndex(constCommandPacket);
 				const void* command = Rhi::CommandPacketHelper::loadCommand(constCommandPacket);
+				#ifdef RHI_STATISTICS
+					getStatistics().currentFrame.countCommandPacket(commandDispatchFunctionIndex, command);
+				#endif
 				detail::DISPATCH_FUNCTIONS[static_cast<uint32_t>(commandDispatchFunctionIndex)](command, *this);
 			}
 
 			{ // Next command
-				const uint32_t nextCommandPacketByteIndex = Rhi::CommandPacketHelper::getNextCommandPacketByteIndex(constCommandPacket);
-				constCommandPacket = (~0u != nextCommandPacketByteIndex) ? &commandPacketBuffer[nextCommandPacketByteIndex] : nullptr;
+				constCommandPacket = Rhi::CommandPacketHelper::getNextCommandPacket(constCommandPacket);
 			}
 		}
 	}
@@ -13828,6 +13973,11 @@ namespace Direct3D12Rhi
 		// -> One element = float4 = 16 bytes
 		mCapabilities.maximumUniformBufferSize = 4096 * 16;
 
+		{ // Timestamp period, Direct3D 12 timestamp queries return ticks of the command queue timestamp frequency
+			UINT64 timestampFrequency = 0;
+			mCapabilities.timestampPeriod = (SUCCEEDED(mD3D12CommandQueue->GetTimestampFrequency(&timestampFrequency)) && timestampFrequency > 0) ? static_cast<float>(1e9 / static_cast<double>(timestampFrequency)) : 0.0f;
+		}
+
 		// Left-handed coordinate system with clip space depth value range 0..1
 		mCapabilities.upperLeftOrigin = mCapabilities.zeroToOneClipZ = true;
 
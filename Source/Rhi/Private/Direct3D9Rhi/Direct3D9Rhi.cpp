@@ -2753,7 +2753,9 @@ namespace Direct3D9Rhi
 				D3DDECLTYPE_UBYTE4,		// Rhi::VertexAttributeFormat::R8G8B8A8_UINT
 				D3DDECLTYPE_SHORT2,		// Rhi::VertexAttributeFormat::SHORT_2
 				D3DDECLTYPE_SHORT4,		// Rhi::VertexAttributeFormat::SHORT_4
-				D3DDECLTYPE_UNUSED		// Rhi::VertexAttributeFormat::UINT_1 - not supported by DirectX 9
+				D3DDECLTYPE_UNUSED,		// Rhi::VertexAttributeFormat::UINT_1 - not supported by DirectX 9
+				D3DDECLTYPE_FLOAT16_2,	// Rhi::VertexAttributeFormat::HALF_2
+				D3DDECLTYPE_SHORT4N		// Rhi::VertexAttributeFormat::SHORT_4_SNORM
 			};
 			return MAPPING[static_cast<int>(vertexAttributeFormat)];
 		}
@@ -3311,6 +3313,11 @@ namespace Direct3D9Rhi
 			IVertexBuffer(direct3D9Rhi RHI_RESOURCE_DEBUG_PASS_PARAMETER),
 			mDirect3DVertexBuffer9(nullptr)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsNumberOfBytes(numberOfBytes);
+			#endif
+
 			// Create the Direct3D 9 vertex buffer
 			FAILED_DEBUG_BREAK(direct3D9Rhi.getDirect3DDevice9()->CreateVertexBuffer(numberOfBytes, Mapping::getDirect3D9Usage(bufferUsage), 0, D3DPOOL_DEFAULT, &mDirect3DVertexBuffer9, nullptr))
 
@@ -3424,6 +3431,11 @@ namespace Direct3D9Rhi
 			IIndexBuffer(direct3D9Rhi RHI_RESOURCE_DEBUG_PASS_PARAMETER),
 			mDirect3DIndexBuffer9(nullptr)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsNumberOfBytes(numberOfBytes);
+			#endif
+
 			// "Rhi::IndexBufferFormat::UNSIGNED_CHAR" is not supported by Direct3D 9
 			if (Rhi::IndexBufferFormat::UNSIGNED_CHAR == indexBufferFormat)
 			{
@@ -3743,6 +3755,11 @@ namespace Direct3D9Rhi
 			mNumberOfBytes(numberOfBytes),
 			mData(nullptr)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsNumberOfBytes(numberOfBytes);
+			#endif
+
 			// Sanity checks
 			RHI_ASSERT(direct3D9Rhi.getContext(), (indirectBufferFlags & Rhi::IndirectBufferFlag::DRAW_ARGUMENTS) != 0 || (indirectBufferFlags & Rhi::IndirectBufferFlag::DRAW_INDEXED_ARGUMENTS) != 0, "Invalid Direct3D 9 flags, indirect buffer element type specification \"DRAW_ARGUMENTS\" or \"DRAW_INDEXED_ARGUMENTS\" is missing")
 			RHI_ASSERT(direct3D9Rhi.getContext(), !((indirectBufferFlags & Rhi::IndirectBufferFlag::DRAW_ARGUMENTS) != 0 && (indirectBufferFlags & Rhi::IndirectBufferFlag::DRAW_INDEXED_ARGUMENTS) != 0), "Invalid Direct3D 9 flags, indirect buffer element type specification \"DRAW_ARGUMENTS\" or \"DRAW_INDEXED_ARGUMENTS\" must be set, but not both at one and the same time")
@@ -4001,6 +4018,11 @@ namespace Direct3D9Rhi
 			ITexture1D(direct3D9Rhi, width RHI_RESOURCE_DEBUG_PASS_PARAMETER),
 			mDirect3DTexture9(nullptr)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsTextureDescription(textureFormat, textureFlags, width);
+			#endif
+
 			// Sanity checks
 			RHI_ASSERT(direct3D9Rhi.getContext(), 0 == (textureFlags & Rhi::TextureFlag::DATA_CONTAINS_MIPMAPS) || nullptr != data, "Invalid Direct3D 9 texture parameters")
 
@@ -4210,6 +4232,11 @@ namespace Direct3D9Rhi
 			ITexture2D(direct3D9Rhi, width, height RHI_RESOURCE_DEBUG_PASS_PARAMETER),
 			mDirect3DTexture9(nullptr)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsTextureDescription(textureFormat, textureFlags, width, height);
+			#endif
+
 			// Sanity checks
 			RHI_ASSERT(direct3D9Rhi.getContext(), 0 == (textureFlags & Rhi::TextureFlag::DATA_CONTAINS_MIPMAPS) || nullptr != data, "Invalid Direct3D 9 texture parameters")
 
@@ -4436,6 +4463,11 @@ namespace Direct3D9Rhi
 			ITexture3D(direct3D9Rhi, width, height, depth RHI_RESOURCE_DEBUG_PASS_PARAMETER),
 			mDirect3DTexture9(nullptr)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsTextureDescription(textureFormat, textureFlags, width, height, depth);
+			#endif
+
 			// TODO(co) Implement Direct3D 9 volume texture
 			/*
 			// Sanity checks
@@ -4647,6 +4679,11 @@ namespace Direct3D9Rhi
 			ITextureCube(direct3D9Rhi, width RHI_RESOURCE_DEBUG_PASS_PARAMETER),
 			mDirect3DCubeTexture9(nullptr)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsTextureDescription(textureFormat, textureFlags, width, width, 1, 6);
+			#endif
+
 			static constexpr uint32_t NUMBER_OF_SLICES = 6;
 
 			// Sanity checks
@@ -7389,6 +7426,11 @@ namespace
 				RHI_LOG(static_cast<Direct3D9Rhi::Direct3D9Rhi&>(rhi).getContext(), CRITICAL, "Direct3D 9 doesn't support compute dispatch")
 			}
 
+			void ComputeBufferBarrier(const void*, Rhi::IRhi& rhi)
+			{
+				RHI_LOG(static_cast<Direct3D9Rhi::Direct3D9Rhi&>(rhi).getContext(), CRITICAL, "Direct3D 9 doesn't support compute buffer barrier")
+			}
+
 			//[-------------------------------------------------------]
 			//[ Resource                                              ]
 			//[-------------------------------------------------------]
@@ -7508,6 +7550,7 @@ namespace
 			&ImplementationDispatch::SetComputePipelineState,
 			&ImplementationDispatch::SetComputeResourceGroup,
 			&ImplementationDispatch::DispatchCompute,
+			&ImplementationDispatch::ComputeBufferBarrier,
 			// Resource
 			&ImplementationDispatch::SetTextureMinimumMaximumMipmapIndex,
 			&ImplementationDispatch::ResolveMultisampleFramebuffer,
@@ -8775,6 +8818,10 @@ namespace Direct3D9Rhi
 	//[-------------------------------------------------------]
 	bool Direct3D9Rhi::map(Rhi::IResource& resource, uint32_t subresource, Rhi::MapType mapType, uint32_t, Rhi::MappedSubresource& mappedSubresource)
 	{
+		#ifdef RHI_STATISTICS
+			getStatistics().currentFrame.countMap(resource, subresource, mapType);
+		#endif
+
 		// The "Rhi::MapType" values directly map to Direct3D 10 & 11 constants, do not change them
 		// The "Rhi::MappedSubresource" structure directly maps to Direct3D 11, do not change it
 
@@ -8953,6 +9000,10 @@ namespace Direct3D9Rhi
 
 	void Direct3D9Rhi::unmap(Rhi::IResource& resource, uint32_t subresource)
 	{
+		#ifdef RHI_STATISTICS
+			++getStatistics().currentFrame.numberOfUnmaps;
+		#endif
+
 		// Evaluate the resource type
 		switch (resource.getResourceType())
 		{
@@ -9047,19 +9098,20 @@ namespace Direct3D9Rhi
 		RHI_ASSERT(mContext, !commandBuffer.isEmpty(), "The Direct3D 9 command buffer to execute mustn't be empty")
 
 		// Loop through all commands
-		const uint8_t* commandPacketBuffer = commandBuffer.getCommandPacketBuffer();
-		Rhi::ConstCommandPacket constCommandPacket = commandPacketBuffer;
+		Rhi::ConstCommandPacket constCommandPacket = commandBuffer.getFirstCommandPacket();
 		while (nullptr != constCommandPacket)
 		{
 			{ // Submit command packet
 				const Rhi::CommandDispatchFunctionIndex commandDispatchFunctionIndex = Rhi::CommandPacketHelper::loadCommandDispatchFunctionIndex(constCommandPacket);
 				const void* command = Rhi::CommandPacketHelper::loadCommand(constCommandPacket);
+				#ifdef RHI_STATISTICS
+					getStatistics().currentFrame.countCommandPacket(commandDispatchFunctionIndex, command);
+				#endif
 				detail::DISPATCH_FUNCTIONS[static_cast<uint32_t>(commandDispatchFunctionIndex)](command, *this);
 			}
 
 			{ // Next command
-				const uint32_t nextCommandPacketByteIndex = Rhi::CommandPacketHelper::getNextCommandPacketByteIndex(constCommandPacket);
-				constCommandPacket = (~0u != nextCommandPacketByteIndex) ? &commandPacketBuffer[nextCommandPacketByteIndex] : nullptr;
+				constCommandPacket = Rhi::CommandPacketHelper::getNextCommandPacket(constCommandPacket);
 			}
 		}
 	}
@@ -1021,10 +1021,17 @@ namespace NullRhi
 		*
 		*  @param[in] nullRhi
 		*    Owner null RHI instance
+		*  @param[in] numberOfBytes
+		*    Number of bytes within the buffer, must be valid
 		*/
-		inline explicit VertexBuffer(NullRhi& nullRhi RHI_RESOURCE_DEBUG_NAME_PARAMETER_NO_DEFAULT) :
+		inline VertexBuffer(NullRhi& nullRhi, [[maybe_unused]] uint32_t numberOfBytes RHI_RESOURCE_DEBUG_NAME_PARAMETER_NO_DEFAULT) :
 			IVertexBuffer(nullRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER)
-		{}
+		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsNumberOfBytes(numberOfBytes);
+			#endif
+		}
 
 		/**
 		*  @brief
@@ -1078,10 +1085,17 @@ namespace NullRhi
 		*
 		*  @param[in] nullRhi
 		*    Owner null RHI instance
+		*  @param[in] numberOfBytes
+		*    Number of bytes within the buffer, must be valid
 		*/
-		inline explicit IndexBuffer(NullRhi& nullRhi RHI_RESOURCE_DEBUG_NAME_PARAMETER_NO_DEFAULT) :
+		inline IndexBuffer(NullRhi& nullRhi, [[maybe_unused]] uint32_t numberOfBytes RHI_RESOURCE_DEBUG_NAME_PARAMETER_NO_DEFAULT) :
 			IIndexBuffer(nullRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER)
-		{}
+		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsNumberOfBytes(numberOfBytes);
+			#endif
+		}
 
 		/**
 		*  @brief
@@ -1197,10 +1211,17 @@ namespace NullRhi
 		*
 		*  @param[in] nullRhi
 		*    Owner null RHI instance
+		*  @param[in] numberOfBytes
+		*    Number of bytes within the buffer, must be valid
 		*/
-		inline explicit TextureBuffer(NullRhi& nullRhi RHI_RESOURCE_DEBUG_NAME_PARAMETER_NO_DEFAULT) :
+		inline TextureBuffer(NullRhi& nullRhi, [[maybe_unused]] uint32_t numberOfBytes RHI_RESOURCE_DEBUG_NAME_PARAMETER_NO_DEFAULT) :
 			ITextureBuffer(nullRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER)
-		{}
+		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsNumberOfBytes(numberOfBytes);
+			#endif
+		}
 
 		/**
 		*  @brief
@@ -1254,10 +1275,17 @@ namespace NullRhi
 		*
 		*  @param[in] nullRhi
 		*    Owner null RHI instance
+		*  @param[in] numberOfBytes
+		*    Number of bytes within the buffer, must be valid
 		*/
-		inline explicit StructuredBuffer(NullRhi& nullRhi RHI_RESOURCE_DEBUG_NAME_PARAMETER_NO_DEFAULT) :
+		inline StructuredBuffer(NullRhi& nullRhi, [[maybe_unused]] uint32_t numberOfBytes RHI_RESOURCE_DEBUG_NAME_PARAMETER_NO_DEFAULT) :
 			IStructuredBuffer(nullRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER)
-		{}
+		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsNumberOfBytes(numberOfBytes);
+			#endif
+		}
 
 		/**
 		*  @brief
@@ -1311,10 +1339,17 @@ namespace NullRhi
 		*
 		*  @param[in] nullRhi
 		*    Owner null RHI instance
+		*  @param[in] numberOfBytes
+		*    Number of bytes within the buffer, must be valid
 		*/
-		inline explicit IndirectBuffer(NullRhi& nullRhi RHI_RESOURCE_DEBUG_NAME_PARAMETER_NO_DEFAULT) :
+		inline IndirectBuffer(NullRhi& nullRhi, [[maybe_unused]] uint32_t numberOfBytes RHI_RESOURCE_DEBUG_NAME_PARAMETER_NO_DEFAULT) :
 			IIndirectBuffer(nullRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER)
-		{}
+		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsNumberOfBytes(numberOfBytes);
+			#endif
+		}
 
 		/**
 		*  @brief
@@ -1378,10 +1413,17 @@ namespace NullRhi
 		*
 		*  @param[in] nullRhi
 		*    Owner null RHI instance
+		*  @param[in] numberOfBytes
+		*    Number of bytes within the buffer, must be valid
 		*/
-		inline explicit UniformBuffer(NullRhi& nullRhi RHI_RESOURCE_DEBUG_NAME_PARAMETER_NO_DEFAULT) :
+		inline UniformBuffer(NullRhi& nullRhi, [[maybe_unused]] uint32_t numberOfBytes RHI_RESOURCE_DEBUG_NAME_PARAMETER_NO_DEFAULT) :
 			IUniformBuffer(nullRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER)
-		{}
+		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsNumberOfBytes(numberOfBytes);
+			#endif
+		}
 
 		/**
 		*  @brief
@@ -1452,16 +1494,16 @@ namespace NullRhi
 	//[ Public virtual Rhi::IBufferManager methods            ]
 	//[-------------------------------------------------------]
 	public:
-		[[nodiscard]] inline virtual Rhi::IVertexBuffer* createVertexBuffer([[maybe_unused]] uint32_t numberOfBytes, [[maybe_unused]] const void* data = nullptr, [[maybe_unused]] uint32_t bufferFlags = 0, [[maybe_unused]] Rhi::BufferUsage bufferUsage = Rhi::BufferUsage::STATIC_DRAW RHI_RESOURCE_DEBUG_NAME_PARAMETER) override
+		[[nodiscard]] inline virtual Rhi::IVertexBuffer* createVertexBuffer(uint32_t numberOfBytes, [[maybe_unused]] const void* data = nullptr, [[maybe_unused]] uint32_t bufferFlags = 0, [[maybe_unused]] Rhi::BufferUsage bufferUsage = Rhi::BufferUsage::STATIC_DRAW RHI_RESOURCE_DEBUG_NAME_PARAMETER) override
 		{
 			NullRhi& nullRhi = static_cast<NullRhi&>(getRhi());
-			return RHI_NEW(nullRhi.getContext(), VertexBuffer)(nullRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER);
+			return RHI_NEW(nullRhi.getContext(), VertexBuffer)(nullRhi, numberOfBytes RHI_RESOURCE_DEBUG_PASS_PARAMETER);
 		}
 
-		[[nodiscard]] inline virtual Rhi::IIndexBuffer* createIndexBuffer([[maybe_unused]] uint32_t numberOfBytes, [[maybe_unused]] const void* data = nullptr, [[maybe_unused]] uint32_t bufferFlags = 0, [[maybe_unused]] Rhi::BufferUsage bufferUsage = Rhi::BufferUsage::STATIC_DRAW, [[maybe_unused]] Rhi::IndexBufferFormat::Enum indexBufferFormat = Rhi::IndexBufferFormat::UNSIGNED_SHORT RHI_RESOURCE_DEBUG_NAME_PARAMETER) override
+		[[nodiscard]] inline virtual Rhi::IIndexBuffer* createIndexBuffer(uint32_t numberOfBytes, [[maybe_unused]] const void* data = nullptr, [[maybe_unused]] uint32_t bufferFlags = 0, [[maybe_unused]] Rhi::BufferUsage bufferUsage = Rhi::BufferUsage::STATIC_DRAW, [[maybe_unused]] Rhi::IndexBufferFormat::Enum indexBufferFormat = Rhi::IndexBufferFormat::UNSIGNED_SHORT RHI_RESOURCE_DEBUG_NAME_PARAMETER) override
 		{
 			NullRhi& nullRhi = static_cast<NullRhi&>(getRhi());
-			return RHI_NEW(nullRhi.getContext(), IndexBuffer)(nullRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER);
+			return RHI_NEW(nullRhi.getContext(), IndexBuffer)(nullRhi, numberOfBytes RHI_RESOURCE_DEBUG_PASS_PARAMETER);
 		}
 
 		[[nodiscard]] virtual Rhi::IVertexArray* createVertexArray([[maybe_unused]] const Rhi::VertexAttributes& vertexAttributes, uint32_t numberOfVertexBuffers, const Rhi::VertexArrayVertexBuffer* vertexBuffers, Rhi::IIndexBuffer* indexBuffer = nullptr RHI_RESOURCE_DEBUG_NAME_PARAMETER) override
@@ -1502,7 +1544,7 @@ namespace NullRhi
 			return nullRhi.VertexArrayMakeId.CreateID(id) ? RHI_NEW(nullRhi.getContext(), VertexArray)(nullRhi, id RHI_RESOURCE_DEBUG_PASS_PARAMETER) : nullptr;
 		}
 
-		[[nodiscard]] inline virtual Rhi::ITextureBuffer* createTextureBuffer([[maybe_unused]] uint32_t numberOfBytes, [[maybe_unused]] const void* data = nullptr, [[maybe_unused]] uint32_t bufferFlags = Rhi::BufferFlag::SHADER_RESOURCE, [[maybe_unused]] Rhi::BufferUsage bufferUsage = Rhi::BufferUsage::STATIC_DRAW, [[maybe_unused]] Rhi::TextureFormat::Enum textureFormat = Rhi::TextureFormat::R32G32B32A32F RHI_RESOURCE_DEBUG_NAME_PARAMETER) override
+		[[nodiscard]] inline virtual Rhi::ITextureBuffer* createTextureBuffer(uint32_t numberOfBytes, [[maybe_unused]] const void* data = nullptr, [[maybe_unused]] uint32_t bufferFlags = Rhi::BufferFlag::SHADER_RESOURCE, [[maybe_unused]] Rhi::BufferUsage bufferUsage = Rhi::BufferUsage::STATIC_DRAW, [[maybe_unused]] Rhi::TextureFormat::Enum textureFormat = Rhi::TextureFormat::R32G32B32A32F RHI_RESOURCE_DEBUG_NAME_PARAMETER) override
 		{
 			NullRhi& nullRhi = static_cast<NullRhi&>(getRhi());
 
@@ -1510,10 +1552,10 @@ namespace NullRhi
 			RHI_ASSERT(nullRhi.getContext(), (numberOfBytes % Rhi::TextureFormat::getNumberOfBytesPerElement(textureFormat)) == 0, "The null texture buffer size must be a multiple of the selected texture format bytes per texel")
 
 			// Create the texture buffer
-			return RHI_NEW(nullRhi.getContext(), TextureBuffer)(nullRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER);
+			return RHI_NEW(nullRhi.getContext(), TextureBuffer)(nullRhi, numberOfBytes RHI_RESOURCE_DEBUG_PASS_PARAMETER);
 		}
 
-		[[nodiscard]] inline virtual Rhi::IStructuredBuffer* createStructuredBuffer([[maybe_unused]] uint32_t numberOfBytes, [[maybe_unused]] const void* data, [[maybe_unused]] uint32_t bufferFlags, [[maybe_unused]] Rhi::BufferUsage bufferUsage, [[maybe_unused]] uint32_t numberOfStructureBytes RHI_RESOURCE_DEBUG_NAME_PARAMETER) override
+		[[nodiscard]] inline virtual Rhi::IStructuredBuffer* createStructuredBuffer(uint32_t numberOfBytes, [[maybe_unused]] const void* data, [[maybe_unused]] uint32_t bufferFlags, [[maybe_unused]] Rhi::BufferUsage bufferUsage, [[maybe_unused]] uint32_t numberOfStructureBytes RHI_RESOURCE_DEBUG_NAME_PARAMETER) override
 		{
 			NullRhi& nullRhi = static_cast<NullRhi&>(getRhi());
 
@@ -1522,10 +1564,10 @@ namespace NullRhi
 			RHI_ASSERT(nullRhi.getContext(), (numberOfBytes % (sizeof(float) * 4)) == 0, "Performance: The null structured buffer should be aligned to a 128-bit stride, see \"Understanding Structured Buffer Performance\" by Evan Hart, posted Apr 17 2015 at 11:33AM - https://developer.nvidia.com/content/understanding-structured-buffer-performance")
 
 			// Create the structured buffer
-			return RHI_NEW(nullRhi.getContext(), StructuredBuffer)(nullRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER);
+			return RHI_NEW(nullRhi.getContext(), StructuredBuffer)(nullRhi, numberOfBytes RHI_RESOURCE_DEBUG_PASS_PARAMETER);
 		}
 
-		[[nodiscard]] inline virtual Rhi::IIndirectBuffer* createIndirectBuffer([[maybe_unused]] uint32_t numberOfBytes, [[maybe_unused]] const void* data = nullptr, [[maybe_unused]] uint32_t indirectBufferFlags = 0, [[maybe_unused]] Rhi::BufferUsage bufferUsage = Rhi::BufferUsage::STATIC_DRAW RHI_RESOURCE_DEBUG_NAME_PARAMETER) override
+		[[nodiscard]] inline virtual Rhi::IIndirectBuffer* createIndirectBuffer(uint32_t numberOfBytes, [[maybe_unused]] const void* data = nullptr, [[maybe_unused]] uint32_t indirectBufferFlags = 0, [[maybe_unused]] Rhi::BufferUsage bufferUsage = Rhi::BufferUsage::STATIC_DRAW RHI_RESOURCE_DEBUG_NAME_PARAMETER) override
 		{
 			NullRhi& nullRhi = static_cast<NullRhi&>(getRhi());
 
@@ -1536,10 +1578,10 @@ namespace NullRhi
 			RHI_ASSERT(nullRhi.getContext(), (indirectBufferFlags & Rhi::IndirectBufferFlag::DRAW_INDEXED_ARGUMENTS) == 0 || (numberOfBytes % sizeof(Rhi::DrawIndexedArguments)) == 0, "Null indirect buffer element type flags specification is \"DRAW_INDEXED_ARGUMENTS\" but the given number of bytes don't align to this")
 
 			// Create indirect buffer
-			return RHI_NEW(nullRhi.getContext(), IndirectBuffer)(nullRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER);
+			return RHI_NEW(nullRhi.getContext(), IndirectBuffer)(nullRhi, numberOfBytes RHI_RESOURCE_DEBUG_PASS_PARAMETER);
 		}
 
-		[[nodiscard]] inline virtual Rhi::IUniformBuffer* createUniformBuffer([[maybe_unused]] uint32_t numberOfBytes, [[maybe_unused]] const void* data = nullptr, [[maybe_unused]] Rhi::BufferUsage bufferUsage = Rhi::BufferUsage::STATIC_DRAW RHI_RESOURCE_DEBUG_NAME_PARAMETER) override
+		[[nodiscard]] inline virtual Rhi::IUniformBuffer* createUniformBuffer(uint32_t numberOfBytes, [[maybe_unused]] const void* data = nullptr, [[maybe_unused]] Rhi::BufferUsage bufferUsage = Rhi::BufferUsage::STATIC_DRAW RHI_RESOURCE_DEBUG_NAME_PARAMETER) override
 		{
 			NullRhi& nullRhi = static_cast<NullRhi&>(getRhi());
 
@@ -1548,7 +1590,7 @@ namespace NullRhi
 			// RHI_ASSERT(nullRhi.getContext(), (bufferFlags & Rhi::BufferFlag::SHADER_RESOURCE) != 0, "Invalid null buffer flags, uniform buffer must be used as shader resource")
 
 			// Create the uniform buffer
-			return RHI_NEW(nullRhi.getContext(), UniformBuffer)(nullRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER);
+			return RHI_NEW(nullRhi.getContext(), UniformBuffer)(nullRhi, numberOfBytes RHI_RESOURCE_DEBUG_PASS_PARAMETER);
 		}
 
 
@@ -1598,10 +1640,19 @@ namespace NullRhi
 		*    Owner null RHI instance
 		*  @param[in] width
 		*    The width of the texture
+		*  @param[in] textureFormat
+		*    Texture format
+		*  @param[in] textureFlags
+		*    Texture flags, see "Rhi::TextureFlag::Enum"
 		*/
-		inline Texture1D(NullRhi& nullRhi, uint32_t width RHI_RESOURCE_DEBUG_NAME_PARAMETER_NO_DEFAULT) :
+		inline Texture1D(NullRhi& nullRhi, uint32_t width, [[maybe_unused]] Rhi::TextureFormat::Enum textureFormat, [[maybe_unused]] uint32_t textureFlags RHI_RESOURCE_DEBUG_NAME_PARAMETER_NO_DEFAULT) :
 			ITexture1D(nullRhi, width RHI_RESOURCE_DEBUG_PASS_PARAMETER)
-		{}
+		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsTextureDescription(textureFormat, textureFlags, width);
+			#endif
+		}
 
 		/**
 		*  @brief
@@ -1659,10 +1710,19 @@ namespace NullRhi
 		*    The width of the texture
 		*  @param[in] numberOfSlices
 		*    The number of slices
+		*  @param[in] textureFormat
+		*    Texture format
+		*  @param[in] textureFlags
+		*    Texture flags, see "Rhi::TextureFlag::Enum"
 		*/
-		inline Texture1DArray(NullRhi& nullRhi, uint32_t width, uint32_t numberOfSlices RHI_RESOURCE_DEBUG_NAME_PARAMETER_NO_DEFAULT) :
+		inline Texture1DArray(NullRhi& nullRhi, uint32_t width, uint32_t numberOfSlices, [[maybe_unused]] Rhi::TextureFormat::Enum textureFormat, [[maybe_unused]] uint32_t textureFlags RHI_RESOURCE_DEBUG_NAME_PARAMETER_NO_DEFAULT) :
 			ITexture1DArray(nullRhi, width, numberOfSlices RHI_RESOURCE_DEBUG_PASS_PARAMETER)
-		{}
+		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsTextureDescription(textureFormat, textureFlags, width, 1, 1, numberOfSlices);
+			#endif
+		}
 
 		/**
 		*  @brief
@@ -1720,10 +1780,21 @@ namespace NullRhi
 		*    The width of the texture
 		*  @param[in] height
 		*    The height of the texture
+		*  @param[in] textureFormat
+		*    Texture format
+		*  @param[in] textureFlags
+		*    Texture flags, see "Rhi::TextureFlag::Enum"
+		*  @param[in] numberOfMultisamples
+		*    The number of multisamples per pixel (valid values: 1, 2, 4, 8)
 		*/
-		inline Texture2D(NullRhi& nullRhi, uint32_t width, uint32_t height RHI_RESOURCE_DEBUG_NAME_PARAMETER_NO_DEFAULT) :
+		inline Texture2D(NullRhi& nullRhi, uint32_t width, uint32_t height, [[maybe_unused]] Rhi::TextureFormat::Enum textureFormat, [[maybe_unused]] uint32_t textureFlags, [[maybe_unused]] uint8_t numberOfMultisamples RHI_RESOURCE_DEBUG_NAME_PARAMETER_NO_DEFAULT) :
 			ITexture2D(nullRhi, width, height RHI_RESOURCE_DEBUG_PASS_PARAMETER)
-		{}
+		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsTextureDescription(textureFormat, textureFlags, width, height, 1, 1, numberOfMultisamples);
+			#endif
+		}
 
 		/**
 		*  @brief
@@ -1783,10 +1854,19 @@ namespace NullRhi
 		*    The height of the texture
 		*  @param[in] numberOfSlices
 		*    The number of slices
+		*  @param[in] textureFormat
+		*    Texture format
+		*  @param[in] textureFlags
+		*    Texture flags, see "Rhi::TextureFlag::Enum"
 		*/
-		inline Texture2DArray(NullRhi& nullRhi, uint32_t width, uint32_t height, uint32_t numberOfSlices RHI_RESOURCE_DEBUG_NAME_PARAMETER_NO_DEFAULT) :
+		inline Texture2DArray(NullRhi& nullRhi, uint32_t width, uint32_t height, uint32_t numberOfSlices, [[maybe_unused]] Rhi::TextureFormat::Enum textureFormat, [[maybe_unused]] uint32_t textureFlags RHI_RESOURCE_DEBUG_NAME_PARAMETER_NO_DEFAULT) :
 			ITexture2DArray(nullRhi, width, height, numberOfSlices RHI_RESOURCE_DEBUG_PASS_PARAMETER)
-		{}
+		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsTextureDescription(textureFormat, textureFlags, width, height, 1, numberOfSlices);
+			#endif
+		}
 
 		/**
 		*  @brief
@@ -1846,10 +1926,19 @@ namespace NullRhi
 		*    The height of the texture
 		*  @param[in] depth
 		*    The depth of the texture
+		*  @param[in] textureFormat
+		*    Texture format
+		*  @param[in] textureFlags
+		*    Texture flags, see "Rhi::TextureFlag::Enum"
 		*/
-		inline Texture3D(NullRhi& nullRhi, uint32_t width, uint32_t height, uint32_t depth RHI_RESOURCE_DEBUG_NAME_PARAMETER_NO_DEFAULT) :
+		inline Texture3D(NullRhi& nullRhi, uint32_t width, uint32_t height, uint32_t depth, [[maybe_unused]] Rhi::TextureFormat::Enum textureFormat, [[maybe_unused]] uint32_t textureFlags RHI_RESOURCE_DEBUG_NAME_PARAMETER_NO_DEFAULT) :
 			ITexture3D(nullRhi, width, height, depth RHI_RESOURCE_DEBUG_PASS_PARAMETER)
-		{}
+		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsTextureDescription(textureFormat, textureFlags, width, height, depth);
+			#endif
+		}
 
 		/**
 		*  @brief
@@ -1905,10 +1994,19 @@ namespace NullRhi
 		*    Owner null RHI instance
 		*  @param[in] width
 		*    The width of the texture
+		*  @param[in] textureFormat
+		*    Texture format
+		*  @param[in] textureFlags
+		*    Texture flags, see "Rhi::TextureFlag::Enum"
 		*/
-		inline TextureCube(NullRhi& nullRhi, uint32_t width RHI_RESOURCE_DEBUG_NAME_PARAMETER_NO_DEFAULT) :
+		inline TextureCube(NullRhi& nullRhi, uint32_t width, [[maybe_unused]] Rhi::TextureFormat::Enum textureFormat, [[maybe_unused]] uint32_t textureFlags RHI_RESOURCE_DEBUG_NAME_PARAMETER_NO_DEFAULT) :
 			ITextureCube(nullRhi, width RHI_RESOURCE_DEBUG_PASS_PARAMETER)
-		{}
+		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsTextureDescription(textureFormat, textureFlags, width, width, 1, 6);
+			#endif
+		}
 
 		/**
 		*  @brief
@@ -1966,10 +2064,19 @@ namespace NullRhi
 		*    The width of the texture
 		*  @param[in] numberOfSlices
 		*    The number of slices
+		*  @param[in] textureFormat
+		*    Texture format
+		*  @param[in] textureFlags
+		*    Texture flags, see "Rhi::TextureFlag::Enum"
 		*/
-		inline TextureCubeArray(NullRhi& nullRhi, uint32_t width, uint32_t numberOfSlices RHI_RESOURCE_DEBUG_NAME_PARAMETER_NO_DEFAULT) :
+		inline TextureCubeArray(NullRhi& nullRhi, uint32_t width, uint32_t numberOfSlices, [[maybe_unused]] Rhi::TextureFormat::Enum textureFormat, [[maybe_unused]] uint32_t textureFlags RHI_RESOURCE_DEBUG_NAME_PARAMETER_NO_DEFAULT) :
 			ITextureCubeArray(nullRhi, width, numberOfSlices RHI_RESOURCE_DEBUG_PASS_PARAMETER)
-		{}
+		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsTextureDescription(textureFormat, textureFlags, width, width, 1, 6 * numberOfSlices);
+			#endif
+		}
 
 		/**
 		*  @brief
@@ -2040,7 +2147,7 @@ namespace NullRhi
 	//[ Public virtual Rhi::ITextureManager methods           ]
 	//[-------------------------------------------------------]
 	public:
-		[[nodiscard]] virtual Rhi::ITexture1D* createTexture1D(uint32_t width, [[maybe_unused]] Rhi::TextureFormat::Enum textureFormat, [[maybe_unused]] const void* data = nullptr, [[maybe_unused]] uint32_t textureFlags = 0, [[maybe_unused]] Rhi::TextureUsage textureUsage = Rhi::TextureUsage::DEFAULT RHI_RESOURCE_DEBUG_NAME_PARAMETER) override
+		[[nodiscard]] virtual Rhi::ITexture1D* createTexture1D(uint32_t width, Rhi::TextureFormat::Enum textureFormat, [[maybe_unused]] const void* data = nullptr, uint32_t textureFlags = 0, [[maybe_unused]] Rhi::TextureUsage textureUsage = Rhi::TextureUsage::DEFAULT RHI_RESOURCE_DEBUG_NAME_PARAMETER) override
 		{
 			NullRhi& nullRhi = static_cast<NullRhi&>(getRhi());
 
@@ -2048,10 +2155,10 @@ namespace NullRhi
 			RHI_ASSERT(nullRhi.getContext(), width > 0, "Null create texture 1D was called with invalid parameters")
 
 			// Create 1D texture resource
-			return RHI_NEW(nullRhi.getContext(), Texture1D)(nullRhi, width RHI_RESOURCE_DEBUG_PASS_PARAMETER);
+			return RHI_NEW(nullRhi.getContext(), Texture1D)(nullRhi, width, textureFormat, textureFlags RHI_RESOURCE_DEBUG_PASS_PARAMETER);
 		}
 
-		[[nodiscard]] virtual Rhi::ITexture1DArray* createTexture1DArray(uint32_t width, uint32_t numberOfSlices, [[maybe_unused]] Rhi::TextureFormat::Enum textureFormat, [[maybe_unused]] const void* data = nullptr, [[maybe_unused]] uint32_t textureFlags = 0, [[maybe_unused]] Rhi::TextureUsage textureUsage = Rhi::TextureUsage::DEFAULT RHI_RESOURCE_DEBUG_NAME_PARAMETER) override
+		[[nodiscard]] virtual Rhi::ITexture1DArray* createTexture1DArray(uint32_t width, uint32_t numberOfSlices, Rhi::TextureFormat::Enum textureFormat, [[maybe_unused]] const void* data = nullptr, uint32_t textureFlags = 0, [[maybe_unused]] Rhi::TextureUsage textureUsage = Rhi::TextureUsage::DEFAULT RHI_RESOURCE_DEBUG_NAME_PARAMETER) override
 		{
 			NullRhi& nullRhi = static_cast<NullRhi&>(getRhi());
 
@@ -2059,10 +2166,10 @@ namespace NullRhi
 			RHI_ASSERT(nullRhi.getContext(), width > 0 && numberOfSlices > 0, "Null create texture 1D array was called with invalid parameters")
 
 			// Create 1D texture array resource
-			return RHI_NEW(nullRhi.getContext(), Texture1DArray)(nullRhi, width, numberOfSlices RHI_RESOURCE_DEBUG_PASS_PARAMETER);
+			return RHI_NEW(nullRhi.getContext(), Texture1DArray)(nullRhi, width, numberOfSlices, textureFormat, textureFlags RHI_RESOURCE_DEBUG_PASS_PARAMETER);
 		}
 
-		[[nodiscard]] virtual Rhi::ITexture2D* createTexture2D(uint32_t width, uint32_t height, [[maybe_unused]] Rhi::TextureFormat::Enum textureFormat, [[maybe_unused]] const void* data = nullptr, [[maybe_unused]] uint32_t textureFlags = 0, [[maybe_unused]] Rhi::TextureUsage textureUsage = Rhi::TextureUsage::DEFAULT, [[maybe_unused]] uint8_t numberOfMultisamples = 1, [[maybe_unused]] const Rhi::OptimizedTextureClearValue* optimizedTextureClearValue = nullptr RHI_RESOURCE_DEBUG_NAME_PARAMETER) override
+		[[nodiscard]] virtual Rhi::ITexture2D* createTexture2D(uint32_t width, uint32_t height, Rhi::TextureFormat::Enum textureFormat, [[maybe_unused]] const void* data = nullptr, uint32_t textureFlags = 0, [[maybe_unused]] Rhi::TextureUsage textureUsage = Rhi::TextureUsage::DEFAULT, uint8_t numberOfMultisamples = 1, [[maybe_unused]] const Rhi::OptimizedTextureClearValue* optimizedTextureClearValue = nullptr RHI_RESOURCE_DEBUG_NAME_PARAMETER) override
 		{
 			NullRhi& nullRhi = static_cast<NullRhi&>(getRhi());
 
@@ -2070,10 +2177,10 @@ namespace NullRhi
 			RHI_ASSERT(nullRhi.getContext(), width > 0 && height > 0, "Null create texture 2D was called with invalid parameters")
 
 			// Create 2D texture resource
-			return RHI_NEW(nullRhi.getContext(), Texture2D)(nullRhi, width, height RHI_RESOURCE_DEBUG_PASS_PARAMETER);
+			return RHI_NEW(nullRhi.getContext(), Texture2D)(nullRhi, width, height, textureFormat, textureFlags, numberOfMultisamples RHI_RESOURCE_DEBUG_PASS_PARAMETER);
 		}
 
-		[[nodiscard]] virtual Rhi::ITexture2DArray* createTexture2DArray(uint32_t width, uint32_t height, uint32_t numberOfSlices, [[maybe_unused]] Rhi::TextureFormat::Enum textureFormat, [[maybe_unused]] const void* data = nullptr, [[maybe_unused]] uint32_t textureFlags = 0, [[maybe_unused]] Rhi::TextureUsage textureUsage = Rhi::TextureUsage::DEFAULT RHI_RESOURCE_DEBUG_NAME_PARAMETER) override
+		[[nodiscard]] virtual Rhi::ITexture2DArray* createTexture2DArray(uint32_t width, uint32_t height, uint32_t numberOfSlices, Rhi::TextureFormat::Enum textureFormat, [[maybe_unused]] const void* data = nullptr, uint32_t textureFlags = 0, [[maybe_unused]] Rhi::TextureUsage textureUsage = Rhi::TextureUsage::DEFAULT RHI_RESOURCE_DEBUG_NAME_PARAMETER) override
 		{
 			NullRhi& nullRhi = static_cast<NullRhi&>(getRhi());
 
@@ -2081,10 +2188,10 @@ namespace NullRhi
 			RHI_ASSERT(nullRhi.getContext(), width > 0 && height > 0 && numberOfSlices > 0, "Null create texture 2D array was called with invalid parameters")
 
 			// Create 2D texture array resource
-			return RHI_NEW(nullRhi.getContext(), Texture2DArray)(nullRhi, width, height, numberOfSlices RHI_RESOURCE_DEBUG_PASS_PARAMETER);
+			return RHI_NEW(nullRhi.getContext(), Texture2DArray)(nullRhi, width, height, numberOfSlices, textureFormat, textureFlags RHI_RESOURCE_DEBUG_PASS_PARAMETER);
 		}
 
-		[[nodiscard]] virtual Rhi::ITexture3D* createTexture3D(uint32_t width, uint32_t height, uint32_t depth, [[maybe_unused]] Rhi::TextureFormat::Enum textureFormat, [[maybe_unused]] const void* data = nullptr, [[maybe_unused]] uint32_t textureFlags = 0, [[maybe_unused]] Rhi::TextureUsage textureUsage = Rhi::TextureUsage::DEFAULT RHI_RESOURCE_DEBUG_NAME_PARAMETER) override
+		[[nodiscard]] virtual Rhi::ITexture3D* createTexture3D(uint32_t width, uint32_t height, uint32_t depth, Rhi::TextureFormat::Enum textureFormat, [[maybe_unused]] const void* data = nullptr, uint32_t textureFlags = 0, [[maybe_unused]] Rhi::TextureUsage textureUsage = Rhi::TextureUsage::DEFAULT RHI_RESOURCE_DEBUG_NAME_PARAMETER) override
 		{
 			NullRhi& nullRhi = static_cast<NullRhi&>(getRhi());
 
@@ -2092,10 +2199,10 @@ namespace NullRhi
 			RHI_ASSERT(nullRhi.getContext(), width > 0 && height > 0 && depth > 0, "Null create texture 3D was called with invalid parameters")
 
 			// Create 3D texture resource
-			return RHI_NEW(nullRhi.getContext(), Texture3D)(nullRhi, width, height, depth RHI_RESOURCE_DEBUG_PASS_PARAMETER);
+			return RHI_NEW(nullRhi.getContext(), Texture3D)(nullRhi, width, height, depth, textureFormat, textureFlags RHI_RESOURCE_DEBUG_PASS_PARAMETER);
 		}
 
-		[[nodiscard]] virtual Rhi::ITextureCube* createTextureCube(uint32_t width, [[maybe_unused]] Rhi::TextureFormat::Enum textureFormat, [[maybe_unused]] const void* data = nullptr, [[maybe_unused]] uint32_t textureFlags = 0, [[maybe_unused]] Rhi::TextureUsage textureUsage = Rhi::TextureUsage::DEFAULT RHI_RESOURCE_DEBUG_NAME_PARAMETER) override
+		[[nodiscard]] virtual Rhi::ITextureCube* createTextureCube(uint32_t width, Rhi::TextureFormat::Enum textureFormat, [[maybe_unused]] const void* data = nullptr, uint32_t textureFlags = 0, [[maybe_unused]] Rhi::TextureUsage textureUsage = Rhi::TextureUsage::DEFAULT RHI_RESOURCE_DEBUG_NAME_PARAMETER) override
 		{
 			NullRhi& nullRhi = static_cast<NullRhi&>(getRhi());
 
@@ -2103,10 +2210,10 @@ namespace NullRhi
 			RHI_ASSERT(nullRhi.getContext(), width > 0, "Null create texture cube was called with invalid parameters")
 
 			// Create cube texture resource
-			return RHI_NEW(nullRhi.getContext(), TextureCube)(nullRhi, width RHI_RESOURCE_DEBUG_PASS_PARAMETER);
+			return RHI_NEW(nullRhi.getContext(), TextureCube)(nullRhi, width, textureFormat, textureFlags RHI_RESOURCE_DEBUG_PASS_PARAMETER);
 		}
 
-		[[nodiscard]] virtual Rhi::ITextureCubeArray* createTextureCubeArray(uint32_t width, uint32_t numberOfSlices, [[maybe_unused]] Rhi::TextureFormat::Enum textureFormat, [[maybe_unused]] const void* data = nullptr, [[maybe_unused]] uint32_t textureFlags = 0, [[maybe_unused]] Rhi::TextureUsage textureUsage = Rhi::TextureUsage::DEFAULT RHI_RESOURCE_DEBUG_NAME_PARAMETER) override
+		[[nodiscard]] virtual Rhi::ITextureCubeArray* createTextureCubeArray(uint32_t width, uint32_t numberOfSlices, Rhi::TextureFormat::Enum textureFormat, [[maybe_unused]] const void* data = nullptr, uint32_t textureFlags = 0, [[maybe_unused]] Rhi::TextureUsage textureUsage = Rhi::TextureUsage::DEFAULT RHI_RESOURCE_DEBUG_NAME_PARAMETER) override
 		{
 			NullRhi& nullRhi = static_cast<NullRhi&>(getRhi());
 
@@ -2114,7 +2221,7 @@ namespace NullRhi
 			RHI_ASSERT(nullRhi.getContext(), width > 0, "Null create texture cube array was called with invalid parameters")
 
 			// Create cube texture array resource
-			return RHI_NEW(nullRhi.getContext(), TextureCubeArray)(nullRhi, width, numberOfSlices RHI_RESOURCE_DEBUG_PASS_PARAMETER);
+			return RHI_NEW(nullRhi.getContext(), TextureCubeArray)(nullRhi, width, numberOfSlices, textureFormat, textureFlags RHI_RESOURCE_DEBUG_PASS_PARAMETER);
 		}
 
 
@@ -3521,6 +3628,9 @@ namespace
 				static_cast<NullRhi::NullRhi&>(rhi).dispatchCompute(realData->groupCountX, realData->groupCountY, realData->groupCountZ);
 			}
 
+			void ComputeBufferBarrier(const void*, Rhi::IRhi&)
+			{}
+
 			//[-------------------------------------------------------]
 			//[ Resource                                              ]
 			//[-------------------------------------------------------]
@@ -3630,6 +3740,7 @@ namespace
 			&ImplementationDispatch::SetComputePipelineState,
 			&ImplementationDispatch::SetComputeResourceGroup,
 			&ImplementationDispatch::DispatchCompute,
+			&ImplementationDispatch::ComputeBufferBarrier,
 			// Resource
 			&ImplementationDispatch::SetTextureMinimumMaximumMipmapIndex,
 			&ImplementationDispatch::ResolveMultisampleFramebuffer,
@@ -4213,14 +4324,24 @@ namespace NullRhi
 	//[-------------------------------------------------------]
 	//[ Resource handling                                     ]
 	//[-------------------------------------------------------]
-	bool NullRhi::map(Rhi::IResource&, uint32_t, Rhi::MapType, uint32_t, Rhi::MappedSubresource&)
+	bool NullRhi::map([[maybe_unused]] Rhi::IResource& resource, [[maybe_unused]] uint32_t subresource, [[maybe_unused]] Rhi::MapType mapType, uint32_t, Rhi::MappedSubresource&)
 	{
+		#ifdef RHI_STATISTICS
+			getStatistics().currentFrame.countMap(resource, subresource, mapType);
+		#endif
+
 		// Not supported by the null RHI
 		return false;
 	}
 
 	void NullRhi::unmap(Rhi::IResource&, uint32_t)
-	{}
+	{
+		#ifdef RHI_STATISTICS
+			++getStatistics().currentFrame.numberOfUnmaps;
+		#endif
+
+		// Not supported by the null RHI
+	}
 
 	bool NullRhi::getQueryPoolResults(Rhi::IQueryPool&, uint32_t, uint8_t*, uint32_t, uint32_t, uint32_t, uint32_t)
 	{
@@ -4251,19 +4372,20 @@ namespace NullRhi
 		RHI_ASSERT(mContext, !commandBuffer.isEmpty(), "The null command buffer to execute mustn't be empty")
 
 		// Loop through all commands
-		const uint8_t* commandPacketBuffer = commandBuffer.getCommandPacketBuffer();
-		Rhi::ConstCommandPacket constCommandPacket = commandPacketBuffer;
+		Rhi::ConstCommandPacket constCommandPacket = commandBuffer.getFirstCommandPacket();
 		while (nullptr != constCommandPacket)
 		{
 			{ // Submit command packet
 				const Rhi::CommandDispatchFunctionIndex commandDispatchFunctionIndex = Rhi::CommandPacketHelper::loadCommandDispatchFunctionIndex(constCommandPacket);
 				const void* command = Rhi::CommandPacketHelper::loadCommand(constCommandPacket);
+				#ifdef RHI_STATISTICS
+					getStatistics().currentFrame.countCommandPacket(commandDispatchFunctionIndex, command);
+				#endif
 				detail::DISPATCH_FUNCTIONS[static_cast<uint32_t>(commandDispatchFunctionIndex)](command, *this);
 			}
 
 			{ // Next command
-				const uint32_t nextCommandPacketByteIndex = Rhi::CommandPacketHelper::getNextCommandPacketByteIndex(constCommandPacket);
-				constCommandPacket = (~0u != nextCommandPacketByteIndex) ? &commandPacketBuffer[nextCommandPacketByteIndex] : nullptr;
+				constCommandPacket = Rhi::CommandPacketHelper::getNextCommandPacket(constCommandPacket);
 			}
 		}
 	}
@@ -1070,6 +1070,27 @@ namespace OpenGLES3Rhi
 	FNDEF_EX(void,	glClipControlEXT,	(GLenum origin, GLenum depth));
 	#define glClipControlEXT			FNPTR(glClipControlEXT)
 
+	// GL_EXT_multi_draw_arrays
+	FNDEF_EX(void,	glMultiDrawArraysEXT,	(GLenum mode, const GLint* first, const GLsizei* count, GLsizei primcount));
+	FNDEF_EX(void,	glMultiDrawElementsEXT,	(GLenum mode, const GLsizei* count, GLenum type, const void* const* indices, GLsizei primcount));
+	#define glMultiDrawArraysEXT	FNPTR(glMultiDrawArraysEXT)
+	#define glMultiDrawElementsEXT	FNPTR(glMultiDrawElementsEXT)
+
+	//[-------------------------------------------------------]
+	//[ ANGLE definitions                                     ]
+	//[-------------------------------------------------------]
+	// GL_ANGLE_multi_draw
+	FNDEF_EX(void,	glMultiDrawArraysANGLE,		(GLenum mode, const GLint* firsts, const GLsizei* counts, GLsizei drawcount));
+	FNDEF_EX(void,	glMultiDrawElementsANGLE,	(GLenum mode, const GLsizei* counts, GLenum type, const void* const* indices, GLsizei drawcount));
+	#define glMultiDrawArraysANGLE		FNPTR(glMultiDrawArraysANGLE)
+	#define glMultiDrawElementsANGLE	FNPTR(glMultiDrawElementsANGLE)
+
+	// GL_ANGLE_base_vertex_base_instance
+	FNDEF_EX(void,	glMultiDrawArraysInstancedBaseInstanceANGLE,				(GLenum mode, const GLint* firsts, const GLsizei* counts, const GLsizei* instanceCounts, const GLuint* baseInstances, GLsizei drawcount));
+	FNDEF_EX(void,	glMultiDrawElementsInstancedBaseVertexBaseInstanceANGLE,	(GLenum mode, const GLsizei* counts, GLenum type, const void* const* indices, const GLsizei* instanceCounts, const GLint* baseVertices, const GLuint* baseInstances, GLsizei drawcount));
+	#define glMultiDrawArraysInstancedBaseInstanceANGLE				FNPTR(glMultiDrawArraysInstancedBaseInstanceANGLE)
+	#define glMultiDrawElementsInstancedBaseVertexBaseInstanceANGLE	FNPTR(glMultiDrawElementsInstancedBaseVertexBaseInstanceANGLE)
+
 	//[-------------------------------------------------------]
 	//[ AMD definitions                                       ]
 	//[-------------------------------------------------------]
@@ -1347,6 +1368,41 @@ namespace OpenGLES3Rhi
 		*/
 		void updateGL_EXT_base_instanceEmulation(uint32_t startInstanceLocation);
 
+		/**
+		*  @brief
+		*    Try to coalesce a run of emulated draws into a single native multi-draw call
+		*
+		*  @param[in] drawArguments
+		*    Draw arguments of the first draw to coalesce, must be valid
+		*  @param[in] numberOfDraws
+		*    Number of remaining draws inside the draw arguments array
+		*
+		*  @return
+		*    Number of draws issued by the native multi-draw call, zero if the first draw must be issued individually
+		*
+		*  @note
+		*    - Uses "GL_ANGLE_base_vertex_base_instance", "GL_ANGLE_multi_draw" or "GL_EXT_multi_draw_arrays", whichever is available
+		*    - Without per-draw instance data, only non-instanced draws sharing the same draw ID can be coalesced
+		*/
+		[[nodiscard]] uint32_t multiDrawGraphicsEmulated(const Rhi::DrawArguments* drawArguments, uint32_t numberOfDraws);
+
+		/**
+		*  @brief
+		*    Try to coalesce a run of emulated indexed draws into a single native multi-draw call
+		*
+		*  @param[in] drawIndexedArguments
+		*    Draw indexed arguments of the first draw to coalesce, must be valid
+		*  @param[in] numberOfDraws
+		*    Number of remaining draws inside the draw indexed arguments array
+		*
+		*  @return
+		*    Number of draws issued by the native multi-draw call, zero if the first draw must be issued individually
+		*
+		*  @note
+		*    - Without "GL_ANGLE_base_vertex_base_instance", draws using a base vertex location can't be coalesced
+		*/
+		[[nodiscard]] uint32_t multiDrawIndexedGraphicsEmulated(const Rhi::DrawIndexedArguments* drawIndexedArguments, uint32_t numberOfDraws);
+
 
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
@@ -1937,6 +1993,10 @@ namespace OpenGLES3Rhi
 		[[nodiscard]] virtual bool isGL_EXT_draw_elements_base_vertex() const = 0;
 		[[nodiscard]] virtual bool isGL_EXT_base_instance() const = 0;
 		[[nodiscard]] virtual bool isGL_EXT_clip_control() const = 0;
+		[[nodiscard]] virtual bool isGL_EXT_multi_draw_arrays() const = 0;
+		// ANGLE
+		[[nodiscard]] virtual bool isGL_ANGLE_multi_draw() const = 0;
+		[[nodiscard]] virtual bool isGL_ANGLE_base_vertex_base_instance() const = 0;
 		// AMD
 		[[nodiscard]] virtual bool isGL_AMD_compressed_3DC_texture() const = 0;
 		// NV
@@ -2002,6 +2062,10 @@ namespace OpenGLES3Rhi
 			mGL_EXT_draw_elements_base_vertex(false),
 			mGL_EXT_base_instance(false),
 			mGL_EXT_clip_control(false),
+			mGL_EXT_multi_draw_arrays(false),
+			// ANGLE
+			mGL_ANGLE_multi_draw(false),
+			mGL_ANGLE_base_vertex_base_instance(false),
 			// AMD
 			mGL_AMD_compressed_3DC_texture(false),
 			// NV
@@ -2104,6 +2168,40 @@ namespace OpenGLES3Rhi
 				mGL_EXT_clip_control = result;
 			}
 
+			mGL_EXT_multi_draw_arrays = (nullptr != strstr(extensions, "GL_EXT_multi_draw_arrays"));
+			if (mGL_EXT_multi_draw_arrays)
+			{
+				// Load the entry points
+				bool result = true;	// Success by default
+				IMPORT_FUNC(glMultiDrawArraysEXT)
+				IMPORT_FUNC(glMultiDrawElementsEXT)
+				mGL_EXT_multi_draw_arrays = result;
+			}
+
+
+			//[-------------------------------------------------------]
+			//[ ANGLE                                                 ]
+			//[-------------------------------------------------------]
+			mGL_ANGLE_multi_draw = (nullptr != strstr(extensions, "GL_ANGLE_multi_draw"));
+			if (mGL_ANGLE_multi_draw)
+			{
+				// Load the entry points
+				bool result = true;	// Success by default
+				IMPORT_FUNC(glMultiDrawArraysANGLE)
+				IMPORT_FUNC(glMultiDrawElementsANGLE)
+				mGL_ANGLE_multi_draw = result;
+			}
+
+			mGL_ANGLE_base_vertex_base_instance = (nullptr != strstr(extensions, "GL_ANGLE_base_vertex_base_instance"));
+			if (mGL_ANGLE_base_vertex_base_instance)
+			{
+				// Load the entry points
+				bool result = true;	// Success by default
+				IMPORT_FUNC(glMultiDrawArraysInstancedBaseInstanceANGLE)
+				IMPORT_FUNC(glMultiDrawElementsInstancedBaseVertexBaseInstanceANGLE)
+				mGL_ANGLE_base_vertex_base_instance = result;
+			}
+
 
 			//[-------------------------------------------------------]
 			//[ AMD                                                   ]
@@ -2188,6 +2286,22 @@ namespace OpenGLES3Rhi
 			return mGL_EXT_clip_control;
 		}
 
+		[[nodiscard]] inline virtual bool isGL_EXT_multi_draw_arrays() const override
+		{
+			return mGL_EXT_multi_draw_arrays;
+		}
+
+		// ANGLE
+		[[nodiscard]] inline virtual bool isGL_ANGLE_multi_draw() const override
+		{
+			return mGL_ANGLE_multi_draw;
+		}
+
+		[[nodiscard]] inline virtual bool isGL_ANGLE_base_vertex_base_instance() const override
+		{
+			return mGL_ANGLE_base_vertex_base_instance;
+		}
+
 		// AMD
 		[[nodiscard]] inline virtual bool isGL_AMD_compressed_3DC_texture() const override
 		{
@@ -2249,6 +2363,10 @@ namespace OpenGLES3Rhi
 		bool mGL_EXT_draw_elements_base_vertex;
 		bool mGL_EXT_base_instance;
 		bool mGL_EXT_clip_control;
+		bool mGL_EXT_multi_draw_arrays;
+		// ANGLE
+		bool mGL_ANGLE_multi_draw;
+		bool mGL_ANGLE_base_vertex_base_instance;
 		// AMD
 		bool mGL_AMD_compressed_3DC_texture;
 		// NV
@@ -3304,7 +3422,9 @@ namespace OpenGLES3Rhi
 				4,	// Rhi::VertexAttributeFormat::R8G8B8A8_UINT
 				2,	// Rhi::VertexAttributeFormat::SHORT_2
 				4,	// Rhi::VertexAttributeFormat::SHORT_4
-				1	// Rhi::VertexAttributeFormat::UINT_1
+				1,	// Rhi::VertexAttributeFormat::UINT_1
+				2,	// Rhi::VertexAttributeFormat::HALF_2
+				4	// Rhi::VertexAttributeFormat::SHORT_4_SNORM
 			};
 			return MAPPING[static_cast<int>(vertexAttributeFormat)];
 		}
@@ -3331,7 +3451,9 @@ namespace OpenGLES3Rhi
 				GL_UNSIGNED_BYTE,	// Rhi::VertexAttributeFormat::R8G8B8A8_UINT
 				GL_SHORT,			// Rhi::VertexAttributeFormat::SHORT_2
 				GL_SHORT,			// Rhi::VertexAttributeFormat::SHORT_4
-				GL_UNSIGNED_INT		// Rhi::VertexAttributeFormat::UINT_1
+				GL_UNSIGNED_INT,	// Rhi::VertexAttributeFormat::UINT_1
+				GL_HALF_FLOAT,		// Rhi::VertexAttributeFormat::HALF_2
+				GL_SHORT			// Rhi::VertexAttributeFormat::SHORT_4_SNORM
 			};
 			return MAPPING[static_cast<int>(vertexAttributeFormat)];
 		}
@@ -3358,7 +3480,9 @@ namespace OpenGLES3Rhi
 				GL_FALSE,	// Rhi::VertexAttributeFormat::R8G8B8A8_UINT
 				GL_FALSE,	// Rhi::VertexAttributeFormat::SHORT_2
 				GL_FALSE,	// Rhi::VertexAttributeFormat::SHORT_4
-				GL_FALSE	// Rhi::VertexAttributeFormat::UINT_1
+				GL_FALSE,	// Rhi::VertexAttributeFormat::UINT_1
+				GL_FALSE,	// Rhi::VertexAttributeFormat::HALF_2
+				GL_TRUE		// Rhi::VertexAttributeFormat::SHORT_4_SNORM
 			};
 			return MAPPING[static_cast<int>(vertexAttributeFormat)];
 		}
@@ -3385,7 +3509,9 @@ namespace OpenGLES3Rhi
 				GL_TRUE,	// Rhi::VertexAttributeFormat::R8G8B8A8_UINT
 				GL_TRUE,	// Rhi::VertexAttributeFormat::SHORT_2
 				GL_TRUE,	// Rhi::VertexAttributeFormat::SHORT_4
-				GL_TRUE		// Rhi::VertexAttributeFormat::UINT_1
+				GL_TRUE,	// Rhi::VertexAttributeFormat::UINT_1
+				GL_FALSE,	// Rhi::VertexAttributeFormat::HALF_2
+				GL_FALSE	// Rhi::VertexAttributeFormat::SHORT_4_SNORM
 			};
 			return MAPPING[static_cast<int>(vertexAttributeFormat)];
 		}
@@ -4093,6 +4219,11 @@ namespace OpenGLES3Rhi
 			mOpenGLES3ArrayBuffer(0),
 			mBufferSize(numberOfBytes)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsNumberOfBytes(numberOfBytes);
+			#endif
+
 			// Create the OpenGL ES 3 array buffer
 			glGenBuffers(1, &mOpenGLES3ArrayBuffer);
 
@@ -4218,6 +4349,11 @@ namespace OpenGLES3Rhi
 			mIndexSizeInBytes(Rhi::IndexBufferFormat::getNumberOfBytesPerElement(indexBufferFormat)),
 			mBufferSize(numberOfBytes)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsNumberOfBytes(numberOfBytes);
+			#endif
+
 			// "GL_UNSIGNED_INT" is only allowed when the "GL_OES_element_index_uint" extension is there
 			if (Rhi::IndexBufferFormat::UNSIGNED_INT != indexBufferFormat || openGLES3Rhi.getOpenGLES3Context().getExtensions().isGL_OES_element_index_uint())
 			{
@@ -4734,6 +4870,11 @@ namespace OpenGLES3Rhi
 		TextureBufferBind(OpenGLES3Rhi& openGLES3Rhi, uint32_t numberOfBytes, const void* data, Rhi::BufferUsage bufferUsage, Rhi::TextureFormat::Enum textureFormat RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
 			TextureBuffer(openGLES3Rhi, numberOfBytes RHI_RESOURCE_DEBUG_PASS_PARAMETER)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsNumberOfBytes(numberOfBytes);
+			#endif
+
 			{ // Buffer part
 				#ifdef RHI_OPENGLES3_STATE_CLEANUP
 					// Backup the currently bound OpenGL ES 3 texture buffer
@@ -4924,6 +5065,11 @@ namespace OpenGLES3Rhi
 			mNumberOfBytes(numberOfBytes),
 			mData(nullptr)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsNumberOfBytes(numberOfBytes);
+			#endif
+
 			// Sanity checks
 			RHI_ASSERT(openGLES3Rhi.getContext(), (indirectBufferFlags & Rhi::IndirectBufferFlag::DRAW_ARGUMENTS) != 0 || (indirectBufferFlags & Rhi::IndirectBufferFlag::DRAW_INDEXED_ARGUMENTS) != 0, "Invalid OpenGL ES 3 flags, indirect buffer element type specification \"DRAW_ARGUMENTS\" or \"DRAW_INDEXED_ARGUMENTS\" is missing")
 			RHI_ASSERT(openGLES3Rhi.getContext(), !((indirectBufferFlags & Rhi::IndirectBufferFlag::DRAW_ARGUMENTS) != 0 && (indirectBufferFlags & Rhi::IndirectBufferFlag::DRAW_INDEXED_ARGUMENTS) != 0), "Invalid OpenGL ES 3 flags, indirect buffer element type specification \"DRAW_ARGUMENTS\" or \"DRAW_INDEXED_ARGUMENTS\" must be set, but not both at one and the same time")
@@ -5041,6 +5187,11 @@ namespace OpenGLES3Rhi
 			mOpenGLES3UniformBuffer(0),
 			mBufferSize(numberOfBytes)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsNumberOfBytes(numberOfBytes);
+			#endif
+
 			// Create the OpenGL ES 3 uniform buffer
 			glGenBuffers(1, &mOpenGLES3UniformBuffer);
 
@@ -5341,6 +5492,11 @@ namespace OpenGLES3Rhi
 			ITexture1D(openGLES3Rhi, width RHI_RESOURCE_DEBUG_PASS_PARAMETER),
 			mOpenGLES3Texture(0)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsTextureDescription(textureFormat, textureFlags, width);
+			#endif
+
 			// OpenGL ES 3 has no 1D textures, just use a 2D texture with a height of one
 
 			// Sanity checks
@@ -5555,6 +5711,11 @@ namespace OpenGLES3Rhi
 			ITexture1DArray(openGLES3Rhi, width, numberOfSlices RHI_RESOURCE_DEBUG_PASS_PARAMETER),
 			mOpenGLES3Texture(0)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsTextureDescription(textureFormat, textureFlags, width, 1, 1, numberOfSlices);
+			#endif
+
 			// OpenGL ES 3 has no 1D texture arrays, just use a 2D texture array with a height of one
 
 			// TODO(co) Check support formats
@@ -5705,6 +5866,11 @@ namespace OpenGLES3Rhi
 			ITexture2D(openGLES3Rhi, width, height RHI_RESOURCE_DEBUG_PASS_PARAMETER),
 			mOpenGLES3Texture(0)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsTextureDescription(textureFormat, textureFlags, width, height);
+			#endif
+
 			// Sanity checks
 			RHI_ASSERT(openGLES3Rhi.getContext(), 0 == (textureFlags & Rhi::TextureFlag::DATA_CONTAINS_MIPMAPS) || nullptr != data, "Invalid OpenGL ES 3 texture parameters")
 			RHI_ASSERT(openGLES3Rhi.getContext(), (textureFlags & Rhi::TextureFlag::RENDER_TARGET) == 0 || nullptr == data, "OpenGL ES 3 render target textures can't be filled using provided data")
@@ -5957,6 +6123,11 @@ namespace OpenGLES3Rhi
 			ITexture2DArray(openGLES3Rhi, width, height, numberOfSlices RHI_RESOURCE_DEBUG_PASS_PARAMETER),
 			mOpenGLES3Texture(0)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsTextureDescription(textureFormat, textureFlags, width, height, 1, numberOfSlices);
+			#endif
+
 			// TODO(co) Check support formats
 
 			#ifdef RHI_OPENGLES3_STATE_CLEANUP
@@ -6108,6 +6279,11 @@ namespace OpenGLES3Rhi
 			mTextureFormat(textureFormat),
 			mOpenGLES3Texture(0)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsTextureDescription(textureFormat, textureFlags, width, height, depth);
+			#endif
+
 			// Sanity checks
 			RHI_ASSERT(openGLES3Rhi.getContext(), 0 == (textureFlags & Rhi::TextureFlag::DATA_CONTAINS_MIPMAPS) || nullptr != data, "Invalid OpenGL ES 3 texture parameters")
 			RHI_ASSERT(openGLES3Rhi.getContext(), (textureFlags & Rhi::TextureFlag::RENDER_TARGET) == 0 || nullptr == data, "OpenGL ES 3 render target textures can't be filled using provided data")
@@ -6333,6 +6509,11 @@ namespace OpenGLES3Rhi
 			ITextureCube(openGLES3Rhi, width RHI_RESOURCE_DEBUG_PASS_PARAMETER),
 			mOpenGLES3Texture(0)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsTextureDescription(textureFormat, textureFlags, width, width, 1, 6);
+			#endif
+
 			// Sanity checks
 			RHI_ASSERT(openGLES3Rhi.getContext(), 0 == (textureFlags & Rhi::TextureFlag::DATA_CONTAINS_MIPMAPS) || nullptr != data, "Invalid OpenGL ES 3 texture parameters")
 			RHI_ASSERT(openGLES3Rhi.getContext(), (textureFlags & Rhi::TextureFlag::RENDER_TARGET) == 0 || nullptr == data, "OpenGL ES 3 render target textures can't be filled using provided data")
@@ -8956,6 +9137,12 @@ namespace
 	{
 
 
+		//[-------------------------------------------------------]
+		//[ Global definitions                                    ]
+		//[-------------------------------------------------------]
+		static constexpr uint32_t MAXIMUM_NUMBER_OF_COALESCED_DRAWS = 64;	///< Maximum number of emulated draws coalesced into a single native multi-draw call, limits the used stack memory
+
+
 		//[-------------------------------------------------------]
 		//[ Global functions                                      ]
 		//[-------------------------------------------------------]
@@ -9134,6 +9321,11 @@ namespace
 				RHI_LOG(static_cast<OpenGLES3Rhi::OpenGLES3Rhi&>(rhi).getContext(), CRITICAL, "OpenGL ES 3 doesn't support compute dispatch")
 			}
 
+			void ComputeBufferBarrier(const void*, Rhi::IRhi& rhi)
+			{
+				RHI_LOG(static_cast<OpenGLES3Rhi::OpenGLES3Rhi&>(rhi).getContext(), CRITICAL, "OpenGL ES 3 doesn't support compute buffer barrier")
+			}
+
 			//[-------------------------------------------------------]
 			//[ Resource                                              ]
 			//[-------------------------------------------------------]
@@ -9259,6 +9451,7 @@ namespace
 			&ImplementationDispatch::SetComputePipelineState,
 			&ImplementationDispatch::SetComputeResourceGroup,
 			&ImplementationDispatch::DispatchCompute,
+			&ImplementationDispatch::ComputeBufferBarrier,
 			// Resource
 			&ImplementationDispatch::SetTextureMinimumMaximumMipmapIndex,
 			&ImplementationDispatch::ResolveMultisampleFramebuffer,
@@ -10008,7 +10201,15 @@ namespace OpenGLES3Rhi
 		#endif
 		for (uint32_t i = 0; i < numberOfDraws; ++i)
 		{
+			// Try to coalesce a run of draws into a single native multi-draw call
 			const Rhi::DrawArguments& drawArguments = *reinterpret_cast<const Rhi::DrawArguments*>(emulationData);
+			const uint32_t numberOfCoalescedDraws = multiDrawGraphicsEmulated(&drawArguments, numberOfDraws - i);
+			if (numberOfCoalescedDraws > 0)
+			{
+				i += numberOfCoalescedDraws - 1;
+				emulationData += sizeof(Rhi::DrawArguments) * numberOfCoalescedDraws;
+				continue;
+			}
 			updateGL_EXT_base_instanceEmulation(drawArguments.startInstanceLocation);
 
 			// Draw and advance
@@ -10061,7 +10262,15 @@ namespace OpenGLES3Rhi
 		IndexBuffer* indexBuffer = mVertexArray->getIndexBuffer();
 		for (uint32_t i = 0; i < numberOfDraws; ++i)
 		{
+			// Try to coalesce a run of draws into a single native multi-draw call
 			const Rhi::DrawIndexedArguments& drawIndexedArguments = *reinterpret_cast<const Rhi::DrawIndexedArguments*>(emulationData);
+			const uint32_t numberOfCoalescedDraws = multiDrawIndexedGraphicsEmulated(&drawIndexedArguments, numberOfDraws - i);
+			if (numberOfCoalescedDraws > 0)
+			{
+				i += numberOfCoalescedDraws - 1;
+				emulationData += sizeof(Rhi::DrawIndexedArguments) * numberOfCoalescedDraws;
+				continue;
+			}
 			updateGL_EXT_base_instanceEmulation(drawIndexedArguments.startInstanceLocation);
 
 			// Draw and advance
@@ -10121,11 +10330,13 @@ namespace OpenGLES3Rhi
 				}
 				else
 				{
-					// Draw and advance
+					// Draw
 					glDrawElements(mOpenGLES3PrimitiveTopology, static_cast<GLsizei>(drawIndexedArguments.indexCountPerInstance), indexBuffer->getOpenGLES3Type(), reinterpret_cast<void*>(static_cast<uintptr_t>(drawIndexedArguments.startIndexLocation * indexBuffer->getIndexSizeInBytes())));
-					emulationData += sizeof(Rhi::DrawIndexedArguments);
 				}
 			}
+
+			// Advance
+			emulationData += sizeof(Rhi::DrawIndexedArguments);
 		}
 		#ifdef RHI_DEBUG
 			if (numberOfDraws > 1)
@@ -10496,8 +10707,12 @@ namespace OpenGLES3Rhi
 	//[-------------------------------------------------------]
 	//[ Resource handling                                     ]
 	//[-------------------------------------------------------]
-	bool OpenGLES3Rhi::map(Rhi::IResource& resource, uint32_t, Rhi::MapType mapType, uint32_t, Rhi::MappedSubresource& mappedSubresource)
+	bool OpenGLES3Rhi::map(Rhi::IResource& resource, [[maybe_unused]] uint32_t subresource, Rhi::MapType mapType, uint32_t, Rhi::MappedSubresource& mappedSubresource)
 	{
+		#ifdef RHI_STATISTICS
+			getStatistics().currentFrame.countMap(resource, subresource, mapType);
+		#endif
+
 		// Evaluate the resource type
 		switch (resource.getResourceType())
 		{
@@ -10655,6 +10870,10 @@ namespace OpenGLES3Rhi
 
 	void OpenGLES3Rhi::unmap(Rhi::IResource& resource, uint32_t)
 	{
+		#ifdef RHI_STATISTICS
+			++getStatistics().currentFrame.numberOfUnmaps;
+		#endif
+
 		// Evaluate the resource type
 		switch (resource.getResourceType())
 		{
@@ -10806,19 +11025,20 @@ namespace OpenGLES3Rhi
 		RHI_ASSERT(mContext, !commandBuffer.isEmpty(), "The OpenGL ES 3 command buffer to execute mustn't be empty")
 
 		// Loop through all commands
-		const uint8_t* commandPacketBuffer = commandBuffer.getCommandPacketBuffer();
-		Rhi::ConstCommandPacket constCommandPacket = commandPacketBuffer;
+		Rhi::ConstCommandPacket constCommandPacket = commandBuffer.getFirstCommandPacket();
 		while (nullptr != constCommandPacket)
 		{
 			{ // Submit command packet
 				const Rhi::CommandDispatchFunctionIndex commandDispatchFunctionIndex = Rhi::CommandPacketHelper::loadCommandDispatchFunctionIndex(constCommandPacket);
 				const void* command = Rhi::CommandPacketHelper::loadCommand(constCommandPacket);
+				#ifdef RHI_STATISTICS
+					getStatistics().currentFrame.countCommandPacket(commandDispatchFunctionIndex, command);
+				#endif
 				detail::DISPATCH_FUNCTIONS[static_cast<uint32_t>(commandDispatchFunctionIndex)](command, *this);
 			}
 
 			{ // Next command
-				const uint32_t nextCommandPacketByteIndex = Rhi::CommandPacketHelper::getNextCommandPacketByteIndex(constCommandPacket);
-				constCommandPacket = (~0u != nextCommandPacketByteIndex) ? &commandPacketBuffer[nextCommandPacketByteIndex] : nullptr;
+				constCommandPacket = Rhi::CommandPacketHelper::getNextCommandPacket(constCommandPacket);
 			}
 		}
 	}
@@ -11144,6 +11364,136 @@ namespace OpenGLES3Rhi
 		}
 	}
 
+	uint32_t OpenGLES3Rhi::multiDrawGraphicsEmulated(const Rhi::DrawArguments* drawArguments, uint32_t numberOfDraws)
+	{
+		const IExtensions& extensions = mOpenGLES3Context->getExtensions();
+		const bool drawIdUniformUsed = (-1 != mDrawIdUniformLocation && 0 != mOpenGLES3Program);
+		const uint32_t maximumNumberOfDraws = (numberOfDraws < ::detail::MAXIMUM_NUMBER_OF_COALESCED_DRAWS) ? numberOfDraws : ::detail::MAXIMUM_NUMBER_OF_COALESCED_DRAWS;
+		if (maximumNumberOfDraws < 2)
+		{
+			// Nothing to coalesce
+			return 0;
+		}
+		GLint firsts[::detail::MAXIMUM_NUMBER_OF_COALESCED_DRAWS];
+		GLsizei counts[::detail::MAXIMUM_NUMBER_OF_COALESCED_DRAWS];
+
+		// Per-draw instance count and start instance location: All draws can be coalesced as long as the draw ID uniform emulation isn't used
+		if (!drawIdUniformUsed && extensions.isGL_ANGLE_base_vertex_base_instance())
+		{
+			GLsizei instanceCounts[::detail::MAXIMUM_NUMBER_OF_COALESCED_DRAWS];
+			GLuint baseInstances[::detail::MAXIMUM_NUMBER_OF_COALESCED_DRAWS];
+			for (uint32_t i = 0; i < maximumNumberOfDraws; ++i)
+			{
+				const Rhi::DrawArguments& currentDrawArguments = drawArguments[i];
+				firsts[i]		  = static_cast<GLint>(currentDrawArguments.startVertexLocation);
+				counts[i]		  = static_cast<GLsizei>(currentDrawArguments.vertexCountPerInstance);
+				instanceCounts[i] = static_cast<GLsizei>((currentDrawArguments.instanceCount > 1) ? currentDrawArguments.instanceCount : 1);
+				baseInstances[i]  = currentDrawArguments.startInstanceLocation;
+			}
+			glMultiDrawArraysInstancedBaseInstanceANGLE(mOpenGLES3PrimitiveTopology, firsts, counts, instanceCounts, baseInstances, static_cast<GLsizei>(maximumNumberOfDraws));
+			return maximumNumberOfDraws;
+		}
+
+		// No per-draw instance data: Gather a run of non-instanced draws sharing the same draw ID
+		if (!extensions.isGL_ANGLE_multi_draw() && !extensions.isGL_EXT_multi_draw_arrays())
+		{
+			return 0;
+		}
+		const bool baseInstance = extensions.isGL_EXT_base_instance();
+		uint32_t numberOfCoalescedDraws = 0;
+		for (; numberOfCoalescedDraws < maximumNumberOfDraws; ++numberOfCoalescedDraws)
+		{
+			const Rhi::DrawArguments& currentDrawArguments = drawArguments[numberOfCoalescedDraws];
+			if (currentDrawArguments.instanceCount > 1 || (currentDrawArguments.startInstanceLocation > 0 && baseInstance) || (drawIdUniformUsed && currentDrawArguments.startInstanceLocation != drawArguments->startInstanceLocation))
+			{
+				break;
+			}
+			firsts[numberOfCoalescedDraws] = static_cast<GLint>(currentDrawArguments.startVertexLocation);
+			counts[numberOfCoalescedDraws] = static_cast<GLsizei>(currentDrawArguments.vertexCountPerInstance);
+		}
+		if (numberOfCoalescedDraws < 2)
+		{
+			return 0;
+		}
+		updateGL_EXT_base_instanceEmulation(drawArguments->startInstanceLocation);
+		if (extensions.isGL_ANGLE_multi_draw())
+		{
+			glMultiDrawArraysANGLE(mOpenGLES3PrimitiveTopology, firsts, counts, static_cast<GLsizei>(numberOfCoalescedDraws));
+		}
+		else
+		{
+			glMultiDrawArraysEXT(mOpenGLES3PrimitiveTopology, firsts, counts, static_cast<GLsizei>(numberOfCoalescedDraws));
+		}
+		return numberOfCoalescedDraws;
+	}
+
+	uint32_t OpenGLES3Rhi::multiDrawIndexedGraphicsEmulated(const Rhi::DrawIndexedArguments* drawIndexedArguments, uint32_t numberOfDraws)
+	{
+		const IExtensions& extensions = mOpenGLES3Context->getExtensions();
+		const bool drawIdUniformUsed = (-1 != mDrawIdUniformLocation && 0 != mOpenGLES3Program);
+		const uint32_t maximumNumberOfDraws = (numberOfDraws < ::detail::MAXIMUM_NUMBER_OF_COALESCED_DRAWS) ? numberOfDraws : ::detail::MAXIMUM_NUMBER_OF_COALESCED_DRAWS;
+		if (maximumNumberOfDraws < 2)
+		{
+			// Nothing to coalesce
+			return 0;
+		}
+		const IndexBuffer* indexBuffer = mVertexArray->getIndexBuffer();
+		const uint32_t indexSizeInBytes = indexBuffer->getIndexSizeInBytes();
+		GLsizei counts[::detail::MAXIMUM_NUMBER_OF_COALESCED_DRAWS];
+		const void* indices[::detail::MAXIMUM_NUMBER_OF_COALESCED_DRAWS];
+
+		// Per-draw instance count, base vertex location and start instance location: All draws can be coalesced as long as the draw ID uniform emulation isn't used
+		if (!drawIdUniformUsed && extensions.isGL_ANGLE_base_vertex_base_instance())
+		{
+			GLsizei instanceCounts[::detail::MAXIMUM_NUMBER_OF_COALESCED_DRAWS];
+			GLint baseVertices[::detail::MAXIMUM_NUMBER_OF_COALESCED_DRAWS];
+			GLuint baseInstances[::detail::MAXIMUM_NUMBER_OF_COALESCED_DRAWS];
+			for (uint32_t i = 0; i < maximumNumberOfDraws; ++i)
+			{
+				const Rhi::DrawIndexedArguments& currentDrawIndexedArguments = drawIndexedArguments[i];
+				counts[i]		  = static_cast<GLsizei>(currentDrawIndexedArguments.indexCountPerInstance);
+				indices[i]		  = reinterpret_cast<const void*>(static_cast<uintptr_t>(currentDrawIndexedArguments.startIndexLocation * indexSizeInBytes));
+				instanceCounts[i] = static_cast<GLsizei>((currentDrawIndexedArguments.instanceCount > 1) ? currentDrawIndexedArguments.instanceCount : 1);
+				baseVertices[i]	  = static_cast<GLint>(currentDrawIndexedArguments.baseVertexLocation);
+				baseInstances[i]  = currentDrawIndexedArguments.startInstanceLocation;
+			}
+			glMultiDrawElementsInstancedBaseVertexBaseInstanceANGLE(mOpenGLES3PrimitiveTopology, counts, indexBuffer->getOpenGLES3Type(), indices, instanceCounts, baseVertices, baseInstances, static_cast<GLsizei>(maximumNumberOfDraws));
+			return maximumNumberOfDraws;
+		}
+
+		// No per-draw instance data: Gather a run of non-instanced draws without base vertex location sharing the same draw ID
+		if (!extensions.isGL_ANGLE_multi_draw() && !extensions.isGL_EXT_multi_draw_arrays())
+		{
+			return 0;
+		}
+		const bool baseInstance = extensions.isGL_EXT_base_instance();
+		uint32_t numberOfCoalescedDraws = 0;
+		for (; numberOfCoalescedDraws < maximumNumberOfDraws; ++numberOfCoalescedDraws)
+		{
+			const Rhi::DrawIndexedArguments& currentDrawIndexedArguments = drawIndexedArguments[numberOfCoalescedDraws];
+			if (currentDrawIndexedArguments.instanceCount > 1 || currentDrawIndexedArguments.baseVertexLocation > 0 || (currentDrawIndexedArguments.startInstanceLocation > 0 && baseInstance) || (drawIdUniformUsed && currentDrawIndexedArguments.startInstanceLocation != drawIndexedArguments->startInstanceLocation))
+			{
+				break;
+			}
+			counts[numberOfCoalescedDraws]  = static_cast<GLsizei>(currentDrawIndexedArguments.indexCountPerInstance);
+			indices[numberOfCoalescedDraws] = reinterpret_cast<const void*>(static_cast<uintptr_t>(currentDrawIndexedArguments.startIndexLocation * indexSizeInBytes));
+		}
+		if (numberOfCoalescedDraws < 2)
+		{
+			return 0;
+		}
+		updateGL_EXT_base_instanceEmulation(drawIndexedArguments->startInstanceLocation);
+		if (extensions.isGL_ANGLE_multi_draw())
+		{
+			glMultiDrawElementsANGLE(mOpenGLES3PrimitiveTopology, counts, indexBuffer->getOpenGLES3Type(), indices, static_cast<GLsizei>(numberOfCoalescedDraws));
+		}
+		else
+		{
+			glMultiDrawElementsEXT(mOpenGLES3PrimitiveTopology, counts, indexBuffer->getOpenGLES3Type(), indices, static_cast<GLsizei>(numberOfCoalescedDraws));
+		}
+		return numberOfCoalescedDraws;
+	}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
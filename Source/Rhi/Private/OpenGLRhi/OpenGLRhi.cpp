@@ -953,6 +953,7 @@ FNDEF_EX(glSamplerParameterfv,	PFNGLSAMPLERPARAMETERFVPROC);
 // GL_ARB_draw_elements_base_vertex
 FNDEF_EX(glDrawElementsBaseVertex,			PFNGLDRAWELEMENTSBASEVERTEXPROC);
 FNDEF_EX(glDrawElementsInstancedBaseVertex,	PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC);
+FNDEF_EX(glMultiDrawElementsBaseVertex,		PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC);
 
 // GL_ARB_debug_output
 FNDEF_EX(glDebugMessageCallbackARB,	PFNGLDEBUGMESSAGECALLBACKARBPROC);
@@ -964,8 +965,10 @@ FNDEF_EX(glCreateFramebuffers,				PFNGLCREATEFRAMEBUFFERSPROC);
 FNDEF_EX(glCreateTextures,					PFNGLCREATETEXTURESPROC);
 FNDEF_EX(glCreateVertexArrays,				PFNGLCREATEVERTEXARRAYSPROC);
 FNDEF_EX(glNamedBufferData,					PFNGLNAMEDBUFFERDATAPROC);
+FNDEF_EX(glNamedBufferStorage,				PFNGLNAMEDBUFFERSTORAGEPROC);
 FNDEF_EX(glNamedBufferSubData,				PFNGLNAMEDBUFFERSUBDATAPROC);
 FNDEF_EX(glMapNamedBuffer,					PFNGLMAPNAMEDBUFFERPROC);
+FNDEF_EX(glMapNamedBufferRange,				PFNGLMAPNAMEDBUFFERRANGEPROC);
 FNDEF_EX(glUnmapNamedBuffer,				PFNGLUNMAPNAMEDBUFFERPROC);
 FNDEF_EX(glProgramUniform1i,				PFNGLPROGRAMUNIFORM1IPROC);
 FNDEF_EX(glProgramUniform1ui,				PFNGLPROGRAMUNIFORM1UIPROC);
@@ -1023,11 +1026,21 @@ FNDEF_EX(glGetQueryObjectuivARB,	PFNGLGETQUERYOBJECTUIVARBPROC);
 // GL_ARB_timer_query
 FNDEF_EX(glQueryCounter,	PFNGLQUERYCOUNTERPROC);
 
+// GL_ARB_buffer_storage
+FNDEF_EX(glBufferStorage,	PFNGLBUFFERSTORAGEPROC);
+
+// GL_ARB_sync
+FNDEF_EX(glFenceSync,		PFNGLFENCESYNCPROC);
+FNDEF_EX(glDeleteSync,		PFNGLDELETESYNCPROC);
+FNDEF_EX(glClientWaitSync,	PFNGLCLIENTWAITSYNCPROC);
+
 
 //[-------------------------------------------------------]
 //[ Core (OpenGL version dependent)                       ]
 //[-------------------------------------------------------]
-FNDEF_EX(glShaderBinary,	PFNGLSHADERBINARYPROC);	// OpenGL 4.1
+FNDEF_EX(glMultiDrawArrays,		PFNGLMULTIDRAWARRAYSPROC);		// OpenGL 1.4
+FNDEF_EX(glMultiDrawElements,	PFNGLMULTIDRAWELEMENTSPROC);	// OpenGL 1.4
+FNDEF_EX(glShaderBinary,		PFNGLSHADERBINARYPROC);			// OpenGL 4.1
 
 //[-------------------------------------------------------]
 //[ Undefine helper macro                                 ]
@@ -1764,6 +1777,326 @@ namespace OpenGLRhi
 
 
 
+	//[-------------------------------------------------------]
+	//[ OpenGLRhi/OpenGLStateCache.h                          ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    OpenGL state cache class
+	*
+	*  @remarks
+	*    Shadows the OpenGL rasterizer, depth stencil and blend states as well as the texture unit, sampler and buffer binding
+	*    points so only OpenGL calls which really change something are issued. An unknown cached state always issues the OpenGL
+	*    call, so invalidating the cache is always safe.
+	*
+	*  @note
+	*    - Only OpenGL state changes done through the state cache are known, OpenGL calls bypassing it must invalidate the affected cached state
+	*    - OpenGL resets the bindings of destroyed OpenGL objects and might reuse their names, so destroyed OpenGL objects must be forgotten
+	*/
+	class OpenGLStateCache final
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Public definitions                                    ]
+	//[-------------------------------------------------------]
+	public:
+		static constexpr uint32_t MAXIMUM_NUMBER_OF_BINDINGS = 32;	///< Maximum number of cached texture unit, sampler and buffer binding points, bindings outside of this range are always issued
+
+		enum class Capability : uint8_t
+		{
+			CULL_FACE,					///< "GL_CULL_FACE"
+			DEPTH_CLAMP,				///< "GL_DEPTH_CLAMP"
+			SCISSOR_TEST,				///< "GL_SCISSOR_TEST"
+			LINE_SMOOTH,				///< "GL_LINE_SMOOTH"
+			DEPTH_TEST,					///< "GL_DEPTH_TEST"
+			SAMPLE_ALPHA_TO_COVERAGE,	///< "GL_SAMPLE_ALPHA_TO_COVERAGE_ARB"
+			BLEND,						///< "GL_BLEND"
+			NUMBER_OF_CAPABILITIES
+		};
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		inline OpenGLStateCache()
+		#ifdef RHI_STATISTICS
+			:
+			mNumberOfIssuedOpenGLCalls(0),
+			mNumberOfFilteredOpenGLCalls(0)
+		#endif
+		{
+			invalidate();
+		}
+
+		inline ~OpenGLStateCache()
+		{}
+
+		/**
+		*  @brief
+		*    Forget all cached states, the next state change will always issue the OpenGL call
+		*/
+		inline void invalidate()
+		{
+			memset(mCapabilities, -1, sizeof(mCapabilities));
+			mOpenGLPolygonMode		= GL_NONE;
+			mOpenGLCullFaceMode		= GL_NONE;
+			mOpenGLFrontFaceMode	= GL_NONE;
+			mOpenGLDepthMask		= -1;
+			mOpenGLDepthFunc		= GL_NONE;
+			mOpenGLSourceBlend		= GL_NONE;
+			mOpenGLDestinationBlend	= GL_NONE;
+			invalidateTextureUnits();
+			memset(mOpenGLSamplers, 0xFF, sizeof(mOpenGLSamplers));
+			memset(mOpenGLUniformBuffers, 0xFF, sizeof(mOpenGLUniformBuffers));
+			memset(mOpenGLShaderStorageBuffers, 0xFF, sizeof(mOpenGLShaderStorageBuffers));
+		}
+
+		/**
+		*  @brief
+		*    Forget the cached texture unit bindings, to be used after OpenGL textures have been bound without using the state cache
+		*/
+		inline void invalidateTextureUnits()
+		{
+			memset(mOpenGLTextures, 0xFF, sizeof(mOpenGLTextures));
+		}
+
+		//[-------------------------------------------------------]
+		//[ Rasterizer, depth stencil and blend states            ]
+		//[-------------------------------------------------------]
+		inline void setCapability(Capability capability, bool enabled)
+		{
+			static constexpr GLenum OPENGL_CAPABILITIES[static_cast<uint8_t>(Capability::NUMBER_OF_CAPABILITIES)] =
+			{
+				GL_CULL_FACE,						// Capability::CULL_FACE
+				GL_DEPTH_CLAMP,						// Capability::DEPTH_CLAMP
+				GL_SCISSOR_TEST,					// Capability::SCISSOR_TEST
+				GL_LINE_SMOOTH,						// Capability::LINE_SMOOTH
+				GL_DEPTH_TEST,						// Capability::DEPTH_TEST
+				GL_SAMPLE_ALPHA_TO_COVERAGE_ARB,	// Capability::SAMPLE_ALPHA_TO_COVERAGE
+				GL_BLEND							// Capability::BLEND
+			};
+			if (changeState(mCapabilities[static_cast<uint8_t>(capability)], static_cast<int8_t>(enabled)))
+			{
+				if (enabled)
+				{
+					glEnable(OPENGL_CAPABILITIES[static_cast<uint8_t>(capability)]);
+				}
+				else
+				{
+					glDisable(OPENGL_CAPABILITIES[static_cast<uint8_t>(capability)]);
+				}
+			}
+		}
+
+		inline void setPolygonMode(GLenum openGLPolygonMode)
+		{
+			if (changeState(mOpenGLPolygonMode, openGLPolygonMode))
+			{
+				glPolygonMode(GL_FRONT_AND_BACK, openGLPolygonMode);
+			}
+		}
+
+		inline void setCullFace(GLenum openGLCullFaceMode)
+		{
+			if (changeState(mOpenGLCullFaceMode, openGLCullFaceMode))
+			{
+				glCullFace(openGLCullFaceMode);
+			}
+		}
+
+		inline void setFrontFace(GLenum openGLFrontFaceMode)
+		{
+			if (changeState(mOpenGLFrontFaceMode, openGLFrontFaceMode))
+			{
+				glFrontFace(openGLFrontFaceMode);
+			}
+		}
+
+		inline void setDepthMask(GLboolean openGLDepthMask)
+		{
+			if (changeState(mOpenGLDepthMask, static_cast<int8_t>(openGLDepthMask)))
+			{
+				glDepthMask(openGLDepthMask);
+			}
+		}
+
+		inline void setDepthFunc(GLenum openGLDepthFunc)
+		{
+			if (changeState(mOpenGLDepthFunc, openGLDepthFunc))
+			{
+				glDepthFunc(openGLDepthFunc);
+			}
+		}
+
+		inline void setBlendFunc(GLenum openGLSourceBlend, GLenum openGLDestinationBlend)
+		{
+			// Both blend factors are set by a single OpenGL call
+			const bool sourceBlendChanged = changeState(mOpenGLSourceBlend, openGLSourceBlend);
+			if (changeState(mOpenGLDestinationBlend, openGLDestinationBlend) || sourceBlendChanged)
+			{
+				glBlendFunc(openGLSourceBlend, openGLDestinationBlend);
+			}
+		}
+
+		//[-------------------------------------------------------]
+		//[ Bindings                                              ]
+		//[-------------------------------------------------------]
+		/**
+		*  @brief
+		*    Bind an OpenGL texture to a texture unit using "GL_ARB_direct_state_access"
+		*/
+		inline void bindTextureUnit(GLuint unit, GLuint openGLTexture)
+		{
+			if (unit >= MAXIMUM_NUMBER_OF_BINDINGS || changeState(mOpenGLTextures[unit], openGLTexture))
+			{
+				glBindTextureUnit(unit, openGLTexture);
+			}
+		}
+
+		/**
+		*  @brief
+		*    Bind an OpenGL texture to a texture unit using "GL_EXT_direct_state_access"
+		*
+		*  @note
+		*    - The texture target of an OpenGL texture never changes, so it's sufficient to shadow the OpenGL texture
+		*/
+		inline void bindMultiTexture(GLuint unit, GLenum openGLTarget, GLuint openGLTexture)
+		{
+			if (unit >= MAXIMUM_NUMBER_OF_BINDINGS || changeState(mOpenGLTextures[unit], openGLTexture))
+			{
+				// "GL_TEXTURE0_ARB" is the first texture unit, while the unit we received is zero based
+				glBindMultiTextureEXT(GL_TEXTURE0_ARB + unit, openGLTarget, openGLTexture);
+			}
+		}
+
+		inline void bindSampler(GLuint unit, GLuint openGLSampler)
+		{
+			if (unit >= MAXIMUM_NUMBER_OF_BINDINGS || changeState(mOpenGLSamplers[unit], openGLSampler))
+			{
+				glBindSampler(unit, openGLSampler);
+			}
+		}
+
+		/**
+		*  @brief
+		*    Bind an OpenGL buffer to an indexed "GL_UNIFORM_BUFFER" or "GL_SHADER_STORAGE_BUFFER" binding point
+		*/
+		inline void bindBufferBase(GLenum openGLTarget, GLuint index, GLuint openGLBuffer)
+		{
+			GLuint* openGLBuffers = (GL_UNIFORM_BUFFER == openGLTarget) ? mOpenGLUniformBuffers : mOpenGLShaderStorageBuffers;
+			if (index >= MAXIMUM_NUMBER_OF_BINDINGS || changeState(openGLBuffers[index], openGLBuffer))
+			{
+				glBindBufferBase(openGLTarget, index, openGLBuffer);
+			}
+		}
+
+		//[-------------------------------------------------------]
+		//[ Destroyed OpenGL objects                              ]
+		//[-------------------------------------------------------]
+		inline void forgetOpenGLTexture(GLuint openGLTexture)
+		{
+			forgetOpenGLObject(mOpenGLTextures, openGLTexture);
+		}
+
+		inline void forgetOpenGLSampler(GLuint openGLSampler)
+		{
+			forgetOpenGLObject(mOpenGLSamplers, openGLSampler);
+		}
+
+		inline void forgetOpenGLBuffer(GLuint openGLBuffer)
+		{
+			forgetOpenGLObject(mOpenGLUniformBuffers, openGLBuffer);
+			forgetOpenGLObject(mOpenGLShaderStorageBuffers, openGLBuffer);
+		}
+
+		//[-------------------------------------------------------]
+		//[ Statistics                                            ]
+		//[-------------------------------------------------------]
+		#ifdef RHI_STATISTICS
+			[[nodiscard]] inline uint32_t getNumberOfIssuedOpenGLCalls() const
+			{
+				return mNumberOfIssuedOpenGLCalls;
+			}
+
+			[[nodiscard]] inline uint32_t getNumberOfFilteredOpenGLCalls() const
+			{
+				return mNumberOfFilteredOpenGLCalls;
+			}
+		#endif
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		explicit OpenGLStateCache(const OpenGLStateCache& source) = delete;
+		OpenGLStateCache& operator =(const OpenGLStateCache& source) = delete;
+
+		template <typename TYPE>
+		[[nodiscard]] inline bool changeState(TYPE& cachedValue, TYPE value)
+		{
+			if (cachedValue != value)
+			{
+				cachedValue = value;
+				#ifdef RHI_STATISTICS
+					++mNumberOfIssuedOpenGLCalls;
+				#endif
+				return true;
+			}
+			#ifdef RHI_STATISTICS
+				++mNumberOfFilteredOpenGLCalls;
+			#endif
+			return false;
+		}
+
+		inline void forgetOpenGLObject(GLuint openGLObjects[MAXIMUM_NUMBER_OF_BINDINGS], GLuint openGLObject)
+		{
+			for (uint32_t i = 0; i < MAXIMUM_NUMBER_OF_BINDINGS; ++i)
+			{
+				if (openGLObjects[i] == openGLObject)
+				{
+					openGLObjects[i] = UNKNOWN_OPENGL_OBJECT;
+				}
+			}
+		}
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		static constexpr GLuint UNKNOWN_OPENGL_OBJECT = ~0u;	///< Unknown binding, zero can't be used since it's a valid binding
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		int8_t mCapabilities[static_cast<uint8_t>(Capability::NUMBER_OF_CAPABILITIES)];	///< Cached capabilities, <0 = unknown, 0 = disabled, 1 = enabled
+		GLenum mOpenGLPolygonMode;														///< Cached OpenGL polygon mode, "GL_NONE" = unknown
+		GLenum mOpenGLCullFaceMode;														///< Cached OpenGL cull face mode, "GL_NONE" = unknown
+		GLenum mOpenGLFrontFaceMode;													///< Cached OpenGL front face mode, "GL_NONE" = unknown
+		int8_t mOpenGLDepthMask;														///< Cached OpenGL depth mask, <0 = unknown
+		GLenum mOpenGLDepthFunc;														///< Cached OpenGL depth function, "GL_NONE" = unknown
+		GLenum mOpenGLSourceBlend;														///< Cached OpenGL source blend function, "GL_NONE" = unknown
+		GLenum mOpenGLDestinationBlend;													///< Cached OpenGL destination blend function, "GL_NONE" = unknown
+		GLuint mOpenGLTextures[MAXIMUM_NUMBER_OF_BINDINGS];								///< Cached OpenGL textures per texture unit, "UNKNOWN_OPENGL_OBJECT" = unknown
+		GLuint mOpenGLSamplers[MAXIMUM_NUMBER_OF_BINDINGS];								///< Cached OpenGL samplers per texture unit, "UNKNOWN_OPENGL_OBJECT" = unknown
+		GLuint mOpenGLUniformBuffers[MAXIMUM_NUMBER_OF_BINDINGS];						///< Cached OpenGL uniform buffers per binding point, "UNKNOWN_OPENGL_OBJECT" = unknown
+		GLuint mOpenGLShaderStorageBuffers[MAXIMUM_NUMBER_OF_BINDINGS];					///< Cached OpenGL shader storage buffers per binding point, "UNKNOWN_OPENGL_OBJECT" = unknown
+		#ifdef RHI_STATISTICS
+			uint32_t mNumberOfIssuedOpenGLCalls;	///< Number of OpenGL state calls which passed the state cache
+			uint32_t mNumberOfFilteredOpenGLCalls;	///< Number of redundant OpenGL state calls which were filtered by the state cache
+		#endif
+
+
+	};
+
+
+
+
 	//[-------------------------------------------------------]
 	//[ OpenGLRhi/OpenGLRhi.h                                 ]
 	//[-------------------------------------------------------]
@@ -1848,6 +2181,18 @@ namespace OpenGLRhi
 			return *mExtensions;
 		}
 
+		/**
+		*  @brief
+		*    Return the OpenGL state cache
+		*
+		*  @return
+		*    The OpenGL state cache, do not free the memory the reference is pointing to
+		*/
+		[[nodiscard]] inline OpenGLStateCache& getOpenGLStateCache()
+		{
+			return mOpenGLStateCache;
+		}
+
 		//[-------------------------------------------------------]
 		//[ Graphics                                              ]
 		//[-------------------------------------------------------]
@@ -2033,6 +2378,40 @@ namespace OpenGLRhi
 		*/
 		void updateGL_ARB_base_instanceEmulation(uint32_t startInstanceLocation);
 
+		/**
+		*  @brief
+		*    Try to coalesce a run of emulated draws into a single native multi-draw call
+		*
+		*  @param[in] drawArguments
+		*    Draw arguments of the first draw to coalesce, must be valid
+		*  @param[in] numberOfDraws
+		*    Number of remaining draws inside the draw arguments array
+		*
+		*  @return
+		*    Number of draws issued by the native multi-draw call, zero if the first draw must be issued individually
+		*
+		*  @note
+		*    - Only non-instanced draws sharing the same draw ID can be coalesced since "glMultiDrawArrays()" has no per-draw instance data
+		*/
+		[[nodiscard]] uint32_t multiDrawGraphicsEmulated(const Rhi::DrawArguments* drawArguments, uint32_t numberOfDraws);
+
+		/**
+		*  @brief
+		*    Try to coalesce a run of emulated indexed draws into a single native multi-draw call
+		*
+		*  @param[in] drawIndexedArguments
+		*    Draw indexed arguments of the first draw to coalesce, must be valid
+		*  @param[in] numberOfDraws
+		*    Number of remaining draws inside the draw indexed arguments array
+		*
+		*  @return
+		*    Number of draws issued by the native multi-draw call, zero if the first draw must be issued individually
+		*
+		*  @note
+		*    - Without "GL_ARB_draw_elements_base_vertex", draws using a base vertex location can't be coalesced
+		*/
+		[[nodiscard]] uint32_t multiDrawIndexedGraphicsEmulated(const Rhi::DrawIndexedArguments* drawIndexedArguments, uint32_t numberOfDraws);
+
 
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
@@ -2057,10 +2436,11 @@ namespace OpenGLRhi
 		// Output-merger (OM) stage
 		Rhi::IRenderTarget* mRenderTarget;	///< Currently set render target (we keep a reference to it), can be a null pointer
 		// State cache to avoid making redundant OpenGL calls
-		GLenum mOpenGLClipControlOrigin;	///< Currently set OpenGL clip control origin
-		GLuint mOpenGLProgramPipeline;		///< Currently set OpenGL program pipeline, can be zero if no resource is set
-		GLuint mOpenGLProgram;				///< Currently set OpenGL program, can be zero if no resource is set
-		GLuint mOpenGLIndirectBuffer;		///< Currently set OpenGL indirect buffer, can be zero if no resource is set
+		GLenum			 mOpenGLClipControlOrigin;	///< Currently set OpenGL clip control origin
+		GLuint			 mOpenGLProgramPipeline;	///< Currently set OpenGL program pipeline, can be zero if no resource is set
+		GLuint			 mOpenGLProgram;			///< Currently set OpenGL program, can be zero if no resource is set
+		GLuint			 mOpenGLIndirectBuffer;		///< Currently set OpenGL indirect buffer, can be zero if no resource is set
+		OpenGLStateCache mOpenGLStateCache;			///< Shadowed OpenGL rasterizer, depth stencil, blend and binding states
 		// Draw ID uniform location for "GL_ARB_base_instance"-emulation (see "17/11/2012 Surviving without gl_DrawID" - https://www.g-truc.net/post-0518.html)
 		GLuint	 mOpenGLVertexProgram;			///< Currently set OpenGL vertex program, can be zero if no resource is set
 		GLint	 mDrawIdUniformLocation;		///< Draw ID uniform location
@@ -2617,6 +2997,16 @@ namespace OpenGLRhi
 			return mGL_ARB_timer_query;
 		}
 
+		[[nodiscard]] inline bool isGL_ARB_buffer_storage() const
+		{
+			return mGL_ARB_buffer_storage;
+		}
+
+		[[nodiscard]] inline bool isGL_ARB_sync() const
+		{
+			return mGL_ARB_sync;
+		}
+
 
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
@@ -2828,6 +3218,8 @@ namespace OpenGLRhi
 			mGL_ARB_occlusion_query				 = false;
 			mGL_ARB_pipeline_statistics_query	 = false;
 			mGL_ARB_timer_query					 = false;
+			mGL_ARB_buffer_storage				 = false;
+			mGL_ARB_sync						 = false;
 		}
 
 		/**
@@ -3398,6 +3790,7 @@ namespace OpenGLRhi
 				bool result = true;	// Success by default
 				IMPORT_FUNC(glDrawElementsBaseVertex)
 				IMPORT_FUNC(glDrawElementsInstancedBaseVertex)
+				IMPORT_FUNC(glMultiDrawElementsBaseVertex)
 				mGL_ARB_draw_elements_base_vertex = result;
 			}
 
@@ -3423,8 +3816,10 @@ namespace OpenGLRhi
 				IMPORT_FUNC(glCreateTextures)
 				IMPORT_FUNC(glCreateVertexArrays)
 				IMPORT_FUNC(glNamedBufferData)
+				IMPORT_FUNC(glNamedBufferStorage)
 				IMPORT_FUNC(glNamedBufferSubData)
 				IMPORT_FUNC(glMapNamedBuffer)
+				IMPORT_FUNC(glMapNamedBufferRange)
 				IMPORT_FUNC(glUnmapNamedBuffer)
 				IMPORT_FUNC(glProgramUniform1i)
 				IMPORT_FUNC(glProgramUniform1ui)
@@ -3535,10 +3930,37 @@ namespace OpenGLRhi
 				mGL_ARB_timer_query = result;
 			}
 
+			// GL_ARB_buffer_storage - Is core since OpenGL 4.4
+			mGL_ARB_buffer_storage = isSupported("GL_ARB_buffer_storage");
+			if (mGL_ARB_buffer_storage)
+			{
+				// Load the entry points
+				bool result = true;	// Success by default
+				IMPORT_FUNC(glBufferStorage)
+				mGL_ARB_buffer_storage = result;
+			}
+
+			// GL_ARB_sync - Is core since OpenGL 3.2
+			mGL_ARB_sync = isCoreProfile ? true : isSupported("GL_ARB_sync");
+			if (mGL_ARB_sync)
+			{
+				// Load the entry points
+				bool result = true;	// Success by default
+				IMPORT_FUNC(glFenceSync)
+				IMPORT_FUNC(glDeleteSync)
+				IMPORT_FUNC(glClientWaitSync)
+				mGL_ARB_sync = result;
+			}
+
 
 			//[-------------------------------------------------------]
 			//[ Core (OpenGL version dependent)                       ]
 			//[-------------------------------------------------------]
+			{
+				[[maybe_unused]] bool result = true;	// Success by default
+				IMPORT_FUNC(glMultiDrawArrays)		// OpenGL 1.4
+				IMPORT_FUNC(glMultiDrawElements)	// OpenGL 1.4
+			}
 			{
 				[[maybe_unused]] bool result = true;	// Success by default
 				IMPORT_FUNC(glShaderBinary)	// OpenGL 4.1
@@ -3612,6 +4034,8 @@ namespace OpenGLRhi
 		bool mGL_ARB_occlusion_query;
 		bool mGL_ARB_pipeline_statistics_query;
 		bool mGL_ARB_timer_query;
+		bool mGL_ARB_buffer_storage;
+		bool mGL_ARB_sync;
 
 
 	};
@@ -4779,7 +5203,9 @@ namespace OpenGLRhi
 				4,	// Rhi::VertexAttributeFormat::R8G8B8A8_UINT
 				2,	// Rhi::VertexAttributeFormat::SHORT_2
 				4,	// Rhi::VertexAttributeFormat::SHORT_4
-				1	// Rhi::VertexAttributeFormat::UINT_1
+				1,	// Rhi::VertexAttributeFormat::UINT_1
+				2,	// Rhi::VertexAttributeFormat::HALF_2
+				4	// Rhi::VertexAttributeFormat::SHORT_4_SNORM
 			};
 			return MAPPING[static_cast<int>(vertexAttributeFormat)];
 		}
@@ -4806,7 +5232,9 @@ namespace OpenGLRhi
 				GL_UNSIGNED_BYTE,	// Rhi::VertexAttributeFormat::R8G8B8A8_UINT
 				GL_SHORT,			// Rhi::VertexAttributeFormat::SHORT_2
 				GL_SHORT,			// Rhi::VertexAttributeFormat::SHORT_4
-				GL_UNSIGNED_INT		// Rhi::VertexAttributeFormat::UINT_1
+				GL_UNSIGNED_INT,	// Rhi::VertexAttributeFormat::UINT_1
+				GL_HALF_FLOAT,		// Rhi::VertexAttributeFormat::HALF_2
+				GL_SHORT			// Rhi::VertexAttributeFormat::SHORT_4_SNORM
 			};
 			return MAPPING[static_cast<int>(vertexAttributeFormat)];
 		}
@@ -4833,7 +5261,9 @@ namespace OpenGLRhi
 				GL_FALSE,	// Rhi::VertexAttributeFormat::R8G8B8A8_UINT
 				GL_FALSE,	// Rhi::VertexAttributeFormat::SHORT_2
 				GL_FALSE,	// Rhi::VertexAttributeFormat::SHORT_4
-				GL_FALSE	// Rhi::VertexAttributeFormat::UINT_1
+				GL_FALSE,	// Rhi::VertexAttributeFormat::UINT_1
+				GL_FALSE,	// Rhi::VertexAttributeFormat::HALF_2
+				GL_TRUE		// Rhi::VertexAttributeFormat::SHORT_4_SNORM
 			};
 			return MAPPING[static_cast<int>(vertexAttributeFormat)];
 		}
@@ -4860,7 +5290,9 @@ namespace OpenGLRhi
 				GL_TRUE,	// Rhi::VertexAttributeFormat::R8G8B8A8_UINT
 				GL_TRUE,	// Rhi::VertexAttributeFormat::SHORT_2
 				GL_TRUE,	// Rhi::VertexAttributeFormat::SHORT_4
-				GL_TRUE		// Rhi::VertexAttributeFormat::UINT_1
+				GL_TRUE,	// Rhi::VertexAttributeFormat::UINT_1
+				GL_FALSE,	// Rhi::VertexAttributeFormat::HALF_2
+				GL_FALSE	// Rhi::VertexAttributeFormat::SHORT_4_SNORM
 			};
 			return MAPPING[static_cast<int>(vertexAttributeFormat)];
 		}
@@ -5502,6 +5934,7 @@ namespace OpenGLRhi
 			// Destroy the OpenGL array buffer
 			// -> Silently ignores 0's and names that do not correspond to existing buffer objects
 			glDeleteBuffersARB(1, &mOpenGLArrayBuffer);
+			static_cast<OpenGLRhi&>(getRhi()).getOpenGLStateCache().forgetOpenGLBuffer(mOpenGLArrayBuffer);
 		}
 
 		/**
@@ -5595,6 +6028,11 @@ namespace OpenGLRhi
 		VertexBufferBind(OpenGLRhi& openGLRhi, uint32_t numberOfBytes, const void* data, Rhi::BufferUsage bufferUsage RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
 			VertexBuffer(openGLRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsNumberOfBytes(numberOfBytes);
+			#endif
+
 			#ifdef RHI_OPENGL_STATE_CLEANUP
 				// Backup the currently bound OpenGL array buffer
 				GLint openGLArrayBufferBackup = 0;
@@ -5676,6 +6114,11 @@ namespace OpenGLRhi
 		VertexBufferDsa(OpenGLRhi& openGLRhi, uint32_t numberOfBytes, const void* data, Rhi::BufferUsage bufferUsage RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
 			VertexBuffer(openGLRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsNumberOfBytes(numberOfBytes);
+			#endif
+
 			if (openGLRhi.getExtensions().isGL_ARB_direct_state_access())
 			{
 				// Create the OpenGL array buffer
@@ -5750,6 +6193,7 @@ namespace OpenGLRhi
 			// Destroy the OpenGL element array buffer
 			// -> Silently ignores 0's and names that do not correspond to existing buffer objects
 			glDeleteBuffersARB(1, &mOpenGLElementArrayBuffer);
+			static_cast<OpenGLRhi&>(getRhi()).getOpenGLStateCache().forgetOpenGLBuffer(mOpenGLElementArrayBuffer);
 		}
 
 		/**
@@ -5875,6 +6319,11 @@ namespace OpenGLRhi
 		IndexBufferBind(OpenGLRhi& openGLRhi, uint32_t numberOfBytes, const void* data, Rhi::BufferUsage bufferUsage, Rhi::IndexBufferFormat::Enum indexBufferFormat RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
 			IndexBuffer(openGLRhi, indexBufferFormat RHI_RESOURCE_DEBUG_PASS_PARAMETER)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsNumberOfBytes(numberOfBytes);
+			#endif
+
 			#ifdef RHI_OPENGL_STATE_CLEANUP
 				// Backup the currently bound OpenGL element array buffer
 				GLint openGLElementArrayBufferBackup = 0;
@@ -5958,6 +6407,11 @@ namespace OpenGLRhi
 		IndexBufferDsa(OpenGLRhi& openGLRhi, uint32_t numberOfBytes, const void* data, Rhi::BufferUsage bufferUsage, Rhi::IndexBufferFormat::Enum indexBufferFormat RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
 			IndexBuffer(openGLRhi, indexBufferFormat RHI_RESOURCE_DEBUG_PASS_PARAMETER)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsNumberOfBytes(numberOfBytes);
+			#endif
+
 			if (openGLRhi.getExtensions().isGL_ARB_direct_state_access())
 			{
 				// Create the OpenGL element array buffer
@@ -6836,10 +7290,12 @@ namespace OpenGLRhi
 			// Destroy the OpenGL texture instance
 			// -> Silently ignores 0's and names that do not correspond to existing textures
 			glDeleteTextures(1, &mOpenGLTexture);
+			static_cast<OpenGLRhi&>(getRhi()).getOpenGLStateCache().forgetOpenGLTexture(mOpenGLTexture);
 
 			// Destroy the OpenGL texture buffer
 			// -> Silently ignores 0's and names that do not correspond to existing buffer objects
 			glDeleteBuffersARB(1, &mOpenGLTextureBuffer);
+			static_cast<OpenGLRhi&>(getRhi()).getOpenGLStateCache().forgetOpenGLBuffer(mOpenGLTextureBuffer);
 		}
 
 		/**
@@ -6965,6 +7421,11 @@ namespace OpenGLRhi
 		TextureBufferBind(OpenGLRhi& openGLRhi, uint32_t numberOfBytes, const void* data, Rhi::BufferUsage bufferUsage, Rhi::TextureFormat::Enum textureFormat RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
 			TextureBuffer(openGLRhi, textureFormat RHI_RESOURCE_DEBUG_PASS_PARAMETER)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsNumberOfBytes(numberOfBytes);
+			#endif
+
 			{ // Buffer part
 				#ifdef RHI_OPENGL_STATE_CLEANUP
 					// Backup the currently bound OpenGL texture buffer
@@ -7073,6 +7534,11 @@ namespace OpenGLRhi
 		TextureBufferDsa(OpenGLRhi& openGLRhi, uint32_t numberOfBytes, const void* data, Rhi::BufferUsage bufferUsage, Rhi::TextureFormat::Enum textureFormat RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
 			TextureBuffer(openGLRhi, textureFormat RHI_RESOURCE_DEBUG_PASS_PARAMETER)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsNumberOfBytes(numberOfBytes);
+			#endif
+
 			if (openGLRhi.getExtensions().isGL_ARB_direct_state_access())
 			{
 				{ // Buffer part
@@ -7122,6 +7588,9 @@ namespace OpenGLRhi
 					#ifdef RHI_OPENGL_STATE_CLEANUP
 						// Be polite and restore the previous bound OpenGL texture
 						glBindTexture(GL_TEXTURE_BUFFER_ARB, static_cast<GLuint>(openGLTextureBackup));
+					#else
+						// The OpenGL texture bound to the active texture unit was changed without using the OpenGL state cache
+						openGLRhi.getOpenGLStateCache().invalidateTextureUnits();
 					#endif
 				}
 			}
@@ -7182,6 +7651,7 @@ namespace OpenGLRhi
 			// Destroy the OpenGL structured buffer
 			// -> Silently ignores 0's and names that do not correspond to existing buffer objects
 			glDeleteBuffersARB(1, &mOpenGLStructuredBuffer);
+			static_cast<OpenGLRhi&>(getRhi()).getOpenGLStateCache().forgetOpenGLBuffer(mOpenGLStructuredBuffer);
 		}
 
 		/**
@@ -7275,6 +7745,11 @@ namespace OpenGLRhi
 		StructuredBufferBind(OpenGLRhi& openGLRhi, uint32_t numberOfBytes, const void* data, Rhi::BufferUsage bufferUsage RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
 			StructuredBuffer(openGLRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsNumberOfBytes(numberOfBytes);
+			#endif
+
 			#ifdef RHI_OPENGL_STATE_CLEANUP
 				// Backup the currently bound OpenGL structured buffer
 				GLint openGLStructuredBufferBackup = 0;
@@ -7356,50 +7831,301 @@ namespace OpenGLRhi
 		StructuredBufferDsa(OpenGLRhi& openGLRhi, uint32_t numberOfBytes, const void* data, Rhi::BufferUsage bufferUsage RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
 			StructuredBuffer(openGLRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsNumberOfBytes(numberOfBytes);
+			#endif
+
 			if (openGLRhi.getExtensions().isGL_ARB_direct_state_access())
 			{
-				// Create the OpenGL structured buffer
-				glCreateBuffers(1, &mOpenGLStructuredBuffer);
+				// Create the OpenGL structured buffer
+				glCreateBuffers(1, &mOpenGLStructuredBuffer);
+
+				// Upload the data
+				// -> Usage: These constants directly map to "GL_ARB_vertex_buffer_object" and OpenGL ES 3 constants, do not change them
+				glNamedBufferData(mOpenGLStructuredBuffer, static_cast<GLsizeiptr>(numberOfBytes), data, static_cast<GLenum>(bufferUsage));
+			}
+			else
+			{
+				// Create the OpenGL structured buffer
+				glGenBuffersARB(1, &mOpenGLStructuredBuffer);
+
+				// Buffer part
+				// -> Upload the data
+				// -> Usage: These constants directly map to "GL_ARB_vertex_buffer_object" and OpenGL ES 3 constants, do not change them
+				glNamedBufferDataEXT(mOpenGLStructuredBuffer, static_cast<GLsizeiptr>(numberOfBytes), data, static_cast<GLenum>(bufferUsage));
+			}
+
+			// Assign a default name to the resource for debugging purposes
+			#ifdef RHI_DEBUG
+				if (openGLRhi.getExtensions().isGL_KHR_debug())
+				{
+					RHI_DECORATED_DEBUG_NAME(debugName, detailedDebugName, "SBO", 6)	// 6 = "SBO: " including terminating zero
+					glObjectLabel(GL_BUFFER, mOpenGLStructuredBuffer, -1, detailedDebugName);
+				}
+			#endif
+		}
+
+		/**
+		*  @brief
+		*    Destructor
+		*/
+		inline virtual ~StructuredBufferDsa() override
+		{}
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		explicit StructuredBufferDsa(const StructuredBufferDsa& source) = delete;
+		StructuredBufferDsa& operator =(const StructuredBufferDsa& source) = delete;
+
+
+	};
+
+
+
+
+	//[-------------------------------------------------------]
+	//[ OpenGLRhi/Buffer/PersistentMappedBuffer.h             ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Persistent mapped OpenGL buffer helper class for dynamic buffers which are updated frequently
+	*
+	*  @remarks
+	*    Instead of mapping and unmapping the OpenGL buffer on each update, which forces the OpenGL driver to synchronize, there are
+	*    "NUMBER_OF_REGIONS" OpenGL buffers created by using "GL_ARB_buffer_storage" which stay persistent and coherent mapped during
+	*    their whole lifetime. Each "Rhi::MapType::WRITE_DISCARD" fences the current region and moves on to the next one, the CPU only
+	*    has to wait in case the GPU is still using the next region.
+	*
+	*  @note
+	*    - The OpenGL buffer of the current region changes after each "Rhi::MapType::WRITE_DISCARD", so it must be fetched for each binding
+	*/
+	class PersistentMappedBuffer final
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Public definitions                                    ]
+	//[-------------------------------------------------------]
+	public:
+		static constexpr uint32_t NUMBER_OF_REGIONS = 3;	///< Triple buffering: One region for the CPU, one for the GPU and one for the OpenGL driver queue
+
+
+	//[-------------------------------------------------------]
+	//[ Public static methods                                 ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Return whether or not persistent mapped buffers are supported and useful for the given buffer usage
+		*
+		*  @param[in] extensions
+		*    Available OpenGL extensions
+		*  @param[in] bufferUsage
+		*    Indication of the buffer usage
+		*
+		*  @return
+		*    "true" if a persistent mapped buffer should be used, else "false"
+		*/
+		[[nodiscard]] static inline bool isSupported(const Extensions& extensions, Rhi::BufferUsage bufferUsage)
+		{
+			return ((Rhi::BufferUsage::STREAM_DRAW == bufferUsage || Rhi::BufferUsage::DYNAMIC_DRAW == bufferUsage) && extensions.isGL_ARB_direct_state_access() && extensions.isGL_ARB_buffer_storage() && extensions.isGL_ARB_sync());
+		}
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		inline PersistentMappedBuffer() :
+			mCurrentRegion(0)
+		{
+			memset(mOpenGLBuffers, 0, sizeof(mOpenGLBuffers));
+			memset(mMappedData, 0, sizeof(mMappedData));
+			memset(mOpenGLSyncs, 0, sizeof(mOpenGLSyncs));
+		}
+
+		/**
+		*  @brief
+		*    Destructor
+		*
+		*  @note
+		*    - The owner has to call "destroy()" while the OpenGL context is still there
+		*/
+		inline ~PersistentMappedBuffer()
+		{}
+
+		/**
+		*  @brief
+		*    Create the persistent mapped OpenGL buffers
+		*
+		*  @param[in] numberOfBytes
+		*    Number of bytes within the buffer, must be valid
+		*  @param[in] data
+		*    Buffer data, can be a null pointer (empty buffer), the data is internally copied into each region
+		*
+		*  @return
+		*    The OpenGL buffer of the current region
+		*/
+		GLuint create(uint32_t numberOfBytes, const void* data)
+		{
+			static constexpr GLbitfield OPENGL_FLAGS = GL_MAP_READ_BIT | GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+			glCreateBuffers(NUMBER_OF_REGIONS, mOpenGLBuffers);
+			for (uint32_t region = 0; region < NUMBER_OF_REGIONS; ++region)
+			{
+				glNamedBufferStorage(mOpenGLBuffers[region], static_cast<GLsizeiptr>(numberOfBytes), data, OPENGL_FLAGS);
+				mMappedData[region] = glMapNamedBufferRange(mOpenGLBuffers[region], 0, static_cast<GLsizeiptr>(numberOfBytes), OPENGL_FLAGS);
+			}
+			return mOpenGLBuffers[mCurrentRegion];
+		}
+
+		/**
+		*  @brief
+		*    Destroy the persistent mapped OpenGL buffers
+		*
+		*  @param[in] openGLStateCache
+		*    OpenGL state cache which must forget about the destroyed OpenGL buffers
+		*/
+		void destroy(OpenGLStateCache& openGLStateCache)
+		{
+			for (uint32_t region = 0; region < NUMBER_OF_REGIONS; ++region)
+			{
+				if (nullptr != mOpenGLSyncs[region])
+				{
+					glDeleteSync(mOpenGLSyncs[region]);
+					mOpenGLSyncs[region] = nullptr;
+				}
+				openGLStateCache.forgetOpenGLBuffer(mOpenGLBuffers[region]);
+			}
+
+			// Destroying a mapped OpenGL buffer implicitly unmaps it
+			// -> Silently ignores 0's and names that do not correspond to existing buffer objects
+			glDeleteBuffersARB(NUMBER_OF_REGIONS, mOpenGLBuffers);
+			memset(mOpenGLBuffers, 0, sizeof(mOpenGLBuffers));
+			memset(mMappedData, 0, sizeof(mMappedData));
+		}
+
+		/**
+		*  @brief
+		*    Return whether or not the persistent mapped OpenGL buffers have been created
+		*/
+		[[nodiscard]] inline bool isCreated() const
+		{
+			return (0 != mOpenGLBuffers[0]);
+		}
+
+		/**
+		*  @brief
+		*    Return the OpenGL buffer of the current region
+		*
+		*  @return
+		*    The OpenGL buffer of the current region, can be zero if no resource is allocated, do not destroy the returned resource
+		*/
+		[[nodiscard]] inline GLuint getOpenGLBuffer() const
+		{
+			return mOpenGLBuffers[mCurrentRegion];
+		}
+
+		#ifdef RHI_DEBUG
+			/**
+			*  @brief
+			*    Assign the given debug name to the OpenGL buffers of all regions
+			*/
+			void setDebugName(const char* debugName) const
+			{
+				for (uint32_t region = 0; region < NUMBER_OF_REGIONS; ++region)
+				{
+					glObjectLabel(GL_BUFFER, mOpenGLBuffers[region], -1, debugName);
+				}
+			}
+		#endif
+
+		/**
+		*  @brief
+		*    Map the persistent mapped OpenGL buffer
+		*
+		*  @param[in] mapType
+		*    Map type
+		*  @param[out] mappedSubresource
+		*    Receives the mapped subresource information
+		*
+		*  @return
+		*    "true" if all went fine, else "false"
+		*
+		*  @note
+		*    - There's no need to unmap since the OpenGL buffers stay mapped
+		*/
+		[[nodiscard]] bool map(Rhi::MapType mapType, Rhi::MappedSubresource& mappedSubresource)
+		{
+			switch (mapType)
+			{
+				case Rhi::MapType::WRITE_DISCARD:
+					// Fence all OpenGL commands issued so far which might use the current region and move on to the next region
+					mOpenGLSyncs[mCurrentRegion] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+					mCurrentRegion = (mCurrentRegion + 1) % NUMBER_OF_REGIONS;
+					waitForRegion(mCurrentRegion);
+					break;
 
-				// Upload the data
-				// -> Usage: These constants directly map to "GL_ARB_vertex_buffer_object" and OpenGL ES 3 constants, do not change them
-				glNamedBufferData(mOpenGLStructuredBuffer, static_cast<GLsizeiptr>(numberOfBytes), data, static_cast<GLenum>(bufferUsage));
-			}
-			else
-			{
-				// Create the OpenGL structured buffer
-				glGenBuffersARB(1, &mOpenGLStructuredBuffer);
+				case Rhi::MapType::WRITE_NO_OVERWRITE:
+					// The caller promises to not overwrite data the GPU might still be using
+					break;
 
-				// Buffer part
-				// -> Upload the data
-				// -> Usage: These constants directly map to "GL_ARB_vertex_buffer_object" and OpenGL ES 3 constants, do not change them
-				glNamedBufferDataEXT(mOpenGLStructuredBuffer, static_cast<GLsizeiptr>(numberOfBytes), data, static_cast<GLenum>(bufferUsage));
+				case Rhi::MapType::READ:
+				case Rhi::MapType::READ_WRITE:
+				case Rhi::MapType::WRITE:
+				default:
+					// The GPU must have finished using the current region, that's what "glMapBuffer()" would synchronize as well
+					if (nullptr == mOpenGLSyncs[mCurrentRegion])
+					{
+						mOpenGLSyncs[mCurrentRegion] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+					}
+					waitForRegion(mCurrentRegion);
+					break;
 			}
+			mappedSubresource.data		 = mMappedData[mCurrentRegion];
+			mappedSubresource.rowPitch   = 0;
+			mappedSubresource.depthPitch = 0;
 
-			// Assign a default name to the resource for debugging purposes
-			#ifdef RHI_DEBUG
-				if (openGLRhi.getExtensions().isGL_KHR_debug())
+			// Done
+			return (nullptr != mappedSubresource.data);
+		}
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		explicit PersistentMappedBuffer(const PersistentMappedBuffer& source) = delete;
+		PersistentMappedBuffer& operator =(const PersistentMappedBuffer& source) = delete;
+
+		void waitForRegion(uint32_t region)
+		{
+			GLsync& openGLSync = mOpenGLSyncs[region];
+			if (nullptr != openGLSync)
+			{
+				// Flush the OpenGL command queue with the first wait, else the fence might never be signaled
+				GLbitfield openGLWaitFlags = GL_SYNC_FLUSH_COMMANDS_BIT;
+				while (GL_TIMEOUT_EXPIRED == glClientWaitSync(openGLSync, openGLWaitFlags, 1000000))	// Timeout in nanoseconds: 1 millisecond
 				{
-					RHI_DECORATED_DEBUG_NAME(debugName, detailedDebugName, "SBO", 6)	// 6 = "SBO: " including terminating zero
-					glObjectLabel(GL_BUFFER, mOpenGLStructuredBuffer, -1, detailedDebugName);
+					openGLWaitFlags = 0;
 				}
-			#endif
+				glDeleteSync(openGLSync);
+				openGLSync = nullptr;
+			}
 		}
 
-		/**
-		*  @brief
-		*    Destructor
-		*/
-		inline virtual ~StructuredBufferDsa() override
-		{}
-
 
 	//[-------------------------------------------------------]
-	//[ Private methods                                       ]
+	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
-		explicit StructuredBufferDsa(const StructuredBufferDsa& source) = delete;
-		StructuredBufferDsa& operator =(const StructuredBufferDsa& source) = delete;
+		uint32_t mCurrentRegion;					///< Index of the current region the CPU is writing into
+		GLuint	 mOpenGLBuffers[NUMBER_OF_REGIONS];	///< OpenGL buffer per region, zero if not created
+		void*	 mMappedData[NUMBER_OF_REGIONS];	///< Persistent and coherent mapped data per region, null pointer if not created
+		GLsync	 mOpenGLSyncs[NUMBER_OF_REGIONS];	///< OpenGL fence per region protecting OpenGL commands which might still use the region, null pointer if there's nothing to wait for
 
 
 	};
@@ -7428,9 +8154,18 @@ namespace OpenGLRhi
 		*/
 		inline virtual ~IndirectBuffer() override
 		{
-			// Destroy the OpenGL indirect buffer
-			// -> Silently ignores 0's and names that do not correspond to existing buffer objects
-			glDeleteBuffersARB(1, &mOpenGLIndirectBuffer);
+			if (mPersistentMappedBuffer.isCreated())
+			{
+				// Destroy the persistent mapped OpenGL indirect buffers
+				mPersistentMappedBuffer.destroy(static_cast<OpenGLRhi&>(getRhi()).getOpenGLStateCache());
+			}
+			else
+			{
+				// Destroy the OpenGL indirect buffer
+				// -> Silently ignores 0's and names that do not correspond to existing buffer objects
+				glDeleteBuffersARB(1, &mOpenGLIndirectBuffer);
+				static_cast<OpenGLRhi&>(getRhi()).getOpenGLStateCache().forgetOpenGLBuffer(mOpenGLIndirectBuffer);
+			}
 		}
 
 		/**
@@ -7445,6 +8180,41 @@ namespace OpenGLRhi
 			return mOpenGLIndirectBuffer;
 		}
 
+		/**
+		*  @brief
+		*    Return whether or not the OpenGL indirect buffer is persistent mapped
+		*
+		*  @return
+		*    "true" if the OpenGL indirect buffer is persistent mapped, else "false"
+		*/
+		[[nodiscard]] inline bool isPersistentMapped() const
+		{
+			return mPersistentMappedBuffer.isCreated();
+		}
+
+		/**
+		*  @brief
+		*    Map the persistent mapped OpenGL indirect buffer
+		*
+		*  @param[in] mapType
+		*    Map type
+		*  @param[out] mappedSubresource
+		*    Receives the mapped subresource information
+		*
+		*  @return
+		*    "true" if all went fine, else "false"
+		*
+		*  @note
+		*    - Only valid if "isPersistentMapped()" returns "true", there's no need to unmap
+		*/
+		[[nodiscard]] inline bool mapPersistent(Rhi::MapType mapType, Rhi::MappedSubresource& mappedSubresource)
+		{
+			// The OpenGL indirect buffer changes when moving on to the next region
+			const bool result = mPersistentMappedBuffer.map(mapType, mappedSubresource);
+			mOpenGLIndirectBuffer = mPersistentMappedBuffer.getOpenGLBuffer();
+			return result;
+		}
+
 
 	//[-------------------------------------------------------]
 	//[ Public virtual Rhi::IIndirectBuffer methods           ]
@@ -7487,7 +8257,8 @@ namespace OpenGLRhi
 	//[ Protected data                                        ]
 	//[-------------------------------------------------------]
 	protected:
-		GLuint mOpenGLIndirectBuffer;	///< OpenGL indirect buffer, can be zero if no resource is allocated
+		GLuint				   mOpenGLIndirectBuffer;	///< OpenGL indirect buffer, can be zero if no resource is allocated
+		PersistentMappedBuffer mPersistentMappedBuffer;	///< Persistent mapped OpenGL indirect buffers, only created for dynamic buffers if "GL_ARB_buffer_storage" is available
 
 
 	//[-------------------------------------------------------]
@@ -7534,6 +8305,11 @@ namespace OpenGLRhi
 		IndirectBufferBind(OpenGLRhi& openGLRhi, uint32_t numberOfBytes, const void* data, Rhi::BufferUsage bufferUsage RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
 			IndirectBuffer(openGLRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsNumberOfBytes(numberOfBytes);
+			#endif
+
 			#ifdef RHI_OPENGL_STATE_CLEANUP
 				// Backup the currently bound OpenGL indirect buffer
 				GLint openGLIndirectBufferBackup = 0;
@@ -7615,7 +8391,17 @@ namespace OpenGLRhi
 		IndirectBufferDsa(OpenGLRhi& openGLRhi, uint32_t numberOfBytes, const void* data, Rhi::BufferUsage bufferUsage RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
 			IndirectBuffer(openGLRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER)
 		{
-			if (openGLRhi.getExtensions().isGL_ARB_direct_state_access())
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsNumberOfBytes(numberOfBytes);
+			#endif
+
+			if (PersistentMappedBuffer::isSupported(openGLRhi.getExtensions(), bufferUsage))
+			{
+				// Create the persistent mapped OpenGL indirect buffers, avoids driver synchronization on each update
+				mOpenGLIndirectBuffer = mPersistentMappedBuffer.create(numberOfBytes, data);
+			}
+			else if (openGLRhi.getExtensions().isGL_ARB_direct_state_access())
 			{
 				// Create the OpenGL indirect buffer
 				glCreateBuffers(1, &mOpenGLIndirectBuffer);
@@ -7639,7 +8425,14 @@ namespace OpenGLRhi
 				if (openGLRhi.getExtensions().isGL_KHR_debug())
 				{
 					RHI_DECORATED_DEBUG_NAME(debugName, detailedDebugName, "IndirectBufferObject", 23)	// 23 = "IndirectBufferObject: " including terminating zero
-					glObjectLabel(GL_BUFFER, mOpenGLIndirectBuffer, -1, detailedDebugName);
+					if (mPersistentMappedBuffer.isCreated())
+					{
+						mPersistentMappedBuffer.setDebugName(detailedDebugName);
+					}
+					else
+					{
+						glObjectLabel(GL_BUFFER, mOpenGLIndirectBuffer, -1, detailedDebugName);
+					}
 				}
 			#endif
 		}
@@ -7686,9 +8479,18 @@ namespace OpenGLRhi
 		*/
 		inline virtual ~UniformBuffer() override
 		{
-			// Destroy the OpenGL uniform buffer
-			// -> Silently ignores 0's and names that do not correspond to existing buffer objects
-			glDeleteBuffersARB(1, &mOpenGLUniformBuffer);
+			if (mPersistentMappedBuffer.isCreated())
+			{
+				// Destroy the persistent mapped OpenGL uniform buffers
+				mPersistentMappedBuffer.destroy(static_cast<OpenGLRhi&>(getRhi()).getOpenGLStateCache());
+			}
+			else
+			{
+				// Destroy the OpenGL uniform buffer
+				// -> Silently ignores 0's and names that do not correspond to existing buffer objects
+				glDeleteBuffersARB(1, &mOpenGLUniformBuffer);
+				static_cast<OpenGLRhi&>(getRhi()).getOpenGLStateCache().forgetOpenGLBuffer(mOpenGLUniformBuffer);
+			}
 		}
 
 		/**
@@ -7703,6 +8505,41 @@ namespace OpenGLRhi
 			return mOpenGLUniformBuffer;
 		}
 
+		/**
+		*  @brief
+		*    Return whether or not the OpenGL uniform buffer is persistent mapped
+		*
+		*  @return
+		*    "true" if the OpenGL uniform buffer is persistent mapped, else "false"
+		*/
+		[[nodiscard]] inline bool isPersistentMapped() const
+		{
+			return mPersistentMappedBuffer.isCreated();
+		}
+
+		/**
+		*  @brief
+		*    Map the persistent mapped OpenGL uniform buffer
+		*
+		*  @param[in] mapType
+		*    Map type
+		*  @param[out] mappedSubresource
+		*    Receives the mapped subresource information
+		*
+		*  @return
+		*    "true" if all went fine, else "false"
+		*
+		*  @note
+		*    - Only valid if "isPersistentMapped()" returns "true", there's no need to unmap
+		*/
+		[[nodiscard]] inline bool mapPersistent(Rhi::MapType mapType, Rhi::MappedSubresource& mappedSubresource)
+		{
+			// The OpenGL uniform buffer changes when moving on to the next region
+			const bool result = mPersistentMappedBuffer.map(mapType, mappedSubresource);
+			mOpenGLUniformBuffer = mPersistentMappedBuffer.getOpenGLBuffer();
+			return result;
+		}
+
 
 	//[-------------------------------------------------------]
 	//[ Protected virtual Rhi::RefCount methods               ]
@@ -7735,7 +8572,8 @@ namespace OpenGLRhi
 	//[ Protected data                                        ]
 	//[-------------------------------------------------------]
 	protected:
-		GLuint mOpenGLUniformBuffer;	///< OpenGL uniform buffer, can be zero if no resource is allocated
+		GLuint				   mOpenGLUniformBuffer;	///< OpenGL uniform buffer, can be zero if no resource is allocated
+		PersistentMappedBuffer mPersistentMappedBuffer;	///< Persistent mapped OpenGL uniform buffers, only created for dynamic buffers if "GL_ARB_buffer_storage" is available
 
 
 	//[-------------------------------------------------------]
@@ -7782,6 +8620,11 @@ namespace OpenGLRhi
 		UniformBufferBind(OpenGLRhi& openGLRhi, uint32_t numberOfBytes, const void* data, Rhi::BufferUsage bufferUsage RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
 			UniformBuffer(openGLRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsNumberOfBytes(numberOfBytes);
+			#endif
+
 			// TODO(co) Review OpenGL uniform buffer alignment topic
 
 			#ifdef RHI_OPENGL_STATE_CLEANUP
@@ -7865,9 +8708,19 @@ namespace OpenGLRhi
 		UniformBufferDsa(OpenGLRhi& openGLRhi, uint32_t numberOfBytes, const void* data, Rhi::BufferUsage bufferUsage RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
 			UniformBuffer(openGLRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsNumberOfBytes(numberOfBytes);
+			#endif
+
 			// TODO(co) Review OpenGL uniform buffer alignment topic
 
-			if (openGLRhi.getExtensions().isGL_ARB_direct_state_access())
+			if (PersistentMappedBuffer::isSupported(openGLRhi.getExtensions(), bufferUsage))
+			{
+				// Create the persistent mapped OpenGL uniform buffers, avoids driver synchronization on each update
+				mOpenGLUniformBuffer = mPersistentMappedBuffer.create(numberOfBytes, data);
+			}
+			else if (openGLRhi.getExtensions().isGL_ARB_direct_state_access())
 			{
 				// Create the OpenGL uniform buffer
 				glCreateBuffers(1, &mOpenGLUniformBuffer);
@@ -7891,7 +8744,14 @@ namespace OpenGLRhi
 				if (openGLRhi.getExtensions().isGL_KHR_debug())
 				{
 					RHI_DECORATED_DEBUG_NAME(debugName, detailedDebugName, "UBO", 6)	// 6 = "UBO: " including terminating zero
-					glObjectLabel(GL_BUFFER, mOpenGLUniformBuffer, -1, detailedDebugName);
+					if (mPersistentMappedBuffer.isCreated())
+					{
+						mPersistentMappedBuffer.setDebugName(detailedDebugName);
+					}
+					else
+					{
+						glObjectLabel(GL_BUFFER, mOpenGLUniformBuffer, -1, detailedDebugName);
+					}
 				}
 			#endif
 		}
@@ -8243,6 +9103,7 @@ namespace OpenGLRhi
 			// Destroy the OpenGL texture instance
 			// -> Silently ignores 0's and names that do not correspond to existing textures
 			glDeleteTextures(1, &mOpenGLTexture);
+			static_cast<OpenGLRhi&>(getRhi()).getOpenGLStateCache().forgetOpenGLTexture(mOpenGLTexture);
 		}
 
 		/**
@@ -8366,6 +9227,11 @@ namespace OpenGLRhi
 		Texture1DBind(OpenGLRhi& openGLRhi, uint32_t width, Rhi::TextureFormat::Enum textureFormat, const void* data, uint32_t textureFlags RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
 			Texture1D(openGLRhi, width, textureFormat RHI_RESOURCE_DEBUG_PASS_PARAMETER)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsTextureDescription(textureFormat, textureFlags, width);
+			#endif
+
 			// Sanity checks
 			RHI_ASSERT(openGLRhi.getContext(), 0 == (textureFlags & Rhi::TextureFlag::DATA_CONTAINS_MIPMAPS) || nullptr != data, "Invalid OpenGL texture parameters")
 			RHI_ASSERT(openGLRhi.getContext(), (textureFlags & Rhi::TextureFlag::RENDER_TARGET) == 0 || nullptr == data, "OpenGL render target textures can't be filled using provided data")
@@ -8530,6 +9396,11 @@ namespace OpenGLRhi
 		Texture1DDsa(OpenGLRhi& openGLRhi, uint32_t width, Rhi::TextureFormat::Enum textureFormat, const void* data, uint32_t textureFlags RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
 			Texture1D(openGLRhi, width, textureFormat RHI_RESOURCE_DEBUG_PASS_PARAMETER)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsTextureDescription(textureFormat, textureFlags, width);
+			#endif
+
 			// Sanity checks
 			RHI_ASSERT(openGLRhi.getContext(), 0 == (textureFlags & Rhi::TextureFlag::DATA_CONTAINS_MIPMAPS) || nullptr != data, "Invalid OpenGL texture parameters")
 			RHI_ASSERT(openGLRhi.getContext(), (textureFlags & Rhi::TextureFlag::RENDER_TARGET) == 0 || nullptr == data, "OpenGL render target textures can't be filled using provided data")
@@ -8746,6 +9617,7 @@ namespace OpenGLRhi
 			// Destroy the OpenGL texture instance
 			// -> Silently ignores 0's and names that do not correspond to existing textures
 			glDeleteTextures(1, &mOpenGLTexture);
+			static_cast<OpenGLRhi&>(getRhi()).getOpenGLStateCache().forgetOpenGLTexture(mOpenGLTexture);
 		}
 
 		/**
@@ -8863,6 +9735,11 @@ namespace OpenGLRhi
 		Texture1DArrayBind(OpenGLRhi& openGLRhi, uint32_t width, uint32_t numberOfSlices, Rhi::TextureFormat::Enum textureFormat, const void* data, uint32_t textureFlags RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
 			Texture1DArray(openGLRhi, width, numberOfSlices, textureFormat RHI_RESOURCE_DEBUG_PASS_PARAMETER)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsTextureDescription(textureFormat, textureFlags, width, 1, 1, numberOfSlices);
+			#endif
+
 			#ifdef RHI_OPENGL_STATE_CLEANUP
 				// Backup the currently set alignment
 				GLint openGLAlignmentBackup = 0;
@@ -8977,6 +9854,11 @@ namespace OpenGLRhi
 		Texture1DArrayDsa(OpenGLRhi& openGLRhi, uint32_t width, uint32_t numberOfSlices, Rhi::TextureFormat::Enum textureFormat, const void* data, uint32_t textureFlags RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
 			Texture1DArray(openGLRhi, width, numberOfSlices, textureFormat RHI_RESOURCE_DEBUG_PASS_PARAMETER)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsTextureDescription(textureFormat, textureFlags, width, 1, 1, numberOfSlices);
+			#endif
+
 			#ifdef RHI_OPENGL_STATE_CLEANUP
 				// Backup the currently set alignment
 				GLint openGLAlignmentBackup = 0;
@@ -9205,6 +10087,7 @@ namespace OpenGLRhi
 			// Destroy the OpenGL texture instance
 			// -> Silently ignores 0's and names that do not correspond to existing textures
 			glDeleteTextures(1, &mOpenGLTexture);
+			static_cast<OpenGLRhi&>(getRhi()).getOpenGLStateCache().forgetOpenGLTexture(mOpenGLTexture);
 		}
 
 		/**
@@ -9366,6 +10249,11 @@ namespace OpenGLRhi
 		Texture2DBind(OpenGLRhi& openGLRhi, uint32_t width, uint32_t height, Rhi::TextureFormat::Enum textureFormat, const void* data, uint32_t textureFlags, uint8_t numberOfMultisamples RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
 			Texture2D(openGLRhi, width, height, textureFormat, numberOfMultisamples RHI_RESOURCE_DEBUG_PASS_PARAMETER)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsTextureDescription(textureFormat, textureFlags, width, height, 1, 1, numberOfMultisamples);
+			#endif
+
 			// Sanity checks
 			RHI_ASSERT(openGLRhi.getContext(), numberOfMultisamples == 1 || numberOfMultisamples == 2 || numberOfMultisamples == 4 || numberOfMultisamples == 8, "Invalid OpenGL texture parameters")
 			RHI_ASSERT(openGLRhi.getContext(), numberOfMultisamples == 1 || nullptr == data, "Invalid OpenGL texture parameters")
@@ -9596,6 +10484,11 @@ namespace OpenGLRhi
 		Texture2DDsa(OpenGLRhi& openGLRhi, uint32_t width, uint32_t height, Rhi::TextureFormat::Enum textureFormat, const void* data, uint32_t textureFlags, uint8_t numberOfMultisamples RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
 			Texture2D(openGLRhi, width, height, textureFormat, numberOfMultisamples RHI_RESOURCE_DEBUG_PASS_PARAMETER)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsTextureDescription(textureFormat, textureFlags, width, height, 1, 1, numberOfMultisamples);
+			#endif
+
 			// Sanity checks
 			RHI_ASSERT(openGLRhi.getContext(), numberOfMultisamples == 1 || numberOfMultisamples == 2 || numberOfMultisamples == 4 || numberOfMultisamples == 8, "Invalid OpenGL texture parameters")
 			RHI_ASSERT(openGLRhi.getContext(), numberOfMultisamples == 1 || nullptr == data, "Invalid OpenGL texture parameters")
@@ -9636,6 +10529,9 @@ namespace OpenGLRhi
 					#ifdef RHI_OPENGL_STATE_CLEANUP
 						// Be polite and restore the previous bound OpenGL texture
 						glBindTexture(GL_TEXTURE_2D_MULTISAMPLE, static_cast<GLuint>(openGLTextureBackup));
+					#else
+						// The OpenGL texture bound to the active texture unit was changed without using the OpenGL state cache
+						openGLRhi.getOpenGLStateCache().invalidateTextureUnits();
 					#endif
 				}
 			}
@@ -9873,6 +10769,7 @@ namespace OpenGLRhi
 			// Destroy the OpenGL texture instance
 			// -> Silently ignores 0's and names that do not correspond to existing textures
 			glDeleteTextures(1, &mOpenGLTexture);
+			static_cast<OpenGLRhi&>(getRhi()).getOpenGLStateCache().forgetOpenGLTexture(mOpenGLTexture);
 		}
 
 		/**
@@ -10008,6 +10905,11 @@ namespace OpenGLRhi
 		Texture2DArrayBind(OpenGLRhi& openGLRhi, uint32_t width, uint32_t height, uint32_t numberOfSlices, Rhi::TextureFormat::Enum textureFormat, const void* data, uint32_t textureFlags RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
 			Texture2DArray(openGLRhi, width, height, numberOfSlices, textureFormat RHI_RESOURCE_DEBUG_PASS_PARAMETER)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsTextureDescription(textureFormat, textureFlags, width, height, 1, numberOfSlices);
+			#endif
+
 			#ifdef RHI_OPENGL_STATE_CLEANUP
 				// Backup the currently set alignment
 				GLint openGLAlignmentBackup = 0;
@@ -10124,6 +11026,11 @@ namespace OpenGLRhi
 		Texture2DArrayDsa(OpenGLRhi& openGLRhi, uint32_t width, uint32_t height, uint32_t numberOfSlices, Rhi::TextureFormat::Enum textureFormat, const void* data, uint32_t textureFlags RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
 			Texture2DArray(openGLRhi, width, height, numberOfSlices, textureFormat RHI_RESOURCE_DEBUG_PASS_PARAMETER)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsTextureDescription(textureFormat, textureFlags, width, height, 1, numberOfSlices);
+			#endif
+
 			#ifdef RHI_OPENGL_STATE_CLEANUP
 				// Backup the currently set alignment
 				GLint openGLAlignmentBackup = 0;
@@ -10354,6 +11261,7 @@ namespace OpenGLRhi
 			// Destroy the OpenGL texture instance
 			// -> Silently ignores 0's and names that do not correspond to existing textures
 			glDeleteTextures(1, &mOpenGLTexture);
+			static_cast<OpenGLRhi&>(getRhi()).getOpenGLStateCache().forgetOpenGLTexture(mOpenGLTexture);
 			glDeleteBuffersARB(1, &mOpenGLPixelUnpackBuffer);
 		}
 
@@ -10516,6 +11424,11 @@ namespace OpenGLRhi
 		Texture3DBind(OpenGLRhi& openGLRhi, uint32_t width, uint32_t height, uint32_t depth, Rhi::TextureFormat::Enum textureFormat, const void* data, uint32_t textureFlags, Rhi::TextureUsage textureUsage RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
 			Texture3D(openGLRhi, width, height, depth, textureFormat RHI_RESOURCE_DEBUG_PASS_PARAMETER)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsTextureDescription(textureFormat, textureFlags, width, height, depth);
+			#endif
+
 			// Sanity checks
 			RHI_ASSERT(openGLRhi.getContext(), 0 == (textureFlags & Rhi::TextureFlag::DATA_CONTAINS_MIPMAPS) || nullptr != data, "Invalid OpenGL texture parameters")
 			RHI_ASSERT(openGLRhi.getContext(), (textureFlags & Rhi::TextureFlag::RENDER_TARGET) == 0 || nullptr == data, "OpenGL render target textures can't be filled using provided data")
@@ -10727,6 +11640,11 @@ namespace OpenGLRhi
 		Texture3DDsa(OpenGLRhi& openGLRhi, uint32_t width, uint32_t height, uint32_t depth, Rhi::TextureFormat::Enum textureFormat, const void* data, uint32_t textureFlags, Rhi::TextureUsage textureUsage RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
 			Texture3D(openGLRhi, width, height, depth, textureFormat RHI_RESOURCE_DEBUG_PASS_PARAMETER)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsTextureDescription(textureFormat, textureFlags, width, height, depth);
+			#endif
+
 			// Sanity checks
 			RHI_ASSERT(openGLRhi.getContext(), 0 == (textureFlags & Rhi::TextureFlag::DATA_CONTAINS_MIPMAPS) || nullptr != data, "Invalid OpenGL texture parameters")
 			RHI_ASSERT(openGLRhi.getContext(), (textureFlags & Rhi::TextureFlag::RENDER_TARGET) == 0 || nullptr == data, "OpenGL render target textures can't be filled using provided data")
@@ -10968,6 +11886,7 @@ namespace OpenGLRhi
 			// Destroy the OpenGL texture instance
 			// -> Silently ignores 0's and names that do not correspond to existing textures
 			glDeleteTextures(1, &mOpenGLTexture);
+			static_cast<OpenGLRhi&>(getRhi()).getOpenGLStateCache().forgetOpenGLTexture(mOpenGLTexture);
 		}
 
 		/**
@@ -11091,6 +12010,11 @@ namespace OpenGLRhi
 		TextureCubeBind(OpenGLRhi& openGLRhi, uint32_t width, Rhi::TextureFormat::Enum textureFormat, const void* data, uint32_t textureFlags RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
 			TextureCube(openGLRhi, width, textureFormat RHI_RESOURCE_DEBUG_PASS_PARAMETER)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsTextureDescription(textureFormat, textureFlags, width, width, 1, 6);
+			#endif
+
 			// Sanity checks
 			RHI_ASSERT(openGLRhi.getContext(), 0 == (textureFlags & Rhi::TextureFlag::DATA_CONTAINS_MIPMAPS) || nullptr != data, "Invalid OpenGL texture parameters")
 			RHI_ASSERT(openGLRhi.getContext(), (textureFlags & Rhi::TextureFlag::RENDER_TARGET) == 0 || nullptr == data, "OpenGL render target textures can't be filled using provided data")
@@ -11287,6 +12211,11 @@ namespace OpenGLRhi
 		TextureCubeDsa(OpenGLRhi& openGLRhi, uint32_t width, Rhi::TextureFormat::Enum textureFormat, const void* data, uint32_t textureFlags RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
 			TextureCube(openGLRhi, width, textureFormat RHI_RESOURCE_DEBUG_PASS_PARAMETER)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsTextureDescription(textureFormat, textureFlags, width, width, 1, 6);
+			#endif
+
 			// Sanity checks
 			RHI_ASSERT(openGLRhi.getContext(), 0 == (textureFlags & Rhi::TextureFlag::DATA_CONTAINS_MIPMAPS) || nullptr != data, "Invalid OpenGL texture parameters")
 			RHI_ASSERT(openGLRhi.getContext(), (textureFlags & Rhi::TextureFlag::RENDER_TARGET) == 0 || nullptr == data, "OpenGL render target textures can't be filled using provided data")
@@ -12101,6 +13030,7 @@ namespace OpenGLRhi
 			// Destroy the OpenGL sampler
 			// -> Silently ignores 0's and names that do not correspond to existing samplers
 			glDeleteSamplers(1, &mOpenGLSampler);
+			static_cast<OpenGLRhi&>(getRhi()).getOpenGLStateCache().forgetOpenGLSampler(mOpenGLSampler);
 		}
 
 		/**
@@ -12220,21 +13150,24 @@ namespace OpenGLRhi
 		/**
 		*  @brief
 		*    Set the OpenGL rasterizer states
+		*
+		*  @param[in] openGLStateCache
+		*    OpenGL state cache used to filter redundant OpenGL calls
 		*/
-		void setOpenGLRasterizerStates() const
+		void setOpenGLRasterizerStates(OpenGLStateCache& openGLStateCache) const
 		{
 			// Rhi::RasterizerState::fillMode
 			switch (mRasterizerState.fillMode)
 			{
 				// Wireframe
 				case Rhi::FillMode::WIREFRAME:
-					glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
+					openGLStateCache.setPolygonMode(GL_LINE);
 					break;
 
 				// Solid
 				default:
 				case Rhi::FillMode::SOLID:
-					glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
+					openGLStateCache.setPolygonMode(GL_FILL);
 					break;
 			}
 
@@ -12244,24 +13177,24 @@ namespace OpenGLRhi
 				// No culling
 				default:
 				case Rhi::CullMode::NONE:
-					glDisable(GL_CULL_FACE);
+					openGLStateCache.setCapability(OpenGLStateCache::Capability::CULL_FACE, false);
 					break;
 
 				// Selects clockwise polygons as front-facing
 				case Rhi::CullMode::FRONT:
-					glEnable(GL_CULL_FACE);
-					glCullFace(GL_FRONT);
+					openGLStateCache.setCapability(OpenGLStateCache::Capability::CULL_FACE, true);
+					openGLStateCache.setCullFace(GL_FRONT);
 					break;
 
 				// Selects counterclockwise polygons as front-facing
 				case Rhi::CullMode::BACK:
-					glEnable(GL_CULL_FACE);
-					glCullFace(GL_BACK);
+					openGLStateCache.setCapability(OpenGLStateCache::Capability::CULL_FACE, true);
+					openGLStateCache.setCullFace(GL_BACK);
 					break;
 			}
 
 			// Rhi::RasterizerState::frontCounterClockwise
-			glFrontFace(mOpenGLFrontFaceMode);
+			openGLStateCache.setFrontFace(mOpenGLFrontFaceMode);
 
 			// TODO(co) Map the rest of the rasterizer states
 
@@ -12272,36 +13205,15 @@ namespace OpenGLRhi
 			// RasterizerState::slopeScaledDepthBias
 
 			// RasterizerState::depthClipEnable
-			if (mRasterizerState.depthClipEnable)
-			{
-				glDisable(GL_DEPTH_CLAMP);
-			}
-			else
-			{
-				glEnable(GL_DEPTH_CLAMP);
-			}
+			openGLStateCache.setCapability(OpenGLStateCache::Capability::DEPTH_CLAMP, !mRasterizerState.depthClipEnable);
 
 			// RasterizerState::scissorEnable
-			if (mRasterizerState.scissorEnable)
-			{
-				glEnable(GL_SCISSOR_TEST);
-			}
-			else
-			{
-				glDisable(GL_SCISSOR_TEST);
-			}
+			openGLStateCache.setCapability(OpenGLStateCache::Capability::SCISSOR_TEST, 0 != mRasterizerState.scissorEnable);
 
 			// RasterizerState::multisampleEnable
 
 			// RasterizerState::antialiasedLineEnable
-			if (mRasterizerState.antialiasedLineEnable)
-			{
-				glEnable(GL_LINE_SMOOTH);
-			}
-			else
-			{
-				glDisable(GL_LINE_SMOOTH);
-			}
+			openGLStateCache.setCapability(OpenGLStateCache::Capability::LINE_SMOOTH, 0 != mRasterizerState.antialiasedLineEnable);
 		}
 
 
@@ -12368,24 +13280,20 @@ namespace OpenGLRhi
 		/**
 		*  @brief
 		*    Set the OpenGL depth stencil states
+		*
+		*  @param[in] openGLStateCache
+		*    OpenGL state cache used to filter redundant OpenGL calls
 		*/
-		void setOpenGLDepthStencilStates() const
+		void setOpenGLDepthStencilStates(OpenGLStateCache& openGLStateCache) const
 		{
 			// Rhi::DepthStencilState::depthEnable
-			if (mDepthStencilState.depthEnable)
-			{
-				glEnable(GL_DEPTH_TEST);
-			}
-			else
-			{
-				glDisable(GL_DEPTH_TEST);
-			}
+			openGLStateCache.setCapability(OpenGLStateCache::Capability::DEPTH_TEST, 0 != mDepthStencilState.depthEnable);
 
 			// Rhi::DepthStencilState::depthWriteMask
-			glDepthMask(mOpenGLDepthMaskEnabled);
+			openGLStateCache.setDepthMask(mOpenGLDepthMaskEnabled);
 
 			// Rhi::DepthStencilState::depthFunc
-			glDepthFunc(static_cast<GLenum>(mOpenGLDepthFunc));
+			openGLStateCache.setDepthFunc(static_cast<GLenum>(mOpenGLDepthFunc));
 
 			// TODO(co) Map the rest of the depth stencil states
 		}
@@ -12455,28 +13363,24 @@ namespace OpenGLRhi
 		/**
 		*  @brief
 		*    Set the OpenGL blend states
+		*
+		*  @param[in] openGLStateCache
+		*    OpenGL state cache used to filter redundant OpenGL calls
 		*/
-		void setOpenGLBlendStates() const
+		void setOpenGLBlendStates(OpenGLStateCache& openGLStateCache) const
 		{
 			// "GL_ARB_multisample"-extension
-			if (mBlendState.alphaToCoverageEnable)
-			{
-				glEnable(GL_SAMPLE_ALPHA_TO_COVERAGE_ARB);
-			}
-			else
-			{
-				glDisable(GL_SAMPLE_ALPHA_TO_COVERAGE_ARB);
-			}
+			openGLStateCache.setCapability(OpenGLStateCache::Capability::SAMPLE_ALPHA_TO_COVERAGE, 0 != mBlendState.alphaToCoverageEnable);
 
 			// TODO(co) Add support for blend state per render target
 			if (mBlendState.renderTarget[0].blendEnable)
 			{
-				glEnable(GL_BLEND);
-				glBlendFunc(mOpenGLSrcBlend, mOpenGLDstBlend);
+				openGLStateCache.setCapability(OpenGLStateCache::Capability::BLEND, true);
+				openGLStateCache.setBlendFunc(mOpenGLSrcBlend, mOpenGLDstBlend);
 			}
 			else
 			{
-				glDisable(GL_BLEND);
+				openGLStateCache.setCapability(OpenGLStateCache::Capability::BLEND, false);
 			}
 
 			// TODO(co) Map the rest of the blend states
@@ -18331,16 +19235,18 @@ namespace OpenGLRhi
 		*/
 		void bindGraphicsPipelineState() const
 		{
-			static_cast<OpenGLRhi&>(getRhi()).setOpenGLGraphicsProgram(mGraphicsProgram);
+			OpenGLRhi& openGLRhi = static_cast<OpenGLRhi&>(getRhi());
+			openGLRhi.setOpenGLGraphicsProgram(mGraphicsProgram);
 
-			// Set the OpenGL rasterizer state
-			mRasterizerState.setOpenGLRasterizerStates();
+			// Set the OpenGL rasterizer state, the OpenGL state cache filters OpenGL calls which wouldn't change anything
+			OpenGLStateCache& openGLStateCache = openGLRhi.getOpenGLStateCache();
+			mRasterizerState.setOpenGLRasterizerStates(openGLStateCache);
 
 			// Set OpenGL depth stencil state
-			mDepthStencilState.setOpenGLDepthStencilStates();
+			mDepthStencilState.setOpenGLDepthStencilStates(openGLStateCache);
 
 			// Set OpenGL blend state
-			mBlendState.setOpenGLBlendStates();
+			mBlendState.setOpenGLBlendStates(openGLStateCache);
 		}
 
 		//[-------------------------------------------------------]
@@ -18415,6 +19321,12 @@ namespace
 	{
 
 
+		//[-------------------------------------------------------]
+		//[ Global definitions                                    ]
+		//[-------------------------------------------------------]
+		static constexpr uint32_t MAXIMUM_NUMBER_OF_COALESCED_DRAWS = 64;	///< Maximum number of emulated draws coalesced into a single native multi-draw call, limits the used stack memory
+
+
 		//[-------------------------------------------------------]
 		//[ Global functions                                      ]
 		//[-------------------------------------------------------]
@@ -18427,7 +19339,7 @@ namespace
 
 		[[nodiscard]] bool mapBuffer([[maybe_unused]] const Rhi::Context& context, const OpenGLRhi::Extensions& extensions, GLenum target, [[maybe_unused]] GLenum bindingTarget, GLuint openGLBuffer, Rhi::MapType mapType, Rhi::MappedSubresource& mappedSubresource)
 		{
-			// TODO(co) This buffer update isn't efficient, use e.g. persistent buffer mapping
+			// TODO(co) This buffer update isn't efficient, use e.g. persistent buffer mapping (already done for dynamic uniform and indirect buffers, see "OpenGLRhi::PersistentMappedBuffer")
 
 			// Is "GL_ARB_direct_state_access" there?
 			if (extensions.isGL_ARB_direct_state_access())
@@ -18633,6 +19545,11 @@ namespace
 				static_cast<OpenGLRhi::OpenGLRhi&>(rhi).dispatchCompute(realData->groupCountX, realData->groupCountY, realData->groupCountZ);
 			}
 
+			void ComputeBufferBarrier(const void*, Rhi::IRhi&)
+			{
+				// Nothing here, "OpenGLRhi::OpenGLRhi::dispatchCompute()" has a fixed memory barrier build in which also covers shader storage buffers consumed as indirect buffers or mapped for reading
+			}
+
 			//[-------------------------------------------------------]
 			//[ Resource                                              ]
 			//[-------------------------------------------------------]
@@ -18758,6 +19675,7 @@ namespace
 			&ImplementationDispatch::SetComputePipelineState,
 			&ImplementationDispatch::SetComputeResourceGroup,
 			&ImplementationDispatch::DispatchCompute,
+			&ImplementationDispatch::ComputeBufferBarrier,
 			// Resource
 			&ImplementationDispatch::SetTextureMinimumMaximumMipmapIndex,
 			&ImplementationDispatch::ResolveMultisampleFramebuffer,
@@ -18950,6 +19868,11 @@ namespace OpenGLRhi
 			mComputeRootSignature->releaseReference();
 		}
 
+		#ifdef RHI_STATISTICS
+			// Show how many OpenGL calls the OpenGL state cache was able to filter
+			RHI_LOG(mContext, INFORMATION, "OpenGL state cache: %u OpenGL calls issued, %u redundant OpenGL calls filtered", mOpenGLStateCache.getNumberOfIssuedOpenGLCalls(), mOpenGLStateCache.getNumberOfFilteredOpenGLCalls())
+		#endif
+
 		#ifdef RHI_STATISTICS
 		{ // For debugging: At this point there should be no resource instances left, validate this!
 			// -> Are the currently any resource instances?
@@ -19360,7 +20283,7 @@ namespace OpenGLRhi
 				glClearDepth(static_cast<GLclampd>(z));
 				if (nullptr != mGraphicsPipelineState && Rhi::DepthWriteMask::ALL != mGraphicsPipelineState->getDepthStencilState().depthWriteMask)
 				{
-					glDepthMask(GL_TRUE);
+					mOpenGLStateCache.setDepthMask(GL_TRUE);
 				}
 			}
 			if (clearFlags & Rhi::ClearFlag::STENCIL)
@@ -19374,7 +20297,7 @@ namespace OpenGLRhi
 			// Disable OpenGL scissor test, in case it's not disabled, yet
 			if (nullptr != mGraphicsPipelineState && mGraphicsPipelineState->getRasterizerState().scissorEnable)
 			{
-				glDisable(GL_SCISSOR_TEST);
+				mOpenGLStateCache.setCapability(OpenGLStateCache::Capability::SCISSOR_TEST, false);
 			}
 
 			// Clear
@@ -19383,11 +20306,11 @@ namespace OpenGLRhi
 			// Restore the previously set OpenGL states
 			if (nullptr != mGraphicsPipelineState && mGraphicsPipelineState->getRasterizerState().scissorEnable)
 			{
-				glEnable(GL_SCISSOR_TEST);
+				mOpenGLStateCache.setCapability(OpenGLStateCache::Capability::SCISSOR_TEST, true);
 			}
 			if ((clearFlags & Rhi::ClearFlag::DEPTH) && nullptr != mGraphicsPipelineState && Rhi::DepthWriteMask::ALL != mGraphicsPipelineState->getDepthStencilState().depthWriteMask)
 			{
-				glDepthMask(GL_FALSE);
+				mOpenGLStateCache.setDepthMask(GL_FALSE);
 			}
 		}
 	}
@@ -19459,7 +20382,15 @@ namespace OpenGLRhi
 		#endif
 		for (uint32_t i = 0; i < numberOfDraws; ++i)
 		{
+			// Try to coalesce a run of draws into a single native multi-draw call
 			const Rhi::DrawArguments& drawArguments = *reinterpret_cast<const Rhi::DrawArguments*>(emulationData);
+			const uint32_t numberOfCoalescedDraws = multiDrawGraphicsEmulated(&drawArguments, numberOfDraws - i);
+			if (numberOfCoalescedDraws > 0)
+			{
+				i += numberOfCoalescedDraws - 1;
+				emulationData += sizeof(Rhi::DrawArguments) * numberOfCoalescedDraws;
+				continue;
+			}
 			updateGL_ARB_base_instanceEmulation(drawArguments.startInstanceLocation);
 
 			// Draw and advance
@@ -19562,7 +20493,15 @@ namespace OpenGLRhi
 		IndexBuffer* indexBuffer = mVertexArray->getIndexBuffer();
 		for (uint32_t i = 0; i < numberOfDraws; ++i)
 		{
+			// Try to coalesce a run of draws into a single native multi-draw call
 			const Rhi::DrawIndexedArguments& drawIndexedArguments = *reinterpret_cast<const Rhi::DrawIndexedArguments*>(emulationData);
+			const uint32_t numberOfCoalescedDraws = multiDrawIndexedGraphicsEmulated(&drawIndexedArguments, numberOfDraws - i);
+			if (numberOfCoalescedDraws > 0)
+			{
+				i += numberOfCoalescedDraws - 1;
+				emulationData += sizeof(Rhi::DrawIndexedArguments) * numberOfCoalescedDraws;
+				continue;
+			}
 			updateGL_ARB_base_instanceEmulation(drawIndexedArguments.startInstanceLocation);
 
 			// Draw and advance
@@ -19737,7 +20676,7 @@ namespace OpenGLRhi
 
 			// TODO(co) Compute shader: Memory barrier currently fixed build in: Make sure writing to image has finished before read
 			glMemoryBarrierEXT(GL_SHADER_IMAGE_ACCESS_BARRIER_BIT);
-			glMemoryBarrierEXT(GL_SHADER_STORAGE_BARRIER_BIT);
+			glMemoryBarrierEXT(GL_SHADER_STORAGE_BARRIER_BIT | GL_COMMAND_BARRIER_BIT | GL_BUFFER_UPDATE_BARRIER_BIT);	// Shader storage buffers written by compute shaders might be used as indirect buffers or mapped for reading
 		}
 	}
 
@@ -20370,8 +21309,12 @@ namespace OpenGLRhi
 	//[-------------------------------------------------------]
 	//[ Resource handling                                     ]
 	//[-------------------------------------------------------]
-	bool OpenGLRhi::map(Rhi::IResource& resource, uint32_t, Rhi::MapType mapType, uint32_t, Rhi::MappedSubresource& mappedSubresource)
+	bool OpenGLRhi::map(Rhi::IResource& resource, [[maybe_unused]] uint32_t subresource, Rhi::MapType mapType, uint32_t, Rhi::MappedSubresource& mappedSubresource)
 	{
+		#ifdef RHI_STATISTICS
+			getStatistics().currentFrame.countMap(resource, subresource, mapType);
+		#endif
+
 		// Evaluate the resource type
 		switch (resource.getResourceType())
 		{
@@ -20388,10 +21331,16 @@ namespace OpenGLRhi
 				return ::detail::mapBuffer(mContext, *mExtensions, GL_TEXTURE_BUFFER_ARB, GL_TEXTURE_BINDING_BUFFER_ARB, static_cast<StructuredBuffer&>(resource).getOpenGLStructuredBuffer(), mapType, mappedSubresource);
 
 			case Rhi::ResourceType::INDIRECT_BUFFER:
-				return ::detail::mapBuffer(mContext, *mExtensions, GL_DRAW_INDIRECT_BUFFER, GL_DRAW_INDIRECT_BUFFER_BINDING, static_cast<IndirectBuffer&>(resource).getOpenGLIndirectBuffer(), mapType, mappedSubresource);
+			{
+				IndirectBuffer& indirectBuffer = static_cast<IndirectBuffer&>(resource);
+				return indirectBuffer.isPersistentMapped() ? indirectBuffer.mapPersistent(mapType, mappedSubresource) : ::detail::mapBuffer(mContext, *mExtensions, GL_DRAW_INDIRECT_BUFFER, GL_DRAW_INDIRECT_BUFFER_BINDING, indirectBuffer.getOpenGLIndirectBuffer(), mapType, mappedSubresource);
+			}
 
 			case Rhi::ResourceType::UNIFORM_BUFFER:
-				return ::detail::mapBuffer(mContext, *mExtensions, GL_UNIFORM_BUFFER, GL_UNIFORM_BUFFER_BINDING, static_cast<UniformBuffer&>(resource).getOpenGLUniformBuffer(), mapType, mappedSubresource);
+			{
+				UniformBuffer& uniformBuffer = static_cast<UniformBuffer&>(resource);
+				return uniformBuffer.isPersistentMapped() ? uniformBuffer.mapPersistent(mapType, mappedSubresource) : ::detail::mapBuffer(mContext, *mExtensions, GL_UNIFORM_BUFFER, GL_UNIFORM_BUFFER_BINDING, uniformBuffer.getOpenGLUniformBuffer(), mapType, mappedSubresource);
+			}
 
 			case Rhi::ResourceType::TEXTURE_1D:
 			{
@@ -20508,6 +21457,10 @@ namespace OpenGLRhi
 
 	void OpenGLRhi::unmap(Rhi::IResource& resource, uint32_t)
 	{
+		#ifdef RHI_STATISTICS
+			++getStatistics().currentFrame.numberOfUnmaps;
+		#endif
+
 		// Evaluate the resource type
 		switch (resource.getResourceType())
 		{
@@ -20528,11 +21481,19 @@ namespace OpenGLRhi
 				break;
 
 			case Rhi::ResourceType::INDIRECT_BUFFER:
-				::detail::unmapBuffer(*mExtensions, GL_DRAW_INDIRECT_BUFFER, GL_DRAW_INDIRECT_BUFFER_BINDING, static_cast<IndirectBuffer&>(resource).getOpenGLIndirectBuffer());
+				// Persistent mapped OpenGL buffers stay mapped
+				if (!static_cast<IndirectBuffer&>(resource).isPersistentMapped())
+				{
+					::detail::unmapBuffer(*mExtensions, GL_DRAW_INDIRECT_BUFFER, GL_DRAW_INDIRECT_BUFFER_BINDING, static_cast<IndirectBuffer&>(resource).getOpenGLIndirectBuffer());
+				}
 				break;
 
 			case Rhi::ResourceType::UNIFORM_BUFFER:
-				::detail::unmapBuffer(*mExtensions, GL_UNIFORM_BUFFER, GL_UNIFORM_BUFFER_BINDING, static_cast<UniformBuffer&>(resource).getOpenGLUniformBuffer());
+				// Persistent mapped OpenGL buffers stay mapped
+				if (!static_cast<UniformBuffer&>(resource).isPersistentMapped())
+				{
+					::detail::unmapBuffer(*mExtensions, GL_UNIFORM_BUFFER, GL_UNIFORM_BUFFER_BINDING, static_cast<UniformBuffer&>(resource).getOpenGLUniformBuffer());
+				}
 				break;
 
 			case Rhi::ResourceType::TEXTURE_1D:
@@ -20746,14 +21707,15 @@ namespace OpenGLRhi
 	//[-------------------------------------------------------]
 	bool OpenGLRhi::beginScene()
 	{
-		// Not required when using OpenGL
-
 		// Sanity check
 		#ifdef RHI_DEBUG
 			RHI_ASSERT(mContext, false == mDebugBetweenBeginEndScene, "OpenGL: Begin scene was called while scene rendering is already in progress, missing end scene call?")
 			mDebugBetweenBeginEndScene = true;
 		#endif
 
+		// The OpenGL context might have been used by someone else since the last scene, so don't trust the shadowed OpenGL states
+		mOpenGLStateCache.invalidate();
+
 		// Done
 		return true;
 	}
@@ -20764,19 +21726,20 @@ namespace OpenGLRhi
 		RHI_ASSERT(mContext, !commandBuffer.isEmpty(), "The OpenGL command buffer to execute mustn't be empty")
 
 		// Loop through all commands
-		const uint8_t* commandPacketBuffer = commandBuffer.getCommandPacketBuffer();
-		Rhi::ConstCommandPacket constCommandPacket = commandPacketBuffer;
+		Rhi::ConstCommandPacket constCommandPacket = commandBuffer.getFirstCommandPacket();
 		while (nullptr != constCommandPacket)
 		{
 			{ // Submit command packet
 				const Rhi::CommandDispatchFunctionIndex commandDispatchFunctionIndex = Rhi::CommandPacketHelper::loadCommandDispatchFunctionIndex(constCommandPacket);
 				const void* command = Rhi::CommandPacketHelper::loadCommand(constCommandPacket);
+				#ifdef RHI_STATISTICS
+					getStatistics().currentFrame.countCommandPacket(commandDispatchFunctionIndex, command);
+				#endif
 				detail::DISPATCH_FUNCTIONS[static_cast<uint32_t>(commandDispatchFunctionIndex)](command, *this);
 			}
 
 			{ // Next command
-				const uint32_t nextCommandPacketByteIndex = Rhi::CommandPacketHelper::getNextCommandPacketByteIndex(constCommandPacket);
-				constCommandPacket = (~0u != nextCommandPacketByteIndex) ? &commandPacketBuffer[nextCommandPacketByteIndex] : nullptr;
+				constCommandPacket = Rhi::CommandPacketHelper::getNextCommandPacket(constCommandPacket);
 			}
 		}
 	}
@@ -21038,6 +22001,9 @@ namespace OpenGLRhi
 			mCapabilities.maximumUniformBufferSize = 0;
 		}
 
+		// Timestamp period, "GL_ARB_timer_query" timestamps are already in nanoseconds
+		mCapabilities.timestampPeriod = mExtensions->isGL_ARB_timer_query() ? 1.0f : 0.0f;
+
 		// Maximum number of multisamples (always at least 1, usually 8)
 		if (mExtensions->isGL_ARB_texture_multisample())
 		{
@@ -21196,24 +22162,22 @@ namespace OpenGLRhi
 										case Rhi::ResourceType::TEXTURE_BUFFER:
 											if (isArbDsa)
 											{
-												glBindTextureUnit(unit, static_cast<TextureBuffer*>(resource)->getOpenGLTexture());
+												mOpenGLStateCache.bindTextureUnit(unit, static_cast<TextureBuffer*>(resource)->getOpenGLTexture());
 											}
 											else
 											{
-												// "GL_TEXTURE0_ARB" is the first texture unit, while the unit we received is zero based
-												glBindMultiTextureEXT(GL_TEXTURE0_ARB + unit, GL_TEXTURE_BUFFER_ARB, static_cast<TextureBuffer*>(resource)->getOpenGLTexture());
+												mOpenGLStateCache.bindMultiTexture(unit, GL_TEXTURE_BUFFER_ARB, static_cast<TextureBuffer*>(resource)->getOpenGLTexture());
 											}
 											break;
 
 										case Rhi::ResourceType::TEXTURE_1D:
 											if (isArbDsa)
 											{
-												glBindTextureUnit(unit, static_cast<Texture1D*>(resource)->getOpenGLTexture());
+												mOpenGLStateCache.bindTextureUnit(unit, static_cast<Texture1D*>(resource)->getOpenGLTexture());
 											}
 											else
 											{
-												// "GL_TEXTURE0_ARB" is the first texture unit, while the unit we received is zero based
-												glBindMultiTextureEXT(GL_TEXTURE0_ARB + unit, GL_TEXTURE_1D, static_cast<Texture1D*>(resource)->getOpenGLTexture());
+												mOpenGLStateCache.bindMultiTexture(unit, GL_TEXTURE_1D, static_cast<Texture1D*>(resource)->getOpenGLTexture());
 											}
 											break;
 
@@ -21221,25 +22185,23 @@ namespace OpenGLRhi
 											// No texture 1D array extension check required, if we in here we already know it must exist
 											if (isArbDsa)
 											{
-												glBindTextureUnit(unit, static_cast<Texture1DArray*>(resource)->getOpenGLTexture());
+												mOpenGLStateCache.bindTextureUnit(unit, static_cast<Texture1DArray*>(resource)->getOpenGLTexture());
 											}
 											else
 											{
-												// "GL_TEXTURE0_ARB" is the first texture unit, while the unit we received is zero based
-												glBindMultiTextureEXT(GL_TEXTURE0_ARB + unit, GL_TEXTURE_1D_ARRAY_EXT, static_cast<Texture1DArray*>(resource)->getOpenGLTexture());
+												mOpenGLStateCache.bindMultiTexture(unit, GL_TEXTURE_1D_ARRAY_EXT, static_cast<Texture1DArray*>(resource)->getOpenGLTexture());
 											}
 											break;
 
 										case Rhi::ResourceType::TEXTURE_2D:
 											if (isArbDsa)
 											{
-												glBindTextureUnit(unit, static_cast<Texture2D*>(resource)->getOpenGLTexture());
+												mOpenGLStateCache.bindTextureUnit(unit, static_cast<Texture2D*>(resource)->getOpenGLTexture());
 											}
 											else
 											{
-												// "GL_TEXTURE0_ARB" is the first texture unit, while the unit we received is zero based
 												const Texture2D* texture2D = static_cast<Texture2D*>(resource);
-												glBindMultiTextureEXT(GL_TEXTURE0_ARB + unit, static_cast<GLenum>((texture2D->getNumberOfMultisamples() > 1) ? GL_TEXTURE_2D_MULTISAMPLE : GL_TEXTURE_2D), texture2D->getOpenGLTexture());
+												mOpenGLStateCache.bindMultiTexture(unit, static_cast<GLenum>((texture2D->getNumberOfMultisamples() > 1) ? GL_TEXTURE_2D_MULTISAMPLE : GL_TEXTURE_2D), texture2D->getOpenGLTexture());
 											}
 											break;
 
@@ -21247,36 +22209,33 @@ namespace OpenGLRhi
 											// No texture 2D array extension check required, if we in here we already know it must exist
 											if (isArbDsa)
 											{
-												glBindTextureUnit(unit, static_cast<Texture2DArray*>(resource)->getOpenGLTexture());
+												mOpenGLStateCache.bindTextureUnit(unit, static_cast<Texture2DArray*>(resource)->getOpenGLTexture());
 											}
 											else
 											{
-												// "GL_TEXTURE0_ARB" is the first texture unit, while the unit we received is zero based
-												glBindMultiTextureEXT(GL_TEXTURE0_ARB + unit, GL_TEXTURE_2D_ARRAY_EXT, static_cast<Texture2DArray*>(resource)->getOpenGLTexture());
+												mOpenGLStateCache.bindMultiTexture(unit, GL_TEXTURE_2D_ARRAY_EXT, static_cast<Texture2DArray*>(resource)->getOpenGLTexture());
 											}
 											break;
 
 										case Rhi::ResourceType::TEXTURE_3D:
 											if (isArbDsa)
 											{
-												glBindTextureUnit(unit, static_cast<Texture3D*>(resource)->getOpenGLTexture());
+												mOpenGLStateCache.bindTextureUnit(unit, static_cast<Texture3D*>(resource)->getOpenGLTexture());
 											}
 											else
 											{
-												// "GL_TEXTURE0_ARB" is the first texture unit, while the unit we received is zero based
-												glBindMultiTextureEXT(GL_TEXTURE0_ARB + unit, GL_TEXTURE_3D, static_cast<Texture3D*>(resource)->getOpenGLTexture());
+												mOpenGLStateCache.bindMultiTexture(unit, GL_TEXTURE_3D, static_cast<Texture3D*>(resource)->getOpenGLTexture());
 											}
 											break;
 
 										case Rhi::ResourceType::TEXTURE_CUBE:
 											if (isArbDsa)
 											{
-												glBindTextureUnit(unit, static_cast<TextureCube*>(resource)->getOpenGLTexture());
+												mOpenGLStateCache.bindTextureUnit(unit, static_cast<TextureCube*>(resource)->getOpenGLTexture());
 											}
 											else
 											{
-												// "GL_TEXTURE0_ARB" is the first texture unit, while the unit we received is zero based
-												glBindMultiTextureEXT(GL_TEXTURE0_ARB + unit, GL_TEXTURE_CUBE_MAP, static_cast<TextureCube*>(resource)->getOpenGLTexture());
+												mOpenGLStateCache.bindMultiTexture(unit, GL_TEXTURE_CUBE_MAP, static_cast<TextureCube*>(resource)->getOpenGLTexture());
 											}
 											break;
 
@@ -21285,12 +22244,11 @@ namespace OpenGLRhi
 											/*
 											if (isArbDsa)
 											{
-												glBindTextureUnit(unit, static_cast<TextureCubeArray*>(resource)->getOpenGLTexture());
+												mOpenGLStateCache.bindTextureUnit(unit, static_cast<TextureCubeArray*>(resource)->getOpenGLTexture());
 											}
 											else
 											{
-												// "GL_TEXTURE0_ARB" is the first texture unit, while the unit we received is zero based
-												glBindMultiTextureEXT(GL_TEXTURE0_ARB + unit, GL_TEXTURE_CUBE_MAP, static_cast<TextureCubeArray*>(resource)->getOpenGLTexture());
+												mOpenGLStateCache.bindMultiTexture(unit, GL_TEXTURE_CUBE_MAP, static_cast<TextureCubeArray*>(resource)->getOpenGLTexture());
 											}
 											*/
 											break;
@@ -21331,7 +22289,7 @@ namespace OpenGLRhi
 											if (mExtensions->isGL_ARB_sampler_objects())
 											{
 												// Effective sampler object (SO)
-												glBindSampler(descriptorRange.baseShaderRegister, static_cast<const SamplerStateSo*>(samplerState)->getOpenGLSampler());
+												mOpenGLStateCache.bindSampler(descriptorRange.baseShaderRegister, static_cast<const SamplerStateSo*>(samplerState)->getOpenGLSampler());
 											}
 											else
 											{
@@ -21462,7 +22420,7 @@ namespace OpenGLRhi
 												if (mExtensions->isGL_ARB_sampler_objects())
 												{
 													// Effective sampler object (SO)
-													glBindSampler(descriptorRange.baseShaderRegister, static_cast<const SamplerStateSo*>(samplerState)->getOpenGLSampler());
+													mOpenGLStateCache.bindSampler(descriptorRange.baseShaderRegister, static_cast<const SamplerStateSo*>(samplerState)->getOpenGLSampler());
 												}
 												// Is "GL_EXT_direct_state_access" there?
 												else if (mExtensions->isGL_EXT_direct_state_access() || mExtensions->isGL_ARB_direct_state_access())
@@ -21606,7 +22564,7 @@ namespace OpenGLRhi
 							const GLuint index = descriptorRange.baseShaderRegister;
 
 							// Attach the buffer to the given SSBO binding point
-							glBindBufferBase(GL_SHADER_STORAGE_BUFFER, index, static_cast<VertexBuffer*>(resource)->getOpenGLArrayBuffer());
+							mOpenGLStateCache.bindBufferBase(GL_SHADER_STORAGE_BUFFER, index, static_cast<VertexBuffer*>(resource)->getOpenGLArrayBuffer());
 						}
 						break;
 					}
@@ -21623,7 +22581,7 @@ namespace OpenGLRhi
 							const GLuint index = descriptorRange.baseShaderRegister;
 
 							// Attach the buffer to the given SSBO binding point
-							glBindBufferBase(GL_SHADER_STORAGE_BUFFER, index, static_cast<IndexBuffer*>(resource)->getOpenGLElementArrayBuffer());
+							mOpenGLStateCache.bindBufferBase(GL_SHADER_STORAGE_BUFFER, index, static_cast<IndexBuffer*>(resource)->getOpenGLElementArrayBuffer());
 						}
 						break;
 					}
@@ -21639,7 +22597,7 @@ namespace OpenGLRhi
 							const GLuint index = descriptorRange.baseShaderRegister;
 
 							// Attach the buffer to the given SSBO binding point
-							glBindBufferBase(GL_SHADER_STORAGE_BUFFER, index, static_cast<StructuredBuffer*>(resource)->getOpenGLStructuredBuffer());
+							mOpenGLStateCache.bindBufferBase(GL_SHADER_STORAGE_BUFFER, index, static_cast<StructuredBuffer*>(resource)->getOpenGLStructuredBuffer());
 						}
 						break;
 					}
@@ -21656,7 +22614,7 @@ namespace OpenGLRhi
 							const GLuint index = descriptorRange.baseShaderRegister;
 
 							// Attach the buffer to the given SSBO binding point
-							glBindBufferBase(GL_SHADER_STORAGE_BUFFER, index, static_cast<IndirectBuffer*>(resource)->getOpenGLIndirectBuffer());
+							mOpenGLStateCache.bindBufferBase(GL_SHADER_STORAGE_BUFFER, index, static_cast<IndirectBuffer*>(resource)->getOpenGLIndirectBuffer());
 						}
 						break;
 					}
@@ -21670,7 +22628,7 @@ namespace OpenGLRhi
 							// -> Direct3D 10 and Direct3D 11 have explicit binding points
 							RHI_ASSERT(mContext, Rhi::DescriptorRangeType::UBV == descriptorRange.rangeType, "OpenGL uniform buffer must bound at UBV descriptor range type")
 							RHI_ASSERT(mContext, nullptr != openGLResourceGroup->getResourceIndexToUniformBlockBindingIndex(), "Invalid OpenGL resource index to uniform block binding index")
-							glBindBufferBase(GL_UNIFORM_BUFFER, openGLResourceGroup->getResourceIndexToUniformBlockBindingIndex()[resourceIndex], static_cast<UniformBuffer*>(resource)->getOpenGLUniformBuffer());
+							mOpenGLStateCache.bindBufferBase(GL_UNIFORM_BUFFER, openGLResourceGroup->getResourceIndexToUniformBlockBindingIndex()[resourceIndex], static_cast<UniformBuffer*>(resource)->getOpenGLUniformBuffer());
 						}
 						break;
 
@@ -21850,6 +22808,92 @@ namespace OpenGLRhi
 		}
 	}
 
+	uint32_t OpenGLRhi::multiDrawGraphicsEmulated(const Rhi::DrawArguments* drawArguments, uint32_t numberOfDraws)
+	{
+		const uint32_t maximumNumberOfDraws = (numberOfDraws < ::detail::MAXIMUM_NUMBER_OF_COALESCED_DRAWS) ? numberOfDraws : ::detail::MAXIMUM_NUMBER_OF_COALESCED_DRAWS;
+		if (maximumNumberOfDraws < 2 || nullptr == glMultiDrawArrays)
+		{
+			// Nothing to coalesce
+			return 0;
+		}
+
+		// Gather a run of non-instanced draws sharing the same draw ID
+		const bool drawIdUniformUsed = (-1 != mDrawIdUniformLocation && 0 != mOpenGLVertexProgram);
+		const bool baseInstance = mExtensions->isGL_ARB_base_instance();
+		GLint firsts[::detail::MAXIMUM_NUMBER_OF_COALESCED_DRAWS];
+		GLsizei counts[::detail::MAXIMUM_NUMBER_OF_COALESCED_DRAWS];
+		uint32_t numberOfCoalescedDraws = 0;
+		for (; numberOfCoalescedDraws < maximumNumberOfDraws; ++numberOfCoalescedDraws)
+		{
+			const Rhi::DrawArguments& currentDrawArguments = drawArguments[numberOfCoalescedDraws];
+			if (currentDrawArguments.instanceCount > 1 || (currentDrawArguments.startInstanceLocation > 0 && baseInstance) || (drawIdUniformUsed && currentDrawArguments.startInstanceLocation != drawArguments->startInstanceLocation))
+			{
+				break;
+			}
+			firsts[numberOfCoalescedDraws] = static_cast<GLint>(currentDrawArguments.startVertexLocation);
+			counts[numberOfCoalescedDraws] = static_cast<GLsizei>(currentDrawArguments.vertexCountPerInstance);
+		}
+		if (numberOfCoalescedDraws < 2)
+		{
+			return 0;
+		}
+
+		// Draw
+		updateGL_ARB_base_instanceEmulation(drawArguments->startInstanceLocation);
+		glMultiDrawArrays(mOpenGLPrimitiveTopology, firsts, counts, static_cast<GLsizei>(numberOfCoalescedDraws));
+		return numberOfCoalescedDraws;
+	}
+
+	uint32_t OpenGLRhi::multiDrawIndexedGraphicsEmulated(const Rhi::DrawIndexedArguments* drawIndexedArguments, uint32_t numberOfDraws)
+	{
+		const uint32_t maximumNumberOfDraws = (numberOfDraws < ::detail::MAXIMUM_NUMBER_OF_COALESCED_DRAWS) ? numberOfDraws : ::detail::MAXIMUM_NUMBER_OF_COALESCED_DRAWS;
+		if (maximumNumberOfDraws < 2 || nullptr == glMultiDrawElements)
+		{
+			// Nothing to coalesce
+			return 0;
+		}
+
+		// Gather a run of non-instanced draws sharing the same draw ID, base vertex locations require "GL_ARB_draw_elements_base_vertex"
+		const bool drawIdUniformUsed = (-1 != mDrawIdUniformLocation && 0 != mOpenGLVertexProgram);
+		const bool baseInstance = mExtensions->isGL_ARB_base_instance();
+		const bool baseVertex = mExtensions->isGL_ARB_draw_elements_base_vertex();
+		const IndexBuffer* indexBuffer = mVertexArray->getIndexBuffer();
+		const uint32_t indexSizeInBytes = indexBuffer->getIndexSizeInBytes();
+		GLsizei counts[::detail::MAXIMUM_NUMBER_OF_COALESCED_DRAWS];
+		const void* indices[::detail::MAXIMUM_NUMBER_OF_COALESCED_DRAWS];
+		GLint baseVertices[::detail::MAXIMUM_NUMBER_OF_COALESCED_DRAWS];
+		bool anyBaseVertex = false;
+		uint32_t numberOfCoalescedDraws = 0;
+		for (; numberOfCoalescedDraws < maximumNumberOfDraws; ++numberOfCoalescedDraws)
+		{
+			const Rhi::DrawIndexedArguments& currentDrawIndexedArguments = drawIndexedArguments[numberOfCoalescedDraws];
+			if (currentDrawIndexedArguments.instanceCount > 1 || (currentDrawIndexedArguments.baseVertexLocation > 0 && !baseVertex) || (currentDrawIndexedArguments.startInstanceLocation > 0 && baseInstance) || (drawIdUniformUsed && currentDrawIndexedArguments.startInstanceLocation != drawIndexedArguments->startInstanceLocation))
+			{
+				break;
+			}
+			counts[numberOfCoalescedDraws]		 = static_cast<GLsizei>(currentDrawIndexedArguments.indexCountPerInstance);
+			indices[numberOfCoalescedDraws]		 = reinterpret_cast<const void*>(static_cast<uintptr_t>(currentDrawIndexedArguments.startIndexLocation * indexSizeInBytes));
+			baseVertices[numberOfCoalescedDraws] = (currentDrawIndexedArguments.baseVertexLocation > 0) ? static_cast<GLint>(currentDrawIndexedArguments.baseVertexLocation) : 0;
+			anyBaseVertex |= (currentDrawIndexedArguments.baseVertexLocation > 0);
+		}
+		if (numberOfCoalescedDraws < 2)
+		{
+			return 0;
+		}
+
+		// Draw
+		updateGL_ARB_base_instanceEmulation(drawIndexedArguments->startInstanceLocation);
+		if (anyBaseVertex)
+		{
+			glMultiDrawElementsBaseVertex(mOpenGLPrimitiveTopology, counts, indexBuffer->getOpenGLType(), indices, static_cast<GLsizei>(numberOfCoalescedDraws), baseVertices);
+		}
+		else
+		{
+			glMultiDrawElements(mOpenGLPrimitiveTopology, counts, indexBuffer->getOpenGLType(), indices, static_cast<GLsizei>(numberOfCoalescedDraws));
+		}
+		return numberOfCoalescedDraws;
+	}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -1982,6 +1982,7 @@ namespace VulkanRhi
 	//[ Friends                                               ]
 	//[-------------------------------------------------------]
 		friend class GraphicsPipelineState;
+		friend class SwapChain;
 
 
 	//[-------------------------------------------------------]
@@ -2084,6 +2085,7 @@ namespace VulkanRhi
 		void setComputeRootSignature(Rhi::IRootSignature* rootSignature);
 		void setComputePipelineState(Rhi::IComputePipelineState* computePipelineState);
 		void setComputeResourceGroup(uint32_t rootParameterIndex, Rhi::IResourceGroup* resourceGroup);
+		void computeBufferBarrier(Rhi::IBuffer& buffer);
 		//[-------------------------------------------------------]
 		//[ Resource                                              ]
 		//[-------------------------------------------------------]
@@ -2200,6 +2202,7 @@ namespace VulkanRhi
 		RootSignature*		  mComputeRootSignature;	///< Currently set compute root signature (we keep a reference to it), can be a null pointer
 		Rhi::ISamplerState*	  mDefaultSamplerState;		///< Default rasterizer state (we keep a reference to it), can be a null pointer
 		bool				  mInsideVulkanRenderPass;	///< Some Vulkan commands like "vkCmdClearColorImage()" can only be executed outside a Vulkan render pass, so need to delay starting a Vulkan render pass
+		bool				  mPendingVkCommandBufferSubmission;	///< "true" if the Vulkan command buffer was ended by "Rhi::IRhi::endScene()" but not yet submitted by a swap chain present or "Rhi::IRhi::finish()"
 		VkClearValues		  mVkClearValues;
 		//[-------------------------------------------------------]
 		//[ Input-assembler (IA) stage                            ]
@@ -3525,7 +3528,9 @@ namespace VulkanRhi
 				VK_FORMAT_R8G8B8A8_UINT,		// Rhi::VertexAttributeFormat::R8G8B8A8_UINT
 				VK_FORMAT_R16G16_SINT,			// Rhi::VertexAttributeFormat::SHORT_2
 				VK_FORMAT_R16G16B16A16_SINT,	// Rhi::VertexAttributeFormat::SHORT_4
-				VK_FORMAT_R32_UINT				// Rhi::VertexAttributeFormat::UINT_1
+				VK_FORMAT_R32_UINT,				// Rhi::VertexAttributeFormat::UINT_1
+				VK_FORMAT_R16G16_SFLOAT,		// Rhi::VertexAttributeFormat::HALF_2
+				VK_FORMAT_R16G16B16A16_SNORM	// Rhi::VertexAttributeFormat::SHORT_4_SNORM
 			};
 			return MAPPING[static_cast<int>(vertexAttributeFormat)];
 		}
@@ -4948,6 +4953,11 @@ namespace VulkanRhi
 			mVkBuffer(VK_NULL_HANDLE),
 			mVkDeviceMemory(VK_NULL_HANDLE)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsNumberOfBytes(numberOfBytes);
+			#endif
+
 			int vkBufferUsageFlagBits = VK_BUFFER_USAGE_VERTEX_BUFFER_BIT;
 			if ((bufferFlags & Rhi::BufferFlag::UNORDERED_ACCESS) != 0 || (bufferFlags & Rhi::BufferFlag::SHADER_RESOURCE) != 0)
 			{
@@ -5070,6 +5080,11 @@ namespace VulkanRhi
 			mVkBuffer(VK_NULL_HANDLE),
 			mVkDeviceMemory(VK_NULL_HANDLE)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsNumberOfBytes(numberOfBytes);
+			#endif
+
 			int vkBufferUsageFlagBits = VK_BUFFER_USAGE_INDEX_BUFFER_BIT;
 			if ((bufferFlags & Rhi::BufferFlag::UNORDERED_ACCESS) != 0 || (bufferFlags & Rhi::BufferFlag::SHADER_RESOURCE) != 0)
 			{
@@ -5404,6 +5419,11 @@ namespace VulkanRhi
 			mVkDeviceMemory(VK_NULL_HANDLE),
 			mVkBufferView(VK_NULL_HANDLE)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsNumberOfBytes(numberOfBytes);
+			#endif
+
 			// Sanity check
 			RHI_ASSERT(vulkanRhi.getContext(), (numberOfBytes % Rhi::TextureFormat::getNumberOfBytesPerElement(textureFormat)) == 0, "The Vulkan texture buffer size must be a multiple of the selected texture format bytes per texel")
 
@@ -5569,6 +5589,11 @@ namespace VulkanRhi
 			mVkBuffer(VK_NULL_HANDLE),
 			mVkDeviceMemory(VK_NULL_HANDLE)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsNumberOfBytes(numberOfBytes);
+			#endif
+
 			// Sanity checks
 			RHI_ASSERT(vulkanRhi.getContext(), (numberOfBytes % numberOfStructureBytes) == 0, "The Vulkan structured buffer size must be a multiple of the given number of structure bytes")
 			RHI_ASSERT(vulkanRhi.getContext(), (numberOfBytes % (sizeof(float) * 4)) == 0, "Performance: The Vulkan structured buffer should be aligned to a 128-bit stride, see \"Understanding Structured Buffer Performance\" by Evan Hart, posted Apr 17 2015 at 11:33AM - https://developer.nvidia.com/content/understanding-structured-buffer-performance")
@@ -5688,6 +5713,11 @@ namespace VulkanRhi
 			mVkBuffer(VK_NULL_HANDLE),
 			mVkDeviceMemory(VK_NULL_HANDLE)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsNumberOfBytes(numberOfBytes);
+			#endif
+
 			// Sanity checks
 			RHI_ASSERT(vulkanRhi.getContext(), (indirectBufferFlags & Rhi::IndirectBufferFlag::DRAW_ARGUMENTS) != 0 || (indirectBufferFlags & Rhi::IndirectBufferFlag::DRAW_INDEXED_ARGUMENTS) != 0, "Invalid Vulkan flags, indirect buffer element type specification \"DRAW_ARGUMENTS\" or \"DRAW_INDEXED_ARGUMENTS\" is missing")
 			RHI_ASSERT(vulkanRhi.getContext(), !((indirectBufferFlags & Rhi::IndirectBufferFlag::DRAW_ARGUMENTS) != 0 && (indirectBufferFlags & Rhi::IndirectBufferFlag::DRAW_INDEXED_ARGUMENTS) != 0), "Invalid Vulkan flags, indirect buffer element type specification \"DRAW_ARGUMENTS\" or \"DRAW_INDEXED_ARGUMENTS\" must be set, but not both at one and the same time")
@@ -5822,6 +5852,11 @@ namespace VulkanRhi
 			mVkBuffer(VK_NULL_HANDLE),
 			mVkDeviceMemory(VK_NULL_HANDLE)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsNumberOfBytes(numberOfBytes);
+			#endif
+
 			Helper::createAndAllocateVkBuffer(vulkanRhi, static_cast<VkBufferUsageFlagBits>(VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT), VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, numberOfBytes, data, mVkBuffer, mVkDeviceMemory);
 
 			// Assign a default name to the resource for debugging purposes
@@ -6082,6 +6117,11 @@ namespace VulkanRhi
 			mVkDeviceMemory(VK_NULL_HANDLE),
 			mVkImageView(VK_NULL_HANDLE)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsTextureDescription(textureFormat, textureFlags, width);
+			#endif
+
 			Helper::createAndFillVkImage(vulkanRhi, VK_IMAGE_TYPE_1D, VK_IMAGE_VIEW_TYPE_1D, { width, 1, 1 }, textureFormat, data, textureFlags, 1, mVkImage, mVkDeviceMemory, mVkImageView);
 
 			// Assign a default name to the resource for debugging purposes
@@ -6204,6 +6244,11 @@ namespace VulkanRhi
 			mVkImageView(VK_NULL_HANDLE),
 			mVkFormat(Helper::createAndFillVkImage(vulkanRhi, VK_IMAGE_TYPE_1D, VK_IMAGE_VIEW_TYPE_1D_ARRAY, { width, 1, numberOfSlices }, textureFormat, data, textureFlags, 1, mVkImage, mVkDeviceMemory, mVkImageView))
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsTextureDescription(textureFormat, textureFlags, width, 1, 1, numberOfSlices);
+			#endif
+
 			// Assign a default name to the resource for debugging purposes
 			#ifdef RHI_DEBUG
 				if (nullptr != vkDebugMarkerSetObjectNameEXT)
@@ -6359,6 +6404,11 @@ namespace VulkanRhi
 			mVkDeviceMemory(VK_NULL_HANDLE),
 			mVkImageView(VK_NULL_HANDLE)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsTextureDescription(textureFormat, textureFlags, width, height, 1, 1, numberOfMultisamples);
+			#endif
+
 			mVrVulkanTextureData.m_nFormat = Helper::createAndFillVkImage(vulkanRhi, VK_IMAGE_TYPE_2D, VK_IMAGE_VIEW_TYPE_2D, { width, height, 1 }, textureFormat, data, textureFlags, numberOfMultisamples, mVrVulkanTextureData.m_nImage, mVkDeviceMemory, mVkImageView);
 
 			// Fill the rest of the "VRVulkanTextureData_t"-structure
@@ -6533,6 +6583,11 @@ namespace VulkanRhi
 			mVkImageView(VK_NULL_HANDLE),
 			mVkFormat(Helper::createAndFillVkImage(vulkanRhi, VK_IMAGE_TYPE_2D, VK_IMAGE_VIEW_TYPE_2D_ARRAY, { width, height, numberOfSlices }, textureFormat, data, textureFlags, 1, mVkImage, mVkDeviceMemory, mVkImageView))
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsTextureDescription(textureFormat, textureFlags, width, height, 1, numberOfSlices);
+			#endif
+
 			// Assign a default name to the resource for debugging purposes
 			#ifdef RHI_DEBUG
 				if (nullptr != vkDebugMarkerSetObjectNameEXT)
@@ -6667,6 +6722,11 @@ namespace VulkanRhi
 			mVkDeviceMemory(VK_NULL_HANDLE),
 			mVkImageView(VK_NULL_HANDLE)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsTextureDescription(textureFormat, textureFlags, width, height, depth);
+			#endif
+
 			Helper::createAndFillVkImage(vulkanRhi, VK_IMAGE_TYPE_3D, VK_IMAGE_VIEW_TYPE_3D, { width, height, depth }, textureFormat, data, textureFlags, 1, mVkImage, mVkDeviceMemory, mVkImageView);
 
 			// Assign a default name to the resource for debugging purposes
@@ -6786,6 +6846,11 @@ namespace VulkanRhi
 			mVkDeviceMemory(VK_NULL_HANDLE),
 			mVkImageView(VK_NULL_HANDLE)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsTextureDescription(textureFormat, textureFlags, width, width, 1, 6);
+			#endif
+
 			Helper::createAndFillVkImage(vulkanRhi, VK_IMAGE_TYPE_2D, VK_IMAGE_VIEW_TYPE_CUBE, { width, width, 6 }, textureFormat, data, textureFlags, 1, mVkImage, mVkDeviceMemory, mVkImageView);
 
 			// Assign a default name to the resource for debugging purposes
@@ -6907,6 +6972,11 @@ namespace VulkanRhi
 			mVkDeviceMemory(VK_NULL_HANDLE),
 			mVkImageView(VK_NULL_HANDLE)
 		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				setStatisticsTextureDescription(textureFormat, textureFlags, width, width, 1, 6 * numberOfSlices);
+			#endif
+
 			Helper::createAndFillVkImage(vulkanRhi, VK_IMAGE_TYPE_2D, VK_IMAGE_VIEW_TYPE_CUBE_ARRAY, { width, width, numberOfSlices * 6 }, textureFormat, data, textureFlags, 1, mVkImage, mVkDeviceMemory, mVkImageView);
 
 			// Assign a default name to the resource for debugging purposes
@@ -7988,10 +8058,11 @@ namespace VulkanRhi
 			*/
 
 			// Get the Vulkan context
-			const VulkanRhi& vulkanRhi = static_cast<VulkanRhi&>(getRhi());
+			VulkanRhi& vulkanRhi = static_cast<VulkanRhi&>(getRhi());
 			const VulkanContext& vulkanContext = vulkanRhi.getVulkanContext();
 
 			{ // Queue submit
+				vulkanRhi.mPendingVkCommandBufferSubmission = false;
 				const VkPipelineStageFlags waitDstStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
 				const VkCommandBuffer vkCommandBuffer = vulkanContext.getVkCommandBuffer();
 				const VkSubmitInfo vkSubmitInfo =
@@ -11052,6 +11123,12 @@ namespace
 				vkCmdDispatch(static_cast<VulkanRhi::VulkanRhi&>(rhi).getVulkanContext().getVkCommandBuffer(), realData->groupCountX, realData->groupCountY, realData->groupCountZ);
 			}
 
+			void ComputeBufferBarrier(const void* data, Rhi::IRhi& rhi)
+			{
+				const Rhi::Command::ComputeBufferBarrier* realData = static_cast<const Rhi::Command::ComputeBufferBarrier*>(data);
+				static_cast<VulkanRhi::VulkanRhi&>(rhi).computeBufferBarrier(*realData->buffer);
+			}
+
 			//[-------------------------------------------------------]
 			//[ Resource                                              ]
 			//[-------------------------------------------------------]
@@ -11201,6 +11278,7 @@ namespace
 			&ImplementationDispatch::SetComputePipelineState,
 			&ImplementationDispatch::SetComputeResourceGroup,
 			&ImplementationDispatch::DispatchCompute,
+			&ImplementationDispatch::ComputeBufferBarrier,
 			// Resource
 			&ImplementationDispatch::SetTextureMinimumMaximumMipmapIndex,
 			&ImplementationDispatch::ResolveMultisampleFramebuffer,
@@ -11248,6 +11326,7 @@ namespace VulkanRhi
 		mComputeRootSignature(nullptr),
 		mDefaultSamplerState(nullptr),
 		mInsideVulkanRenderPass(false),
+		mPendingVkCommandBufferSubmission(false),
 		mVkClearValues{},
 		mVertexArray(nullptr),
 		mRenderTarget(nullptr)
@@ -11773,6 +11852,95 @@ namespace VulkanRhi
 		}
 	}
 
+	void VulkanRhi::computeBufferBarrier(Rhi::IBuffer& buffer)
+	{
+		// Sanity checks
+		RHI_MATCH_CHECK(*this, buffer)
+		RHI_ASSERT(mContext, !mInsideVulkanRenderPass, "Can't execute compute buffer barrier command inside a Vulkan render pass")
+
+		// Get the Vulkan buffer as well as the pipeline stages and accesses the buffer type can be used with besides compute shaders
+		VkBuffer vkBuffer = VK_NULL_HANDLE;
+		VkPipelineStageFlags vkPipelineStageFlags = VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT;
+		VkAccessFlags vkAccessFlags = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+		switch (buffer.getResourceType())
+		{
+			case Rhi::ResourceType::VERTEX_BUFFER:
+				vkBuffer = static_cast<VertexBuffer&>(buffer).getVkBuffer();
+				vkPipelineStageFlags |= VK_PIPELINE_STAGE_VERTEX_INPUT_BIT;
+				vkAccessFlags |= VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT;
+				break;
+
+			case Rhi::ResourceType::INDEX_BUFFER:
+				vkBuffer = static_cast<IndexBuffer&>(buffer).getVkBuffer();
+				vkPipelineStageFlags |= VK_PIPELINE_STAGE_VERTEX_INPUT_BIT;
+				vkAccessFlags |= VK_ACCESS_INDEX_READ_BIT;
+				break;
+
+			case Rhi::ResourceType::TEXTURE_BUFFER:
+				vkBuffer = static_cast<TextureBuffer&>(buffer).getVkBuffer();
+				vkPipelineStageFlags |= VK_PIPELINE_STAGE_VERTEX_SHADER_BIT | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+				break;
+
+			case Rhi::ResourceType::STRUCTURED_BUFFER:
+				vkBuffer = static_cast<StructuredBuffer&>(buffer).getVkBuffer();
+				vkPipelineStageFlags |= VK_PIPELINE_STAGE_VERTEX_SHADER_BIT | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+				break;
+
+			case Rhi::ResourceType::INDIRECT_BUFFER:
+				// Indirect buffers are host visible, so include host reads for mapping the buffer content for reading after the GPU is done
+				vkBuffer = static_cast<IndirectBuffer&>(buffer).getVkBuffer();
+				vkPipelineStageFlags |= VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT | VK_PIPELINE_STAGE_HOST_BIT;
+				vkAccessFlags |= VK_ACCESS_INDIRECT_COMMAND_READ_BIT | VK_ACCESS_HOST_READ_BIT;
+				break;
+
+			case Rhi::ResourceType::UNIFORM_BUFFER:
+			case Rhi::ResourceType::ROOT_SIGNATURE:
+			case Rhi::ResourceType::RESOURCE_GROUP:
+			case Rhi::ResourceType::GRAPHICS_PROGRAM:
+			case Rhi::ResourceType::VERTEX_ARRAY:
+			case Rhi::ResourceType::RENDER_PASS:
+			case Rhi::ResourceType::QUERY_POOL:
+			case Rhi::ResourceType::SWAP_CHAIN:
+			case Rhi::ResourceType::FRAMEBUFFER:
+			case Rhi::ResourceType::TEXTURE_1D:
+			case Rhi::ResourceType::TEXTURE_1D_ARRAY:
+			case Rhi::ResourceType::TEXTURE_2D:
+			case Rhi::ResourceType::TEXTURE_2D_ARRAY:
+			case Rhi::ResourceType::TEXTURE_3D:
+			case Rhi::ResourceType::TEXTURE_CUBE:
+			case Rhi::ResourceType::TEXTURE_CUBE_ARRAY:
+			case Rhi::ResourceType::GRAPHICS_PIPELINE_STATE:
+			case Rhi::ResourceType::COMPUTE_PIPELINE_STATE:
+			case Rhi::ResourceType::SAMPLER_STATE:
+			case Rhi::ResourceType::VERTEX_SHADER:
+			case Rhi::ResourceType::TESSELLATION_CONTROL_SHADER:
+			case Rhi::ResourceType::TESSELLATION_EVALUATION_SHADER:
+			case Rhi::ResourceType::GEOMETRY_SHADER:
+			case Rhi::ResourceType::FRAGMENT_SHADER:
+			case Rhi::ResourceType::COMPUTE_SHADER:
+			default:
+				// Error!
+				RHI_ASSERT(mContext, false, "Invalid Vulkan compute buffer barrier resource type")
+				return;
+		}
+
+		// Make the compute shader writes to the buffer available to all following accesses and let following compute shader writes wait for all previous accesses
+		// -> Only the source compute shader writes need to be made available, the execution dependency of the source stages is sufficient for write-after-read hazards
+		const VkBufferMemoryBarrier vkBufferMemoryBarrier =
+		{
+			VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER,	// sType (VkStructureType)
+			nullptr,									// pNext (const void*)
+			VK_ACCESS_SHADER_WRITE_BIT,					// srcAccessMask (VkAccessFlags)
+			vkAccessFlags,								// dstAccessMask (VkAccessFlags)
+			VK_QUEUE_FAMILY_IGNORED,					// srcQueueFamilyIndex (uint32_t)
+			VK_QUEUE_FAMILY_IGNORED,					// dstQueueFamilyIndex (uint32_t)
+			vkBuffer,									// buffer (VkBuffer)
+			0,											// offset (VkDeviceSize)
+			VK_WHOLE_SIZE								// size (VkDeviceSize)
+		};
+		vkCmdPipelineBarrier(getVulkanContext().getVkCommandBuffer(), vkPipelineStageFlags, vkPipelineStageFlags, 0, 0, nullptr, 1, &vkBufferMemoryBarrier, 0, nullptr);
+	}
+
 
 	//[-------------------------------------------------------]
 	//[ Resource                                              ]
@@ -12056,8 +12224,12 @@ namespace VulkanRhi
 	//[-------------------------------------------------------]
 	//[ Resource handling                                     ]
 	//[-------------------------------------------------------]
-	bool VulkanRhi::map(Rhi::IResource& resource, uint32_t, Rhi::MapType, uint32_t, Rhi::MappedSubresource& mappedSubresource)
+	bool VulkanRhi::map(Rhi::IResource& resource, [[maybe_unused]] uint32_t subresource, [[maybe_unused]] Rhi::MapType mapType, uint32_t, Rhi::MappedSubresource& mappedSubresource)
 	{
+		#ifdef RHI_STATISTICS
+			getStatistics().currentFrame.countMap(resource, subresource, mapType);
+		#endif
+
 		// Evaluate the resource type
 		switch (resource.getResourceType())
 		{
@@ -12175,6 +12347,10 @@ namespace VulkanRhi
 
 	void VulkanRhi::unmap(Rhi::IResource& resource, uint32_t)
 	{
+		#ifdef RHI_STATISTICS
+			++getStatistics().currentFrame.numberOfUnmaps;
+		#endif
+
 		// Evaluate the resource type
 		switch (resource.getResourceType())
 		{
@@ -12315,7 +12491,7 @@ namespace VulkanRhi
 		switch (vulkanQueryPool.getQueryType())
 		{
 			case Rhi::QueryType::OCCLUSION:
-			case Rhi::QueryType::TIMESTAMP:	// TODO(co) Convert time to nanoseconds, see e.g. http://vulkan-spec-chunked.ahcox.com/ch16s05.html - VkPhysicalDeviceLimits::timestampPeriod - The number of nanoseconds it takes for a timestamp value to be incremented by 1
+			case Rhi::QueryType::TIMESTAMP:	// Ticks, "Rhi::Capabilities::timestampPeriod" is "VkPhysicalDeviceLimits::timestampPeriod"
 			{
 				// Get Vulkan query pool results
 				const VkQueryResultFlags vkQueryResultFlags = 0u;
@@ -12376,19 +12552,20 @@ namespace VulkanRhi
 		RHI_ASSERT(mContext, !commandBuffer.isEmpty(), "The Vulkan command buffer to execute mustn't be empty")
 
 		// Loop through all commands
-		const uint8_t* commandPacketBuffer = commandBuffer.getCommandPacketBuffer();
-		Rhi::ConstCommandPacket constCommandPacket = commandPacketBuffer;
+		Rhi::ConstCommandPacket constCommandPacket = commandBuffer.getFirstCommandPacket();
 		while (nullptr != constCommandPacket)
 		{
 			{ // Submit command packet
 				const Rhi::CommandDispatchFunctionIndex commandDispatchFunctionIndex = Rhi::CommandPacketHelper::loadCommandDispatchFunctionIndex(constCommandPacket);
 				const void* command = Rhi::CommandPacketHelper::loadCommand(constCommandPacket);
+				#ifdef RHI_STATISTICS
+					getStatistics().currentFrame.countCommandPacket(commandDispatchFunctionIndex, command);
+				#endif
 				detail::DISPATCH_FUNCTIONS[static_cast<uint32_t>(commandDispatchFunctionIndex)](command, *this);
 			}
 
 			{ // Next command
-				const uint32_t nextCommandPacketByteIndex = Rhi::CommandPacketHelper::getNextCommandPacketByteIndex(constCommandPacket);
-				constCommandPacket = (~0u != nextCommandPacketByteIndex) ? &commandPacketBuffer[nextCommandPacketByteIndex] : nullptr;
+				constCommandPacket = Rhi::CommandPacketHelper::getNextCommandPacket(constCommandPacket);
 			}
 		}
 	}
@@ -12408,7 +12585,12 @@ namespace VulkanRhi
 		unsetGraphicsVertexArray();
 
 		// End Vulkan command buffer
-		if (vkEndCommandBuffer(getVulkanContext().getVkCommandBuffer()) != VK_SUCCESS)
+		if (vkEndCommandBuffer(getVulkanContext().getVkCommandBuffer()) == VK_SUCCESS)
+		{
+			// The swap chain present will submit the Vulkan command buffer, without one "Rhi::IRhi::finish()" has to do it
+			mPendingVkCommandBufferSubmission = true;
+		}
+		else
 		{
 			// Error!
 			RHI_LOG(getContext(), CRITICAL, "Failed to end Vulkan command buffer instance")
@@ -12426,7 +12608,43 @@ namespace VulkanRhi
 
 	void VulkanRhi::finish()
 	{
-		// TODO(co) Implement me
+		// Sanity check
+		#ifdef RHI_DEBUG
+			RHI_ASSERT(mContext, false == mDebugBetweenBeginEndScene, "Vulkan: Finish was called while scene rendering is in progress, missing end scene call?")
+		#endif
+
+		// Submit the Vulkan command buffer in case there was no swap chain present doing so, e.g. headless rendering into framebuffers
+		const VkQueue vkQueue = getVulkanContext().getGraphicsVkQueue();
+		if (mPendingVkCommandBufferSubmission)
+		{
+			mPendingVkCommandBufferSubmission = false;
+			const VkCommandBuffer vkCommandBuffer = getVulkanContext().getVkCommandBuffer();
+			const VkSubmitInfo vkSubmitInfo =
+			{
+				VK_STRUCTURE_TYPE_SUBMIT_INFO,	// sType (VkStructureType)
+				nullptr,						// pNext (const void*)
+				0,								// waitSemaphoreCount (uint32_t)
+				nullptr,						// pWaitSemaphores (const VkSemaphore*)
+				nullptr,						// pWaitDstStageMask (const VkPipelineStageFlags*)
+				1,								// commandBufferCount (uint32_t)
+				&vkCommandBuffer,				// pCommandBuffers (const VkCommandBuffer*)
+				0,								// signalSemaphoreCount (uint32_t)
+				nullptr							// pSignalSemaphores (const VkSemaphore*)
+			};
+			if (vkQueueSubmit(vkQueue, 1, &vkSubmitInfo, VK_NULL_HANDLE) != VK_SUCCESS)
+			{
+				// Error!
+				RHI_LOG(mContext, CRITICAL, "Vulkan queue submit failed")
+				return;
+			}
+		}
+
+		// Wait until the GPU is done
+		if (vkQueueWaitIdle(vkQueue) != VK_SUCCESS)
+		{
+			// Error!
+			RHI_LOG(mContext, CRITICAL, "Vulkan queue wait idle failed")
+		}
 	}
 
 
@@ -12435,12 +12653,16 @@ namespace VulkanRhi
 	//[-------------------------------------------------------]
 	void VulkanRhi::initializeCapabilities()
 	{
-		{ // Get device name
+		{ // Get device name and timestamp period
 			VkPhysicalDeviceProperties vkPhysicalDeviceProperties;
 			vkGetPhysicalDeviceProperties(mVulkanContext->getVkPhysicalDevice(), &vkPhysicalDeviceProperties);
 			const size_t numberOfCharacters = ::detail::countof(mCapabilities.deviceName) - 1;
 			strncpy(mCapabilities.deviceName, vkPhysicalDeviceProperties.deviceName, numberOfCharacters);
 			mCapabilities.deviceName[numberOfCharacters] = '\0';
+
+			// Vulkan timestamp queries return ticks, "VkPhysicalDeviceLimits::timestampPeriod" is the number of nanoseconds it takes for a timestamp value to be incremented by one
+			// -> See "VkPhysicalDeviceLimits::timestampComputeAndGraphics", without it timestamps aren't supported by all graphics and compute queues
+			mCapabilities.timestampPeriod = vkPhysicalDeviceProperties.limits.timestampComputeAndGraphics ? vkPhysicalDeviceProperties.limits.timestampPeriod : 0.0f;
 		}
 
 		// Preferred swap chain texture format
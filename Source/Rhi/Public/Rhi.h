@@ -318,6 +318,7 @@ PRAGMA_WARNING_POP
 //[-------------------------------------------------------]
 namespace Rhi
 {
+	enum class CommandDispatchFunctionIndex : uint8_t;
 	class ILog;
 	class IAssert;
 	class Context;
@@ -2606,7 +2607,9 @@ namespace Rhi
 		R8G8B8A8_UINT	= 5,	///< Unsigned byte 4 (four components per element, 8 bit integer per component), supported by DirectX 9, DirectX 10, DirectX 11, OpenGL and OpenGL ES 3
 		SHORT_2			= 6,	///< Short 2 (two components per element, 16 bit integer per component), supported by DirectX 9, DirectX 10, DirectX 11, OpenGL and OpenGL ES 3
 		SHORT_4			= 7,	///< Short 4 (four components per element, 16 bit integer per component), supported by DirectX 9, DirectX 10, DirectX 11, OpenGL and OpenGL ES 3
-		UINT_1			= 8		///< Unsigned integer 1 (one components per element, 32 bit unsigned integer per component), supported by DirectX 10, DirectX 11, OpenGL and OpenGL ES 3
+		UINT_1			= 8,	///< Unsigned integer 1 (one components per element, 32 bit unsigned integer per component), supported by DirectX 10, DirectX 11, OpenGL and OpenGL ES 3
+		HALF_2			= 9,	///< Half 2 (two components per element, 16 bit floating point per component), supported by DirectX 9, DirectX 10, DirectX 11, OpenGL and OpenGL ES 3
+		SHORT_4_SNORM	= 10	///< Short 4 (four components per element, 16 bit integer per component), will be passed in a signed normalized form into shaders, supported by DirectX 9, DirectX 10, DirectX 11, OpenGL and OpenGL ES 3
 	};
 	/**
 	*  @brief
@@ -3299,7 +3302,7 @@ namespace Rhi
 	{
 		OCCLUSION			= 0,	///< Occlusion query, result is a "uint64_t" containing the number of passed samples
 		PIPELINE_STATISTICS = 1,	///< Pipeline statistics query, result is a "Rhi::PipelineStatisticsQueryResult"
-		TIMESTAMP			= 2		///< Timestamp query, result is a "uint64_t" containing a timestamp in nanosecond
+		TIMESTAMP			= 2		///< Timestamp query, result is a "uint64_t" containing a timestamp in RHI implementation specific ticks, see "Rhi::Capabilities::timestampPeriod"
 	};
 
 	/**
@@ -3764,6 +3767,7 @@ namespace Rhi
 		uint32_t			maximumStructuredBufferSize;					///< Maximum structured buffer size in bytes (>65536, typically much larger than that of one-dimensional texture, in case there's no support for structured buffer it's 0)
 		uint32_t			maximumIndirectBufferSize;						///< Maximum indirect buffer size in bytes
 		uint32_t			maximumUniformBufferSize;						///< Maximum uniform buffer (UBO) size in bytes (usually at least 4096 *16 bytes, in case there's no support for uniform buffer it's 0)
+		float				timestampPeriod;								///< Number of nanoseconds it takes for a timestamp query result to be incremented by one (1 if timestamps are already in nanoseconds, in case there's no support for timestamp queries it's 0)
 		uint8_t				maximumNumberOfMultisamples;					///< Maximum number of multisamples (always at least 1, usually 8)
 		uint8_t				maximumAnisotropy;								///< Maximum anisotropy (always at least 1, usually 16)
 		bool				upperLeftOrigin;								///< Upper left origin (true for Vulkan, Direct3D, OpenGL with "GL_ARB_clip_control"-extension)
@@ -3805,6 +3809,7 @@ namespace Rhi
 			maximumStructuredBufferSize(0),
 			maximumIndirectBufferSize(0),
 			maximumUniformBufferSize(0),
+			timestampPeriod(0.0f),
 			maximumNumberOfMultisamples(1),
 			maximumAnisotropy(1),
 			upperLeftOrigin(true),
@@ -3854,8 +3859,50 @@ namespace Rhi
 		class Statistics final
 		{
 
+		// Public definitions
+		public:
+			static constexpr uint32_t MAXIMUM_NUMBER_OF_COMMAND_DISPATCH_FUNCTIONS = 32;	///< Must be at least "Rhi::CommandDispatchFunctionIndex::NUMBER_OF_FUNCTIONS", checked by a static assert
+
+			/**
+			*  @brief
+			*    Per-frame statistics
+			*
+			*  @note
+			*    - Gathered by the RHI implementation while submitting command buffers as well as inside "Rhi::IRhi::map()" and "Rhi::IRhi::unmap()"
+			*    - The written bytes are the sizes of the buffers respectively texture subresources mapped for writing, the RHI can't see how many bytes the caller actually writes into the mapped memory
+			*    - Not thread-safe by intent, the counters are meant to be updated by the thread feeding the RHI implementation
+			*    - Instances and vertices can only be gathered for draws which have their draw arguments inside the command auxiliary
+			*      memory or inside an emulated indirect buffer, draw arguments inside GPU memory are not visible to the CPU
+			*/
+			struct FrameStatistics final
+			{
+				uint32_t numberOfCommandPackets[MAXIMUM_NUMBER_OF_COMMAND_DISPATCH_FUNCTIONS];	///< Number of submitted command packets by "Rhi::CommandDispatchFunctionIndex", includes e.g. graphics pipeline state, resource group and vertex array bindings
+				uint32_t numberOfDraws;					///< Number of draws, each draw inside multi-draw and indirect draw command packets is counted individually
+				uint32_t numberOfSubmittedInstances;	///< Number of submitted instances, see class notes
+				uint64_t numberOfSubmittedVertices;		///< Number of submitted vertices respectively indices for indexed draws, see class notes
+				uint32_t numberOfMaps;					///< Number of "Rhi::IRhi::map()" calls
+				uint32_t numberOfUnmaps;				///< Number of "Rhi::IRhi::unmap()" calls
+				uint64_t numberOfWrittenBytes;			///< Number of bytes mapped for writing via "Rhi::IRhi::map()", see class notes
+
+				inline FrameStatistics()
+				{
+					reset();
+				}
+
+				inline void reset()
+				{
+					memset(this, 0, sizeof(FrameStatistics));
+				}
+
+				inline void countCommandPacket(CommandDispatchFunctionIndex commandDispatchFunctionIndex, const void* command);	// Defined after the concrete commands
+				inline void countMap(const IResource& resource, uint32_t subresource, MapType mapType);							// Defined after the concrete commands
+			};
+
 		// Public data
 		public:
+			// Per-frame
+			FrameStatistics currentFrame;	///< Per-frame statistics of the frame which is currently in progress
+			FrameStatistics lastFrame;		///< Per-frame statistics of the last finished frame, see "Rhi::IRhi::nextStatisticsFrame()"
 			// Resources
 			std::atomic<uint32_t> currentNumberOfRootSignatures;				///< Current number of root signature instances
 			std::atomic<uint32_t> numberOfCreatedRootSignatures;				///< Number of created root signature instances
@@ -3922,6 +3969,9 @@ namespace Rhi
 			std::atomic<uint32_t> numberOfCreatedFragmentShaders;				///< Number of created fragment shader (FS, "pixel shader" in Direct3D terminology) instances
 			std::atomic<uint32_t> currentNumberOfComputeShaders;				///< Current number of compute shader (CS) instances
 			std::atomic<uint32_t> numberOfCreatedComputeShaders;				///< Number of created compute shader (CS) instances
+			// Memory
+			std::atomic<uint64_t> currentNumberOfBufferBytes;					///< Current number of bytes of all buffer instances, gathered by the RHI implementation when creating buffers
+			std::atomic<uint64_t> currentNumberOfTextureBytes;					///< Current number of bytes of all texture instances including mipmaps, gathered by the RHI implementation when creating textures
 
 		// Public methods
 		public:
@@ -3994,7 +4044,10 @@ namespace Rhi
 				currentNumberOfFragmentShaders(0),
 				numberOfCreatedFragmentShaders(0),
 				currentNumberOfComputeShaders(0),
-				numberOfCreatedComputeShaders(0)
+				numberOfCreatedComputeShaders(0),
+				// Memory
+				currentNumberOfBufferBytes(0),
+				currentNumberOfTextureBytes(0)
 			{}
 
 			/**
@@ -4112,10 +4165,24 @@ namespace Rhi
 				RHI_LOG(context, INFORMATION, "Fragment shaders: %u", currentNumberOfFragmentShaders.load())
 				RHI_LOG(context, INFORMATION, "Compute shaders: %u", currentNumberOfComputeShaders.load())
 
+				// Memory
+				RHI_LOG(context, INFORMATION, "Buffer bytes: %llu", static_cast<unsigned long long>(currentNumberOfBufferBytes.load()))
+				RHI_LOG(context, INFORMATION, "Texture bytes: %llu", static_cast<unsigned long long>(currentNumberOfTextureBytes.load()))
+
 				// End
 				RHI_LOG(context, INFORMATION, "***************************************************")
 			}
 
+			/**
+			*  @brief
+			*    Finish the per-frame statistics of the current frame and start a new frame
+			*/
+			inline void nextFrame()
+			{
+				lastFrame = currentFrame;
+				currentFrame.reset();
+			}
+
 		// Private methods
 		private:
 			explicit Statistics(const Statistics& source) = delete;
@@ -4180,12 +4247,14 @@ namespace Rhi
 		friend class IQueryPool;
 		friend class ISwapChain;
 		friend class IFramebuffer;
+		friend class IBuffer;
 		friend class IVertexBuffer;
 		friend class IIndexBuffer;
 		friend class ITextureBuffer;
 		friend class IStructuredBuffer;
 		friend class IIndirectBuffer;
 		friend class IUniformBuffer;
+		friend class ITexture;
 		friend class ITexture1D;
 		friend class ITexture1DArray;
 		friend class ITexture2D;
@@ -4277,6 +4346,18 @@ namespace Rhi
 			{
 				return mStatistics;
 			}
+
+			/**
+			*  @brief
+			*    Finish the per-frame statistics of the current frame and start a new frame
+			*
+			*  @note
+			*    - Call this once per frame, the results of the finished frame are available via "Rhi::Statistics::lastFrame"
+			*/
+			inline void nextStatisticsFrame()
+			{
+				mStatistics.nextFrame();
+			}
 		#endif
 
 	// Public virtual Rhi::IRhi methods
@@ -6359,7 +6440,29 @@ namespace Rhi
 		*    Destructor
 		*/
 		inline virtual ~IBuffer() override
-		{}
+		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				if (0 != mStatisticsNumberOfBytes)
+				{
+					getRhi().getStatistics().currentNumberOfBufferBytes -= mStatisticsNumberOfBytes;
+				}
+			#endif
+		}
+
+		#ifdef RHI_STATISTICS
+			/**
+			*  @brief
+			*    Return the number of bytes of the buffer
+			*
+			*  @return
+			*    The number of bytes of the buffer, zero if the RHI implementation didn't provide it
+			*/
+			[[nodiscard]] inline uint64_t getStatisticsNumberOfBytes() const
+			{
+				return mStatisticsNumberOfBytes;
+			}
+		#endif
 
 	// Protected methods
 	protected:
@@ -6375,6 +6478,9 @@ namespace Rhi
 		*/
 		inline explicit IBuffer(ResourceType resourceType RHI_RESOURCE_DEBUG_NAME_PARAMETER_NO_DEFAULT) :
 			IResource(resourceType RHI_RESOURCE_DEBUG_PASS_PARAMETER)
+			#ifdef RHI_STATISTICS
+				, mStatisticsNumberOfBytes(0)
+			#endif
 		{}
 
 		/**
@@ -6388,11 +6494,38 @@ namespace Rhi
 		*/
 		inline IBuffer(ResourceType resourceType, IRhi& rhi RHI_RESOURCE_DEBUG_NAME_PARAMETER_NO_DEFAULT) :
 			IResource(resourceType, rhi RHI_RESOURCE_DEBUG_PASS_PARAMETER)
+			#ifdef RHI_STATISTICS
+				, mStatisticsNumberOfBytes(0)
+			#endif
 		{}
 
+		#ifdef RHI_STATISTICS
+			/**
+			*  @brief
+			*    Set the number of bytes of the buffer
+			*
+			*  @param[in] numberOfBytes
+			*    Number of bytes of the buffer
+			*
+			*  @note
+			*    - To be called once by the RHI implementation when creating the buffer, the destructor removes the bytes from the statistics again
+			*/
+			inline void setStatisticsNumberOfBytes(uint64_t numberOfBytes)
+			{
+				getRhi().getStatistics().currentNumberOfBufferBytes += numberOfBytes - mStatisticsNumberOfBytes;
+				mStatisticsNumberOfBytes = numberOfBytes;
+			}
+		#endif
+
 		explicit IBuffer(const IBuffer& source) = delete;
 		IBuffer& operator =(const IBuffer& source) = delete;
 
+	// Private data
+	private:
+		#ifdef RHI_STATISTICS
+			uint64_t mStatisticsNumberOfBytes;	///< Number of bytes of the buffer, see "Rhi::IBuffer::setStatisticsNumberOfBytes()"
+		#endif
+
 	};
 
 	typedef SmartRefCount<IBuffer> IBufferPtr;
@@ -7225,6 +7358,38 @@ namespace Rhi
 			getMipmapSize(mipmapIndex, depth);
 		}
 
+		/**
+		*  @brief
+		*    Calculate the number of bytes of a texture
+		*
+		*  @param[in] textureFormat
+		*    Texture format
+		*  @param[in] textureFlags
+		*    Texture flags, see "Rhi::TextureFlag::Enum", the complete mipmap chain is taken into account if "Rhi::TextureFlag::DATA_CONTAINS_MIPMAPS" or "Rhi::TextureFlag::GENERATE_MIPMAPS" is set
+		*  @param[in] width
+		*    Texture width
+		*  @param[in] height
+		*    Texture height
+		*  @param[in] depth
+		*    Texture depth, for array and cube textures multiply the result by the number of slices and faces instead
+		*
+		*  @return
+		*    Number of bytes
+		*/
+		[[nodiscard]] static inline uint64_t getNumberOfBytes(TextureFormat::Enum textureFormat, uint32_t textureFlags, uint32_t width, uint32_t height = 1, uint32_t depth = 1)
+		{
+			const uint32_t numberOfMipmaps = ((textureFlags & TextureFlag::DATA_CONTAINS_MIPMAPS) || (textureFlags & TextureFlag::GENERATE_MIPMAPS)) ? getNumberOfMipmaps(width, height, depth) : 1;
+			uint64_t numberOfBytes = 0;
+			for (uint32_t mipmap = 0; mipmap < numberOfMipmaps; ++mipmap)
+			{
+				numberOfBytes += static_cast<uint64_t>(TextureFormat::getNumberOfBytesPerSlice(textureFormat, width, height)) * depth;
+				width = getHalfSize(width);
+				height = getHalfSize(height);
+				depth = getHalfSize(depth);
+			}
+			return numberOfBytes;
+		}
+
 	// Public methods
 	public:
 		/**
@@ -7232,7 +7397,52 @@ namespace Rhi
 		*    Destructor
 		*/
 		inline virtual ~ITexture() override
-		{}
+		{
+			#ifdef RHI_STATISTICS
+				// Update the statistics
+				if (0 != mStatisticsNumberOfBytes)
+				{
+					getRhi().getStatistics().currentNumberOfTextureBytes -= mStatisticsNumberOfBytes;
+				}
+			#endif
+		}
+
+		#ifdef RHI_STATISTICS
+			/**
+			*  @brief
+			*    Return the number of bytes of the texture
+			*
+			*  @return
+			*    The number of bytes of the texture including mipmaps, zero if the RHI implementation didn't provide it
+			*/
+			[[nodiscard]] inline uint64_t getStatisticsNumberOfBytes() const
+			{
+				return mStatisticsNumberOfBytes;
+			}
+
+			/**
+			*  @brief
+			*    Return the number of bytes of a texture subresource
+			*
+			*  @param[in] subresource
+			*    Subresource index, "<mipmap index> + <slice index> * <number of mipmaps>" as used by "Rhi::IRhi::map()"
+			*
+			*  @return
+			*    The number of bytes of the given texture subresource, zero if the RHI implementation didn't provide the texture description
+			*/
+			[[nodiscard]] inline uint64_t getStatisticsNumberOfSubresourceBytes(uint32_t subresource) const
+			{
+				if (0 == mStatisticsNumberOfMipmaps)
+				{
+					return 0;
+				}
+				uint32_t width = mStatisticsWidth;
+				uint32_t height = mStatisticsHeight;
+				uint32_t depth = mStatisticsDepth;
+				getMipmapSize(subresource % mStatisticsNumberOfMipmaps, width, height, depth);
+				return static_cast<uint64_t>(TextureFormat::getNumberOfBytesPerSlice(mStatisticsTextureFormat, width, height)) * depth * mStatisticsNumberOfMultisamples;
+			}
+		#endif
 
 	// Protected methods
 	protected:
@@ -7247,11 +7457,69 @@ namespace Rhi
 		*/
 		inline ITexture(ResourceType resourceType, IRhi& rhi RHI_RESOURCE_DEBUG_NAME_PARAMETER_NO_DEFAULT) :
 			IResource(resourceType, rhi RHI_RESOURCE_DEBUG_PASS_PARAMETER)
+			#ifdef RHI_STATISTICS
+				, mStatisticsNumberOfBytes(0),
+				mStatisticsTextureFormat(TextureFormat::UNKNOWN),
+				mStatisticsWidth(0),
+				mStatisticsHeight(0),
+				mStatisticsDepth(0),
+				mStatisticsNumberOfMipmaps(0),
+				mStatisticsNumberOfMultisamples(0)
+			#endif
 		{}
 
+		#ifdef RHI_STATISTICS
+			/**
+			*  @brief
+			*    Set the texture description the memory statistics are derived from
+			*
+			*  @param[in] textureFormat
+			*    Texture format
+			*  @param[in] textureFlags
+			*    Texture flags, see "Rhi::TextureFlag::Enum", the complete mipmap chain is taken into account if "Rhi::TextureFlag::DATA_CONTAINS_MIPMAPS" or "Rhi::TextureFlag::GENERATE_MIPMAPS" is set
+			*  @param[in] width
+			*    Texture width
+			*  @param[in] height
+			*    Texture height
+			*  @param[in] depth
+			*    Texture depth
+			*  @param[in] numberOfSlices
+			*    Number of array slices, for cube textures six per cube
+			*  @param[in] numberOfMultisamples
+			*    Number of multisamples per pixel
+			*
+			*  @note
+			*    - To be called once by the RHI implementation when creating the texture, the destructor removes the bytes from the statistics again
+			*/
+			inline void setStatisticsTextureDescription(TextureFormat::Enum textureFormat, uint32_t textureFlags, uint32_t width, uint32_t height = 1, uint32_t depth = 1, uint32_t numberOfSlices = 1, uint8_t numberOfMultisamples = 1)
+			{
+				const uint64_t numberOfBytes = getNumberOfBytes(textureFormat, textureFlags, width, height, depth) * numberOfSlices * numberOfMultisamples;
+				getRhi().getStatistics().currentNumberOfTextureBytes += numberOfBytes - mStatisticsNumberOfBytes;
+				mStatisticsNumberOfBytes = numberOfBytes;
+				mStatisticsTextureFormat = textureFormat;
+				mStatisticsWidth = width;
+				mStatisticsHeight = height;
+				mStatisticsDepth = depth;
+				mStatisticsNumberOfMipmaps = ((textureFlags & TextureFlag::DATA_CONTAINS_MIPMAPS) || (textureFlags & TextureFlag::GENERATE_MIPMAPS)) ? getNumberOfMipmaps(width, height, depth) : 1;
+				mStatisticsNumberOfMultisamples = numberOfMultisamples;
+			}
+		#endif
+
 		explicit ITexture(const ITexture& source) = delete;
 		ITexture& operator =(const ITexture& source) = delete;
 
+	// Private data
+	private:
+		#ifdef RHI_STATISTICS
+			uint64_t			mStatisticsNumberOfBytes;			///< Number of bytes of the texture including mipmaps, see "Rhi::ITexture::setStatisticsTextureDescription()"
+			TextureFormat::Enum mStatisticsTextureFormat;
+			uint32_t			mStatisticsWidth;
+			uint32_t			mStatisticsHeight;
+			uint32_t			mStatisticsDepth;
+			uint32_t			mStatisticsNumberOfMipmaps;			///< Zero if the RHI implementation didn't provide the texture description
+			uint8_t				mStatisticsNumberOfMultisamples;
+		#endif
+
 	};
 
 	typedef SmartRefCount<ITexture> ITexturePtr;
@@ -8623,6 +8891,7 @@ namespace Rhi
 		SET_COMPUTE_PIPELINE_STATE,
 		SET_COMPUTE_RESOURCE_GROUP,
 		DISPATCH_COMPUTE,
+		COMPUTE_BUFFER_BARRIER,
 		// Resource
 		SET_TEXTURE_MINIMUM_MAXIMUM_MIPMAP_INDEX,
 		RESOLVE_MULTISAMPLE_FRAMEBUFFER,
@@ -8648,29 +8917,30 @@ namespace Rhi
 	// Global functions
 	namespace CommandPacketHelper
 	{
-		static constexpr uint32_t OFFSET_NEXT_COMMAND_PACKET_BYTE_INDEX		= 0u;
-		static constexpr uint32_t OFFSET_IMPLEMENTATION_DISPATCH_FUNCTION	= OFFSET_NEXT_COMMAND_PACKET_BYTE_INDEX + sizeof(uint32_t);
-		static constexpr uint32_t OFFSET_COMMAND							= OFFSET_IMPLEMENTATION_DISPATCH_FUNCTION + sizeof(uint32_t);	// Don't use "sizeof(CommandDispatchFunctionIndex)" instead of "sizeof(uint32_t)" so we have a known alignment
+		static constexpr uint32_t OFFSET_NEXT_COMMAND_PACKET				= 0u;
+		static constexpr uint32_t OFFSET_IMPLEMENTATION_DISPATCH_FUNCTION	= OFFSET_NEXT_COMMAND_PACKET + sizeof(CommandPacket);
+		static constexpr uint32_t OFFSET_COMMAND							= OFFSET_IMPLEMENTATION_DISPATCH_FUNCTION + sizeof(CommandPacket);	// Don't use "sizeof(CommandDispatchFunctionIndex)" instead of "sizeof(CommandPacket)" so we have a known alignment
+		static constexpr uint32_t COMMAND_PACKET_ALIGNMENT					= sizeof(CommandPacket);	// Command packets start with a pointer to the next command packet
 
 		template <typename T>
 		[[nodiscard]] inline uint32_t getNumberOfBytes(uint32_t numberOfAuxiliaryBytes)
 		{
-			return OFFSET_COMMAND + sizeof(T) + numberOfAuxiliaryBytes;
+			return (OFFSET_COMMAND + sizeof(T) + numberOfAuxiliaryBytes + COMMAND_PACKET_ALIGNMENT - 1) & ~(COMMAND_PACKET_ALIGNMENT - 1);
 		}
 
-		[[nodiscard]] inline uint32_t getNextCommandPacketByteIndex(const CommandPacket commandPacket)
+		[[nodiscard]] inline CommandPacket getNextCommandPacket(const CommandPacket commandPacket)
 		{
-			return *reinterpret_cast<const uint32_t*>(reinterpret_cast<const uint8_t*>(commandPacket) + OFFSET_NEXT_COMMAND_PACKET_BYTE_INDEX);
+			return *reinterpret_cast<const CommandPacket*>(reinterpret_cast<const uint8_t*>(commandPacket) + OFFSET_NEXT_COMMAND_PACKET);
 		}
 
-		[[nodiscard]] inline uint32_t getNextCommandPacketByteIndex(const ConstCommandPacket constCommandPacket)
+		[[nodiscard]] inline ConstCommandPacket getNextCommandPacket(const ConstCommandPacket constCommandPacket)
 		{
-			return *reinterpret_cast<const uint32_t*>(reinterpret_cast<const uint8_t*>(constCommandPacket) + OFFSET_NEXT_COMMAND_PACKET_BYTE_INDEX);
+			return *reinterpret_cast<const ConstCommandPacket*>(reinterpret_cast<const uint8_t*>(constCommandPacket) + OFFSET_NEXT_COMMAND_PACKET);
 		}
 
-		inline void storeNextCommandPacketByteIndex(const CommandPacket commandPacket, uint32_t nextPacketByteIndex)
+		inline void storeNextCommandPacket(const CommandPacket commandPacket, CommandPacket nextCommandPacket)
 		{
-			*reinterpret_cast<uint32_t*>(reinterpret_cast<uint8_t*>(commandPacket) + OFFSET_NEXT_COMMAND_PACKET_BYTE_INDEX) = nextPacketByteIndex;
+			*reinterpret_cast<CommandPacket*>(reinterpret_cast<uint8_t*>(commandPacket) + OFFSET_NEXT_COMMAND_PACKET) = nextCommandPacket;
 		}
 
 		[[nodiscard]] inline CommandDispatchFunctionIndex* getCommandDispatchFunctionIndex(const CommandPacket commandPacket)
@@ -8716,7 +8986,7 @@ namespace Rhi
 
 		/**
 		*  @brief
-		*    Return auxiliary memory address of the given command; returned memory address is considered unstable and might change as soon as another command is added
+		*    Return auxiliary memory address of the given command; command packets are never moved once written, so the returned memory address stays valid until the command buffer is cleared
 		*/
 		template <typename T>
 		[[nodiscard]] inline uint8_t* getAuxiliaryMemory(T* command)
@@ -8726,7 +8996,7 @@ namespace Rhi
 
 		/**
 		*  @brief
-		*    Return auxiliary memory address of the given command; returned memory address is considered unstable and might change as soon as another command is added
+		*    Return auxiliary memory address of the given command; command packets are never moved once written, so the returned memory address stays valid until the command buffer is cleared
 		*/
 		template <typename T>
 		[[nodiscard]] inline const uint8_t* getAuxiliaryMemory(const T* command)
@@ -8750,7 +9020,8 @@ namespace Rhi
 	*    batching and instancing. Also the memory management is much simplified to be cache friendly.
 	*
 	*  @note
-	*    - The commands are stored as a flat contiguous array to be cache friendly
+	*    - The commands are stored as flat contiguous arrays inside linked fixed-size memory blocks to be cache friendly, command packets are never moved once written
+	*    - Memory blocks are kept when the command buffer is cleared, so a command buffer which is recorded each frame acts as a frame arena without memory allocations once warmed up
 	*    - Each command can have an additional auxiliary buffer, e.g. to store uniform buffer data to submit to the RHI
 	*    - It's valid to record a command buffer only once, and submit it multiple times to the RHI
 	*/
@@ -8764,10 +9035,10 @@ namespace Rhi
 		*    Default constructor
 		*/
 		inline CommandBuffer() :
-			mCommandPacketBufferNumberOfBytes(0),
-			mCommandPacketBuffer(nullptr),
-			mPreviousCommandPacketByteIndex(~0u),
-			mCurrentCommandPacketByteIndex(0)
+			mFirstCommandPacketBlock(nullptr),
+			mCurrentCommandPacketBlock(nullptr),
+			mFirstCommandPacket(nullptr),
+			mPreviousCommandPacket(nullptr)
 			#ifdef RHI_STATISTICS
 				, mNumberOfCommands(0)
 			#endif
@@ -8779,7 +9050,13 @@ namespace Rhi
 		*/
 		inline ~CommandBuffer()
 		{
-			delete [] mCommandPacketBuffer;
+			CommandPacketBlock* commandPacketBlock = mFirstCommandPacketBlock;
+			while (nullptr != commandPacketBlock)
+			{
+				CommandPacketBlock* nextCommandPacketBlock = commandPacketBlock->nextCommandPacketBlock;
+				delete [] reinterpret_cast<uint8_t*>(commandPacketBlock);
+				commandPacketBlock = nextCommandPacketBlock;
+			}
 		}
 
 		/**
@@ -8791,7 +9068,7 @@ namespace Rhi
 		*/
 		[[nodiscard]] inline bool isEmpty() const
 		{
-			return (~0u == mPreviousCommandPacketByteIndex);
+			return (nullptr == mPreviousCommandPacket);
 		}
 
 		#ifdef RHI_STATISTICS
@@ -8813,27 +9090,32 @@ namespace Rhi
 
 		/**
 		*  @brief
-		*    Return the command packet buffer
+		*    Return the first command packet
 		*
 		*  @return
-		*    The command packet buffer, can be a null pointer, don't destroy the instance
+		*    The first command packet, null pointer if the command buffer is empty, don't destroy the instance
 		*
 		*  @note
 		*    - Internal, don't access the method if you don't have to
+		*    - Use "Rhi::CommandPacketHelper::getNextCommandPacket()" to iterate through the command packets, null pointer marks the end
 		*/
-		[[nodiscard]] inline const uint8_t* getCommandPacketBuffer() const
+		[[nodiscard]] inline ConstCommandPacket getFirstCommandPacket() const
 		{
-			return (~0u != mPreviousCommandPacketByteIndex) ? mCommandPacketBuffer : nullptr;
+			return (nullptr != mPreviousCommandPacket) ? mFirstCommandPacket : nullptr;
 		}
 
 		/**
 		*  @brief
 		*    Clear the command buffer
+		*
+		*  @note
+		*    - The memory blocks are kept and reused by the next recording
 		*/
 		inline void clear()
 		{
-			mPreviousCommandPacketByteIndex = ~0u;
-			mCurrentCommandPacketByteIndex = 0;
+			mCurrentCommandPacketBlock = nullptr;
+			mFirstCommandPacket = nullptr;
+			mPreviousCommandPacket = nullptr;
 			#ifdef RHI_STATISTICS
 				mNumberOfCommands = 0;
 			#endif
@@ -8855,41 +9137,10 @@ namespace Rhi
 			// How many command package buffer bytes are consumed by the command to add?
 			const uint32_t numberOfCommandBytes = CommandPacketHelper::getNumberOfBytes<U>(numberOfAuxiliaryBytes);
 
-			// 4294967295 is the maximum value of an "uint32_t"-type: Check for overflow
-			// -> We use the magic number here to avoid "std::numeric_limits::max()" usage
-			ASSERT((static_cast<uint64_t>(mCurrentCommandPacketByteIndex) + numberOfCommandBytes) < 4294967295u, "Invalid current command packet byte index")
-
-			// Grow command packet buffer, if required
-			if (mCommandPacketBufferNumberOfBytes < mCurrentCommandPacketByteIndex + numberOfCommandBytes)
-			{
-				// Allocate new memory, grow using a known value but do also add the number of bytes consumed by the current command to add (many auxiliary bytes might be requested)
-				const uint32_t newCommandPacketBufferNumberOfBytes = mCommandPacketBufferNumberOfBytes + NUMBER_OF_BYTES_TO_GROW + numberOfCommandBytes;
-				uint8_t* newCommandPacketBuffer = new uint8_t[newCommandPacketBufferNumberOfBytes];
-
-				// Copy over current command package buffer content and free it, if required
-				if (nullptr != mCommandPacketBuffer)
-				{
-					memcpy(newCommandPacketBuffer, mCommandPacketBuffer, mCommandPacketBufferNumberOfBytes);
-					delete [] mCommandPacketBuffer;
-				}
-
-				// Finalize
-				mCommandPacketBuffer = newCommandPacketBuffer;
-				mCommandPacketBufferNumberOfBytes = newCommandPacketBufferNumberOfBytes;
-			}
-
-			// Get command package for the new command
-			CommandPacket commandPacket = &mCommandPacketBuffer[mCurrentCommandPacketByteIndex];
-
-			// Setup previous and current command package
-			if (~0u != mPreviousCommandPacketByteIndex)
-			{
-				CommandPacketHelper::storeNextCommandPacketByteIndex(&mCommandPacketBuffer[mPreviousCommandPacketByteIndex], mCurrentCommandPacketByteIndex);
-			}
-			CommandPacketHelper::storeNextCommandPacketByteIndex(commandPacket, ~0u);
+			// Get command package for the new command and link it
+			CommandPacket commandPacket = allocateCommandPacketBytes(numberOfCommandBytes);
+			linkCommandPacket(commandPacket);
 			CommandPacketHelper::storeImplementationDispatchFunctionIndex(commandPacket, U::COMMAND_DISPATCH_FUNCTION_INDEX);
-			mPreviousCommandPacketByteIndex = mCurrentCommandPacketByteIndex;
-			mCurrentCommandPacketByteIndex += numberOfCommandBytes;
 
 			// Done
 			#ifdef RHI_STATISTICS
@@ -8929,6 +9180,10 @@ namespace Rhi
 		*
 		*  @param[in] commandBuffer
 		*    Command buffer to submit the command buffer to
+		*
+		*  @note
+		*    - The command packets are copied block-wise, the command buffer can be cleared or recorded again afterwards
+		*    - See "Rhi::CommandBuffer::submitToCommandBufferByReference()" for a submission without copying the command packets
 		*/
 		inline void submitToCommandBuffer(CommandBuffer& commandBuffer) const
 		{
@@ -8936,55 +9191,33 @@ namespace Rhi
 			ASSERT(this != &commandBuffer, "Can't submit a command buffer to itself")
 			ASSERT(!isEmpty(), "Can't submit empty command buffers")
 
-			// How many command package buffer bytes are consumed by the command to add?
-			const uint32_t numberOfCommandBytes = mCurrentCommandPacketByteIndex;
-
-			// 4294967295 is the maximum value of an "uint32_t"-type: Check for overflow
-			// -> We use the magic number here to avoid "std::numeric_limits::max()" usage
-			ASSERT((static_cast<uint64_t>(commandBuffer.mCurrentCommandPacketByteIndex) + numberOfCommandBytes) < 4294967295u, "Invalid current command packet byte index")
-
-			// Grow command packet buffer, if required
-			if (commandBuffer.mCommandPacketBufferNumberOfBytes < commandBuffer.mCurrentCommandPacketByteIndex + numberOfCommandBytes)
+			// Copy over the command packets one block at a time, command packets are stored one after another inside a block so we just have to link them again
+			const CommandPacketBlock* commandPacketBlock = mFirstCommandPacketBlock;
+			while (true)
 			{
-				// Allocate new memory, grow using a known value but do also add the number of bytes consumed by the current command to add (many auxiliary bytes might be requested)
-				const uint32_t newCommandPacketBufferNumberOfBytes = commandBuffer.mCommandPacketBufferNumberOfBytes + NUMBER_OF_BYTES_TO_GROW + numberOfCommandBytes;
-				uint8_t* newCommandPacketBuffer = new uint8_t[newCommandPacketBufferNumberOfBytes];
+				// Copy over the block content in one burst
+				const uint8_t* sourceBytes = reinterpret_cast<const uint8_t*>(commandPacketBlock + 1);
+				uint8_t* destinationBytes = commandBuffer.allocateCommandPacketBytes(commandPacketBlock->numberOfUsedBytes);
+				memcpy(destinationBytes, sourceBytes, commandPacketBlock->numberOfUsedBytes);
+
+				// Link the copied command packets
+				const ConstCommandPacket nextBlockCommandPacket = (commandPacketBlock != mCurrentCommandPacketBlock) ? reinterpret_cast<const uint8_t*>(commandPacketBlock->nextCommandPacketBlock + 1) : nullptr;
+				ConstCommandPacket constCommandPacket = sourceBytes;
+				do
+				{
+					commandBuffer.linkCommandPacket(destinationBytes + (reinterpret_cast<const uint8_t*>(constCommandPacket) - sourceBytes));
+					constCommandPacket = CommandPacketHelper::getNextCommandPacket(constCommandPacket);
+				} while (nextBlockCommandPacket != constCommandPacket);
 
-				// Copy over current command package buffer content and free it, if required
-				if (nullptr != commandBuffer.mCommandPacketBuffer)
+				// Next block
+				if (commandPacketBlock == mCurrentCommandPacketBlock)
 				{
-					memcpy(newCommandPacketBuffer, commandBuffer.mCommandPacketBuffer, commandBuffer.mCommandPacketBufferNumberOfBytes);
-					delete [] commandBuffer.mCommandPacketBuffer;
+					break;
 				}
-
-				// Finalize
-				commandBuffer.mCommandPacketBuffer = newCommandPacketBuffer;
-				commandBuffer.mCommandPacketBufferNumberOfBytes = newCommandPacketBufferNumberOfBytes;
-			}
-
-			// Copy over the command buffer in one burst
-			memcpy(&commandBuffer.mCommandPacketBuffer[commandBuffer.mCurrentCommandPacketByteIndex], mCommandPacketBuffer, mCurrentCommandPacketByteIndex);
-
-			// Setup previous command package
-			if (~0u != commandBuffer.mPreviousCommandPacketByteIndex)
-			{
-				CommandPacketHelper::storeNextCommandPacketByteIndex(&commandBuffer.mCommandPacketBuffer[commandBuffer.mPreviousCommandPacketByteIndex], commandBuffer.mCurrentCommandPacketByteIndex);
-			}
-
-			// Update command package indices
-			CommandPacket commandPacket = &commandBuffer.mCommandPacketBuffer[commandBuffer.mCurrentCommandPacketByteIndex];
-			uint32_t nextCommandPacketByteIndex = CommandPacketHelper::getNextCommandPacketByteIndex(commandPacket);
-			while (~0u != nextCommandPacketByteIndex)
-			{
-				nextCommandPacketByteIndex = commandBuffer.mCurrentCommandPacketByteIndex + nextCommandPacketByteIndex;
-				CommandPacketHelper::storeNextCommandPacketByteIndex(commandPacket, nextCommandPacketByteIndex);
-				commandPacket = &commandBuffer.mCommandPacketBuffer[nextCommandPacketByteIndex];
-				nextCommandPacketByteIndex = CommandPacketHelper::getNextCommandPacketByteIndex(commandPacket);
+				commandPacketBlock = commandPacketBlock->nextCommandPacketBlock;
 			}
 
 			// Finalize
-			commandBuffer.mPreviousCommandPacketByteIndex = commandBuffer.mCurrentCommandPacketByteIndex + mPreviousCommandPacketByteIndex;
-			commandBuffer.mCurrentCommandPacketByteIndex += mCurrentCommandPacketByteIndex;
 			#ifdef RHI_STATISTICS
 				commandBuffer.mNumberOfCommands += mNumberOfCommands;
 			#endif
@@ -9003,18 +9236,90 @@ namespace Rhi
 			clear();
 		}
 
+		/**
+		*  @brief
+		*    Submit the command buffer by reference to another command buffer, this is a single "Rhi::Command::ExecuteCommandBuffer" command independent of the number of commands
+		*
+		*  @param[in] commandBuffer
+		*    Command buffer to submit the command buffer to
+		*
+		*  @note
+		*    - The command buffer mustn't be cleared, recorded again or destroyed until the given command buffer was submitted to the RHI
+		*/
+		inline void submitToCommandBufferByReference(CommandBuffer& commandBuffer) const;
+
 	// Private definitions
 	private:
-		static constexpr uint32_t NUMBER_OF_BYTES_TO_GROW = 8192;
+		static constexpr uint32_t NUMBER_OF_BYTES_PER_BLOCK = 16384;	///< Default number of command packet bytes per memory block, commands with a lot of auxiliary bytes get a larger memory block
+
+		struct CommandPacketBlock final
+		{
+			CommandPacketBlock* nextCommandPacketBlock;
+			uint32_t			numberOfBytes;		///< Number of command packet bytes following the memory block header
+			uint32_t			numberOfUsedBytes;	///< Number of currently used command packet bytes
+		};
+
+	// Private methods
+	private:
+		explicit CommandBuffer(const CommandBuffer&) = delete;
+		CommandBuffer& operator=(const CommandBuffer&) = delete;
+
+		[[nodiscard]] uint8_t* allocateCommandPacketBytes(uint32_t numberOfBytes)
+		{
+			// Move on to the next memory block, if required
+			if (nullptr == mCurrentCommandPacketBlock || mCurrentCommandPacketBlock->numberOfUsedBytes + numberOfBytes > mCurrentCommandPacketBlock->numberOfBytes)
+			{
+				// Reuse the next already existing memory block, if possible
+				CommandPacketBlock* commandPacketBlock = (nullptr != mCurrentCommandPacketBlock) ? mCurrentCommandPacketBlock->nextCommandPacketBlock : mFirstCommandPacketBlock;
+				if (nullptr == commandPacketBlock || commandPacketBlock->numberOfBytes < numberOfBytes)
+				{
+					// Allocate a new memory block and insert it into the chain, existing command packets are never moved
+					const uint32_t numberOfBlockBytes = (numberOfBytes > NUMBER_OF_BYTES_PER_BLOCK) ? numberOfBytes : NUMBER_OF_BYTES_PER_BLOCK;
+					CommandPacketBlock* newCommandPacketBlock = reinterpret_cast<CommandPacketBlock*>(new uint8_t[sizeof(CommandPacketBlock) + numberOfBlockBytes]);
+					newCommandPacketBlock->nextCommandPacketBlock = commandPacketBlock;
+					newCommandPacketBlock->numberOfBytes = numberOfBlockBytes;
+					if (nullptr != mCurrentCommandPacketBlock)
+					{
+						mCurrentCommandPacketBlock->nextCommandPacketBlock = newCommandPacketBlock;
+					}
+					else
+					{
+						mFirstCommandPacketBlock = newCommandPacketBlock;
+					}
+					commandPacketBlock = newCommandPacketBlock;
+				}
+				commandPacketBlock->numberOfUsedBytes = 0;
+				mCurrentCommandPacketBlock = commandPacketBlock;
+			}
+
+			// Done
+			uint8_t* bytes = reinterpret_cast<uint8_t*>(mCurrentCommandPacketBlock + 1) + mCurrentCommandPacketBlock->numberOfUsedBytes;
+			mCurrentCommandPacketBlock->numberOfUsedBytes += numberOfBytes;
+			return bytes;
+		}
+
+		inline void linkCommandPacket(CommandPacket commandPacket)
+		{
+			if (nullptr != mPreviousCommandPacket)
+			{
+				CommandPacketHelper::storeNextCommandPacket(mPreviousCommandPacket, commandPacket);
+			}
+			else
+			{
+				mFirstCommandPacket = commandPacket;
+			}
+			CommandPacketHelper::storeNextCommandPacket(commandPacket, nullptr);
+			mPreviousCommandPacket = commandPacket;
+		}
 
 	// Private data
 	private:
 		// Memory
-		uint32_t mCommandPacketBufferNumberOfBytes;
-		uint8_t* mCommandPacketBuffer;
+		CommandPacketBlock* mFirstCommandPacketBlock;	///< First memory block, the memory blocks up to and including the current memory block are in use
+		CommandPacketBlock* mCurrentCommandPacketBlock;	///< Memory block new command packets are added to, null pointer if the command buffer is empty
 		// Current state
-		uint32_t mPreviousCommandPacketByteIndex;
-		uint32_t mCurrentCommandPacketByteIndex;
+		CommandPacket mFirstCommandPacket;
+		CommandPacket mPreviousCommandPacket;
 		#ifdef RHI_STATISTICS
 			uint32_t mNumberOfCommands;
 		#endif
@@ -9031,17 +9336,17 @@ namespace Rhi
 		struct ExecuteCommandBuffer final
 		{
 			// Static methods
-			static inline void create(CommandBuffer& commandBuffer, CommandBuffer* commandBufferToExecute)
+			static inline void create(CommandBuffer& commandBuffer, const CommandBuffer* commandBufferToExecute)
 			{
 				ASSERT(nullptr != commandBufferToExecute, "Invalid command buffer to execute")
 				*commandBuffer.addCommand<ExecuteCommandBuffer>() = ExecuteCommandBuffer(commandBufferToExecute);
 			}
 			// Constructor
-			inline explicit ExecuteCommandBuffer(CommandBuffer* _commandBufferToExecute) :
+			inline explicit ExecuteCommandBuffer(const CommandBuffer* _commandBufferToExecute) :
 				commandBufferToExecute(_commandBufferToExecute)
 			{}
 			// Data
-			CommandBuffer* commandBufferToExecute;
+			const CommandBuffer* commandBufferToExecute;
 			// Static data
 			static constexpr CommandDispatchFunctionIndex COMMAND_DISPATCH_FUNCTION_INDEX = CommandDispatchFunctionIndex::EXECUTE_COMMAND_BUFFER;
 		};
@@ -9581,6 +9886,37 @@ namespace Rhi
 			static constexpr CommandDispatchFunctionIndex COMMAND_DISPATCH_FUNCTION_INDEX = CommandDispatchFunctionIndex::DISPATCH_COMPUTE;
 		};
 
+		/**
+		*  @brief
+		*    Compute buffer barrier, orders the accesses to the given buffer in between compute dispatches writing the buffer and other commands accessing it
+		*
+		*  @param[in] buffer
+		*    Vertex, index, texture, structured or indirect buffer which is written by a compute shader via an unordered access view (UAV)
+		*
+		*  @note
+		*    - Only supported if "Rhi::Capabilities::computeShader" is true
+		*    - Record it after a compute dispatch writing the buffer and before the next command accessing the buffer, e.g. an indirect draw consuming the draw arguments
+		*    - Record it as well after commands accessing the buffer and before the next compute dispatch writing the buffer again
+		*    - RHI implementations which track the hazards on their own treat this command as no operation
+		*    - Vulkan: Must be recorded outside of a render pass, this is the case after setting a graphics render target and before the first draw (same as for "Rhi::Command::ClearGraphics")
+		*/
+		struct ComputeBufferBarrier final
+		{
+			// Static methods
+			static inline void create(CommandBuffer& commandBuffer, IBuffer& buffer)
+			{
+				*commandBuffer.addCommand<ComputeBufferBarrier>() = ComputeBufferBarrier(buffer);
+			}
+			// Constructor
+			inline explicit ComputeBufferBarrier(IBuffer& _buffer) :
+				buffer(&_buffer)
+			{}
+			// Data
+			IBuffer* buffer;
+			// Static data
+			static constexpr CommandDispatchFunctionIndex COMMAND_DISPATCH_FUNCTION_INDEX = CommandDispatchFunctionIndex::COMPUTE_BUFFER_BARRIER;
+		};
+
 		//[-------------------------------------------------------]
 		//[ Resource                                              ]
 		//[-------------------------------------------------------]
@@ -9923,6 +10259,141 @@ namespace Rhi
 
 	}
 
+	// Command buffer methods which need the concrete commands
+	inline void CommandBuffer::submitToCommandBufferByReference(CommandBuffer& commandBuffer) const
+	{
+		// Sanity checks
+		ASSERT(this != &commandBuffer, "Can't submit a command buffer to itself")
+		ASSERT(!isEmpty(), "Can't submit empty command buffers")
+
+		// Just a single command, no matter how many commands are inside this command buffer
+		Command::ExecuteCommandBuffer::create(commandBuffer, this);
+	}
+
+	// Statistics methods which need the concrete commands
+	#ifdef RHI_STATISTICS
+		static_assert(static_cast<uint32_t>(CommandDispatchFunctionIndex::NUMBER_OF_FUNCTIONS) <= Statistics::MAXIMUM_NUMBER_OF_COMMAND_DISPATCH_FUNCTIONS, "Increase \"Rhi::Statistics::MAXIMUM_NUMBER_OF_COMMAND_DISPATCH_FUNCTIONS\"");
+
+		inline void Statistics::FrameStatistics::countCommandPacket(CommandDispatchFunctionIndex commandDispatchFunctionIndex, const void* command)
+		{
+			++numberOfCommandPackets[static_cast<uint32_t>(commandDispatchFunctionIndex)];
+			switch (commandDispatchFunctionIndex)
+			{
+				case CommandDispatchFunctionIndex::DRAW_GRAPHICS:
+				{
+					const Command::DrawGraphics* realData = static_cast<const Command::DrawGraphics*>(command);
+					numberOfDraws += realData->numberOfDraws;
+					const uint8_t* emulationData = (nullptr != realData->indirectBuffer) ? realData->indirectBuffer->getEmulationData() : CommandPacketHelper::getAuxiliaryMemory(realData);
+					if (nullptr != emulationData)
+					{
+						const DrawArguments* drawArguments = reinterpret_cast<const DrawArguments*>(emulationData + realData->indirectBufferOffset);
+						for (uint32_t i = 0; i < realData->numberOfDraws; ++i, ++drawArguments)
+						{
+							numberOfSubmittedInstances += drawArguments->instanceCount;
+							numberOfSubmittedVertices += static_cast<uint64_t>(drawArguments->vertexCountPerInstance) * drawArguments->instanceCount;
+						}
+					}
+					break;
+				}
+
+				case CommandDispatchFunctionIndex::DRAW_INDEXED_GRAPHICS:
+				{
+					const Command::DrawIndexedGraphics* realData = static_cast<const Command::DrawIndexedGraphics*>(command);
+					numberOfDraws += realData->numberOfDraws;
+					const uint8_t* emulationData = (nullptr != realData->indirectBuffer) ? realData->indirectBuffer->getEmulationData() : CommandPacketHelper::getAuxiliaryMemory(realData);
+					if (nullptr != emulationData)
+					{
+						const DrawIndexedArguments* drawIndexedArguments = reinterpret_cast<const DrawIndexedArguments*>(emulationData + realData->indirectBufferOffset);
+						for (uint32_t i = 0; i < realData->numberOfDraws; ++i, ++drawIndexedArguments)
+						{
+							numberOfSubmittedInstances += drawIndexedArguments->instanceCount;
+							numberOfSubmittedVertices += static_cast<uint64_t>(drawIndexedArguments->indexCountPerInstance) * drawIndexedArguments->instanceCount;
+						}
+					}
+					break;
+				}
+
+				case CommandDispatchFunctionIndex::EXECUTE_COMMAND_BUFFER:
+				case CommandDispatchFunctionIndex::SET_GRAPHICS_ROOT_SIGNATURE:
+				case CommandDispatchFunctionIndex::SET_GRAPHICS_PIPELINE_STATE:
+				case CommandDispatchFunctionIndex::SET_GRAPHICS_RESOURCE_GROUP:
+				case CommandDispatchFunctionIndex::SET_GRAPHICS_VERTEX_ARRAY:
+				case CommandDispatchFunctionIndex::SET_GRAPHICS_VIEWPORTS:
+				case CommandDispatchFunctionIndex::SET_GRAPHICS_SCISSOR_RECTANGLES:
+				case CommandDispatchFunctionIndex::SET_GRAPHICS_RENDER_TARGET:
+				case CommandDispatchFunctionIndex::CLEAR_GRAPHICS:
+				case CommandDispatchFunctionIndex::SET_COMPUTE_ROOT_SIGNATURE:
+				case CommandDispatchFunctionIndex::SET_COMPUTE_PIPELINE_STATE:
+				case CommandDispatchFunctionIndex::SET_COMPUTE_RESOURCE_GROUP:
+				case CommandDispatchFunctionIndex::DISPATCH_COMPUTE:
+				case CommandDispatchFunctionIndex::COMPUTE_BUFFER_BARRIER:
+				case CommandDispatchFunctionIndex::SET_TEXTURE_MINIMUM_MAXIMUM_MIPMAP_INDEX:
+				case CommandDispatchFunctionIndex::RESOLVE_MULTISAMPLE_FRAMEBUFFER:
+				case CommandDispatchFunctionIndex::COPY_RESOURCE:
+				case CommandDispatchFunctionIndex::GENERATE_MIPMAPS:
+				case CommandDispatchFunctionIndex::RESET_QUERY_POOL:
+				case CommandDispatchFunctionIndex::BEGIN_QUERY:
+				case CommandDispatchFunctionIndex::END_QUERY:
+				case CommandDispatchFunctionIndex::WRITE_TIMESTAMP_QUERY:
+				case CommandDispatchFunctionIndex::SET_DEBUG_MARKER:
+				case CommandDispatchFunctionIndex::BEGIN_DEBUG_EVENT:
+				case CommandDispatchFunctionIndex::END_DEBUG_EVENT:
+				case CommandDispatchFunctionIndex::NUMBER_OF_FUNCTIONS:
+					// Nothing here, the command packet counter is sufficient
+					break;
+			}
+		}
+
+		inline void Statistics::FrameStatistics::countMap(const IResource& resource, uint32_t subresource, MapType mapType)
+		{
+			++numberOfMaps;
+			if (MapType::READ != mapType)
+			{
+				switch (resource.getResourceType())
+				{
+					case ResourceType::VERTEX_BUFFER:
+					case ResourceType::INDEX_BUFFER:
+					case ResourceType::TEXTURE_BUFFER:
+					case ResourceType::STRUCTURED_BUFFER:
+					case ResourceType::INDIRECT_BUFFER:
+					case ResourceType::UNIFORM_BUFFER:
+						numberOfWrittenBytes += static_cast<const IBuffer&>(resource).getStatisticsNumberOfBytes();
+						break;
+
+					case ResourceType::TEXTURE_1D:
+					case ResourceType::TEXTURE_1D_ARRAY:
+					case ResourceType::TEXTURE_2D:
+					case ResourceType::TEXTURE_2D_ARRAY:
+					case ResourceType::TEXTURE_3D:
+					case ResourceType::TEXTURE_CUBE:
+					case ResourceType::TEXTURE_CUBE_ARRAY:
+						numberOfWrittenBytes += static_cast<const ITexture&>(resource).getStatisticsNumberOfSubresourceBytes(subresource);
+						break;
+
+					case ResourceType::ROOT_SIGNATURE:
+					case ResourceType::RESOURCE_GROUP:
+					case ResourceType::GRAPHICS_PROGRAM:
+					case ResourceType::VERTEX_ARRAY:
+					case ResourceType::RENDER_PASS:
+					case ResourceType::QUERY_POOL:
+					case ResourceType::SWAP_CHAIN:
+					case ResourceType::FRAMEBUFFER:
+					case ResourceType::GRAPHICS_PIPELINE_STATE:
+					case ResourceType::COMPUTE_PIPELINE_STATE:
+					case ResourceType::SAMPLER_STATE:
+					case ResourceType::VERTEX_SHADER:
+					case ResourceType::TESSELLATION_CONTROL_SHADER:
+					case ResourceType::TESSELLATION_EVALUATION_SHADER:
+					case ResourceType::GEOMETRY_SHADER:
+					case ResourceType::FRAGMENT_SHADER:
+					case ResourceType::COMPUTE_SHADER:
+						// Nothing here, not mappable
+						break;
+				}
+			}
+		}
+	#endif
+
 	// Debug macros
 	#ifdef RHI_DEBUG
 		/**